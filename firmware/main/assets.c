@@ -0,0 +1,189 @@
+#include "assets.h"
+
+#include <stdlib.h>
+#include "esp_log.h"
+#include "esp_partition.h"
+#include "esp_rom_crc.h"
+#include "image_lz4.h"
+
+static const char *TAG = "assets";
+
+_Static_assert(sizeof(lv_font_fmt_txt_glyph_dsc_t) == ASSETS_GLYPH_DSC_SIZE,
+               "The glyph descriptors are stored in the LVGL layout");
+_Static_assert((int)ASSETS_CMAP_FORMAT0_FULL == (int)LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL &&
+                   (int)ASSETS_CMAP_SPARSE_FULL == (int)LV_FONT_FMT_TXT_CMAP_SPARSE_FULL &&
+                   (int)ASSETS_CMAP_FORMAT0_TINY == (int)LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY &&
+                   (int)ASSETS_CMAP_SPARSE_TINY == (int)LV_FONT_FMT_TXT_CMAP_SPARSE_TINY,
+               "The cmap types are stored as LVGL numbers them");
+
+static const uint8_t *base;
+static const assets_header_t *header;
+static esp_partition_mmap_handle_t mmap_handle;
+
+bool assets_init(void)
+{
+    const esp_partition_t *partition =
+        esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, ASSETS_PARTITION);
+    if (!partition)
+    {
+        ESP_LOGE(TAG, "No \"%s\" partition", ASSETS_PARTITION);
+        return false;
+    }
+    const void *ptr;
+    esp_err_t err = esp_partition_mmap(partition, 0, partition->size, ESP_PARTITION_MMAP_DATA, &ptr, &mmap_handle);
+    if (err != ESP_OK)
+    {
+        ESP_LOGE(TAG, "Failed to map the assets (%s)", esp_err_to_name(err));
+        return false;
+    }
+
+    const assets_header_t *h = ptr;
+    if (!assets_pack_check(h, partition->size))
+    {
+        ESP_LOGE(TAG, "No asset pack in the partition, flash it with idf.py assets-flash");
+        esp_partition_munmap(mmap_handle);
+        return false;
+    }
+    uint32_t crc = esp_rom_crc32_le(0, (const uint8_t *)ptr + sizeof(assets_header_t), h->size - sizeof(assets_header_t));
+    if (crc != h->crc32)
+    {
+        ESP_LOGE(TAG, "Asset pack is corrupt (CRC %08lx, expected %08lx)", (unsigned long)crc, (unsigned long)h->crc32);
+        esp_partition_munmap(mmap_handle);
+        return false;
+    }
+
+    base = ptr;
+    header = h;
+    ESP_LOGI(TAG, "%d assets, %lu bytes mapped", h->count, (unsigned long)h->size);
+    return true;
+}
+
+// The record of the named asset, NULL if there is none of that type or it doesn't fit in the pack. The CRC only
+// catches corruption, this catches a pack whose layout doesn't match the structs.
+static const void *find(const char *name, assets_type_t type)
+{
+    if (!header)
+    {
+        return NULL;
+    }
+    const assets_entry_t *entry = assets_pack_find(header, name, type);
+    if (!entry)
+    {
+        ESP_LOGE(TAG, "No asset \"%s\"", name);
+        return NULL;
+    }
+    if (!assets_pack_record_valid(header, entry))
+    {
+        ESP_LOGE(TAG, "Asset \"%s\" points outside of the pack", name);
+        return NULL;
+    }
+    return base + entry->offset;
+}
+
+const lv_image_dsc_t *assets_image(const char *name)
+{
+    const assets_image_t *record = find(name, ASSETS_TYPE_IMAGE);
+    if (!record)
+    {
+        return NULL;
+    }
+    lv_image_dsc_t *image = calloc(1, sizeof(lv_image_dsc_t));
+    if (!image)
+    {
+        return NULL;
+    }
+    image->header.magic = LV_IMAGE_HEADER_MAGIC;
+    image->header.cf = LV_COLOR_FORMAT_RGB565;
+    image->header.flags = record->format == ASSETS_IMAGE_RGB565_LZ4 ? IMAGE_LZ4_FLAG : 0;
+    image->header.w = record->w;
+    image->header.h = record->h;
+    image->header.stride = record->stride;
+    image->data_size = record->data_size;
+    image->data = (const uint8_t *)record + record->data;
+    return image;
+}
+
+static const void *record_ptr(const void *record, uint32_t offset)
+{
+    return offset ? (const uint8_t *)record + offset : NULL;
+}
+
+const lv_font_t *assets_font(const char *name)
+{
+    const assets_font_t *record = find(name, ASSETS_TYPE_FONT);
+    if (!record)
+    {
+        return NULL;
+    }
+
+    // The descriptors are small and hold pointers, so they are built in RAM around the mapped arrays
+    lv_font_t *font = calloc(1, sizeof(lv_font_t));
+    lv_font_fmt_txt_dsc_t *dsc = calloc(1, sizeof(lv_font_fmt_txt_dsc_t));
+    lv_font_fmt_txt_cmap_t *cmaps = calloc(record->cmap_num, sizeof(lv_font_fmt_txt_cmap_t));
+    lv_font_fmt_txt_kern_classes_t *classes = calloc(1, sizeof(lv_font_fmt_txt_kern_classes_t));
+    lv_font_fmt_txt_kern_pair_t *pairs = calloc(1, sizeof(lv_font_fmt_txt_kern_pair_t));
+    if (!font || !dsc || !cmaps || !classes || !pairs)
+    {
+        free(font);
+        free(dsc);
+        free(cmaps);
+        free(classes);
+        free(pairs);
+        return NULL;
+    }
+
+    const assets_cmap_t *stored_cmaps = record_ptr(record, record->cmaps);
+    for (int i = 0; i < record->cmap_num; i++)
+    {
+        cmaps[i].range_start = stored_cmaps[i].range_start;
+        cmaps[i].range_length = stored_cmaps[i].range_length;
+        cmaps[i].glyph_id_start = stored_cmaps[i].glyph_id_start;
+        cmaps[i].unicode_list = record_ptr(record, stored_cmaps[i].unicode_list);
+        cmaps[i].glyph_id_ofs_list = record_ptr(record, stored_cmaps[i].glyph_id_ofs_list);
+        cmaps[i].list_length = stored_cmaps[i].list_length;
+        cmaps[i].type = stored_cmaps[i].type;
+    }
+
+    dsc->glyph_bitmap = record_ptr(record, record->bitmap);
+    dsc->glyph_dsc = record_ptr(record, record->glyph_dsc);
+    dsc->cmaps = cmaps;
+    dsc->kern_scale = record->kern_scale;
+    dsc->cmap_num = record->cmap_num;
+    dsc->bpp = record->bpp;
+    dsc->bitmap_format = record->bitmap_format;
+    if (record->kern == ASSETS_KERN_CLASSES)
+    {
+        classes->left_class_mapping = record_ptr(record, record->kern_left);
+        classes->right_class_mapping = record_ptr(record, record->kern_right);
+        classes->class_pair_values = record_ptr(record, record->kern_values);
+        classes->left_class_cnt = record->kern_left_cnt;
+        classes->right_class_cnt = record->kern_right_cnt;
+        dsc->kern_dsc = classes;
+        dsc->kern_classes = 1;
+        free(pairs);
+    }
+    else if (record->kern == ASSETS_KERN_PAIRS)
+    {
+        pairs->glyph_ids = record_ptr(record, record->kern_left);
+        pairs->values = record_ptr(record, record->kern_values);
+        pairs->pair_cnt = record->kern_pair_cnt;
+        pairs->glyph_ids_size = record->kern_left_cnt == 2 ? 1 : 0;
+        dsc->kern_dsc = pairs;
+        free(classes);
+    }
+    else
+    {
+        free(classes);
+        free(pairs);
+    }
+
+    font->get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt;
+    font->get_glyph_bitmap = lv_font_get_bitmap_fmt_txt;
+    font->line_height = record->line_height;
+    font->base_line = record->base_line;
+    font->subpx = LV_FONT_SUBPX_NONE;
+    font->underline_position = record->underline_position;
+    font->underline_thickness = record->underline_thickness;
+    font->dsc = dsc;
+    return font;
+}
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "assets_pack.h"
+#include "lvgl.h"
+
+// Images and fonts packed by tools/pack_assets.py into the "assets" data partition, which is flashed separately from
+// the app (idf.py assets-flash). The partition is memory mapped and the LVGL descriptors point into the mapping, the
+// pixels and glyphs are read through the flash cache in place like the app's own constants. The layout is in
+// assets_pack.h.
+#define ASSETS_PARTITION "assets"
+
+// Maps the partition and checks the header and CRC. Returns false if it is missing or not a valid asset pack.
+bool assets_init(void);
+
+// Creates a descriptor for the named image or font pointing into the mapping, call once per asset. NULL if the pack
+// doesn't have it or its record points outside of it.
+const lv_image_dsc_t *assets_image(const char *name);
+const lv_font_t *assets_font(const char *name);
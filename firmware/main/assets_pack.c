@@ -0,0 +1,125 @@
+#include "assets_pack.h"
+
+#include <stddef.h>
+#include <string.h>
+
+_Static_assert(sizeof(assets_header_t) == 16, "assets_header_t must match tools/pack_assets.py");
+_Static_assert(sizeof(assets_entry_t) == 36, "assets_entry_t must match tools/pack_assets.py");
+_Static_assert(sizeof(assets_image_t) == 16, "assets_image_t must match tools/pack_assets.py");
+_Static_assert(sizeof(assets_font_t) == 56, "assets_font_t must match tools/pack_assets.py");
+_Static_assert(sizeof(assets_cmap_t) == 20, "assets_cmap_t must match tools/pack_assets.py");
+
+bool assets_pack_check(const assets_header_t *header, uint32_t capacity)
+{
+    return capacity >= sizeof(assets_header_t) && header->magic == ASSETS_MAGIC &&
+           header->version == ASSETS_VERSION && header->size <= capacity &&
+           header->size >= sizeof(assets_header_t) + header->count * sizeof(assets_entry_t);
+}
+
+const assets_entry_t *assets_pack_find(const assets_header_t *header, const char *name, assets_type_t type)
+{
+    const assets_entry_t *entries = (const assets_entry_t *)(header + 1);
+    for (int i = 0; i < header->count; i++)
+    {
+        if (entries[i].type == type && strncmp(entries[i].name, name, ASSETS_NAME_SIZE) == 0)
+        {
+            return &entries[i];
+        }
+    }
+    return NULL;
+}
+
+// Whether `size` bytes at `offset` lie inside a record of `record_size` bytes. The record is read in place through
+// the flash cache, so the offset also has to keep the word loads aligned. Offset 0 is no array, which is never valid
+// where LVGL reads one.
+static bool in_record(uint32_t record_size, uint32_t offset, uint64_t size)
+{
+    return offset != 0 && offset % 4 == 0 && offset <= record_size && size <= record_size - offset;
+}
+
+static bool image_valid(const assets_image_t *image, uint32_t record_size)
+{
+    if (!in_record(record_size, image->data, image->data_size))
+    {
+        return false;
+    }
+    if (image->format == ASSETS_IMAGE_RGB565_LZ4)
+    {
+        // The decoded size comes from the header, LZ4_decompress_safe stops at it
+        return image->data_size > 0;
+    }
+    return image->format == ASSETS_IMAGE_RGB565 && image->stride >= image->w * 2 &&
+           image->data_size >= (uint64_t)image->stride * image->h;
+}
+
+static bool cmap_valid(const assets_cmap_t *cmap, uint32_t record_size)
+{
+    switch (cmap->type)
+    {
+    case ASSETS_CMAP_FORMAT0_FULL:
+        return in_record(record_size, cmap->glyph_id_ofs_list, cmap->range_length);
+    case ASSETS_CMAP_SPARSE_FULL:
+        return in_record(record_size, cmap->unicode_list, cmap->list_length * 2ULL) &&
+               in_record(record_size, cmap->glyph_id_ofs_list, cmap->list_length * 2ULL);
+    case ASSETS_CMAP_FORMAT0_TINY:
+        return true;
+    case ASSETS_CMAP_SPARSE_TINY:
+        return in_record(record_size, cmap->unicode_list, cmap->list_length * 2ULL);
+    default:
+        return false;
+    }
+}
+
+static bool font_valid(const assets_font_t *font, const uint8_t *record, uint32_t record_size)
+{
+    if (!in_record(record_size, font->bitmap, font->bitmap_size) ||
+        !in_record(record_size, font->glyph_dsc, (uint64_t)font->glyph_cnt * ASSETS_GLYPH_DSC_SIZE) ||
+        !in_record(record_size, font->cmaps, (uint64_t)font->cmap_num * sizeof(assets_cmap_t)))
+    {
+        return false;
+    }
+    const assets_cmap_t *cmaps = (const assets_cmap_t *)(record + font->cmaps);
+    for (int i = 0; i < font->cmap_num; i++)
+    {
+        if (!cmap_valid(&cmaps[i], record_size))
+        {
+            return false;
+        }
+    }
+
+    switch (font->kern)
+    {
+    case ASSETS_KERN_NONE:
+        return true;
+    case ASSETS_KERN_CLASSES:
+        return in_record(record_size, font->kern_left, font->glyph_cnt) &&
+               in_record(record_size, font->kern_right, font->glyph_cnt) &&
+               in_record(record_size, font->kern_values, (uint64_t)font->kern_left_cnt * font->kern_right_cnt);
+    case ASSETS_KERN_PAIRS:
+        return (font->kern_left_cnt == 1 || font->kern_left_cnt == 2) &&
+               in_record(record_size, font->kern_left, 2ULL * font->kern_pair_cnt * font->kern_left_cnt) &&
+               in_record(record_size, font->kern_values, font->kern_pair_cnt);
+    default:
+        return false;
+    }
+}
+
+bool assets_pack_record_valid(const assets_header_t *header, const assets_entry_t *entry)
+{
+    uint32_t records = sizeof(assets_header_t) + header->count * sizeof(assets_entry_t);
+    if (entry->offset < records || entry->offset % 4 != 0 || entry->offset > header->size ||
+        entry->size > header->size - entry->offset)
+    {
+        return false;
+    }
+    const uint8_t *record = (const uint8_t *)header + entry->offset;
+    switch (entry->type)
+    {
+    case ASSETS_TYPE_IMAGE:
+        return entry->size >= sizeof(assets_image_t) && image_valid((const assets_image_t *)record, entry->size);
+    case ASSETS_TYPE_FONT:
+        return entry->size >= sizeof(assets_font_t) && font_valid((const assets_font_t *)record, record, entry->size);
+    default:
+        return false;
+    }
+}
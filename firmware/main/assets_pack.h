@@ -0,0 +1,118 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Layout of the asset pack written by tools/pack_assets.py, little endian: an assets_header_t, count assets_entry_t,
+// then the records the entries point to. The CRC covers everything after the header. Records and the arrays in them
+// are 4 byte aligned. No ESP-IDF or LVGL dependencies, so the checks can run on the host.
+#define ASSETS_MAGIC 0x54455341 // "ASET"
+#define ASSETS_VERSION 2
+#define ASSETS_NAME_SIZE 24
+#define ASSETS_GLYPH_DSC_SIZE 8 // lv_font_fmt_txt_glyph_dsc_t
+
+typedef struct
+{
+    uint32_t magic;
+    uint16_t version;
+    uint16_t count;
+    uint32_t size; // Bytes used in the partition, header included
+    uint32_t crc32;
+} assets_header_t;
+
+typedef enum
+{
+    ASSETS_TYPE_IMAGE,
+    ASSETS_TYPE_FONT,
+} assets_type_t;
+
+typedef struct
+{
+    char name[ASSETS_NAME_SIZE];
+    uint32_t type;
+    uint32_t offset; // Of the record, from the start of the partition
+    uint32_t size;
+} assets_entry_t;
+
+typedef enum
+{
+    ASSETS_IMAGE_RGB565,
+    ASSETS_IMAGE_RGB565_LZ4, // Decoded by image_lz4.c
+} assets_image_format_t;
+
+// Offsets in the records are from the start of the record, 0 for none.
+typedef struct
+{
+    uint32_t data;
+    uint32_t data_size;
+    uint16_t w;
+    uint16_t h;
+    uint16_t stride;
+    uint8_t format;
+    uint8_t reserved;
+} assets_image_t;
+
+typedef enum
+{
+    ASSETS_KERN_NONE,
+    ASSETS_KERN_CLASSES,
+    ASSETS_KERN_PAIRS,
+} assets_kern_t;
+
+// An lv_font_conv font, the arrays are stored as the generated C file defines them.
+typedef struct
+{
+    uint32_t bitmap;
+    uint32_t bitmap_size;
+    uint32_t glyph_dsc; // lv_font_fmt_txt_glyph_dsc_t[glyph_cnt], glyph 0 included
+    uint32_t glyph_cnt;
+    uint32_t cmaps;     // assets_cmap_t[cmap_num]
+    uint32_t kern_left; // Left and right class mappings and class pair values, or pair glyph ids and values
+    uint32_t kern_right;
+    uint32_t kern_values;
+    uint32_t kern_pair_cnt;
+    int16_t line_height;
+    int16_t base_line;
+    int8_t underline_position;
+    int8_t underline_thickness;
+    uint16_t kern_scale;
+    uint16_t cmap_num;
+    uint8_t bpp;
+    uint8_t bitmap_format;
+    uint8_t kern;           // assets_kern_t
+    uint8_t kern_left_cnt;  // Left class count, or the size of a pair glyph id
+    uint8_t kern_right_cnt; // Right class count
+    uint8_t reserved[5];
+} assets_font_t;
+
+// The values of lv_font_fmt_txt_cmap_type_t.
+typedef enum
+{
+    ASSETS_CMAP_FORMAT0_FULL,
+    ASSETS_CMAP_SPARSE_FULL,
+    ASSETS_CMAP_FORMAT0_TINY,
+    ASSETS_CMAP_SPARSE_TINY,
+} assets_cmap_type_t;
+
+typedef struct
+{
+    uint32_t range_start;
+    uint32_t unicode_list;
+    uint32_t glyph_id_ofs_list;
+    uint16_t range_length;
+    uint16_t glyph_id_start;
+    uint16_t list_length;
+    uint8_t type; // assets_cmap_type_t
+    uint8_t reserved;
+} assets_cmap_t;
+
+// Whether the header at the start of `capacity` mapped bytes is a pack of this version that fits in them, with its
+// entry table. The CRC is left to the caller.
+bool assets_pack_check(const assets_header_t *header, uint32_t capacity);
+
+// The entry of the named asset in a checked pack, NULL if there is none of that type.
+const assets_entry_t *assets_pack_find(const assets_header_t *header, const char *name, assets_type_t type);
+
+// Whether the entry lies inside the pack and its record, and every array the record points to with the length LVGL
+// reads from it, lie inside the entry.
+bool assets_pack_record_valid(const assets_header_t *header, const assets_entry_t *entry);
@@ -0,0 +1,4167 @@
+// Generated by tools/compress_image.py from beach.c, do not edit.
+// 255360 bytes of RGB565 packed into 132736 bytes with LZ4.
+
+#include "lvgl.h"
+#include "image_lz4.h"
+
+static const LV_ATTRIBUTE_LARGE_CONST uint8_t beach_lz4_map[] = {
+  0x2f, 0x7c, 0x75, 0x02, 0x00, 0x3b, 0x1e, 0x5c, 0x0c, 0x00, 0x0f, 0x2e, 0x00, 0x12, 0x10, 0x5c, 0x02, 0x00, 0x15, 0x6d, 0x02, 0x00, 0x08, 0x0c, 0x00, 0x0f, 0x02, 0x00, 0x38, 0x14, 0x3c, 0x08,
+  0x00, 0x15, 0x65, 0x02, 0x00, 0x1f, 0x6d, 0x02, 0x00, 0x06, 0x07, 0x22, 0x00, 0x01, 0x92, 0x00, 0x00, 0xa8, 0x00, 0xb0, 0x7d, 0x7c, 0x7d, 0x5c, 0x75, 0x3b, 0x75, 0x1b, 0x6d, 0x3b, 0x6d, 0x04,
+  0x00, 0xe0, 0x5c, 0x6d, 0x1b, 0x65, 0x3b, 0x6d, 0x3b, 0x6d, 0x3b, 0x65, 0x1b, 0x65, 0x3b, 0x65, 0x06, 0x00, 0x13, 0x1b, 0x36, 0x00, 0x16, 0x3b, 0x62, 0x00, 0x07, 0x02, 0x00, 0x1b, 0x1c, 0x0e,
+  0x00, 0x01, 0x02, 0x00, 0x13, 0x5d, 0x08, 0x00, 0x06, 0x0e, 0x00, 0x14, 0x5d, 0x02, 0x00, 0x17, 0x3c, 0x0c, 0x00, 0x0f, 0x02, 0x00, 0x13, 0x11, 0x1b, 0x02, 0x00, 0x06, 0x0e, 0x00, 0x0c, 0x18,
+  0x00, 0x1d, 0x1b, 0x02, 0x00, 0x0f, 0x48, 0x00, 0x07, 0x0f, 0x2e, 0x00, 0x01, 0x2a, 0x1b, 0x65, 0x02, 0x00, 0x30, 0x3b, 0x6d, 0x3a, 0x02, 0x00, 0x61, 0x75, 0x3a, 0x75, 0x3a, 0x7d, 0x5a, 0x02,
+  0x00, 0x10, 0x3a, 0x02, 0x00, 0x50, 0x75, 0x1a, 0x75, 0x1a, 0x75, 0x16, 0x00, 0x11, 0x1a, 0x0a, 0x00, 0x00, 0x14, 0x00, 0xb4, 0x5a, 0x85, 0x7a, 0x8d, 0x7a, 0x95, 0x7a, 0x95, 0x7a, 0x9d, 0x9a,
+  0x02, 0x00, 0x20, 0xa5, 0xba, 0x02, 0x00, 0x10, 0x9d, 0x02, 0x00, 0x00, 0x0a, 0x00, 0x2a, 0x9a, 0x9d, 0x02, 0x00, 0x01, 0x16, 0x00, 0x13, 0x9d, 0x02, 0x00, 0x00, 0x12, 0x00, 0x12, 0x95, 0x02,
+  0x00, 0x31, 0x9b, 0x9d, 0xbb, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x10, 0x7a, 0x12, 0x00, 0x16, 0x9d, 0x44, 0x00, 0xf2, 0x01, 0x99, 0x9d, 0xba, 0xa5, 0xda, 0xad, 0xfb, 0xad, 0x1b, 0xb6, 0x1b, 0xb6,
+  0x3b, 0xbe, 0x3b, 0xbe, 0x06, 0x00, 0x06, 0x02, 0x00, 0x12, 0x1a, 0x06, 0x00, 0xf1, 0x02, 0xb6, 0xfa, 0xb5, 0xfa, 0xad, 0xfa, 0xad, 0xda, 0xad, 0xb9, 0xa5, 0xd9, 0xa5, 0xb9, 0xa5, 0xb9, 0x9d,
+  0x02, 0x00, 0x12, 0xa5, 0x02, 0x00, 0x31, 0xda, 0xa5, 0xba, 0x08, 0x00, 0xf0, 0x57, 0x99, 0xa5, 0xb9, 0xa5, 0x98, 0x9d, 0x98, 0x9d, 0x78, 0x95, 0x78, 0x95, 0x58, 0x95, 0x38, 0x8d, 0x18, 0x8d,
+  0x18, 0x85, 0xf8, 0x84, 0xf8, 0x7c, 0xd8, 0x7c, 0xd8, 0x74, 0xd7, 0x74, 0xb7, 0x6c, 0xb7, 0x6c, 0xd8, 0x6c, 0xb8, 0x64, 0xb8, 0x64, 0xb8, 0x6c, 0xb8, 0x6c, 0xd8, 0x74, 0x39, 0x85, 0x7a, 0x8d,
+  0x59, 0x8d, 0x59, 0x95, 0xba, 0xa5, 0x79, 0x9d, 0x38, 0x95, 0x39, 0x95, 0x39, 0x95, 0xd7, 0x84, 0xba, 0x9d, 0xfb, 0xa5, 0x79, 0x95, 0x9a, 0x95, 0xba, 0x95, 0x79, 0x8d, 0x9a, 0x8d, 0x59, 0x85,
+  0x39, 0x85, 0xf8, 0x74, 0xd8, 0x74, 0xd8, 0x6c, 0xd9, 0x6c, 0xfa, 0x6c, 0xfa, 0x6c, 0xb9, 0x64, 0xda, 0x64, 0xd9, 0x64, 0x0a, 0x00, 0xef, 0xd9, 0x6c, 0xf9, 0x6c, 0xf9, 0x74, 0x19, 0x7d, 0x3a,
+  0x7d, 0x9c, 0x7d, 0x7c, 0x75, 0x02, 0x00, 0x73, 0x1e, 0x5c, 0x02, 0x00, 0x1f, 0x6d, 0x02, 0x00, 0x4b, 0x00, 0x14, 0x03, 0x04, 0xa8, 0x03, 0x04, 0x02, 0x00, 0x1e, 0x5c, 0x9e, 0x03, 0x03, 0x18,
+  0x00, 0x04, 0x90, 0x03, 0x40, 0x7c, 0x75, 0x3b, 0x75, 0x84, 0x03, 0x00, 0x14, 0x00, 0x70, 0x7c, 0x75, 0x9c, 0x75, 0x9c, 0x75, 0x7c, 0x10, 0x00, 0x03, 0x98, 0x03, 0x1f, 0x3c, 0x02, 0x00, 0x1a,
+  0x1b, 0x1c, 0xa2, 0x03, 0x00, 0x80, 0x03, 0x04, 0x06, 0x00, 0x27, 0x1c, 0x5d, 0x9c, 0x03, 0x18, 0x65, 0xa6, 0x03, 0x0f, 0x9e, 0x03, 0x19, 0x0c, 0x0c, 0x00, 0x0e, 0x66, 0x03, 0x0e, 0x9e, 0x03,
+  0x0f, 0x20, 0x00, 0x08, 0x1f, 0x65, 0x90, 0x03, 0x09, 0x19, 0x3a, 0x90, 0x03, 0x1f, 0x3a, 0x90, 0x03, 0x04, 0x09, 0x72, 0x03, 0x14, 0xa5, 0x02, 0x00, 0x35, 0xdb, 0xa5, 0xdb, 0x0c, 0x00, 0x08,
+  0x1c, 0x00, 0x28, 0xda, 0xa5, 0x90, 0x03, 0x13, 0x7a, 0x92, 0x03, 0x31, 0xbb, 0x9d, 0x9b, 0x8c, 0x03, 0x23, 0x7a, 0x95, 0xa8, 0x03, 0x03, 0xbc, 0x03, 0x31, 0x99, 0x9d, 0xb9, 0x34, 0x00, 0x03,
+  0x92, 0x03, 0x00, 0x94, 0x03, 0x81, 0xb6, 0x1a, 0xb6, 0x1a, 0xb6, 0x3b, 0xbe, 0x5b, 0x86, 0x03, 0x30, 0x1a, 0xbe, 0x1a, 0x06, 0x00, 0x01, 0x8e, 0x03, 0x10, 0xda, 0x02, 0x00, 0x03, 0x82, 0x03,
+  0x02, 0x8e, 0x03, 0x04, 0x72, 0x00, 0x10, 0xda, 0xa8, 0x03, 0x12, 0xad, 0x90, 0x03, 0x00, 0x1a, 0x00, 0x2a, 0x99, 0x9d, 0x90, 0x03, 0x51, 0xf8, 0x7c, 0xd8, 0x74, 0xd8, 0x58, 0x03, 0x51, 0xd8,
+  0x6c, 0xf9, 0x6c, 0xd8, 0x92, 0x03, 0xc0, 0xd8, 0x74, 0x5a, 0x8d, 0xbb, 0x9d, 0xfb, 0xa5, 0x1c, 0xae, 0xfb, 0xa5, 0x92, 0x03, 0x00, 0xc2, 0x00, 0xf3, 0x0e, 0x7a, 0x9d, 0x7a, 0x95, 0x3c, 0xae,
+  0x99, 0x95, 0x79, 0x95, 0x99, 0x95, 0x79, 0x8d, 0x79, 0x8d, 0x7a, 0x8d, 0x9a, 0x8d, 0x7a, 0x8d, 0x19, 0x7d, 0x77, 0x64, 0x97, 0x64, 0xd9, 0x94, 0x03, 0xc2, 0x1a, 0x6d, 0x1a, 0x6d, 0xf9, 0x6c,
+  0xf9, 0x6c, 0x1a, 0x75, 0x1a, 0x7d, 0x90, 0x03, 0x02, 0x02, 0x00, 0x06, 0x18, 0x03, 0x0c, 0x10, 0x00, 0x0f, 0x92, 0x03, 0x5b, 0x0f, 0x9e, 0x03, 0x67, 0x0f, 0x54, 0x07, 0x07, 0x10, 0x3c, 0x6a,
+  0x03, 0x01, 0x90, 0x03, 0x02, 0x1a, 0x01, 0x33, 0x5b, 0x75, 0x5b, 0x94, 0x00, 0xbe, 0x7d, 0x75, 0xbd, 0x7d, 0x9d, 0x7d, 0x7c, 0x75, 0x5c, 0x6d, 0x3b, 0x5a, 0x07, 0x0f, 0x02, 0x00, 0x22, 0x2a,
+  0x1b, 0x5d, 0x0c, 0x00, 0x27, 0x1c, 0x5d, 0x40, 0x07, 0x08, 0x0c, 0x00, 0x08, 0xa2, 0x03, 0x0c, 0x20, 0x00, 0x0f, 0x46, 0x07, 0x12, 0x5f, 0x3b, 0x5d, 0x3b, 0x5d, 0x3c, 0x9c, 0x03, 0x0a, 0x0f,
+  0x90, 0x03, 0x13, 0x10, 0x1b, 0x1e, 0x01, 0x03, 0x7e, 0x03, 0x22, 0x3a, 0x7d, 0x02, 0x00, 0x2b, 0x1a, 0x75, 0x02, 0x00, 0x00, 0x1a, 0x00, 0xa4, 0x85, 0x5a, 0x8d, 0x7a, 0x8d, 0x9b, 0x95, 0x9b,
+  0x95, 0xbb, 0xae, 0x02, 0x08, 0x08, 0x07, 0x06, 0x8e, 0x03, 0x08, 0x90, 0x03, 0x01, 0x66, 0x03, 0x03, 0xbe, 0x03, 0x03, 0x82, 0x03, 0x23, 0x7a, 0x8d, 0x68, 0x07, 0x01, 0x9e, 0x03, 0x12, 0xdb,
+  0xaa, 0x03, 0x03, 0xb4, 0x03, 0x00, 0x1e, 0x07, 0x08, 0x56, 0x03, 0x51, 0xda, 0xad, 0x1a, 0xae, 0x1b, 0x92, 0x03, 0x02, 0x86, 0x03, 0x04, 0x8c, 0x03, 0x01, 0x1c, 0x07, 0x25, 0xa5, 0xb9, 0x72,
+  0x00, 0x15, 0x99, 0x3a, 0x00, 0x02, 0x36, 0x00, 0x04, 0x92, 0x03, 0x00, 0x94, 0x03, 0x70, 0x99, 0x9d, 0x79, 0x9d, 0x58, 0x95, 0x58, 0xf2, 0x06, 0x75, 0x8d, 0x19, 0x8d, 0x19, 0x85, 0xf9, 0x84,
+  0x90, 0x03, 0x10, 0x74, 0x56, 0x03, 0x06, 0x20, 0x07, 0x70, 0x9b, 0x9d, 0xfb, 0xa5, 0xfb, 0xa5, 0xfb, 0x0c, 0x04, 0x81, 0xae, 0x3c, 0xae, 0x1b, 0xae, 0xdb, 0xa5, 0x59, 0x30, 0x04, 0x60, 0x79,
+  0x95, 0x59, 0x95, 0x79, 0x95, 0xa0, 0x00, 0xc0, 0x59, 0x8d, 0x7a, 0x95, 0x3d, 0xa6, 0xdb, 0x9d, 0x7a, 0x8d, 0x3a, 0x85, 0x7e, 0x03, 0x31, 0x19, 0x75, 0x5b, 0x2c, 0x01, 0xce, 0x5b, 0x85, 0xbc,
+  0x8d, 0xbb, 0x8d, 0x7a, 0x8d, 0x5a, 0x8d, 0x9c, 0x7d, 0x02, 0x00, 0x0e, 0x92, 0x03, 0x0f, 0x3c, 0x07, 0x7c, 0x0f, 0x92, 0x03, 0x62, 0x03, 0x2c, 0x04, 0x10, 0x7d, 0x8e, 0x00, 0x15, 0x5b, 0x58,
+  0x0b, 0x05, 0xa0, 0x00, 0x0a, 0x5a, 0x07, 0x1f, 0x65, 0x02, 0x00, 0x6d, 0x06, 0x74, 0x0a, 0x0e, 0x2e, 0x07, 0x06, 0x60, 0x03, 0x0a, 0x90, 0x03, 0x04, 0x06, 0x04, 0x0f, 0x90, 0x03, 0x18, 0x00,
+  0x02, 0x00, 0x11, 0x6d, 0xbe, 0x0b, 0x4e, 0x75, 0x3b, 0x75, 0x1a, 0x02, 0x00, 0x13, 0x6d, 0x02, 0x00, 0x01, 0x92, 0x03, 0x51, 0x5a, 0x85, 0x5a, 0x85, 0x7b, 0x92, 0x03, 0x13, 0x9b, 0x50, 0x03,
+  0x28, 0x79, 0x95, 0x92, 0x03, 0x31, 0xbb, 0xa5, 0xbb, 0x8e, 0x03, 0x02, 0xaa, 0x03, 0x02, 0x14, 0x07, 0x03, 0xbc, 0x03, 0x14, 0x95, 0x02, 0x00, 0x31, 0x5a, 0x8d, 0x59, 0x02, 0x00, 0x10, 0x5a,
+  0x6e, 0x06, 0x00, 0x0a, 0x0a, 0x05, 0x8c, 0x03, 0x06, 0xd6, 0x03, 0x05, 0x0a, 0x0b, 0x01, 0x98, 0x03, 0x22, 0xfa, 0xad, 0x0c, 0x07, 0x64, 0xfa, 0xad, 0xfb, 0xb5, 0x1b, 0xb6, 0x18, 0x07, 0x01,
+  0x94, 0x0a, 0x05, 0x18, 0x04, 0x03, 0x1c, 0x04, 0x02, 0x34, 0x00, 0x03, 0x90, 0x03, 0x11, 0xba, 0xb6, 0x0a, 0x11, 0xba, 0x90, 0x03, 0x15, 0x59, 0x8e, 0x03, 0x83, 0x19, 0x85, 0xf9, 0x7c, 0xf9,
+  0x7c, 0xd9, 0x74, 0x02, 0x00, 0x10, 0x6c, 0x02, 0x00, 0x00, 0x0a, 0x00, 0xf3, 0x08, 0xd8, 0x7c, 0x19, 0x85, 0x7a, 0x95, 0xbb, 0xa5, 0x1c, 0xae, 0x3c, 0xb6, 0x3b, 0xb6, 0x5c, 0xbe, 0x3b, 0xb6,
+  0x3b, 0xb6, 0xda, 0xa5, 0x79, 0x96, 0x00, 0x60, 0xda, 0xa5, 0x9a, 0xa5, 0x58, 0x95, 0x02, 0x00, 0x80, 0xba, 0x9d, 0x5d, 0xb6, 0xbe, 0xbe, 0xbe, 0xbe, 0x94, 0x03, 0x60, 0xdc, 0x9d, 0x19, 0x7d,
+  0x5a, 0x85, 0x18, 0x07, 0x51, 0x7a, 0x85, 0xbc, 0x95, 0xbb, 0x70, 0x04, 0x0f, 0x90, 0x03, 0x2b, 0x2f, 0x9c, 0x7d, 0x92, 0x03, 0x5d, 0x0d, 0x9e, 0x03, 0x0f, 0x6e, 0x0e, 0x48, 0x0d, 0x7a, 0x0e,
+  0x03, 0x74, 0x00, 0x11, 0x5b, 0x10, 0x07, 0x18, 0x3b, 0xa6, 0x03, 0x01, 0x18, 0x00, 0x0e, 0x82, 0x0e, 0x0f, 0x02, 0x00, 0x65, 0x0e, 0x1c, 0x0e, 0x0e, 0xaa, 0x0a, 0x02, 0x80, 0x03, 0x0a, 0x8c,
+  0x03, 0x0f, 0x90, 0x03, 0x22, 0x01, 0x92, 0x03, 0x00, 0x02, 0x00, 0x26, 0x1a, 0x6d, 0x8a, 0x03, 0x04, 0x8c, 0x09, 0x0c, 0x92, 0x03, 0x10, 0x5b, 0x92, 0x03, 0x41, 0x8d, 0x9b, 0x95, 0x7a, 0x0e,
+  0x06, 0x17, 0x5a, 0x52, 0x0e, 0x7b, 0xba, 0x9d, 0xbb, 0xa5, 0xdb, 0xa5, 0x9a, 0x46, 0x0e, 0x71, 0xbb, 0x9d, 0x9b, 0x9d, 0x7a, 0x95, 0x5a, 0x02, 0x00, 0x02, 0x90, 0x03, 0x66, 0x5a, 0x8d, 0x39,
+  0x85, 0x39, 0x85, 0x92, 0x03, 0x06, 0x3e, 0x0e, 0x0a, 0xf4, 0x0a, 0x15, 0x99, 0x02, 0x00, 0x00, 0x12, 0x0e, 0x04, 0x94, 0x03, 0x00, 0x8a, 0x03, 0x04, 0x04, 0x0b, 0x04, 0xe8, 0x03, 0x05, 0x5e,
+  0x00, 0x09, 0x42, 0x0b, 0x04, 0x9a, 0x07, 0x11, 0x7a, 0xe0, 0x06, 0x10, 0x39, 0x8c, 0x03, 0x00, 0x02, 0x00, 0x17, 0x7d, 0x8e, 0x03, 0x11, 0x74, 0x76, 0x0a, 0x40, 0x74, 0x3a, 0x7d, 0x7b, 0x96,
+  0x00, 0xc1, 0x8d, 0x5a, 0x95, 0xbb, 0xa5, 0x9d, 0xbe, 0x3c, 0xb6, 0x5c, 0xbe, 0x7c, 0x90, 0x03, 0x20, 0xfa, 0xad, 0x8a, 0x03, 0x00, 0x36, 0x0b, 0x60, 0x3c, 0xb6, 0x3c, 0xbe, 0x1b, 0xb6, 0x0e,
+  0x04, 0xf0, 0x01, 0x78, 0x9d, 0x5c, 0xb6, 0xde, 0xc6, 0xfe, 0xc6, 0x7d, 0xb6, 0xfb, 0xa5, 0xba, 0x9d, 0x39, 0x8d, 0x50, 0x00, 0x32, 0x19, 0x7d, 0x5a, 0xca, 0x00, 0x0f, 0x90, 0x03, 0x0a, 0x08,
+  0x9a, 0x03, 0x0a, 0xa6, 0x03, 0x06, 0xae, 0x03, 0x2f, 0x9c, 0x7d, 0x6c, 0x0e, 0x7b, 0x1f, 0x7c, 0x98, 0x03, 0x4e, 0x12, 0x5b, 0xbc, 0x0a, 0x24, 0x6d, 0x3c, 0x90, 0x03, 0x05, 0xa6, 0x03, 0x0e,
+  0x7a, 0x0e, 0x0f, 0x8a, 0x03, 0x67, 0x0a, 0x92, 0x03, 0x0e, 0xcc, 0x11, 0x0a, 0x90, 0x03, 0x0e, 0xcc, 0x03, 0x0f, 0x90, 0x03, 0x1c, 0x06, 0x92, 0x03, 0x00, 0x06, 0x00, 0x26, 0x75, 0x1b, 0x18,
+  0x07, 0x0b, 0x90, 0x03, 0x03, 0x24, 0x07, 0x42, 0x85, 0x5b, 0x85, 0x5a, 0x02, 0x00, 0x11, 0x8d, 0xf0, 0x06, 0x03, 0x6c, 0x03, 0x04, 0x0e, 0x07, 0x08, 0x02, 0x00, 0x71, 0x9b, 0x95, 0x7b, 0x95,
+  0x5a, 0x8d, 0x3a, 0x02, 0x00, 0x00, 0x2e, 0x00, 0x0d, 0x90, 0x03, 0x05, 0x8a, 0x0e, 0x11, 0xdb, 0x02, 0x00, 0x15, 0xda, 0x90, 0x03, 0x12, 0x79, 0x02, 0x00, 0x10, 0x95, 0x06, 0x00, 0x02, 0x82,
+  0x07, 0x07, 0x8a, 0x03, 0x22, 0x95, 0x7a, 0xfe, 0x0a, 0x03, 0x52, 0x00, 0x30, 0x3a, 0x8d, 0x39, 0x08, 0x00, 0x0a, 0xde, 0x0e, 0x03, 0x22, 0x03, 0x31, 0x59, 0x8d, 0x39, 0x72, 0x00, 0x04, 0x8e,
+  0x03, 0x39, 0xf9, 0x74, 0xf9, 0x1e, 0x07, 0x80, 0xf9, 0x74, 0x3a, 0x85, 0xbc, 0x95, 0xbc, 0x9d, 0x92, 0x03, 0x80, 0x9a, 0x9d, 0xfb, 0xad, 0xda, 0xa5, 0x5c, 0xbe, 0x02, 0x00, 0x30, 0x1b, 0xae,
+  0xb9, 0x08, 0x0b, 0xf4, 0x18, 0xa5, 0x9a, 0xa5, 0xba, 0xad, 0x5c, 0xbe, 0xde, 0xce, 0xde, 0xce, 0x9c, 0xc6, 0x3b, 0xbe, 0xb9, 0xad, 0xd9, 0xad, 0x5b, 0xbe, 0xbd, 0xc6, 0xbd, 0xc6, 0x7c, 0xbe,
+  0xfb, 0xad, 0x38, 0x8d, 0x18, 0x85, 0x18, 0x85, 0x39, 0x8d, 0x7a, 0x95, 0xca, 0x00, 0x2f, 0x9c, 0x7d, 0x02, 0x00, 0x23, 0x01, 0xda, 0x10, 0x05, 0x08, 0x00, 0x08, 0x02, 0x00, 0x16, 0x9c, 0x06,
+  0x00, 0x01, 0xde, 0x09, 0x0f, 0x92, 0x03, 0x4f, 0x1f, 0x7c, 0xce, 0x0a, 0x52, 0x15, 0x3b, 0x08, 0x00, 0x15, 0x3b, 0x0e, 0x00, 0x00, 0x0c, 0x00, 0x1a, 0x5b, 0x3c, 0x0e, 0x0f, 0xb2, 0x0a, 0x76,
+  0x06, 0x6c, 0x03, 0x0a, 0x8e, 0x0a, 0x0f, 0x6e, 0x07, 0x27, 0x0e, 0x90, 0x03, 0x0e, 0x92, 0x03, 0x0e, 0x02, 0x00, 0x08, 0x3c, 0x07, 0x06, 0x62, 0x0e, 0x03, 0x8e, 0x15, 0x03, 0x94, 0x03, 0x13,
+  0x5a, 0x2c, 0x07, 0x15, 0x9b, 0xb2, 0x11, 0x04, 0x2c, 0x0e, 0x01, 0x2e, 0x03, 0x16, 0x85, 0x02, 0x00, 0x11, 0x5a, 0x06, 0x00, 0x22, 0x39, 0x85, 0x30, 0x00, 0x0c, 0x90, 0x03, 0x19, 0xba, 0x20,
+  0x07, 0x22, 0x79, 0x95, 0xba, 0x0d, 0x02, 0x08, 0x00, 0x01, 0x6c, 0x03, 0x04, 0xf8, 0x0a, 0x03, 0xf6, 0x0a, 0x35, 0x59, 0x85, 0x5a, 0x52, 0x00, 0x02, 0xe6, 0x03, 0x22, 0x7a, 0x8d, 0x1c, 0x00,
+  0x11, 0x79, 0x02, 0x00, 0x01, 0x36, 0x04, 0x00, 0x1a, 0x00, 0x52, 0x7d, 0x39, 0x7d, 0x19, 0x75, 0x02, 0x00, 0x00, 0x90, 0x03, 0x33, 0xf9, 0x6c, 0xd9, 0x02, 0x00, 0x01, 0x0e, 0x00, 0xf0, 0x00,
+  0x7c, 0x5a, 0x85, 0x7a, 0x95, 0x39, 0x8d, 0x18, 0x8d, 0x59, 0x95, 0x79, 0x9d, 0x99, 0xa5, 0x08, 0x07, 0x22, 0x3b, 0xb6, 0xea, 0x0a, 0x00, 0x10, 0x00, 0xf6, 0x0e, 0x79, 0x9d, 0x78, 0x9d, 0xba,
+  0xad, 0x3b, 0xbe, 0x5b, 0xc6, 0xfa, 0xb5, 0xd9, 0xad, 0xd9, 0xad, 0xfa, 0xad, 0x5b, 0xbe, 0x7c, 0xbe, 0x1a, 0xae, 0xfb, 0xad, 0x3c, 0xae, 0xbb, 0x8c, 0x0b, 0x0f, 0x90, 0x03, 0x1c, 0x17, 0x9d,
+  0x88, 0x03, 0x0f, 0x02, 0x00, 0x18, 0x0f, 0x28, 0x07, 0x50, 0x1f, 0x7c, 0xfc, 0x11, 0x08, 0x03, 0x28, 0x00, 0x06, 0x10, 0x00, 0x0f, 0x1a, 0x07, 0x28, 0x0e, 0x3a, 0x19, 0x00, 0x8e, 0x03, 0x00,
+  0x02, 0x00, 0x0d, 0xa2, 0x15, 0x00, 0xba, 0x15, 0x2f, 0x65, 0x5c, 0x4c, 0x03, 0x29, 0x0f, 0x92, 0x03, 0x34, 0x0c, 0x04, 0x07, 0x17, 0x3b, 0x02, 0x00, 0x0c, 0x10, 0x00, 0x0c, 0x02, 0x00, 0x0c,
+  0x92, 0x03, 0x04, 0xd2, 0x19, 0x09, 0xd0, 0x11, 0x0f, 0x94, 0x03, 0x16, 0x00, 0x26, 0x07, 0x02, 0xf8, 0x11, 0x04, 0x9a, 0x03, 0x12, 0x3b, 0x9a, 0x03, 0x05, 0x66, 0x03, 0x15, 0x3a, 0x9e, 0x03,
+  0x01, 0xce, 0x0a, 0x03, 0x16, 0x00, 0x20, 0x1a, 0x7d, 0x02, 0x00, 0x28, 0x3a, 0x7d, 0x96, 0x03, 0x15, 0x39, 0x92, 0x03, 0x06, 0xf8, 0x0d, 0x08, 0x8e, 0x03, 0x03, 0x22, 0x07, 0x01, 0x8a, 0x03,
+  0x00, 0x5e, 0x03, 0x04, 0x08, 0x12, 0x11, 0x5a, 0x84, 0x03, 0x00, 0x86, 0x03, 0x12, 0x59, 0x44, 0x00, 0x14, 0x85, 0x12, 0x16, 0x4a, 0x39, 0x7d, 0x39, 0x85, 0x02, 0x00, 0x35, 0x59, 0x85, 0x59,
+  0x1c, 0x00, 0x33, 0x19, 0x7d, 0x39, 0x8e, 0x03, 0x06, 0x94, 0x03, 0x80, 0xd9, 0x6c, 0xd8, 0x6c, 0xd9, 0x74, 0xd8, 0x74, 0x00, 0x19, 0x20, 0xf9, 0x7c, 0x5a, 0x00, 0x40, 0x18, 0x8d, 0x38, 0x8d,
+  0x18, 0x12, 0x50, 0xfa, 0xad, 0x1b, 0xb6, 0xfa, 0xb0, 0x0e, 0x01, 0x84, 0x0e, 0xd2, 0x59, 0x9d, 0x79, 0x9d, 0xba, 0xad, 0xfa, 0xb5, 0x3b, 0xb6, 0x5b, 0xbe, 0x5b, 0x6a, 0x19, 0xe9, 0xb5, 0x1b,
+  0xb6, 0xd9, 0xad, 0xd9, 0xa5, 0x5c, 0xb6, 0x5c, 0xb6, 0x5d, 0xb6, 0xfb, 0xb6, 0x00, 0x0f, 0x20, 0x07, 0x2b, 0x0f, 0x1e, 0x07, 0x05, 0x07, 0x0e, 0x00, 0x16, 0x75, 0xee, 0x0a, 0x0f, 0x82, 0x03,
+  0x39, 0x0f, 0x20, 0x00, 0x17, 0x0e, 0x9a, 0x03, 0x08, 0xa0, 0x03, 0x0f, 0x96, 0x03, 0x2b, 0x02, 0x22, 0x07, 0x04, 0x3a, 0x07, 0x04, 0x1a, 0x07, 0x06, 0xe0, 0x1c, 0x0e, 0x94, 0x03, 0x0f, 0x22,
+  0x07, 0x5d, 0x0a, 0x10, 0x00, 0x22, 0x3b, 0x65, 0x56, 0x03, 0x0c, 0x76, 0x03, 0x17, 0x1b, 0x40, 0x1d, 0x0d, 0x02, 0x00, 0x16, 0x5d, 0xb8, 0x03, 0x0b, 0x80, 0x03, 0x0e, 0x32, 0x00, 0x03, 0x94,
+  0x03, 0x00, 0x14, 0x01, 0x03, 0x88, 0x03, 0x0c, 0x62, 0x0e, 0x0d, 0xc6, 0x0a, 0x04, 0xca, 0x0a, 0x15, 0x1a, 0x02, 0x00, 0x03, 0xa4, 0x15, 0x07, 0xca, 0x1c, 0x04, 0x24, 0x00, 0x24, 0x3a, 0x7d,
+  0xce, 0x06, 0x02, 0xae, 0x15, 0x04, 0x90, 0x03, 0x06, 0xc0, 0x11, 0x08, 0xc8, 0x1c, 0x11, 0x79, 0xfa, 0x0d, 0x22, 0x59, 0x8d, 0x16, 0x0b, 0x04, 0x6a, 0x03, 0x00, 0xec, 0x06, 0x00, 0x88, 0x03,
+  0x11, 0x39, 0x4e, 0x00, 0x51, 0x19, 0x75, 0x5a, 0x7d, 0x39, 0x3c, 0x1d, 0x33, 0x39, 0x7d, 0x59, 0x22, 0x00, 0x32, 0x18, 0x7d, 0x19, 0x84, 0x03, 0x01, 0x14, 0x07, 0x02, 0x92, 0x03, 0x00, 0x0a,
+  0x00, 0x00, 0x06, 0x00, 0x20, 0xf8, 0x74, 0x2a, 0x00, 0xf1, 0x08, 0xf8, 0x74, 0xb7, 0x74, 0xd8, 0x74, 0x97, 0x6c, 0xd8, 0x74, 0xd8, 0x7c, 0xd8, 0x7c, 0xd7, 0x7c, 0xd7, 0x7c, 0xf8, 0x84, 0x19,
+  0x8d, 0x39, 0x00, 0x04, 0x01, 0x90, 0x15, 0x12, 0x9d, 0xaa, 0x0a, 0x30, 0xda, 0xa5, 0x79, 0x32, 0x07, 0x10, 0x9d, 0x30, 0x07, 0x11, 0x3b, 0x12, 0x1d, 0x04, 0xe8, 0x15, 0x22, 0xfa, 0xad, 0x40,
+  0x07, 0x01, 0xda, 0x07, 0x00, 0x36, 0x12, 0x01, 0x02, 0x00, 0x2f, 0xba, 0xa5, 0x8e, 0x03, 0x3b, 0x0e, 0x90, 0x03, 0x0f, 0xb6, 0x15, 0x7d, 0x02, 0x98, 0x03, 0x0f, 0x52, 0x0e, 0x3b, 0x07, 0xa4,
+  0x03, 0x02, 0xd2, 0x1c, 0x18, 0x65, 0x02, 0x00, 0x0f, 0x82, 0x03, 0x5b, 0x0a, 0xd8, 0x06, 0x0e, 0x14, 0x07, 0x0f, 0x02, 0x00, 0x0b, 0x0e, 0xd0, 0x18, 0x0f, 0x46, 0x07, 0x0d, 0x0e, 0xc8, 0x03,
+  0x1a, 0x3b, 0x18, 0x07, 0x0d, 0x3c, 0x07, 0x02, 0x8a, 0x03, 0x09, 0x0e, 0x00, 0x1f, 0x75, 0x02, 0x00, 0x07, 0x06, 0xc4, 0x1c, 0x00, 0x52, 0x07, 0x35, 0x5b, 0x7d, 0x5b, 0x2a, 0x07, 0x03, 0x90,
+  0x03, 0x07, 0x22, 0x07, 0x1c, 0xda, 0x90, 0x03, 0x22, 0x95, 0x79, 0x8e, 0x03, 0x04, 0x56, 0x07, 0x01, 0x84, 0x03, 0x0a, 0x02, 0x00, 0x33, 0x7a, 0x85, 0x3a, 0x7e, 0x03, 0x33, 0x18, 0x7d, 0x19,
+  0x98, 0x0e, 0x11, 0x59, 0x28, 0x0e, 0x05, 0xbc, 0x19, 0x00, 0x8c, 0x03, 0x03, 0x22, 0x00, 0x11, 0x18, 0xb4, 0x03, 0x00, 0x4e, 0x0b, 0x00, 0xb8, 0x03, 0x00, 0xfc, 0x0d, 0xe0, 0x9a, 0x95, 0x1c,
+  0xa6, 0x9a, 0x95, 0xd7, 0x7c, 0xb7, 0x7c, 0x18, 0x8d, 0x39, 0x8d, 0x30, 0x16, 0x02, 0xb8, 0x0e, 0x13, 0x59, 0x1c, 0x12, 0x00, 0x8e, 0x03, 0x20, 0xda, 0xa5, 0x02, 0x19, 0x02, 0x66, 0x19, 0x00,
+  0xe6, 0x11, 0xf0, 0x01, 0xb9, 0xad, 0xfb, 0xb5, 0xda, 0xad, 0x58, 0x9d, 0x38, 0x95, 0x58, 0x95, 0xda, 0xa5, 0xdb, 0xad, 0x74, 0x0e, 0x02, 0xee, 0x1c, 0x0e, 0x20, 0x07, 0x0f, 0x02, 0x00, 0x4f,
+  0x0f, 0xd8, 0x0a, 0x0c, 0x0f, 0xf0, 0x0a, 0x52, 0x0e, 0xcc, 0x0a, 0x0f, 0x32, 0x07, 0x34, 0x0d, 0x8e, 0x03, 0x0f, 0x92, 0x03, 0x4b, 0x0f, 0x56, 0x03, 0x09, 0x09, 0x70, 0x0a, 0x05, 0x02, 0x07,
+  0x08, 0x8a, 0x0a, 0x0f, 0x96, 0x03, 0x0f, 0x13, 0x3b, 0xb6, 0x20, 0x0a, 0x3e, 0x00, 0x0f, 0xd2, 0x03, 0x0d, 0x01, 0x08, 0x00, 0x0a, 0x8e, 0x03, 0x0f, 0xd2, 0x0a, 0x06, 0x48, 0x1a, 0x65, 0x1a,
+  0x65, 0x9e, 0x03, 0x0c, 0x98, 0x15, 0x00, 0x6e, 0x20, 0x03, 0x0a, 0x00, 0x00, 0x88, 0x21, 0x24, 0x75, 0x5b, 0x4a, 0x03, 0x25, 0x85, 0x5a, 0x92, 0x03, 0x03, 0x9e, 0x15, 0x13, 0x9d, 0x42, 0x0e,
+  0x05, 0x3c, 0x20, 0x01, 0x8e, 0x03, 0x02, 0xf6, 0x0a, 0x05, 0x18, 0x1d, 0x16, 0x3a, 0x02, 0x00, 0x00, 0x00, 0x1c, 0x01, 0x02, 0x00, 0x10, 0x59, 0xbe, 0x0a, 0x10, 0x8d, 0x56, 0x11, 0x31, 0xfc,
+  0xad, 0xbb, 0x76, 0x15, 0x82, 0xdb, 0x9d, 0x9b, 0x95, 0xf8, 0x7c, 0xf9, 0x7c, 0xfe, 0x14, 0x11, 0x3a, 0xcc, 0x11, 0x51, 0x59, 0x8d, 0x9a, 0x95, 0xdb, 0xf0, 0x1f, 0xf3, 0x02, 0x3c, 0xae, 0x7d,
+  0xb6, 0x9e, 0xbe, 0xdf, 0xc6, 0xff, 0xce, 0x9e, 0xbe, 0x3c, 0xae, 0x3c, 0xae, 0xfb, 0x1c, 0x0b, 0x00, 0x7a, 0x03, 0x13, 0xda, 0xdc, 0x20, 0x02, 0x46, 0x12, 0x11, 0x7a, 0xe0, 0x15, 0x11, 0xda,
+  0x96, 0x1c, 0x11, 0xda, 0x3c, 0x19, 0x04, 0x02, 0x24, 0x42, 0x99, 0x9d, 0x58, 0x95, 0xba, 0x03, 0x80, 0xba, 0xa5, 0x1b, 0xae, 0x1b, 0xb6, 0xda, 0xad, 0x68, 0x19, 0x2f, 0x1b, 0xb6, 0x90, 0x03,
+  0x5f, 0x0a, 0x9c, 0x03, 0x1e, 0x9c, 0x52, 0x07, 0x0f, 0x90, 0x03, 0x54, 0x2f, 0x7c, 0x75, 0x2a, 0x07, 0x3d, 0x0f, 0x90, 0x03, 0x61, 0x0f, 0xa2, 0x03, 0x09, 0x0f, 0xb6, 0x03, 0x05, 0x0f, 0x30,
+  0x00, 0x07, 0x13, 0x3b, 0x12, 0x00, 0x06, 0x80, 0x03, 0x08, 0xd0, 0x03, 0x0f, 0x94, 0x03, 0x11, 0x07, 0x28, 0x00, 0x0e, 0x8e, 0x03, 0x0f, 0x02, 0x00, 0x0d, 0x05, 0x32, 0x00, 0x01, 0xa6, 0x03,
+  0x06, 0x0a, 0x00, 0x02, 0x7c, 0x0e, 0x01, 0x78, 0x20, 0x12, 0x3b, 0x30, 0x07, 0x03, 0x52, 0x0e, 0x14, 0x5a, 0x46, 0x0e, 0x01, 0xb4, 0x23, 0x02, 0x02, 0x00, 0x14, 0xba, 0x3a, 0x20, 0x02, 0xa8,
+  0x1c, 0x06, 0x8e, 0x03, 0x1d, 0x75, 0x02, 0x00, 0x00, 0x20, 0x07, 0x12, 0x8d, 0x3a, 0x00, 0xf2, 0x09, 0xfc, 0xa5, 0x1c, 0xae, 0x1c, 0xae, 0x9e, 0xc6, 0x5d, 0xbe, 0xfb, 0xad, 0x9a, 0x9d, 0xfc,
+  0xa5, 0xfc, 0xa5, 0x7a, 0x95, 0x3a, 0x8d, 0xf9, 0x84, 0xaa, 0x0e, 0x31, 0x39, 0x8d, 0x59, 0x8c, 0x03, 0xc0, 0x5c, 0xbe, 0xbe, 0xc6, 0xbe, 0xce, 0x7c, 0xbe, 0x5c, 0xbe, 0x3c, 0xbe, 0xb8, 0x11,
+  0x60, 0x7d, 0xbe, 0x3b, 0xb6, 0x1b, 0xae, 0x02, 0x00, 0x00, 0x06, 0x20, 0x00, 0xde, 0x15, 0x02, 0x06, 0x00, 0x05, 0xd6, 0x20, 0x01, 0x84, 0x03, 0x04, 0x02, 0x00, 0x02, 0x0c, 0x00, 0x11, 0x79,
+  0xcc, 0x0a, 0x00, 0x0a, 0x00, 0x13, 0x9a, 0xf0, 0x11, 0x00, 0x70, 0x0e, 0x13, 0x3b, 0x4e, 0x24, 0x23, 0x9c, 0x85, 0x1c, 0x03, 0x3f, 0x85, 0x9c, 0x85, 0x98, 0x03, 0x69, 0x0f, 0xe0, 0x0a, 0x06,
+  0x0f, 0x9c, 0x03, 0x4c, 0x0f, 0x90, 0x03, 0x51, 0x0f, 0xba, 0x0a, 0x63, 0x04, 0xbc, 0x0a, 0x0e, 0x88, 0x03, 0x0f, 0xe2, 0x0a, 0x0d, 0x0e, 0x32, 0x00, 0x0c, 0xa6, 0x03, 0x0f, 0xf6, 0x0a, 0x1d,
+  0x0f, 0x02, 0x00, 0x09, 0x0f, 0x30, 0x00, 0x12, 0x05, 0x42, 0x07, 0x00, 0x7a, 0x20, 0x06, 0xc0, 0x0a, 0x02, 0x40, 0x19, 0x00, 0x02, 0x00, 0x00, 0xae, 0x11, 0x05, 0x9a, 0x15, 0x02, 0xdc, 0x1c,
+  0x01, 0x1a, 0x07, 0x1c, 0x5a, 0x8e, 0x03, 0x03, 0xde, 0x27, 0x00, 0x02, 0x00, 0x71, 0x3b, 0x7d, 0x7b, 0x85, 0xdb, 0x9d, 0xdb, 0x8a, 0x03, 0xe0, 0x5d, 0xb6, 0x7d, 0xc6, 0x3c, 0xbe, 0x5c, 0xbe,
+  0x9d, 0xc6, 0x1b, 0xb6, 0x1c, 0xb6, 0x5e, 0x03, 0x22, 0xfc, 0xa5, 0xf8, 0x14, 0xf0, 0x11, 0x39, 0x95, 0x7a, 0x9d, 0xdb, 0xa5, 0x3c, 0xb6, 0x7d, 0xc6, 0x9d, 0xc6, 0xbd, 0xce, 0x9c, 0xce, 0xfe,
+  0xd6, 0x7c, 0xce, 0x7c, 0xc6, 0x3b, 0xbe, 0xf6, 0x94, 0x37, 0x9d, 0xfa, 0xb5, 0x3b, 0xbe, 0xfc, 0x1f, 0x06, 0x42, 0x20, 0x03, 0x76, 0x03, 0x01, 0x92, 0x03, 0x02, 0x00, 0x07, 0x60, 0x78, 0x9d,
+  0x78, 0x9d, 0x58, 0x95, 0x9c, 0x0a, 0x02, 0x8e, 0x03, 0x00, 0x18, 0x07, 0x11, 0xda, 0x22, 0x07, 0x14, 0x99, 0x30, 0x2b, 0x14, 0xad, 0xd2, 0x27, 0x4b, 0x3b, 0xbe, 0x9c, 0x85, 0x02, 0x00, 0x0f,
+  0x2a, 0x07, 0x6a, 0x0f, 0x90, 0x03, 0xae, 0x08, 0x46, 0x0e, 0x01, 0x22, 0x2b, 0x0a, 0x16, 0x00, 0x0f, 0x92, 0x03, 0x5f, 0x0f, 0xec, 0x0a, 0x1d, 0x0f, 0x4a, 0x07, 0x09, 0x0f, 0xb6, 0x0a, 0x1b,
+  0x0f, 0x90, 0x03, 0x1b, 0x0f, 0x36, 0x00, 0x08, 0x1a, 0x6d, 0x2a, 0x12, 0x03, 0xda, 0x0a, 0x09, 0xe6, 0x06, 0x08, 0x9a, 0x03, 0x04, 0x02, 0x00, 0x09, 0x28, 0x0e, 0x00, 0x7e, 0x03, 0x03, 0x78,
+  0x2c, 0x15, 0x3a, 0x68, 0x07, 0x11, 0x5b, 0x90, 0x03, 0xf3, 0x03, 0xfb, 0xa5, 0x7d, 0xbe, 0x7d, 0xbe, 0x5c, 0xbe, 0x7d, 0xc6, 0x7c, 0xc6, 0x7c, 0xc6, 0x9c, 0xce, 0x1b, 0xb6, 0xc2, 0x1f, 0x10,
+  0xb6, 0xfa, 0x0a, 0x11, 0xda, 0xd2, 0x1f, 0x20, 0x7c, 0xbe, 0x8c, 0x03, 0xf0, 0x03, 0xdd, 0xd6, 0xdd, 0xd6, 0x1e, 0xdf, 0xfd, 0xde, 0x7c, 0xce, 0x3a, 0xbe, 0x1a, 0xbe, 0xb8, 0xad, 0x98, 0xa5,
+  0xc4, 0x18, 0x20, 0x5b, 0xc6, 0xb6, 0x2e, 0x20, 0xfa, 0xb5, 0x72, 0x0a, 0x01, 0x70, 0x27, 0x05, 0x66, 0x27, 0x00, 0xfc, 0x06, 0x11, 0x58, 0x06, 0x00, 0x13, 0x99, 0x0c, 0x1d, 0x10, 0x38, 0xa2,
+  0x23, 0x21, 0xa5, 0xfb, 0x46, 0x0e, 0x23, 0x99, 0xa5, 0x90, 0x03, 0x23, 0xad, 0xfa, 0x90, 0x03, 0x00, 0x02, 0x00, 0x06, 0x8a, 0x03, 0x1f, 0xbd, 0x96, 0x03, 0x70, 0x0f, 0xea, 0x1c, 0x09, 0x1f,
+  0x9c, 0x40, 0x19, 0x4e, 0x0f, 0xe6, 0x23, 0x4e, 0x11, 0x65, 0x40, 0x07, 0x09, 0x64, 0x32, 0x0e, 0x4e, 0x07, 0x0f, 0x7c, 0x0e, 0x6b, 0x0e, 0x92, 0x03, 0x0f, 0x6c, 0x0e, 0x0f, 0x0f, 0x90, 0x03,
+  0x29, 0x0f, 0x2e, 0x00, 0x10, 0x0d, 0xa6, 0x15, 0x02, 0xc0, 0x15, 0x02, 0x5c, 0x03, 0x0a, 0x7e, 0x0a, 0x0f, 0x02, 0x00, 0x04, 0x04, 0x10, 0x07, 0x05, 0x38, 0x00, 0x01, 0x9c, 0x03, 0x01, 0x90,
+  0x03, 0x60, 0x9a, 0x95, 0xfb, 0xa5, 0x5c, 0xb6, 0xc0, 0x1f, 0x00, 0x8e, 0x03, 0x22, 0x5b, 0xc6, 0x60, 0x03, 0x80, 0x3a, 0xb6, 0x1a, 0xae, 0xfa, 0xad, 0x1b, 0xae, 0x06, 0x00, 0x40, 0x1a, 0xae,
+  0x3b, 0xbe, 0xa8, 0x03, 0x40, 0xdd, 0xd6, 0xfd, 0xde, 0x02, 0x00, 0xa2, 0xbc, 0xd6, 0x9b, 0xce, 0x5a, 0xc6, 0xf9, 0xb5, 0xb8, 0xa5, 0x90, 0x03, 0xc2, 0x3b, 0xc6, 0x5b, 0xc6, 0x5c, 0xc6, 0x3b,
+  0xbe, 0x3c, 0xbe, 0x3b, 0xbe, 0x02, 0x24, 0x14, 0xd9, 0x06, 0x2b, 0x11, 0xa5, 0x6c, 0x32, 0x00, 0xaa, 0x03, 0x01, 0x02, 0x16, 0x11, 0x79, 0x28, 0x07, 0x00, 0xd4, 0x0a, 0x00, 0xa2, 0x0a, 0x01,
+  0x6a, 0x15, 0x10, 0xad, 0xfe, 0x18, 0x00, 0x70, 0x15, 0x13, 0x5b, 0xf2, 0x2e, 0x13, 0xbc, 0x82, 0x03, 0x39, 0xbc, 0x85, 0xbc, 0x08, 0x00, 0x0f, 0x94, 0x03, 0x79, 0x04, 0x3c, 0x07, 0x06, 0xd2,
+  0x0a, 0x0f, 0x94, 0x03, 0x4d, 0x0c, 0x08, 0x00, 0x0f, 0x5e, 0x32, 0x45, 0x0e, 0x92, 0x03, 0x0e, 0x26, 0x00, 0x0f, 0x02, 0x00, 0x09, 0x1d, 0x5c, 0x60, 0x03, 0x04, 0xc4, 0x03, 0x1d, 0x3b, 0x20,
+  0x00, 0x0e, 0x3c, 0x00, 0x00, 0x02, 0x00, 0x0f, 0x90, 0x03, 0x11, 0x0f, 0xa0, 0x15, 0x17, 0x0e, 0x92, 0x03, 0x0f, 0xa6, 0x03, 0x0d, 0x0e, 0xa6, 0x15, 0x0f, 0xbe, 0x0a, 0x11, 0x06, 0x5a, 0x03,
+  0x02, 0xf2, 0x11, 0x06, 0x98, 0x03, 0x09, 0xb2, 0x11, 0x09, 0x02, 0x00, 0x19, 0x1b, 0x8e, 0x03, 0x10, 0x3a, 0x16, 0x30, 0x50, 0x7d, 0x5a, 0x7d, 0x59, 0x8d, 0x90, 0x03, 0xe0, 0x3b, 0xb6, 0x7c,
+  0xc6, 0x9c, 0xc6, 0x5b, 0xc6, 0x9c, 0xce, 0x9c, 0xce, 0x7b, 0xc6, 0x26, 0x1c, 0x22, 0x1a, 0xae, 0x02, 0x00, 0x20, 0x3b, 0xb6, 0x38, 0x1c, 0x20, 0xbc, 0xce, 0x1a, 0x00, 0x11, 0xfd, 0x92, 0x03,
+  0xa1, 0xdc, 0xd6, 0xbb, 0xce, 0x9b, 0xce, 0x7b, 0xc6, 0xbc, 0xc6, 0xd2, 0x06, 0x05, 0xc4, 0x03, 0x02, 0xde, 0x35, 0x02, 0x8a, 0x03, 0x02, 0x34, 0x2b, 0x00, 0x08, 0x07, 0x31, 0x1b, 0xbe, 0x5c,
+  0xa8, 0x03, 0x15, 0xba, 0x9a, 0x2e, 0x00, 0xa4, 0x03, 0x03, 0xa2, 0x1c, 0x25, 0xb5, 0x3b, 0xec, 0x2e, 0x11, 0x1a, 0x18, 0x36, 0x4a, 0x3a, 0xbe, 0xbc, 0x85, 0x02, 0x00, 0x0f, 0xc0, 0x0a, 0x03,
+  0x07, 0x20, 0x00, 0x06, 0x28, 0x03, 0x08, 0xb4, 0x03, 0x0f, 0xbe, 0x03, 0x56, 0x00, 0x82, 0x15, 0x06, 0x9a, 0x03, 0x0f, 0x30, 0x07, 0x2f, 0x0e, 0xae, 0x1c, 0x0f, 0xa2, 0x2e, 0x55, 0x0a, 0x92,
+  0x39, 0x08, 0x1a, 0x00, 0x07, 0xe4, 0x35, 0x0f, 0x8e, 0x0e, 0x08, 0x06, 0x50, 0x03, 0x33, 0x5b, 0x65, 0x5b, 0x8a, 0x03, 0x0c, 0x60, 0x03, 0x13, 0x5b, 0x02, 0x00, 0x0e, 0x42, 0x0e, 0x05, 0x68,
+  0x03, 0x00, 0xe8, 0x31, 0x01, 0x7e, 0x11, 0x09, 0x02, 0x00, 0x0f, 0x84, 0x03, 0x22, 0x0f, 0x3a, 0x07, 0x11, 0x0f, 0xf6, 0x0a, 0x09, 0x0f, 0x44, 0x07, 0x14, 0x08, 0xa2, 0x00, 0x08, 0xb6, 0x00,
+  0x00, 0x8a, 0x0a, 0x02, 0x20, 0x0e, 0x09, 0x14, 0x00, 0x0a, 0x10, 0x00, 0x15, 0x3b, 0x8e, 0x32, 0xd0, 0x5a, 0x75, 0x7a, 0x7d, 0x7a, 0x85, 0x79, 0x85, 0xda, 0x9d, 0x1b, 0xa6, 0x3b, 0x7c, 0x03,
+  0x32, 0xb6, 0x7b, 0xc6, 0x02, 0x00, 0x01, 0x5e, 0x03, 0x12, 0xb6, 0xb8, 0x0a, 0x00, 0x28, 0x03, 0x20, 0x7b, 0xbe, 0xae, 0x03, 0x62, 0xbc, 0xce, 0xdd, 0xd6, 0xbc, 0xd6, 0x9a, 0x03, 0x90, 0x9b,
+  0xce, 0x9b, 0xc6, 0x9b, 0xc6, 0x9c, 0xce, 0xbc, 0x0a, 0x00, 0x11, 0xce, 0x34, 0x00, 0x05, 0x56, 0x39, 0x00, 0x90, 0x03, 0x13, 0xd9, 0x94, 0x03, 0x21, 0xfa, 0xad, 0x6a, 0x03, 0x01, 0xc6, 0x2e,
+  0x07, 0xc6, 0x0a, 0x03, 0x52, 0x2b, 0x00, 0x7c, 0x07, 0x02, 0x22, 0x00, 0x02, 0x26, 0x20, 0x00, 0x3a, 0x00, 0x2e, 0xbc, 0x85, 0x92, 0x03, 0x0c, 0x90, 0x03, 0x0e, 0x24, 0x00, 0x0f, 0x92, 0x15,
+  0x73, 0x0f, 0x2c, 0x36, 0x01, 0x0f, 0x4e, 0x3d, 0x2f, 0x0f, 0xd8, 0x35, 0x65, 0x0e, 0x8a, 0x39, 0x03, 0xb0, 0x03, 0x09, 0x84, 0x0e, 0x0d, 0x6e, 0x19, 0x05, 0x74, 0x03, 0x0a, 0xa8, 0x03, 0x22,
+  0x5b, 0x65, 0x3a, 0x24, 0x0a, 0x20, 0x00, 0x0b, 0x88, 0x3d, 0x05, 0xb2, 0x03, 0x0f, 0x90, 0x03, 0x41, 0x0f, 0xa8, 0x03, 0x1d, 0x0f, 0xe0, 0x1c, 0x09, 0x09, 0xb0, 0x03, 0x0e, 0x90, 0x03, 0x0f,
+  0x02, 0x00, 0x08, 0x58, 0x5b, 0x6d, 0x5a, 0x6d, 0x5b, 0x1a, 0x07, 0x07, 0x90, 0x03, 0xe0, 0x5a, 0x7d, 0x7a, 0x7d, 0xba, 0x8d, 0xdb, 0x9d, 0xda, 0x9d, 0xfa, 0xa5, 0xda, 0xa5, 0x58, 0x2a, 0x20,
+  0x7b, 0xc6, 0x7a, 0x03, 0x11, 0x7c, 0x80, 0x0a, 0x11, 0xfb, 0x48, 0x23, 0x22, 0xfa, 0xb5, 0xdc, 0x0d, 0x11, 0x7b, 0x5c, 0x0e, 0x00, 0xd4, 0x0a, 0x15, 0x7b, 0x02, 0x00, 0x00, 0x90, 0x03, 0x11,
+  0x9c, 0x9a, 0x03, 0x04, 0x90, 0x03, 0x06, 0x58, 0x03, 0x08, 0x90, 0x03, 0x11, 0x1a, 0x90, 0x03, 0x02, 0x1c, 0x1d, 0x1d, 0x58, 0x92, 0x03, 0x13, 0x1a, 0x9a, 0x1c, 0x01, 0xb4, 0x03, 0x0e, 0x90,
+  0x03, 0x0d, 0x98, 0x03, 0x0f, 0x1c, 0x00, 0x02, 0x0f, 0x54, 0x0e, 0x7b, 0x0f, 0xf6, 0x11, 0x34, 0x06, 0x2c, 0x07, 0x06, 0xd4, 0x23, 0x0f, 0x9a, 0x03, 0x6b, 0x0f, 0x8c, 0x20, 0x11, 0x06, 0x02,
+  0x00, 0x04, 0x32, 0x00, 0x02, 0x06, 0x00, 0x07, 0x90, 0x03, 0x03, 0x8e, 0x02, 0x0c, 0x7c, 0x07, 0x01, 0xb0, 0x02, 0x02, 0x90, 0x03, 0x05, 0x20, 0x00, 0x0f, 0x8a, 0x03, 0x49, 0x0f, 0xae, 0x03,
+  0x2d, 0x0a, 0x3c, 0x0e, 0x0f, 0x02, 0x00, 0x15, 0x00, 0x06, 0x01, 0x0c, 0x14, 0x00, 0x00, 0xc2, 0x3a, 0x11, 0x5a, 0x92, 0x03, 0xc2, 0xbb, 0x8d, 0xdb, 0x95, 0xba, 0x9d, 0xdb, 0xa5, 0xfa, 0xa5,
+  0xfa, 0xad, 0x54, 0x11, 0x31, 0x5c, 0xc6, 0x5c, 0x5e, 0x03, 0x02, 0xda, 0x0d, 0x00, 0x56, 0x0a, 0x03, 0x6e, 0x11, 0x16, 0xc6, 0x02, 0x00, 0x03, 0x90, 0x03, 0x10, 0xc6, 0x8e, 0x03, 0x02, 0x52,
+  0x07, 0x35, 0x5b, 0xbe, 0x3a, 0x90, 0x03, 0x17, 0xfa, 0x90, 0x03, 0x04, 0x6a, 0x03, 0x13, 0xba, 0xe6, 0x11, 0x02, 0x76, 0x35, 0x01, 0xe8, 0x2a, 0x01, 0x2c, 0x12, 0x02, 0xfc, 0x35, 0x11, 0xb9,
+  0x04, 0x3d, 0x00, 0xde, 0x11, 0x0c, 0x6a, 0x03, 0x3f, 0xbd, 0x85, 0xbd, 0x32, 0x07, 0x0b, 0x06, 0xa8, 0x0a, 0x0f, 0xfe, 0x11, 0x72, 0x0e, 0x20, 0x24, 0x0f, 0x9e, 0x03, 0x39, 0x0a, 0x02, 0x00,
+  0x0e, 0x9e, 0x03, 0x0f, 0xb2, 0x03, 0x5f, 0x04, 0x0e, 0x24, 0x04, 0x84, 0x03, 0x04, 0xd2, 0x2e, 0x0c, 0xb6, 0x27, 0x13, 0x5c, 0x1e, 0x00, 0x06, 0x06, 0x00, 0x17, 0x5b, 0x1e, 0x00, 0x08, 0xac,
+  0x02, 0x1a, 0x5b, 0xaa, 0x02, 0x06, 0x4a, 0x12, 0x04, 0x5c, 0x00, 0x0f, 0x70, 0x03, 0x3a, 0x1e, 0x3c, 0x80, 0x07, 0x0b, 0x4a, 0x0e, 0x0e, 0x5e, 0x0e, 0x0f, 0x90, 0x03, 0x17, 0x0e, 0x7a, 0x03,
+  0x09, 0xc2, 0x11, 0x08, 0xbe, 0x04, 0x01, 0x56, 0x3e, 0x00, 0xa0, 0x23, 0x70, 0x9a, 0x8d, 0xbb, 0x95, 0xdb, 0xa5, 0x1b, 0x2a, 0x0e, 0x03, 0xde, 0x43, 0x26, 0x1a, 0xb6, 0xb8, 0x3c, 0x01, 0x00,
+  0x2e, 0x12, 0xb5, 0x1e, 0x0e, 0x15, 0x5b, 0xf6, 0x43, 0x06, 0x94, 0x03, 0x00, 0x8a, 0x03, 0x01, 0x8c, 0x03, 0x05, 0x04, 0x44, 0x02, 0x80, 0x03, 0x10, 0xd9, 0xd6, 0x11, 0x15, 0xa5, 0x80, 0x40,
+  0x03, 0x86, 0x1c, 0x00, 0x4a, 0x39, 0x02, 0x02, 0x00, 0x02, 0x48, 0x27, 0x07, 0x02, 0x00, 0x03, 0x32, 0x27, 0x0f, 0x90, 0x03, 0x11, 0x0f, 0x58, 0x0e, 0x02, 0x0f, 0x16, 0x00, 0x04, 0x0f, 0x3c,
+  0x19, 0x0b, 0x2f, 0xbc, 0x85, 0x80, 0x03, 0x31, 0x0f, 0xcc, 0x1c, 0x17, 0x1a, 0x7c, 0x14, 0x00, 0x0f, 0x36, 0x2b, 0x44, 0x04, 0x5e, 0x20, 0x0f, 0x46, 0x07, 0x61, 0x1b, 0x5b, 0x90, 0x03, 0x08,
+  0xec, 0x0a, 0x06, 0x8a, 0x03, 0x06, 0xd4, 0x27, 0x06, 0x90, 0x03, 0x02, 0x94, 0x02, 0x0a, 0x9a, 0x03, 0x16, 0x5b, 0x90, 0x03, 0x07, 0x1a, 0x41, 0x2f, 0x3c, 0x6d, 0xfe, 0x06, 0x37, 0x07, 0x10,
+  0x04, 0x02, 0x70, 0x0a, 0x0b, 0x70, 0x03, 0x0d, 0x32, 0x0b, 0x29, 0x6d, 0x3b, 0x12, 0x2b, 0x0f, 0x12, 0x07, 0x13, 0x0c, 0x4a, 0x15, 0x03, 0x50, 0x15, 0x1c, 0x75, 0x90, 0x03, 0x11, 0x3b, 0x46,
+  0x44, 0x20, 0x9a, 0x95, 0x6a, 0x43, 0x13, 0x3b, 0x94, 0x1f, 0x06, 0xe6, 0x06, 0x00, 0x8e, 0x03, 0x20, 0xb9, 0xad, 0x22, 0x35, 0x07, 0x62, 0x40, 0x10, 0xbe, 0x02, 0x00, 0x24, 0x3a, 0xbe, 0xa0,
+  0x18, 0x11, 0x3a, 0x02, 0x00, 0x08, 0xa8, 0x0a, 0x09, 0x08, 0x44, 0x12, 0xa5, 0xfa, 0x1f, 0x04, 0xf0, 0x18, 0x04, 0x8e, 0x03, 0x15, 0x58, 0x02, 0x00, 0x02, 0xd8, 0x23, 0x04, 0x58, 0x0e, 0x2e,
+  0x99, 0x9d, 0xb0, 0x0a, 0x0a, 0x84, 0x03, 0x0f, 0xcc, 0x0a, 0x0b, 0x0f, 0x96, 0x03, 0x10, 0x04, 0x50, 0x07, 0x03, 0x8a, 0x0e, 0x0f, 0xaa, 0x1c, 0x47, 0x0f, 0x4c, 0x07, 0x18, 0x0f, 0x8c, 0x39,
+  0x4c, 0x0f, 0x1c, 0x12, 0x26, 0x1f, 0x75, 0x02, 0x00, 0x0e, 0x0f, 0x24, 0x00, 0x09, 0x0f, 0xd2, 0x0a, 0x0a, 0x0f, 0x64, 0x00, 0x05, 0x18, 0x5b, 0x02, 0x00, 0x0a, 0x2a, 0x00, 0x0d, 0x10, 0x28,
+  0x02, 0x4a, 0x03, 0x08, 0x60, 0x07, 0x04, 0x96, 0x3d, 0x08, 0x08, 0x00, 0x0e, 0x8a, 0x0e, 0x08, 0x5a, 0x03, 0x0c, 0x3e, 0x00, 0x0f, 0x02, 0x00, 0x3f, 0x0b, 0xf4, 0x07, 0x06, 0x8c, 0x03, 0x08,
+  0x90, 0x03, 0x02, 0x0e, 0x00, 0x23, 0x7d, 0x5b, 0xf2, 0x35, 0x00, 0x0a, 0x27, 0x11, 0xfb, 0x74, 0x47, 0x04, 0xf4, 0x0d, 0x00, 0x08, 0x00, 0x52, 0xf9, 0xad, 0xf9, 0xad, 0xd9, 0x9c, 0x11, 0x16,
+  0xb5, 0x02, 0x00, 0x01, 0x9a, 0x03, 0x01, 0x86, 0x03, 0x10, 0x3b, 0x06, 0x00, 0x05, 0x4c, 0x07, 0x11, 0xd9, 0xbe, 0x03, 0x03, 0x7a, 0x40, 0x07, 0x96, 0x23, 0x17, 0x79, 0x16, 0x07, 0x01, 0x4c,
+  0x39, 0x41, 0x8d, 0x38, 0x8d, 0x38, 0x0c, 0x32, 0x00, 0x02, 0x00, 0x00, 0x98, 0x47, 0x31, 0x58, 0x8d, 0x59, 0x96, 0x03, 0x00, 0xd2, 0x23, 0x0f, 0x70, 0x03, 0x11, 0x0f, 0x20, 0x00, 0x13, 0x1f,
+  0x9c, 0x02, 0x00, 0x10, 0x18, 0xbc, 0x38, 0x07, 0x0f, 0xc0, 0x03, 0x09, 0x0f, 0x64, 0x07, 0x03, 0x0a, 0x3e, 0x00, 0x0e, 0x0e, 0x07, 0x0e, 0xac, 0x03, 0x0f, 0x1a, 0x36, 0x1f, 0x0e, 0x24, 0x36,
+  0x0f, 0x66, 0x3d, 0x58, 0x0e, 0xf0, 0x15, 0x0e, 0xec, 0x03, 0x0f, 0x12, 0x04, 0x0c, 0x1b, 0x6d, 0x9e, 0x03, 0x05, 0xec, 0x47, 0x0e, 0x38, 0x04, 0x00, 0xec, 0x00, 0x12, 0x5b, 0x02, 0x00, 0x09,
+  0x96, 0x03, 0x17, 0x7b, 0xbc, 0x03, 0x0a, 0xa2, 0x03, 0x04, 0x7e, 0x0e, 0x0f, 0x20, 0x03, 0x18, 0x18, 0x65, 0xba, 0x0e, 0x0f, 0x4c, 0x0a, 0x08, 0x0f, 0x02, 0x00, 0x01, 0x05, 0x68, 0x0a, 0x0f,
+  0x80, 0x0a, 0x05, 0x0e, 0x20, 0x0e, 0x06, 0x02, 0x07, 0x04, 0x2a, 0x0e, 0x07, 0x8e, 0x03, 0x00, 0x36, 0x0e, 0x22, 0x6d, 0x5a, 0x8e, 0x03, 0x02, 0xf8, 0x00, 0x22, 0x85, 0x7b, 0x08, 0x2b, 0x12,
+  0x95, 0xfa, 0x1f, 0x08, 0xf2, 0x0d, 0x15, 0xda, 0x0a, 0x00, 0x04, 0x26, 0x1c, 0x09, 0x92, 0x03, 0x27, 0xb6, 0x1a, 0x98, 0x47, 0x03, 0x4a, 0x07, 0x03, 0x16, 0x2e, 0x06, 0x10, 0x07, 0x14, 0x78,
+  0x08, 0x07, 0x01, 0x86, 0x03, 0x00, 0x72, 0x2e, 0x10, 0x19, 0x86, 0x2e, 0x00, 0x16, 0x4b, 0x10, 0x84, 0x08, 0x00, 0x24, 0x38, 0x85, 0x92, 0x3c, 0x00, 0x92, 0x03, 0x00, 0x8a, 0x40, 0x2f, 0xbc,
+  0x85, 0x02, 0x00, 0x1b, 0x1e, 0x9c, 0x3a, 0x07, 0x0f, 0x92, 0x03, 0x12, 0x04, 0x3c, 0x00, 0x1f, 0x9c, 0x02, 0x00, 0x31, 0x07, 0x6c, 0x19, 0x1f, 0x7c, 0x3e, 0x07, 0x0c, 0x0e, 0x82, 0x32, 0x0f,
+  0xac, 0x03, 0x16, 0x1f, 0x75, 0x02, 0x00, 0x81, 0x0c, 0x92, 0x03, 0x0e, 0xf0, 0x06, 0x05, 0xf8, 0x06, 0x00, 0x4a, 0x03, 0x07, 0x7c, 0x4b, 0x0b, 0x02, 0x00, 0x21, 0x7d, 0x5b, 0xe6, 0x00, 0x34,
+  0x7b, 0x7d, 0x7b, 0x94, 0x03, 0x07, 0x9c, 0x03, 0x13, 0x7b, 0x38, 0x00, 0x04, 0xc6, 0x02, 0x0e, 0x4e, 0x07, 0x03, 0x90, 0x0d, 0x1f, 0x75, 0xc2, 0x06, 0x21, 0x1e, 0x1b, 0x84, 0x03, 0x05, 0x54,
+  0x00, 0x2a, 0x5b, 0x75, 0x22, 0x04, 0x09, 0x9c, 0x03, 0x09, 0x90, 0x11, 0x0e, 0x92, 0x03, 0x02, 0x90, 0x00, 0x09, 0x5c, 0x04, 0x0d, 0x02, 0x00, 0x13, 0x5a, 0xc8, 0x11, 0x31, 0x5a, 0x7d, 0x5b,
+  0x3c, 0x44, 0x11, 0x7a, 0x02, 0x00, 0x11, 0x79, 0xd4, 0x11, 0x02, 0x8a, 0x4a, 0x06, 0x76, 0x0a, 0x03, 0x6c, 0x47, 0x09, 0x10, 0x00, 0x06, 0x9c, 0x03, 0x0b, 0xd8, 0x0a, 0x02, 0x9c, 0x0a, 0x07,
+  0x8c, 0x03, 0x13, 0x79, 0x8a, 0x03, 0x11, 0x38, 0x14, 0x07, 0x10, 0x39, 0x78, 0x03, 0x00, 0x98, 0x2e, 0x00, 0x8e, 0x03, 0x12, 0x7c, 0x02, 0x00, 0x02, 0x92, 0x03, 0x00, 0x9a, 0x03, 0x00, 0x20,
+  0x00, 0x00, 0x6e, 0x2b, 0x34, 0x38, 0x8d, 0xbc, 0x02, 0x00, 0x1f, 0x85, 0x02, 0x00, 0x4f, 0x0e, 0x74, 0x07, 0x0f, 0xc8, 0x03, 0x07, 0x0f, 0x76, 0x07, 0x16, 0x0f, 0x9e, 0x0a, 0x05, 0x0e, 0x28,
+  0x00, 0x0f, 0x32, 0x36, 0x16, 0x0d, 0x70, 0x0e, 0x0a, 0x0a, 0x00, 0x0f, 0xac, 0x03, 0x1a, 0x1f, 0x5c, 0x20, 0x00, 0x2c, 0x0e, 0x2c, 0x1d, 0x0a, 0x02, 0x00, 0x13, 0x5b, 0x1a, 0x00, 0x02, 0x36,
+  0x03, 0x13, 0x7c, 0x3c, 0x03, 0x04, 0x52, 0x03, 0x20, 0x7c, 0x7d, 0x04, 0x00, 0x15, 0x7b, 0x16, 0x00, 0x03, 0x52, 0x03, 0x02, 0x88, 0x03, 0x00, 0xec, 0x00, 0x50, 0x85, 0x7b, 0x7d, 0x7b, 0x85,
+  0x76, 0x3b, 0x51, 0xbc, 0x8d, 0xdc, 0x95, 0x5b, 0x7c, 0x2d, 0x20, 0x5b, 0x85, 0x10, 0x03, 0x02, 0x40, 0x00, 0x13, 0x7b, 0x2a, 0x03, 0x22, 0x5c, 0x7d, 0x60, 0x00, 0x15, 0x3b, 0xa8, 0x03, 0x0a,
+  0x76, 0x06, 0x0c, 0x02, 0x00, 0x05, 0x34, 0x03, 0x08, 0x40, 0x03, 0x01, 0x86, 0x03, 0x05, 0x24, 0x00, 0x07, 0x08, 0x04, 0x12, 0x7b, 0x02, 0x00, 0x13, 0x85, 0x02, 0x00, 0x18, 0x7d, 0x02, 0x00,
+  0x02, 0xae, 0x00, 0x02, 0x0e, 0x04, 0x02, 0x82, 0x03, 0x11, 0x5c, 0xf4, 0x00, 0x02, 0x92, 0x03, 0x0a, 0x20, 0x04, 0x1f, 0x5b, 0x02, 0x00, 0x10, 0x22, 0x3a, 0x75, 0x82, 0x3c, 0x00, 0x86, 0x03,
+  0x00, 0x06, 0x03, 0x60, 0xd7, 0x7c, 0x59, 0x8d, 0x38, 0x85, 0x90, 0x03, 0x00, 0x8c, 0x03, 0x05, 0xf0, 0x4a, 0x06, 0x66, 0x4e, 0x12, 0xa5, 0x9a, 0x2a, 0x08, 0xc4, 0x18, 0x06, 0x44, 0x15, 0x12,
+  0xda, 0x6e, 0x1c, 0x05, 0xb4, 0x11, 0x02, 0x8a, 0x4e, 0x02, 0x8a, 0x03, 0x22, 0x38, 0x8d, 0x22, 0x52, 0x04, 0x02, 0x00, 0x02, 0x84, 0x03, 0x3b, 0xd8, 0x7c, 0xf8, 0x02, 0x00, 0x06, 0x22, 0x00,
+  0x00, 0x38, 0x3d, 0x05, 0x90, 0x03, 0x04, 0x96, 0x03, 0x0f, 0xa0, 0x03, 0x48, 0x0e, 0xe2, 0x0a, 0x0f, 0x80, 0x07, 0x05, 0x0e, 0x7a, 0x07, 0x0f, 0x02, 0x00, 0x36, 0x0b, 0x1a, 0x12, 0x0f, 0x40,
+  0x07, 0x05, 0x0f, 0xde, 0x39, 0x11, 0x0f, 0x50, 0x07, 0x48, 0x0f, 0x50, 0x00, 0x20, 0x04, 0x6a, 0x03, 0x00, 0xe0, 0x02, 0x11, 0x9c, 0xca, 0x02, 0x03, 0x04, 0x00, 0x01, 0x12, 0x00, 0x04, 0x9c,
+  0x0a, 0x04, 0xae, 0x00, 0x04, 0x02, 0x03, 0x20, 0x9b, 0x85, 0x9e, 0x3b, 0x80, 0xfd, 0x9d, 0x7e, 0xae, 0x7e, 0xb6, 0x3d, 0xae, 0xfa, 0x4d, 0x10, 0x7b, 0x8a, 0x2d, 0x05, 0x26, 0x03, 0x08, 0x38,
+  0x03, 0x01, 0x42, 0x00, 0x06, 0xc0, 0x06, 0x0c, 0xe8, 0x0a, 0x0f, 0x02, 0x00, 0x13, 0x08, 0x82, 0x03, 0x08, 0x86, 0x03, 0x01, 0x8c, 0x00, 0x17, 0x9b, 0x0e, 0x00, 0x04, 0x9c, 0x03, 0x15, 0x7c,
+  0x80, 0x00, 0x11, 0x5c, 0x82, 0x01, 0x11, 0x5c, 0x64, 0x04, 0x12, 0x3b, 0xda, 0x00, 0x0f, 0x78, 0x00, 0x1c, 0x00, 0x42, 0x39, 0x02, 0x7e, 0x2e, 0x80, 0xfc, 0xa5, 0x3d, 0xae, 0x1c, 0xae, 0x1b,
+  0xae, 0x58, 0x4a, 0x42, 0x58, 0x8d, 0x99, 0x9d, 0xb4, 0x55, 0x00, 0x02, 0x00, 0x03, 0xf2, 0x4a, 0x06, 0xa2, 0x4e, 0x03, 0x90, 0x4e, 0x03, 0x9e, 0x18, 0x07, 0xd0, 0x0a, 0x06, 0xbc, 0x11, 0x06,
+  0xb6, 0x11, 0x02, 0xa2, 0x0a, 0x02, 0x1c, 0x0e, 0x08, 0x88, 0x03, 0x02, 0x46, 0x59, 0x0e, 0x02, 0x00, 0x03, 0x1e, 0x00, 0x13, 0x84, 0xb6, 0x0a, 0x2f, 0x8d, 0xbc, 0x02, 0x00, 0x59, 0x15, 0x85,
+  0xf0, 0x03, 0x0f, 0xd4, 0x03, 0x28, 0x0c, 0x0a, 0x00, 0x0e, 0xa2, 0x0e, 0x0f, 0x96, 0x03, 0x1b, 0x0f, 0x9a, 0x27, 0x05, 0x0f, 0x9a, 0x44, 0x22, 0x0f, 0x96, 0x03, 0x35, 0x0f, 0x10, 0x45, 0x1e,
+  0x15, 0x7b, 0x40, 0x03, 0x20, 0x9b, 0x85, 0xf2, 0x06, 0x02, 0x00, 0x3f, 0x10, 0x7b, 0xe2, 0x02, 0x05, 0x00, 0x03, 0x13, 0x7c, 0x98, 0x03, 0x17, 0x7c, 0xf2, 0x02, 0x11, 0x7a, 0x56, 0x5b, 0xf1,
+  0x04, 0xdb, 0x9d, 0x9e, 0xbe, 0x7e, 0xbe, 0x1c, 0xae, 0x1d, 0xae, 0x1c, 0xae, 0x3d, 0xae, 0xfc, 0xa5, 0x9b, 0x8d, 0x5a, 0x0e, 0x03, 0x11, 0x5b, 0x30, 0x03, 0x05, 0x06, 0x00, 0x2a, 0x7d, 0x7b,
+  0x4c, 0x03, 0x05, 0xee, 0x0a, 0x06, 0xf6, 0x0a, 0x0c, 0x10, 0x00, 0x03, 0x34, 0x03, 0x0c, 0x0c, 0x07, 0x0b, 0x8a, 0x03, 0x0e, 0x92, 0x03, 0x11, 0x7a, 0x02, 0x00, 0x26, 0x7b, 0x85, 0x32, 0x00,
+  0x0c, 0x42, 0x00, 0x11, 0x9c, 0xc8, 0x07, 0x0f, 0x02, 0x00, 0x0e, 0x25, 0x75, 0x7b, 0x2c, 0x0e, 0x12, 0x5b, 0xf2, 0x31, 0x10, 0x8d, 0xb6, 0x55, 0x40, 0x3c, 0xb6, 0x7c, 0xbe, 0x08, 0x4e, 0x51,
+  0x7c, 0xbe, 0x9d, 0xbe, 0x5b, 0xbe, 0x11, 0x00, 0xc4, 0x26, 0x02, 0x04, 0x1c, 0x05, 0xda, 0x3c, 0x03, 0x56, 0x23, 0x07, 0x2a, 0x59, 0x05, 0xd8, 0x55, 0x02, 0x52, 0x1c, 0x06, 0x44, 0x15, 0x12,
+  0x79, 0xa8, 0x0a, 0x06, 0x1a, 0x07, 0x05, 0x8c, 0x03, 0x15, 0xd8, 0x8a, 0x03, 0x20, 0xb8, 0x74, 0xaa, 0x55, 0x00, 0xd8, 0x5c, 0x27, 0xb8, 0x6c, 0x94, 0x03, 0x25, 0x7c, 0xd7, 0x94, 0x03, 0x16,
+  0x39, 0x10, 0x07, 0x0f, 0x02, 0x00, 0x67, 0x0f, 0x08, 0x0b, 0x36, 0x0f, 0x50, 0x12, 0x11, 0x0c, 0x30, 0x00, 0x09, 0xe8, 0x23, 0x0e, 0x64, 0x20, 0x0f, 0x02, 0x00, 0x2d, 0x0f, 0x7c, 0x03, 0x17,
+  0x0f, 0x90, 0x03, 0x12, 0x1f, 0x7b, 0x18, 0x00, 0x06, 0x13, 0x7b, 0x9e, 0x10, 0x00, 0xa0, 0x10, 0x00, 0xba, 0x5e, 0x62, 0xdb, 0x95, 0x1c, 0x9e, 0xdc, 0x9d, 0xea, 0x30, 0x1e, 0x7b, 0x78, 0x06,
+  0x04, 0xf6, 0x02, 0x10, 0x8d, 0xcc, 0x5e, 0xf1, 0x06, 0x1c, 0xa6, 0x9e, 0xbe, 0x9e, 0xc6, 0xbe, 0xc6, 0xde, 0xce, 0x3c, 0xb6, 0x1c, 0xb6, 0x1c, 0xae, 0x1c, 0xa6, 0xfc, 0x9d, 0x9a, 0xb0, 0x34,
+  0x33, 0x9b, 0x8d, 0x7a, 0x42, 0x00, 0x00, 0x14, 0x4e, 0x0e, 0x44, 0x00, 0x05, 0x60, 0x0a, 0x05, 0x08, 0x00, 0x03, 0x34, 0x03, 0x04, 0xce, 0x03, 0x0b, 0xb4, 0x03, 0x0f, 0x8e, 0x03, 0x01, 0x1e,
+  0x7a, 0x96, 0x00, 0x05, 0x02, 0x00, 0x05, 0x50, 0x00, 0x0f, 0xbe, 0x03, 0x02, 0x00, 0x70, 0x04, 0x0a, 0x18, 0x04, 0x0c, 0x02, 0x00, 0x11, 0x7b, 0x36, 0x4b, 0x01, 0x98, 0x00, 0x04, 0x2e, 0x0e,
+  0x10, 0x95, 0xc4, 0x5f, 0x20, 0x1b, 0xae, 0x42, 0x2e, 0x10, 0x5b, 0xd2, 0x1f, 0x61, 0xc6, 0xfe, 0xce, 0xbd, 0xc6, 0x1a, 0xc8, 0x5c, 0x03, 0xb2, 0x18, 0x05, 0x90, 0x03, 0x05, 0x14, 0x0e, 0x03,
+  0x32, 0x07, 0x17, 0xda, 0x02, 0x00, 0x04, 0x8e, 0x03, 0x08, 0x46, 0x15, 0x03, 0xbe, 0x11, 0x0c, 0x8e, 0x03, 0x01, 0x8a, 0x03, 0x11, 0xb7, 0x60, 0x60, 0x11, 0x97, 0x04, 0x00, 0x11, 0x97, 0x94,
+  0x03, 0x05, 0x92, 0x03, 0x00, 0xfc, 0x43, 0x05, 0xb8, 0x0a, 0x0e, 0x90, 0x03, 0x0f, 0x94, 0x03, 0x8b, 0x0b, 0xd0, 0x0a, 0x05, 0x3a, 0x00, 0x0f, 0x82, 0x03, 0x11, 0x0e, 0xe0, 0x20, 0x0e, 0xfe,
+  0x39, 0x0f, 0x20, 0x07, 0x07, 0x0f, 0xce, 0x4b, 0x48, 0x0f, 0x52, 0x00, 0x18, 0x0c, 0x9e, 0x06, 0x08, 0xe0, 0x02, 0x00, 0x70, 0x02, 0x10, 0xdc, 0x5a, 0x3b, 0xb1, 0xa6, 0x5d, 0xae, 0x9e, 0xbe,
+  0xff, 0xc6, 0xbe, 0xbe, 0x3c, 0xae, 0x12, 0x5c, 0x40, 0x8d, 0x7a, 0x8d, 0x7b, 0x02, 0x00, 0x03, 0x5a, 0x03, 0x15, 0x7b, 0xc8, 0x10, 0x00, 0x6e, 0x42, 0x31, 0x7d, 0xb6, 0x5c, 0x50, 0x34, 0x50,
+  0x9d, 0xce, 0xbd, 0xce, 0x3b, 0x6a, 0x3b, 0x03, 0x66, 0x49, 0x21, 0x7a, 0x8d, 0x50, 0x5c, 0x05, 0x40, 0x00, 0x4c, 0xbc, 0x95, 0x9b, 0x8d, 0xce, 0x06, 0x0e, 0x26, 0x03, 0x0e, 0xb8, 0x03, 0x0b,
+  0x12, 0x0e, 0x09, 0x2a, 0x00, 0x14, 0x5b, 0x16, 0x07, 0x14, 0x8d, 0x02, 0x00, 0x03, 0x5a, 0x00, 0x00, 0x0c, 0x00, 0x04, 0x26, 0x00, 0x00, 0x52, 0x03, 0x11, 0x85, 0x1c, 0x00, 0x03, 0x1e, 0x04,
+  0x20, 0x7a, 0x85, 0x54, 0x0b, 0x0e, 0x7e, 0x00, 0x08, 0x08, 0x07, 0x0b, 0xde, 0x03, 0x01, 0x12, 0x39, 0x00, 0x18, 0x07, 0x40, 0x1c, 0xae, 0x3c, 0xae, 0xb0, 0x58, 0x30, 0xbd, 0xce, 0xbd, 0xb2,
+  0x31, 0x70, 0xd6, 0xfe, 0xd6, 0x1e, 0xd7, 0xdd, 0xd6, 0x2c, 0x2e, 0x63, 0xbc, 0xce, 0x5b, 0xbe, 0xfa, 0xb5, 0x12, 0x2e, 0x05, 0xfa, 0x06, 0x04, 0xc4, 0x3f, 0x08, 0x10, 0x44, 0x12, 0xba, 0xd2,
+  0x18, 0x05, 0x90, 0x2a, 0x07, 0xc0, 0x11, 0x20, 0x8d, 0x58, 0xaa, 0x0a, 0x05, 0x32, 0x0e, 0x07, 0x8e, 0x03, 0x01, 0x90, 0x03, 0x02, 0x94, 0x03, 0x04, 0x92, 0x03, 0x01, 0x02, 0x00, 0x27, 0x74,
+  0xb7, 0x90, 0x03, 0x39, 0x39, 0x8d, 0xdc, 0x02, 0x00, 0x1f, 0xbc, 0x02, 0x00, 0xb6, 0x0f, 0xee, 0x27, 0x0a, 0x0f, 0x20, 0x12, 0x14, 0x0f, 0x40, 0x19, 0x30, 0x08, 0x4a, 0x03, 0x1f, 0x75, 0x02,
+  0x00, 0x05, 0x0f, 0x90, 0x03, 0x29, 0x22, 0x7c, 0x7d, 0x56, 0x0a, 0x51, 0xbc, 0x8d, 0xdc, 0x9d, 0xdc, 0x20, 0x3f, 0x71, 0x7d, 0xb6, 0xdf, 0xc6, 0x9e, 0xbe, 0x7d, 0x02, 0x00, 0x20, 0xbe, 0xc6,
+  0x9e, 0x03, 0x22, 0xbb, 0x9d, 0xa8, 0x5f, 0x04, 0x86, 0x03, 0x00, 0x48, 0x62, 0x00, 0x02, 0x00, 0x40, 0x9b, 0x95, 0xdb, 0x9d, 0x2a, 0x06, 0x11, 0x7c, 0x30, 0x2d, 0x00, 0x28, 0x2d, 0x20, 0x5b,
+  0xbe, 0x8a, 0x50, 0x60, 0xbd, 0xc6, 0x9d, 0xbe, 0x3c, 0xae, 0x24, 0x3f, 0xf7, 0x02, 0xbb, 0x9d, 0xfc, 0x9d, 0xfc, 0xa5, 0xdb, 0x9d, 0x9a, 0x95, 0xbb, 0x95, 0x1d, 0xa6, 0xfc, 0x9d, 0x7a, 0x34,
+  0x03, 0x07, 0x5e, 0x0a, 0x16, 0x8d, 0x02, 0x00, 0x00, 0x36, 0x03, 0x05, 0x5c, 0x03, 0x1e, 0x8d, 0x52, 0x07, 0x0e, 0x0c, 0x07, 0x08, 0x90, 0x03, 0x03, 0x32, 0x00, 0x00, 0x44, 0x00, 0x0b, 0x3c,
+  0x07, 0x00, 0x88, 0x03, 0x00, 0x1c, 0x4e, 0x03, 0x46, 0x59, 0x03, 0x66, 0x00, 0x02, 0x84, 0x00, 0x0f, 0xfe, 0x07, 0x05, 0x04, 0xda, 0x03, 0x02, 0x62, 0x60, 0x10, 0x9a, 0x56, 0x3c, 0x00, 0xa6,
+  0x0a, 0x00, 0xe4, 0x00, 0x01, 0x1e, 0x2e, 0x02, 0x02, 0x00, 0x52, 0xfd, 0xd6, 0xdd, 0xd6, 0xbc, 0x4e, 0x35, 0x74, 0xd6, 0x9c, 0xce, 0xbd, 0xc6, 0x5b, 0xbe, 0x1e, 0x0e, 0x00, 0xbe, 0x38, 0x03,
+  0x04, 0x47, 0x07, 0x24, 0x59, 0x00, 0x96, 0x60, 0x09, 0x4a, 0x15, 0x07, 0x60, 0x1c, 0x01, 0x8e, 0x03, 0x07, 0x90, 0x03, 0x0b, 0x92, 0x03, 0x00, 0x08, 0x00, 0x1e, 0x6c, 0x90, 0x03, 0x15, 0xd8,
+  0x90, 0x03, 0x3f, 0x59, 0x8d, 0xdc, 0x02, 0x00, 0x12, 0x0f, 0x9c, 0x03, 0xaa, 0x1f, 0x85, 0xa6, 0x12, 0x07, 0x0f, 0x66, 0x0e, 0x10, 0x07, 0xce, 0x20, 0x0e, 0x3a, 0x2b, 0x0a, 0xee, 0x0a, 0x1f,
+  0x7b, 0x50, 0x0a, 0x06, 0x06, 0x92, 0x03, 0x0f, 0x10, 0x00, 0x09, 0x0f, 0x42, 0x12, 0x0d, 0x0e, 0x60, 0x00, 0x05, 0x70, 0x06, 0xf2, 0x02, 0x8d, 0xdc, 0x95, 0x1d, 0xa6, 0x1d, 0xa6, 0xfc, 0xa5,
+  0xfb, 0xad, 0x3c, 0xb6, 0x9d, 0xc6, 0x9d, 0xc6, 0x66, 0x03, 0x00, 0x4e, 0x42, 0x20, 0x1c, 0xa6, 0x5a, 0x03, 0x00, 0x06, 0x00, 0x22, 0xbb, 0x95, 0x8a, 0x03, 0x01, 0x44, 0x63, 0x60, 0x95, 0xbb,
+  0x95, 0xfb, 0x9d, 0x1c, 0xb8, 0x09, 0x01, 0x18, 0x2d, 0x13, 0x7c, 0x02, 0x26, 0x02, 0x92, 0x03, 0x60, 0x7c, 0xbe, 0x1b, 0xb6, 0xfb, 0xad, 0x38, 0x3f, 0x24, 0xfc, 0xa5, 0x98, 0x03, 0x11, 0x3d,
+  0x90, 0x03, 0x0a, 0x92, 0x03, 0x12, 0x7b, 0x6e, 0x5c, 0x03, 0x8a, 0x03, 0x0e, 0x02, 0x00, 0x0f, 0x92, 0x03, 0x0f, 0x1f, 0x7a, 0x20, 0x00, 0x0c, 0x02, 0xac, 0x03, 0x00, 0xa0, 0x51, 0x00, 0xd6,
+  0x46, 0x40, 0xfc, 0xa5, 0x3c, 0xa6, 0x40, 0x4a, 0x03, 0xc6, 0x63, 0x2f, 0x8d, 0x7b, 0x62, 0x00, 0x07, 0x07, 0x92, 0x00, 0x26, 0x9a, 0x95, 0x8e, 0x03, 0x23, 0x5b, 0xbe, 0x12, 0x2e, 0x11, 0xce,
+  0x04, 0x00, 0x02, 0xac, 0x31, 0x90, 0xce, 0x9c, 0xd6, 0x9b, 0xce, 0xbc, 0xd6, 0xbc, 0xd6, 0x92, 0x04, 0x01, 0x7a, 0x35, 0x01, 0x94, 0x03, 0x00, 0xd4, 0x18, 0x44, 0x7d, 0xbe, 0x5d, 0xbe, 0xfa,
+  0x3f, 0x0c, 0x02, 0x00, 0x06, 0x1c, 0x07, 0x05, 0x72, 0x23, 0x0d, 0xc8, 0x11, 0x01, 0x3e, 0x0e, 0x07, 0xcc, 0x11, 0x04, 0x12, 0x07, 0x53, 0xb7, 0x74, 0xd7, 0x74, 0xd7, 0xa4, 0x03, 0x00, 0x20,
+  0x00, 0x04, 0x62, 0x15, 0x1f, 0xdc, 0x02, 0x00, 0x3e, 0x06, 0x0a, 0x03, 0x0f, 0xce, 0x03, 0x01, 0x0f, 0xde, 0x03, 0x70, 0x0e, 0x0a, 0x12, 0x0f, 0x30, 0x07, 0x11, 0x1f, 0x85, 0xee, 0x1c, 0x0d,
+  0x06, 0xb2, 0x06, 0x1f, 0x7c, 0x5e, 0x2b, 0x17, 0x0f, 0x10, 0x07, 0x16, 0x04, 0x90, 0x00, 0x0d, 0xa6, 0x0a, 0x00, 0x1e, 0x06, 0x01, 0xa8, 0x66, 0x62, 0xdc, 0x9d, 0xfc, 0xad, 0xfb, 0xad, 0x5c,
+  0x3b, 0x00, 0x5e, 0x3b, 0x11, 0x5b, 0x90, 0x37, 0x00, 0x64, 0x09, 0x00, 0x82, 0x49, 0x20, 0x3d, 0xae, 0x8a, 0x49, 0x13, 0xbb, 0x76, 0x5b, 0x01, 0xfe, 0x49, 0x00, 0x98, 0x49, 0x10, 0xbe, 0x90,
+  0x03, 0x80, 0x7c, 0xce, 0x7c, 0xce, 0x7b, 0xce, 0x5b, 0xc6, 0x50, 0x0d, 0x12, 0x3a, 0x48, 0x2d, 0x01, 0xbe, 0x37, 0x20, 0x1c, 0xb6, 0x0e, 0x46, 0x02, 0x28, 0x4a, 0x04, 0x68, 0x07, 0x02, 0x9a,
+  0x06, 0x01, 0x6a, 0x07, 0x01, 0x08, 0x0a, 0x02, 0xf6, 0x02, 0x04, 0xa8, 0x03, 0x1d, 0x9b, 0x98, 0x03, 0x00, 0xa2, 0x06, 0x0f, 0x92, 0x03, 0x0d, 0x1f, 0x7a, 0xd8, 0x06, 0x03, 0x25, 0x85, 0x9b,
+  0x5c, 0x00, 0x00, 0x6a, 0x0a, 0xa0, 0x5d, 0xb6, 0xde, 0xc6, 0xff, 0xc6, 0xbe, 0xc6, 0x9e, 0xbe, 0x26, 0x04, 0x00, 0x96, 0x43, 0x03, 0x08, 0x04, 0x0d, 0x88, 0x03, 0x08, 0x84, 0x00, 0x00, 0x1a,
+  0x01, 0x02, 0xf2, 0x00, 0x01, 0x0a, 0x08, 0x01, 0xa6, 0x31, 0x03, 0xe6, 0x38, 0x00, 0x90, 0x03, 0x00, 0x92, 0x03, 0x00, 0x46, 0x35, 0x01, 0x90, 0x03, 0x31, 0x7b, 0xc6, 0x3a, 0xb0, 0x03, 0x00,
+  0x56, 0x0e, 0x11, 0x7b, 0xb8, 0x03, 0x10, 0x5b, 0xc8, 0x0b, 0x21, 0xbe, 0xda, 0xb6, 0x0a, 0x04, 0x80, 0x4a, 0x04, 0xda, 0x26, 0x06, 0x68, 0x1c, 0x17, 0x79, 0xe2, 0x18, 0x04, 0x90, 0x03, 0x02,
+  0x08, 0x6b, 0x07, 0x5c, 0x15, 0x03, 0xea, 0x18, 0x13, 0xd7, 0x98, 0x03, 0x13, 0xd7, 0x02, 0x00, 0x13, 0xb7, 0x64, 0x15, 0x00, 0xdc, 0x4e, 0x01, 0xb0, 0x0a, 0x1f, 0x95, 0x02, 0x00, 0x02, 0x19,
+  0x8d, 0x0c, 0x00, 0x17, 0x8d, 0x10, 0x00, 0x04, 0x58, 0x03, 0x0c, 0x30, 0x00, 0x0f, 0x8e, 0x03, 0x04, 0x0e, 0x0c, 0x00, 0x0f, 0x74, 0x07, 0x7b, 0x34, 0x9c, 0x8d, 0x9c, 0x08, 0x00, 0x38, 0x85,
+  0x9c, 0x8d, 0xa6, 0x15, 0x02, 0x0a, 0x09, 0x0f, 0xf8, 0x1c, 0x17, 0x09, 0xc2, 0x14, 0x0e, 0x8a, 0x11, 0x03, 0x8e, 0x03, 0x0e, 0xfa, 0x0d, 0x08, 0x5a, 0x07, 0x03, 0x64, 0x03, 0x05, 0x06, 0x00,
+  0x02, 0x20, 0x1c, 0x0e, 0xd0, 0x02, 0x0b, 0x94, 0x11, 0x02, 0x1a, 0x0d, 0x20, 0xa6, 0x1c, 0x5a, 0x49, 0x02, 0xce, 0x65, 0x13, 0xbe, 0x8e, 0x29, 0x10, 0xae, 0xd0, 0x45, 0x00, 0x2e, 0x2d, 0x30,
+  0x1c, 0xae, 0x1c, 0x74, 0x49, 0x01, 0x66, 0x49, 0x00, 0x12, 0x51, 0x00, 0x36, 0x42, 0x00, 0x88, 0x3b, 0x10, 0x3b, 0x4a, 0x34, 0x12, 0xce, 0xa4, 0x02, 0x02, 0x58, 0x3b, 0x31, 0xfa, 0xb5, 0xb9,
+  0x78, 0x62, 0x00, 0x86, 0x03, 0x11, 0xfb, 0xa0, 0x09, 0x00, 0xde, 0x29, 0x60, 0xfc, 0xad, 0xdc, 0xa5, 0x9b, 0x9d, 0xb8, 0x0d, 0x04, 0xf0, 0x02, 0x02, 0x60, 0x0e, 0x11, 0x5a, 0x6e, 0x07, 0x02,
+  0xd6, 0x5b, 0x02, 0xba, 0x46, 0x02, 0xb2, 0x0e, 0x01, 0x22, 0x00, 0x01, 0xea, 0x15, 0x06, 0x50, 0x0a, 0x31, 0x9b, 0x85, 0x7a, 0xda, 0x0d, 0x02, 0x32, 0x60, 0x34, 0x9b, 0x85, 0x5b, 0xde, 0x0d,
+  0x2d, 0x7d, 0x7a, 0x64, 0x15, 0x12, 0x7a, 0xca, 0x0a, 0x01, 0x2a, 0x5c, 0x10, 0xfb, 0x52, 0x04, 0x70, 0xb6, 0xfe, 0xce, 0xde, 0xce, 0x9d, 0xc6, 0x02, 0x00, 0x20, 0x3c, 0xb6, 0x5a, 0x04, 0x02,
+  0x1e, 0x07, 0x13, 0x7a, 0x5e, 0x00, 0x15, 0x9b, 0x2e, 0x0b, 0x01, 0x16, 0x00, 0x07, 0x02, 0x00, 0x03, 0x82, 0x04, 0x01, 0x3a, 0x08, 0x04, 0x90, 0x03, 0x17, 0x7c, 0xa6, 0x31, 0x02, 0x96, 0x03,
+  0x04, 0xc8, 0x38, 0x00, 0x2c, 0x08, 0x02, 0x02, 0x00, 0x00, 0x28, 0x00, 0x64, 0xdd, 0xce, 0xdd, 0xc6, 0xb9, 0xa5, 0x8a, 0x03, 0x11, 0x58, 0x02, 0x00, 0x02, 0x8e, 0x4a, 0x06, 0xa8, 0x0a, 0x06,
+  0x1e, 0x07, 0x06, 0x72, 0x1c, 0x24, 0xf8, 0x84, 0x90, 0x03, 0x3d, 0xd7, 0x7c, 0xf7, 0x72, 0x1c, 0x04, 0x02, 0x00, 0x00, 0xb8, 0x55, 0x01, 0x96, 0x03, 0x01, 0x5e, 0x15, 0x02, 0xb4, 0x23, 0x2f,
+  0xdc, 0x95, 0x02, 0x00, 0x4a, 0x0e, 0x2e, 0x07, 0x0f, 0x0a, 0x0b, 0x76, 0x00, 0x32, 0x02, 0x00, 0x88, 0x03, 0x06, 0x98, 0x03, 0x07, 0x02, 0x00, 0x0f, 0x90, 0x03, 0x06, 0x15, 0x7b, 0x0a, 0x00,
+  0x22, 0x9b, 0x7d, 0x06, 0x00, 0x02, 0x02, 0x00, 0x08, 0x1e, 0x07, 0x0f, 0xec, 0x06, 0x0b, 0x1b, 0x9c, 0x98, 0x03, 0x14, 0x9b, 0x08, 0x00, 0x0f, 0xae, 0x09, 0x02, 0x0f, 0x42, 0x11, 0x0e, 0x02,
+  0x0c, 0x0e, 0x01, 0x12, 0x2d, 0x02, 0xe6, 0x4c, 0x24, 0xfb, 0xb5, 0xfa, 0x70, 0x00, 0xf4, 0x53, 0x04, 0x8a, 0x10, 0x00, 0x78, 0x69, 0x42, 0x1b, 0xae, 0xdb, 0xad, 0x52, 0x1b, 0x02, 0x32, 0x42,
+  0x00, 0x8e, 0x03, 0x13, 0x5c, 0x3a, 0x0e, 0x02, 0xdc, 0x37, 0x00, 0x56, 0x07, 0x01, 0x7c, 0x50, 0x06, 0x7e, 0x1b, 0xd0, 0x9d, 0x9a, 0x95, 0x79, 0x95, 0xbb, 0xa5, 0xfc, 0xad, 0xfc, 0xad, 0x9b,
+  0x9d, 0x7e, 0x03, 0x00, 0x04, 0x03, 0x00, 0x74, 0x03, 0x10, 0xbb, 0x86, 0x54, 0x04, 0x9c, 0x0d, 0x15, 0x95, 0x1c, 0x75, 0x03, 0x4c, 0x0a, 0x03, 0x9c, 0x06, 0x00, 0x46, 0x6d, 0x03, 0x88, 0x03,
+  0x00, 0x72, 0x5c, 0x20, 0x39, 0x7d, 0x06, 0x00, 0x00, 0x38, 0x03, 0x02, 0xf6, 0x15, 0x17, 0x5a, 0x4a, 0x15, 0x08, 0x8c, 0x03, 0x02, 0x62, 0x03, 0x00, 0xba, 0x03, 0x60, 0x79, 0x8d, 0x1b, 0xa6,
+  0xbe, 0xbe, 0xca, 0x00, 0x20, 0x9c, 0xc6, 0x84, 0x11, 0x40, 0xde, 0xd6, 0x7c, 0xc6, 0x8c, 0x5f, 0x02, 0xb8, 0x4a, 0x16, 0x9b, 0x90, 0x03, 0x07, 0xa2, 0x0a, 0x00, 0x0a, 0x00, 0x1b, 0x9a, 0x90,
+  0x03, 0x11, 0xda, 0xb6, 0x46, 0x11, 0x5c, 0x38, 0x35, 0x13, 0x7c, 0x96, 0x31, 0x04, 0x94, 0x03, 0x03, 0x08, 0x00, 0x03, 0x90, 0x03, 0x11, 0x7b, 0x9c, 0x43, 0x00, 0xe0, 0x11, 0x65, 0xdc, 0xce,
+  0x1e, 0xd7, 0x1b, 0xb6, 0x5e, 0x1c, 0x01, 0x48, 0x0e, 0x06, 0x3c, 0x0e, 0x03, 0xd0, 0x11, 0x05, 0x90, 0x03, 0x2e, 0x38, 0x8d, 0x90, 0x03, 0x0b, 0x02, 0x00, 0x16, 0x84, 0x2a, 0x27, 0x04, 0x42,
+  0x07, 0x32, 0x18, 0x7d, 0xf8, 0xb2, 0x03, 0x02, 0x18, 0x00, 0x32, 0x8d, 0xfc, 0x95, 0x02, 0x00, 0x0f, 0x92, 0x03, 0x47, 0x04, 0x76, 0x03, 0x0f, 0x90, 0x03, 0x1a, 0x11, 0x95, 0x02, 0x00, 0x0f,
+  0x2a, 0x07, 0x5e, 0x04, 0x9e, 0x03, 0x07, 0xa0, 0x03, 0x0b, 0x90, 0x03, 0x04, 0xa2, 0x03, 0x04, 0xae, 0x03, 0x14, 0x9b, 0x52, 0x10, 0x0e, 0x56, 0x0a, 0x07, 0xbc, 0x0a, 0x08, 0x92, 0x03, 0x08,
+  0x50, 0x07, 0x1c, 0x9c, 0x7a, 0x0a, 0x0b, 0x28, 0x06, 0x1e, 0x9b, 0x92, 0x03, 0x0e, 0xb0, 0x10, 0x01, 0x1c, 0x03, 0x00, 0x98, 0x49, 0x02, 0x78, 0x50, 0x02, 0xaa, 0x5e, 0x11, 0x1b, 0x1e, 0x07,
+  0x02, 0xf6, 0x53, 0x11, 0xba, 0x88, 0x50, 0x06, 0x02, 0x00, 0x31, 0x1b, 0xae, 0x5c, 0xb0, 0x49, 0x00, 0x76, 0x69, 0x13, 0x5c, 0xa0, 0x09, 0x02, 0x86, 0x3b, 0x01, 0xfa, 0x37, 0x13, 0xb6, 0x36,
+  0x00, 0x05, 0x56, 0x58, 0x10, 0x9a, 0xb2, 0x0a, 0x00, 0x0c, 0x6e, 0x00, 0x6a, 0x6a, 0x01, 0x68, 0x03, 0x80, 0xbb, 0x95, 0xfc, 0x9d, 0xfc, 0x9d, 0xdb, 0xa5, 0xac, 0x1c, 0x11, 0xba, 0x22, 0x00,
+  0x71, 0xfb, 0xa5, 0x3d, 0xae, 0xba, 0x9d, 0x59, 0x78, 0x51, 0x11, 0xdb, 0x28, 0x00, 0x02, 0xdc, 0x0a, 0x20, 0x7a, 0x85, 0x7c, 0x03, 0x02, 0x1a, 0x03, 0x50, 0x1c, 0x9e, 0x7e, 0xae, 0x9a, 0x32,
+  0x6e, 0x03, 0x9e, 0x03, 0x02, 0x8e, 0x03, 0x39, 0x9a, 0x85, 0x9b, 0xde, 0x00, 0x17, 0x9b, 0x00, 0x0e, 0x00, 0xca, 0x26, 0xa0, 0x9d, 0xbe, 0xbe, 0xbe, 0x3b, 0xb6, 0xfa, 0xb5, 0x5b, 0xbe, 0xde,
+  0x4d, 0x60, 0xbd, 0xce, 0x9c, 0xc6, 0x5c, 0xbe, 0xf8, 0x5b, 0x03, 0x64, 0x00, 0x0d, 0x20, 0x07, 0x04, 0x90, 0x03, 0x04, 0x02, 0x00, 0x02, 0xb0, 0x0a, 0x02, 0x94, 0x58, 0x04, 0x36, 0x79, 0x04,
+  0x28, 0x79, 0x00, 0x16, 0x2e, 0x05, 0xd6, 0x38, 0x12, 0xbe, 0xc4, 0x46, 0x04, 0x96, 0x3c, 0x01, 0x24, 0x07, 0x23, 0xc6, 0x99, 0x68, 0x15, 0x10, 0xda, 0x4a, 0x27, 0x0b, 0x2a, 0x20, 0x00, 0x92,
+  0x03, 0x14, 0x78, 0xe6, 0x18, 0x06, 0x20, 0x07, 0x02, 0xb6, 0x75, 0x01, 0x02, 0x00, 0x00, 0x70, 0x03, 0x01, 0x02, 0x00, 0x19, 0x85, 0x02, 0x00, 0x00, 0xb8, 0x2a, 0x0c, 0x10, 0x00, 0x03, 0xec,
+  0x0a, 0x2f, 0xdc, 0x95, 0x02, 0x00, 0x4e, 0x0f, 0x6e, 0x0e, 0x09, 0x17, 0x95, 0x7a, 0x03, 0x04, 0x0a, 0x00, 0x17, 0x95, 0x02, 0x00, 0x09, 0xce, 0x03, 0x0f, 0xba, 0x0a, 0x53, 0x0d, 0x16, 0x00,
+  0x0f, 0x90, 0x03, 0x12, 0x0a, 0x4a, 0x07, 0x04, 0x62, 0x02, 0x27, 0x9c, 0x85, 0x78, 0x0e, 0x07, 0x38, 0x00, 0x08, 0x02, 0x00, 0x0f, 0x18, 0x14, 0x05, 0x11, 0x9c, 0xf6, 0x00, 0x11, 0xbc, 0x20,
+  0x0d, 0x08, 0xf4, 0x09, 0x1d, 0x9b, 0xb4, 0x10, 0x11, 0xbb, 0x04, 0x03, 0x11, 0xfb, 0xb8, 0x50, 0x02, 0x24, 0x07, 0x00, 0x90, 0x03, 0x02, 0x08, 0x00, 0x08, 0xd6, 0x62, 0x01, 0xa2, 0x29, 0x01,
+  0xbe, 0x0a, 0x20, 0x3c, 0xb6, 0xa6, 0x70, 0x04, 0xc4, 0x5e, 0x04, 0x34, 0x0d, 0x10, 0x5c, 0x8e, 0x3b, 0x10, 0xbe, 0x48, 0x07, 0x01, 0x42, 0x54, 0x03, 0xe2, 0x5b, 0x06, 0x90, 0x03, 0x01, 0xe8,
+  0x54, 0x00, 0xd8, 0x54, 0x60, 0x85, 0x9a, 0x8d, 0xfc, 0x9d, 0x1c, 0x3c, 0x20, 0x30, 0xb6, 0x3d, 0xb6, 0x52, 0x00, 0x02, 0x0e, 0x0b, 0x02, 0x9e, 0x7b, 0x02, 0xa6, 0x03, 0x00, 0x28, 0x00, 0x02,
+  0x82, 0x6a, 0x01, 0x84, 0x19, 0xc0, 0x9d, 0x1d, 0xa6, 0xbf, 0xb6, 0xdf, 0xbe, 0x9e, 0xb6, 0xfc, 0xa5, 0x5a, 0x50, 0x63, 0x05, 0xa6, 0x63, 0x1b, 0x7a, 0x40, 0x0e, 0x00, 0x60, 0x03, 0x04, 0x76,
+  0x0a, 0x00, 0xda, 0x00, 0x40, 0xba, 0x9d, 0x7d, 0xbe, 0x58, 0x0b, 0x00, 0x26, 0x03, 0x20, 0xbc, 0xce, 0xdc, 0x06, 0x60, 0x9d, 0xce, 0x3b, 0xb6, 0x99, 0x9d, 0x20, 0x67, 0x13, 0xbb, 0x8a, 0x07,
+  0x08, 0xe0, 0x15, 0x04, 0x9c, 0x07, 0x05, 0x8e, 0x03, 0x21, 0x8d, 0x9b, 0x30, 0x7c, 0x13, 0xda, 0xfe, 0x3b, 0x01, 0xac, 0x5f, 0x07, 0x16, 0x2e, 0x19, 0x3a, 0xce, 0x7c, 0x02, 0xf2, 0x18, 0x20,
+  0x3b, 0xb6, 0xac, 0x31, 0x00, 0x3e, 0x08, 0x31, 0xd9, 0xad, 0x78, 0xc2, 0x58, 0x00, 0x24, 0x55, 0x11, 0x5c, 0x3a, 0x08, 0x02, 0x38, 0x20, 0x02, 0x62, 0x0f, 0x50, 0x99, 0xa5, 0x78, 0xa5, 0x78,
+  0xd0, 0x7c, 0x01, 0x4e, 0x0e, 0x10, 0x78, 0x02, 0x00, 0x0b, 0xb8, 0x0a, 0x17, 0x38, 0x7a, 0x03, 0x04, 0x74, 0x03, 0x17, 0x39, 0x02, 0x00, 0x01, 0x14, 0x00, 0x03, 0x1a, 0x00, 0x11, 0x59, 0x54,
+  0x2e, 0x1f, 0xdc, 0x02, 0x00, 0x5b, 0x1c, 0x8d, 0x92, 0x0e, 0x09, 0x7e, 0x03, 0x07, 0x90, 0x03, 0x0f, 0xce, 0x03, 0x03, 0x09, 0x3e, 0x07, 0x0c, 0x40, 0x07, 0x0e, 0xda, 0x03, 0x0a, 0x1c, 0x00,
+  0x0f, 0xb2, 0x03, 0x32, 0x0e, 0x90, 0x03, 0x0e, 0x92, 0x03, 0x0e, 0xa6, 0x03, 0x04, 0x0a, 0x00, 0x1d, 0xbc, 0x82, 0x03, 0x08, 0x10, 0x00, 0x08, 0xaa, 0x14, 0x00, 0x06, 0x00, 0x00, 0xa6, 0x0f,
+  0x00, 0x90, 0x03, 0x03, 0xda, 0x10, 0x0b, 0xaa, 0x1b, 0x04, 0x02, 0x00, 0x33, 0xbb, 0x8d, 0xbb, 0x20, 0x07, 0x26, 0xfb, 0xa5, 0x02, 0x07, 0x03, 0x98, 0x03, 0x00, 0xb2, 0x5b, 0x07, 0x00, 0x6a,
+  0x11, 0xfb, 0x04, 0x00, 0x02, 0x20, 0x00, 0x02, 0xd6, 0x0a, 0x00, 0x8e, 0x29, 0x02, 0x74, 0x0e, 0x02, 0x76, 0x0e, 0x00, 0x56, 0x07, 0x02, 0xe6, 0x5b, 0x23, 0xbb, 0x9d, 0x22, 0x07, 0x03, 0x90,
+  0x03, 0x60, 0x9a, 0x9d, 0x39, 0x95, 0x18, 0x8d, 0x74, 0x10, 0x00, 0x9c, 0x17, 0x02, 0xa8, 0x09, 0x24, 0xba, 0xa5, 0x00, 0x04, 0x00, 0xc6, 0x03, 0x02, 0x42, 0x06, 0x02, 0x56, 0x07, 0x02, 0x1e,
+  0x5c, 0x02, 0xc0, 0x0a, 0x10, 0xbb, 0x34, 0x19, 0x10, 0xa5, 0x02, 0x6a, 0x00, 0x4a, 0x00, 0xb2, 0x9e, 0xbe, 0x9e, 0xbe, 0x5d, 0xae, 0x1c, 0xa6, 0x1c, 0xa6, 0xbb, 0x52, 0x03, 0x04, 0xb2, 0x0a,
+  0x03, 0x10, 0x0e, 0x02, 0x2e, 0x1c, 0x02, 0x02, 0x16, 0x51, 0xba, 0x95, 0xfb, 0xa5, 0x3b, 0xbc, 0x1f, 0x00, 0xf8, 0x0d, 0x02, 0x5a, 0x0a, 0x61, 0x9d, 0xce, 0x5c, 0xbe, 0xda, 0xad, 0x28, 0x04,
+  0x08, 0x66, 0x15, 0x09, 0x3a, 0x0e, 0x08, 0x90, 0x03, 0x11, 0x9a, 0x90, 0x03, 0x34, 0xdb, 0x9d, 0xda, 0xfe, 0x26, 0x1a, 0xb5, 0xae, 0x31, 0x05, 0x00, 0x40, 0x01, 0x86, 0x07, 0x04, 0xea, 0x18,
+  0x20, 0x78, 0x9d, 0xba, 0x2a, 0x22, 0x99, 0x9d, 0x08, 0x00, 0x11, 0xba, 0xea, 0x5f, 0x00, 0x88, 0x03, 0x00, 0x9c, 0x3c, 0x04, 0x3e, 0x40, 0x40, 0xb9, 0xad, 0x99, 0xa5, 0x80, 0x80, 0x14, 0xd9,
+  0x6e, 0x43, 0x03, 0x6a, 0x35, 0x02, 0x1c, 0x01, 0x02, 0x42, 0x6b, 0x00, 0xac, 0x6e, 0x14, 0x38, 0x02, 0x00, 0x0b, 0x8e, 0x03, 0x04, 0x90, 0x03, 0x21, 0x18, 0x85, 0x7e, 0x35, 0x1e, 0x95, 0x90,
+  0x03, 0x0f, 0x02, 0x00, 0x80, 0x0e, 0x90, 0x03, 0x0c, 0xc0, 0x03, 0x0b, 0xa6, 0x03, 0x08, 0x3e, 0x00, 0x1e, 0xbc, 0xc0, 0x03, 0x1f, 0x95, 0xa4, 0x03, 0x11, 0x11, 0xbb, 0x02, 0x00, 0x0f, 0x40,
+  0x07, 0x01, 0x14, 0x9b, 0x7e, 0x0e, 0x04, 0x72, 0x03, 0x06, 0x0a, 0x00, 0x0e, 0x8e, 0x03, 0x0b, 0xae, 0x03, 0x00, 0xd4, 0x15, 0x0d, 0x18, 0x00, 0x05, 0x70, 0x03, 0x03, 0xa0, 0x07, 0x36, 0x95,
+  0x9c, 0x8d, 0x20, 0x06, 0x07, 0x88, 0x03, 0x04, 0x2e, 0x00, 0x04, 0x7a, 0x02, 0x05, 0xf6, 0x1b, 0x04, 0x22, 0x07, 0x00, 0x24, 0x07, 0x03, 0x76, 0x03, 0x12, 0xad, 0xaa, 0x0a, 0x04, 0x76, 0x0a,
+  0x11, 0x7a, 0xb4, 0x74, 0x02, 0x20, 0x71, 0x0c, 0xb4, 0x03, 0x0a, 0xc0, 0x30, 0x02, 0x3a, 0x00, 0x06, 0x02, 0x63, 0x06, 0x3a, 0x00, 0x11, 0xba, 0x3e, 0x54, 0x82, 0x38, 0x8d, 0x59, 0x95, 0xf7,
+  0x84, 0x18, 0x85, 0xcc, 0x05, 0x00, 0x60, 0x5b, 0x22, 0xfb, 0xad, 0xac, 0x7f, 0x33, 0x5c, 0xb6, 0xdb, 0xfe, 0x29, 0x02, 0x3c, 0x26, 0x02, 0x3e, 0x00, 0x02, 0xe6, 0x6d, 0x04, 0xd2, 0x5f, 0x00,
+  0x1e, 0x00, 0x20, 0x1b, 0xae, 0x38, 0x04, 0x00, 0x22, 0x78, 0x20, 0x9e, 0xbe, 0x84, 0x19, 0x02, 0x6e, 0x20, 0x0c, 0x02, 0x00, 0x10, 0x9b, 0xdc, 0x18, 0x50, 0x9d, 0xdc, 0x9d, 0xdb, 0x9d, 0xa6,
+  0x00, 0x02, 0x2e, 0x43, 0x04, 0xe8, 0x0d, 0x32, 0x9c, 0xc6, 0x9d, 0x42, 0x0e, 0x16, 0x9d, 0x92, 0x03, 0x0b, 0x3e, 0x00, 0x08, 0x1e, 0x07, 0x01, 0x20, 0x07, 0x00, 0xc4, 0x00, 0x04, 0x20, 0x07,
+  0x00, 0x12, 0x08, 0x05, 0x76, 0x3c, 0x09, 0xfc, 0x00, 0x21, 0xfb, 0xad, 0x16, 0x55, 0x05, 0xb6, 0x58, 0x13, 0xba, 0x40, 0x35, 0x02, 0x22, 0x00, 0x04, 0x98, 0x0f, 0x02, 0xba, 0x04, 0x32, 0x1a,
+  0xb6, 0x1b, 0x8c, 0x80, 0x00, 0x64, 0x07, 0x02, 0xce, 0x58, 0x12, 0xb6, 0x0a, 0x47, 0x11, 0xda, 0xc8, 0x80, 0x04, 0x92, 0x03, 0x28, 0x38, 0x8d, 0x22, 0x07, 0x03, 0x08, 0x00, 0x01, 0x84, 0x15,
+  0x07, 0xb2, 0x0a, 0x12, 0x8d, 0x04, 0x39, 0x0f, 0x90, 0x03, 0x9f, 0x1e, 0xdc, 0x90, 0x03, 0x0b, 0x02, 0x00, 0x0a, 0x3e, 0x00, 0x1a, 0xbb, 0x30, 0x00, 0x0f, 0x3e, 0x00, 0x01, 0x0f, 0x8e, 0x03,
+  0x06, 0x06, 0x02, 0x00, 0x0f, 0xd2, 0x0a, 0x01, 0x13, 0x9b, 0x10, 0x12, 0x04, 0xa6, 0x06, 0x02, 0x3c, 0x07, 0x0f, 0x02, 0x00, 0x0b, 0x0f, 0x22, 0x00, 0x02, 0x15, 0x8d, 0x06, 0x0e, 0x02, 0x52,
+  0x00, 0x14, 0x95, 0x8a, 0x22, 0x0f, 0x9a, 0x1b, 0x0d, 0x06, 0x80, 0x2a, 0x12, 0x9a, 0x4e, 0x06, 0x25, 0x9d, 0xba, 0x78, 0x7f, 0x07, 0x8c, 0x03, 0x21, 0x9d, 0x7a, 0xe2, 0x06, 0x06, 0x64, 0x7f,
+  0x0a, 0xf6, 0x25, 0x04, 0xbc, 0x30, 0x06, 0xa2, 0x29, 0x04, 0x78, 0x69, 0x0b, 0xec, 0x86, 0x05, 0x34, 0x26, 0x10, 0x1b, 0xb2, 0x82, 0x01, 0xd6, 0x5b, 0x02, 0xce, 0x03, 0x04, 0x1c, 0x0b, 0x20,
+  0x1b, 0xb6, 0xd0, 0x09, 0x20, 0xdb, 0xad, 0x9a, 0x15, 0x04, 0x46, 0x7c, 0x00, 0xd2, 0x37, 0x11, 0x7a, 0x86, 0x00, 0x11, 0xba, 0xd4, 0x62, 0x03, 0xd4, 0x49, 0x10, 0x95, 0x58, 0x7f, 0x02, 0xbc,
+  0x15, 0x00, 0x06, 0x07, 0x35, 0x9b, 0x95, 0x9a, 0xc2, 0x0a, 0x02, 0xca, 0x00, 0x02, 0x5e, 0x04, 0x00, 0x08, 0x04, 0x11, 0xfa, 0x58, 0x00, 0x13, 0x5b, 0xe8, 0x54, 0x02, 0x9a, 0x3f, 0x00, 0xb0,
+  0x5f, 0x00, 0x64, 0x15, 0x11, 0x9a, 0xb6, 0x86, 0x02, 0xe0, 0x20, 0x0e, 0x96, 0x03, 0x04, 0xae, 0x0a, 0x02, 0x90, 0x03, 0x03, 0x8e, 0x03, 0x00, 0xc6, 0x12, 0x03, 0x28, 0x0e, 0x02, 0x76, 0x0a,
+  0x24, 0xb9, 0xa5, 0xc2, 0x31, 0x02, 0x92, 0x51, 0x04, 0xc0, 0x3f, 0x00, 0x7a, 0x04, 0x24, 0x99, 0x95, 0x6a, 0x1c, 0x22, 0x9a, 0xa5, 0xa6, 0x51, 0x04, 0x06, 0x13, 0x06, 0x88, 0x0e, 0x04, 0x28,
+  0x40, 0x11, 0x5b, 0x5c, 0x08, 0x01, 0x8e, 0x03, 0x03, 0x22, 0x07, 0x08, 0xaa, 0x23, 0x0f, 0x02, 0x00, 0x05, 0x06, 0xe2, 0x11, 0x13, 0x38, 0xe2, 0x04, 0x0f, 0xd0, 0x11, 0x0d, 0x0e, 0xec, 0x11,
+  0x0f, 0x8e, 0x03, 0x5b, 0x0d, 0x08, 0x12, 0x0b, 0xe4, 0x0a, 0x1e, 0xdc, 0x8a, 0x03, 0x0b, 0x90, 0x03, 0x0e, 0x2c, 0x07, 0x0c, 0x92, 0x03, 0x06, 0x74, 0x03, 0x0c, 0x8a, 0x03, 0x06, 0x92, 0x03,
+  0x13, 0xbb, 0x7c, 0x03, 0x19, 0xbb, 0x90, 0x03, 0x17, 0xbb, 0x90, 0x03, 0x00, 0xb0, 0x03, 0x04, 0xd2, 0x06, 0x0f, 0x02, 0x00, 0x08, 0x0a, 0x1e, 0x00, 0x06, 0x9c, 0x1b, 0x05, 0xf2, 0x06, 0x04,
+  0xe8, 0x10, 0x14, 0x7b, 0x50, 0x1f, 0x0b, 0x10, 0x07, 0x0a, 0x02, 0x00, 0x05, 0xca, 0x03, 0x25, 0x95, 0x9b, 0xc6, 0x74, 0x00, 0x8a, 0x17, 0x1a, 0x7a, 0x50, 0x03, 0x03, 0xee, 0x73, 0x08, 0x4c,
+  0x62, 0x04, 0xbe, 0x30, 0x06, 0xc4, 0x82, 0x05, 0xa8, 0x10, 0x07, 0x20, 0x78, 0x13, 0x9a, 0x38, 0x00, 0x00, 0x9a, 0x0a, 0x02, 0xce, 0x0a, 0x00, 0xd0, 0x0d, 0x02, 0xf4, 0x0a, 0x23, 0xdb, 0xad,
+  0x3a, 0x06, 0x00, 0x3c, 0x00, 0x00, 0xba, 0x62, 0x02, 0x9a, 0x34, 0x01, 0xc4, 0x62, 0x10, 0x9a, 0x8a, 0x03, 0x00, 0x42, 0x07, 0x01, 0x04, 0x00, 0x0a, 0x8e, 0x00, 0x04, 0x96, 0x34, 0x01, 0x20,
+  0x04, 0x01, 0x98, 0x0a, 0x13, 0xbb, 0x80, 0x75, 0x00, 0xf4, 0x1f, 0x15, 0xdb, 0x26, 0x79, 0x02, 0x10, 0x63, 0x10, 0x1b, 0x06, 0x16, 0x03, 0x08, 0x5c, 0x04, 0x88, 0x11, 0x02, 0x90, 0x03, 0x3e,
+  0xda, 0x9d, 0x79, 0x20, 0x07, 0x0b, 0x92, 0x03, 0x02, 0x5c, 0x00, 0x12, 0xba, 0x20, 0x79, 0x01, 0xfc, 0x3f, 0x13, 0x1b, 0x2a, 0x55, 0x00, 0x24, 0x07, 0x08, 0x4e, 0x80, 0x02, 0xc2, 0x75, 0x02,
+  0x64, 0x23, 0x03, 0x68, 0x23, 0x01, 0xd4, 0x0d, 0x15, 0x59, 0x80, 0x4a, 0x16, 0xba, 0xb0, 0x3c, 0x01, 0x7e, 0x0e, 0x13, 0x1b, 0x7e, 0x0f, 0x03, 0x5c, 0x47, 0x12, 0xb6, 0x08, 0x01, 0x06, 0x46,
+  0x00, 0x04, 0x72, 0x03, 0x07, 0x8e, 0x1c, 0x04, 0xe8, 0x11, 0x03, 0x10, 0x00, 0x50, 0xf7, 0x7c, 0xf7, 0x84, 0xf7, 0x90, 0x03, 0x12, 0x8d, 0x90, 0x03, 0x00, 0x20, 0x07, 0x00, 0x2a, 0x13, 0x04,
+  0x78, 0x03, 0x0f, 0x7c, 0x03, 0x23, 0x1f, 0xfc, 0x1e, 0x07, 0x4e, 0x09, 0xc4, 0x1c, 0x0d, 0x70, 0x0e, 0x02, 0xa4, 0x03, 0x0e, 0x3e, 0x00, 0x1b, 0xdb, 0xba, 0x0a, 0x0f, 0xb0, 0x0e, 0x04, 0x0d,
+  0xa6, 0x0a, 0x1f, 0xbb, 0x02, 0x00, 0x10, 0x0a, 0x28, 0x07, 0x0d, 0x02, 0x00, 0x0f, 0x8e, 0x03, 0x09, 0x0c, 0x30, 0x1f, 0x06, 0x88, 0x0a, 0x09, 0x4c, 0x2d, 0x1c, 0x7a, 0xe6, 0x1e, 0x0f, 0xf4,
+  0x1e, 0x06, 0x0a, 0x90, 0x03, 0x27, 0x9a, 0x9d, 0xf4, 0x69, 0x03, 0xee, 0x69, 0x02, 0x38, 0x83, 0x13, 0x79, 0x56, 0x02, 0x02, 0xf2, 0x65, 0x0c, 0x3a, 0x34, 0x07, 0x38, 0x14, 0x2b, 0x9d, 0x99,
+  0x08, 0x8e, 0x02, 0x9e, 0x14, 0x13, 0x3b, 0x06, 0x12, 0x02, 0xba, 0x15, 0x02, 0x02, 0x00, 0x18, 0xba, 0x9a, 0x34, 0x04, 0x14, 0x75, 0x03, 0x9e, 0x7f, 0x04, 0x30, 0x46, 0x08, 0x76, 0x8e, 0x24,
+  0x79, 0x95, 0x18, 0x00, 0x01, 0x1c, 0x87, 0x03, 0x64, 0x0e, 0x13, 0x9b, 0xbc, 0x78, 0x02, 0x1e, 0x0b, 0x18, 0xba, 0x94, 0x07, 0x03, 0x92, 0x06, 0x15, 0x5b, 0x4e, 0x4a, 0x02, 0x74, 0x12, 0x11,
+  0x3b, 0x80, 0x7f, 0x45, 0x9a, 0x95, 0x59, 0x8d, 0x8a, 0x80, 0x03, 0x0a, 0x00, 0x0b, 0xba, 0x0a, 0x03, 0x0e, 0x20, 0x13, 0xba, 0x20, 0x07, 0x04, 0x00, 0x0e, 0x02, 0x2e, 0x55, 0x06, 0x4c, 0x35,
+  0x13, 0xb9, 0x50, 0x79, 0x09, 0x8c, 0x03, 0x17, 0x85, 0xea, 0x0d, 0x01, 0x5c, 0x43, 0x05, 0x88, 0x4a, 0x02, 0x06, 0x32, 0x05, 0x20, 0x39, 0x03, 0x76, 0x35, 0x01, 0x6a, 0x04, 0x04, 0xce, 0x11,
+  0x02, 0x78, 0x03, 0x1d, 0xf7, 0x74, 0x1c, 0x0e, 0x06, 0x19, 0x05, 0x22, 0x07, 0x2f, 0x8d, 0x59, 0x90, 0x03, 0x46, 0x1f, 0xdb, 0x90, 0x03, 0x44, 0x1b, 0xdc, 0x12, 0x16, 0x04, 0x1a, 0x07, 0x1f,
+  0xbc, 0x52, 0x00, 0x14, 0x0e, 0xb0, 0x0a, 0x0e, 0xaa, 0x0a, 0x0f, 0x90, 0x03, 0x3c, 0x0e, 0x1a, 0x00, 0x08, 0xc8, 0x22, 0x0b, 0x6a, 0x15, 0x1e, 0x7a, 0x92, 0x03, 0x08, 0x10, 0x07, 0x2e, 0x85,
+  0x7b, 0x54, 0x00, 0x05, 0x92, 0x03, 0x04, 0x7c, 0x02, 0x02, 0x08, 0x83, 0x11, 0xbb, 0x20, 0x83, 0x09, 0x84, 0x6d, 0x01, 0x1a, 0x2d, 0x03, 0xce, 0x11, 0x23, 0xae, 0x1b, 0xf2, 0x57, 0x22, 0xfb,
+  0xb5, 0x3a, 0x0d, 0x26, 0xda, 0xad, 0x34, 0x2d, 0x0a, 0x94, 0x91, 0x04, 0x2c, 0x18, 0x00, 0x90, 0x03, 0x03, 0x34, 0x00, 0x02, 0x2c, 0x0e, 0x13, 0xad, 0xd0, 0x1c, 0x06, 0x06, 0x18, 0x08, 0xbe,
+  0x91, 0x01, 0x18, 0x04, 0x13, 0x59, 0x98, 0x8a, 0x15, 0x9a, 0x18, 0x00, 0x00, 0x8a, 0x0e, 0x00, 0xea, 0x37, 0x02, 0x0c, 0x07, 0x05, 0x42, 0x7c, 0x03, 0x22, 0x00, 0x02, 0xa6, 0x3f, 0x03, 0xb2,
+  0x06, 0x00, 0x5c, 0x24, 0x03, 0x62, 0x0a, 0x15, 0x5c, 0x88, 0x06, 0x01, 0x08, 0x00, 0x02, 0x94, 0x19, 0x05, 0x92, 0x83, 0x02, 0x8e, 0x1c, 0x02, 0xba, 0x15, 0x17, 0x7a, 0xc2, 0x0a, 0x13, 0x9a,
+  0x2c, 0x27, 0x03, 0xa2, 0x00, 0x01, 0xd2, 0x6d, 0x14, 0x1b, 0x1a, 0x92, 0x10, 0xb6, 0xd8, 0x3f, 0x03, 0x1e, 0x2e, 0x04, 0xde, 0x7c, 0x05, 0xf2, 0x0d, 0x12, 0x38, 0x22, 0x79, 0x15, 0x8d, 0x96,
+  0x11, 0x04, 0xf0, 0x46, 0x24, 0x8d, 0x58, 0x04, 0x7d, 0x08, 0x18, 0x4e, 0x05, 0x38, 0x27, 0x0b, 0x86, 0x1c, 0x22, 0x7c, 0x18, 0xd4, 0x03, 0x06, 0x70, 0x1c, 0x0d, 0xb0, 0x0a, 0x07, 0xf6, 0x18,
+  0x20, 0x8d, 0x59, 0x80, 0x1c, 0x02, 0xb4, 0x0a, 0x22, 0x9d, 0xfc, 0x9c, 0x03, 0x0f, 0x40, 0x0e, 0x8c, 0x0f, 0x90, 0x03, 0x05, 0x1f, 0xdc, 0x90, 0x03, 0x1d, 0x0f, 0xe4, 0x1c, 0x06, 0x0f, 0x7c,
+  0x03, 0x03, 0x0e, 0x8e, 0x03, 0x0f, 0x20, 0x07, 0x1c, 0x07, 0x1c, 0x00, 0x0a, 0x5e, 0x29, 0x0a, 0x62, 0x15, 0x0c, 0xfe, 0x17, 0x04, 0x2c, 0x00, 0x04, 0x90, 0x03, 0x0e, 0xea, 0x03, 0x0c, 0x22,
+  0x07, 0x06, 0x12, 0x27, 0x04, 0x80, 0x6d, 0x06, 0x24, 0x03, 0x26, 0x79, 0x9d, 0x5c, 0x03, 0x19, 0x3b, 0x90, 0x03, 0x07, 0xda, 0x11, 0x04, 0xbc, 0x09, 0x01, 0x02, 0x00, 0x06, 0x94, 0x03, 0x17,
+  0xfa, 0xc2, 0x1c, 0x07, 0x34, 0x03, 0x07, 0x70, 0x8a, 0x15, 0x9a, 0xaa, 0x0e, 0x06, 0xa4, 0x8a, 0x04, 0xe8, 0x7f, 0x11, 0xbb, 0xe8, 0x23, 0x02, 0x2e, 0x7f, 0x00, 0x58, 0x14, 0x02, 0xc8, 0x6d,
+  0x04, 0xa6, 0x3f, 0x00, 0x1a, 0x06, 0x11, 0x9a, 0x42, 0x00, 0x15, 0xda, 0x30, 0x04, 0x06, 0x9e, 0x0e, 0x14, 0x3b, 0x74, 0x24, 0x02, 0x02, 0x00, 0x03, 0x90, 0x19, 0x13, 0xb9, 0x60, 0x0a, 0x00,
+  0xd8, 0x03, 0x01, 0x22, 0x36, 0x02, 0x9a, 0x7c, 0x0c, 0x02, 0x00, 0x01, 0x96, 0x0d, 0x04, 0xba, 0x38, 0x40, 0x1a, 0xb6, 0x5c, 0xc6, 0xf4, 0x0a, 0x13, 0x1b, 0x90, 0x03, 0x01, 0xc6, 0x38, 0x02,
+  0x58, 0x03, 0x23, 0x95, 0x99, 0x90, 0x03, 0x04, 0x5a, 0x80, 0x01, 0x16, 0x72, 0x05, 0x04, 0x00, 0x01, 0xd4, 0x83, 0x03, 0x20, 0x15, 0x11, 0x59, 0x96, 0x03, 0x13, 0x58, 0x96, 0x03, 0x0a, 0xb0,
+  0x4a, 0x06, 0xd4, 0x18, 0x24, 0x38, 0x85, 0x64, 0x3c, 0x02, 0x9e, 0x79, 0x02, 0x74, 0x03, 0x08, 0x12, 0x7d, 0x03, 0xa4, 0x03, 0x16, 0x84, 0x96, 0x03, 0x15, 0x38, 0x10, 0x20, 0x06, 0x90, 0x03,
+  0x0e, 0x32, 0x0e, 0x0f, 0x90, 0x03, 0x7a, 0x0f, 0x04, 0x07, 0x1a, 0x0f, 0x24, 0x00, 0x08, 0x0f, 0x62, 0x15, 0x05, 0x0e, 0x32, 0x07, 0x09, 0x82, 0x03, 0x0c, 0x6c, 0x0e, 0x0f, 0xa6, 0x0a, 0x12,
+  0x06, 0x3c, 0x03, 0x14, 0x85, 0x80, 0x03, 0x0e, 0x8c, 0x03, 0x05, 0x46, 0x0e, 0x1b, 0x85, 0xb6, 0x30, 0x09, 0x36, 0x2d, 0x0e, 0xe6, 0x03, 0x0a, 0x22, 0x07, 0x06, 0x26, 0x07, 0x08, 0x8c, 0x03,
+  0x15, 0xdb, 0x2a, 0x07, 0x11, 0xda, 0x80, 0x1c, 0x08, 0x8e, 0x03, 0x02, 0x40, 0x20, 0x03, 0x92, 0x03, 0x07, 0x20, 0x07, 0x04, 0x9c, 0x29, 0x04, 0xfc, 0x0a, 0x06, 0x06, 0x07, 0x04, 0x4c, 0x00,
+  0x02, 0x54, 0x06, 0x07, 0xa2, 0x06, 0x07, 0x8e, 0x83, 0x04, 0xb0, 0x23, 0x01, 0xb6, 0x1f, 0x04, 0xce, 0x86, 0x07, 0xb0, 0x86, 0x02, 0x3e, 0x8a, 0x05, 0x46, 0x83, 0x04, 0x20, 0x07, 0x02, 0x1e,
+  0x16, 0x01, 0xac, 0x20, 0x02, 0x86, 0x07, 0x02, 0xb6, 0x3f, 0x06, 0xce, 0x07, 0x00, 0x16, 0x00, 0x01, 0xac, 0x6d, 0x03, 0xa0, 0x00, 0x02, 0x56, 0x00, 0x00, 0xf4, 0x2e, 0x00, 0x94, 0x98, 0x06,
+  0x92, 0x03, 0x06, 0xc2, 0x0a, 0x14, 0x79, 0xd0, 0x11, 0x01, 0xb4, 0x18, 0x04, 0x44, 0x55, 0x00, 0xf0, 0x38, 0x02, 0xa2, 0x18, 0x02, 0x0e, 0x15, 0x03, 0x02, 0x00, 0x03, 0xc8, 0x83, 0x02, 0x92,
+  0x03, 0x09, 0x4c, 0x80, 0x12, 0x85, 0x26, 0x07, 0x07, 0xb2, 0x03, 0x13, 0x95, 0x30, 0x84, 0x04, 0xe0, 0x18, 0x14, 0x95, 0x4a, 0x07, 0x0b, 0x28, 0x00, 0x01, 0x16, 0x00, 0x03, 0x8c, 0x03, 0x07,
+  0x22, 0x00, 0x02, 0x38, 0x07, 0x02, 0x9a, 0x04, 0x06, 0x84, 0x15, 0x05, 0x1e, 0x07, 0x09, 0x90, 0x03, 0x1f, 0xfc, 0x20, 0x07, 0x92, 0x0a, 0x4a, 0x2b, 0x02, 0x0c, 0x00, 0x0c, 0x60, 0x0e, 0x0b,
+  0x54, 0x2b, 0x08, 0xda, 0x11, 0x0f, 0x02, 0x00, 0x14, 0x0e, 0x14, 0x07, 0x0a, 0x8c, 0x03, 0x0f, 0xc6, 0x11, 0x12, 0x08, 0x40, 0x03, 0x0d, 0xda, 0x11, 0x0e, 0x26, 0x3f, 0x09, 0xc6, 0x0a, 0x0e,
+  0x18, 0x07, 0x0f, 0x92, 0x03, 0x06, 0x08, 0x90, 0x03, 0x04, 0x1e, 0x0a, 0x01, 0x94, 0x0d, 0x00, 0x08, 0x0a, 0x01, 0x7e, 0x1c, 0x03, 0x7e, 0x0a, 0x07, 0xde, 0x02, 0x03, 0x1c, 0x15, 0x02, 0x90,
+  0x06, 0x07, 0x7a, 0x8d, 0x04, 0x68, 0x02, 0x13, 0x7a, 0x24, 0x54, 0x04, 0x62, 0x07, 0x28, 0x9a, 0x9d, 0x62, 0x1c, 0x06, 0xa6, 0x02, 0x1b, 0x7a, 0x90, 0x03, 0x06, 0xc2, 0x91, 0x02, 0xa8, 0x06,
+  0x04, 0x4a, 0x0e, 0x02, 0x2e, 0x06, 0x02, 0x3e, 0x8a, 0x22, 0x19, 0x85, 0x4a, 0x2d, 0x00, 0x94, 0x03, 0x02, 0x38, 0x03, 0x02, 0xae, 0x19, 0x01, 0x90, 0x03, 0x16, 0xae, 0x3e, 0x43, 0x15, 0xda,
+  0xc0, 0x46, 0x06, 0x02, 0x16, 0x05, 0xe8, 0x1b, 0x03, 0x8c, 0x75, 0x02, 0x76, 0x00, 0x02, 0x98, 0x98, 0x17, 0x7a, 0x4e, 0x0e, 0x04, 0x96, 0x12, 0x13, 0xda, 0xac, 0x15, 0x04, 0x8e, 0x03, 0x00,
+  0x90, 0x03, 0x02, 0x14, 0x92, 0x14, 0x99, 0x50, 0x03, 0x05, 0x22, 0x07, 0x1e, 0x39, 0xdc, 0x83, 0x03, 0x38, 0x03, 0x01, 0x2a, 0x07, 0x07, 0x94, 0x03, 0x09, 0x02, 0x00, 0x07, 0x0e, 0x01, 0x01,
+  0xa2, 0x87, 0x03, 0x58, 0x00, 0x1b, 0x39, 0xa6, 0x03, 0x02, 0xfc, 0x0a, 0x03, 0x36, 0x01, 0x07, 0x3c, 0x07, 0x03, 0x90, 0x03, 0x05, 0x92, 0x03, 0x0f, 0x90, 0x03, 0x01, 0x0f, 0xa0, 0x03, 0x6e,
+  0x0f, 0x62, 0x27, 0x04, 0x08, 0x56, 0x03, 0x0f, 0x7a, 0x27, 0x07, 0x0f, 0xd4, 0x23, 0x31, 0x0a, 0xb4, 0x0a, 0x06, 0x14, 0x00, 0x0f, 0x86, 0x03, 0x17, 0x15, 0x9c, 0x38, 0x0e, 0x05, 0x0a, 0x00,
+  0x0e, 0x9c, 0x03, 0x05, 0xfc, 0x37, 0x0f, 0x70, 0x03, 0x04, 0x0f, 0x90, 0x03, 0x13, 0x04, 0xce, 0x30, 0x01, 0x02, 0x00, 0x07, 0xac, 0x06, 0x05, 0xf0, 0x94, 0x13, 0x9a, 0x10, 0x0e, 0x02, 0x58,
+  0x27, 0x01, 0x78, 0x06, 0x12, 0xae, 0x06, 0x00, 0x04, 0x26, 0x27, 0x07, 0x0a, 0x91, 0x05, 0xa8, 0x02, 0x06, 0x0e, 0x06, 0x00, 0x02, 0x00, 0x00, 0x3e, 0x91, 0x08, 0xfc, 0x05, 0x02, 0x50, 0x03,
+  0x02, 0x9a, 0x06, 0x00, 0x86, 0x02, 0x1a, 0x7a, 0x02, 0x00, 0x01, 0x16, 0x00, 0x04, 0xda, 0x11, 0x03, 0xb6, 0x02, 0x04, 0x90, 0x03, 0x00, 0xbc, 0x7f, 0x01, 0x28, 0x07, 0x13, 0x79, 0x5a, 0x0a,
+  0x20, 0xba, 0x9d, 0x90, 0x32, 0x08, 0x12, 0x0b, 0x05, 0x5a, 0x04, 0x07, 0xda, 0x0e, 0x03, 0x72, 0x12, 0x03, 0xe4, 0x95, 0x01, 0x42, 0x24, 0x21, 0x9d, 0xdb, 0x1a, 0x79, 0x32, 0xfb, 0x9d, 0xba,
+  0x74, 0x00, 0x1a, 0x95, 0x90, 0x03, 0x15, 0x99, 0xd2, 0x11, 0x03, 0x06, 0x21, 0x02, 0xca, 0x12, 0x27, 0xa5, 0x99, 0x90, 0x03, 0x00, 0x14, 0x04, 0x08, 0x8e, 0x03, 0x02, 0x46, 0x0e, 0x06, 0x02,
+  0x00, 0x04, 0xd8, 0x1f, 0x08, 0xe4, 0x11, 0x04, 0x3a, 0x1c, 0x07, 0x00, 0x20, 0x07, 0x40, 0x07, 0x06, 0xac, 0x03, 0x08, 0x44, 0x07, 0x02, 0xa6, 0x0e, 0x05, 0x54, 0x01, 0x04, 0x18, 0x20, 0x01,
+  0x44, 0x07, 0x04, 0x1c, 0x07, 0x05, 0x98, 0x03, 0x0f, 0x02, 0x00, 0x08, 0x0f, 0xcc, 0x11, 0x09, 0x1f, 0xfc, 0x90, 0x03, 0x5c, 0x08, 0x3e, 0x0a, 0x0f, 0x4c, 0x27, 0x4d, 0x0e, 0xd0, 0x11, 0x0e,
+  0x8e, 0x03, 0x0e, 0xa6, 0x23, 0x0b, 0x18, 0x20, 0x0f, 0xea, 0x11, 0x0f, 0x0e, 0xfc, 0x0a, 0x0f, 0x90, 0x03, 0x1e, 0x00, 0x1a, 0x20, 0x13, 0x9a, 0xda, 0x22, 0x08, 0x92, 0x03, 0x04, 0xb8, 0x06,
+  0x27, 0x79, 0x95, 0xa2, 0x1c, 0x0a, 0x4a, 0x4d, 0x0d, 0x60, 0xa3, 0x15, 0x7a, 0x10, 0x0a, 0x00, 0xec, 0x05, 0x04, 0x64, 0x02, 0x02, 0xcc, 0x94, 0x02, 0x96, 0x8a, 0x33, 0x79, 0x85, 0x59, 0xa0,
+  0x8a, 0x04, 0x66, 0x02, 0x03, 0x9e, 0x06, 0x07, 0x8e, 0x03, 0x02, 0xea, 0x91, 0x06, 0xd8, 0x0a, 0x02, 0xb8, 0x03, 0x03, 0x24, 0x07, 0x03, 0x90, 0x03, 0x04, 0xfa, 0x8d, 0x02, 0x5a, 0x03, 0x15,
+  0x99, 0xaa, 0xa3, 0x02, 0xda, 0x34, 0x06, 0xe6, 0x34, 0x08, 0x46, 0x0b, 0x0e, 0x02, 0x00, 0x22, 0x7a, 0x95, 0x7c, 0x44, 0x01, 0x24, 0x12, 0x03, 0x94, 0x07, 0x07, 0x52, 0x2e, 0x01, 0x90, 0x03,
+  0x05, 0x66, 0x15, 0x05, 0x12, 0x15, 0x15, 0x99, 0x16, 0x28, 0x08, 0xe0, 0x06, 0x02, 0x52, 0x0b, 0x04, 0xc6, 0x1f, 0x04, 0x8e, 0x03, 0x04, 0x78, 0x04, 0x16, 0x39, 0x1c, 0x07, 0x06, 0x16, 0x19,
+  0x1d, 0x8d, 0x02, 0x00, 0x07, 0x60, 0x0e, 0x02, 0xb0, 0x16, 0x06, 0x18, 0x0b, 0x07, 0x9e, 0x0f, 0x03, 0xe8, 0x80, 0x04, 0x38, 0x07, 0x09, 0x90, 0x03, 0x0f, 0x92, 0x03, 0x0e, 0x0e, 0x98, 0x03,
+  0x19, 0xfc, 0xa6, 0x1c, 0x0f, 0xa4, 0x15, 0x1b, 0x0f, 0x84, 0x15, 0x0f, 0x1e, 0xbb, 0x8c, 0x1c, 0x07, 0xa6, 0x0a, 0x02, 0x2a, 0x03, 0x0e, 0x9a, 0x2e, 0x0f, 0x70, 0x39, 0x19, 0x0e, 0x88, 0x23,
+  0x0f, 0x90, 0x03, 0x0b, 0x0a, 0x34, 0x03, 0x1f, 0xbb, 0x38, 0x27, 0x08, 0x0e, 0x3a, 0x03, 0x0c, 0xfc, 0x1f, 0x05, 0xbc, 0x3e, 0x05, 0x3e, 0x38, 0x1f, 0x9b, 0x40, 0x19, 0x1d, 0x0d, 0x42, 0x19,
+  0x02, 0xee, 0x31, 0x09, 0x1c, 0x07, 0x09, 0xe0, 0x0d, 0x02, 0x26, 0x02, 0x04, 0x96, 0x03, 0x04, 0x6a, 0x06, 0x15, 0xba, 0x74, 0x06, 0x04, 0x34, 0x02, 0x02, 0x2c, 0x00, 0x04, 0x3c, 0x03, 0x04,
+  0x02, 0x00, 0x07, 0xbc, 0x91, 0x05, 0x02, 0x39, 0x08, 0x02, 0x00, 0x08, 0xbe, 0x0d, 0x06, 0x68, 0x9c, 0x0a, 0x30, 0x07, 0x03, 0xe0, 0x10, 0x21, 0x8d, 0x39, 0xac, 0x0a, 0x02, 0xb6, 0x0a, 0x01,
+  0xf2, 0x02, 0x02, 0xd2, 0x03, 0x07, 0xc2, 0x91, 0x04, 0x62, 0x06, 0x06, 0x0e, 0x00, 0x04, 0x02, 0x00, 0x0b, 0x26, 0x0a, 0x05, 0xfe, 0x0d, 0x37, 0x59, 0x8d, 0xba, 0x78, 0x95, 0x15, 0x7a, 0x98,
+  0x03, 0x02, 0xc0, 0x0b, 0x04, 0xc0, 0x66, 0x17, 0xba, 0x42, 0x5c, 0x04, 0x50, 0x00, 0x02, 0x14, 0x99, 0x02, 0x5c, 0x15, 0x1b, 0x39, 0xec, 0x2d, 0x04, 0x1a, 0x07, 0x00, 0xa2, 0x00, 0x03, 0xb8,
+  0x03, 0x0a, 0x8c, 0x00, 0x06, 0x90, 0x04, 0x06, 0x0c, 0x00, 0x03, 0xb0, 0x00, 0x08, 0x68, 0x21, 0x06, 0x00, 0x1e, 0x02, 0x70, 0x01, 0x04, 0x40, 0x39, 0x06, 0xc0, 0x03, 0x14, 0x9a, 0x88, 0x03,
+  0x0a, 0x02, 0x00, 0x07, 0x7c, 0x03, 0x3d, 0xfb, 0x95, 0xfb, 0x24, 0x00, 0x1b, 0xdc, 0x9e, 0x03, 0x1f, 0xfc, 0xf2, 0x18, 0x04, 0x02, 0x02, 0x00, 0x0e, 0x8e, 0x03, 0x09, 0x20, 0x00, 0x38, 0x8d,
+  0xdb, 0x8d, 0x1e, 0x0b, 0x00, 0x30, 0x00, 0x01, 0x14, 0x1e, 0x01, 0x94, 0x29, 0x01, 0x06, 0x00, 0x21, 0x95, 0xdb, 0x06, 0x00, 0x0a, 0xfc, 0x0d, 0x04, 0xa4, 0x03, 0x00, 0x40, 0x00, 0x00, 0x06,
+  0x00, 0x0e, 0x40, 0x07, 0x01, 0x0e, 0x00, 0x00, 0x44, 0x03, 0x21, 0x85, 0xdb, 0x26, 0x00, 0x0f, 0x68, 0x03, 0x01, 0x0f, 0x96, 0x35, 0x11, 0x00, 0x42, 0x00, 0x02, 0x22, 0x27, 0x03, 0x28, 0x27,
+  0x02, 0x98, 0x03, 0x12, 0x85, 0xdc, 0x3c, 0x00, 0x94, 0x03, 0x13, 0xbb, 0x96, 0x0a, 0x0e, 0x80, 0x23, 0x16, 0x9c, 0x20, 0x00, 0x06, 0x20, 0x3b, 0x01, 0x8c, 0x17, 0x02, 0x76, 0x1b, 0x13, 0xbb,
+  0x66, 0x09, 0x22, 0xba, 0x9d, 0x08, 0x1f, 0x11, 0xdc, 0xf2, 0x00, 0x03, 0x02, 0x00, 0x09, 0x70, 0x20, 0x0f, 0xa8, 0x03, 0x09, 0x26, 0xbb, 0x85, 0xd2, 0x11, 0x13, 0x7a, 0x02, 0x1f, 0x11, 0xdb,
+  0x1c, 0x2a, 0x0b, 0xbe, 0x22, 0x15, 0x95, 0xe8, 0x10, 0x05, 0xac, 0x03, 0x06, 0x90, 0x11, 0x04, 0x3e, 0x91, 0x06, 0x46, 0x91, 0x11, 0x5a, 0xfc, 0x89, 0x08, 0x8a, 0x03, 0x12, 0x7a, 0xd4, 0x94,
+  0x0f, 0x82, 0x1f, 0x06, 0x14, 0x5a, 0x36, 0x00, 0x06, 0x08, 0x00, 0x24, 0x85, 0x59, 0xbe, 0x03, 0x04, 0x20, 0x07, 0x05, 0xe2, 0x18, 0x00, 0xf8, 0x0d, 0x13, 0x5a, 0x98, 0x00, 0x0e, 0x5a, 0x18,
+  0x0c, 0x02, 0x00, 0x02, 0x18, 0x6a, 0x02, 0xe8, 0x02, 0x06, 0xc2, 0x0e, 0x0a, 0x08, 0x0a, 0x00, 0x9e, 0x07, 0x05, 0xcc, 0x07, 0x07, 0x68, 0x95, 0x00, 0xf2, 0xa6, 0x04, 0x4c, 0x0f, 0x06, 0x6c,
+  0xab, 0x02, 0x80, 0x04, 0x30, 0xda, 0x9d, 0xda, 0x84, 0x43, 0x02, 0x56, 0x3c, 0x02, 0xee, 0x06, 0x05, 0xde, 0x0d, 0x22, 0x18, 0x85, 0x0a, 0x00, 0x03, 0x80, 0x1c, 0x03, 0x74, 0x03, 0x02, 0x4e,
+  0x00, 0x02, 0x02, 0x00, 0x0b, 0x42, 0x0e, 0x05, 0x44, 0x04, 0x02, 0x02, 0x60, 0x03, 0xc4, 0x6a, 0x07, 0x52, 0x9d, 0x02, 0xc2, 0x1c, 0x05, 0xb6, 0x63, 0x03, 0x64, 0x07, 0x06, 0xd4, 0x00, 0x0d,
+  0x86, 0x03, 0x0b, 0x92, 0x03, 0x06, 0x90, 0x03, 0x00, 0xa0, 0x45, 0x00, 0x8c, 0x03, 0x1f, 0xdc, 0x40, 0x07, 0x12, 0x04, 0x8e, 0x03, 0x0f, 0x92, 0x03, 0x10, 0x0a, 0x22, 0x00, 0x01, 0x9a, 0x02,
+  0x01, 0x5e, 0x3b, 0x51, 0xa6, 0x3d, 0xae, 0x1c, 0xa6, 0x38, 0x25, 0x07, 0x98, 0x03, 0x0e, 0xae, 0x11, 0x1f, 0xdb, 0xca, 0x35, 0x08, 0x02, 0x20, 0x00, 0x02, 0x02, 0x00, 0x0e, 0x7e, 0x03, 0x0e,
+  0xc0, 0x18, 0x0c, 0xae, 0x03, 0x02, 0x04, 0x00, 0x26, 0x9b, 0x85, 0x14, 0x00, 0x03, 0x8e, 0x03, 0x05, 0x7a, 0x03, 0x15, 0xbb, 0x70, 0x03, 0x1e, 0x9c, 0xc8, 0x06, 0x04, 0x22, 0x00, 0x08, 0xc4,
+  0x06, 0x01, 0x6c, 0x03, 0x02, 0x7e, 0x03, 0x00, 0xb4, 0x38, 0x02, 0x02, 0x00, 0x11, 0x1c, 0x36, 0x89, 0x13, 0xdb, 0xfc, 0x00, 0x04, 0x92, 0x03, 0x0e, 0x8c, 0x03, 0x0e, 0x4e, 0x2e, 0x04, 0xa2,
+  0x07, 0x06, 0x60, 0x15, 0x13, 0x7a, 0x92, 0x10, 0x01, 0x1a, 0x3f, 0x23, 0x8d, 0x9a, 0x8e, 0x03, 0x02, 0x10, 0x19, 0x0e, 0xa8, 0x3b, 0x05, 0xe4, 0x0d, 0x02, 0x5e, 0x14, 0x06, 0xfe, 0x09, 0x0e,
+  0x66, 0x03, 0x03, 0x80, 0x3c, 0x1f, 0x7a, 0x02, 0x00, 0x10, 0x05, 0x64, 0x95, 0x07, 0x42, 0x00, 0x04, 0xe2, 0x10, 0x04, 0x6e, 0x1c, 0x04, 0x12, 0x27, 0x01, 0x90, 0x23, 0x09, 0x04, 0x12, 0x05,
+  0xc2, 0x07, 0x02, 0xac, 0x46, 0x03, 0x90, 0x3f, 0x13, 0x79, 0x80, 0x66, 0x04, 0xbc, 0x02, 0x08, 0xa6, 0xae, 0x03, 0xbe, 0x00, 0x0b, 0x8c, 0x03, 0x05, 0x90, 0x03, 0x07, 0x42, 0x03, 0x14, 0x99,
+  0x7c, 0x0e, 0x05, 0xc4, 0x66, 0x04, 0xaa, 0xa7, 0x11, 0x9a, 0x1a, 0x05, 0x02, 0x98, 0x03, 0x02, 0xfe, 0x18, 0x04, 0x50, 0x00, 0x04, 0xc2, 0x06, 0x04, 0x1c, 0x01, 0x06, 0xde, 0xa7, 0x1f, 0x99,
+  0xb2, 0x07, 0x03, 0x04, 0x90, 0x03, 0x05, 0x02, 0x8b, 0x07, 0x52, 0x9d, 0x29, 0x95, 0x79, 0xf6, 0x07, 0x02, 0xe6, 0x03, 0x06, 0xf2, 0x00, 0x0e, 0x90, 0x03, 0x0a, 0x02, 0x00, 0x01, 0x90, 0x03,
+  0x13, 0x95, 0x90, 0x03, 0x0b, 0xe4, 0x11, 0x08, 0x20, 0x07, 0x0f, 0x90, 0x03, 0x02, 0x1f, 0x9d, 0x4c, 0x20, 0x11, 0x08, 0x90, 0x03, 0x00, 0x58, 0x37, 0x42, 0x1c, 0xa6, 0xfb, 0x9d, 0xe4, 0x8b,
+  0x51, 0x7d, 0xb6, 0x5d, 0xb6, 0xfc, 0xa2, 0x02, 0x22, 0xdc, 0x9d, 0x26, 0x00, 0x1e, 0xbb, 0x7a, 0x1c, 0x0f, 0x4e, 0x39, 0x0c, 0x0f, 0x1c, 0x00, 0x07, 0x13, 0xbb, 0xa6, 0x03, 0x0e, 0x18, 0x0e,
+  0x07, 0xa4, 0x06, 0x12, 0x95, 0x14, 0x00, 0x06, 0xaa, 0x0a, 0x0a, 0xc4, 0x03, 0x24, 0x9b, 0x8d, 0x1e, 0x07, 0x09, 0x6c, 0x15, 0x07, 0x4e, 0x0a, 0x0c, 0xe4, 0x0a, 0x00, 0x8c, 0x03, 0x00, 0x8c,
+  0x57, 0x20, 0x3c, 0xae, 0x8a, 0x02, 0x11, 0xfc, 0xb4, 0x38, 0x10, 0x3c, 0x90, 0x38, 0x51, 0xae, 0x1c, 0xa6, 0xdb, 0xa5, 0x32, 0x1c, 0x12, 0x95, 0x92, 0xa6, 0x02, 0x90, 0x03, 0x0e, 0x26, 0x0b,
+  0x0f, 0x60, 0x20, 0x03, 0x04, 0xc4, 0xa6, 0x00, 0x4c, 0x55, 0x00, 0x14, 0x8d, 0x02, 0xf2, 0x34, 0x06, 0x90, 0x03, 0x06, 0x90, 0x1b, 0x0b, 0x0e, 0x00, 0x01, 0x8e, 0x03, 0x1c, 0x79, 0x90, 0x03,
+  0x09, 0xa6, 0x14, 0x05, 0x2a, 0x00, 0x1f, 0x8d, 0x02, 0x00, 0x19, 0x0e, 0xba, 0x03, 0x04, 0x36, 0x0b, 0x01, 0x08, 0x0b, 0x03, 0x7a, 0x03, 0x02, 0xdc, 0x9f, 0x06, 0x9a, 0x15, 0x04, 0xfa, 0x18,
+  0x00, 0xa4, 0x04, 0x00, 0x66, 0x15, 0x11, 0xfa, 0x60, 0x06, 0x04, 0x50, 0xaa, 0x07, 0xf4, 0x1c, 0x05, 0xe8, 0x11, 0x1b, 0x99, 0x46, 0x0e, 0x1c, 0x79, 0x22, 0x07, 0x1a, 0x95, 0x90, 0x03, 0x00,
+  0x3c, 0x00, 0x06, 0xfe, 0x46, 0x07, 0x42, 0x28, 0x00, 0x3c, 0x03, 0x01, 0x2c, 0x07, 0x03, 0x6e, 0x03, 0x01, 0x34, 0x00, 0x0f, 0xac, 0x0e, 0x03, 0x06, 0xea, 0x0a, 0x0e, 0xb4, 0x0a, 0x0a, 0xb0,
+  0x0a, 0x05, 0x02, 0x2b, 0x0a, 0x22, 0x13, 0x03, 0x86, 0x07, 0x02, 0x7e, 0x0e, 0x06, 0xe8, 0x03, 0x1e, 0x9a, 0xae, 0x0a, 0x0f, 0xbc, 0x0a, 0x05, 0x07, 0x5c, 0x03, 0x0e, 0x4c, 0x0e, 0x0e, 0x8a,
+  0x15, 0x0f, 0x90, 0x03, 0x15, 0x08, 0x1a, 0x07, 0x11, 0xdc, 0x08, 0x8c, 0x60, 0x5d, 0xae, 0x3c, 0xae, 0x1c, 0xae, 0x54, 0x02, 0x00, 0x78, 0x50, 0x20, 0x1c, 0xa6, 0x8e, 0x03, 0x01, 0x96, 0x03,
+  0x0f, 0x72, 0x0e, 0x07, 0x07, 0xbc, 0x35, 0x04, 0x48, 0x03, 0x05, 0xde, 0x2a, 0x0f, 0xa6, 0x11, 0x17, 0x04, 0x3c, 0x00, 0x00, 0x66, 0x00, 0x10, 0x9d, 0x10, 0x03, 0x07, 0x3e, 0x0a, 0x05, 0x4e,
+  0x03, 0x04, 0xa2, 0x03, 0x04, 0x6a, 0x03, 0x07, 0x3e, 0x00, 0x05, 0xe4, 0x2a, 0x0c, 0x10, 0x35, 0x04, 0x16, 0x35, 0x04, 0x3a, 0x3c, 0x21, 0xfc, 0xa5, 0x7e, 0x03, 0x05, 0x20, 0x07, 0x11, 0x1b,
+  0xdc, 0x46, 0x02, 0x46, 0x31, 0x01, 0x38, 0x07, 0x09, 0xb4, 0x0a, 0x0f, 0x02, 0x00, 0x12, 0x01, 0xc6, 0xb4, 0x20, 0xdb, 0xa5, 0x2c, 0x86, 0xa2, 0x1f, 0xcf, 0x1f, 0xcf, 0xde, 0xc6, 0xbe, 0xbe,
+  0x1c, 0xae, 0xae, 0x38, 0x09, 0xb4, 0x06, 0x03, 0x0e, 0x1c, 0x14, 0x79, 0xc8, 0x09, 0x03, 0x0e, 0x00, 0x02, 0x70, 0x03, 0x05, 0xb8, 0x02, 0x04, 0x14, 0x00, 0x09, 0x72, 0x31, 0x0b, 0x5e, 0x07,
+  0x0f, 0x24, 0x07, 0x16, 0x0a, 0x90, 0x07, 0x04, 0xce, 0x06, 0x06, 0x50, 0x0e, 0x06, 0x54, 0x19, 0x06, 0x5e, 0xa3, 0x00, 0x82, 0x03, 0x02, 0x90, 0x03, 0x00, 0x1a, 0x40, 0x04, 0x02, 0x19, 0x00,
+  0x18, 0x2b, 0x19, 0xdb, 0x04, 0x16, 0x19, 0x99, 0x8e, 0x03, 0x16, 0x7a, 0xc2, 0x2b, 0x05, 0xa8, 0x0a, 0x16, 0x79, 0xae, 0x19, 0x07, 0xac, 0x51, 0x04, 0xa4, 0x78, 0x08, 0x4a, 0x0e, 0x02, 0x8c,
+  0x1c, 0x04, 0x90, 0xa7, 0x03, 0x4a, 0x07, 0x0e, 0x3c, 0x12, 0x09, 0x0e, 0x07, 0x08, 0x42, 0x20, 0x06, 0xd2, 0x18, 0x16, 0x39, 0x68, 0x15, 0x04, 0x92, 0x03, 0x09, 0xb6, 0x03, 0x06, 0x02, 0x0b,
+  0x04, 0x8e, 0x03, 0x15, 0x7a, 0xa8, 0x00, 0x0f, 0x90, 0x03, 0x16, 0x07, 0x6e, 0x03, 0x0f, 0x02, 0x19, 0x11, 0x03, 0x88, 0x0a, 0x1a, 0x9d, 0x70, 0x03, 0x03, 0x02, 0x00, 0x0d, 0x88, 0x03, 0x50,
+  0xdc, 0x9d, 0xbc, 0x9d, 0xbc, 0x60, 0x33, 0x00, 0x90, 0x03, 0x10, 0xb6, 0x12, 0x54, 0x11, 0x3c, 0xa4, 0x21, 0x02, 0xb8, 0x02, 0x11, 0xdb, 0x90, 0x03, 0x02, 0x50, 0x0e, 0x1b, 0xdb, 0x02, 0x00,
+  0x0a, 0x08, 0x20, 0x17, 0xbb, 0x92, 0x03, 0x0a, 0x1e, 0x00, 0x08, 0x20, 0x27, 0x0f, 0x88, 0x03, 0x03, 0x13, 0xdb, 0x8a, 0x00, 0x02, 0x32, 0x03, 0x20, 0xdb, 0x9d, 0xc6, 0x54, 0x31, 0x3c, 0xa6,
+  0xdb, 0x9a, 0x07, 0x02, 0x86, 0x30, 0x13, 0xbb, 0x22, 0x00, 0x01, 0x10, 0x00, 0x07, 0x40, 0x00, 0x04, 0x74, 0x28, 0x06, 0xac, 0x03, 0x08, 0xd8, 0x06, 0x06, 0x74, 0x07, 0x13, 0x9b, 0x32, 0x0e,
+  0x00, 0x1c, 0x4a, 0x02, 0xde, 0x30, 0x15, 0xdb, 0x96, 0x38, 0x04, 0x08, 0xa6, 0x00, 0x0e, 0x03, 0x02, 0x6a, 0x23, 0x01, 0xb8, 0x31, 0x0f, 0x8a, 0x03, 0x10, 0x01, 0x02, 0x00, 0x00, 0xca, 0x04,
+  0x92, 0xad, 0x3c, 0xb6, 0x7d, 0xbe, 0x9d, 0xbe, 0x9d, 0xbe, 0xfe, 0x3f, 0x00, 0xd8, 0x90, 0x07, 0x90, 0x03, 0x05, 0x90, 0x1f, 0x0a, 0xf0, 0x14, 0x08, 0x9c, 0x06, 0x00, 0x0e, 0x04, 0x02, 0x22,
+  0x04, 0x12, 0xbb, 0xb6, 0x06, 0x0a, 0x78, 0x03, 0x0f, 0x90, 0x03, 0x06, 0x0d, 0x84, 0x07, 0x07, 0x20, 0x07, 0x1b, 0x9a, 0x20, 0x07, 0x1b, 0x59, 0xde, 0x11, 0x09, 0x86, 0x00, 0x07, 0xca, 0xaa,
+  0x08, 0x06, 0x20, 0x15, 0xfb, 0xb0, 0x20, 0x17, 0xba, 0xb8, 0x40, 0x0e, 0x6c, 0x15, 0x0a, 0x8a, 0x03, 0x13, 0x7a, 0x58, 0x16, 0x11, 0x99, 0xca, 0x6d, 0x04, 0xb6, 0x2b, 0x06, 0x82, 0x03, 0x04,
+  0xf8, 0x9f, 0x15, 0xda, 0x22, 0x60, 0x06, 0x9c, 0x5c, 0x06, 0x24, 0x0b, 0x04, 0x78, 0x20, 0x08, 0xec, 0x12, 0x07, 0x92, 0x03, 0x05, 0x4c, 0x1c, 0x05, 0x84, 0x15, 0x02, 0x0a, 0x00, 0x03, 0xc4,
+  0x18, 0x08, 0xe6, 0x0a, 0x0a, 0xb8, 0x03, 0x06, 0x84, 0x1c, 0x06, 0x70, 0x0e, 0x00, 0x02, 0x00, 0x0f, 0x90, 0x03, 0x1d, 0x0e, 0x1a, 0x07, 0x04, 0x4c, 0x0a, 0x0e, 0x3c, 0x15, 0x0b, 0x86, 0x03,
+  0x0a, 0x02, 0x00, 0x05, 0x3c, 0x00, 0x04, 0x12, 0x00, 0x11, 0xbc, 0x9a, 0x0a, 0x00, 0xaa, 0x0a, 0x02, 0x02, 0x00, 0x08, 0x90, 0x03, 0x05, 0x02, 0x00, 0x1c, 0x95, 0x92, 0x03, 0x0c, 0xee, 0x03,
+  0x0a, 0x82, 0x0d, 0x07, 0x28, 0x07, 0x07, 0xf4, 0x31, 0x0e, 0x12, 0x07, 0x00, 0x56, 0x00, 0x00, 0x2a, 0x0b, 0x00, 0x78, 0x25, 0x01, 0x06, 0xb7, 0x10, 0xa6, 0xc4, 0x06, 0x40, 0x9e, 0xb6, 0x7d,
+  0xb6, 0x3e, 0x0b, 0x06, 0x50, 0x00, 0x13, 0xdb, 0x16, 0x01, 0x08, 0x62, 0x00, 0x00, 0xa6, 0x03, 0x01, 0x14, 0x00, 0x02, 0xb4, 0x03, 0x0b, 0x8e, 0x03, 0x0a, 0x90, 0x03, 0x13, 0xbb, 0x90, 0x03,
+  0x01, 0xf4, 0x02, 0x03, 0x84, 0x03, 0x06, 0x90, 0x03, 0x04, 0x54, 0x31, 0x01, 0xac, 0x0a, 0x04, 0x08, 0x00, 0x0f, 0x3e, 0x0e, 0x0b, 0x01, 0x28, 0x00, 0x00, 0xaa, 0x2a, 0x00, 0x8e, 0x03, 0x00,
+  0xd8, 0x58, 0x20, 0x3c, 0xb6, 0x10, 0xad, 0x02, 0x2c, 0x47, 0x13, 0xbb, 0x50, 0x4e, 0x04, 0xb0, 0x0d, 0x05, 0x02, 0x04, 0x18, 0x9d, 0x04, 0xb5, 0x06, 0x02, 0x00, 0x04, 0x7e, 0x01, 0x02, 0x3a,
+  0x0b, 0x01, 0x14, 0x2a, 0x00, 0xd6, 0x06, 0x03, 0xde, 0x06, 0x0a, 0x22, 0x07, 0x1b, 0x9a, 0xd8, 0x34, 0x0f, 0xc4, 0x0a, 0x12, 0x01, 0x50, 0x00, 0x03, 0xc2, 0x31, 0x05, 0x20, 0x04, 0x02, 0x12,
+  0x0e, 0x08, 0x8e, 0x03, 0x02, 0x9c, 0x27, 0x02, 0xd6, 0x27, 0x06, 0x92, 0x03, 0x06, 0x7e, 0x44, 0x04, 0x8c, 0x2b, 0x04, 0x90, 0x0d, 0x02, 0xc6, 0x04, 0x0c, 0x6c, 0x04, 0x06, 0x7a, 0x1d, 0x17,
+  0x99, 0x30, 0x36, 0x15, 0xba, 0x84, 0x63, 0x02, 0x64, 0x48, 0x0a, 0x54, 0x7c, 0x06, 0x52, 0x2f, 0x1a, 0x79, 0x02, 0x00, 0x09, 0xa2, 0x0a, 0x04, 0x1e, 0x07, 0x15, 0x38, 0xec, 0x2a, 0x0c, 0x94,
+  0x15, 0x07, 0x84, 0x3c, 0x03, 0x96, 0x03, 0x0c, 0x68, 0x20, 0x02, 0x18, 0x00, 0x07, 0x8e, 0x12, 0x03, 0x08, 0x00, 0x0f, 0x90, 0x03, 0x0e, 0x0c, 0x96, 0x03, 0x21, 0x9d, 0xfc, 0x80, 0x03, 0x04,
+  0x6a, 0x15, 0x0e, 0xf2, 0x06, 0x0e, 0xfe, 0x06, 0x0f, 0x02, 0x00, 0x09, 0x29, 0xdb, 0x95, 0x0e, 0x00, 0x05, 0xa2, 0x05, 0x04, 0xc8, 0x09, 0x0b, 0x90, 0x03, 0x17, 0x9d, 0x8c, 0x03, 0x03, 0x5a,
+  0x0e, 0x0e, 0x02, 0x00, 0x00, 0x3e, 0x25, 0x14, 0xdc, 0xfa, 0x09, 0x03, 0x3a, 0x03, 0x09, 0x90, 0x03, 0x05, 0x40, 0x07, 0x08, 0x56, 0x03, 0x00, 0xfa, 0x57, 0x02, 0xaa, 0x54, 0x00, 0xaa, 0x4d,
+  0x00, 0xc2, 0x06, 0x00, 0xea, 0x37, 0x21, 0x1b, 0xa6, 0xd8, 0x22, 0x04, 0x0e, 0x2a, 0x00, 0xa0, 0x00, 0x03, 0x0c, 0x15, 0x09, 0x66, 0x0e, 0x0b, 0x72, 0x0e, 0x0f, 0x90, 0x03, 0x07, 0x03, 0x30,
+  0x04, 0x01, 0x7a, 0x02, 0x00, 0xa0, 0xb4, 0x05, 0xcc, 0x26, 0x09, 0x44, 0xbf, 0x02, 0x24, 0x15, 0x01, 0xb2, 0x49, 0x0f, 0x92, 0x03, 0x0b, 0x03, 0xf6, 0x38, 0x20, 0xbb, 0xa5, 0x2e, 0x55, 0x04,
+  0x86, 0x43, 0x02, 0x94, 0x2a, 0x21, 0xdb, 0xad, 0x00, 0xb5, 0x03, 0x58, 0x0e, 0x00, 0x66, 0x04, 0x00, 0x22, 0x06, 0x01, 0xd2, 0x43, 0x05, 0x90, 0x07, 0x19, 0xba, 0x96, 0x03, 0x02, 0xb6, 0x0d,
+  0x01, 0x3c, 0x0b, 0x03, 0xb4, 0xad, 0x04, 0x94, 0x2d, 0x04, 0xee, 0x16, 0x0a, 0x50, 0x59, 0x0f, 0x1e, 0x07, 0x06, 0x09, 0x0c, 0x20, 0x08, 0xce, 0x15, 0x02, 0x84, 0x07, 0x04, 0xd4, 0x98, 0x1e,
+  0x9a, 0xb2, 0x20, 0x0a, 0xb6, 0x66, 0x01, 0x60, 0xb5, 0x02, 0x14, 0x48, 0x15, 0xda, 0x3e, 0x24, 0x08, 0x90, 0x0d, 0x00, 0x3e, 0x0e, 0x04, 0x8c, 0x24, 0x04, 0x54, 0x00, 0x0c, 0x74, 0x07, 0x05,
+  0xd4, 0x19, 0x04, 0x7e, 0xc0, 0x27, 0xa5, 0xfa, 0x80, 0x27, 0x0f, 0xe2, 0x32, 0x03, 0x1b, 0xba, 0x3a, 0x6e, 0x06, 0x8a, 0x03, 0x0b, 0xfc, 0x3f, 0x07, 0x6e, 0x3c, 0x0d, 0x02, 0x00, 0x07, 0x38,
+  0x47, 0x13, 0x38, 0x10, 0x00, 0x08, 0x50, 0x47, 0x02, 0x94, 0x24, 0x08, 0xe0, 0x03, 0x00, 0x42, 0xab, 0x0f, 0x86, 0x03, 0x0e, 0x1d, 0x9d, 0xe2, 0x11, 0x02, 0x36, 0x03, 0x03, 0x72, 0x15, 0x0e,
+  0x8c, 0x03, 0x09, 0x50, 0x0e, 0x0f, 0x86, 0x03, 0x04, 0x06, 0x18, 0x00, 0x02, 0x72, 0x06, 0x09, 0x92, 0x03, 0x03, 0xc2, 0x09, 0x01, 0x86, 0x9d, 0x01, 0x0a, 0x00, 0x04, 0x0c, 0x03, 0x04, 0x9a,
+  0x14, 0x0a, 0x02, 0x00, 0x06, 0x16, 0x07, 0x03, 0x4e, 0x03, 0x01, 0xdc, 0x50, 0x00, 0xe2, 0x06, 0x00, 0xfa, 0x01, 0x08, 0xc8, 0x03, 0x0a, 0x10, 0x07, 0x05, 0x52, 0x0b, 0x05, 0x5e, 0x19, 0x04,
+  0xda, 0x15, 0x11, 0x3c, 0x42, 0x00, 0x22, 0xdb, 0xa5, 0xb6, 0x29, 0x01, 0x1e, 0x46, 0x11, 0xa6, 0x42, 0x46, 0x00, 0xf8, 0x50, 0x12, 0xa5, 0xde, 0x06, 0x02, 0x36, 0x07, 0x04, 0x0c, 0x23, 0x06,
+  0x84, 0x11, 0x0e, 0x90, 0x03, 0x04, 0x00, 0x04, 0x03, 0x20, 0x00, 0x03, 0x8c, 0x03, 0x06, 0x04, 0x9f, 0x08, 0x1e, 0x03, 0x01, 0xfa, 0x37, 0x03, 0x14, 0x4a, 0x06, 0xda, 0x11, 0x07, 0x02, 0x00,
+  0x04, 0x84, 0x42, 0x07, 0x1c, 0x46, 0x02, 0xa4, 0x34, 0x05, 0xae, 0x49, 0x07, 0xe2, 0x09, 0x00, 0xb2, 0x00, 0x00, 0xe4, 0xad, 0x02, 0x34, 0x43, 0x06, 0xe8, 0x04, 0x01, 0x72, 0xa9, 0x04, 0x6e,
+  0x00, 0x07, 0x22, 0x31, 0x06, 0x46, 0x40, 0x03, 0x56, 0x40, 0x07, 0x02, 0x00, 0x02, 0xda, 0x04, 0x0c, 0x90, 0x03, 0x0c, 0x0e, 0x3c, 0x03, 0x52, 0x07, 0x07, 0x1c, 0x0b, 0x06, 0x88, 0x03, 0x0a,
+  0x34, 0x03, 0x06, 0x3a, 0x03, 0x06, 0x90, 0x2e, 0x0a, 0xb0, 0x66, 0x04, 0x0c, 0x75, 0x08, 0x98, 0x39, 0x09, 0x86, 0x58, 0x08, 0x20, 0x07, 0x14, 0x95, 0x58, 0x1f, 0x03, 0x1a, 0x0a, 0x09, 0xae,
+  0x1c, 0x01, 0xda, 0x06, 0x07, 0xf8, 0x39, 0x02, 0xd2, 0x9f, 0x03, 0x4a, 0x3d, 0x05, 0x66, 0x7c, 0x0c, 0x12, 0x60, 0x03, 0x26, 0x07, 0x0c, 0x36, 0x0e, 0x09, 0x74, 0x0a, 0x09, 0x7c, 0x2a, 0x01,
+  0x70, 0x03, 0x04, 0x34, 0x4e, 0x02, 0x7a, 0x03, 0x08, 0x0c, 0x00, 0x00, 0x20, 0xa4, 0x25, 0xd8, 0x74, 0x0e, 0x00, 0x05, 0x72, 0x1d, 0x07, 0xc0, 0x23, 0x21, 0x8d, 0x18, 0x66, 0x5e, 0x0a, 0x6e,
+  0x03, 0x06, 0x06, 0x00, 0x0b, 0x76, 0x1c, 0x05, 0xdc, 0x02, 0x35, 0xfb, 0x9d, 0xfb, 0x22, 0x00, 0x09, 0x82, 0x03, 0x01, 0x3c, 0x07, 0x04, 0x16, 0x00, 0x04, 0xda, 0x09, 0x06, 0x7e, 0x03, 0x04,
+  0x34, 0x19, 0x17, 0xfc, 0x06, 0x00, 0x00, 0xc0, 0x15, 0x06, 0xdc, 0x03, 0x03, 0x60, 0x00, 0x02, 0xfa, 0x17, 0x16, 0xa5, 0x02, 0x00, 0x03, 0xb6, 0x06, 0x1c, 0xa6, 0x2e, 0x07, 0x14, 0xfc, 0x24,
+  0x18, 0x03, 0x32, 0x00, 0x01, 0x3c, 0x18, 0x15, 0xa6, 0x94, 0x03, 0x01, 0x1a, 0x12, 0x11, 0x5c, 0x64, 0x07, 0x00, 0x64, 0x00, 0x0a, 0x94, 0x03, 0x0c, 0xa2, 0x03, 0x03, 0x5a, 0x19, 0x03, 0x24,
+  0x06, 0x00, 0x90, 0x03, 0x04, 0x26, 0x02, 0x02, 0x88, 0x46, 0x13, 0xfb, 0x8a, 0x03, 0x12, 0x1b, 0x5e, 0x00, 0x02, 0xc8, 0x0a, 0x14, 0x9d, 0x90, 0x03, 0x05, 0x74, 0x03, 0x09, 0x3a, 0x0e, 0x13,
+  0xbb, 0x8e, 0x07, 0x06, 0x22, 0x07, 0x09, 0xf2, 0xb7, 0x07, 0xf2, 0x2d, 0x04, 0xfe, 0x17, 0x16, 0xbb, 0xce, 0x00, 0x03, 0xf0, 0x03, 0x01, 0xea, 0x5f, 0x05, 0x2e, 0x0a, 0x14, 0x9a, 0x34, 0x2e,
+  0x03, 0x68, 0x5c, 0x06, 0xda, 0xa2, 0x17, 0xfb, 0xd0, 0x38, 0x00, 0x6e, 0x02, 0x02, 0x84, 0x4a, 0x14, 0x9b, 0x70, 0x03, 0x03, 0x66, 0xa2, 0x31, 0xfa, 0xa5, 0xfb, 0xe4, 0x46, 0x01, 0x40, 0xbc,
+  0x12, 0x9d, 0xec, 0x04, 0x29, 0x9a, 0x9d, 0x6a, 0xb1, 0x09, 0xa0, 0x31, 0x0e, 0x1a, 0x19, 0x0b, 0xa2, 0x11, 0x08, 0x2c, 0x07, 0x04, 0xe2, 0x0a, 0x0a, 0x18, 0x24, 0x06, 0x5c, 0x08, 0x05, 0x98,
+  0x0b, 0x0a, 0xd2, 0x11, 0x2c, 0x9a, 0x95, 0x64, 0xc0, 0x08, 0x02, 0x75, 0x03, 0x56, 0xbc, 0x05, 0xd4, 0x6d, 0x04, 0x1e, 0x07, 0x0c, 0xbc, 0x06, 0x06, 0x40, 0x1d, 0x1f, 0x7a, 0x86, 0x11, 0x04,
+  0x02, 0xee, 0x23, 0x12, 0xb9, 0x06, 0x00, 0x01, 0xfc, 0x03, 0x13, 0xfb, 0xaa, 0x23, 0x0c, 0xfc, 0x39, 0x07, 0xf8, 0x03, 0x08, 0xcc, 0x18, 0x04, 0x88, 0x11, 0x05, 0x74, 0x0a, 0x03, 0x06, 0x07,
+  0x03, 0x02, 0x00, 0x0f, 0x66, 0x55, 0x02, 0x11, 0x74, 0x04, 0x00, 0x05, 0x02, 0x00, 0x01, 0x64, 0x6e, 0x02, 0x96, 0x03, 0x03, 0xee, 0x23, 0x04, 0x68, 0x60, 0x02, 0x0a, 0x4b, 0x0e, 0xfe, 0x06,
+  0x08, 0x0e, 0x00, 0x28, 0x1c, 0x9e, 0x0e, 0x00, 0x02, 0x2c, 0x03, 0x00, 0x40, 0x06, 0x11, 0x5c, 0x66, 0x0c, 0x00, 0x12, 0x00, 0x04, 0xa2, 0x35, 0x06, 0x24, 0x00, 0x02, 0xba, 0x03, 0x08, 0x0c,
+  0x07, 0x0a, 0xd4, 0x03, 0x08, 0x06, 0x00, 0x13, 0xfb, 0x90, 0x03, 0x17, 0xfb, 0xe2, 0x1c, 0x04, 0xb4, 0x0a, 0x00, 0x98, 0x02, 0x13, 0xfc, 0x08, 0x03, 0x01, 0xb4, 0x06, 0x12, 0xa6, 0xfa, 0x5e,
+  0x15, 0xfc, 0x16, 0x04, 0x00, 0x18, 0x00, 0x17, 0xdb, 0x2c, 0x2d, 0x06, 0xac, 0x49, 0x06, 0xd6, 0x1b, 0x12, 0x5c, 0x8c, 0x0e, 0x01, 0x92, 0x03, 0x06, 0x10, 0x12, 0x07, 0x96, 0x03, 0x0d, 0x70,
+  0x07, 0x15, 0xfb, 0x98, 0x07, 0x00, 0x8c, 0x03, 0x04, 0x5c, 0x10, 0x08, 0x64, 0x00, 0x02, 0xce, 0x0a, 0x02, 0xbe, 0x0a, 0x04, 0xc6, 0x03, 0x15, 0x9b, 0xfa, 0x0d, 0x03, 0x24, 0x07, 0x04, 0x18,
+  0x0b, 0x05, 0x90, 0x03, 0x04, 0xe4, 0x06, 0x08, 0x0e, 0x35, 0x19, 0xba, 0x02, 0x00, 0x17, 0xbb, 0x5c, 0x04, 0x01, 0x1e, 0x00, 0x07, 0x4a, 0x06, 0x0d, 0xe0, 0x09, 0x03, 0x6e, 0x00, 0x06, 0x90,
+  0x03, 0x03, 0x22, 0x46, 0x07, 0x02, 0x00, 0x12, 0xbb, 0x6e, 0x03, 0x05, 0xe8, 0x3b, 0x04, 0x86, 0x0d, 0x05, 0x02, 0x40, 0x03, 0x24, 0x39, 0x05, 0xb6, 0xb8, 0x06, 0x18, 0x03, 0x08, 0xf0, 0xbb,
+  0x08, 0x90, 0x03, 0x07, 0xa2, 0x0a, 0x05, 0x1a, 0x04, 0x07, 0xc6, 0x9f, 0x04, 0x1e, 0xc7, 0x16, 0xbb, 0x94, 0x0a, 0x04, 0xdc, 0x00, 0x12, 0xa5, 0x02, 0x00, 0x06, 0x1a, 0x39, 0x0a, 0x4c, 0x12,
+  0x06, 0xaa, 0x1f, 0x04, 0xd4, 0x26, 0x03, 0x96, 0x39, 0x0b, 0xf6, 0xb1, 0x05, 0xb8, 0x03, 0x09, 0x96, 0xc7, 0x0d, 0x72, 0x18, 0x06, 0x10, 0x00, 0x14, 0x95, 0xda, 0x11, 0x06, 0xc4, 0x14, 0x03,
+  0x50, 0x15, 0x03, 0xd2, 0x2a, 0x05, 0xfe, 0xca, 0x08, 0x96, 0x0e, 0x0e, 0xce, 0x18, 0x09, 0xae, 0x2b, 0x0e, 0x8e, 0x03, 0x07, 0x80, 0x03, 0x1e, 0x74, 0x80, 0x03, 0x06, 0x0c, 0x00, 0x03, 0xf6,
+  0x71, 0x05, 0x94, 0x5c, 0x02, 0xe0, 0x07, 0x24, 0x99, 0x95, 0xc8, 0x55, 0x06, 0x72, 0x03, 0x15, 0xfb, 0xf8, 0x06, 0x06, 0xfe, 0x06, 0x07, 0x90, 0x03, 0x12, 0xa5, 0xc0, 0x4c, 0x00, 0x16, 0x1c,
+  0x02, 0x00, 0x15, 0x04, 0x1e, 0x03, 0x0a, 0xb2, 0x03, 0x06, 0x06, 0x00, 0x03, 0x00, 0x07, 0x05, 0x40, 0x00, 0x02, 0x02, 0x00, 0x01, 0xce, 0x10, 0x05, 0x66, 0x00, 0x01, 0x90, 0x03, 0x01, 0x06,
+  0x00, 0x04, 0x30, 0x00, 0x04, 0x80, 0x07, 0x06, 0x26, 0x06, 0x0c, 0x12, 0x07, 0x02, 0x8a, 0x00, 0x04, 0x50, 0x00, 0x03, 0x98, 0x00, 0x05, 0x72, 0x0e, 0x03, 0x8c, 0x2c, 0x03, 0x4a, 0x4d, 0x01,
+  0xce, 0x68, 0x01, 0x92, 0x03, 0x03, 0x64, 0x03, 0x09, 0xe4, 0x0a, 0x1d, 0xbb, 0xfe, 0x11, 0x05, 0xa0, 0x03, 0x25, 0xa5, 0xfb, 0x20, 0xbb, 0x02, 0x52, 0x00, 0x0a, 0xb2, 0x34, 0x13, 0xdb, 0xf0,
+  0x09, 0x02, 0xd4, 0x1f, 0x02, 0xba, 0x20, 0x11, 0xfb, 0x96, 0x03, 0x18, 0x9b, 0x2c, 0x07, 0x03, 0x4a, 0x2a, 0x04, 0xcc, 0x06, 0x15, 0x9b, 0xaa, 0x11, 0x15, 0xba, 0x1e, 0xa6, 0x08, 0x92, 0x06,
+  0x02, 0x52, 0x00, 0x03, 0x5e, 0x0e, 0x03, 0x82, 0x2a, 0x05, 0x28, 0x00, 0x0f, 0x90, 0x03, 0x04, 0x24, 0xba, 0x95, 0x5c, 0x07, 0x15, 0xda, 0x36, 0x47, 0x19, 0xb9, 0xf4, 0x38, 0x0e, 0x90, 0x03,
+  0x02, 0x46, 0x2d, 0x04, 0xa6, 0x2a, 0x08, 0x1e, 0x03, 0x03, 0xa0, 0x3f, 0x03, 0x54, 0x35, 0x05, 0x66, 0x15, 0x0f, 0x1e, 0x07, 0x07, 0x0d, 0x96, 0x27, 0x17, 0x7a, 0x14, 0x3d, 0x02, 0xc2, 0x1b,
+  0x07, 0x3e, 0xce, 0x0c, 0x7c, 0x07, 0x0a, 0x12, 0x32, 0x07, 0xd0, 0x11, 0x06, 0x64, 0x2a, 0x00, 0x16, 0x07, 0x08, 0x82, 0x03, 0x02, 0x32, 0x04, 0x17, 0xbb, 0x4c, 0x00, 0x08, 0x90, 0x03, 0x08,
+  0xc8, 0x14, 0x04, 0x02, 0x00, 0x06, 0xda, 0x1c, 0x0a, 0x40, 0x1c, 0x02, 0x92, 0x03, 0x05, 0x6c, 0xb9, 0x02, 0x82, 0x03, 0x0d, 0x42, 0x15, 0x02, 0x86, 0x27, 0x0c, 0x2c, 0x4e, 0x2e, 0x18, 0x85,
+  0x10, 0x07, 0x0c, 0x86, 0x03, 0x0b, 0x02, 0x00, 0x17, 0x6c, 0x02, 0x00, 0x03, 0x92, 0x03, 0x00, 0xbc, 0x2b, 0x06, 0x82, 0x15, 0x02, 0xaa, 0x23, 0x04, 0x18, 0x03, 0x04, 0x12, 0x0a, 0x02, 0x1c,
+  0x0d, 0x0d, 0xb0, 0x0a, 0x21, 0xa5, 0xdb, 0x48, 0x0d, 0x20, 0x5d, 0xbe, 0x52, 0x17, 0x00, 0x42, 0x45, 0x03, 0xe2, 0x02, 0x1c, 0x9d, 0xce, 0x03, 0x03, 0x16, 0x00, 0x12, 0xa5, 0xc0, 0x0d, 0x12,
+  0xfb, 0x5e, 0x03, 0x0b, 0x36, 0x03, 0x03, 0x02, 0x00, 0x09, 0x92, 0x03, 0x24, 0xdb, 0x9d, 0x68, 0x1c, 0x01, 0xfc, 0x03, 0x09, 0xb0, 0x0a, 0x06, 0xb2, 0x06, 0x04, 0x28, 0x03, 0x06, 0xc8, 0x0d,
+  0x03, 0xb2, 0x00, 0x01, 0x58, 0x1f, 0x00, 0x00, 0x12, 0x0c, 0x2e, 0x00, 0x10, 0xfa, 0xee, 0x37, 0x24, 0xae, 0x3b, 0xe2, 0x1b, 0x07, 0xd6, 0x03, 0x12, 0xdc, 0x0a, 0x00, 0x05, 0x40, 0x0e, 0x06,
+  0x6c, 0x0e, 0x13, 0xba, 0xa2, 0x34, 0x0a, 0x02, 0x00, 0x18, 0xbb, 0x3c, 0xcd, 0x07, 0xd0, 0x06, 0x20, 0xfb, 0xa5, 0xc4, 0x74, 0x11, 0x3d, 0x16, 0x0b, 0x13, 0xba, 0x8c, 0x11, 0x00, 0x28, 0x03,
+  0x04, 0x04, 0x11, 0x04, 0xd0, 0x0a, 0x06, 0x1e, 0x07, 0x05, 0x90, 0x0d, 0x06, 0x68, 0x03, 0x05, 0x4c, 0x06, 0x03, 0x98, 0x02, 0x03, 0x8a, 0x03, 0x23, 0xba, 0x95, 0xda, 0x49, 0x06, 0xaa, 0x03,
+  0x2d, 0x95, 0xba, 0x90, 0x03, 0x0f, 0x02, 0x00, 0x05, 0x06, 0x76, 0x14, 0x03, 0x74, 0x43, 0x05, 0x38, 0x31, 0x06, 0xca, 0x00, 0x03, 0xf0, 0x4a, 0x05, 0x38, 0x0a, 0x00, 0x24, 0x00, 0x05, 0xf2,
+  0x00, 0x0e, 0x22, 0x11, 0x0b, 0x4e, 0x20, 0x0e, 0x26, 0x04, 0x0d, 0x5e, 0x03, 0x07, 0xc4, 0x18, 0x02, 0x7a, 0x4d, 0x02, 0x9a, 0x27, 0x06, 0xae, 0x23, 0x0c, 0x32, 0x00, 0x15, 0xda, 0xea, 0x07,
+  0x0e, 0x3a, 0x44, 0x19, 0x9a, 0xe8, 0x0b, 0x1e, 0x9a, 0x9a, 0x0a, 0x05, 0x9e, 0x2d, 0x0a, 0x06, 0x19, 0x06, 0xec, 0x1c, 0x0e, 0x96, 0x03, 0x0e, 0xb6, 0x11, 0x0a, 0xd2, 0x18, 0x08, 0x16, 0x07,
+  0x06, 0x2a, 0x0e, 0x0f, 0x14, 0x07, 0x01, 0x05, 0xfc, 0x06, 0x0d, 0x8e, 0x03, 0x15, 0xb8, 0x8c, 0x03, 0x16, 0xb8, 0x92, 0x03, 0x01, 0x90, 0x03, 0x02, 0x16, 0x2b, 0x06, 0x80, 0x2e, 0x13, 0xfb,
+  0xd6, 0x02, 0x04, 0x66, 0x18, 0x02, 0x8c, 0x09, 0x1a, 0xfb, 0xc0, 0x0a, 0x02, 0x6e, 0x06, 0x01, 0x3a, 0x69, 0x10, 0x7d, 0x02, 0x00, 0x03, 0x36, 0x57, 0x01, 0xa8, 0x06, 0x06, 0x90, 0x03, 0x07,
+  0x6c, 0x03, 0x02, 0xba, 0x0d, 0x1f, 0xfb, 0x86, 0x03, 0x01, 0x08, 0x30, 0x03, 0x07, 0x94, 0x07, 0x03, 0x28, 0x03, 0x0a, 0x0e, 0x07, 0x06, 0xd2, 0x06, 0x16, 0xa5, 0x14, 0x00, 0x0e, 0x5a, 0x0a,
+  0x04, 0xd4, 0x0d, 0x02, 0x02, 0x54, 0x06, 0x8e, 0x03, 0x02, 0xe0, 0x06, 0x02, 0xaa, 0x03, 0x02, 0xe0, 0x21, 0x24, 0xdb, 0xa5, 0x42, 0x11, 0x04, 0x7c, 0x0e, 0x15, 0xfc, 0xee, 0x02, 0x06, 0xf8,
+  0x02, 0x03, 0x6c, 0x03, 0x0c, 0x90, 0x03, 0x04, 0xa2, 0xc9, 0x02, 0x12, 0x11, 0x03, 0x58, 0x38, 0x11, 0xfb, 0x3c, 0x22, 0x20, 0x3d, 0xb6, 0xf0, 0x00, 0x02, 0xca, 0x03, 0x04, 0x5a, 0x31, 0x00,
+  0x4c, 0x03, 0x02, 0x6a, 0x04, 0x0f, 0x90, 0x03, 0x04, 0x05, 0xba, 0x03, 0x09, 0x66, 0x14, 0x02, 0x9a, 0x02, 0x05, 0xa0, 0x31, 0x03, 0x1c, 0x04, 0x03, 0x04, 0x07, 0x08, 0xc4, 0x03, 0x04, 0x7e,
+  0x07, 0x0a, 0x24, 0x43, 0x09, 0x90, 0x03, 0x09, 0xf2, 0x22, 0x17, 0xdb, 0xa4, 0x5c, 0x08, 0x80, 0x5c, 0x03, 0xda, 0x46, 0x06, 0x1a, 0x12, 0x06, 0x80, 0x04, 0x08, 0x16, 0xce, 0x07, 0x96, 0x0a,
+  0x0d, 0xb4, 0x23, 0x0e, 0x2c, 0x15, 0x09, 0x8a, 0x00, 0x07, 0xee, 0x35, 0x0b, 0x8c, 0x1b, 0x06, 0xbe, 0x06, 0x06, 0x64, 0x15, 0x08, 0x90, 0x03, 0x06, 0x92, 0x43, 0x04, 0xdc, 0x14, 0x08, 0x5c,
+  0x03, 0x05, 0x4a, 0x0a, 0x07, 0x82, 0x32, 0x02, 0x9e, 0x23, 0x03, 0x8c, 0x1c, 0x0e, 0xae, 0x03, 0x09, 0xac, 0x2e, 0x09, 0x58, 0x0e, 0x03, 0x0e, 0x21, 0x0c, 0xa2, 0x0a, 0x04, 0x36, 0x3c, 0x05,
+  0x46, 0x15, 0x0e, 0x30, 0x0e, 0x0f, 0x12, 0x07, 0x0b, 0x03, 0x16, 0x79, 0x04, 0x02, 0x00, 0x0a, 0x22, 0x07, 0x15, 0x18, 0x46, 0xbd, 0x00, 0x7c, 0x2b, 0x00, 0x0c, 0x01, 0x02, 0xce, 0x02, 0x35,
+  0x3c, 0xae, 0x5d, 0x88, 0x0a, 0x02, 0xaa, 0x0d, 0x01, 0x8e, 0x0a, 0x04, 0x6c, 0x03, 0x02, 0x98, 0x0d, 0x13, 0xb6, 0x24, 0xa8, 0x00, 0x02, 0x00, 0x01, 0x22, 0x07, 0x03, 0x92, 0x03, 0x09, 0xa0,
+  0x18, 0x21, 0x3c, 0xae, 0x02, 0x1b, 0x00, 0x4a, 0x00, 0x02, 0x5a, 0x37, 0x17, 0xa6, 0x78, 0x07, 0x01, 0x96, 0x17, 0x04, 0x02, 0x00, 0x03, 0x9c, 0x57, 0x05, 0x66, 0x00, 0x07, 0x72, 0x03, 0x05,
+  0x7c, 0x0a, 0x04, 0x0c, 0x18, 0x04, 0x2e, 0x03, 0x0b, 0xc4, 0x0a, 0x07, 0x42, 0x07, 0x03, 0x14, 0x46, 0x1a, 0xae, 0x8e, 0x03, 0x06, 0x60, 0x07, 0x02, 0x4e, 0x66, 0x06, 0x52, 0x00, 0x06, 0x02,
+  0x00, 0x15, 0xbb, 0x14, 0x0a, 0x0e, 0x02, 0x00, 0x08, 0x68, 0x00, 0x12, 0xbb, 0x32, 0x0e, 0x05, 0x6c, 0x04, 0x02, 0xc6, 0x1b, 0x20, 0xfb, 0xa5, 0xcc, 0xac, 0x62, 0x5d, 0xb6, 0x3c, 0xb6, 0x1c,
+  0xae, 0x5a, 0x00, 0x00, 0x72, 0x25, 0x02, 0x78, 0x25, 0x21, 0xdb, 0xa5, 0x30, 0x19, 0x07, 0xa4, 0x03, 0x1d, 0xbb, 0x72, 0x0a, 0x0f, 0x62, 0x06, 0x08, 0x02, 0x94, 0x03, 0x07, 0x36, 0x1c, 0x14,
+  0xdb, 0xe2, 0x0a, 0x0e, 0x00, 0x03, 0x0b, 0x40, 0x06, 0x0c, 0xfe, 0x17, 0x0a, 0x90, 0x03, 0x03, 0x1a, 0x1f, 0x05, 0xe6, 0x46, 0x09, 0xa0, 0x07, 0x1a, 0x9d, 0x9a, 0x4a, 0x0f, 0x90, 0x03, 0x0a,
+  0x0e, 0xe2, 0x18, 0x05, 0xaa, 0x15, 0x11, 0x99, 0x88, 0x1f, 0x00, 0x5a, 0x4e, 0x15, 0x7a, 0xbe, 0x11, 0x04, 0x8a, 0x23, 0x07, 0xc0, 0x35, 0x07, 0x84, 0x31, 0x19, 0x7a, 0x1c, 0x2a, 0x06, 0x20,
+  0x23, 0x1c, 0x7a, 0x0a, 0x35, 0x09, 0x02, 0x00, 0x0e, 0xe8, 0x34, 0x09, 0x02, 0x0a, 0x1e, 0x95, 0xd0, 0x2a, 0x02, 0xee, 0x38, 0x07, 0x7a, 0x15, 0x0c, 0x02, 0x00, 0x09, 0xda, 0x2e, 0x04, 0x5a,
+  0x43, 0x08, 0x8e, 0x03, 0x0c, 0xa6, 0x0a, 0x1f, 0xd8, 0x8e, 0x03, 0x05, 0x00, 0x82, 0x03, 0x0e, 0x90, 0x03, 0x02, 0x06, 0x00, 0x02, 0x54, 0x07, 0x16, 0x7c, 0x16, 0x19, 0x02, 0xbc, 0x0a, 0x02,
+  0xfa, 0x02, 0x30, 0x3c, 0xb6, 0x7d, 0xea, 0x6e, 0x01, 0x46, 0x03, 0x00, 0x68, 0x06, 0x04, 0x32, 0x18, 0x06, 0x4c, 0x03, 0x04, 0xae, 0x6b, 0x11, 0x5c, 0xdc, 0x60, 0x00, 0x86, 0x6b, 0x11, 0x5c,
+  0xca, 0x5a, 0x0a, 0x2e, 0x1c, 0x00, 0x22, 0x22, 0x02, 0xde, 0xab, 0x13, 0x5c, 0x26, 0x22, 0x02, 0x24, 0x03, 0x02, 0xec, 0x3d, 0x02, 0x22, 0x00, 0x02, 0xac, 0x03, 0x06, 0x40, 0x07, 0x06, 0x0a,
+  0x0e, 0x02, 0x3c, 0x03, 0x00, 0x28, 0x27, 0x00, 0x02, 0x00, 0x00, 0x1e, 0x04, 0x02, 0xd4, 0x06, 0x0d, 0x96, 0x03, 0x05, 0x8a, 0x2c, 0x05, 0x08, 0x00, 0x05, 0xc4, 0x03, 0x06, 0x7c, 0x26, 0x01,
+  0x42, 0x03, 0x01, 0xd6, 0x06, 0x04, 0xe8, 0x0a, 0x00, 0x14, 0x66, 0x06, 0x4e, 0x00, 0x00, 0x3a, 0x03, 0x0f, 0xa2, 0x0e, 0x01, 0x0e, 0x94, 0x03, 0x04, 0x1c, 0x14, 0x13, 0xbb, 0xa0, 0x18, 0x04,
+  0x86, 0x04, 0x15, 0xdb, 0x7a, 0x4d, 0x00, 0xe0, 0x00, 0x02, 0x16, 0x04, 0x06, 0xb0, 0x07, 0x13, 0x1b, 0x02, 0x04, 0x02, 0x12, 0x29, 0x0f, 0x08, 0x0e, 0x09, 0x09, 0x3a, 0x03, 0x0b, 0x92, 0x03,
+  0x1a, 0x9a, 0x72, 0x43, 0x05, 0x12, 0x0e, 0x09, 0x50, 0x18, 0x0e, 0xd2, 0x09, 0x0a, 0xf2, 0xd4, 0x02, 0xe6, 0x14, 0x07, 0xf4, 0x11, 0x0a, 0x7a, 0x4a, 0x05, 0xbe, 0x03, 0x09, 0xe4, 0xd8, 0x07,
+  0x14, 0xca, 0x1e, 0x8d, 0xae, 0x0a, 0x0f, 0x90, 0x03, 0x0a, 0x17, 0x9d, 0x36, 0x3c, 0x09, 0xa8, 0x03, 0x03, 0xda, 0x06, 0x0e, 0x42, 0x00, 0x07, 0x62, 0x0a, 0x11, 0x99, 0x04, 0x39, 0x0e, 0x6e,
+  0x0a, 0x01, 0xf8, 0x06, 0x0e, 0x80, 0x03, 0x08, 0x2a, 0x0e, 0x04, 0xf2, 0x35, 0x05, 0x2e, 0x36, 0x0a, 0xfa, 0x18, 0x08, 0xce, 0x2a, 0x02, 0xda, 0x0e, 0x0e, 0x72, 0x23, 0x08, 0x48, 0x23, 0x08,
+  0x90, 0x3c, 0x17, 0x19, 0x92, 0x03, 0x0e, 0x38, 0x0e, 0x0b, 0xa6, 0x0a, 0x07, 0x2c, 0x0e, 0x0c, 0x90, 0x03, 0x05, 0x96, 0x03, 0x08, 0x90, 0x03, 0x07, 0x94, 0x1c, 0x02, 0x4c, 0x02, 0x13, 0x1c,
+  0x04, 0x03, 0x04, 0x26, 0x41, 0x02, 0x04, 0x06, 0x04, 0x64, 0x18, 0x20, 0x1b, 0xa6, 0xb2, 0x03, 0x16, 0x7c, 0x1e, 0x07, 0x10, 0xc6, 0xb2, 0x73, 0x00, 0x2e, 0x03, 0x0a, 0x4c, 0x11, 0x02, 0x22,
+  0x22, 0x13, 0x7d, 0xb0, 0x56, 0x14, 0x3c, 0x0a, 0x1b, 0x05, 0x64, 0xd6, 0x51, 0x1c, 0xb6, 0x3c, 0xb6, 0x5d, 0xb2, 0x03, 0x02, 0x50, 0x06, 0x03, 0x1c, 0x00, 0x05, 0x8c, 0x03, 0x03, 0xa4, 0x0e,
+  0x00, 0x22, 0x00, 0x01, 0x90, 0x03, 0x00, 0x08, 0x00, 0x03, 0x40, 0x0b, 0x09, 0xd4, 0x06, 0x06, 0x2e, 0x57, 0x0a, 0x2c, 0x07, 0x08, 0x2a, 0x0b, 0x04, 0xd0, 0x06, 0x0e, 0x7a, 0x0a, 0x05, 0x86,
+  0x0e, 0x01, 0xc8, 0x06, 0x0d, 0x0a, 0x07, 0x09, 0x10, 0x00, 0x0c, 0x2a, 0x07, 0x0c, 0x78, 0x00, 0x02, 0x50, 0x06, 0x04, 0xd0, 0x14, 0x02, 0x82, 0x00, 0x01, 0x00, 0x2d, 0x12, 0xa6, 0x86, 0x00,
+  0x06, 0x9e, 0xdb, 0x04, 0x40, 0x00, 0x1f, 0x9a, 0x92, 0x03, 0x0c, 0x0f, 0x88, 0x0d, 0x0b, 0x07, 0xb8, 0x14, 0x05, 0xa4, 0x10, 0x0f, 0x92, 0x03, 0x03, 0x0a, 0xb6, 0x03, 0x15, 0x7a, 0x02, 0xdc,
+  0x06, 0x90, 0x43, 0x0b, 0x90, 0x03, 0x07, 0x40, 0x40, 0x0a, 0xba, 0x55, 0x0f, 0x14, 0x07, 0x01, 0x1a, 0x9a, 0x74, 0x15, 0x0d, 0x1e, 0x07, 0x0a, 0x88, 0x00, 0x0f, 0x82, 0x0e, 0x03, 0x07, 0x02,
+  0x32, 0x0b, 0x6e, 0x11, 0x06, 0x1e, 0xc0, 0x11, 0x9a, 0x6a, 0x32, 0x05, 0x60, 0x2b, 0x03, 0x46, 0x12, 0x0f, 0x72, 0x27, 0x06, 0x0b, 0x4a, 0x36, 0x06, 0x80, 0x03, 0x15, 0x9a, 0xa0, 0x07, 0x13,
+  0x9a, 0x84, 0x07, 0x06, 0xf2, 0x43, 0x0e, 0x3a, 0x0e, 0x08, 0xc6, 0x3f, 0x04, 0x68, 0x1c, 0x0d, 0xca, 0x58, 0x0e, 0xcc, 0x11, 0x0f, 0x28, 0x07, 0x02, 0x13, 0xb8, 0x02, 0x00, 0x09, 0xd0, 0x11,
+  0x03, 0x3c, 0x80, 0x04, 0xae, 0x1c, 0x08, 0x94, 0x03, 0x2e, 0x1c, 0xae, 0x02, 0x00, 0x00, 0x28, 0x03, 0x17, 0x1c, 0x00, 0x0e, 0x52, 0x3b, 0xae, 0x7c, 0xb6, 0x7d, 0xe6, 0x73, 0x05, 0x02, 0x00,
+  0x2a, 0x5c, 0xb6, 0x90, 0x03, 0x01, 0xd6, 0x06, 0x01, 0x22, 0x00, 0x13, 0x5c, 0x20, 0x53, 0x04, 0x62, 0x69, 0x04, 0xaa, 0x0a, 0x15, 0x1b, 0xca, 0x0a, 0x07, 0xfa, 0x03, 0x09, 0x50, 0x0e, 0x04,
+  0x50, 0x03, 0x02, 0xae, 0x03, 0x1e, 0x1c, 0x18, 0x15, 0x06, 0x14, 0x03, 0x0e, 0x0e, 0x00, 0x06, 0x10, 0x5f, 0x04, 0x54, 0x23, 0x07, 0xf8, 0x0d, 0x05, 0x74, 0x0a, 0x09, 0x4c, 0x46, 0x02, 0xf0,
+  0x0d, 0x0e, 0x0c, 0x07, 0x09, 0x02, 0x00, 0x18, 0x95, 0xd0, 0x0a, 0x06, 0x5c, 0x03, 0x08, 0xcc, 0x02, 0x02, 0x14, 0x14, 0x04, 0x8e, 0x2c, 0x04, 0x86, 0x06, 0x02, 0xd4, 0x20, 0x0c, 0xd0, 0x18,
+  0x15, 0xba, 0x64, 0x0e, 0x0f, 0x04, 0x11, 0x03, 0x0b, 0xc8, 0x26, 0x07, 0x64, 0x03, 0x08, 0x1e, 0x07, 0x0f, 0xe6, 0x0a, 0x09, 0x05, 0x0a, 0x03, 0x09, 0xc6, 0x10, 0x05, 0x10, 0x1c, 0x0c, 0x7a,
+  0x5c, 0x0d, 0x12, 0x00, 0x04, 0x3c, 0x55, 0x04, 0x2e, 0x31, 0x05, 0xf0, 0x18, 0x0a, 0x4a, 0x51, 0x01, 0xac, 0x46, 0x26, 0x7a, 0x95, 0x96, 0x11, 0x02, 0x68, 0x00, 0x0d, 0x12, 0x0e, 0x0b, 0x9e,
+  0x00, 0x0c, 0x1c, 0x07, 0x06, 0x88, 0x35, 0x08, 0x64, 0x11, 0x06, 0x88, 0x00, 0x05, 0xda, 0x38, 0x0f, 0xfa, 0x19, 0x0a, 0x06, 0x26, 0x27, 0x04, 0x2c, 0x27, 0x0e, 0x38, 0x3c, 0x08, 0x30, 0x0e,
+  0x07, 0x54, 0x75, 0x0a, 0xba, 0x0a, 0x07, 0xda, 0x11, 0x15, 0x99, 0x4e, 0x0e, 0x0a, 0x94, 0x23, 0x04, 0x12, 0x39, 0x01, 0x72, 0x95, 0x04, 0x16, 0x52, 0x06, 0x48, 0x07, 0x08, 0x5e, 0x03, 0x05,
+  0x92, 0x23, 0x0b, 0x90, 0x1c, 0x01, 0x86, 0x03, 0x22, 0x19, 0x85, 0xaa, 0x44, 0x0a, 0x86, 0x40, 0x02, 0x08, 0x11, 0x04, 0x0e, 0x11, 0x13, 0x1c, 0x0a, 0x00, 0x06, 0x7a, 0x09, 0x02, 0x0c, 0x73,
+  0x01, 0x66, 0x03, 0x02, 0x4e, 0x03, 0x03, 0x8e, 0x03, 0x08, 0xae, 0x0d, 0x02, 0x28, 0x0a, 0x02, 0x48, 0xd6, 0x00, 0x26, 0x00, 0x06, 0xbe, 0x4c, 0x05, 0x7c, 0xbd, 0x07, 0x92, 0x03, 0x02, 0x02,
+  0x00, 0x14, 0x1c, 0x54, 0x57, 0x06, 0x3a, 0x1c, 0x07, 0xa4, 0x18, 0x0e, 0x0c, 0x12, 0x02, 0x82, 0x15, 0x0f, 0x02, 0x00, 0x10, 0x0e, 0x38, 0x12, 0x07, 0x14, 0x12, 0x07, 0xc6, 0x62, 0x03, 0x18,
+  0x00, 0x0f, 0x90, 0x03, 0x05, 0x14, 0xba, 0x06, 0x00, 0x18, 0x95, 0x92, 0x03, 0x05, 0xd0, 0x0d, 0x08, 0x8a, 0x15, 0x06, 0x3a, 0xd4, 0x03, 0x90, 0x03, 0x07, 0x28, 0x14, 0x2b, 0x9d, 0xda, 0x20,
+  0x07, 0x0a, 0xec, 0x06, 0x07, 0xa2, 0x03, 0x03, 0xa4, 0x00, 0x07, 0xc8, 0x17, 0x0c, 0x9e, 0x1c, 0x29, 0xa5, 0xbb, 0xf8, 0x06, 0x06, 0x64, 0x0e, 0x0f, 0x54, 0x07, 0x03, 0x0a, 0x48, 0x31, 0x0f,
+  0xbe, 0x03, 0x05, 0x1b, 0x99, 0xf8, 0x03, 0x02, 0xde, 0x11, 0x07, 0xac, 0x06, 0x0d, 0x20, 0x07, 0x06, 0x6a, 0x1c, 0x02, 0x80, 0xe3, 0x01, 0x08, 0x01, 0x03, 0xd0, 0x3c, 0x1e, 0x9a, 0x58, 0x1c,
+  0x0d, 0x12, 0x08, 0x0c, 0xf6, 0x0a, 0x06, 0xa2, 0x38, 0x15, 0x99, 0x86, 0x03, 0x0b, 0xce, 0x34, 0x0b, 0xbe, 0x18, 0x1b, 0x7a, 0x00, 0x20, 0x0e, 0xb6, 0x11, 0x16, 0x7a, 0x60, 0x40, 0x0b, 0xf0,
+  0x03, 0x0a, 0xe4, 0x78, 0x0b, 0x64, 0xa3, 0x09, 0xb6, 0x3f, 0x0f, 0x16, 0x44, 0x05, 0x0a, 0x2c, 0x12, 0x14, 0x59, 0x46, 0x0b, 0x03, 0xf2, 0x4a, 0x02, 0x50, 0xcb, 0x12, 0x38, 0xf0, 0xce, 0x0e,
+  0xf6, 0xce, 0x08, 0x02, 0x00, 0x05, 0xe2, 0x23, 0x08, 0x02, 0x00, 0x0c, 0x7e, 0x03, 0x08, 0x18, 0x07, 0x04, 0x80, 0x1b, 0x06, 0xf0, 0x4b, 0x04, 0x52, 0x03, 0x04, 0x88, 0x0a, 0x05, 0x38, 0x00,
+  0x14, 0xad, 0x92, 0x03, 0x06, 0xca, 0x6c, 0x12, 0x3b, 0x40, 0x57, 0x05, 0x0e, 0xc1, 0x02, 0x40, 0x0e, 0x02, 0x02, 0x1b, 0x06, 0xe0, 0x5a, 0x06, 0xca, 0x06, 0x0a, 0x98, 0x03, 0x02, 0xda, 0x02,
+  0x0e, 0xe2, 0x0d, 0x0f, 0x96, 0x1c, 0x03, 0x1e, 0xdb, 0x26, 0x07, 0x0a, 0x2a, 0x07, 0x07, 0x10, 0x03, 0x08, 0x5c, 0x07, 0x0a, 0x20, 0x07, 0x08, 0xb0, 0x0a, 0x05, 0x90, 0x03, 0x03, 0x8c, 0x11,
+  0x08, 0x90, 0x03, 0x06, 0x0a, 0x20, 0x05, 0x7c, 0x07, 0x2b, 0x9d, 0xdb, 0x6a, 0x18, 0x0c, 0x4a, 0x07, 0x1e, 0xbb, 0x8e, 0x03, 0x05, 0x90, 0x03, 0x02, 0x96, 0x0e, 0x02, 0xc6, 0x16, 0x06, 0x90,
+  0x14, 0x04, 0xfe, 0x0a, 0x0a, 0x66, 0x07, 0x17, 0x9a, 0xf8, 0x06, 0x03, 0x88, 0x42, 0x0c, 0x74, 0x0e, 0x0e, 0x52, 0xea, 0x0e, 0xd8, 0x29, 0x0f, 0xa8, 0x03, 0x01, 0x06, 0x30, 0x07, 0x0b, 0xdc,
+  0x02, 0x06, 0x72, 0x58, 0x03, 0x04, 0x79, 0x05, 0x38, 0x07, 0x13, 0x79, 0x92, 0x2a, 0x15, 0xba, 0x34, 0x00, 0x0e, 0x60, 0x00, 0x1f, 0x99, 0x8e, 0x03, 0x03, 0x00, 0x1e, 0xd5, 0x05, 0x30, 0x3c,
+  0x05, 0x62, 0x63, 0x06, 0xee, 0x34, 0x0b, 0x98, 0x06, 0x0a, 0x0a, 0x43, 0x0b, 0x20, 0x15, 0x0e, 0xb0, 0x00, 0x08, 0x46, 0x15, 0x06, 0x58, 0x19, 0x07, 0xe0, 0x18, 0x02, 0xf2, 0x38, 0x00, 0x6e,
+  0xe7, 0x08, 0xb8, 0x64, 0x08, 0x96, 0x23, 0x08, 0x08, 0x04, 0x08, 0xa0, 0x04, 0x0e, 0xfc, 0x11, 0x04, 0xac, 0x55, 0x22, 0x38, 0x85, 0x30, 0x15, 0x06, 0x36, 0x15, 0x1e, 0x18, 0x90, 0x03, 0x03,
+  0x66, 0x59, 0x06, 0xa8, 0x4e, 0x05, 0x94, 0x03, 0x01, 0x0e, 0x00, 0x2a, 0x1c, 0xae, 0x9a, 0x14, 0x0e, 0x5e, 0x06, 0x02, 0xd2, 0x17, 0x06, 0x54, 0x03, 0x06, 0x60, 0x03, 0x0b, 0x2c, 0x00, 0x09,
+  0x00, 0x07, 0x02, 0x8e, 0x03, 0x22, 0x3c, 0xb6, 0xee, 0x06, 0x04, 0x64, 0x00, 0x18, 0x1c, 0x3e, 0x00, 0x09, 0x8e, 0x03, 0x0c, 0x02, 0x00, 0x03, 0x20, 0xd7, 0x0d, 0x3a, 0x23, 0x2f, 0xdb, 0xa5,
+  0x28, 0x07, 0x1b, 0x0a, 0x10, 0x12, 0x0a, 0xde, 0x06, 0x08, 0x1a, 0x07, 0x02, 0x32, 0x03, 0x07, 0xa4, 0x3f, 0x07, 0x2e, 0x07, 0x0a, 0x9a, 0x1f, 0x0e, 0x68, 0x58, 0x0d, 0xf6, 0x1b, 0x09, 0x84,
+  0x03, 0x08, 0x2e, 0x00, 0x2e, 0xbb, 0x9d, 0x42, 0x15, 0x06, 0x7c, 0x03, 0x04, 0x2a, 0x5f, 0x03, 0x00, 0x27, 0x01, 0x8e, 0x16, 0x04, 0xb8, 0x1b, 0x0a, 0x12, 0x3f, 0x0e, 0x50, 0x03, 0x0c, 0x06,
+  0x12, 0x09, 0xd8, 0x11, 0x1f, 0x9d, 0x76, 0x0d, 0x09, 0x0a, 0xc8, 0x03, 0x03, 0x42, 0x44, 0x0b, 0xd0, 0x03, 0x0e, 0xd0, 0x11, 0x06, 0xd8, 0x34, 0x17, 0x9a, 0x4a, 0x07, 0x1d, 0x9a, 0x92, 0x18,
+  0x0e, 0xa6, 0x03, 0x0a, 0x4a, 0x00, 0x02, 0xbe, 0x06, 0x06, 0xea, 0x35, 0x06, 0x80, 0x04, 0x1e, 0x9a, 0x3e, 0x1c, 0x03, 0x9c, 0x2a, 0x05, 0xd4, 0x31, 0x05, 0x6e, 0x0b, 0x06, 0x4a, 0x12, 0x06,
+  0x9c, 0x0b, 0x08, 0xd6, 0x18, 0x08, 0xea, 0x31, 0x07, 0x18, 0x40, 0x05, 0x54, 0x8e, 0x02, 0x54, 0x0f, 0x08, 0x8c, 0x1c, 0x04, 0x9e, 0x6a, 0x08, 0x68, 0x40, 0x07, 0x9a, 0x03, 0x07, 0x12, 0x00,
+  0x08, 0xb0, 0x23, 0x0a, 0x90, 0x4e, 0x00, 0xfe, 0x11, 0x04, 0x14, 0x12, 0x1e, 0x18, 0x10, 0x59, 0x09, 0xa0, 0x55, 0x04, 0x02, 0x00, 0x04, 0xb0, 0x0a, 0x02, 0x90, 0x03, 0x0f, 0x96, 0x03, 0x05,
+  0x01, 0x54, 0x0e, 0x0b, 0x02, 0x00, 0x1c, 0xfc, 0x90, 0x03, 0x04, 0xb4, 0x36, 0x09, 0x02, 0x00, 0x04, 0x46, 0x2a, 0x05, 0xb6, 0x15, 0x06, 0x94, 0x03, 0x0e, 0x9a, 0x18, 0x0e, 0x02, 0x00, 0x08,
+  0x8e, 0x03, 0x01, 0x0a, 0x23, 0x0c, 0xf2, 0x18, 0x0f, 0xc8, 0x0a, 0x06, 0x07, 0x42, 0x00, 0x15, 0xfb, 0x2e, 0x18, 0x1c, 0xba, 0xce, 0x2d, 0x0c, 0x24, 0x12, 0x07, 0x02, 0x27, 0x19, 0xdb, 0x90,
+  0x03, 0x0f, 0x10, 0x19, 0x03, 0x0c, 0x1e, 0x0e, 0x04, 0x52, 0x0a, 0x0e, 0x90, 0x03, 0x04, 0xd6, 0x03, 0x0f, 0xf4, 0x0d, 0x05, 0x05, 0x64, 0x26, 0x07, 0x02, 0x0b, 0x19, 0xdb, 0x88, 0x31, 0x0c,
+  0xca, 0x18, 0x0f, 0xf2, 0x06, 0x09, 0x0a, 0xa2, 0x5f, 0x08, 0x1a, 0x51, 0x08, 0xd6, 0x42, 0x15, 0x5a, 0x8e, 0x14, 0x06, 0xc4, 0x2e, 0x19, 0xba, 0x1e, 0x08, 0x0e, 0x74, 0x00, 0x04, 0xc2, 0x3c,
+  0x24, 0x9a, 0x95, 0x3c, 0x0e, 0x0b, 0x20, 0x0e, 0x0e, 0x8e, 0x03, 0x0d, 0xb8, 0x06, 0x07, 0xf2, 0x09, 0x07, 0x4e, 0x43, 0x02, 0xe4, 0x0b, 0x07, 0x4c, 0x5d, 0x03, 0x20, 0x19, 0x0e, 0x5a, 0x27,
+  0x09, 0x9c, 0x32, 0x07, 0xe0, 0x00, 0x0c, 0x14, 0x13, 0x03, 0xce, 0x0a, 0x09, 0xf2, 0x3b, 0x0a, 0xb0, 0x0a, 0x07, 0x58, 0x8e, 0x05, 0xb0, 0x0a, 0x04, 0x20, 0x08, 0x0e, 0x34, 0x4e, 0x0a, 0x40,
+  0x03, 0x02, 0xda, 0x06, 0x25, 0x59, 0x8d, 0xc2, 0x5c, 0x09, 0x08, 0x00, 0x1d, 0x59, 0x18, 0x07, 0x15, 0x19, 0x02, 0x00, 0x04, 0xa8, 0x4e, 0x0e, 0x54, 0x00, 0x03, 0x60, 0x15, 0x1e, 0xa5, 0x20,
+  0x07, 0x0e, 0x02, 0x00, 0x04, 0x36, 0x26, 0x04, 0xe8, 0x73, 0x0c, 0x20, 0x00, 0x1e, 0x1b, 0xb4, 0x03, 0x03, 0x70, 0x1c, 0x04, 0x90, 0x03, 0x06, 0x02, 0x00, 0x08, 0x5e, 0x07, 0x0f, 0x90, 0x03,
+  0x0b, 0x0f, 0x40, 0x0e, 0x0c, 0x0b, 0xec, 0x11, 0x0b, 0x90, 0x03, 0x0e, 0xc8, 0x18, 0x09, 0x5c, 0x02, 0x15, 0x9a, 0xb8, 0x1f, 0x0a, 0x36, 0x03, 0x08, 0x0e, 0x00, 0x0f, 0x90, 0x03, 0x0b, 0x06,
+  0xb6, 0x02, 0x02, 0xb6, 0x29, 0x0a, 0x02, 0x07, 0x0f, 0xe4, 0x18, 0x0f, 0x0a, 0xb6, 0x11, 0x07, 0xcc, 0x0a, 0x0b, 0x0a, 0x12, 0x0c, 0x82, 0x07, 0x0f, 0x8c, 0x0a, 0x05, 0x0e, 0xc0, 0x0d, 0x06,
+  0x60, 0x46, 0x0e, 0x02, 0x02, 0x09, 0xc2, 0x3f, 0x09, 0x02, 0x2e, 0x08, 0x74, 0x15, 0x04, 0xe8, 0x2e, 0x06, 0x4c, 0x12, 0x01, 0x38, 0x0e, 0x05, 0x6c, 0x00, 0x15, 0xba, 0xfc, 0x54, 0x0c, 0x78,
+  0x03, 0x0e, 0x76, 0x15, 0x06, 0x56, 0xe3, 0x06, 0xdc, 0x55, 0x08, 0x80, 0x18, 0x06, 0x40, 0x04, 0x0a, 0x2e, 0x5c, 0x04, 0xa6, 0x11, 0x0a, 0x86, 0x08, 0x02, 0x90, 0x11, 0x02, 0x60, 0x24, 0x1b,
+  0x79, 0xa6, 0x07, 0x08, 0xc6, 0x06, 0x16, 0x79, 0x14, 0x3c, 0x0a, 0xbe, 0x4e, 0x0b, 0xec, 0x6b, 0x04, 0x94, 0x03, 0x0e, 0x8e, 0x03, 0x06, 0x54, 0x0a, 0x03, 0xf8, 0x0d, 0x04, 0x72, 0x3c, 0x0c,
+  0x8c, 0x0a, 0x03, 0x28, 0x00, 0x0e, 0x56, 0x59, 0x0a, 0x38, 0x19, 0x15, 0x38, 0xaa, 0x5c, 0x0c, 0x92, 0x03, 0x0f, 0x86, 0x03, 0x0d, 0x13, 0x1c, 0xc8, 0x2d, 0x11, 0xfb, 0xbe, 0x1b, 0x04, 0x60,
+  0x77, 0x08, 0xec, 0x0d, 0x0a, 0xb2, 0x03, 0x0f, 0x34, 0x07, 0x05, 0x08, 0xa2, 0x0a, 0x08, 0x58, 0x23, 0x0c, 0x92, 0x03, 0x0b, 0x1a, 0x27, 0x03, 0x18, 0x07, 0x0f, 0x06, 0x07, 0x08, 0x0f, 0x18,
+  0x00, 0x0c, 0x09, 0xce, 0x18, 0x0a, 0x48, 0x03, 0x05, 0x1c, 0x23, 0x17, 0xba, 0x2c, 0x23, 0x16, 0xba, 0x10, 0x00, 0x09, 0x40, 0x39, 0x0f, 0x6c, 0x15, 0x05, 0x15, 0xba, 0xd8, 0x03, 0x0f, 0xc8,
+  0x18, 0x11, 0x06, 0xf6, 0x29, 0x02, 0xd8, 0x38, 0x06, 0xb8, 0x03, 0x06, 0xc4, 0x2a, 0x0e, 0x08, 0x00, 0x0b, 0x22, 0x63, 0x0e, 0xcc, 0x03, 0x0f, 0xc6, 0x1c, 0x09, 0x09, 0xac, 0x0a, 0x02, 0x7c,
+  0x10, 0x08, 0xb4, 0x51, 0x04, 0x0c, 0x00, 0x02, 0x2e, 0x07, 0x05, 0x1e, 0x15, 0x0f, 0x86, 0x0b, 0x06, 0x07, 0xe4, 0x14, 0x18, 0x9d, 0xf0, 0x14, 0x13, 0x7a, 0x4c, 0x0e, 0x0e, 0x94, 0x0e, 0x0a,
+  0xba, 0x15, 0x1b, 0xbb, 0x20, 0x1d, 0x03, 0x1e, 0x07, 0x06, 0xb4, 0x1c, 0x09, 0x9e, 0x0d, 0x06, 0x54, 0x4a, 0x05, 0xba, 0x18, 0x06, 0xfa, 0x38, 0x0e, 0xdc, 0x46, 0x0e, 0x8c, 0x4a, 0x0b, 0x00,
+  0x0e, 0x05, 0x7c, 0x0e, 0x2d, 0x9d, 0x79, 0x32, 0xb5, 0x04, 0xf6, 0x52, 0x04, 0x8e, 0x03, 0x07, 0xe0, 0x0d, 0x06, 0x8e, 0x03, 0x05, 0x48, 0x75, 0x06, 0xf6, 0x38, 0x07, 0x94, 0x03, 0x0e, 0x64,
+  0x03, 0x07, 0xb2, 0x11, 0x0e, 0x42, 0x80, 0x1e, 0x38, 0xe2, 0x20, 0x0f, 0x90, 0x03, 0x0e, 0x07, 0xf2, 0x37, 0x0d, 0x08, 0x00, 0x0f, 0x0e, 0x27, 0x0c, 0x06, 0x20, 0x7b, 0x07, 0xac, 0x11, 0x0b,
+  0x36, 0x23, 0x03, 0xee, 0x3b, 0x06, 0x84, 0x18, 0x04, 0x24, 0x2e, 0x1f, 0xdb, 0x2c, 0x0e, 0x19, 0x0f, 0xd6, 0x1f, 0x06, 0x0c, 0x14, 0x00, 0x03, 0x88, 0x09, 0x04, 0x86, 0x03, 0x06, 0x52, 0x0a,
+  0x07, 0xc0, 0x26, 0x05, 0xcc, 0x26, 0x0a, 0x1a, 0x00, 0x1d, 0x9d, 0xdc, 0x26, 0x09, 0x1e, 0x38, 0x0c, 0xa8, 0x06, 0x05, 0xbc, 0x10, 0x1a, 0x95, 0xb8, 0x34, 0x0a, 0x42, 0x38, 0x02, 0xc8, 0x2a,
+  0x06, 0x86, 0x35, 0x09, 0xae, 0x02, 0x09, 0x94, 0x18, 0x0a, 0xc2, 0x18, 0x0b, 0xc0, 0x14, 0x0c, 0xec, 0x3f, 0x07, 0xfc, 0x0a, 0x1f, 0xbb, 0x44, 0x0e, 0x01, 0x0d, 0x56, 0x43, 0x08, 0xa0, 0x03,
+  0x0a, 0x5e, 0x00, 0x2c, 0x79, 0x95, 0x60, 0x00, 0x0a, 0x40, 0x19, 0x04, 0x78, 0x07, 0x04, 0xc0, 0x51, 0x08, 0x1a, 0x2f, 0x0a, 0xcc, 0x00, 0x0e, 0x66, 0x0a, 0x04, 0x58, 0x00, 0x04, 0x94, 0x03,
+  0x06, 0x62, 0x18, 0x06, 0xe4, 0x2a, 0x0d, 0x60, 0x58, 0x1f, 0x95, 0x90, 0x03, 0x0d, 0x15, 0x79, 0x1a, 0x67, 0x11, 0x58, 0x02, 0x00, 0x03, 0x04, 0x0e, 0x0a, 0x2c, 0x5c, 0x05, 0x9e, 0x0a, 0x05,
+  0xe6, 0x38, 0x06, 0xa0, 0x43, 0x03, 0x34, 0x5c, 0x0f, 0x10, 0x24, 0x07, 0x05, 0x7a, 0x03, 0x01, 0xd4, 0x63, 0x0f, 0xa2, 0x20, 0x09, 0x08, 0x18, 0x40, 0x08, 0xb8, 0x3c, 0x08, 0xb6, 0x03, 0x06,
+  0xc6, 0x63, 0x0f, 0x90, 0x03, 0x13, 0x0f, 0x72, 0x03, 0x0b, 0x1f, 0xdb, 0x26, 0x00, 0x14, 0x0e, 0x92, 0x1f, 0x0f, 0x20, 0x00, 0x04, 0x0a, 0xb6, 0x11, 0x0f, 0x92, 0x03, 0x08, 0x0c, 0x96, 0x1c,
+  0x1e, 0xbb, 0x5e, 0x23, 0x0b, 0x18, 0x00, 0x0c, 0xa8, 0x03, 0x1f, 0xbb, 0x02, 0x00, 0x11, 0x09, 0x24, 0x39, 0x02, 0x60, 0x15, 0x0e, 0xc4, 0x17, 0x0f, 0x1a, 0x07, 0x08, 0x09, 0x86, 0x03, 0x08,
+  0xca, 0x3b, 0x04, 0x92, 0x03, 0x0a, 0x1c, 0x27, 0x0c, 0x88, 0x15, 0x0e, 0xc2, 0x0d, 0x0f, 0xf8, 0x0a, 0x0a, 0x03, 0xcc, 0x35, 0x19, 0xba, 0x26, 0x16, 0x07, 0x4c, 0x32, 0x0f, 0x26, 0x4e, 0x0e,
+  0x14, 0x59, 0x6c, 0x4e, 0x09, 0x66, 0x49, 0x15, 0x99, 0xce, 0x03, 0x06, 0x1c, 0x4e, 0x05, 0x72, 0x07, 0x0b, 0xb0, 0x2d, 0x06, 0x9a, 0x0f, 0x07, 0x0c, 0x04, 0x0e, 0x88, 0x03, 0x05, 0x50, 0x03,
+  0x06, 0x64, 0x51, 0x10, 0x9a, 0x60, 0x47, 0x0b, 0xa8, 0x2a, 0x08, 0xb4, 0x51, 0x08, 0xfc, 0x23, 0x08, 0x54, 0xe0, 0x0e, 0xfe, 0x14, 0x06, 0xec, 0x0a, 0x09, 0xba, 0x19, 0x06, 0x7a, 0x00, 0x04,
+  0x66, 0x76, 0x14, 0x9d, 0xb0, 0xf5, 0x08, 0x72, 0x1c, 0x0a, 0x1a, 0x67, 0x0f, 0x82, 0x0a, 0x01, 0x06, 0x98, 0x11, 0x07, 0xfe, 0x5f, 0x0e, 0x9e, 0x11, 0x03, 0x48, 0x67, 0x0b, 0x36, 0x40, 0x06,
+  0x4e, 0x00, 0x05, 0xae, 0x03, 0x06, 0xf6, 0x43, 0x0f, 0x90, 0x03, 0x27, 0x06, 0xc4, 0x1f, 0x0f, 0x90, 0x03, 0x21, 0x1f, 0xdb, 0x90, 0x03, 0x06, 0x0e, 0xd2, 0x11, 0x0f, 0x18, 0x07, 0x1f, 0x0e,
+  0x84, 0x2a, 0x0c, 0xa0, 0x03, 0x0f, 0x8e, 0x03, 0x14, 0x0f, 0x34, 0x0e, 0x07, 0x05, 0x48, 0x03, 0x0c, 0x5c, 0x07, 0x0e, 0x96, 0x03, 0x0c, 0xb4, 0x77, 0x0b, 0x02, 0x00, 0x06, 0x92, 0x03, 0x09,
+  0xa2, 0x3c, 0x16, 0xba, 0xc0, 0x2a, 0x0e, 0x90, 0x63, 0x0f, 0x52, 0x31, 0x08, 0x0e, 0x70, 0x12, 0x09, 0x3e, 0x27, 0x01, 0x1c, 0x15, 0x0a, 0x90, 0x51, 0x18, 0x5a, 0x4a, 0x0e, 0x07, 0x2e, 0x38,
+  0x08, 0xb2, 0x0d, 0x0c, 0x04, 0x19, 0x0e, 0x3c, 0x15, 0x0c, 0x7c, 0x20, 0x0e, 0x34, 0x24, 0x0e, 0x8e, 0x03, 0x0f, 0x02, 0x00, 0x05, 0x06, 0x52, 0x55, 0x03, 0x84, 0x60, 0x05, 0xb4, 0x07, 0x06,
+  0x94, 0x0a, 0x04, 0xd0, 0x1f, 0x08, 0x7a, 0x00, 0x0a, 0xdc, 0x59, 0x0e, 0x26, 0x21, 0x0c, 0xc4, 0x03, 0x04, 0x44, 0x00, 0x0e, 0x70, 0x5c, 0x09, 0x0e, 0x07, 0x0d, 0x02, 0x00, 0x06, 0xa4, 0x0a,
+  0x0a, 0x88, 0x03, 0x0c, 0x8e, 0x03, 0x06, 0x62, 0x47, 0x0a, 0x5e, 0x47, 0x08, 0xfa, 0x07, 0x06, 0xc6, 0x35, 0x1f, 0x39, 0x90, 0x03, 0x32, 0x0f, 0x26, 0x07, 0x03, 0x0c, 0x70, 0x03, 0x0f, 0xa6,
+  0x03, 0x15, 0x0d, 0xae, 0x03, 0x0f, 0x8a, 0x03, 0x18, 0x0e, 0x7e, 0x2a, 0x0e, 0xf8, 0x26, 0x0f, 0x8c, 0x03, 0x2b, 0x08, 0xf6, 0x03, 0x05, 0x06, 0x19, 0x0b, 0x66, 0x40, 0x08, 0x12, 0x00, 0x04,
+  0x4c, 0x63, 0x07, 0xba, 0x1f, 0x09, 0x8c, 0x03, 0x08, 0x7c, 0x26, 0x04, 0x06, 0x67, 0x0a, 0x7c, 0x03, 0x0f, 0x18, 0x07, 0x12, 0x0f, 0x60, 0x31, 0x06, 0x0c, 0x6a, 0x0a, 0x04, 0x9e, 0x54, 0x04,
+  0x1a, 0x23, 0x1c, 0x59, 0x2c, 0x55, 0x0b, 0x10, 0x0b, 0x04, 0xf0, 0x20, 0x06, 0xae, 0x11, 0x0a, 0xf6, 0x02, 0x0e, 0xbe, 0x11, 0x08, 0x68, 0x46, 0x08, 0xfa, 0x22, 0x08, 0xd4, 0x2a, 0x1f, 0x99,
+  0x8e, 0x03, 0x0c, 0x0d, 0xfa, 0x6d, 0x0b, 0x26, 0x2e, 0x0f, 0x80, 0x51, 0x07, 0x0a, 0x86, 0x11, 0x04, 0x80, 0x0e, 0x0f, 0x30, 0x00, 0x01, 0x0a, 0x5c, 0xf2, 0x08, 0x34, 0x43, 0x0e, 0xfa, 0x14,
+  0x0b, 0x20, 0x6e, 0x03, 0xd0, 0x11, 0x06, 0x64, 0x00, 0x0f, 0x88, 0x15, 0x09, 0x1a, 0x38, 0x1e, 0x32, 0x03, 0xe0, 0x43, 0x06, 0x90, 0x03, 0x0a, 0x14, 0x20, 0x1f, 0x38, 0x90, 0x03, 0x2e, 0x08,
+  0x3c, 0x2a, 0x0e, 0x3e, 0x0e, 0x0a, 0x7e, 0x23, 0x0f, 0x8a, 0x03, 0x13, 0x0a, 0x64, 0x2a, 0x0f, 0x16, 0x07, 0x25, 0x0e, 0x4c, 0x03, 0x0f, 0x12, 0x07, 0x2b, 0x0a, 0x94, 0x03, 0x0f, 0xd4, 0x0a,
+  0x09, 0x0a, 0xe0, 0x0a, 0x08, 0x20, 0x44, 0x05, 0x3c, 0x07, 0x0c, 0x04, 0x4a, 0x00, 0x0e, 0x00, 0x0f, 0x76, 0x03, 0x1f, 0x0f, 0xec, 0x1f, 0x0e, 0x0e, 0x64, 0x18, 0x07, 0x6e, 0x55, 0x15, 0x8d,
+  0xf4, 0x58, 0x09, 0x7a, 0x4a, 0x02, 0x1c, 0x59, 0x0e, 0x5c, 0x20, 0x0b, 0xf4, 0x46, 0x0d, 0x7c, 0x00, 0x1f, 0x79, 0x26, 0x07, 0x01, 0x03, 0x2a, 0x51, 0x06, 0x42, 0x58, 0x0e, 0x8a, 0x03, 0x0b,
+  0x18, 0x19, 0x0f, 0xd6, 0x02, 0x04, 0x0f, 0xf0, 0x02, 0x04, 0x0e, 0x88, 0x03, 0x0f, 0x02, 0x00, 0x0f, 0x09, 0xd0, 0x4d, 0x1d, 0x79, 0x40, 0x00, 0x15, 0x58, 0x68, 0x03, 0x1f, 0x59, 0x8c, 0x00,
+  0x14, 0x0f, 0xb6, 0x00, 0x05, 0x0b, 0x02, 0x00, 0x02, 0x44, 0x72, 0x05, 0x9a, 0x0a, 0x01, 0xe6, 0x0a, 0x07, 0xa8, 0x0a, 0x04, 0x02, 0x00, 0x0f, 0x3c, 0x0e, 0x2b, 0x08, 0x5a, 0x23, 0x1d, 0xdb,
+  0xb4, 0x11, 0x0e, 0xc0, 0x11, 0x0e, 0x1a, 0x47, 0x0e, 0x02, 0x00, 0x0f, 0xb0, 0x0a, 0x1b, 0x15, 0xba, 0x08, 0x00, 0x0f, 0x86, 0x03, 0x2d, 0x0e, 0xf6, 0x1f, 0x0f, 0xb4, 0x0a, 0x0f, 0x04, 0x36,
+  0x00, 0x0f, 0x02, 0x00, 0x07, 0x0a, 0xfa, 0x06, 0x05, 0x8a, 0x15, 0x0e, 0xb6, 0x0a, 0x0f, 0x90, 0x03, 0x44, 0x0c, 0x58, 0x0a, 0x0e, 0x3a, 0x00, 0x0f, 0xde, 0x2e, 0x15, 0x19, 0x7a, 0x6a, 0x00,
+  0x0e, 0xea, 0x1f, 0x0e, 0xf0, 0x3f, 0x0c, 0x1e, 0x2b, 0x0f, 0xf0, 0x5b, 0x03, 0x02, 0xe8, 0x6d, 0x07, 0xe2, 0x3f, 0x0f, 0xc8, 0x31, 0x0e, 0x08, 0x38, 0x03, 0x0f, 0x02, 0x00, 0x19, 0x0e, 0x00,
+  0x07, 0x02, 0xf4, 0x11, 0x0f, 0x32, 0x00, 0x08, 0x0d, 0x0a, 0x64, 0x0f, 0x24, 0x00, 0x07, 0x1e, 0x79, 0x24, 0x00, 0x0a, 0xc0, 0x03, 0x0b, 0x84, 0x03, 0x0a, 0x02, 0x00, 0x0f, 0x90, 0x03, 0x23,
+  0x1f, 0xdb, 0x8e, 0x03, 0x07, 0x0e, 0x14, 0x23, 0x09, 0xaa, 0x03, 0x02, 0x10, 0x40, 0x0c, 0xb8, 0x38, 0x0d, 0x78, 0x03, 0x0e, 0xb0, 0x03, 0x0f, 0x3e, 0x0e, 0x30, 0x0f, 0x92, 0x03, 0x19, 0x0f,
+  0xbc, 0x03, 0x19, 0x0f, 0x7e, 0x03, 0x01, 0x0f, 0x0c, 0x00, 0x05, 0x0c, 0x0e, 0x00, 0x0e, 0x7c, 0x2a, 0x0f, 0x02, 0x00, 0x7d, 0x0d, 0xd0, 0x03, 0x05, 0x48, 0x2e, 0x0b, 0x90, 0x03, 0x09, 0xe8,
+  0x0a, 0x0a, 0x2c, 0x5c, 0x02, 0x2e, 0x27, 0x03, 0x5e, 0x1c, 0x07, 0x40, 0x15, 0x0e, 0xda, 0x06, 0x0a, 0xde, 0x02, 0x07, 0xe6, 0x18, 0x0a, 0x18, 0x67, 0x0c, 0x22, 0x03, 0x1f, 0x95, 0x92, 0x03,
+  0x1c, 0x0d, 0x8c, 0x03, 0x0c, 0x90, 0x03, 0x0e, 0x74, 0x03, 0x0f, 0xe6, 0x03, 0x0f, 0x0f, 0x1e, 0x04, 0x05, 0x17, 0x58, 0xa0, 0x55, 0x0a, 0x76, 0x03, 0x0f, 0x94, 0x03, 0x07, 0x0f, 0x90, 0x03,
+  0x2f, 0x0e, 0x1c, 0x07, 0x0e, 0x0e, 0x0e, 0x0b, 0xd2, 0x1f, 0x0f, 0x12, 0x07, 0x0d, 0x0f, 0xd0, 0x11, 0x3a, 0x1e, 0xbb, 0x40, 0x07, 0x0f, 0xc8, 0x11, 0x28, 0x18, 0xbb, 0x6c, 0x11, 0x0f, 0x02,
+  0x00, 0x10, 0x08, 0x0c, 0x47, 0x0e, 0xa8, 0x03, 0x0d, 0xb6, 0x03, 0x0b, 0xea, 0x34, 0x0e, 0xa8, 0x3c, 0x0c, 0xc8, 0x03, 0x09, 0xf0, 0x03, 0x09, 0xb0, 0x1c, 0x02, 0x44, 0x00, 0x07, 0x6c, 0x00,
+  0x06, 0x30, 0x1d, 0x07, 0x12, 0x40, 0x0f, 0x92, 0x03, 0x0b, 0x0c, 0x02, 0x27, 0x0e, 0x60, 0x07, 0x0a, 0x90, 0x03, 0x0a, 0x94, 0x67, 0x0f, 0x02, 0x00, 0x0f, 0x04, 0x14, 0x07, 0x07, 0x1e, 0x0e,
+  0x08, 0xf2, 0x31, 0x07, 0x86, 0x03, 0x06, 0xdc, 0x60, 0x07, 0x02, 0x00, 0x0e, 0xa0, 0x07, 0x0c, 0x94, 0x20, 0x08, 0xea, 0x26, 0x0a, 0x3a, 0x00, 0x2f, 0x8d, 0x59, 0x02, 0x00, 0x32, 0x01, 0x8e,
+  0x75, 0x05, 0xda, 0x03, 0x0c, 0x02, 0x00, 0x06, 0x90, 0x95, 0x08, 0x90, 0x80, 0x0f, 0x90, 0x03, 0x20, 0x06, 0x0c, 0x47, 0x0e, 0x18, 0x0e, 0x0e, 0x12, 0x00, 0x2d, 0x9d, 0xdb, 0x8c, 0x0a, 0x0f,
+  0xac, 0x0a, 0x05, 0x0f, 0x42, 0x0e, 0x0d, 0x0a, 0x5e, 0x2e, 0x0e, 0x90, 0x03, 0x06, 0x46, 0x3c, 0x00, 0x3c, 0x31, 0x02, 0x06, 0x00, 0x0e, 0x46, 0x31, 0x06, 0x7c, 0x11, 0x17, 0xba, 0x20, 0x00,
+  0x0f, 0x9c, 0x1c, 0x01, 0x06, 0xa6, 0x0a, 0x0f, 0xd0, 0x03, 0x03, 0x07, 0xca, 0x02, 0x0f, 0x88, 0x03, 0x1a, 0x0f, 0xbc, 0x0a, 0x05, 0x0f, 0x14, 0x00, 0x0c, 0x0d, 0x8c, 0x03, 0x0f, 0x42, 0x07,
+  0x03, 0x0f, 0x16, 0x0b, 0x05, 0x0b, 0xcc, 0x11, 0x0f, 0x80, 0x07, 0x28, 0x1a, 0x7a, 0x60, 0x39, 0x0d, 0x3a, 0x07, 0x04, 0x30, 0x03, 0x13, 0x9a, 0x72, 0x0e, 0x14, 0x7a, 0x3a, 0x11, 0x0f, 0x2c,
+  0x43, 0x04, 0x0f, 0x0a, 0x63, 0x05, 0x08, 0x02, 0x2b, 0x0e, 0xd6, 0x11, 0x0c, 0x90, 0x03, 0x19, 0x9a, 0x78, 0x67, 0x0e, 0xb4, 0x03, 0x0a, 0xbc, 0x03, 0x0b, 0xbe, 0x03, 0x0e, 0x76, 0x07, 0x0f,
+  0xa2, 0x0a, 0x0f, 0x1e, 0x95, 0xaa, 0x0a, 0x0a, 0xde, 0x18, 0x13, 0x58, 0x08, 0x07, 0x0e, 0x8a, 0x03, 0x03, 0xaa, 0x75, 0x06, 0x22, 0x20, 0x0b, 0x8c, 0x03, 0x19, 0x58, 0x34, 0x07, 0x05, 0x90,
+  0x03, 0x1f, 0x9d, 0x02, 0x00, 0x0a, 0x0e, 0x92, 0x03, 0x0a, 0x14, 0x00, 0x0b, 0x30, 0x00, 0x0a, 0xa2, 0x55, 0x05, 0x28, 0x4e, 0x08, 0x90, 0x0a, 0x0b, 0x02, 0x00, 0x1f, 0xda, 0x9c, 0x03, 0x08,
+  0x02, 0x70, 0x68, 0x08, 0x76, 0x03, 0x06, 0x0a, 0x00, 0x0f, 0x02, 0x00, 0x05, 0x0f, 0xba, 0x1b, 0x01, 0x0f, 0x30, 0x00, 0x0a, 0x01, 0xd0, 0x02, 0x13, 0xda, 0x02, 0x00, 0x1f, 0xba, 0x02, 0x00,
+  0x2e, 0x1f, 0x9a, 0x98, 0x03, 0x14, 0x0f, 0x02, 0x00, 0x15, 0x0f, 0x32, 0x00, 0x07, 0x1f, 0xba, 0x9e, 0x0a, 0x40, 0x0e, 0x06, 0x07, 0x02, 0x8c, 0x02, 0x15, 0x99, 0x02, 0x00, 0x1f, 0x79, 0x02,
+  0x00, 0x13, 0x0f, 0xcc, 0x18, 0x0a, 0x04, 0x9c, 0x35, 0x08, 0xc2, 0x2a, 0x04, 0xa6, 0x71, 0x0f, 0x5a, 0x00, 0x0d, 0x0e, 0x56, 0x0a, 0x07, 0x36, 0x47, 0x0f, 0x6c, 0x0a, 0x10, 0x0e, 0x6a, 0x83,
+  0x0f, 0x2a, 0x00, 0x0b, 0x04, 0x56, 0x03, 0x0c, 0x02, 0x00, 0x04, 0x10, 0x72, 0x1e, 0x38, 0xe6, 0x18, 0x0a, 0xa0, 0x9c, 0x0e, 0xf4, 0x7c, 0x0d, 0x20, 0x07, 0x15, 0x39, 0x20, 0x32, 0x0f, 0x60,
+  0x15, 0x1f, 0x2d, 0xdb, 0x9d, 0x10, 0x00, 0x0e, 0x90, 0x03, 0x07, 0x94, 0x03, 0x0f, 0x8a, 0x31, 0x11, 0x0f, 0xcc, 0x11, 0x09, 0x08, 0x0e, 0x07, 0x06, 0x7e, 0x35, 0x06, 0x0c, 0x00, 0x0f, 0xe6,
+  0x29, 0x07, 0x0f, 0x84, 0x31, 0x09, 0x0a, 0xf2, 0x06, 0x06, 0x84, 0x60, 0x06, 0x0c, 0x07, 0x06, 0xb4, 0x11, 0x0f, 0x90, 0x03, 0x3b, 0x0c, 0xe2, 0x06, 0x0f, 0x3a, 0x03, 0x1f, 0x1f, 0xba, 0x8e,
+  0x11, 0x12, 0x0f, 0x12, 0x12, 0x35, 0x04, 0x08, 0x03, 0x04, 0x78, 0x12, 0x0f, 0x88, 0x03, 0x0e, 0x0f, 0x8e, 0x03, 0x09, 0x1a, 0x8d, 0x7e, 0x03, 0x03, 0x66, 0x4e, 0x0f, 0x02, 0x00, 0x1c, 0x0f,
+  0x60, 0x0a, 0x2b, 0x1f, 0x39, 0xa8, 0x0a, 0x34, 0x01, 0x12, 0x07, 0x07, 0xbe, 0x7c, 0x0e, 0x8e, 0x03, 0x0a, 0xf8, 0x06, 0x1f, 0x38, 0x8a, 0x03, 0x02, 0x0e, 0x02, 0x00, 0x1f, 0xfc, 0x50, 0x15,
+  0x1d, 0x0f, 0x1e, 0x15, 0x3a, 0x0f, 0x10, 0x0e, 0x13, 0x1f, 0xdb, 0xf2, 0x14, 0x17, 0x0f, 0x16, 0x0e, 0x21, 0x09, 0x96, 0x2a, 0x0f, 0xbe, 0x11, 0x09, 0x0e, 0xca, 0x11, 0x02, 0x3e, 0x5c, 0x0f,
+  0x02, 0x00, 0x13, 0x0f, 0x7a, 0x11, 0x46, 0x0a, 0xa4, 0x15, 0x1f, 0x8d, 0x80, 0x0a, 0x09, 0x0f, 0x90, 0x03, 0x0f, 0x0b, 0xf6, 0x09, 0x0f, 0x02, 0x00, 0x0e, 0x15, 0x79, 0x5a, 0x87, 0x0f, 0x02,
+  0x00, 0x0d, 0x07, 0x72, 0x18, 0x0b, 0x8e, 0x51, 0x08, 0x6e, 0x3c, 0x0f, 0x80, 0x11, 0x09, 0x0d, 0x12, 0x00, 0x0f, 0xce, 0x11, 0x0c, 0x03, 0x2a, 0x0a, 0x03, 0xc2, 0x3f, 0x07, 0x08, 0x00, 0x0b,
+  0xf4, 0x14, 0x08, 0x90, 0x18, 0x07, 0x22, 0x00, 0x0b, 0x10, 0x92, 0x0a, 0x40, 0x4b, 0x06, 0x14, 0x0e, 0x0a, 0x02, 0x00, 0x0e, 0x00, 0x84, 0x0f, 0x86, 0x03, 0x11, 0x06, 0x02, 0x00, 0x0f, 0x14,
+  0x1c, 0x0d, 0x0d, 0x1e, 0x00, 0x0a, 0x06, 0x15, 0x0f, 0xe2, 0x34, 0x04, 0x0f, 0x02, 0x00, 0x37, 0x0f, 0x22, 0x15, 0x19, 0x0f, 0x8e, 0x03, 0x1d, 0x1a, 0x9b, 0xa0, 0x2a, 0x1e, 0x9d, 0x20, 0x00,
+  0x1f, 0x9b, 0x9e, 0x31, 0x0e, 0x0f, 0x7e, 0x03, 0x09, 0x0f, 0x90, 0x03, 0x54, 0x0c, 0x9e, 0x03, 0x0f, 0x9c, 0x47, 0x17, 0x09, 0x28, 0x40, 0x04, 0x02, 0x00, 0x0f, 0x92, 0x03, 0x19, 0x0f, 0x2a,
+  0x00, 0x0f, 0x0c, 0xda, 0x06, 0x1b, 0x7a, 0xa2, 0x0a, 0x2f, 0x5a, 0x8d, 0x02, 0x00, 0x09, 0x1f, 0x59, 0x12, 0x07, 0x26, 0x06, 0x1e, 0x23, 0x1e, 0x39, 0x36, 0x03, 0x09, 0x3e, 0x03, 0x08, 0xd6,
+  0x0d, 0x0e, 0x3c, 0x3c, 0x0b, 0xce, 0x3f, 0x2d, 0x8d, 0x59, 0xfe, 0x06, 0x06, 0x5a, 0x1c, 0x08, 0x60, 0x1c, 0x0f, 0x02, 0x00, 0x25, 0x0e, 0x92, 0x0a, 0x0e, 0x3c, 0x5f, 0x2f, 0xdb, 0x9d, 0x02,
+  0x00, 0x71, 0x02, 0x92, 0x11, 0x0e, 0x7e, 0x0a, 0x0c, 0xa4, 0x0a, 0x0f, 0x36, 0x3c, 0x13, 0x0f, 0xa2, 0x11, 0x11, 0x01, 0x1a, 0x11, 0x0e, 0x68, 0x0a, 0x0f, 0x6c, 0x0a, 0x28, 0x0f, 0x18, 0x03,
+  0x0f, 0x0f, 0x2e, 0x03, 0x0d, 0x1a, 0x99, 0x16, 0x00, 0x3f, 0x8d, 0x99, 0x95, 0x02, 0x00, 0x0c, 0x0f, 0xda, 0x1c, 0x0d, 0x09, 0x06, 0x1d, 0x0e, 0x98, 0x0a, 0x0f, 0x02, 0x00, 0x3f, 0x19, 0x59,
+  0xf4, 0x14, 0x1f, 0x59, 0x02, 0x00, 0x42, 0x05, 0x76, 0x80, 0x0f, 0x8c, 0x03, 0x08, 0x0e, 0xea, 0x14, 0x0e, 0x90, 0x03, 0x08, 0xe4, 0x06, 0x05, 0x6a, 0x35, 0x0b, 0x96, 0x11, 0x0f, 0x02, 0x00,
+  0x03, 0x0f, 0x90, 0x03, 0x25, 0x0c, 0x80, 0x11, 0x0f, 0xf4, 0x0d, 0x07, 0x1f, 0xda, 0x76, 0x03, 0x58, 0x0c, 0xee, 0x1f, 0x1f, 0xdb, 0x0a, 0x0e, 0x11, 0x09, 0xbc, 0x5a, 0x0f, 0x8e, 0x03, 0x0c,
+  0x0f, 0x0c, 0x0e, 0x16, 0x0c, 0x52, 0x11, 0x09, 0xcc, 0x14, 0x0e, 0x70, 0x11, 0x0e, 0xae, 0x06, 0x0f, 0x8e, 0x0a, 0x33, 0x07, 0x60, 0x11, 0x0c, 0x20, 0x4a, 0x08, 0x50, 0x14, 0x06, 0xec, 0x03,
+  0x08, 0x8a, 0x3f, 0x0f, 0x3a, 0x55, 0x0e, 0x1f, 0x8d, 0xce, 0x51, 0x07, 0x0f, 0x72, 0x03, 0x29, 0x0e, 0x1e, 0x00, 0x0f, 0x88, 0x03, 0x1f, 0x0f, 0x68, 0x55, 0x0b, 0x0e, 0x10, 0x0e, 0x16, 0x38,
+  0x68, 0x9c, 0x09, 0xbe, 0x06, 0x0f, 0x5a, 0x0a, 0x05, 0x0a, 0xde, 0x0d, 0x08, 0x16, 0x07, 0x06, 0x64, 0x11, 0x0f, 0x02, 0x00, 0x17, 0x1f, 0x58, 0x20, 0x07, 0x2f, 0x0e, 0x60, 0x15, 0x0f, 0x9c,
+  0x03, 0x0c, 0x0f, 0xb2, 0x03, 0x09, 0x0f, 0xb4, 0x03, 0x11, 0x0a, 0x02, 0x51, 0x19, 0xba, 0x16, 0x00, 0x1e, 0xdb, 0xf2, 0x06, 0x0f, 0x5a, 0x03, 0x2c, 0x1f, 0xbb, 0x02, 0x00, 0x0a, 0x1d, 0x9b,
+  0xe0, 0x26, 0x0e, 0x0c, 0x07, 0x0a, 0x70, 0x03, 0x08, 0x88, 0x03, 0x0f, 0x78, 0x06, 0x17, 0x0e, 0x88, 0x23, 0x05, 0x34, 0x27, 0x1f, 0x95, 0x02, 0x00, 0x9f, 0x06, 0x50, 0x0a, 0x0e, 0x62, 0x11,
+  0x0f, 0x02, 0x00, 0x4c, 0x06, 0x0a, 0x0e, 0x06, 0xee, 0x0d, 0x0d, 0x94, 0x26, 0x0f, 0x84, 0x03, 0x0d, 0x0e, 0x18, 0x2e, 0x0f, 0x02, 0x00, 0x21, 0x0f, 0x74, 0x03, 0x27, 0x1e, 0x18, 0x0a, 0x00,
+  0x0b, 0x20, 0x07, 0x0f, 0x02, 0x00, 0x26, 0x1d, 0x95, 0x2a, 0x75, 0x0e, 0x34, 0x75, 0x0d, 0x8c, 0x5f, 0x0e, 0xd6, 0x69, 0x06, 0x5c, 0x4a, 0x1f, 0xba, 0x96, 0x11, 0x12, 0x05, 0xc2, 0xa2, 0x1e,
+  0x9d, 0x80, 0x03, 0x08, 0x0a, 0x00, 0x0f, 0x88, 0x03, 0x07, 0x06, 0xd6, 0x0d, 0x09, 0x74, 0x03, 0x17, 0x8d, 0x2e, 0x03, 0x03, 0xda, 0x38, 0x05, 0x06, 0x2e, 0x01, 0x50, 0x00, 0x06, 0xb2, 0x06,
+  0x1d, 0xba, 0x24, 0x0e, 0x03, 0x3e, 0xbb, 0x09, 0x80, 0x03, 0x0d, 0x1c, 0x8e, 0x0c, 0x50, 0x2e, 0x0f, 0x0c, 0x03, 0x1b, 0x0c, 0x30, 0x00, 0x0f, 0x6e, 0x83, 0x0f, 0x0f, 0x6c, 0x03, 0x26, 0x03,
+  0xf6, 0x31, 0x0f, 0x20, 0x00, 0x0c, 0x1f, 0x5a, 0x6a, 0x03, 0x34, 0x0e, 0x04, 0x07, 0x0f, 0x68, 0x03, 0x18, 0x0f, 0x8c, 0x03, 0x12, 0x19, 0x59, 0x80, 0x03, 0x0f, 0xa2, 0x0a, 0x07, 0x0a, 0x02,
+  0x47, 0x0f, 0x94, 0x03, 0x2f, 0x06, 0x24, 0x72, 0x0b, 0x4e, 0xb9, 0x06, 0x98, 0x3c, 0x07, 0x0a, 0x00, 0x0e, 0xb4, 0x3b, 0x0b, 0x10, 0x00, 0x0b, 0x92, 0x6d, 0x09, 0x14, 0x6a, 0x07, 0xe8, 0x74,
+  0x09, 0x30, 0x00, 0x02, 0x8a, 0x03, 0x03, 0x44, 0x2d, 0x0d, 0x68, 0x71, 0x0b, 0x92, 0x06, 0x17, 0xdb, 0x3a, 0x03, 0x1e, 0xdb, 0x9c, 0x2d, 0x0b, 0x02, 0x00, 0x0e, 0x44, 0x11, 0x0c, 0x36, 0x11,
+  0x1b, 0x9b, 0x72, 0x03, 0x08, 0x82, 0x03, 0x2e, 0xbb, 0x95, 0xc8, 0x06, 0x61, 0xba, 0x8d, 0xba, 0x95, 0xba, 0x8d, 0x08, 0x00, 0x0e, 0xcc, 0x06, 0x01, 0x06, 0x00, 0x06, 0x70, 0x03, 0x0e, 0x36,
+  0x35, 0x0e, 0x0a, 0x07, 0x0c, 0x72, 0x03, 0x0a, 0xf0, 0x38, 0x04, 0xc2, 0x54, 0x08, 0x0c, 0x00, 0x0e, 0x96, 0x86, 0x0e, 0x36, 0x83, 0x0e, 0xb4, 0x35, 0x0e, 0xb8, 0x7f, 0x0e, 0xd6, 0x35, 0x0e,
+  0x72, 0x0a, 0x0b, 0x78, 0x11, 0x05, 0xa2, 0x14, 0x0f, 0x36, 0x87, 0x15, 0x08, 0x2c, 0x00, 0x04, 0x0c, 0x00, 0x0a, 0x9e, 0x03, 0x0d, 0xd2, 0x03, 0x07, 0xb8, 0x03, 0x06, 0x32, 0x92, 0x04, 0x0e,
+  0x00, 0x0f, 0x0a, 0x0e, 0x0e, 0x12, 0x85, 0x04, 0x00, 0x06, 0xe8, 0x54, 0x11, 0x79, 0x14, 0x07, 0x02, 0x64, 0x51, 0x19, 0x58, 0x66, 0x0a, 0x0e, 0x02, 0x00, 0x02, 0xb2, 0x0a, 0x0a, 0xb6, 0x9f,
+  0x08, 0x04, 0x1c, 0x10, 0x39, 0x14, 0xce, 0x05, 0x0a, 0x00, 0x04, 0x82, 0x03, 0x14, 0x18, 0x28, 0x4e, 0x03, 0x04, 0x00, 0x13, 0x38, 0x4e, 0x3c, 0x02, 0x32, 0x4e, 0x1a, 0x18, 0x4a, 0x03, 0x18,
+  0x7d, 0x40, 0x15, 0x0a, 0x7c, 0x55, 0x04, 0xe4, 0x58, 0x07, 0x9a, 0x6e, 0x01, 0x40, 0x00, 0x02, 0x94, 0x55, 0x16, 0x38, 0x42, 0x79, 0x12, 0x7d, 0x20, 0x00, 0x00, 0x5e, 0x00, 0x08, 0x52, 0x4d,
+  0x0a, 0x54, 0x0a, 0x09, 0x00, 0x2a, 0x06, 0x44, 0xb3, 0x04, 0xb2, 0x69, 0x03, 0x8e, 0x74, 0x02, 0x94, 0x03, 0x0a, 0xd4, 0x69, 0x04, 0x8a, 0x03, 0x0a, 0x8c, 0x03, 0x0f, 0x96, 0x03, 0x09, 0x14,
+  0xdb, 0x6e, 0x03, 0x1f, 0x8d, 0xb8, 0x03, 0x07, 0x02, 0xb8, 0x6d, 0x08, 0x0c, 0x00, 0x0c, 0x34, 0x0a, 0x0c, 0xc8, 0x14, 0x0e, 0xd6, 0x14, 0x0e, 0xcc, 0x1b, 0x0c, 0x54, 0x03, 0x29, 0xba, 0x95,
+  0x22, 0x07, 0x0a, 0xd4, 0x3f, 0x0e, 0xd8, 0x38, 0x0c, 0x5e, 0x3c, 0x09, 0xcc, 0x7b, 0x08, 0x44, 0x78, 0x0e, 0x5c, 0x03, 0x0f, 0xa4, 0x86, 0x11, 0x0e, 0x30, 0x39, 0x0a, 0x52, 0x03, 0x0f, 0x58,
+  0x11, 0x31, 0x02, 0x88, 0x00, 0x02, 0x50, 0x1f, 0x0a, 0x56, 0x00, 0x04, 0x62, 0x91, 0x0c, 0x50, 0x0e, 0x0c, 0x0c, 0x00, 0x0e, 0x32, 0x07, 0x04, 0x2e, 0x18, 0x05, 0x08, 0x44, 0x09, 0x58, 0x18,
+  0x04, 0x30, 0xa3, 0x01, 0x66, 0x03, 0x0e, 0x8a, 0x0a, 0x0d, 0xfe, 0x06, 0x06, 0x3e, 0x03, 0x02, 0x9e, 0x03, 0x15, 0x18, 0x24, 0x31, 0x1b, 0x18, 0x86, 0x0a, 0x0a, 0xa4, 0x11, 0x0f, 0xf0, 0x14,
+  0x03, 0x0c, 0xd6, 0x06, 0x04, 0x90, 0x03, 0x03, 0x36, 0x03, 0x09, 0xc6, 0x6a, 0x05, 0x66, 0x03, 0x02, 0xe0, 0x06, 0x00, 0x12, 0x00, 0x04, 0x02, 0x00, 0x07, 0x80, 0x03, 0x17, 0x38, 0x7e, 0x03,
+  0x01, 0x5e, 0x00, 0x03, 0x0c, 0x00, 0x01, 0x26, 0x00, 0x01, 0x2e, 0x00, 0x03, 0x4c, 0x00, 0x03, 0x86, 0x03, 0x00, 0x18, 0x00, 0x22, 0xf8, 0x7c, 0x0c, 0x00, 0x06, 0x48, 0x79, 0x02, 0x02, 0x00,
+  0x1f, 0xdb, 0xec, 0x37, 0x0c, 0x17, 0xba, 0xb6, 0x54, 0x06, 0x18, 0x51, 0x04, 0xfc, 0x42, 0x00, 0x70, 0x26, 0x06, 0x76, 0x26, 0x00, 0x0c, 0x00, 0x0c, 0x16, 0x1f, 0x19, 0x9a, 0xc4, 0x69, 0x1e,
+  0xba, 0xac, 0x0d, 0x01, 0x14, 0x07, 0x04, 0xfe, 0x09, 0x00, 0x7c, 0x9a, 0x0b, 0xb0, 0x0d, 0x1b, 0x8d, 0x02, 0x00, 0x16, 0x95, 0xc8, 0x06, 0x01, 0x0e, 0x00, 0x0f, 0xcc, 0x22, 0x0e, 0x04, 0x30,
+  0x07, 0x0f, 0x68, 0x14, 0x15, 0x09, 0xbc, 0x3f, 0x0f, 0x7a, 0x31, 0x0a, 0x0f, 0x92, 0x06, 0x05, 0x0f, 0x02, 0x00, 0x19, 0x20, 0x79, 0x85, 0x02, 0x00, 0x06, 0x0e, 0x00, 0x1f, 0x9a, 0x22, 0x00,
+  0x08, 0x08, 0x2a, 0x00, 0x0f, 0x60, 0x00, 0x16, 0x0b, 0x40, 0x03, 0x08, 0x6c, 0x11, 0x15, 0x7a, 0x5a, 0xa6, 0x0f, 0x4c, 0x2d, 0x0d, 0x06, 0x30, 0x39, 0x0f, 0x2c, 0x0a, 0x0d, 0x1a, 0x79, 0x10,
+  0x00, 0x0f, 0x64, 0x03, 0x02, 0x17, 0x58, 0x6a, 0x03, 0x0f, 0x90, 0x18, 0x0b, 0x13, 0x59, 0x24, 0x4a, 0x05, 0x44, 0x8a, 0x03, 0x0c, 0x4a, 0x02, 0xfa, 0x22, 0x00, 0x20, 0x23, 0x0f, 0xd6, 0x0d,
+  0x2d, 0x04, 0x9c, 0x06, 0x0c, 0xbc, 0x6a, 0x0a, 0x60, 0x5c, 0x0f, 0x02, 0x00, 0x17, 0x17, 0xf7, 0x02, 0x60, 0x00, 0x90, 0xb5, 0x02, 0x06, 0x00, 0x20, 0xf7, 0x74, 0x02, 0x00, 0x02, 0x22, 0xd2,
+  0x02, 0x08, 0x00, 0x01, 0x18, 0x00, 0x58, 0x74, 0x18, 0x7d, 0xf7, 0x74, 0xd4, 0x03, 0x3d, 0x39, 0x85, 0x9a, 0x0e, 0x0a, 0x08, 0xe4, 0x3e, 0x0c, 0x7e, 0x7a, 0x1b, 0x79, 0xda, 0x8f, 0x02, 0x22,
+  0x17, 0x08, 0x0c, 0x09, 0x0c, 0x1c, 0x09, 0x13, 0x9a, 0xa2, 0x85, 0x0f, 0xae, 0x02, 0x03, 0x0e, 0x3e, 0x5e, 0x0f, 0xde, 0x13, 0x08, 0x16, 0x85, 0x02, 0x00, 0x16, 0x59, 0x0c, 0x00, 0x0e, 0x22,
+  0x00, 0x05, 0x16, 0x00, 0x04, 0xa4, 0x05, 0x0a, 0xba, 0x49, 0x08, 0x14, 0x3f, 0x0f, 0x6e, 0x94, 0x09, 0x06, 0x2e, 0x98, 0x08, 0xa0, 0x09, 0x0c, 0xd8, 0x0c, 0x09, 0x18, 0x06, 0x09, 0x10, 0x00,
+  0x01, 0x0c, 0x00, 0x22, 0x85, 0x5a, 0x9a, 0xdb, 0x01, 0x04, 0x00, 0x17, 0x59, 0x08, 0x00, 0x0a, 0x02, 0x00, 0x04, 0xd6, 0x00, 0x0f, 0x02, 0x00, 0x1f, 0x05, 0xe4, 0x9e, 0x07, 0xe0, 0x4c, 0x0f,
+  0xe2, 0x10, 0x19, 0x0e, 0x60, 0x0d, 0x0a, 0xfc, 0x09, 0x0f, 0xd6, 0x10, 0x0d, 0x08, 0xd6, 0x37, 0x0a, 0x0a, 0x00, 0x09, 0x9c, 0x06, 0x1e, 0x7d, 0x0a, 0x00, 0x1a, 0x18, 0xd0, 0x10, 0x07, 0x66,
+  0x06, 0x04, 0x84, 0x06, 0x03, 0x10, 0x03, 0x14, 0x85, 0xe8, 0x09, 0x11, 0xf7, 0xe0, 0x02, 0x13, 0x18, 0xd8, 0x54, 0x0f, 0x10, 0x03, 0x15, 0x00, 0x14, 0x00, 0x14, 0xf7, 0x14, 0x03, 0x10, 0x7c,
+  0x02, 0x03, 0x03, 0x0e, 0x00, 0x03, 0x12, 0x00, 0x05, 0x1c, 0x00, 0x0a, 0x0c, 0x00, 0x05, 0x26, 0x00, 0x03, 0x40, 0x00, 0x01, 0x4a, 0x03, 0x0f, 0x02, 0x00, 0x09, 0x0a, 0xbc, 0x00, 0x08, 0x02,
+  0x00, 0x15, 0x59, 0xb4, 0x02, 0x01, 0xe2, 0x08, 0x23, 0x85, 0x9a, 0xaa, 0x02, 0x17, 0x99, 0xb2, 0x02, 0x40, 0x99, 0x8d, 0x59, 0x85, 0x2a, 0x00, 0xb1, 0x7d, 0xa6, 0x5d, 0xa6, 0x7e, 0xa6, 0x9e,
+  0xae, 0x9e, 0xae, 0x5d, 0x0a, 0x00, 0x47, 0x7d, 0xa6, 0x7e, 0xae, 0x02, 0x00, 0x25, 0xa6, 0x5d, 0x02, 0x00, 0x14, 0x7e, 0x02, 0x00, 0x07, 0x20, 0x00, 0x31, 0x9e, 0xae, 0x7e, 0x34, 0x00, 0x11,
+  0x7d, 0x42, 0x00, 0x15, 0x7e, 0x24, 0x00, 0x08, 0x0c, 0x00, 0x26, 0x7e, 0xae, 0x08, 0x00, 0x16, 0x5e, 0x40, 0x00, 0x21, 0xa6, 0x5e, 0x56, 0x00, 0x11, 0x5e, 0x02, 0x00, 0x22, 0x7e, 0xae, 0x08,
+  0x00, 0x13, 0x3d, 0x12, 0x00, 0x17, 0x5d, 0x08, 0x00, 0x04, 0x02, 0x00, 0x15, 0x3d, 0x02, 0x00, 0x09, 0x16, 0x00, 0x43, 0x9e, 0x3d, 0x9e, 0x5d, 0x02, 0x00, 0x15, 0x3d, 0x02, 0x00, 0x13, 0x3c,
+  0x08, 0x00, 0x28, 0x5d, 0x9e, 0x28, 0x00, 0x0c, 0x02, 0x00, 0x59, 0x1d, 0x9e, 0x1d, 0x9e, 0x1c, 0x02, 0x00, 0x24, 0xfc, 0x95, 0x08, 0x00, 0x0f, 0x02, 0x00, 0x19, 0x0c, 0xf8, 0xbd, 0x0a, 0x90,
+  0x9d, 0x12, 0xfc, 0xa6, 0x9d, 0x11, 0x95, 0xb6, 0x99, 0x12, 0x95, 0x16, 0x96, 0x06, 0x02, 0x00, 0x09, 0x38, 0x8b, 0x03, 0xa4, 0x96, 0x0f, 0x02, 0x00, 0x1b, 0x08, 0x82, 0x7d, 0x0c, 0x8e, 0x7d,
+  0x0e, 0xc4, 0x12, 0x0d, 0x70, 0x0f, 0x08, 0x1c, 0x8f, 0x0e, 0x2c, 0x00, 0x0e, 0x38, 0x0c, 0x0e, 0x18, 0x1a, 0x0d, 0x42, 0x0f, 0x08, 0x18, 0x00, 0x18, 0xba, 0x34, 0x00, 0x15, 0x8d, 0x48, 0x09,
+  0x05, 0x44, 0x09, 0x03, 0x24, 0x0c, 0x1c, 0x8d, 0x8c, 0x13, 0x03, 0x0c, 0x00, 0x00, 0x1e, 0x85, 0x00, 0xa6, 0x0c, 0x41, 0x8d, 0xba, 0x8d, 0xbb, 0xec, 0x0f, 0x11, 0xdb, 0x06, 0x00, 0x02, 0xee,
+  0x0f, 0x12, 0xbb, 0x3e, 0x00, 0x09, 0x02, 0x00, 0x01, 0x38, 0x00, 0x07, 0x40, 0x09, 0x0a, 0x20, 0x00, 0x15, 0xdb, 0x70, 0x09, 0x04, 0x46, 0x00, 0x04, 0xb4, 0x00, 0x20, 0x99, 0x85, 0x02, 0x00,
+  0x07, 0x18, 0x0c, 0x04, 0x3e, 0x03, 0x03, 0xe8, 0x05, 0x02, 0x1e, 0x00, 0x08, 0x22, 0x00, 0x15, 0x99, 0x14, 0x00, 0x0a, 0x2a, 0x06, 0x13, 0x58, 0x4c, 0x04, 0x04, 0x54, 0x04, 0x20, 0x17, 0x75,
+  0xae, 0x03, 0xfe, 0x1b, 0xb6, 0x6c, 0x95, 0x64, 0x75, 0x64, 0x55, 0x64, 0x75, 0x64, 0x54, 0x64, 0x75, 0x64, 0x34, 0x5c, 0x14, 0x5c, 0xd3, 0x53, 0xf3, 0x53, 0xd3, 0x53, 0xd2, 0x4b, 0xb2, 0x4b,
+  0x91, 0x43, 0x71, 0x43, 0x50, 0x43, 0x50, 0x3b, 0x30, 0x3b, 0x0f, 0x33, 0x52, 0x3b, 0x02, 0x00, 0x10, 0x72, 0x02, 0x00, 0x21, 0x43, 0x93, 0x02, 0x00, 0x00, 0x0e, 0x00, 0x02, 0x14, 0x00, 0x02,
+  0x10, 0x00, 0x73, 0x73, 0x43, 0x93, 0x43, 0xb3, 0x43, 0xb3, 0x1e, 0x00, 0x15, 0xb3, 0x0c, 0x00, 0x04, 0x08, 0x00, 0x95, 0xd4, 0x4b, 0xd4, 0x4b, 0xf4, 0x4b, 0xf4, 0x4b, 0xd4, 0x02, 0x00, 0x55,
+  0xf4, 0x4b, 0xf5, 0x4b, 0xf4, 0x0c, 0x00, 0x20, 0x15, 0x54, 0x02, 0x00, 0x22, 0x35, 0x54, 0x08, 0x00, 0x42, 0xf5, 0x53, 0xf5, 0x4b, 0x08, 0x00, 0x02, 0x04, 0x00, 0x33, 0x36, 0x5c, 0x56, 0x02,
+  0x00, 0x22, 0x77, 0x64, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x33, 0x76, 0x64, 0x97, 0x02, 0x00, 0x04, 0x36, 0xe1, 0x03, 0xf8, 0xeb, 0x00, 0x02, 0x00, 0x20, 0x64, 0xd8, 0x02, 0x00, 0x05, 0x3a, 0x68,
+  0x15, 0xf8, 0x02, 0x00, 0x76, 0xf9, 0x6c, 0xf9, 0x6c, 0x19, 0x6d, 0xd8, 0x0e, 0x00, 0x3e, 0x74, 0x19, 0x75, 0x02, 0x00, 0x81, 0x3a, 0x7d, 0x39, 0x7d, 0x19, 0x75, 0x39, 0x7d, 0x02, 0x00, 0x43,
+  0x75, 0x3a, 0x75, 0x39, 0x02, 0x00, 0x20, 0x3a, 0x7d, 0x02, 0x00, 0x11, 0x5a, 0x06, 0x00, 0x04, 0x0c, 0x00, 0x15, 0x5a, 0x10, 0x00, 0x1f, 0x5a, 0x02, 0x00, 0x16, 0x1f, 0x7a, 0x02, 0x00, 0x06,
+  0x3e, 0x9a, 0x7d, 0x9a, 0xb4, 0xd5, 0x0e, 0x2c, 0xcb, 0x0e, 0xae, 0xae, 0x0e, 0xac, 0xc0, 0x0f, 0x02, 0x00, 0x22, 0x03, 0x78, 0x84, 0x0b, 0xc0, 0xb9, 0x0c, 0x26, 0x00, 0x1b, 0x7a, 0x02, 0x00,
+  0x1f, 0x9a, 0x02, 0x00, 0x14, 0x04, 0x2e, 0x00, 0x02, 0x04, 0x00, 0x08, 0x3e, 0x00, 0x37, 0x7a, 0x85, 0x79, 0x1e, 0x00, 0x0c, 0x02, 0x00, 0x2e, 0x59, 0x7d, 0x02, 0x00, 0x22, 0x39, 0x75, 0x08,
+  0x00, 0xc0, 0x38, 0x75, 0x59, 0x7d, 0x18, 0x75, 0x38, 0x75, 0x39, 0x7d, 0x18, 0x75, 0x0e, 0x00, 0x2e, 0x18, 0x75, 0x02, 0x00, 0x21, 0xf8, 0x74, 0x08, 0x00, 0x00, 0xac, 0x06, 0x05, 0x0e, 0x00,
+  0x03, 0x2c, 0x0a, 0x63, 0x6c, 0xb6, 0x6c, 0xb6, 0x6c, 0xd7, 0x04, 0x00, 0x00, 0x02, 0x00, 0x25, 0x96, 0x64, 0x0c, 0x00, 0x00, 0x0e, 0x00, 0x02, 0x32, 0x03, 0x90, 0x5c, 0x55, 0x5c, 0x54, 0x5c,
+  0x54, 0x5c, 0x55, 0x5c, 0x3c, 0x03, 0x00, 0x42, 0x03, 0x11, 0x55, 0x3e, 0x03, 0x00, 0x3c, 0x03, 0x02, 0x3e, 0x03, 0x00, 0x02, 0x00, 0x22, 0x92, 0x43, 0x02, 0x00, 0x15, 0x91, 0x02, 0x00, 0x91,
+  0x71, 0x43, 0x71, 0x3b, 0x50, 0x3b, 0x50, 0x3b, 0x71, 0x02, 0x00, 0x51, 0x51, 0x3b, 0x51, 0x3b, 0x50, 0x02, 0x00, 0x51, 0x2f, 0x33, 0x30, 0x3b, 0x30, 0x06, 0x00, 0x63, 0x70, 0x3b, 0x50, 0x3b,
+  0x0f, 0x33, 0x2c, 0x00, 0x30, 0x43, 0xd2, 0x4b, 0x02, 0x00, 0x80, 0x13, 0x54, 0xf3, 0x53, 0xf2, 0x53, 0x13, 0x54, 0x02, 0x00, 0xe0, 0x74, 0x64, 0x74, 0x64, 0x54, 0x5c, 0x4f, 0x02, 0x6f, 0x0a,
+  0x70, 0x0a, 0x6f, 0x02, 0x08, 0x00, 0x00, 0x06, 0x00, 0x0b, 0x02, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x20, 0x00, 0x01, 0x02, 0x00, 0x01, 0x10, 0x00, 0x07, 0x1a, 0x00, 0x00, 0x06, 0x00, 0x00, 0x1c,
+  0x00, 0x04, 0x12, 0x00, 0x15, 0x2f, 0x02, 0x00, 0x08, 0x0c, 0x00, 0x53, 0x2f, 0x02, 0x2e, 0x02, 0x2e, 0x14, 0x00, 0x3d, 0x2e, 0x02, 0x0e, 0x02, 0x00, 0x71, 0xee, 0x01, 0x0e, 0x02, 0x2f, 0x02,
+  0x0e, 0x26, 0x00, 0x40, 0xcd, 0x01, 0xed, 0x01, 0x04, 0x00, 0x13, 0xee, 0x02, 0x00, 0x00, 0x20, 0x00, 0x31, 0xed, 0x01, 0xed, 0x16, 0x00, 0x7b, 0xac, 0x01, 0xac, 0x01, 0xad, 0x01, 0xcd, 0x02,
+  0x00, 0x00, 0x14, 0x00, 0x02, 0x02, 0x00, 0x02, 0x10, 0x00, 0x17, 0xad, 0x24, 0x00, 0x15, 0xad, 0x02, 0x00, 0x1d, 0x8c, 0x02, 0x00, 0x31, 0x6c, 0x01, 0x6c, 0x08, 0x00, 0x75, 0x4c, 0x01, 0x4b,
+  0x01, 0x4c, 0x01, 0x6c, 0x02, 0x00, 0x04, 0x1e, 0x00, 0x1d, 0x8c, 0x14, 0x00, 0x04, 0x18, 0x00, 0x0e, 0x48, 0x00, 0x0a, 0x24, 0x00, 0x0c, 0x02, 0x00, 0x13, 0xad, 0xba, 0x00, 0x04, 0x06, 0x00,
+  0x15, 0xad, 0x06, 0x00, 0x00, 0xa2, 0x00, 0x1b, 0xcc, 0x02, 0x00, 0x17, 0xac, 0x02, 0x00, 0x00, 0x10, 0x00, 0x1f, 0xcd, 0x02, 0x00, 0x08, 0x00, 0x18, 0x01, 0x04, 0x22, 0x00, 0x0c, 0x48, 0x00,
+  0x22, 0xcd, 0x01, 0x38, 0x01, 0x2f, 0x0d, 0x02, 0x02, 0x00, 0x0f, 0x02, 0x26, 0x00, 0x13, 0x2d, 0x0c, 0x00, 0x1f, 0xed, 0x3a, 0x00, 0x0a, 0x0f, 0x20, 0x00, 0x15, 0x3f, 0xec, 0x01, 0xec, 0x26,
+  0x00, 0x02, 0x71, 0x6e, 0x02, 0x4e, 0x02, 0x2d, 0x02, 0x4e, 0x02, 0x00, 0x91, 0x6e, 0x02, 0x6e, 0x02, 0x0c, 0x02, 0x0c, 0x02, 0x2d, 0x02, 0x00, 0x33, 0x4d, 0x02, 0x4d, 0x06, 0x00, 0x08, 0x02,
+  0x00, 0x02, 0x1a, 0x00, 0xf9, 0x0a, 0x6d, 0x02, 0x8e, 0x0a, 0xaf, 0x12, 0x8e, 0x12, 0xcf, 0x1a, 0x10, 0x23, 0x30, 0x2b, 0x10, 0x23, 0xcf, 0x1a, 0x71, 0x33, 0x10, 0x2b, 0x8e, 0x1a, 0xae, 0x02,
+  0x00, 0xf2, 0x0b, 0x8e, 0x1a, 0x8e, 0x1a, 0x30, 0x33, 0x30, 0x2b, 0x10, 0x2b, 0xef, 0x2a, 0xef, 0x2a, 0x10, 0x2b, 0x30, 0x33, 0x51, 0x33, 0xef, 0x2a, 0x10, 0x33, 0x30, 0x33, 0x28, 0x03, 0x40,
+  0x91, 0x43, 0x92, 0x43, 0x08, 0x00, 0x00, 0x06, 0x00, 0xb3, 0xb2, 0x43, 0xd2, 0x4b, 0xb2, 0x43, 0xf3, 0x4b, 0xd3, 0x4b, 0xb2, 0x1c, 0x03, 0xa0, 0xf3, 0x53, 0xd3, 0x4b, 0xf3, 0x4b, 0x34, 0x5c,
+  0x34, 0x5c, 0x1e, 0x03, 0x40, 0x34, 0x5c, 0x54, 0x5c, 0x04, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x02, 0x00, 0x00, 0xa4, 0x03, 0x20, 0x95, 0x64, 0xb2, 0x03, 0x00, 0x04, 0x00, 0x00, 0x0e, 0x00, 0x11,
+  0x75, 0x14, 0x00, 0x40, 0x34, 0x54, 0x34, 0x54, 0x08, 0x00, 0x08, 0x0c, 0x00, 0x00, 0x08, 0x00, 0x04, 0x0c, 0x00, 0x51, 0x33, 0x54, 0x34, 0x5c, 0x33, 0x52, 0x00, 0x20, 0x33, 0x5c, 0x7e, 0x03,
+  0x80, 0x13, 0x54, 0xf2, 0x4b, 0xf2, 0x4b, 0x33, 0x54, 0x0c, 0x00, 0xa2, 0xd2, 0x4b, 0x91, 0x43, 0xb1, 0x43, 0xb1, 0x43, 0xd1, 0x4b, 0xd4, 0x03, 0xf1, 0x02, 0x70, 0x3b, 0x70, 0x3b, 0x33, 0x23,
+  0x33, 0x1b, 0x33, 0x1b, 0x33, 0x23, 0x53, 0x23, 0x33, 0x1b, 0x13, 0x02, 0x00, 0x20, 0x33, 0x23, 0x02, 0x00, 0x00, 0x0e, 0x00, 0x70, 0x12, 0x1b, 0xf2, 0x12, 0x12, 0x1b, 0x12, 0x08, 0x00, 0x32,
+  0x1a, 0x12, 0x1b, 0x02, 0x00, 0x02, 0x18, 0x00, 0x10, 0x12, 0x28, 0x00, 0x01, 0x02, 0x00, 0x04, 0x18, 0x00, 0x06, 0x14, 0x00, 0x02, 0x46, 0x00, 0x01, 0x0e, 0x00, 0x00, 0x08, 0x00, 0x65, 0x13,
+  0x12, 0x13, 0x13, 0x13, 0x12, 0x02, 0x00, 0x37, 0xf2, 0x12, 0x12, 0x0e, 0x00, 0x02, 0x1e, 0x00, 0x31, 0x33, 0x1b, 0x13, 0x06, 0x00, 0x0a, 0x02, 0x00, 0x21, 0x13, 0x13, 0x16, 0x00, 0x27, 0x13,
+  0x33, 0x06, 0x00, 0x13, 0x53, 0x16, 0x00, 0x02, 0x12, 0x00, 0x03, 0x28, 0x00, 0x0d, 0x02, 0x00, 0x04, 0x8e, 0x00, 0x01, 0x86, 0x00, 0x11, 0x23, 0x02, 0x00, 0x04, 0x08, 0x00, 0x08, 0x02, 0x00,
+  0x02, 0x2e, 0x00, 0x09, 0x14, 0x00, 0x28, 0x33, 0x23, 0x48, 0x00, 0x20, 0xf3, 0x1a, 0x06, 0x00, 0x43, 0xf2, 0x1a, 0xf2, 0x12, 0x02, 0x00, 0x1e, 0x1a, 0x6c, 0x00, 0x0c, 0x52, 0x00, 0x2e, 0xf2,
+  0x1a, 0x02, 0x00, 0x06, 0x3e, 0x01, 0x04, 0x02, 0x00, 0x04, 0x16, 0x00, 0x00, 0x04, 0x00, 0x20, 0x32, 0x13, 0x02, 0x00, 0x00, 0x0a, 0x01, 0x50, 0x11, 0x13, 0x11, 0x13, 0x12, 0x0e, 0x00, 0x43,
+  0x1b, 0x32, 0x1b, 0x32, 0x1e, 0x01, 0x06, 0x08, 0x00, 0x02, 0x0a, 0x00, 0x06, 0x2e, 0x00, 0x06, 0x0e, 0x00, 0x09, 0x30, 0x00, 0x17, 0x1b, 0x0e, 0x00, 0x00, 0x54, 0x00, 0x10, 0x0b, 0x02, 0x00,
+  0x51, 0x12, 0x0b, 0x12, 0x0b, 0x32, 0x02, 0x00, 0x13, 0x11, 0x02, 0x00, 0x02, 0x10, 0x00, 0x11, 0x12, 0x0c, 0x00, 0x18, 0x32, 0x02, 0x00, 0x17, 0x13, 0x0a, 0x00, 0x0e, 0x02, 0x00, 0x04, 0x60,
+  0x00, 0x2f, 0x1b, 0x52, 0x02, 0x00, 0x06, 0x71, 0x73, 0x1b, 0x73, 0x23, 0x93, 0x23, 0x73, 0x02, 0x00, 0x24, 0x93, 0x23, 0x16, 0x00, 0x12, 0x72, 0x02, 0x00, 0x81, 0x23, 0xb3, 0x2b, 0xb3, 0x2b,
+  0x93, 0x2b, 0xd4, 0x06, 0x00, 0x11, 0xb4, 0x08, 0x00, 0x62, 0xb3, 0x2b, 0xd3, 0x2b, 0xf4, 0x33, 0x02, 0x00, 0x20, 0xd3, 0x2b, 0x02, 0x00, 0x12, 0xb3, 0x02, 0x00, 0x00, 0x0c, 0x00, 0xf0, 0x18,
+  0x33, 0xb3, 0x33, 0xb3, 0x33, 0x92, 0x33, 0xb2, 0x33, 0xb3, 0x33, 0xd3, 0x3b, 0xb3, 0x3b, 0xf4, 0x43, 0xf4, 0x43, 0x14, 0x44, 0x14, 0x44, 0xd3, 0x3b, 0x75, 0x54, 0x34, 0x4c, 0xd3, 0x3b, 0xd3,
+  0x3b, 0xf3, 0x43, 0xf3, 0x43, 0xd3, 0x3b, 0x02, 0x00, 0x11, 0xb2, 0x02, 0x00, 0x26, 0xf3, 0x43, 0x02, 0x00, 0xf0, 0x07, 0x13, 0x4c, 0x13, 0x4c, 0xf3, 0x43, 0xf3, 0x4b, 0x13, 0x4c, 0x14, 0x4c,
+  0x14, 0x54, 0x34, 0x54, 0x14, 0x54, 0x14, 0x4c, 0xf3, 0x4b, 0x02, 0x00, 0x11, 0xb2, 0x16, 0x00, 0x40, 0xd2, 0x43, 0x13, 0x54, 0x20, 0x03, 0x20, 0xf3, 0x4b, 0x9c, 0x03, 0x00, 0x02, 0x00, 0x11,
+  0xd2, 0x9e, 0x03, 0x06, 0xf6, 0x06, 0x22, 0xb2, 0x4b, 0xd0, 0x06, 0x02, 0x0e, 0x00, 0x40, 0xb1, 0x4b, 0x91, 0x43, 0x1e, 0x07, 0x11, 0xb1, 0xe2, 0x06, 0x04, 0x42, 0x03, 0x30, 0x70, 0x3b, 0x91,
+  0x02, 0x00, 0x00, 0x00, 0x07, 0x00, 0x04, 0x00, 0x42, 0x33, 0x50, 0x33, 0x50, 0x1c, 0x07, 0x50, 0x33, 0x2f, 0x33, 0x2f, 0x33, 0x20, 0x00, 0x60, 0x90, 0x43, 0xb1, 0x43, 0x91, 0x43, 0x06, 0x00,
+  0x01, 0x82, 0x03, 0x20, 0x4b, 0x90, 0x3a, 0x00, 0xf0, 0x00, 0x43, 0x70, 0x43, 0x50, 0x43, 0x90, 0x4b, 0x70, 0x43, 0x90, 0x43, 0xb0, 0x4b, 0xb1, 0x4b, 0x16, 0x00, 0x80, 0x4f, 0x3b, 0x90, 0x43,
+  0x12, 0x13, 0x33, 0x13, 0xae, 0x01, 0x01, 0xe0, 0x02, 0x02, 0x0c, 0x00, 0x81, 0x13, 0x12, 0x0b, 0xf2, 0x02, 0x12, 0x0b, 0x32, 0x10, 0x00, 0x20, 0xf2, 0x0a, 0xd6, 0x01, 0x25, 0x33, 0x1b, 0x50,
+  0x03, 0x01, 0x10, 0x00, 0x06, 0x0e, 0x00, 0x24, 0xf2, 0x0a, 0x06, 0x00, 0x01, 0x28, 0x00, 0x01, 0x0c, 0x00, 0x08, 0x24, 0x00, 0x40, 0xf2, 0x02, 0x32, 0x13, 0x5e, 0x00, 0x02, 0x1c, 0x00, 0x27,
+  0x33, 0x1b, 0x4c, 0x00, 0x00, 0x26, 0x02, 0x01, 0x14, 0x00, 0x16, 0x13, 0x94, 0x03, 0x07, 0x58, 0x00, 0x00, 0x10, 0x00, 0x02, 0x9a, 0x00, 0x20, 0x12, 0x0b, 0x1a, 0x00, 0x02, 0x01, 0x00, 0x02,
+  0x30, 0x00, 0x27, 0x33, 0x1b, 0x66, 0x00, 0x10, 0x1b, 0x2c, 0x03, 0x08, 0x38, 0x00, 0x22, 0xf2, 0x0a, 0x26, 0x00, 0x00, 0x38, 0x00, 0x15, 0x12, 0xe8, 0x03, 0x01, 0x72, 0x04, 0x01, 0x10, 0x00,
+  0x20, 0xf2, 0x12, 0x18, 0x04, 0x00, 0x46, 0x00, 0x0a, 0x18, 0x04, 0x04, 0xca, 0x00, 0x04, 0x0c, 0x04, 0x00, 0x16, 0x00, 0x20, 0xd1, 0x02, 0x12, 0x00, 0x24, 0xd2, 0x02, 0x4e, 0x04, 0x02, 0x76,
+  0x00, 0x02, 0xa0, 0x03, 0x02, 0x20, 0x00, 0x00, 0x0e, 0x00, 0x21, 0xd1, 0x0a, 0x0c, 0x00, 0x10, 0x0a, 0x0a, 0x00, 0x62, 0xd1, 0x0a, 0xf1, 0x0a, 0xd1, 0x0a, 0x0c, 0x00, 0x70, 0xb1, 0x02, 0xb0,
+  0x02, 0xf1, 0x0a, 0xf1, 0x12, 0x00, 0xe0, 0x02, 0xb1, 0x02, 0xd1, 0x02, 0xb0, 0x02, 0xd1, 0x0a, 0xf1, 0x12, 0xf2, 0x12, 0xf1, 0x3e, 0x00, 0x01, 0xf0, 0x04, 0x22, 0xf1, 0x0a, 0x20, 0x03, 0x22,
+  0xf1, 0x0a, 0x02, 0x00, 0x13, 0xd0, 0x30, 0x00, 0x00, 0x32, 0x00, 0x20, 0xf1, 0x02, 0x06, 0x00, 0x24, 0x11, 0x13, 0x20, 0x00, 0x20, 0x11, 0x13, 0x20, 0x00, 0x40, 0x11, 0x13, 0xf1, 0x12, 0xba,
+  0x03, 0x02, 0x10, 0x00, 0x08, 0x06, 0x00, 0x00, 0x1c, 0x00, 0x11, 0xd0, 0x34, 0x00, 0x11, 0xd1, 0x46, 0x00, 0x02, 0x26, 0x00, 0x07, 0x24, 0x00, 0x30, 0x0b, 0xd0, 0x02, 0x20, 0x00, 0x00, 0xf6,
+  0x03, 0x04, 0x66, 0x00, 0x03, 0x7e, 0x00, 0x14, 0x02, 0x64, 0x00, 0x04, 0x44, 0x00, 0x12, 0x32, 0xca, 0x03, 0x12, 0x13, 0x10, 0x00, 0x00, 0x4a, 0x00, 0x00, 0x78, 0x00, 0x62, 0x32, 0x1b, 0xf1,
+  0x12, 0x31, 0x1b, 0x0e, 0x00, 0x00, 0x08, 0x00, 0x22, 0x31, 0x13, 0x0c, 0x00, 0x04, 0x12, 0x00, 0x60, 0xf0, 0x0a, 0xf0, 0x0a, 0x11, 0x13, 0x04, 0x00, 0x04, 0x7c, 0x00, 0x10, 0xd0, 0x10, 0x00,
+  0x41, 0x12, 0xf0, 0x12, 0xd0, 0x18, 0x00, 0x11, 0xd0, 0x60, 0x00, 0x22, 0xaf, 0x02, 0x10, 0x00, 0x20, 0xd0, 0x02, 0x30, 0x00, 0x28, 0x10, 0x13, 0x02, 0x00, 0x84, 0xf0, 0x0a, 0x51, 0x23, 0x31,
+  0x1b, 0x72, 0x23, 0x02, 0x00, 0x90, 0x10, 0x13, 0x51, 0x23, 0x10, 0x1b, 0x31, 0x1b, 0x31, 0x06, 0x00, 0x30, 0x23, 0x30, 0x1b, 0x06, 0x00, 0xf1, 0x2a, 0x31, 0x23, 0x51, 0x2b, 0x51, 0x2b, 0x71,
+  0x2b, 0x71, 0x33, 0x92, 0x33, 0x91, 0x2b, 0xd2, 0x3b, 0xd3, 0x3b, 0x92, 0x33, 0x71, 0x2b, 0x92, 0x33, 0x92, 0x33, 0x71, 0x33, 0x51, 0x2b, 0x50, 0x2b, 0x0f, 0x23, 0x71, 0x2b, 0xef, 0x1a, 0x30,
+  0x23, 0x91, 0x33, 0x50, 0x2b, 0x30, 0x23, 0x51, 0x2b, 0x30, 0x2b, 0x30, 0x2b, 0x0f, 0x23, 0x0f, 0x23, 0x71, 0x3c, 0x07, 0xa1, 0x50, 0x33, 0x92, 0x3b, 0xb2, 0x3b, 0x50, 0x33, 0x71, 0x33, 0x46,
+  0x03, 0x32, 0x33, 0x70, 0x33, 0x52, 0x03, 0x30, 0xb1, 0x3b, 0xd2, 0x38, 0x03, 0x03, 0x5c, 0x03, 0x20, 0xd2, 0x4b, 0xba, 0x06, 0x00, 0x72, 0x03, 0x00, 0x04, 0x00, 0x00, 0x0a, 0x00, 0x31, 0x50,
+  0x3b, 0x71, 0x06, 0x00, 0x05, 0xae, 0x03, 0x01, 0x46, 0x03, 0x11, 0x91, 0xde, 0x06, 0x02, 0x98, 0x03, 0x00, 0x74, 0x03, 0x00, 0x10, 0x00, 0x31, 0x90, 0x43, 0x90, 0xf6, 0x06, 0x60, 0xf1, 0x4b,
+  0x90, 0x43, 0xd1, 0x4b, 0x10, 0x00, 0x22, 0xb1, 0x4b, 0x76, 0x03, 0xf0, 0x18, 0xb0, 0x4b, 0x6f, 0x43, 0x90, 0x4b, 0x2e, 0x43, 0xb1, 0x53, 0x90, 0x53, 0x90, 0x53, 0xd1, 0x5b, 0xb0, 0x5b, 0xb0,
+  0x5b, 0xd0, 0x5b, 0x4e, 0x4b, 0xaf, 0x53, 0x4e, 0x4b, 0xd0, 0x5b, 0x6e, 0x53, 0x8f, 0x53, 0x53, 0x1b, 0x53, 0x13, 0x53, 0xd4, 0x04, 0x30, 0x1b, 0x53, 0x13, 0x02, 0x00, 0x71, 0x73, 0x1b, 0x94,
+  0x23, 0x74, 0x1b, 0x53, 0x0e, 0x00, 0x00, 0x16, 0x00, 0x00, 0x0e, 0x03, 0x00, 0x52, 0x03, 0x20, 0x53, 0x1b, 0xa0, 0x03, 0x01, 0xaa, 0x03, 0x31, 0x03, 0x33, 0x13, 0xb0, 0x03, 0x00, 0x8c, 0x02,
+  0x12, 0x0b, 0x0c, 0x00, 0x13, 0x33, 0x60, 0x03, 0x20, 0xf2, 0x02, 0x80, 0x03, 0x02, 0x2a, 0x00, 0x11, 0x33, 0x50, 0x05, 0x22, 0x53, 0x13, 0x88, 0x05, 0x01, 0x16, 0x00, 0x00, 0x16, 0x03, 0x12,
+  0x1b, 0x8c, 0x03, 0x00, 0x6e, 0x02, 0x00, 0x30, 0x00, 0x11, 0x33, 0x06, 0x03, 0x02, 0x0a, 0x04, 0x84, 0x53, 0x1b, 0x94, 0x23, 0x53, 0x1b, 0x53, 0x1b, 0x1c, 0x04, 0x08, 0x0c, 0x00, 0x23, 0x33,
+  0x13, 0xbe, 0x03, 0x01, 0x52, 0x03, 0x71, 0x53, 0x23, 0x74, 0x23, 0x33, 0x1b, 0x54, 0xd6, 0x07, 0x00, 0x50, 0x00, 0x10, 0x53, 0xaa, 0x07, 0x23, 0x0b, 0x12, 0x32, 0x00, 0x11, 0x53, 0x66, 0x00,
+  0x00, 0x4e, 0x00, 0x06, 0x3c, 0x00, 0x00, 0x94, 0x00, 0x02, 0x1a, 0x04, 0x02, 0xce, 0x00, 0x20, 0x53, 0x1b, 0xf6, 0x00, 0x02, 0x24, 0x00, 0x00, 0x06, 0x00, 0x01, 0x00, 0x01, 0x03, 0x14, 0x00,
+  0x34, 0x53, 0x13, 0x33, 0x14, 0x01, 0x10, 0x1b, 0xc0, 0x00, 0x22, 0x53, 0x1b, 0xb4, 0x04, 0x00, 0x6c, 0x00, 0x20, 0x73, 0x23, 0x84, 0x06, 0x02, 0x76, 0x00, 0x02, 0x10, 0x00, 0x11, 0x53, 0xb4,
+  0x00, 0x22, 0x32, 0x1b, 0x76, 0x00, 0x13, 0x32, 0x04, 0x00, 0x08, 0x02, 0x00, 0x00, 0x56, 0x06, 0x00, 0xe0, 0x02, 0x02, 0xbe, 0x06, 0x10, 0x12, 0x1e, 0x00, 0x01, 0x64, 0x06, 0x00, 0x16, 0x03,
+  0x31, 0x32, 0x1b, 0x11, 0x28, 0x01, 0x00, 0x06, 0x00, 0x11, 0x52, 0xda, 0x06, 0x03, 0x26, 0x07, 0x22, 0x1b, 0xf1, 0xd6, 0x02, 0x40, 0x0b, 0xf0, 0x02, 0x31, 0x1c, 0x03, 0x01, 0x0c, 0x00, 0x62,
+  0x31, 0x13, 0x52, 0x1b, 0xf1, 0x12, 0xee, 0x02, 0x06, 0xa8, 0x06, 0x20, 0x32, 0x1b, 0xfc, 0x02, 0x40, 0x52, 0x1b, 0x52, 0x23, 0x14, 0x03, 0x20, 0x32, 0x1b, 0x5a, 0x03, 0x00, 0x1c, 0x00, 0x01,
+  0x5e, 0x00, 0x00, 0x16, 0x03, 0x81, 0x12, 0xd0, 0x02, 0xf1, 0x12, 0xd0, 0x0a, 0xb0, 0x58, 0x03, 0x02, 0x10, 0x00, 0x02, 0x5e, 0x03, 0x02, 0x26, 0x00, 0x00, 0x58, 0x00, 0x00, 0x7e, 0x03, 0x12,
+  0x31, 0x10, 0x00, 0x10, 0x12, 0x02, 0x00, 0x41, 0xf0, 0x0a, 0xf1, 0x12, 0x6a, 0x00, 0x01, 0x64, 0x03, 0x00, 0x52, 0x03, 0x21, 0xf0, 0x0a, 0x46, 0x03, 0x21, 0x1b, 0xaf, 0x08, 0x00, 0x11, 0xaf,
+  0x4c, 0x03, 0x00, 0x54, 0x03, 0x02, 0x46, 0x03, 0x00, 0x04, 0x00, 0x00, 0x02, 0x00, 0x00, 0x94, 0x03, 0x74, 0x11, 0x1b, 0x10, 0x13, 0xd0, 0x0a, 0x10, 0xb6, 0x03, 0xd4, 0x1b, 0xf0, 0x12, 0x10,
+  0x1b, 0x11, 0x1b, 0x10, 0x1b, 0xf0, 0x12, 0x11, 0x1b, 0x0a, 0x00, 0x00, 0x04, 0x00, 0x00, 0x1c, 0x00, 0x11, 0x31, 0x0e, 0x00, 0x00, 0x10, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x06, 0x00, 0x60, 0xcf,
+  0x0a, 0x10, 0x1b, 0xcf, 0x0a, 0x36, 0x00, 0x03, 0x02, 0x00, 0x00, 0x5c, 0x00, 0x30, 0x12, 0xef, 0x12, 0x1e, 0x00, 0xe0, 0xef, 0x12, 0xef, 0x1a, 0xf0, 0x1a, 0xef, 0x1a, 0x10, 0x1b, 0xce, 0x12,
+  0xae, 0x0a, 0x08, 0x00, 0x84, 0x30, 0x1b, 0x0f, 0x1b, 0xcf, 0x12, 0xef, 0x1a, 0x02, 0x00, 0x40, 0x30, 0x2b, 0x30, 0x23, 0x02, 0x00, 0x19, 0x0f, 0x04, 0x00, 0x22, 0xce, 0x12, 0x08, 0x00, 0x02,
+  0x94, 0x03, 0x31, 0x0f, 0x23, 0x2f, 0xa0, 0x03, 0x31, 0x2f, 0x2b, 0x50, 0x94, 0x03, 0x11, 0x90, 0x8e, 0x03, 0x00, 0x9a, 0x03, 0x62, 0xb1, 0x3b, 0xf2, 0x4b, 0xb1, 0x43, 0x8c, 0x03, 0x00, 0x02,
+  0x00, 0x00, 0x8a, 0x03, 0x51, 0xf1, 0x4b, 0xf2, 0x4b, 0xd1, 0x0e, 0x00, 0x91, 0xf2, 0x53, 0xf3, 0x53, 0xf3, 0x53, 0xd2, 0x53, 0xb1, 0x8a, 0x03, 0xf0, 0x03, 0xf2, 0x53, 0xd2, 0x53, 0xf2, 0x53,
+  0xd1, 0x4b, 0xf2, 0x53, 0xf2, 0x4b, 0xd1, 0x4b, 0xf2, 0x4b, 0xf2, 0x53, 0x02, 0x00, 0xf0, 0x33, 0x53, 0x5c, 0xf2, 0x53, 0x12, 0x54, 0x12, 0x54, 0x53, 0x5c, 0x32, 0x5c, 0xf1, 0x53, 0x32, 0x5c,
+  0x33, 0x5c, 0x12, 0x5c, 0x53, 0x64, 0x32, 0x5c, 0x53, 0x64, 0x73, 0x64, 0x93, 0x6c, 0x73, 0x6c, 0x32, 0x64, 0xd4, 0x74, 0xd5, 0x7c, 0xd5, 0x7c, 0x16, 0x85, 0x57, 0x95, 0x77, 0x95, 0x97, 0x9d,
+  0xd8, 0xa5, 0xf8, 0xa5, 0x39, 0xb6, 0x39, 0xae, 0x7a, 0xb6, 0x59, 0xb6, 0x9a, 0xbe, 0x9b, 0xbe, 0x53, 0x1b, 0x82, 0x03, 0x33, 0x94, 0x23, 0x53, 0x00, 0x03, 0x00, 0x42, 0x03, 0x01, 0x86, 0x02,
+  0x01, 0xb8, 0x02, 0x13, 0x32, 0x96, 0x03, 0x02, 0xae, 0x03, 0x04, 0x0e, 0x00, 0x00, 0xbe, 0x02, 0x80, 0x32, 0x0b, 0x53, 0x13, 0x94, 0x1b, 0x94, 0x23, 0x12, 0x00, 0x33, 0x74, 0x23, 0x73, 0xe0,
+  0x02, 0x11, 0x74, 0xde, 0x02, 0x15, 0x32, 0xf4, 0x02, 0x13, 0x12, 0x00, 0x09, 0x21, 0x73, 0x1b, 0x90, 0x03, 0x00, 0x2a, 0x00, 0x30, 0x23, 0x94, 0x2b, 0x70, 0x00, 0x40, 0xb5, 0x2b, 0x94, 0x2b,
+  0xda, 0x08, 0x51, 0x74, 0x23, 0x94, 0x23, 0xb4, 0x0c, 0x00, 0x06, 0x4c, 0x03, 0x46, 0x53, 0x1b, 0x74, 0x23, 0x54, 0x00, 0x17, 0x53, 0x02, 0x00, 0x02, 0x52, 0x03, 0x42, 0x33, 0x1b, 0xf1, 0x02,
+  0xfa, 0x03, 0x04, 0x84, 0x03, 0x00, 0x90, 0x03, 0x02, 0x20, 0x00, 0x20, 0xf2, 0x02, 0x3a, 0x03, 0x00, 0x7a, 0x00, 0x00, 0x20, 0x00, 0x06, 0x52, 0x00, 0x00, 0x6a, 0x00, 0x00, 0x04, 0x00, 0x21,
+  0x53, 0x1b, 0x70, 0x00, 0x12, 0x23, 0x14, 0x00, 0x40, 0x53, 0x1b, 0x11, 0x03, 0xa0, 0x00, 0x81, 0x52, 0x13, 0x52, 0x13, 0x12, 0x03, 0x12, 0x03, 0x7e, 0x03, 0x01, 0xea, 0x00, 0x00, 0x14, 0x00,
+  0x21, 0x53, 0x13, 0xba, 0x00, 0x04, 0x50, 0x04, 0x00, 0x4a, 0x00, 0x01, 0x86, 0x09, 0x06, 0x8c, 0x00, 0x44, 0x12, 0x13, 0xf1, 0x02, 0x82, 0x06, 0x15, 0x12, 0xb4, 0x06, 0x06, 0x56, 0x0a, 0x10,
+  0x32, 0x20, 0x00, 0x00, 0x84, 0x06, 0x56, 0x03, 0x11, 0x0b, 0x32, 0x13, 0x06, 0x07, 0x05, 0x34, 0x00, 0x03, 0x6c, 0x06, 0x04, 0xe4, 0x06, 0x02, 0x02, 0x00, 0x30, 0xd0, 0x02, 0x31, 0x7a, 0x06,
+  0x00, 0x98, 0x06, 0x10, 0x0b, 0x0a, 0x00, 0x20, 0xf1, 0x0a, 0x30, 0x03, 0x02, 0x04, 0x00, 0x02, 0x80, 0x03, 0x20, 0x72, 0x23, 0x76, 0x03, 0x24, 0x52, 0x1b, 0xa8, 0x06, 0x00, 0xf2, 0x09, 0x30,
+  0x51, 0x1b, 0x52, 0x48, 0x06, 0x02, 0xa0, 0x03, 0x12, 0x0b, 0xde, 0x06, 0x11, 0x31, 0x4c, 0x07, 0x11, 0x32, 0x18, 0x00, 0x22, 0x11, 0x13, 0xda, 0x06, 0x03, 0x68, 0x03, 0x03, 0xf2, 0x06, 0x00,
+  0x28, 0x00, 0x51, 0xf0, 0x0a, 0xd0, 0x02, 0xf0, 0x60, 0x03, 0x23, 0xd0, 0x0a, 0xb8, 0x06, 0x32, 0x12, 0x11, 0x13, 0x5c, 0x03, 0x10, 0x10, 0x08, 0x00, 0x13, 0x13, 0xc6, 0x06, 0x10, 0x1b, 0x1a,
+  0x03, 0x10, 0x31, 0x3a, 0x03, 0x50, 0x13, 0x31, 0x23, 0xf0, 0x12, 0x14, 0x00, 0x11, 0x31, 0x8e, 0x03, 0x00, 0x9a, 0x03, 0x12, 0x10, 0x60, 0x00, 0x02, 0x76, 0x03, 0x23, 0x13, 0x10, 0x0a, 0x00,
+  0x02, 0x54, 0x03, 0x01, 0x74, 0x03, 0x21, 0x1a, 0x11, 0xdc, 0x06, 0x51, 0x10, 0x1b, 0x51, 0x23, 0x11, 0xe8, 0x06, 0x20, 0x11, 0x1b, 0x50, 0x03, 0x00, 0x4a, 0x00, 0xc2, 0x51, 0x23, 0x51, 0x23,
+  0xf0, 0x12, 0x31, 0x23, 0x51, 0x23, 0x31, 0x23, 0x0a, 0x07, 0x01, 0x06, 0x07, 0x03, 0x02, 0x00, 0xb2, 0x30, 0x1b, 0x51, 0x23, 0x92, 0x33, 0x51, 0x2b, 0x30, 0x23, 0x71, 0x6e, 0x03, 0x50, 0x2b,
+  0x50, 0x2b, 0x71, 0x2b, 0x10, 0x00, 0x22, 0xef, 0x1a, 0x72, 0x03, 0x11, 0x51, 0x12, 0x00, 0x40, 0x30, 0x2b, 0x71, 0x33, 0xf8, 0x06, 0x14, 0x50, 0x06, 0x00, 0xf0, 0x03, 0x2b, 0x71, 0x33, 0x71,
+  0x33, 0xb2, 0x3b, 0xf2, 0x43, 0xf2, 0x43, 0xf3, 0x43, 0xb1, 0x3b, 0xb2, 0x3b, 0xf2, 0x94, 0x0a, 0x52, 0x43, 0x70, 0x33, 0x71, 0x3b, 0x6e, 0x03, 0xd1, 0xd2, 0x43, 0xd2, 0x43, 0xb1, 0x3b, 0xb1,
+  0x3b, 0x90, 0x3b, 0xb1, 0x43, 0xd2, 0x74, 0x03, 0x00, 0x74, 0x0a, 0x00, 0xdc, 0x06, 0x11, 0xd2, 0x98, 0x03, 0xa0, 0x12, 0x54, 0x12, 0x4c, 0xd1, 0x4b, 0xb1, 0x43, 0xf2, 0x4b, 0x06, 0x00, 0x60,
+  0x90, 0x43, 0x13, 0x5c, 0xf2, 0x53, 0x8a, 0x03, 0x31, 0x13, 0x5c, 0x33, 0x6a, 0x03, 0xd0, 0xf2, 0x53, 0xd1, 0x53, 0xf2, 0x53, 0x12, 0x5c, 0xf2, 0x5b, 0xd1, 0x53, 0xb1, 0x1a, 0x00, 0xd0, 0x5b,
+  0xd1, 0x53, 0xd1, 0x53, 0x33, 0x64, 0xf1, 0x5b, 0x90, 0x4b, 0x12, 0x5c, 0x18, 0x00, 0x71, 0x32, 0x64, 0xd1, 0x53, 0xf1, 0x5b, 0xf1, 0x18, 0x00, 0xf6, 0x15, 0xd0, 0x53, 0xb0, 0x53, 0xb0, 0x53,
+  0x12, 0x64, 0xf1, 0x63, 0x6f, 0x53, 0xb0, 0x5b, 0xf1, 0x63, 0xb0, 0x5b, 0x6f, 0x53, 0xcd, 0x42, 0xed, 0x42, 0x2e, 0x4b, 0x0d, 0x4b, 0x2e, 0x53, 0x4e, 0x53, 0x6f, 0x5b, 0x0d, 0x4b, 0xec, 0x02,
+  0x00, 0x68, 0x02, 0x02, 0xa4, 0x0a, 0x02, 0x5a, 0x03, 0x00, 0x1c, 0x07, 0x02, 0x3c, 0x07, 0x02, 0x86, 0x03, 0x31, 0xb4, 0x2b, 0x94, 0x9a, 0x03, 0x02, 0x8c, 0x03, 0x02, 0x08, 0x00, 0x00, 0x2c,
+  0x07, 0x17, 0x73, 0xc6, 0x03, 0x04, 0xbe, 0x03, 0x02, 0xb6, 0x03, 0x02, 0x76, 0x06, 0x31, 0x93, 0x1b, 0x52, 0xe2, 0x02, 0x00, 0x94, 0x03, 0x00, 0x3e, 0x03, 0x04, 0xf8, 0x0c, 0x11, 0x52, 0x2a,
+  0x03, 0x11, 0x93, 0x24, 0x00, 0x02, 0x0e, 0x00, 0x11, 0x73, 0x2a, 0x00, 0x02, 0x9a, 0x06, 0x02, 0x56, 0x00, 0x00, 0xe6, 0x0c, 0x04, 0xbe, 0x07, 0x11, 0x32, 0x1a, 0x00, 0x42, 0x93, 0x23, 0x93,
+  0x23, 0xa6, 0x03, 0x15, 0x73, 0xda, 0x07, 0x05, 0x0a, 0x00, 0x22, 0x23, 0x73, 0x52, 0x00, 0x00, 0xae, 0x00, 0x10, 0x23, 0x4e, 0x00, 0x15, 0x52, 0x5c, 0x04, 0x13, 0x53, 0x5a, 0x00, 0x00, 0x1a,
+  0x03, 0x51, 0x52, 0x13, 0x73, 0x1b, 0x52, 0x8a, 0x03, 0x00, 0x24, 0x00, 0x51, 0x32, 0x03, 0x32, 0x0b, 0x52, 0x94, 0x03, 0x00, 0x0e, 0x00, 0x24, 0x73, 0x13, 0x0a, 0x00, 0x11, 0x52, 0x16, 0x00,
+  0x20, 0x12, 0x03, 0x46, 0x00, 0x51, 0x32, 0x0b, 0x11, 0x03, 0xd0, 0x7c, 0x0a, 0x11, 0x32, 0xc8, 0x06, 0x10, 0x53, 0x28, 0x0d, 0x10, 0x23, 0xd2, 0x00, 0x65, 0x93, 0x23, 0xb3, 0x2b, 0x73, 0x23,
+  0x3c, 0x0d, 0x14, 0x23, 0x0c, 0x00, 0x00, 0xa8, 0x00, 0x00, 0x82, 0x03, 0x02, 0x90, 0x04, 0x20, 0xf1, 0x02, 0x3e, 0x03, 0x22, 0x32, 0x13, 0x40, 0x00, 0x04, 0xdc, 0x06, 0x02, 0xea, 0x0d, 0x42,
+  0x52, 0x1b, 0x31, 0x13, 0x1e, 0x00, 0x03, 0x2a, 0x07, 0x50, 0x0b, 0x72, 0x1b, 0x52, 0x1b, 0x18, 0x07, 0x00, 0x14, 0x00, 0x02, 0x20, 0x00, 0x24, 0xf0, 0x02, 0x04, 0x00, 0x40, 0xaf, 0x02, 0xf0,
+  0x02, 0x42, 0x03, 0x22, 0x11, 0x0b, 0x06, 0x00, 0x15, 0x10, 0x02, 0x00, 0x31, 0xcf, 0x02, 0xcf, 0x22, 0x00, 0x20, 0x52, 0x1b, 0xb8, 0x03, 0x43, 0x51, 0x1b, 0xf0, 0x02, 0x54, 0x0a, 0x10, 0x1b,
+  0x00, 0x0a, 0x03, 0x90, 0x03, 0x03, 0x0c, 0x00, 0x00, 0x0a, 0x00, 0x62, 0x11, 0x13, 0xd0, 0x0a, 0x31, 0x13, 0xfa, 0x03, 0x00, 0x30, 0x00, 0x42, 0x31, 0x13, 0x10, 0x0b, 0x56, 0x03, 0x11, 0x51,
+  0x02, 0x00, 0x00, 0x32, 0x00, 0x01, 0x2e, 0x0a, 0x01, 0x76, 0x03, 0x11, 0x31, 0x64, 0x03, 0x01, 0xc4, 0x06, 0x01, 0x8c, 0x03, 0x60, 0x31, 0x1b, 0x71, 0x23, 0x71, 0x23, 0x5c, 0x0a, 0x30, 0x30,
+  0x1b, 0x51, 0x0a, 0x00, 0x12, 0x1b, 0x70, 0x0a, 0x11, 0x30, 0xfc, 0x06, 0x00, 0x64, 0x0a, 0x00, 0xc0, 0x03, 0x00, 0xec, 0x06, 0x00, 0x8c, 0x03, 0x00, 0x68, 0x03, 0x30, 0x71, 0x2b, 0x10, 0x16,
+  0x00, 0x01, 0x1c, 0x00, 0x11, 0x30, 0x04, 0x00, 0x00, 0x74, 0x03, 0x00, 0x64, 0x03, 0x00, 0x66, 0x03, 0x00, 0x72, 0x03, 0x00, 0x22, 0x00, 0x20, 0x30, 0x23, 0x0c, 0x00, 0x04, 0x7a, 0x03, 0xc0,
+  0x71, 0x2b, 0x50, 0x23, 0x10, 0x23, 0x50, 0x2b, 0x10, 0x23, 0x0f, 0x1b, 0x88, 0x0a, 0x40, 0x10, 0x23, 0x51, 0x2b, 0x88, 0x0a, 0x20, 0x71, 0x33, 0x94, 0x03, 0x00, 0xd2, 0x06, 0x60, 0x91, 0x33,
+  0x91, 0x33, 0x70, 0x33, 0x78, 0x03, 0x11, 0xb1, 0xe6, 0x06, 0x11, 0x91, 0x64, 0x03, 0x40, 0xb2, 0x43, 0x91, 0x3b, 0xfc, 0x06, 0x11, 0xb1, 0x7e, 0x0a, 0x20, 0x13, 0x4c, 0x6e, 0x03, 0x00, 0x70,
+  0x03, 0x01, 0xfe, 0x06, 0x12, 0x43, 0xee, 0x06, 0x00, 0x3a, 0x0e, 0x00, 0x66, 0x0a, 0x02, 0x0a, 0x07, 0xa2, 0x90, 0x43, 0x90, 0x3b, 0xd1, 0x43, 0xf2, 0x4b, 0x12, 0x54, 0x16, 0x07, 0x51, 0x70,
+  0x3b, 0x2f, 0x3b, 0x70, 0x9e, 0x03, 0x40, 0xd1, 0x4b, 0x12, 0x54, 0x78, 0x0a, 0x00, 0x8c, 0x03, 0x40, 0x2f, 0x3b, 0x74, 0x64, 0x0e, 0x00, 0xc0, 0x70, 0x43, 0x0e, 0x33, 0x70, 0x43, 0x90, 0x4b,
+  0x90, 0x4b, 0xf2, 0x5b, 0x84, 0x03, 0xf0, 0x00, 0x90, 0x4b, 0xb1, 0x53, 0x12, 0x5c, 0xf1, 0x5b, 0xb0, 0x53, 0x53, 0x64, 0xd1, 0x53, 0x6f, 0x8c, 0x03, 0x90, 0x64, 0xb0, 0x53, 0x90, 0x53, 0x70,
+  0x4b, 0xf1, 0x5b, 0x02, 0x00, 0xa2, 0x52, 0x64, 0xd1, 0x5b, 0x11, 0x5c, 0x52, 0x64, 0x52, 0x64, 0x10, 0x00, 0xe0, 0x11, 0x64, 0x52, 0x6c, 0x12, 0x6c, 0x12, 0x6c, 0x32, 0x6c, 0x12, 0x6c, 0x53,
+  0x74, 0x04, 0x00, 0xf0, 0x09, 0x73, 0x7c, 0xb4, 0x84, 0x93, 0x7c, 0x16, 0x95, 0x73, 0x23, 0xb4, 0x2b, 0xd5, 0x2b, 0xd5, 0x33, 0xd5, 0x2b, 0x94, 0x23, 0x74, 0x23, 0xb4, 0x2b, 0x02, 0x00, 0x00,
+  0xee, 0x02, 0x00, 0x18, 0x00, 0x10, 0xb5, 0x0e, 0x00, 0x12, 0x23, 0x3e, 0x07, 0x12, 0x94, 0x22, 0x07, 0x11, 0x0b, 0xec, 0x02, 0x00, 0xd4, 0x06, 0x10, 0x23, 0x32, 0x00, 0x40, 0xd5, 0x2b, 0xb4,
+  0x23, 0x7a, 0x03, 0x02, 0x26, 0x00, 0x11, 0x94, 0x86, 0x03, 0x12, 0x93, 0x3e, 0x03, 0x12, 0x0b, 0xb6, 0x03, 0x02, 0x7c, 0x06, 0x34, 0x32, 0x03, 0x52, 0xaa, 0x03, 0x04, 0xbc, 0x02, 0x03, 0x82,
+  0x03, 0x22, 0x32, 0x13, 0x50, 0x03, 0x11, 0x52, 0x02, 0x00, 0x00, 0x08, 0x00, 0x01, 0x9c, 0x03, 0x05, 0xda, 0x03, 0x00, 0x38, 0x00, 0x02, 0xc2, 0x06, 0x02, 0x06, 0x00, 0x02, 0x2c, 0x00, 0x13,
+  0x93, 0x34, 0x00, 0x35, 0xb4, 0x23, 0x93, 0x06, 0x04, 0x04, 0x6e, 0x0b, 0x17, 0x93, 0xd0, 0x03, 0x63, 0x11, 0x03, 0xf1, 0x02, 0x11, 0x03, 0xec, 0x06, 0x00, 0xa6, 0x06, 0x12, 0x03, 0x10, 0x07,
+  0x15, 0x31, 0x74, 0x03, 0x52, 0x93, 0x1b, 0xb3, 0x23, 0x93, 0xe8, 0x03, 0x45, 0x1b, 0x72, 0x13, 0x93, 0x4e, 0x04, 0x02, 0x8e, 0x03, 0xf0, 0x01, 0x11, 0x03, 0x73, 0x13, 0x73, 0x13, 0x93, 0x1b,
+  0xd4, 0x2b, 0xf5, 0x33, 0xf5, 0x33, 0xd4, 0x2b, 0x64, 0x03, 0x00, 0x3c, 0x00, 0x02, 0xa2, 0x10, 0x24, 0x52, 0x1b, 0x1e, 0x11, 0x02, 0x02, 0x07, 0x02, 0xde, 0x02, 0x01, 0x1a, 0x00, 0x03, 0x08,
+  0x00, 0x11, 0xb3, 0x56, 0x00, 0x02, 0xe2, 0x10, 0x13, 0x93, 0xe0, 0x10, 0x13, 0x32, 0x9a, 0x0a, 0x00, 0x06, 0x03, 0x71, 0x72, 0x23, 0x72, 0x1b, 0x93, 0x23, 0x72, 0x2a, 0x00, 0x30, 0x73, 0x23,
+  0x31, 0x12, 0x00, 0x10, 0x1b, 0x80, 0x03, 0x00, 0x12, 0x00, 0x01, 0xf4, 0x10, 0x12, 0x23, 0x4a, 0x0a, 0x90, 0x52, 0x13, 0x51, 0x13, 0x72, 0x1b, 0x31, 0x13, 0x92, 0x48, 0x00, 0xd0, 0x2b, 0x92,
+  0x23, 0x51, 0x1b, 0x92, 0x23, 0xb3, 0x2b, 0x72, 0x23, 0x92, 0x23, 0x0c, 0x00, 0x40, 0x71, 0x1b, 0x92, 0x23, 0x52, 0x03, 0x50, 0xf3, 0x33, 0xb3, 0x2b, 0x72, 0x1a, 0x03, 0xb0, 0x0b, 0xb3, 0x2b,
+  0x14, 0x3c, 0xf3, 0x33, 0xd3, 0x33, 0x92, 0x23, 0xda, 0x06, 0x02, 0x90, 0x0d, 0x20, 0x93, 0x2b, 0x08, 0x00, 0x00, 0x60, 0x03, 0x02, 0x9a, 0x0d, 0x61, 0x51, 0x23, 0xb3, 0x2b, 0x51, 0x23, 0x7c,
+  0x03, 0x21, 0x23, 0x51, 0xa8, 0x03, 0x20, 0x92, 0x2b, 0x70, 0x11, 0x00, 0x12, 0x00, 0x00, 0x46, 0x00, 0x01, 0x24, 0x00, 0xf0, 0x02, 0x1b, 0x71, 0x23, 0x92, 0x2b, 0xb2, 0x2b, 0xb2, 0x2b, 0x51,
+  0x23, 0x92, 0x2b, 0xd3, 0x33, 0x92, 0x2b, 0x60, 0x11, 0x40, 0xb2, 0x2b, 0x72, 0x2b, 0x18, 0x00, 0x03, 0x1c, 0x00, 0x30, 0x33, 0xd3, 0x33, 0x06, 0x00, 0xa0, 0x92, 0x2b, 0xb2, 0x33, 0xf3, 0x3b,
+  0xb2, 0x33, 0xb2, 0x33, 0xa8, 0x03, 0x01, 0x16, 0x00, 0x00, 0x2c, 0x00, 0x00, 0x14, 0x00, 0x30, 0x3b, 0x71, 0x2b, 0xe0, 0x0d, 0x20, 0x91, 0x33, 0xe6, 0x06, 0x22, 0x91, 0x33, 0x0e, 0x00, 0x11,
+  0x92, 0x08, 0x00, 0x11, 0x10, 0x7a, 0x03, 0x00, 0x10, 0x00, 0x02, 0x68, 0x0a, 0x20, 0xef, 0x1a, 0x18, 0x00, 0x20, 0xf3, 0x43, 0x20, 0x00, 0x00, 0x2a, 0x00, 0x20, 0x91, 0x33, 0xa6, 0x11, 0x10,
+  0xd2, 0x02, 0x00, 0x51, 0x43, 0x33, 0x4c, 0xd2, 0x43, 0xee, 0x06, 0x21, 0x4b, 0xf2, 0x8e, 0x11, 0x20, 0x91, 0x3b, 0x04, 0x00, 0x21, 0xf2, 0x43, 0x78, 0x03, 0x00, 0x3a, 0x03, 0x01, 0x76, 0x03,
+  0x21, 0x91, 0x43, 0x40, 0x18, 0x21, 0x4c, 0x33, 0x04, 0x00, 0x00, 0x02, 0x00, 0x00, 0x30, 0x00, 0x51, 0x12, 0x4c, 0xb1, 0x43, 0xd1, 0x10, 0x0e, 0x20, 0xd2, 0x4b, 0x52, 0x0a, 0x20, 0xd1, 0x4b,
+  0x68, 0x11, 0x20, 0x53, 0x5c, 0x82, 0x03, 0x20, 0x33, 0x5c, 0xaa, 0x03, 0x40, 0x53, 0x5c, 0xb1, 0x4b, 0x08, 0x07, 0x00, 0x86, 0x0a, 0xf0, 0x09, 0x74, 0x64, 0x94, 0x64, 0x74, 0x64, 0x53, 0x64,
+  0x53, 0x5c, 0x94, 0x64, 0x73, 0x5c, 0x12, 0x54, 0x73, 0x64, 0x12, 0x54, 0xf1, 0x53, 0xf1, 0x53, 0x14, 0x07, 0xa0, 0x94, 0x6c, 0x12, 0x5c, 0xb4, 0x6c, 0x73, 0x64, 0xb4, 0x6c, 0x88, 0x0a, 0x20,
+  0x12, 0x5c, 0x88, 0x03, 0xf2, 0x27, 0x53, 0x64, 0x94, 0x6c, 0x73, 0x6c, 0x12, 0x5c, 0xb0, 0x53, 0xd1, 0x53, 0x32, 0x64, 0x11, 0x5c, 0xb0, 0x53, 0x8f, 0x4b, 0xf1, 0x53, 0x93, 0x6c, 0x53, 0x6c,
+  0x32, 0x64, 0x32, 0x6c, 0xd0, 0x5b, 0x6f, 0x4b, 0xd1, 0x5b, 0xd0, 0x5b, 0xd0, 0x5b, 0xb0, 0x53, 0x11, 0x5c, 0xf0, 0x5b, 0xd0, 0x5b, 0x31, 0x64, 0x11, 0x64, 0xf1, 0x63, 0x02, 0x00, 0xe3, 0xd1,
+  0x63, 0xd2, 0x63, 0xd1, 0x63, 0xf2, 0x63, 0xb1, 0x63, 0x90, 0x5b, 0xf1, 0x6b, 0x26, 0x0d, 0x02, 0xce, 0x06, 0x01, 0xd2, 0x06, 0x00, 0x0a, 0x00, 0x13, 0x52, 0xfa, 0x0d, 0x20, 0xf1, 0x02, 0x04,
+  0x00, 0x22, 0xf1, 0x02, 0x10, 0x03, 0x02, 0x62, 0x0e, 0x00, 0x9c, 0x03, 0x02, 0x24, 0x07, 0x11, 0x93, 0xba, 0x0a, 0x14, 0x73, 0xc0, 0x06, 0x01, 0x4e, 0x06, 0x00, 0x22, 0x03, 0x40, 0x93, 0x1b,
+  0x73, 0x13, 0x02, 0x00, 0x00, 0xa8, 0x03, 0x11, 0x93, 0xc0, 0x03, 0x22, 0xd4, 0x2b, 0x98, 0x02, 0x22, 0xb4, 0x23, 0xe2, 0x06, 0x00, 0x9e, 0x02, 0x00, 0x44, 0x00, 0x01, 0x02, 0x03, 0x12, 0x13,
+  0xf8, 0x02, 0x02, 0x0a, 0x00, 0x02, 0xd6, 0x06, 0x15, 0x73, 0x68, 0x07, 0x02, 0x38, 0x03, 0x70, 0x93, 0x1b, 0xf5, 0x33, 0xf5, 0x2b, 0xb4, 0x36, 0x00, 0x10, 0x13, 0x46, 0x03, 0x20, 0x11, 0x03,
+  0x3a, 0x00, 0x00, 0x54, 0x00, 0x00, 0x38, 0x03, 0x71, 0x72, 0x13, 0x32, 0x0b, 0x31, 0x03, 0x31, 0x6e, 0x03, 0x00, 0xfc, 0x03, 0x51, 0x31, 0x03, 0x52, 0x0b, 0x31, 0x0c, 0x00, 0x10, 0x52, 0x22,
+  0x00, 0x03, 0xea, 0x06, 0x11, 0x31, 0x18, 0x00, 0x00, 0x0e, 0x00, 0x03, 0x08, 0x00, 0x50, 0x13, 0x11, 0x03, 0x52, 0x0b, 0x0a, 0x00, 0x00, 0x24, 0x00, 0x00, 0xe2, 0x00, 0x00, 0x48, 0x03, 0x02,
+  0x1a, 0x00, 0x01, 0x3e, 0x00, 0x01, 0xac, 0x03, 0x02, 0x1c, 0x00, 0x00, 0xc2, 0x03, 0x11, 0x31, 0x76, 0x03, 0x00, 0x2a, 0x03, 0x00, 0x24, 0x03, 0x61, 0x10, 0x03, 0xf0, 0x02, 0xf0, 0x02, 0x82,
+  0x03, 0x01, 0x90, 0x03, 0x00, 0x30, 0x03, 0x70, 0x92, 0x1b, 0x93, 0x23, 0xb3, 0x23, 0xb3, 0x36, 0x14, 0x01, 0xe2, 0x00, 0x00, 0x2c, 0x00, 0x11, 0x93, 0x10, 0x01, 0x02, 0x5e, 0x14, 0x00, 0x4c,
+  0x07, 0x0a, 0x68, 0x14, 0x16, 0x72, 0x7a, 0x14, 0x01, 0x94, 0x03, 0x00, 0x3a, 0x00, 0x00, 0x1a, 0x00, 0x00, 0x0c, 0x00, 0x20, 0x92, 0x23, 0x3a, 0x07, 0x00, 0x72, 0x00, 0x30, 0x92, 0x23, 0x10,
+  0x60, 0x00, 0x00, 0x7a, 0x00, 0x01, 0xf4, 0x03, 0x00, 0x0e, 0x00, 0x00, 0xd0, 0x06, 0x00, 0x8a, 0x03, 0x00, 0x8c, 0x03, 0xd3, 0x72, 0x23, 0x30, 0x13, 0x92, 0x23, 0xb2, 0x2b, 0x30, 0x0b, 0x30,
+  0x13, 0x71, 0xa4, 0x03, 0x60, 0x10, 0x0b, 0x30, 0x0b, 0x72, 0x23, 0x2a, 0x03, 0x00, 0xa4, 0x03, 0x00, 0x72, 0x03, 0x00, 0x4e, 0x03, 0x20, 0x92, 0x2b, 0x42, 0x03, 0x00, 0xda, 0x06, 0x13, 0xb2,
+  0xd6, 0x03, 0x20, 0xb2, 0x2b, 0x04, 0x00, 0x00, 0x28, 0x00, 0x02, 0x88, 0x03, 0x02, 0x76, 0x03, 0x20, 0x71, 0x23, 0x26, 0x07, 0x10, 0xb3, 0x64, 0x03, 0x01, 0x30, 0x00, 0x20, 0xd3, 0x33, 0xaa,
+  0x06, 0x10, 0x51, 0xcc, 0x06, 0x30, 0x23, 0xb2, 0x33, 0x08, 0x00, 0x10, 0x91, 0x32, 0x0a, 0x01, 0x76, 0x03, 0x20, 0xf3, 0x3b, 0x12, 0x00, 0x20, 0x91, 0x2b, 0x22, 0x00, 0x31, 0x71, 0x23, 0x91,
+  0x96, 0x03, 0x31, 0x91, 0x2b, 0x51, 0xf8, 0x06, 0x00, 0x9e, 0x03, 0x51, 0x50, 0x2b, 0x91, 0x33, 0x51, 0x76, 0x11, 0x50, 0x54, 0x4c, 0x13, 0x44, 0x50, 0x16, 0x00, 0x10, 0x3b, 0xe2, 0x06, 0x82,
+  0xd3, 0x3b, 0x71, 0x33, 0x34, 0x4c, 0x34, 0x4c, 0x72, 0x03, 0xf1, 0x00, 0x91, 0x33, 0x33, 0x4c, 0x75, 0x54, 0xd2, 0x3b, 0x34, 0x4c, 0xd2, 0x3b, 0x13, 0x44, 0x91, 0x66, 0x0a, 0x40, 0x13, 0x44,
+  0x13, 0x44, 0x50, 0x0a, 0x02, 0x6e, 0x11, 0x00, 0x08, 0x00, 0x60, 0xf2, 0x4b, 0x33, 0x4c, 0x74, 0x5c, 0x7c, 0x03, 0x20, 0xf2, 0x4b, 0x6a, 0x03, 0x60, 0x54, 0x54, 0x12, 0x4c, 0x33, 0x54, 0x01,
+  0x00, 0xf0, 0x0d, 0x74, 0x5c, 0x95, 0x64, 0x53, 0x5c, 0x12, 0x54, 0x70, 0x3b, 0x95, 0x64, 0xd5, 0x6c, 0x94, 0x64, 0xb5, 0x64, 0x33, 0x54, 0xb0, 0x43, 0x74, 0x5c, 0x73, 0x5c, 0xd1, 0x4b, 0xd6,
+  0x0d, 0x10, 0x12, 0x9a, 0x03, 0x30, 0x5c, 0x33, 0x54, 0x68, 0x03, 0x20, 0x32, 0x54, 0x68, 0x03, 0x40, 0xd5, 0x6c, 0x73, 0x64, 0x1a, 0x00, 0x00, 0x2e, 0x00, 0x02, 0x80, 0x03, 0x10, 0x94, 0xe8,
+  0x0d, 0xf0, 0x06, 0x5c, 0x94, 0x6c, 0x73, 0x64, 0xd1, 0x53, 0x32, 0x5c, 0x32, 0x5c, 0xd1, 0x4b, 0x73, 0x64, 0x73, 0x64, 0x32, 0x5c, 0x94, 0x64, 0x80, 0x03, 0xf0, 0x05, 0x53, 0x64, 0xb4, 0x6c,
+  0x33, 0x5c, 0xd1, 0x53, 0x53, 0x64, 0xb1, 0x4b, 0x6f, 0x43, 0xb0, 0x4b, 0xb0, 0x4b, 0xd0, 0x4b, 0x26, 0x00, 0xc0, 0x11, 0x5c, 0xd0, 0x53, 0xd1, 0x53, 0xb0, 0x4b, 0x4f, 0x43, 0xb0, 0x4b, 0x0c,
+  0x00, 0x10, 0xf1, 0xa0, 0x0a, 0xf1, 0x05, 0x53, 0x32, 0x64, 0xf1, 0x53, 0x6f, 0x43, 0xf1, 0x5b, 0xd1, 0x5b, 0x90, 0x53, 0xf1, 0x63, 0x11, 0x64, 0x11, 0x64, 0x32, 0x02, 0x00, 0x20, 0xd0, 0x5b,
+  0x0c, 0x00, 0x00, 0x9c, 0x03, 0x20, 0x32, 0x6c, 0x08, 0x00, 0xf2, 0x03, 0xb0, 0x5b, 0xd1, 0x5b, 0x12, 0x6c, 0xb1, 0x5b, 0xb0, 0x5b, 0xb1, 0x5b, 0xb1, 0x63, 0xb1, 0x63, 0x94, 0x23, 0x64, 0x06,
+  0x00, 0xf8, 0x02, 0x24, 0x93, 0x1b, 0x0a, 0x06, 0x20, 0xd5, 0x2b, 0x02, 0x00, 0x51, 0xf5, 0x2b, 0xf5, 0x33, 0x93, 0x0a, 0x07, 0x20, 0xf5, 0x33, 0x28, 0x00, 0x00, 0x0a, 0x00, 0x40, 0x15, 0x34,
+  0x16, 0x34, 0x0a, 0x00, 0x60, 0xf5, 0x2b, 0xd5, 0x2b, 0x93, 0x1b, 0x40, 0x03, 0x14, 0x94, 0x74, 0x03, 0x01, 0x4a, 0x00, 0x00, 0x02, 0x00, 0x00, 0x38, 0x03, 0x11, 0xb4, 0x02, 0x00, 0x42, 0x73,
+  0x13, 0x72, 0x13, 0x1e, 0x00, 0x02, 0xd4, 0x06, 0x22, 0x52, 0x0b, 0x32, 0x07, 0x11, 0x73, 0x8c, 0x06, 0x50, 0xd4, 0x23, 0xd4, 0x2b, 0xd4, 0x46, 0x0e, 0x12, 0x13, 0x38, 0x00, 0x00, 0x86, 0x03,
+  0x00, 0x84, 0x06, 0x01, 0x8a, 0x03, 0x13, 0x13, 0x3a, 0x03, 0x12, 0x13, 0xac, 0x06, 0x02, 0x2a, 0x03, 0x00, 0x1a, 0x00, 0x02, 0x26, 0x03, 0x16, 0x93, 0x6c, 0x00, 0x03, 0x3c, 0x00, 0x20, 0x72,
+  0x13, 0x16, 0x00, 0x00, 0x5e, 0x00, 0x01, 0x7a, 0x03, 0x12, 0x13, 0x7a, 0x06, 0x01, 0x78, 0x07, 0x02, 0x40, 0x00, 0x01, 0x12, 0x00, 0x00, 0x88, 0x00, 0x00, 0x42, 0x00, 0x41, 0x52, 0x13, 0xb3,
+  0x23, 0x28, 0x03, 0x10, 0x13, 0xe6, 0x02, 0x00, 0xbc, 0x03, 0x04, 0x22, 0x07, 0x00, 0x48, 0x00, 0x11, 0xb3, 0x42, 0x04, 0x11, 0x52, 0x0e, 0x00, 0x00, 0xb8, 0x03, 0x11, 0x31, 0x20, 0x00, 0x01,
+  0x26, 0x03, 0x00, 0x38, 0x03, 0x52, 0x2b, 0xd4, 0x33, 0x92, 0x23, 0x02, 0x00, 0x10, 0xf4, 0xac, 0x17, 0x21, 0x2b, 0xd4, 0x84, 0x03, 0x20, 0x72, 0x1b, 0x94, 0x03, 0x40, 0x52, 0x1b, 0x51, 0x13,
+  0xbe, 0x03, 0x10, 0x51, 0x06, 0x0a, 0x41, 0x13, 0x51, 0x0b, 0x72, 0xfa, 0x07, 0x00, 0x14, 0x00, 0x00, 0xc6, 0x03, 0x20, 0x52, 0x1b, 0x36, 0x00, 0x01, 0x2a, 0x00, 0x04, 0x08, 0x00, 0x50, 0x1b,
+  0xb3, 0x23, 0xd3, 0x2b, 0x0e, 0x00, 0x22, 0xb3, 0x23, 0x14, 0x00, 0x00, 0x0a, 0x00, 0x20, 0x51, 0x13, 0x0a, 0x00, 0x30, 0x10, 0x03, 0xb2, 0x1c, 0x00, 0x32, 0x1b, 0xd3, 0x2b, 0x0e, 0x07, 0x00,
+  0x04, 0x18, 0x22, 0xb2, 0x2b, 0x18, 0x18, 0x20, 0xf3, 0x33, 0x0a, 0x00, 0x11, 0xb2, 0x3a, 0x00, 0x60, 0x34, 0x3c, 0x55, 0x44, 0xf3, 0x33, 0x02, 0x00, 0xc0, 0x92, 0x23, 0xf3, 0x33, 0x71, 0x23,
+  0x30, 0x0b, 0xd2, 0x2b, 0xf3, 0x33, 0xac, 0x03, 0x13, 0x71, 0x02, 0x00, 0x80, 0x51, 0x1b, 0x30, 0x1b, 0x91, 0x23, 0x51, 0x1b, 0xb2, 0x03, 0x00, 0x0a, 0x00, 0x40, 0xb2, 0x2b, 0xd2, 0x33, 0x96,
+  0x03, 0x00, 0xe4, 0x06, 0x13, 0x91, 0x24, 0x00, 0x00, 0x4c, 0x03, 0x00, 0x7e, 0x0a, 0x42, 0x50, 0x1b, 0x10, 0x13, 0x1c, 0x00, 0x01, 0x14, 0x00, 0x70, 0x2b, 0x70, 0x23, 0x71, 0x23, 0xd2, 0x3b,
+  0x78, 0x03, 0x61, 0xd2, 0x3b, 0x91, 0x2b, 0x50, 0x23, 0x04, 0x07, 0x00, 0x66, 0x0a, 0x52, 0x1b, 0x2f, 0x1b, 0x50, 0x23, 0x76, 0x03, 0x42, 0xd2, 0x33, 0xb2, 0x33, 0x94, 0x03, 0x60, 0x91, 0x33,
+  0xd2, 0x3b, 0xb1, 0x33, 0xd2, 0x06, 0xa0, 0x71, 0x2b, 0x50, 0x2b, 0xf2, 0x43, 0x50, 0x2b, 0xd2, 0x3b, 0x5a, 0x03, 0x00, 0x18, 0x00, 0x00, 0x04, 0x00, 0x51, 0xf2, 0x43, 0x71, 0x33, 0xf2, 0x8e,
+  0x18, 0x00, 0xf4, 0x06, 0x80, 0xf2, 0x43, 0x54, 0x4c, 0xf2, 0x43, 0xb1, 0x3b, 0x24, 0x00, 0x61, 0xf2, 0x43, 0x91, 0x33, 0xd2, 0x43, 0x88, 0x03, 0x40, 0x4c, 0xf2, 0x43, 0x91, 0x60, 0x11, 0x00,
+  0x88, 0x03, 0x52, 0x43, 0xf2, 0x43, 0x12, 0x4c, 0x16, 0x07, 0x00, 0x86, 0x0a, 0x82, 0xd1, 0x43, 0x12, 0x4c, 0x74, 0x5c, 0xf2, 0x4b, 0xfa, 0x06, 0x00, 0x1c, 0x15, 0x40, 0x12, 0x54, 0xd1, 0x43,
+  0x70, 0x03, 0x04, 0x54, 0x11, 0x00, 0xd0, 0x14, 0x00, 0x88, 0x11, 0x20, 0x12, 0x54, 0x04, 0x00, 0x11, 0xd1, 0x7c, 0x11, 0x41, 0xb0, 0x4b, 0x12, 0x54, 0xb0, 0x03, 0x32, 0x43, 0x12, 0x54, 0xec,
+  0x06, 0xf0, 0x05, 0xf1, 0x53, 0xd1, 0x53, 0xf1, 0x53, 0x70, 0x43, 0x4f, 0x43, 0x70, 0x43, 0xb0, 0x4b, 0x70, 0x43, 0x4f, 0x3b, 0x6f, 0x43, 0x02, 0x00, 0x00, 0x10, 0x00, 0xf0, 0x03, 0x2e, 0x3b,
+  0x4f, 0x43, 0x4f, 0x3b, 0x2e, 0x3b, 0x4f, 0x3b, 0x4e, 0x3b, 0x4f, 0x3b, 0xed, 0x32, 0xed, 0x32, 0x18, 0x15, 0x90, 0x4e, 0x3b, 0x90, 0x4b, 0x4f, 0x43, 0x90, 0x4b, 0xf1, 0x4e, 0x00, 0x10, 0x5c,
+  0x90, 0x03, 0x80, 0xf1, 0x53, 0xd0, 0x4b, 0x11, 0x5c, 0x11, 0x5c, 0x4e, 0x00, 0x00, 0x90, 0x0a, 0x70, 0x73, 0x64, 0x11, 0x5c, 0x11, 0x54, 0x52, 0x12, 0x00, 0x00, 0x2e, 0x0e, 0x11, 0x4b, 0x3a,
+  0x0e, 0x30, 0x5b, 0x8f, 0x53, 0x02, 0x00, 0x40, 0x6f, 0x53, 0x0d, 0x43, 0x08, 0x00, 0x80, 0xf0, 0x5b, 0xf1, 0x63, 0xd0, 0x5b, 0xf1, 0x63, 0x08, 0x00, 0x60, 0x32, 0x64, 0x52, 0x6c, 0x53, 0x74,
+  0x52, 0x0e, 0x83, 0x32, 0x6c, 0x73, 0x74, 0x11, 0x6c, 0x73, 0x7c, 0x3a, 0x0d, 0x01, 0x94, 0x06, 0x10, 0x93, 0x38, 0x03, 0x13, 0x0b, 0xe4, 0x09, 0x01, 0x60, 0x06, 0x20, 0xd4, 0x2b, 0x34, 0x03,
+  0x20, 0x15, 0x34, 0x08, 0x00, 0x00, 0x70, 0x03, 0x20, 0x32, 0x0b, 0xf0, 0x09, 0x01, 0xa8, 0x06, 0x03, 0x0e, 0x03, 0x00, 0x0c, 0x00, 0x11, 0xd4, 0xd8, 0x05, 0x04, 0xec, 0x09, 0x00, 0x16, 0x00,
+  0x01, 0x1e, 0x00, 0x00, 0x10, 0x03, 0x10, 0x13, 0x16, 0x07, 0x04, 0x4c, 0x03, 0x20, 0xb3, 0x23, 0x2a, 0x07, 0x33, 0xb4, 0x23, 0xb3, 0x20, 0x07, 0x00, 0x1c, 0x00, 0x00, 0x52, 0x06, 0x00, 0xd0,
+  0x02, 0x02, 0xc2, 0x03, 0x00, 0x06, 0x00, 0x11, 0xb3, 0x62, 0x03, 0x00, 0xf2, 0x03, 0x40, 0x15, 0x34, 0xf4, 0x2b, 0x02, 0x00, 0x13, 0xb4, 0x38, 0x00, 0x04, 0x1c, 0x00, 0x31, 0x73, 0x1b, 0x72,
+  0xc4, 0x0a, 0x02, 0x26, 0x07, 0x02, 0xda, 0x03, 0x11, 0xf4, 0x12, 0x03, 0x13, 0xd4, 0x2a, 0x00, 0x11, 0xd4, 0x52, 0x00, 0x11, 0x92, 0x74, 0x06, 0x06, 0x02, 0x00, 0xf3, 0x02, 0xd4, 0x2b, 0xf4,
+  0x2b, 0x14, 0x2c, 0xf4, 0x2b, 0x15, 0x34, 0x56, 0x3c, 0xd3, 0x23, 0x14, 0x34, 0xd3, 0xcc, 0x03, 0x02, 0x1e, 0x00, 0x11, 0x93, 0x1c, 0x03, 0x02, 0xc0, 0x0a, 0x13, 0x92, 0xc0, 0x0a, 0x13, 0x72,
+  0xbe, 0x03, 0x42, 0x14, 0x34, 0xb3, 0x23, 0x90, 0x03, 0x02, 0x34, 0x03, 0x00, 0xf6, 0x02, 0x60, 0x14, 0x3c, 0x14, 0x3c, 0xf4, 0x33, 0x10, 0x00, 0x00, 0x4e, 0x11, 0x00, 0x20, 0x00, 0x11, 0xb3,
+  0x00, 0x04, 0x00, 0x8a, 0x03, 0x00, 0x32, 0x00, 0x40, 0x15, 0x34, 0xf4, 0x33, 0xbe, 0x00, 0x51, 0x92, 0x1b, 0x51, 0x0b, 0x92, 0x3a, 0x00, 0x42, 0xf4, 0x33, 0x14, 0x34, 0x3e, 0x00, 0x11, 0xb3,
+  0x60, 0x03, 0x10, 0x72, 0x60, 0x03, 0x00, 0xa8, 0x06, 0x01, 0x8e, 0x0a, 0x00, 0x08, 0x00, 0x00, 0x08, 0x0e, 0x02, 0x02, 0x07, 0x11, 0x71, 0x32, 0x07, 0x00, 0x7e, 0x03, 0x11, 0xd3, 0x24, 0x00,
+  0x11, 0xb2, 0xaa, 0x06, 0x00, 0x72, 0x03, 0x00, 0x84, 0x03, 0x11, 0x71, 0xce, 0x03, 0x00, 0x56, 0x03, 0x00, 0x38, 0x03, 0x01, 0x0e, 0x07, 0x21, 0x13, 0x30, 0x44, 0x03, 0x20, 0xd2, 0x2b, 0x04,
+  0x00, 0x12, 0xf3, 0x44, 0x0a, 0x01, 0x52, 0x03, 0x40, 0xd2, 0x33, 0x34, 0x44, 0x18, 0x07, 0x00, 0x5c, 0x03, 0x12, 0x91, 0x08, 0x00, 0x01, 0x7e, 0x03, 0x11, 0x50, 0x02, 0x0e, 0x30, 0x70, 0x23,
+  0x91, 0xdc, 0x06, 0x30, 0x23, 0x50, 0x23, 0x04, 0x00, 0x40, 0x0f, 0x13, 0x91, 0x2b, 0x02, 0x00, 0x31, 0xf2, 0x3b, 0xd2, 0x72, 0x03, 0x00, 0xa2, 0x03, 0x00, 0x0c, 0x00, 0x31, 0x30, 0x1b, 0x70,
+  0x18, 0x00, 0x00, 0x50, 0x03, 0x13, 0xb2, 0x70, 0x03, 0x40, 0xf3, 0x3b, 0x33, 0x44, 0x0c, 0x07, 0x60, 0x50, 0x23, 0x70, 0x2b, 0x71, 0x2b, 0x20, 0x00, 0x51, 0xb1, 0x33, 0xb1, 0x33, 0x91, 0x8a,
+  0x03, 0x00, 0x08, 0x00, 0x10, 0xb1, 0x3a, 0x00, 0xf1, 0x05, 0x3b, 0x2f, 0x23, 0x70, 0x33, 0x4f, 0x2b, 0x4f, 0x2b, 0x50, 0x2b, 0xb1, 0x3b, 0x90, 0x33, 0x50, 0x2b, 0x0f, 0x2b, 0x50, 0xfa, 0x0d,
+  0xa0, 0x91, 0x3b, 0x2f, 0x2b, 0x70, 0x33, 0x90, 0x33, 0x91, 0x3b, 0x06, 0x00, 0x11, 0x90, 0x6e, 0x18, 0x20, 0xd1, 0x43, 0x7c, 0x0a, 0x40, 0x33, 0x4c, 0xb1, 0x3b, 0x06, 0x00, 0x80, 0x74, 0x54,
+  0x33, 0x4c, 0x33, 0x4c, 0xf2, 0x4b, 0xd6, 0x0d, 0x00, 0x6c, 0x0a, 0x60, 0x33, 0x54, 0x12, 0x4c, 0x12, 0x4c, 0x62, 0x11, 0x02, 0x66, 0x03, 0xc0, 0x12, 0x4c, 0xd1, 0x43, 0x94, 0x5c, 0x53, 0x54,
+  0x53, 0x54, 0x32, 0x54, 0x8e, 0x03, 0x02, 0x5c, 0x18, 0x11, 0x12, 0xfc, 0x06, 0x31, 0x94, 0x64, 0xb1, 0x0c, 0x00, 0x42, 0x32, 0x54, 0x73, 0x5c, 0x78, 0x0a, 0x00, 0xfa, 0x06, 0x40, 0xd1, 0x4b,
+  0x94, 0x64, 0x02, 0x00, 0x00, 0xf6, 0x06, 0x02, 0x92, 0x03, 0x00, 0x02, 0x15, 0x00, 0x00, 0x15, 0x00, 0x6e, 0x11, 0x11, 0x53, 0x14, 0x00, 0x22, 0x12, 0x5c, 0xa8, 0x03, 0x00, 0x74, 0x03, 0x10,
+  0x73, 0x60, 0x03, 0x41, 0x54, 0x11, 0x54, 0x52, 0x1a, 0x00, 0x02, 0x76, 0x03, 0x01, 0x88, 0x03, 0xe0, 0x53, 0x11, 0x5c, 0xd1, 0x53, 0x11, 0x54, 0x8f, 0x43, 0x8f, 0x43, 0x8f, 0x4b, 0xb0, 0x96,
+  0x03, 0x01, 0x7e, 0x03, 0x40, 0x2e, 0x43, 0x0d, 0x3b, 0x08, 0x00, 0x20, 0x8f, 0x4b, 0xb8, 0x11, 0x00, 0x2a, 0x07, 0x40, 0x2e, 0x43, 0xb0, 0x53, 0xd2, 0x18, 0x02, 0x02, 0x00, 0x31, 0x11, 0x64,
+  0xb0, 0xe2, 0x18, 0x80, 0x8f, 0x53, 0xb0, 0x5b, 0x11, 0x64, 0x6e, 0x53, 0x14, 0x00, 0xf0, 0x03, 0xf0, 0x63, 0xd0, 0x63, 0x32, 0x6c, 0x52, 0x74, 0xd0, 0x63, 0x31, 0x74, 0xf0, 0x6b, 0xd0, 0x63,
+  0xb3, 0x1b, 0x6a, 0x03, 0xa0, 0x15, 0x2c, 0x15, 0x34, 0x35, 0x34, 0x35, 0x34, 0xf4, 0x2b, 0xda, 0x02, 0x31, 0x35, 0x34, 0x15, 0x0a, 0x00, 0x04, 0x82, 0x06, 0x24, 0x73, 0x1b, 0x60, 0x03, 0x10,
+  0x93, 0xf8, 0x02, 0x03, 0x4a, 0x03, 0x12, 0x73, 0xb0, 0x02, 0x02, 0xac, 0x06, 0x11, 0x23, 0xf6, 0x09, 0x21, 0x0b, 0xb3, 0x90, 0x0a, 0x02, 0x38, 0x0a, 0x41, 0x31, 0x03, 0x72, 0x13, 0x40, 0x03,
+  0x05, 0x46, 0x03, 0x22, 0x52, 0x13, 0x52, 0x07, 0x00, 0x0c, 0x00, 0x00, 0x66, 0x00, 0x20, 0x36, 0x3c, 0x82, 0x03, 0x44, 0xf5, 0x33, 0xb3, 0x23, 0x84, 0x0a, 0x00, 0xee, 0x06, 0x22, 0xf4, 0x2b,
+  0xb4, 0x03, 0x02, 0x36, 0x00, 0x62, 0x31, 0x0b, 0x72, 0x1b, 0x31, 0x03, 0xd6, 0x06, 0x02, 0x78, 0x0a, 0x00, 0x2c, 0x00, 0x02, 0x2a, 0x03, 0x10, 0x52, 0xee, 0x03, 0x03, 0x40, 0x07, 0x21, 0x11,
+  0x03, 0xd8, 0x0d, 0x01, 0x06, 0x07, 0x00, 0x34, 0x00, 0x05, 0x20, 0x07, 0x00, 0x20, 0x03, 0x10, 0x0b, 0x06, 0x07, 0x00, 0xe8, 0x06, 0x60, 0xf0, 0x02, 0x31, 0x03, 0x51, 0x0b, 0x04, 0x00, 0x02,
+  0x22, 0x07, 0x02, 0xa6, 0x03, 0x00, 0x68, 0x03, 0x02, 0x32, 0x0a, 0x11, 0x51, 0x40, 0x00, 0x04, 0x06, 0x00, 0x00, 0x2a, 0x04, 0x42, 0x93, 0x23, 0xd3, 0x2b, 0xc6, 0x06, 0x00, 0xee, 0x0d, 0x00,
+  0xe4, 0x09, 0x00, 0xb0, 0x0a, 0x20, 0x30, 0x13, 0x3e, 0x11, 0x30, 0xf0, 0x0a, 0x10, 0x8e, 0x18, 0x01, 0xbc, 0x0a, 0x02, 0x50, 0x0a, 0x00, 0x06, 0x00, 0x21, 0xf4, 0x2b, 0xb4, 0x03, 0x10, 0x1b,
+  0x98, 0x03, 0x82, 0x92, 0x1b, 0x51, 0x13, 0x14, 0x34, 0x55, 0x3c, 0x00, 0x07, 0x03, 0xfc, 0x06, 0x10, 0x2b, 0x38, 0x07, 0x20, 0x30, 0x13, 0x0e, 0x0e, 0x00, 0x52, 0x00, 0x10, 0xb2, 0x18, 0x00,
+  0x01, 0x22, 0x07, 0x11, 0x72, 0x5c, 0x03, 0x60, 0xb2, 0x23, 0x71, 0x1b, 0xf3, 0x33, 0x8c, 0x0a, 0x00, 0xfc, 0x06, 0x20, 0x30, 0x0b, 0x1a, 0x00, 0x00, 0x98, 0x0a, 0x20, 0x10, 0x0b, 0x48, 0x03,
+  0x00, 0xb2, 0x03, 0x11, 0x71, 0x68, 0x0a, 0x02, 0xee, 0x06, 0x60, 0xef, 0x02, 0x30, 0x1b, 0x10, 0x0b, 0x0a, 0x00, 0x00, 0x60, 0x03, 0x40, 0x10, 0x13, 0xef, 0x0a, 0x00, 0x07, 0x22, 0x30, 0x13,
+  0x10, 0x00, 0xe2, 0x91, 0x23, 0x50, 0x23, 0x50, 0x1b, 0x30, 0x1b, 0x50, 0x1b, 0xb2, 0x2b, 0xb1, 0x2b, 0x82, 0x03, 0x00, 0xec, 0x0d, 0x31, 0x70, 0x23, 0x70, 0xaa, 0x03, 0xe0, 0xb1, 0x2b, 0xb1,
+  0x33, 0xd2, 0x33, 0x50, 0x23, 0xd2, 0x33, 0x13, 0x3c, 0xf2, 0x3b, 0x6c, 0x03, 0x20, 0xb1, 0x33, 0x0c, 0x00, 0x11, 0x71, 0x62, 0x03, 0xb0, 0xb1, 0x33, 0x13, 0x44, 0x91, 0x2b, 0x70, 0x2b, 0x50,
+  0x23, 0x70, 0x70, 0x03, 0x10, 0x33, 0x06, 0x00, 0x00, 0x7e, 0x0a, 0x02, 0x02, 0x00, 0x11, 0x50, 0x14, 0x00, 0x20, 0xb1, 0x33, 0xe2, 0x06, 0x20, 0x33, 0x4c, 0xf8, 0x06, 0x00, 0x34, 0x18, 0x00,
+  0xea, 0x06, 0x00, 0x04, 0x00, 0x13, 0x70, 0x9e, 0x03, 0x20, 0xf2, 0x43, 0x18, 0x00, 0x00, 0xe2, 0x06, 0x40, 0x90, 0x33, 0x70, 0x33, 0x72, 0x03, 0xf0, 0x03, 0x74, 0x5c, 0x12, 0x4c, 0x95, 0x5c,
+  0x33, 0x4c, 0xf2, 0x43, 0x33, 0x54, 0xf2, 0x43, 0x70, 0x3b, 0x94, 0x5c, 0x6a, 0x03, 0x02, 0xec, 0x14, 0x00, 0xf0, 0x06, 0x00, 0x7a, 0x03, 0x40, 0x53, 0x54, 0xf2, 0x4b, 0xf6, 0x14, 0x00, 0x7a,
+  0x11, 0x20, 0x74, 0x5c, 0x0a, 0x07, 0x60, 0x74, 0x5c, 0x90, 0x3b, 0xd1, 0x4b, 0x68, 0x11, 0x52, 0xf1, 0x4b, 0xb0, 0x43, 0x90, 0x06, 0x15, 0x31, 0x43, 0x90, 0x3b, 0x44, 0x1f, 0x10, 0x4c, 0x08,
+  0x0e, 0xc0, 0x74, 0x64, 0xf2, 0x53, 0xb4, 0x6c, 0x53, 0x5c, 0xf1, 0x53, 0x90, 0x43, 0xea, 0x0d, 0x00, 0x8e, 0x03, 0x00, 0x56, 0x03, 0x11, 0x70, 0x7c, 0x1f, 0x00, 0xfc, 0x1b, 0x80, 0x90, 0x43,
+  0x8f, 0x43, 0x6f, 0x43, 0xd1, 0x53, 0x04, 0x07, 0x00, 0x46, 0x03, 0x04, 0x10, 0x07, 0x00, 0x6c, 0x0a, 0x20, 0x4e, 0x3b, 0x08, 0x00, 0x61, 0x4e, 0x43, 0x6f, 0x43, 0x11, 0x5c, 0x8c, 0x0a, 0x30,
+  0x53, 0x8f, 0x4b, 0x08, 0x00, 0x00, 0x84, 0x0a, 0x60, 0x8f, 0x4b, 0xd0, 0x53, 0xf1, 0x5b, 0x84, 0x03, 0x60, 0x8f, 0x4b, 0x2e, 0x3b, 0xf1, 0x5b, 0x42, 0x00, 0x20, 0x8f, 0x4b, 0x16, 0x00, 0x11,
+  0xb0, 0x7a, 0x03, 0x60, 0x6f, 0x4b, 0x6f, 0x4b, 0x2e, 0x43, 0x82, 0x03, 0x40, 0x32, 0x64, 0x6f, 0x4b, 0xd6, 0x11, 0x00, 0x16, 0x07, 0x01, 0xba, 0x11, 0x10, 0x63, 0x10, 0x00, 0x80, 0x31, 0x64,
+  0xd0, 0x5b, 0x2d, 0x43, 0xd0, 0x5b, 0x86, 0x03, 0xf1, 0x16, 0x32, 0x6c, 0x72, 0x74, 0xf1, 0x63, 0xf0, 0x63, 0x6f, 0x5b, 0xf0, 0x63, 0x11, 0x6c, 0x52, 0x74, 0x31, 0x74, 0xb3, 0x84, 0xf0, 0x6b,
+  0xcf, 0x6b, 0xaf, 0x63, 0x4d, 0x5b, 0xcf, 0x6b, 0xf0, 0x73, 0x15, 0x2c, 0xb3, 0x1b, 0x93, 0x0e, 0x03, 0xc0, 0x52, 0x03, 0xf0, 0x02, 0x52, 0x03, 0x93, 0x1b, 0xb3, 0x1b, 0xb3, 0x1b, 0x72, 0x06,
+  0x42, 0xb3, 0x1b, 0x72, 0x13, 0x96, 0x03, 0x00, 0xc4, 0x0a, 0x11, 0xd4, 0xba, 0x02, 0x00, 0x5a, 0x06, 0x00, 0x74, 0x03, 0x02, 0xca, 0x02, 0x02, 0xea, 0x06, 0x02, 0x7c, 0x0a, 0x00, 0x16, 0x00,
+  0x00, 0xc6, 0x03, 0x01, 0xda, 0x02, 0x11, 0x13, 0x2e, 0x0d, 0x52, 0x1b, 0xd3, 0x23, 0xd3, 0x23, 0x62, 0x07, 0x00, 0x62, 0x03, 0x22, 0xf4, 0x2b, 0xee, 0x03, 0x00, 0x48, 0x00, 0x01, 0x4a, 0x11,
+  0x03, 0x64, 0x0d, 0x11, 0x93, 0x2c, 0x00, 0x00, 0x5c, 0x00, 0x20, 0x15, 0x34, 0x64, 0x03, 0x01, 0x3c, 0x0a, 0x01, 0x14, 0x11, 0x20, 0xf4, 0x2b, 0x18, 0x00, 0x00, 0x7e, 0x00, 0x02, 0x12, 0x0a,
+  0x00, 0x60, 0x00, 0x02, 0x64, 0x00, 0x13, 0xd4, 0x22, 0x0a, 0x22, 0xb3, 0x23, 0xde, 0x06, 0x00, 0x0e, 0x00, 0x20, 0xd3, 0x23, 0x8a, 0x03, 0x02, 0x88, 0x03, 0x13, 0x93, 0x12, 0x0a, 0x02, 0x78,
+  0x0a, 0x02, 0x90, 0x07, 0x23, 0xb3, 0x23, 0xa0, 0x0d, 0x00, 0x38, 0x07, 0x11, 0x13, 0x30, 0x03, 0x00, 0x02, 0x00, 0x01, 0x9c, 0x11, 0x20, 0x10, 0x03, 0x2a, 0x11, 0x02, 0x54, 0x03, 0x02, 0xac,
+  0x11, 0x00, 0x90, 0x11, 0x13, 0xb3, 0x12, 0x00, 0x10, 0xb3, 0x00, 0x07, 0x12, 0x2b, 0x98, 0x0d, 0x02, 0x08, 0x00, 0x00, 0x72, 0x0d, 0x61, 0x35, 0x44, 0xd3, 0x33, 0xd3, 0x33, 0xec, 0x0d, 0x21,
+  0x2b, 0xd3, 0x44, 0x0a, 0x02, 0x66, 0x11, 0x00, 0xda, 0x0d, 0x42, 0xcf, 0x02, 0xef, 0x02, 0xe6, 0x0d, 0x60, 0x30, 0x0b, 0x30, 0x0b, 0x10, 0x03, 0x02, 0x07, 0x00, 0x06, 0x00, 0x10, 0x92, 0x4e,
+  0x07, 0x90, 0x33, 0x14, 0x3c, 0xd3, 0x33, 0x75, 0x44, 0xd6, 0x54, 0x64, 0x0a, 0x40, 0x55, 0x44, 0xb2, 0x2b, 0x78, 0x03, 0x80, 0x14, 0x3c, 0xd3, 0x2b, 0x30, 0x13, 0xd3, 0x33, 0x86, 0x0a, 0x00,
+  0x88, 0x11, 0x00, 0xe0, 0x06, 0x02, 0x02, 0x07, 0x00, 0x50, 0x0a, 0x00, 0x1a, 0x07, 0x00, 0xa0, 0x06, 0x00, 0x08, 0x00, 0x00, 0xd4, 0x0d, 0xa0, 0x50, 0x1b, 0x50, 0x1b, 0xce, 0x02, 0xae, 0x02,
+  0x50, 0x1b, 0x2c, 0x0a, 0x04, 0xfe, 0x06, 0x00, 0xf4, 0x06, 0x31, 0x13, 0x3c, 0xd2, 0x4e, 0x0a, 0x13, 0x50, 0xf6, 0x06, 0xa0, 0x13, 0x3c, 0x13, 0x44, 0xd2, 0x33, 0xf2, 0x3b, 0xb1, 0x33, 0xf6,
+  0x06, 0x00, 0xf2, 0x06, 0x00, 0x64, 0x0a, 0x00, 0x76, 0x03, 0x71, 0x70, 0x23, 0xee, 0x12, 0xce, 0x0a, 0x0f, 0x0e, 0x00, 0x42, 0x2f, 0x23, 0x2f, 0x23, 0xe2, 0x06, 0x10, 0x2f, 0x70, 0x0a, 0x10,
+  0x33, 0x34, 0x0a, 0x01, 0xba, 0x14, 0x21, 0x2b, 0xd2, 0x5c, 0x03, 0x00, 0x04, 0x00, 0x10, 0xf2, 0x52, 0x0a, 0x02, 0xb2, 0x14, 0x21, 0x33, 0xb1, 0x02, 0x00, 0x11, 0xd1, 0xd6, 0x06, 0xc0, 0x91,
+  0x33, 0xd1, 0x3b, 0x4f, 0x2b, 0xee, 0x22, 0xee, 0x1a, 0xb1, 0x3b, 0x06, 0x07, 0x20, 0x4f, 0x2b, 0x66, 0x0a, 0xa0, 0x33, 0x4c, 0xd1, 0x43, 0x53, 0x54, 0x13, 0x4c, 0x12, 0x4c, 0xc8, 0x06, 0x33,
+  0xb1, 0x3b, 0x12, 0xea, 0x06, 0x11, 0xd1, 0xbe, 0x14, 0xf0, 0x03, 0xee, 0x22, 0x4f, 0x33, 0xd1, 0x43, 0x0e, 0x2b, 0x2f, 0x33, 0x0e, 0x2b, 0x0e, 0x2b, 0x90, 0x43, 0x70, 0x3b, 0x62, 0x03, 0x02,
+  0xd0, 0x22, 0x20, 0xcd, 0x22, 0x02, 0x00, 0xc0, 0xee, 0x2a, 0x0e, 0x2b, 0x2e, 0x33, 0xcd, 0x22, 0x2e, 0x33, 0xee, 0x2a, 0x26, 0x00, 0x40, 0x4b, 0x12, 0xcd, 0x22, 0x26, 0x00, 0x00, 0xb2, 0x03,
+  0x22, 0x6f, 0x3b, 0x0e, 0x15, 0x11, 0x6f, 0x86, 0x1f, 0x20, 0x4f, 0x33, 0x2a, 0x00, 0x00, 0xf0, 0x14, 0x51, 0x2e, 0x33, 0x2e, 0x33, 0x90, 0x64, 0x03, 0xc0, 0xee, 0x32, 0xed, 0x32, 0x2f, 0x3b,
+  0xb0, 0x43, 0x4f, 0x3b, 0xb0, 0x4b, 0x9e, 0x03, 0x60, 0xd1, 0x4b, 0x0e, 0x33, 0xb0, 0x4b, 0x10, 0x0e, 0x60, 0x94, 0x64, 0x11, 0x54, 0xd1, 0x4b, 0x70, 0x0a, 0x00, 0x9a, 0x03, 0x00, 0x0c, 0x07,
+  0x40, 0x12, 0x5c, 0x32, 0x5c, 0x9e, 0x03, 0x00, 0x06, 0x00, 0xc0, 0x32, 0x5c, 0x52, 0x64, 0x8f, 0x4b, 0xf0, 0x53, 0x8f, 0x4b, 0x52, 0x64, 0x0a, 0x00, 0x10, 0xd0, 0xc2, 0x1f, 0x10, 0x4b, 0x66,
+  0x03, 0x00, 0x80, 0x03, 0x30, 0xed, 0x3a, 0xb0, 0x26, 0x00, 0x40, 0x53, 0x32, 0x64, 0xd0, 0x2e, 0x07, 0x81, 0x5b, 0x8f, 0x4b, 0x6f, 0x4b, 0x4f, 0x4b, 0x90, 0xc6, 0x18, 0x11, 0xb0, 0xe0, 0x1f,
+  0x00, 0x88, 0x0a, 0x22, 0x8f, 0x53, 0xbc, 0x11, 0x21, 0x90, 0x5b, 0xb0, 0x11, 0xf0, 0x25, 0x5b, 0x8f, 0x53, 0x6e, 0x4b, 0x11, 0x64, 0x72, 0x74, 0x52, 0x6c, 0xf1, 0x63, 0x8f, 0x5b, 0x8f, 0x5b,
+  0x2d, 0x53, 0xd0, 0x6b, 0xf0, 0x6b, 0x52, 0x7c, 0x72, 0x7c, 0x31, 0x74, 0xd0, 0x6b, 0x8e, 0x63, 0x8e, 0x6b, 0x4d, 0x63, 0xef, 0x73, 0x91, 0x8c, 0x13, 0x9d, 0x95, 0xad, 0x54, 0xa5, 0x93, 0x1b,
+  0xf4, 0x23, 0x56, 0xe8, 0x02, 0x31, 0x2c, 0xd4, 0x23, 0xcc, 0x09, 0x60, 0x2c, 0xd3, 0x23, 0xd4, 0x23, 0xf4, 0xae, 0x09, 0x31, 0x0b, 0x72, 0x13, 0x9a, 0x03, 0x00, 0x48, 0x03, 0x01, 0x90, 0x0a,
+  0x02, 0x9a, 0x0a, 0x80, 0x93, 0x23, 0xd4, 0x2b, 0x35, 0x34, 0xd4, 0x2b, 0x3e, 0x06, 0x00, 0x1c, 0x03, 0x91, 0x35, 0x34, 0x35, 0x3c, 0x55, 0x3c, 0x35, 0x3c, 0xf4, 0xec, 0x02, 0x00, 0x8c, 0x03,
+  0x77, 0x35, 0x34, 0x14, 0x34, 0x92, 0x1b, 0x92, 0x2c, 0x0a, 0x12, 0x72, 0x96, 0x14, 0x03, 0x06, 0x07, 0x00, 0xe4, 0x02, 0x00, 0xc6, 0x15, 0x13, 0x72, 0x2e, 0x0a, 0x05, 0x5c, 0x03, 0x05, 0xb4,
+  0x06, 0x01, 0xde, 0x10, 0x00, 0x0e, 0x00, 0x21, 0x2b, 0x52, 0x10, 0x03, 0x02, 0xde, 0x06, 0x22, 0x31, 0x0b, 0x70, 0x03, 0x11, 0x72, 0x5a, 0x0e, 0x10, 0x72, 0x78, 0x0d, 0x12, 0x23, 0x12, 0x0a,
+  0x00, 0x84, 0x03, 0x00, 0x06, 0x0e, 0x02, 0x1c, 0x07, 0x20, 0x51, 0x13, 0x9e, 0x14, 0x02, 0x84, 0x03, 0x02, 0xf8, 0x06, 0x01, 0xa4, 0x11, 0x10, 0x0b, 0x10, 0x00, 0x00, 0x1a, 0x03, 0x20, 0xd4,
+  0x2b, 0x9e, 0x00, 0x02, 0x98, 0x0d, 0x41, 0x55, 0x44, 0x35, 0x3c, 0x90, 0x0d, 0x14, 0x33, 0xb4, 0x25, 0x20, 0x35, 0x3c, 0x04, 0x00, 0x22, 0x35, 0x3c, 0x58, 0x0a, 0x11, 0x51, 0xf6, 0x17, 0x03,
+  0x74, 0x1b, 0x31, 0x1b, 0x92, 0x23, 0x2a, 0x00, 0x36, 0x3b, 0x35, 0x44, 0x1e, 0x11, 0x02, 0xfc, 0x06, 0x00, 0x78, 0x06, 0x20, 0x34, 0x3c, 0xca, 0x06, 0x20, 0xb3, 0x2b, 0x52, 0x03, 0x01, 0xe0,
+  0x14, 0x03, 0x62, 0x0a, 0x11, 0xd3, 0x06, 0x00, 0x00, 0x48, 0x0a, 0x43, 0x13, 0x3c, 0xb2, 0x2b, 0x7a, 0x0a, 0x30, 0x3b, 0xd2, 0x33, 0xc2, 0x0d, 0x00, 0x6c, 0x03, 0x02, 0xc2, 0x06, 0x50, 0x92,
+  0x2b, 0xd2, 0x33, 0x51, 0xdc, 0x06, 0x01, 0xd8, 0x06, 0x00, 0x7e, 0x03, 0x00, 0x64, 0x03, 0x40, 0xd2, 0x33, 0xb2, 0x2b, 0x64, 0x03, 0x03, 0x30, 0x11, 0x10, 0x2b, 0xa6, 0x0d, 0xc0, 0x13, 0x3c,
+  0xb6, 0x54, 0x95, 0x54, 0x17, 0x65, 0xf7, 0x5c, 0xd2, 0x33, 0x14, 0x00, 0x00, 0xd4, 0x0d, 0x80, 0x0f, 0x1b, 0xb2, 0x33, 0x54, 0x44, 0x54, 0x4c, 0x40, 0x03, 0x80, 0x34, 0x44, 0x13, 0x44, 0x33,
+  0x44, 0x33, 0x44, 0x42, 0x03, 0x11, 0x70, 0x4a, 0x0a, 0x02, 0x62, 0x0a, 0x00, 0x9a, 0x03, 0x30, 0x70, 0x2b, 0x91, 0x10, 0x07, 0x12, 0x3b, 0x4e, 0x0a, 0x00, 0x02, 0x00, 0x11, 0xf2, 0xda, 0x06,
+  0x40, 0x0e, 0x1b, 0x50, 0x2b, 0x50, 0x0a, 0x00, 0xd8, 0x06, 0x11, 0x70, 0x32, 0x1f, 0x20, 0xf2, 0x43, 0x30, 0x0a, 0x40, 0x90, 0x33, 0x0f, 0x23, 0x9c, 0x03, 0x00, 0xfc, 0x06, 0x00, 0x62, 0x0a,
+  0x11, 0xd1, 0xcc, 0x0d, 0x20, 0xd1, 0x3b, 0x7e, 0x0a, 0xa0, 0x70, 0x2b, 0x0e, 0x23, 0x0e, 0x23, 0xd1, 0x43, 0x70, 0x33, 0xe6, 0x14, 0x11, 0x90, 0x1e, 0x07, 0x02, 0x24, 0x07, 0x80, 0x90, 0x3b,
+  0x2f, 0x2b, 0xed, 0x22, 0x70, 0x33, 0xa8, 0x03, 0x30, 0x2e, 0x2b, 0xb0, 0x3c, 0x03, 0xf0, 0x06, 0x33, 0x2f, 0x33, 0x4f, 0x33, 0x4f, 0x33, 0x6f, 0x3b, 0x4f, 0x33, 0xb1, 0x43, 0x12, 0x54, 0x0e,
+  0x2b, 0xd1, 0x4b, 0xd1, 0x43, 0xf2, 0x06, 0xa0, 0x2f, 0x33, 0xee, 0x2a, 0x0e, 0x33, 0x4f, 0x3b, 0xf1, 0x4b, 0xda, 0x0d, 0x60, 0x74, 0x64, 0x33, 0x5c, 0xf2, 0x53, 0xa2, 0x0a, 0x00, 0x7a, 0x18,
+  0xf1, 0x00, 0x4f, 0x3b, 0x12, 0x4c, 0x73, 0x5c, 0x6f, 0x3b, 0xb1, 0x43, 0x73, 0x5c, 0x32, 0x54, 0xb0, 0xf8, 0x22, 0x00, 0x3e, 0x07, 0x00, 0x10, 0x07, 0x30, 0xb0, 0x43, 0x2f, 0x54, 0x00, 0x30,
+  0x3b, 0x6f, 0x3b, 0xc6, 0x0a, 0x42, 0xf2, 0x4b, 0x4f, 0x3b, 0x0c, 0x23, 0x20, 0x12, 0x54, 0x0c, 0x0e, 0x00, 0x24, 0x0e, 0x60, 0x4f, 0x3b, 0xf1, 0x53, 0x94, 0x64, 0x98, 0x1f, 0xa0, 0xb4, 0x6c,
+  0x94, 0x64, 0x12, 0x5c, 0x52, 0x5c, 0x73, 0x64, 0x1c, 0x15, 0x24, 0x94, 0x6c, 0x1c, 0x15, 0x00, 0x90, 0x03, 0x11, 0x52, 0xbe, 0x11, 0x22, 0xd0, 0x53, 0xa4, 0x11, 0x00, 0x12, 0x0e, 0x02, 0x20,
+  0x07, 0x00, 0x86, 0x0a, 0xf0, 0x0b, 0x2e, 0x3b, 0xcc, 0x32, 0xcc, 0x32, 0x4e, 0x43, 0xb0, 0x53, 0xcc, 0x32, 0x2e, 0x43, 0xf1, 0x5b, 0xed, 0x3a, 0xd0, 0x5b, 0xf1, 0x5b, 0x09, 0x1a, 0x2e, 0x43,
+  0x02, 0x00, 0x20, 0x6f, 0x4b, 0x6e, 0x03, 0x11, 0x0d, 0x08, 0x00, 0x20, 0xf1, 0x63, 0x50, 0x1c, 0x20, 0xf1, 0x5b, 0x08, 0x0e, 0x51, 0x32, 0x6c, 0x32, 0x6c, 0xb0, 0x8a, 0x0a, 0xf0, 0x0d, 0x31,
+  0x6c, 0x72, 0x74, 0x92, 0x74, 0x52, 0x74, 0xf0, 0x63, 0x8f, 0x5b, 0x52, 0x74, 0xaf, 0x63, 0x52, 0x7c, 0x72, 0x84, 0xb3, 0x84, 0x11, 0x74, 0x10, 0x74, 0xf0, 0x73, 0x88, 0x03, 0xf0, 0x04, 0xcf,
+  0x73, 0x92, 0x94, 0x50, 0x8c, 0x13, 0xa5, 0x33, 0xa5, 0xd6, 0xbd, 0xf6, 0xc5, 0x17, 0xc6, 0x91, 0x94, 0xd4, 0x2e, 0x0d, 0x01, 0x02, 0x0a, 0x10, 0x93, 0xd2, 0x06, 0x00, 0x3e, 0x06, 0x40, 0x13,
+  0x92, 0x13, 0xb3, 0x4c, 0x03, 0x10, 0x1b, 0x48, 0x0d, 0x00, 0x4e, 0x06, 0x02, 0xc6, 0x0d, 0x00, 0xae, 0x06, 0x00, 0x60, 0x0d, 0x00, 0xf4, 0x06, 0x00, 0xfa, 0x06, 0x03, 0x68, 0x0d, 0x01, 0x56,
+  0x03, 0x00, 0xf2, 0x02, 0x02, 0x8a, 0x06, 0x02, 0x30, 0x00, 0x00, 0xa4, 0x09, 0xc1, 0x76, 0x44, 0x76, 0x3c, 0xb7, 0x4c, 0x56, 0x3c, 0x56, 0x3c, 0x35, 0x34, 0xe0, 0x06, 0x01, 0x3a, 0x07, 0x00,
+  0x0a, 0x00, 0x02, 0x50, 0x07, 0x06, 0x26, 0x0a, 0x11, 0x92, 0xea, 0x09, 0x00, 0x20, 0x0a, 0x11, 0x56, 0x1c, 0x03, 0x40, 0xf4, 0x33, 0x76, 0x44, 0xe2, 0x03, 0x10, 0xd3, 0x6e, 0x07, 0x01, 0xe4,
+  0x09, 0x04, 0x86, 0x14, 0x01, 0xde, 0x28, 0x21, 0x23, 0xb3, 0x82, 0x00, 0x00, 0x8e, 0x03, 0x02, 0x22, 0x00, 0x02, 0xa0, 0x06, 0x02, 0x06, 0x00, 0x20, 0x14, 0x34, 0xbc, 0x0d, 0x00, 0x64, 0x0a,
+  0x02, 0x88, 0x0d, 0x02, 0x78, 0x0a, 0x02, 0x2c, 0x07, 0x03, 0x6e, 0x00, 0x03, 0xb0, 0x0d, 0x02, 0x30, 0x00, 0x00, 0x24, 0x00, 0x02, 0x46, 0x03, 0x00, 0xd8, 0x06, 0x00, 0x36, 0x00, 0x11, 0xaf,
+  0x38, 0x15, 0x02, 0x50, 0x18, 0x00, 0x38, 0x18, 0x60, 0x55, 0x4c, 0x55, 0x44, 0x55, 0x44, 0x2e, 0x0e, 0x00, 0xcc, 0x06, 0x02, 0xde, 0x06, 0x00, 0x86, 0x14, 0x10, 0xf3, 0x36, 0x29, 0x01, 0x0e,
+  0x00, 0x00, 0x02, 0x00, 0x00, 0xc8, 0x06, 0x02, 0x04, 0x00, 0x00, 0x12, 0x00, 0x62, 0x54, 0x44, 0x34, 0x44, 0x34, 0x3c, 0xec, 0x06, 0x20, 0xf3, 0x33, 0x86, 0x03, 0x00, 0x6e, 0x03, 0x11, 0x91,
+  0x8a, 0x03, 0x10, 0x91, 0xa4, 0x14, 0x00, 0xe0, 0x25, 0x01, 0x92, 0x0d, 0x22, 0xef, 0x12, 0xcc, 0x06, 0x02, 0x2c, 0x18, 0x20, 0xf3, 0x3b, 0xee, 0x0d, 0x00, 0x40, 0x0a, 0x11, 0xb2, 0x20, 0x11,
+  0x11, 0xf3, 0x40, 0x11, 0x13, 0xb1, 0xbc, 0x0d, 0x11, 0x91, 0x9e, 0x0d, 0x62, 0x0f, 0x1b, 0x30, 0x23, 0x2f, 0x23, 0x4c, 0x03, 0x20, 0xb2, 0x33, 0x5e, 0x03, 0x01, 0xf0, 0x06, 0x01, 0x10, 0x00,
+  0x02, 0x22, 0x18, 0x20, 0x91, 0x33, 0xa4, 0x0d, 0x00, 0xf4, 0x06, 0x11, 0x50, 0x52, 0x0a, 0x13, 0xd1, 0xd0, 0x0d, 0x00, 0x06, 0x00, 0x20, 0x54, 0x4c, 0x02, 0x00, 0x60, 0x91, 0x33, 0x90, 0x33,
+  0xf2, 0x3b, 0x02, 0x00, 0x11, 0x91, 0xe6, 0x06, 0xc0, 0x12, 0x44, 0x33, 0x4c, 0xd1, 0x3b, 0x53, 0x54, 0x74, 0x54, 0x12, 0x44, 0xba, 0x0d, 0x00, 0x02, 0x00, 0x00, 0x4e, 0x03, 0x02, 0x62, 0x03,
+  0x22, 0xd1, 0x3b, 0x5e, 0x0a, 0x20, 0x33, 0x4c, 0xe6, 0x06, 0x00, 0x5e, 0x0a, 0x11, 0xf2, 0xce, 0x0d, 0x00, 0x9c, 0x03, 0x00, 0x48, 0x18, 0x00, 0x78, 0x0a, 0x00, 0xc8, 0x0d, 0x02, 0x8a, 0x03,
+  0x00, 0x06, 0x07, 0x02, 0x6e, 0x11, 0x41, 0x32, 0x54, 0x53, 0x54, 0x08, 0x00, 0x00, 0x3a, 0x0a, 0x01, 0xc6, 0x1b, 0xc2, 0xb0, 0x43, 0x12, 0x54, 0x94, 0x64, 0xf2, 0x4b, 0xd5, 0x6c, 0x74, 0x5c,
+  0x06, 0x0e, 0x40, 0xf1, 0x4b, 0x53, 0x5c, 0x86, 0x03, 0x20, 0x53, 0x5c, 0x70, 0x18, 0x00, 0x52, 0x03, 0x00, 0x06, 0x00, 0x62, 0xf1, 0x53, 0x12, 0x54, 0xf2, 0x53, 0x10, 0x0e, 0x00, 0x10, 0x00,
+  0x51, 0x6f, 0x3b, 0x0e, 0x33, 0x4f, 0x7c, 0x03, 0x00, 0x0a, 0x07, 0x40, 0xcd, 0x22, 0x6f, 0x3b, 0x9c, 0x03, 0x00, 0xb0, 0x11, 0x31, 0x90, 0x3b, 0x33, 0xa8, 0x11, 0x31, 0xd1, 0x4b, 0x33, 0x86,
+  0x18, 0x00, 0x1a, 0x0e, 0x20, 0x53, 0x5c, 0x0c, 0x15, 0x00, 0x1a, 0x15, 0x20, 0x93, 0x64, 0xa2, 0x26, 0x02, 0x24, 0x07, 0x02, 0x0a, 0x00, 0x11, 0x8f, 0xac, 0x11, 0x11, 0xb0, 0x98, 0x11, 0x01,
+  0xea, 0x0d, 0x72, 0x4b, 0x2e, 0x3b, 0x6f, 0x43, 0xf1, 0x53, 0x0e, 0x00, 0x20, 0xf1, 0x53, 0xa8, 0x0a, 0x00, 0xae, 0x18, 0x11, 0x4e, 0x80, 0x0a, 0xf0, 0x0e, 0xf0, 0x5b, 0x93, 0x6c, 0xd4, 0x7c,
+  0x32, 0x64, 0x11, 0x64, 0x56, 0x8d, 0x15, 0x85, 0x31, 0x64, 0x31, 0x64, 0xf5, 0x84, 0xb4, 0x7c, 0x52, 0x6c, 0x73, 0x6c, 0x11, 0x64, 0x73, 0x6e, 0x23, 0xa0, 0x6c, 0x72, 0x6c, 0xb4, 0x74, 0x72,
+  0x6c, 0x52, 0x6c, 0x52, 0x90, 0x11, 0x01, 0x3a, 0x15, 0xf2, 0x2f, 0x11, 0x6c, 0x11, 0x6c, 0xf1, 0x6b, 0xd4, 0x84, 0x31, 0x6c, 0x11, 0x6c, 0xf0, 0x6b, 0xf0, 0x6b, 0x31, 0x74, 0x10, 0x6c, 0x51,
+  0x7c, 0x92, 0x84, 0xd3, 0x8c, 0x31, 0x7c, 0x4d, 0x63, 0x4d, 0x63, 0xaf, 0x73, 0x31, 0x84, 0x92, 0x8c, 0xb3, 0x94, 0x34, 0xa5, 0x38, 0xc6, 0x18, 0xc6, 0x58, 0xd6, 0xf2, 0xa4, 0xb5, 0xbd, 0x74,
+  0xbd, 0x74, 0xbd, 0x33, 0xb5, 0xb1, 0xa4, 0x53, 0xb5, 0x36, 0x0e, 0x00, 0x14, 0x07, 0x20, 0xd3, 0x23, 0xee, 0x10, 0x02, 0x06, 0x00, 0x00, 0x12, 0x07, 0x00, 0xb0, 0x0a, 0x01, 0xa8, 0x14, 0x10,
+  0x13, 0x76, 0x0d, 0x04, 0x1a, 0x0a, 0x04, 0x74, 0x0d, 0xb1, 0x15, 0x34, 0x14, 0x34, 0x14, 0x34, 0x76, 0x3c, 0x35, 0x3c, 0x56, 0x1c, 0x07, 0x21, 0x55, 0x3c, 0xbe, 0x10, 0x10, 0x33, 0x88, 0x03,
+  0x00, 0x4a, 0x03, 0x60, 0xb2, 0x23, 0x51, 0x13, 0xf0, 0x02, 0x02, 0x00, 0x21, 0x10, 0x03, 0xd0, 0x10, 0x12, 0x1b, 0x94, 0x06, 0x20, 0x14, 0x34, 0x0a, 0x00, 0x00, 0x84, 0x03, 0x03, 0x3c, 0x2c,
+  0x01, 0x6c, 0x0d, 0x12, 0xb3, 0x5a, 0x03, 0x03, 0x72, 0x03, 0x00, 0xdc, 0x09, 0x11, 0x92, 0x00, 0x11, 0x01, 0x28, 0x0a, 0x00, 0x16, 0x03, 0x01, 0x6e, 0x00, 0x00, 0x42, 0x03, 0x11, 0x72, 0x2c,
+  0x00, 0x31, 0xf3, 0x2b, 0xf3, 0x14, 0x00, 0x02, 0xd8, 0x06, 0x42, 0xb3, 0x2b, 0x10, 0x0b, 0xbc, 0x06, 0x20, 0x92, 0x2b, 0xe0, 0x0d, 0x00, 0x38, 0x0a, 0x11, 0x14, 0xe6, 0x06, 0x00, 0x46, 0x03,
+  0x24, 0x35, 0x3c, 0xf6, 0x06, 0x20, 0xd3, 0x33, 0xae, 0x14, 0x00, 0x30, 0x03, 0x00, 0xd2, 0x07, 0x00, 0xae, 0x1b, 0x13, 0xb2, 0xfa, 0x10, 0x20, 0x14, 0x3c, 0x5a, 0x0d, 0x00, 0x66, 0x11, 0x44,
+  0x35, 0x44, 0x55, 0x44, 0x80, 0x03, 0x22, 0x34, 0x3c, 0x70, 0x03, 0x01, 0x10, 0x18, 0x03, 0x84, 0x03, 0x00, 0x0a, 0x00, 0x30, 0x10, 0x1b, 0x51, 0x7e, 0x1b, 0x41, 0x2b, 0xd3, 0x3b, 0x71, 0x98,
+  0x1b, 0x00, 0x7a, 0x1b, 0xf0, 0x02, 0x34, 0x44, 0x54, 0x44, 0x13, 0x3c, 0x14, 0x44, 0xf3, 0x3b, 0xf3, 0x3b, 0x71, 0x2b, 0xef, 0x12, 0x0f, 0xca, 0x25, 0x10, 0x13, 0x32, 0x0a, 0x00, 0xc8, 0x0d,
+  0x00, 0xd4, 0x06, 0x42, 0x54, 0x44, 0xf2, 0x3b, 0x88, 0x14, 0x00, 0xe4, 0x25, 0x11, 0x50, 0x02, 0x07, 0x02, 0x0e, 0x0a, 0x00, 0x7c, 0x03, 0x13, 0x70, 0x9c, 0x14, 0x00, 0x1c, 0x0a, 0x02, 0x52,
+  0x03, 0x71, 0xb1, 0x33, 0x54, 0x4c, 0x34, 0x44, 0xd2, 0x3e, 0x11, 0x44, 0xb1, 0x33, 0xf3, 0x43, 0x8a, 0x0d, 0x51, 0x54, 0x4c, 0xb1, 0x3b, 0x70, 0x2a, 0x03, 0x00, 0x2a, 0x00, 0x00, 0x96, 0x14,
+  0x02, 0x1a, 0x18, 0x02, 0x18, 0x1f, 0x30, 0xb1, 0x3b, 0x50, 0xe4, 0x0d, 0x80, 0x3b, 0x12, 0x44, 0xd2, 0x3b, 0xd1, 0x3b, 0xd1, 0x26, 0x11, 0x01, 0x2c, 0x18, 0x00, 0x52, 0x00, 0xb1, 0x2f, 0x2b,
+  0xce, 0x1a, 0xce, 0x1a, 0x0e, 0x23, 0x0f, 0x23, 0x50, 0x56, 0x11, 0x00, 0xce, 0x14, 0x04, 0x62, 0x03, 0x42, 0x90, 0x3b, 0x50, 0x33, 0x04, 0x00, 0x00, 0x5c, 0x18, 0x00, 0xb0, 0x1b, 0x20, 0x33,
+  0x4c, 0xb6, 0x0d, 0x60, 0xb1, 0x3b, 0x13, 0x4c, 0x54, 0x54, 0xda, 0x0d, 0x00, 0x56, 0x1f, 0x02, 0xdc, 0x29, 0x00, 0x34, 0x00, 0x60, 0x0e, 0x2b, 0x70, 0x3b, 0x33, 0x54, 0x7c, 0x03, 0x00, 0x44,
+  0x0a, 0x00, 0xd0, 0x06, 0x00, 0x98, 0x03, 0xe0, 0xb5, 0x64, 0x53, 0x54, 0x73, 0x5c, 0xb4, 0x64, 0x94, 0x5c, 0x73, 0x5c, 0x73, 0x5c, 0xec, 0x0d, 0x00, 0x2c, 0x00, 0x60, 0x2f, 0x33, 0x6f, 0x3b,
+  0xf2, 0x4b, 0x68, 0x11, 0x00, 0xd6, 0x22, 0x00, 0x08, 0x00, 0x20, 0xf1, 0x4b, 0x86, 0x18, 0x00, 0x86, 0x03, 0x40, 0xb0, 0x43, 0xd1, 0x4b, 0x6a, 0x11, 0x31, 0x6f, 0x43, 0xd1, 0xd2, 0x0d, 0x02,
+  0x06, 0x15, 0x20, 0xb0, 0x43, 0x02, 0x00, 0x00, 0x26, 0x00, 0x00, 0x52, 0x18, 0x00, 0x14, 0x00, 0x00, 0x16, 0x00, 0x00, 0x54, 0x00, 0xa0, 0xf5, 0x6c, 0x57, 0x7d, 0x16, 0x75, 0xb4, 0x64, 0xf5,
+  0x74, 0x72, 0x03, 0x00, 0x00, 0x07, 0x11, 0x73, 0xc8, 0x03, 0x60, 0x53, 0x5c, 0xb0, 0x4b, 0xee, 0x32, 0x0e, 0x0e, 0x31, 0x2e, 0x3b, 0x2e, 0x14, 0x15, 0x60, 0x4f, 0x43, 0x2e, 0x33, 0xac, 0x22,
+  0x56, 0x00, 0x11, 0x8f, 0x8e, 0x03, 0x20, 0xb0, 0x4b, 0x5a, 0x0e, 0x00, 0x84, 0x11, 0x22, 0x90, 0x4b, 0x80, 0x11, 0x20, 0xb0, 0x4b, 0x1a, 0x07, 0x00, 0x18, 0x0e, 0x00, 0xa8, 0x11, 0x11, 0x11,
+  0xb6, 0x0a, 0xa0, 0x73, 0x6c, 0x11, 0x5c, 0x73, 0x6c, 0xf1, 0x5b, 0x32, 0x64, 0x48, 0x1c, 0x60, 0x93, 0x6c, 0xb3, 0x74, 0xf5, 0x84, 0x88, 0x03, 0xd1, 0xd4, 0x7c, 0x72, 0x74, 0xaf, 0x5b, 0xf1,
+  0x63, 0x0d, 0x4b, 0xec, 0x42, 0xaf, 0x0a, 0x0e, 0x20, 0xf0, 0x63, 0x7a, 0x03, 0x20, 0x11, 0x64, 0xdc, 0x1f, 0x40, 0xf0, 0x63, 0xf0, 0x63, 0x8a, 0x03, 0x40, 0x31, 0x6c, 0xd0, 0x63, 0x86, 0x03,
+  0xf1, 0x2d, 0x10, 0x6c, 0x31, 0x74, 0x31, 0x74, 0x51, 0x74, 0x31, 0x74, 0x10, 0x74, 0xef, 0x73, 0x8e, 0x6b, 0x6d, 0x63, 0xcf, 0x73, 0x10, 0x7c, 0x71, 0x8c, 0xb6, 0xb5, 0xd7, 0xbd, 0x38, 0xc6,
+  0x38, 0xce, 0x79, 0xd6, 0x58, 0xce, 0x38, 0xce, 0xf7, 0xc5, 0x54, 0xad, 0x50, 0x94, 0x95, 0xbd, 0x16, 0xce, 0xb5, 0xc5, 0x16, 0xd6, 0xb1, 0xa4, 0x73, 0xbd, 0x74, 0xbd, 0xd3, 0x23, 0xca, 0x11,
+  0x00, 0x46, 0x03, 0x41, 0x34, 0x76, 0x44, 0xf4, 0xe4, 0x06, 0x12, 0xd3, 0x02, 0x15, 0x01, 0x6a, 0x14, 0x00, 0x04, 0x07, 0x02, 0x62, 0x15, 0x00, 0x6e, 0x03, 0x00, 0x5a, 0x0a, 0x02, 0xa6, 0x0a,
+  0x20, 0xd3, 0x23, 0xf6, 0x09, 0x22, 0x11, 0x03, 0xda, 0x06, 0x13, 0x92, 0xbe, 0x06, 0x22, 0xf4, 0x33, 0x3a, 0x1b, 0x11, 0x71, 0x70, 0x03, 0x10, 0x35, 0x24, 0x07, 0x20, 0x44, 0x15, 0x5e, 0x00,
+  0x00, 0xd2, 0x0a, 0x23, 0x34, 0x14, 0xfc, 0x03, 0x10, 0xf4, 0xde, 0x06, 0x32, 0x2b, 0xf4, 0x2b, 0xac, 0x06, 0x11, 0xb2, 0x78, 0x14, 0x11, 0xf3, 0x64, 0x03, 0x00, 0x6c, 0x03, 0x02, 0x2e, 0x0a,
+  0x50, 0x14, 0x34, 0xf4, 0x33, 0x14, 0x0a, 0x0b, 0x40, 0x44, 0x76, 0x4c, 0x55, 0xe2, 0x03, 0x10, 0x33, 0x2e, 0x03, 0x20, 0x55, 0x44, 0x2a, 0x00, 0x91, 0xf4, 0x33, 0x34, 0x34, 0x34, 0x3c, 0xf3,
+  0x2b, 0xd3, 0x8e, 0x06, 0x02, 0xba, 0x06, 0x20, 0xb6, 0x54, 0x44, 0x03, 0x00, 0x20, 0x00, 0x00, 0xfc, 0x17, 0x00, 0x4a, 0x03, 0x03, 0x42, 0x11, 0x12, 0x23, 0xec, 0x1b, 0x20, 0xd3, 0x33, 0x80,
+  0x03, 0x01, 0x62, 0x03, 0x11, 0x34, 0xd4, 0x06, 0x12, 0x2b, 0x58, 0x0a, 0x00, 0x90, 0x03, 0x00, 0xf0, 0x06, 0x66, 0xf3, 0x33, 0x34, 0x3c, 0xb2, 0x2b, 0x80, 0x03, 0x00, 0x28, 0x0a, 0x02, 0xa6,
+  0x06, 0xf3, 0x18, 0xf3, 0x3b, 0x34, 0x44, 0x34, 0x44, 0x55, 0x4c, 0x75, 0x4c, 0x13, 0x3c, 0xf3, 0x3b, 0x13, 0x3c, 0x13, 0x3c, 0x75, 0x4c, 0x55, 0x4c, 0x34, 0x4c, 0x95, 0x54, 0xb6, 0x5c, 0xd6,
+  0x5c, 0x95, 0x54, 0x75, 0x4c, 0x95, 0x54, 0x13, 0x44, 0xd2, 0x1e, 0x03, 0x52, 0xd3, 0x3b, 0x91, 0x33, 0xf3, 0x0a, 0x0a, 0x30, 0x33, 0x75, 0x4c, 0x52, 0x03, 0x00, 0x2c, 0x07, 0x22, 0x13, 0x3c,
+  0x3c, 0x00, 0x11, 0x33, 0x4a, 0x0a, 0x40, 0x34, 0x44, 0x33, 0x44, 0x1c, 0x00, 0x00, 0x36, 0x00, 0x21, 0x33, 0x44, 0x46, 0x14, 0x70, 0x3b, 0x74, 0x54, 0x33, 0x44, 0x74, 0x4c, 0x1e, 0x00, 0x10,
+  0xf3, 0x28, 0x0a, 0x00, 0x3a, 0x00, 0x81, 0x4c, 0x33, 0x44, 0x74, 0x54, 0x13, 0x44, 0x54, 0x0c, 0x00, 0x00, 0xa8, 0x0d, 0x00, 0x04, 0x18, 0x11, 0xb1, 0x66, 0x00, 0x11, 0xd2, 0xfe, 0x10, 0x00,
+  0x16, 0x18, 0x02, 0x1e, 0x18, 0x21, 0x91, 0x33, 0x56, 0x18, 0x01, 0x10, 0x00, 0x40, 0x74, 0x54, 0x74, 0x5c, 0x08, 0x00, 0x00, 0xbc, 0x06, 0x00, 0x32, 0x03, 0x04, 0x14, 0x26, 0x20, 0x13, 0x4c,
+  0xe6, 0x06, 0x20, 0xb5, 0x5c, 0x60, 0x03, 0x20, 0xf3, 0x4b, 0x04, 0x00, 0x00, 0x1a, 0x00, 0x02, 0x36, 0x18, 0x20, 0x33, 0x54, 0x64, 0x11, 0x11, 0x54, 0x06, 0x00, 0x30, 0x12, 0x4c, 0xf2, 0x54,
+  0x26, 0x23, 0x3b, 0x13, 0xf8, 0x0d, 0x00, 0x08, 0x00, 0x02, 0x0a, 0x31, 0x62, 0xd2, 0x4b, 0x12, 0x4c, 0x94, 0x5c, 0xfe, 0x06, 0x00, 0x88, 0x03, 0x10, 0x70, 0x98, 0x0a, 0x10, 0x33, 0x66, 0x00,
+  0x00, 0x0e, 0x0e, 0x11, 0xb1, 0xd4, 0x0d, 0x40, 0x90, 0x43, 0xd1, 0x43, 0xe0, 0x0d, 0x40, 0x2f, 0x33, 0x90, 0x43, 0x52, 0x11, 0x00, 0x66, 0x0a, 0x20, 0x94, 0x64, 0xc0, 0x06, 0x80, 0x4f, 0x3b,
+  0xee, 0x32, 0x4f, 0x3b, 0x4f, 0x3b, 0xe4, 0x0d, 0x00, 0x08, 0x00, 0x02, 0xd0, 0x30, 0x02, 0x7e, 0x2d, 0x00, 0x2c, 0x00, 0x11, 0xb0, 0x8c, 0x03, 0x11, 0xd5, 0x92, 0x11, 0x02, 0x12, 0x23, 0x40,
+  0x12, 0x54, 0x4f, 0x3b, 0xbe, 0x06, 0x20, 0x2e, 0x3b, 0x8e, 0x2d, 0x02, 0x2e, 0x07, 0x00, 0xec, 0x06, 0x00, 0xbe, 0x03, 0x00, 0x2a, 0x07, 0x11, 0xb0, 0xb8, 0x11, 0x31, 0xb0, 0x4b, 0x94, 0x7a,
+  0x1c, 0x00, 0x96, 0x0a, 0x20, 0xf5, 0x74, 0x84, 0x0a, 0x00, 0x2a, 0x15, 0x02, 0x1e, 0x0e, 0x00, 0x62, 0x00, 0x00, 0x4e, 0x00, 0x00, 0x1c, 0x07, 0x20, 0x32, 0x5c, 0xb4, 0x18, 0x03, 0xd2, 0x2d,
+  0x10, 0x3b, 0x92, 0x03, 0x60, 0x52, 0x64, 0x6f, 0x43, 0xed, 0x32, 0xc4, 0x11, 0x00, 0x18, 0x0e, 0x00, 0x34, 0x1c, 0x80, 0x93, 0x6c, 0xd1, 0x5b, 0xd0, 0x53, 0x52, 0x6c, 0xc4, 0x18, 0xf0, 0x17,
+  0x32, 0x64, 0xf1, 0x5b, 0xd0, 0x5b, 0x52, 0x6c, 0x6f, 0x53, 0x56, 0x8d, 0x72, 0x74, 0x4e, 0x53, 0x6e, 0x53, 0xf0, 0x6b, 0x2d, 0x4b, 0x56, 0x95, 0x35, 0x95, 0x11, 0x6c, 0x15, 0x8d, 0x73, 0x7c,
+  0xb3, 0x84, 0x93, 0x7c, 0x52, 0x74, 0x8c, 0x03, 0x40, 0x51, 0x6c, 0x10, 0x6c, 0x9a, 0x0a, 0x00, 0x80, 0x03, 0x70, 0xcf, 0x6b, 0x10, 0x74, 0x51, 0x7c, 0xef, 0x18, 0x0e, 0x10, 0x63, 0x1c, 0x0e,
+  0xf0, 0x03, 0x0f, 0x7c, 0xf3, 0x9c, 0x55, 0xad, 0xb6, 0xb5, 0xf7, 0xbd, 0xba, 0xde, 0x79, 0xd6, 0x58, 0xd6, 0xd6, 0xc5, 0x02, 0x00, 0xf0, 0x0b, 0xf6, 0xcd, 0xf6, 0xc5, 0xf6, 0xcd, 0x95, 0xbd,
+  0x74, 0xbd, 0x57, 0xd6, 0x33, 0xb5, 0xf2, 0xac, 0xf2, 0xac, 0xd5, 0xcd, 0xf5, 0xcd, 0x53, 0xbd, 0x16, 0xd6, 0xfc, 0x13, 0x00, 0x6e, 0x0d, 0x20, 0x14, 0x34, 0x24, 0x0a, 0x60, 0x15, 0x34, 0x76,
+  0x44, 0x96, 0x44, 0xe4, 0x06, 0x42, 0x97, 0x4c, 0x56, 0x44, 0x18, 0x03, 0x01, 0x76, 0x18, 0x00, 0xc8, 0x06, 0x00, 0x30, 0x18, 0x32, 0x33, 0x56, 0x3c, 0xac, 0x06, 0x10, 0xd4, 0xee, 0x09, 0x01,
+  0xa4, 0x03, 0x02, 0x18, 0x07, 0x02, 0xf4, 0x17, 0x22, 0xd3, 0x2b, 0x48, 0x03, 0x42, 0x55, 0x3c, 0x14, 0x34, 0x5c, 0x03, 0x00, 0xf8, 0x06, 0x02, 0x6a, 0x03, 0x00, 0x02, 0x00, 0x03, 0x8c, 0x03,
+  0x10, 0x23, 0x4c, 0x03, 0x00, 0x6e, 0x03, 0x01, 0x04, 0x00, 0x40, 0x3c, 0xb3, 0x2b, 0xb2, 0x22, 0x11, 0x01, 0x5c, 0x03, 0x00, 0xd2, 0x09, 0x10, 0x31, 0xde, 0x14, 0x01, 0xd2, 0x17, 0x10, 0x30,
+  0xfc, 0x1e, 0x01, 0x0c, 0x00, 0x02, 0x3a, 0x03, 0x00, 0x02, 0x0a, 0x00, 0x3a, 0x00, 0x01, 0x90, 0x0d, 0x21, 0x23, 0xd3, 0x92, 0x33, 0x03, 0xe4, 0x1e, 0x11, 0x2b, 0xd0, 0x0d, 0x10, 0x23, 0x5a,
+  0x03, 0x00, 0x1e, 0x07, 0x60, 0x75, 0x4c, 0x75, 0x44, 0x75, 0x44, 0xe4, 0x06, 0x02, 0xf0, 0x06, 0x00, 0x3c, 0x00, 0x00, 0xb0, 0x03, 0x11, 0xd3, 0xa8, 0x18, 0x02, 0xb4, 0x03, 0x20, 0x96, 0x4c,
+  0xa0, 0x03, 0x00, 0xd2, 0x06, 0x40, 0x14, 0x3c, 0xf3, 0x3b, 0x8a, 0x03, 0x51, 0x71, 0x23, 0x13, 0x3c, 0x34, 0xc6, 0x17, 0x20, 0x75, 0x4c, 0x0c, 0x07, 0x40, 0x55, 0x44, 0x13, 0x44, 0x90, 0x03,
+  0x10, 0xd2, 0x34, 0x22, 0x32, 0x3b, 0x13, 0x44, 0x9e, 0x03, 0x02, 0xf4, 0x17, 0x10, 0x30, 0xca, 0x25, 0x00, 0x66, 0x06, 0x01, 0x3c, 0x29, 0x00, 0x02, 0x00, 0x20, 0xd2, 0x3b, 0x62, 0x0a, 0x00,
+  0x22, 0x00, 0x40, 0x75, 0x4c, 0x75, 0x4c, 0x4a, 0x03, 0x00, 0x70, 0x0a, 0x02, 0x56, 0x0a, 0x11, 0xb2, 0x22, 0x18, 0x02, 0x64, 0x0a, 0x31, 0x33, 0x44, 0xb1, 0xf0, 0x1e, 0x10, 0x91, 0x64, 0x30,
+  0x10, 0x33, 0x24, 0x34, 0x60, 0xb2, 0x3b, 0xb1, 0x3b, 0x0f, 0x23, 0x46, 0x03, 0x00, 0x10, 0x1f, 0x02, 0x9a, 0x0a, 0x71, 0xf3, 0x43, 0x71, 0x33, 0xce, 0x1a, 0x70, 0x0a, 0x00, 0x02, 0x90, 0x03,
+  0x00, 0xa6, 0x03, 0x11, 0xd2, 0xc6, 0x14, 0x40, 0x13, 0x4c, 0x95, 0x5c, 0x7e, 0x03, 0x21, 0x13, 0x4c, 0xce, 0x06, 0x04, 0x7e, 0x03, 0x00, 0x3e, 0x0a, 0x30, 0x3b, 0xd1, 0x43, 0x02, 0x00, 0x04,
+  0xba, 0x1b, 0x40, 0x13, 0x4c, 0xb1, 0x3b, 0x32, 0x03, 0x33, 0xd2, 0x43, 0x90, 0x4c, 0x26, 0x00, 0x38, 0x26, 0x53, 0x71, 0x3b, 0x70, 0x33, 0xb2, 0x0c, 0x00, 0x00, 0x2e, 0x11, 0x00, 0x5c, 0x03,
+  0x02, 0x5e, 0x03, 0x31, 0x90, 0x3b, 0x90, 0x7a, 0x18, 0x20, 0xd2, 0x4b, 0x78, 0x11, 0x20, 0x0f, 0x2b, 0x42, 0x34, 0x00, 0xf2, 0x22, 0x00, 0x80, 0x03, 0x02, 0xae, 0x37, 0x00, 0xec, 0x30, 0x00,
+  0xde, 0x0d, 0x00, 0x64, 0x03, 0x00, 0xf6, 0x06, 0x00, 0x02, 0x07, 0x20, 0x74, 0x5c, 0x16, 0x15, 0x00, 0x4c, 0x03, 0x00, 0x84, 0x03, 0x02, 0x08, 0x00, 0x02, 0xfe, 0x1b, 0x02, 0xea, 0x06, 0x42,
+  0xcd, 0x2a, 0x2f, 0x33, 0x32, 0x00, 0x02, 0x92, 0x0a, 0x00, 0x6c, 0x26, 0x11, 0xf2, 0x04, 0x15, 0x20, 0x53, 0x64, 0x2e, 0x03, 0x00, 0xc6, 0x06, 0x00, 0xd6, 0x06, 0x31, 0x70, 0x43, 0x6f, 0x9e,
+  0x03, 0x13, 0x6f, 0x26, 0x1c, 0x20, 0xd1, 0x4b, 0x56, 0x03, 0x22, 0x73, 0x64, 0x6c, 0x11, 0x32, 0x53, 0x64, 0x11, 0x3e, 0x07, 0x01, 0x7e, 0x11, 0x20, 0x90, 0x43, 0x1c, 0x1c, 0x00, 0x36, 0x1c,
+  0x00, 0x64, 0x03, 0x40, 0x0e, 0x3b, 0xb0, 0x4b, 0xbe, 0x03, 0x00, 0x2e, 0x00, 0x02, 0x3c, 0x2a, 0x13, 0x32, 0xc0, 0x0a, 0x00, 0x5c, 0x00, 0x20, 0x52, 0x5c, 0x2e, 0x0e, 0x60, 0x93, 0x6c, 0xf1,
+  0x53, 0x11, 0x54, 0x7a, 0x03, 0x00, 0x2a, 0x1c, 0x20, 0x52, 0x64, 0x1c, 0x07, 0x40, 0xd5, 0x74, 0x53, 0x64, 0x60, 0x23, 0x00, 0x18, 0x07, 0x20, 0x12, 0x64, 0x48, 0x15, 0x31, 0x12, 0x64, 0x6f,
+  0xb2, 0x0a, 0x00, 0xc8, 0x11, 0x40, 0xf1, 0x63, 0x2e, 0x4b, 0xf2, 0x06, 0xf0, 0x09, 0xb3, 0x7c, 0x14, 0x8d, 0x56, 0x95, 0xf8, 0xad, 0x97, 0x9d, 0x7b, 0xbe, 0x56, 0x9d, 0x52, 0x7c, 0xd4, 0x8c,
+  0xb4, 0x84, 0xf4, 0x8c, 0x6f, 0x5b, 0x06, 0x07, 0x80, 0xd3, 0x84, 0xb3, 0x84, 0x72, 0x7c, 0x51, 0x7c, 0x0c, 0x07, 0xd1, 0x51, 0x84, 0x92, 0x8c, 0x51, 0x84, 0x31, 0x84, 0x72, 0x8c, 0xf4, 0x9c,
+  0x75, 0x86, 0x03, 0xf4, 0x21, 0xb6, 0xbd, 0xd7, 0xc5, 0x95, 0xbd, 0x34, 0xb5, 0x54, 0xb5, 0xd2, 0xa4, 0xb2, 0xa4, 0xf2, 0xac, 0x54, 0xbd, 0x37, 0xd6, 0x12, 0xad, 0x16, 0xce, 0x94, 0xc5, 0xf6,
+  0xcd, 0x74, 0xbd, 0xd5, 0xc5, 0xf2, 0xac, 0xd5, 0xc5, 0xd5, 0xcd, 0x78, 0xde, 0xb5, 0xc5, 0x4f, 0x94, 0xb4, 0xc5, 0xf5, 0xd5, 0x0e, 0x0a, 0x02, 0x58, 0x1b, 0x00, 0xec, 0x06, 0x00, 0x62, 0x0a,
+  0x02, 0x0a, 0x22, 0x11, 0xd4, 0x1a, 0x00, 0x00, 0x96, 0x03, 0x00, 0x5a, 0x03, 0x00, 0x92, 0x0a, 0x11, 0x92, 0x04, 0x07, 0x01, 0x66, 0x03, 0x01, 0x80, 0x03, 0x31, 0x10, 0x03, 0x8e, 0x36, 0x29,
+  0x41, 0x10, 0x03, 0x30, 0x0b, 0x2e, 0x1b, 0x05, 0xec, 0x1e, 0x22, 0xb3, 0x2b, 0x6e, 0x0a, 0x11, 0xb2, 0x96, 0x03, 0x00, 0xd2, 0x06, 0x02, 0x38, 0x11, 0x00, 0x10, 0x00, 0x11, 0x71, 0xb2, 0x14,
+  0x20, 0xf3, 0x33, 0x06, 0x11, 0x60, 0x72, 0x23, 0x71, 0x23, 0x31, 0x13, 0xfa, 0x02, 0x11, 0xf4, 0x02, 0x07, 0x00, 0xbc, 0x14, 0x00, 0x76, 0x03, 0x00, 0x68, 0x1b, 0xa0, 0x14, 0x3c, 0xb6, 0x54,
+  0xd7, 0x54, 0xb6, 0x54, 0x75, 0x4c, 0xb6, 0x06, 0x00, 0x0c, 0x22, 0x02, 0x38, 0x1b, 0x10, 0x30, 0x58, 0x29, 0x01, 0x10, 0x18, 0x11, 0x13, 0x50, 0x03, 0x02, 0x40, 0x03, 0xc0, 0x95, 0x4c, 0xf3,
+  0x3b, 0x34, 0x3c, 0x54, 0x44, 0x95, 0x4c, 0x54, 0x44, 0x32, 0x00, 0x01, 0x2e, 0x07, 0x50, 0x3c, 0x35, 0x44, 0x34, 0x44, 0x6e, 0x03, 0x40, 0x71, 0x23, 0x34, 0x3c, 0xe8, 0x06, 0x11, 0xf3, 0x78,
+  0x0a, 0x00, 0x12, 0x00, 0x00, 0x6a, 0x0a, 0x00, 0x7a, 0x29, 0x02, 0xba, 0x0d, 0x00, 0x56, 0x29, 0x00, 0xb2, 0x0d, 0x00, 0xd6, 0x0d, 0x00, 0x60, 0x37, 0x00, 0x80, 0x03, 0x84, 0x14, 0x44, 0x34,
+  0x44, 0xf2, 0x3b, 0x91, 0x2b, 0x54, 0x03, 0x02, 0x14, 0x1f, 0x00, 0x78, 0x1b, 0x02, 0xb4, 0x06, 0x00, 0x18, 0x07, 0x00, 0x06, 0x00, 0x60, 0x95, 0x54, 0x75, 0x54, 0x95, 0x54, 0x14, 0x00, 0x42,
+  0xb5, 0x5c, 0xb5, 0x5c, 0x10, 0x00, 0x00, 0xca, 0x0d, 0x00, 0x12, 0x0a, 0x31, 0x2f, 0x23, 0xb2, 0x3a, 0x11, 0x11, 0xf2, 0x9a, 0x37, 0x02, 0x40, 0x11, 0x20, 0xb1, 0x33, 0x38, 0x00, 0x00, 0x7c,
+  0x22, 0x20, 0x74, 0x54, 0xae, 0x0d, 0x00, 0x9c, 0x03, 0x20, 0x95, 0x5c, 0x02, 0x00, 0x02, 0x22, 0x0e, 0x00, 0xcc, 0x06, 0x00, 0x2c, 0x00, 0x00, 0x1c, 0x00, 0x20, 0xf2, 0x43, 0xd6, 0x0d, 0x11,
+  0x13, 0x34, 0x1f, 0x02, 0x38, 0x18, 0x00, 0x38, 0x26, 0x02, 0xa4, 0x1b, 0x22, 0x12, 0x4c, 0x12, 0x00, 0x20, 0x70, 0x33, 0x8a, 0x1b, 0x80, 0x90, 0x33, 0x4f, 0x33, 0xf2, 0x43, 0xb1, 0x43, 0x88,
+  0x03, 0x20, 0x12, 0x4c, 0xc2, 0x22, 0x40, 0x94, 0x64, 0x90, 0x3b, 0x70, 0x03, 0x00, 0x0c, 0x00, 0x00, 0x6e, 0x03, 0xd0, 0x12, 0x4c, 0x2f, 0x2b, 0x0e, 0x2b, 0x0f, 0x2b, 0x2f, 0x33, 0x2f, 0x2b,
+  0x2f, 0xa2, 0x11, 0x10, 0x3b, 0x8a, 0x11, 0x11, 0x74, 0xc4, 0x1b, 0x11, 0x90, 0x40, 0x18, 0x11, 0x12, 0x22, 0x0e, 0x02, 0x68, 0x18, 0x11, 0xf2, 0x90, 0x06, 0x20, 0x2f, 0x33, 0x80, 0x03, 0x40,
+  0xce, 0x2a, 0x70, 0x3b, 0x78, 0x11, 0x40, 0x4f, 0x3b, 0x91, 0x43, 0x4c, 0x3b, 0x11, 0x90, 0x92, 0x03, 0x00, 0x5c, 0x00, 0x00, 0x74, 0x11, 0x51, 0x2f, 0x33, 0xad, 0x22, 0x70, 0xf0, 0x06, 0x42,
+  0x0e, 0x33, 0x12, 0x54, 0xf6, 0x06, 0x00, 0x42, 0x0a, 0x00, 0x02, 0x0e, 0x41, 0xb5, 0x6c, 0xb4, 0x64, 0x34, 0x0e, 0x01, 0x86, 0x26, 0x20, 0x12, 0x54, 0x86, 0x03, 0x51, 0x94, 0x64, 0xb5, 0x6c,
+  0x33, 0x26, 0x0a, 0x20, 0xb1, 0x4b, 0xac, 0x06, 0x00, 0x64, 0x0a, 0x00, 0x9a, 0x0a, 0x02, 0xf6, 0x0d, 0x22, 0xb0, 0x4b, 0x02, 0x0e, 0x00, 0xaa, 0x03, 0x00, 0x1c, 0x1c, 0x40, 0x6f, 0x43, 0x53,
+  0x64, 0xf2, 0x06, 0x00, 0x24, 0x1c, 0x00, 0xf8, 0x11, 0x11, 0x8f, 0xb4, 0x03, 0x00, 0x1c, 0x23, 0x00, 0x74, 0x03, 0x00, 0x98, 0x03, 0x20, 0x4f, 0x43, 0x20, 0x23, 0x00, 0x86, 0x18, 0x30, 0x73,
+  0x6c, 0x12, 0x58, 0x23, 0x00, 0xdc, 0x03, 0x01, 0x06, 0x07, 0x00, 0x80, 0x03, 0x02, 0x68, 0x1c, 0x00, 0x58, 0x00, 0x00, 0xa0, 0x11, 0x11, 0xf1, 0xd8, 0x2d, 0x00, 0x42, 0x23, 0x00, 0x8e, 0x03,
+  0x00, 0x94, 0x18, 0xa0, 0x73, 0x6c, 0x52, 0x64, 0x6f, 0x4b, 0x4f, 0x43, 0xd0, 0x53, 0x1c, 0x07, 0x00, 0xac, 0x18, 0x00, 0x18, 0x07, 0x40, 0x93, 0x74, 0x73, 0x74, 0x16, 0x0e, 0xf0, 0x11, 0x35,
+  0x8d, 0x52, 0x74, 0x11, 0x6c, 0x51, 0x74, 0x11, 0x6c, 0xd4, 0x84, 0x52, 0x7c, 0xf0, 0x6b, 0x4e, 0x5b, 0x0d, 0x53, 0x4e, 0x5b, 0x72, 0x84, 0x93, 0x8c, 0xaf, 0x6b, 0x52, 0x7c, 0x31, 0x7c, 0x98,
+  0x11, 0x00, 0x92, 0x0a, 0xf0, 0x39, 0x30, 0x7c, 0xf3, 0x9c, 0x96, 0xad, 0xb6, 0xb5, 0x96, 0xb5, 0xd7, 0xbd, 0xd7, 0xbd, 0x38, 0xce, 0x17, 0xc6, 0xd7, 0xbd, 0xb6, 0xbd, 0x95, 0xb5, 0x75, 0xbd,
+  0x95, 0xbd, 0x95, 0xbd, 0xf6, 0xcd, 0x17, 0xd6, 0x38, 0xd6, 0x17, 0xd6, 0x37, 0xd6, 0x78, 0xde, 0x37, 0xd6, 0x57, 0xde, 0x77, 0xde, 0x57, 0xde, 0x78, 0xde, 0x2f, 0x94, 0x98, 0xde, 0x94, 0xc5,
+  0xb5, 0xc5, 0x37, 0xd6, 0x16, 0xd6, 0xd5, 0xcd, 0x16, 0xd6, 0xb4, 0xc5, 0xf6, 0xcd, 0x68, 0x03, 0x03, 0x02, 0x3a, 0x11, 0x23, 0xe2, 0x06, 0x12, 0x33, 0x02, 0x0a, 0x40, 0x76, 0x44, 0x96, 0x4c,
+  0x04, 0x00, 0x02, 0x3c, 0x15, 0x20, 0x14, 0x34, 0xac, 0x03, 0x00, 0x2c, 0x1b, 0x00, 0xf6, 0x09, 0x01, 0xc0, 0x10, 0x01, 0x3c, 0x1b, 0x00, 0xac, 0x06, 0x22, 0xb6, 0x4c, 0x72, 0x06, 0x00, 0x48,
+  0x14, 0x00, 0xdc, 0x03, 0x00, 0x70, 0x03, 0x02, 0xfe, 0x28, 0x42, 0xb2, 0x23, 0x14, 0x3c, 0x2c, 0x07, 0x01, 0x1e, 0x00, 0x01, 0xa0, 0x06, 0x02, 0x08, 0x00, 0x00, 0xa0, 0x06, 0x11, 0x75, 0x46,
+  0x06, 0x60, 0x34, 0x3c, 0x95, 0x4c, 0x75, 0x4c, 0x6e, 0x03, 0x20, 0x13, 0x3c, 0x76, 0x03, 0x11, 0x51, 0xfe, 0x21, 0x00, 0x30, 0x29, 0x00, 0x30, 0x03, 0xf0, 0x01, 0x50, 0x1b, 0xef, 0x12, 0x30,
+  0x23, 0x91, 0x2b, 0xd3, 0x3b, 0x34, 0x44, 0xd3, 0x3b, 0x92, 0x2b, 0xfa, 0x09, 0x00, 0x02, 0x0a, 0x40, 0x54, 0x44, 0x55, 0x4c, 0x38, 0x00, 0x00, 0xb4, 0x0d, 0x42, 0xf3, 0x33, 0x34, 0x44, 0xe6,
+  0x17, 0x10, 0xd2, 0x3a, 0x11, 0x30, 0x33, 0xd3, 0x3b, 0x1e, 0x11, 0x50, 0x75, 0x4c, 0xb6, 0x54, 0x14, 0x8c, 0x03, 0x41, 0x44, 0x13, 0x3c, 0x92, 0x40, 0x00, 0x40, 0x14, 0x44, 0xb2, 0x33, 0xe0,
+  0x0d, 0x00, 0x78, 0x0a, 0x00, 0x46, 0x00, 0x20, 0x95, 0x54, 0x42, 0x00, 0x80, 0xd6, 0x5c, 0x17, 0x65, 0x75, 0x54, 0x75, 0x4c, 0x94, 0x14, 0x10, 0x13, 0x86, 0x11, 0x01, 0x4a, 0x0a, 0x22, 0x75,
+  0x54, 0x32, 0x03, 0x00, 0x00, 0x11, 0x60, 0x74, 0x4c, 0x74, 0x4c, 0x34, 0x44, 0x4e, 0x0a, 0x00, 0xb4, 0x14, 0x02, 0x10, 0x00, 0x00, 0xaa, 0x06, 0x10, 0xf2, 0xf0, 0x3a, 0x41, 0x44, 0x70, 0x33,
+  0xd1, 0x10, 0x18, 0x00, 0x3e, 0x03, 0x02, 0x62, 0x22, 0x00, 0xee, 0x1e, 0x11, 0x71, 0xe6, 0x2c, 0x20, 0xf2, 0x43, 0xa2, 0x03, 0x00, 0xa8, 0x03, 0x00, 0x1c, 0x00, 0x02, 0x62, 0x30, 0x40, 0x71,
+  0x33, 0x13, 0x44, 0x60, 0x03, 0x03, 0x6c, 0x03, 0x01, 0x46, 0x00, 0x00, 0xb0, 0x14, 0x00, 0x88, 0x03, 0xa0, 0x70, 0x33, 0x33, 0x4c, 0x12, 0x44, 0x54, 0x54, 0xf2, 0x43, 0x06, 0x00, 0x50, 0x94,
+  0x5c, 0xd2, 0x43, 0xd2, 0x5c, 0x1b, 0x30, 0x54, 0xf2, 0x43, 0x36, 0x0a, 0xc0, 0x53, 0x54, 0x95, 0x5c, 0x94, 0x5c, 0x74, 0x5c, 0x16, 0x6d, 0xb5, 0x64, 0x92, 0x06, 0x30, 0x94, 0x5c, 0x54, 0x24,
+  0x07, 0x32, 0x4b, 0xf6, 0x64, 0xa0, 0x0a, 0x11, 0xd1, 0x50, 0x03, 0x11, 0xd1, 0x5a, 0x11, 0x00, 0x9a, 0x1b, 0x80, 0x0e, 0x2b, 0xcd, 0x1a, 0x50, 0x33, 0xee, 0x2a, 0x14, 0x00, 0x00, 0xdc, 0x14,
+  0x02, 0x2e, 0x18, 0x01, 0x9e, 0x14, 0x00, 0xf8, 0x0d, 0x01, 0x56, 0x2d, 0x02, 0x8e, 0x18, 0x00, 0x2e, 0x00, 0x11, 0x32, 0x9e, 0x0a, 0x20, 0xf1, 0x43, 0x24, 0x00, 0x02, 0x86, 0x11, 0x11, 0xb1,
+  0xf4, 0x22, 0xa0, 0xd1, 0x4b, 0xb5, 0x64, 0x53, 0x5c, 0x33, 0x54, 0x90, 0x3b, 0x6c, 0x26, 0x10, 0x33, 0x02, 0x15, 0x32, 0x5c, 0x70, 0x43, 0x72, 0x34, 0x20, 0x53, 0x5c, 0x5c, 0x03, 0x00, 0x6a,
+  0x26, 0x00, 0x7a, 0x26, 0x02, 0x7a, 0x0a, 0xf0, 0x04, 0x4f, 0x3b, 0x53, 0x5c, 0xf1, 0x4b, 0xf2, 0x53, 0x32, 0x5c, 0x6f, 0x3b, 0xee, 0x2a, 0xee, 0x2a, 0xee, 0x32, 0x2f, 0x9e, 0x18, 0x01, 0xa2,
+  0x03, 0x00, 0xaa, 0x0a, 0x00, 0x1e, 0x07, 0x00, 0x84, 0x0a, 0x00, 0x6c, 0x03, 0x02, 0x8a, 0x18, 0x11, 0x32, 0x56, 0x03, 0x00, 0x5e, 0x03, 0xa0, 0xd1, 0x53, 0x4f, 0x43, 0x73, 0x64, 0xd5, 0x74,
+  0x32, 0x5c, 0x48, 0x0a, 0x20, 0xb0, 0x4b, 0xa8, 0x2d, 0x40, 0x8f, 0x43, 0x32, 0x5c, 0x12, 0x0e, 0x60, 0xcc, 0x2a, 0xed, 0x32, 0x0d, 0x33, 0x04, 0x07, 0x02, 0x14, 0x07, 0x00, 0xf6, 0x03, 0x00,
+  0x18, 0x07, 0x20, 0x0d, 0x33, 0x20, 0x07, 0x01, 0xb6, 0x18, 0x30, 0x64, 0x32, 0x5c, 0x7e, 0x0a, 0x00, 0x4a, 0x07, 0x20, 0x93, 0x6c, 0x92, 0x18, 0x00, 0x9e, 0x0a, 0x04, 0xf6, 0x1f, 0x20, 0x11,
+  0x5c, 0xbc, 0x11, 0x20, 0xb4, 0x74, 0x50, 0x15, 0x20, 0xb0, 0x4b, 0x1c, 0x0e, 0x20, 0x32, 0x5c, 0xc4, 0x18, 0x40, 0x6f, 0x43, 0xd0, 0x53, 0x64, 0x1c, 0x02, 0x32, 0x0e, 0x20, 0x52, 0x64, 0x84,
+  0x03, 0x11, 0xd0, 0x2e, 0x15, 0x20, 0x52, 0x74, 0x10, 0x0e, 0xf0, 0x01, 0xf0, 0x63, 0xcf, 0x63, 0x8e, 0x5b, 0xcf, 0x63, 0xd0, 0x63, 0x6e, 0x5b, 0x11, 0x74, 0xd4, 0x8c, 0x02, 0x00, 0xf0, 0x09,
+  0x72, 0x84, 0x72, 0x84, 0x92, 0x8c, 0x93, 0x94, 0x92, 0x94, 0x71, 0x8c, 0xb2, 0x94, 0x74, 0xad, 0x95, 0xb5, 0xb5, 0xb5, 0xf7, 0xc5, 0xf7, 0xc5, 0x7a, 0x03, 0x20, 0xb5, 0xbd, 0x90, 0x0a, 0x44,
+  0x95, 0xbd, 0x74, 0xb5, 0x0a, 0x00, 0x40, 0xd6, 0xc5, 0xb5, 0xc5, 0x04, 0x00, 0xc0, 0x17, 0xce, 0xf6, 0xcd, 0x17, 0xce, 0x54, 0xb5, 0x58, 0xde, 0x94, 0xbd, 0x98, 0x03, 0x60, 0xd6, 0xcd, 0xb1,
+  0xa4, 0x37, 0xd6, 0xc4, 0x11, 0x40, 0x73, 0xbd, 0xd1, 0xac, 0x06, 0x00, 0x60, 0x36, 0xd6, 0x12, 0xb5, 0x14, 0x34, 0xf4, 0x17, 0x90, 0xf8, 0x5c, 0xf8, 0x5c, 0xd7, 0x54, 0x18, 0x5d, 0xf8, 0x90,
+  0x06, 0x12, 0x4c, 0x58, 0x06, 0x20, 0x35, 0x44, 0x62, 0x14, 0x00, 0x16, 0x18, 0xb1, 0xb2, 0x23, 0xf3, 0x2b, 0x34, 0x34, 0x75, 0x44, 0x55, 0x3c, 0x34, 0x4e, 0x14, 0x42, 0x72, 0x23, 0x71, 0x1b,
+  0xac, 0x0d, 0x00, 0x56, 0x03, 0x13, 0xb2, 0xf6, 0x17, 0x02, 0xe2, 0x17, 0x22, 0x92, 0x23, 0xe6, 0x1e, 0x02, 0xce, 0x2c, 0x11, 0x71, 0xb8, 0x1e, 0x02, 0x7a, 0x2c, 0x00, 0x8e, 0x06, 0x32, 0x72,
+  0x2b, 0xb2, 0x62, 0x2c, 0x01, 0x24, 0x29, 0x12, 0x71, 0x38, 0x14, 0x01, 0x5c, 0x14, 0x00, 0xae, 0x14, 0x24, 0xd2, 0x33, 0xa8, 0x0d, 0x00, 0x3a, 0x03, 0x11, 0x54, 0xb6, 0x0d, 0x22, 0x54, 0x4c,
+  0xfc, 0x09, 0x11, 0x34, 0x02, 0x00, 0x01, 0xe2, 0x10, 0x01, 0x10, 0x0a, 0x00, 0x60, 0x03, 0x11, 0xf3, 0xc6, 0x06, 0x10, 0xf3, 0x08, 0x0a, 0x03, 0xe6, 0x0d, 0x20, 0x34, 0x44, 0x9c, 0x06, 0x20,
+  0x75, 0x54, 0x8e, 0x03, 0x02, 0x2e, 0x00, 0x02, 0x62, 0x03, 0xe0, 0x96, 0x54, 0x75, 0x4c, 0xd7, 0x5c, 0xd6, 0x5c, 0x75, 0x4c, 0xb6, 0x5c, 0xd2, 0x3b, 0x1e, 0x00, 0x22, 0x55, 0x4c, 0x3a, 0x00,
+  0x00, 0xc8, 0x06, 0x01, 0x64, 0x0a, 0x30, 0x4c, 0x75, 0x54, 0x30, 0x00, 0x00, 0x52, 0x29, 0x00, 0x0c, 0x00, 0x00, 0x5c, 0x00, 0x04, 0x16, 0x18, 0x02, 0x3e, 0x18, 0x20, 0x13, 0x44, 0xdc, 0x06,
+  0x00, 0xf2, 0x06, 0x02, 0x46, 0x11, 0xa0, 0xd6, 0x5c, 0x95, 0x5c, 0x74, 0x54, 0xb5, 0x5c, 0x12, 0x44, 0x02, 0x00, 0x02, 0x04, 0x18, 0x22, 0xf2, 0x43, 0xe8, 0x14, 0x20, 0x74, 0x54, 0x06, 0x00,
+  0x20, 0x53, 0x4c, 0xf0, 0x0d, 0x01, 0xcc, 0x06, 0x14, 0x33, 0xec, 0x0d, 0x01, 0x3a, 0x03, 0x71, 0x3b, 0x70, 0x33, 0x53, 0x4c, 0xd1, 0x3b, 0x96, 0x1b, 0x01, 0x16, 0x2d, 0x22, 0xb5, 0x5c, 0xe0,
+  0x14, 0x40, 0x95, 0x5c, 0x53, 0x54, 0x02, 0x0e, 0x20, 0x94, 0x5c, 0x6e, 0x18, 0xb1, 0xb5, 0x5c, 0x94, 0x5c, 0xf6, 0x6c, 0x53, 0x54, 0x54, 0x54, 0x33, 0xa6, 0x29, 0x60, 0xb5, 0x5c, 0xd5, 0x64,
+  0x74, 0x5c, 0xa2, 0x30, 0x10, 0xb5, 0x84, 0x03, 0x01, 0x38, 0x03, 0x11, 0x53, 0xee, 0x14, 0x20, 0x12, 0x4c, 0xd4, 0x06, 0x02, 0xd6, 0x0d, 0x11, 0xb1, 0x58, 0x1f, 0x24, 0x54, 0x54, 0x52, 0x26,
+  0x20, 0xd1, 0x4b, 0x70, 0x03, 0x02, 0x28, 0x18, 0x24, 0xd1, 0x4b, 0xfe, 0x0d, 0x20, 0x2f, 0x2b, 0x1e, 0x00, 0x31, 0xb0, 0x3b, 0xf1, 0x8e, 0x03, 0x00, 0xe8, 0x03, 0x02, 0xca, 0x03, 0x22, 0x12,
+  0x54, 0xe4, 0x30, 0x00, 0x50, 0x00, 0x02, 0x5a, 0x07, 0x00, 0x72, 0x03, 0x40, 0xb4, 0x64, 0x94, 0x64, 0x64, 0x18, 0x02, 0x92, 0x34, 0x02, 0xf0, 0x0d, 0x20, 0x91, 0x43, 0x26, 0x0e, 0x00, 0xa0,
+  0x06, 0x04, 0x70, 0x03, 0x00, 0xca, 0x0d, 0x20, 0xf1, 0x53, 0xb2, 0x0a, 0x00, 0xa2, 0x26, 0x40, 0x4f, 0x3b, 0x32, 0x54, 0x28, 0x00, 0x00, 0x96, 0x0a, 0x04, 0xac, 0x0a, 0x20, 0xf2, 0x53, 0x2c,
+  0x00, 0x00, 0x7c, 0x11, 0x02, 0x28, 0x1c, 0x00, 0xcc, 0x0d, 0x00, 0xf8, 0x22, 0x21, 0x4e, 0x43, 0xae, 0x06, 0x03, 0xc6, 0x26, 0x00, 0x6a, 0x11, 0x00, 0x72, 0x1f, 0x00, 0x3a, 0x0e, 0x02, 0x6c,
+  0x11, 0x00, 0x9a, 0x26, 0x00, 0x62, 0x23, 0x02, 0xa8, 0x0a, 0x11, 0xf1, 0xfe, 0x26, 0x00, 0xe2, 0x0a, 0x01, 0xba, 0x0a, 0x01, 0xda, 0x2d, 0x00, 0xda, 0x06, 0x00, 0x3a, 0x2a, 0x00, 0x1e, 0x1c,
+  0x00, 0x5c, 0x1c, 0x00, 0x02, 0x07, 0x11, 0x52, 0x94, 0x0a, 0x11, 0x12, 0x36, 0x00, 0x04, 0x5a, 0x2a, 0x71, 0x12, 0x5c, 0x90, 0x4b, 0xd1, 0x53, 0xb0, 0xde, 0x26, 0x11, 0x11, 0xba, 0x0a, 0x00,
+  0x7e, 0x31, 0x53, 0x93, 0x6c, 0x93, 0x6c, 0x52, 0x32, 0x15, 0x30, 0x52, 0x6c, 0x93, 0x1a, 0x07, 0x72, 0x74, 0xb0, 0x63, 0x4e, 0x53, 0x6e, 0x5b, 0xb2, 0x1f, 0xf0, 0x23, 0x31, 0x74, 0x52, 0x7c,
+  0xb3, 0x8c, 0x52, 0x7c, 0xd0, 0x73, 0x31, 0x7c, 0x52, 0x84, 0x52, 0x84, 0xb3, 0x94, 0xf4, 0x9c, 0x34, 0xad, 0x95, 0xb5, 0x54, 0xb5, 0xb5, 0xbd, 0xb4, 0xbd, 0x94, 0xbd, 0x53, 0xb5, 0x33, 0xb5,
+  0x54, 0xb5, 0x94, 0xbd, 0x74, 0xbd, 0x95, 0xbd, 0x33, 0xb5, 0x13, 0xb5, 0x54, 0xbd, 0x0c, 0x00, 0x00, 0x02, 0x00, 0xc0, 0xb5, 0xc5, 0xb5, 0xc5, 0x94, 0xbd, 0xd6, 0xcd, 0xd6, 0xc5, 0x17, 0xd6,
+  0x92, 0x03, 0x00, 0xa6, 0x0a, 0x20, 0x37, 0xd6, 0xb4, 0x0a, 0xf2, 0x07, 0x74, 0xbd, 0xd9, 0xe6, 0x16, 0xce, 0x53, 0xb5, 0x16, 0xd6, 0x0e, 0x94, 0x53, 0xb5, 0x98, 0xde, 0x16, 0xd6, 0x53, 0xbd,
+  0x12, 0xb5, 0x20, 0x1b, 0xa0, 0x30, 0x0b, 0xae, 0x02, 0x8e, 0x02, 0x8e, 0x02, 0xaf, 0x02, 0x5c, 0x33, 0x11, 0x30, 0xd2, 0x36, 0x00, 0x14, 0x0a, 0x00, 0x92, 0x0d, 0x02, 0x3c, 0x29, 0x20, 0xb2,
+  0x23, 0x38, 0x22, 0x02, 0x46, 0x41, 0x00, 0x34, 0x07, 0x04, 0x6e, 0x11, 0x20, 0x55, 0x44, 0x2a, 0x0a, 0xb1, 0x55, 0x44, 0xd6, 0x54, 0x96, 0x4c, 0x75, 0x4c, 0xd7, 0x54, 0xd7, 0x62, 0x0a, 0x24,
+  0x95, 0x4c, 0x22, 0x18, 0x11, 0x34, 0x3c, 0x07, 0xa2, 0x13, 0x3c, 0x96, 0x4c, 0xb6, 0x54, 0xb6, 0x54, 0xd7, 0x5c, 0x1c, 0x03, 0xe0, 0xb6, 0x54, 0x54, 0x44, 0xd6, 0x5c, 0x38, 0x65, 0x17, 0x5d,
+  0xb6, 0x54, 0xf7, 0x64, 0x08, 0x03, 0x00, 0xaa, 0x06, 0x40, 0xf7, 0x5c, 0x18, 0x65, 0x1e, 0x00, 0x11, 0x55, 0x10, 0x00, 0x00, 0x02, 0x00, 0x00, 0x9e, 0x03, 0xa0, 0x14, 0x44, 0x54, 0x4c, 0x95,
+  0x54, 0xf3, 0x3b, 0x96, 0x54, 0x20, 0x0a, 0x00, 0x7a, 0x1b, 0x02, 0x1c, 0x0a, 0x00, 0x9e, 0x0d, 0x00, 0x8a, 0x1b, 0x11, 0x55, 0x2a, 0x00, 0x00, 0x40, 0x00, 0x31, 0xd6, 0x5c, 0x14, 0xe2, 0x0d,
+  0x00, 0x6e, 0x0a, 0x40, 0x10, 0x1b, 0x0f, 0x1b, 0xf0, 0x0d, 0x22, 0x50, 0x23, 0x6c, 0x11, 0x15, 0x71, 0xec, 0x25, 0x01, 0x24, 0x18, 0x01, 0x12, 0x15, 0x00, 0xd0, 0x0d, 0x00, 0x56, 0x11, 0x00,
+  0x60, 0x00, 0x24, 0x74, 0x54, 0xe0, 0x0d, 0x60, 0x50, 0x23, 0x30, 0x23, 0xad, 0x0a, 0x3a, 0x0a, 0x00, 0x10, 0x18, 0x40, 0x70, 0x2b, 0x13, 0x44, 0x18, 0x0e, 0x00, 0x4e, 0x11, 0x31, 0x95, 0x54,
+  0x74, 0x50, 0x07, 0x51, 0x54, 0x4c, 0xd6, 0x5c, 0x54, 0xce, 0x25, 0xe0, 0x13, 0x4c, 0x74, 0x54, 0xf6, 0x64, 0xd5, 0x5c, 0x95, 0x5c, 0x94, 0x54, 0x94, 0x54, 0x34, 0x07, 0x11, 0x54, 0xa6, 0x00,
+  0x51, 0x54, 0x54, 0x13, 0x44, 0x33, 0x0e, 0x00, 0x60, 0x12, 0x44, 0xb1, 0x3b, 0x13, 0x44, 0x94, 0x03, 0x22, 0x54, 0x54, 0x56, 0x07, 0x00, 0x06, 0x07, 0x00, 0x80, 0x03, 0x20, 0x94, 0x54, 0x1e,
+  0x07, 0x20, 0xee, 0x1a, 0x42, 0x1f, 0x22, 0x2f, 0x2b, 0x3e, 0x26, 0x62, 0xee, 0x22, 0xad, 0x12, 0x50, 0x33, 0xea, 0x1b, 0x00, 0x44, 0x26, 0x00, 0xb2, 0x1b, 0x00, 0xcc, 0x1b, 0x10, 0x4f, 0x12,
+  0x1f, 0x10, 0x0a, 0x28, 0x1f, 0x60, 0x4b, 0x0a, 0x0e, 0x2b, 0x91, 0x3b, 0x50, 0x1f, 0x00, 0x3e, 0x07, 0x06, 0xf2, 0x06, 0x20, 0x53, 0x54, 0xa2, 0x03, 0x20, 0x54, 0x5c, 0x26, 0x0e, 0x01, 0x38,
+  0x34, 0x12, 0x4c, 0xa4, 0x0a, 0x11, 0x33, 0x2c, 0x07, 0x00, 0x5e, 0x03, 0x00, 0xc0, 0x3e, 0x20, 0xd1, 0x43, 0xa0, 0x18, 0x40, 0x94, 0x5c, 0xb1, 0x3b, 0xe2, 0x03, 0x20, 0x70, 0x3b, 0x6e, 0x0e,
+  0x03, 0xe8, 0x22, 0x34, 0x33, 0xf2, 0x4b, 0x94, 0x1f, 0x00, 0x82, 0x0a, 0x20, 0xd1, 0x4b, 0x6a, 0x34, 0x11, 0x90, 0x8e, 0x34, 0x31, 0x0e, 0x33, 0x0e, 0x60, 0x07, 0x22, 0x0e, 0x2b, 0xfa, 0x3e,
+  0x20, 0xee, 0x2a, 0x22, 0x1c, 0x20, 0x0e, 0x33, 0x20, 0x38, 0x00, 0xe0, 0x06, 0x00, 0xac, 0x03, 0x02, 0x3a, 0x0e, 0x02, 0x24, 0x07, 0x31, 0xb0, 0x43, 0xb1, 0x8e, 0x11, 0x00, 0xa4, 0x0a, 0x10,
+  0xf1, 0x7a, 0x03, 0x70, 0x3b, 0x6f, 0x3b, 0x70, 0x43, 0x2f, 0x3b, 0x3c, 0x2a, 0x02, 0x4e, 0x15, 0x20, 0x90, 0x43, 0xb8, 0x2d, 0x00, 0x50, 0x23, 0x40, 0xb4, 0x6c, 0xb0, 0x4b, 0x2c, 0x31, 0x11,
+  0xf1, 0xd0, 0x06, 0x00, 0x9c, 0x0a, 0x22, 0x12, 0x5c, 0xb0, 0x26, 0x00, 0x22, 0x1c, 0x22, 0x73, 0x64, 0xba, 0x26, 0x00, 0xb6, 0x0a, 0x00, 0x18, 0x1c, 0x40, 0x8c, 0x22, 0x90, 0x4b, 0xda, 0x2d,
+  0x02, 0x26, 0x00, 0x11, 0x53, 0xee, 0x2d, 0x40, 0xf1, 0x5b, 0x6f, 0x4b, 0xa4, 0x0a, 0x20, 0x73, 0x6c, 0x42, 0x00, 0x00, 0x80, 0x31, 0x00, 0x0e, 0x0e, 0x00, 0xfc, 0x3b, 0x11, 0x52, 0x6a, 0x31,
+  0x71, 0x4e, 0x43, 0x2e, 0x3b, 0x8b, 0x2a, 0x4e, 0x7a, 0x15, 0x00, 0x60, 0x23, 0x00, 0x3a, 0x07, 0x00, 0x18, 0x00, 0x42, 0xed, 0x3a, 0x90, 0x4b, 0x46, 0x15, 0x22, 0xf1, 0x5b, 0x14, 0x00, 0xf1,
+  0x18, 0x4f, 0x4b, 0xed, 0x3a, 0x4e, 0x4b, 0x0d, 0x43, 0x6f, 0x53, 0x4e, 0x4b, 0xac, 0x3a, 0x0d, 0x4b, 0x52, 0x74, 0x32, 0x74, 0x8f, 0x63, 0x73, 0x84, 0x73, 0x84, 0x52, 0x84, 0x15, 0x9d, 0xf5,
+  0x9c, 0xf5, 0x9c, 0x97, 0xad, 0x97, 0xad, 0x76, 0x18, 0x0e, 0xf1, 0x14, 0x75, 0xb5, 0x75, 0xb5, 0x95, 0xbd, 0x53, 0xb5, 0x53, 0xb5, 0xb1, 0xa4, 0x12, 0xad, 0x12, 0xad, 0x12, 0xb5, 0x12, 0xb5,
+  0x90, 0x9c, 0xf2, 0xac, 0xd2, 0xac, 0xf2, 0xac, 0x12, 0xb5, 0x12, 0xad, 0x33, 0xb5, 0x74, 0xa0, 0x03, 0x30, 0x94, 0xbd, 0xd5, 0x20, 0x07, 0x10, 0xcd, 0x02, 0x00, 0x00, 0x9a, 0x0a, 0x00, 0x1a,
+  0x07, 0x33, 0x99, 0xde, 0x37, 0xba, 0x0a, 0x40, 0x98, 0xde, 0x57, 0xd6, 0x56, 0x15, 0xa0, 0x53, 0xbd, 0xb5, 0xc5, 0x90, 0x9c, 0xb4, 0xc5, 0x36, 0xd6, 0xd6, 0x06, 0x00, 0x5c, 0x14, 0x01, 0x5a,
+  0x03, 0x20, 0x44, 0x96, 0xcc, 0x14, 0x03, 0xf2, 0x17, 0x11, 0x75, 0x0c, 0x00, 0x31, 0x34, 0x3c, 0x34, 0x34, 0x18, 0x23, 0x34, 0x3c, 0xe0, 0x44, 0x10, 0x33, 0x86, 0x03, 0x02, 0xb6, 0x0a, 0x00,
+  0x20, 0x07, 0x00, 0x2c, 0x0a, 0x44, 0x96, 0x54, 0x13, 0x3c, 0x3c, 0x1b, 0x02, 0xac, 0x06, 0x00, 0xc2, 0x0d, 0x00, 0xa8, 0x03, 0x11, 0xb6, 0x06, 0x00, 0x00, 0xce, 0x06, 0x00, 0x26, 0x03, 0x40,
+  0x35, 0x4c, 0x14, 0x44, 0x98, 0x06, 0x10, 0x14, 0x6e, 0x0a, 0x41, 0x54, 0x14, 0x44, 0x30, 0x8e, 0x2c, 0x02, 0xea, 0x28, 0x00, 0x76, 0x33, 0x00, 0xa8, 0x1e, 0x12, 0x55, 0xa8, 0x06, 0x21, 0x4c,
+  0x95, 0xe0, 0x06, 0x10, 0x54, 0x48, 0x0a, 0x01, 0xf8, 0x0d, 0x00, 0xca, 0x06, 0x00, 0xca, 0x2c, 0x00, 0x58, 0x00, 0x00, 0x4a, 0x07, 0x20, 0xd3, 0x3b, 0xe2, 0x0a, 0x02, 0x36, 0x11, 0x02, 0x60,
+  0x00, 0x24, 0xf3, 0x3b, 0x12, 0x07, 0x02, 0x84, 0x11, 0x00, 0x1c, 0x1f, 0x00, 0xd8, 0x0d, 0x11, 0x91, 0x4e, 0x11, 0x30, 0x30, 0x23, 0x71, 0x08, 0x0b, 0x50, 0x3b, 0x13, 0x44, 0x95, 0x54, 0x00,
+  0x07, 0x20, 0x74, 0x4c, 0x26, 0x11, 0x80, 0xb2, 0x33, 0x75, 0x54, 0xb5, 0x5c, 0x13, 0x44, 0x96, 0x03, 0x00, 0x86, 0x00, 0x02, 0x5c, 0x0a, 0xa0, 0x95, 0x54, 0xf6, 0x64, 0xf6, 0x64, 0x17, 0x65,
+  0xb5, 0x54, 0x0a, 0x00, 0x60, 0x74, 0x54, 0x74, 0x4c, 0xd5, 0x5c, 0x20, 0x07, 0x11, 0x54, 0xa8, 0x0a, 0x00, 0x4a, 0x18, 0x02, 0x2c, 0x1f, 0x53, 0x74, 0x54, 0x54, 0x54, 0x53, 0x7a, 0x0a, 0x00,
+  0xa6, 0x1b, 0x00, 0x6a, 0x0a, 0x12, 0xf2, 0x78, 0x11, 0x00, 0x12, 0x00, 0x30, 0x33, 0x12, 0x44, 0x04, 0x00, 0x11, 0xf2, 0xaa, 0x18, 0x02, 0x34, 0x00, 0x00, 0xb2, 0x37, 0x20, 0x13, 0x44, 0x64,
+  0x2d, 0x10, 0xb1, 0xb6, 0x29, 0x40, 0x33, 0xd2, 0x3b, 0x74, 0x0c, 0x2d, 0x01, 0xbc, 0x03, 0x31, 0x0e, 0x23, 0x90, 0x4e, 0x2d, 0x00, 0xb2, 0x03, 0x40, 0x0f, 0x23, 0xcd, 0x1a, 0x94, 0x03, 0x40,
+  0xee, 0x22, 0x0e, 0x2b, 0x8e, 0x03, 0x00, 0x02, 0x00, 0x03, 0xc2, 0x3e, 0x01, 0x3e, 0x03, 0x11, 0xf2, 0xf6, 0x30, 0x02, 0x1e, 0x0e, 0x40, 0x90, 0x3b, 0xee, 0x22, 0x46, 0x03, 0x00, 0x06, 0x00,
+  0x20, 0x0f, 0x2b, 0x70, 0x2d, 0x02, 0xd4, 0x37, 0x00, 0xa2, 0x18, 0x20, 0xb5, 0x64, 0xca, 0x11, 0x02, 0x90, 0x18, 0x00, 0x82, 0x0a, 0x02, 0x3e, 0x00, 0x30, 0xee, 0x22, 0xd2, 0x64, 0x00, 0x15,
+  0x2b, 0x5a, 0x0e, 0x20, 0x43, 0xf2, 0x54, 0x42, 0x03, 0x3e, 0x0e, 0x01, 0x9c, 0x26, 0x01, 0x1c, 0x07, 0x20, 0x74, 0x5c, 0x64, 0x1f, 0x02, 0x5c, 0x03, 0x50, 0x70, 0x3b, 0x53, 0x5c, 0x74, 0x46,
+  0x07, 0x10, 0x4b, 0x40, 0x07, 0x00, 0xf6, 0x45, 0x11, 0x33, 0x4a, 0x07, 0x02, 0xec, 0x14, 0x31, 0xee, 0x32, 0x0e, 0x22, 0x23, 0x02, 0x20, 0x1c, 0x20, 0x0e, 0x33, 0xce, 0x2d, 0x60, 0xb1, 0x4b,
+  0x2f, 0x33, 0xcd, 0x2a, 0x7a, 0x03, 0x13, 0x33, 0x5a, 0x1c, 0x00, 0x4c, 0x1c, 0x22, 0x32, 0x54, 0x52, 0x1c, 0x00, 0x9e, 0x03, 0x20, 0xd1, 0x4b, 0x08, 0x1c, 0x02, 0x0a, 0x1c, 0x04, 0x7e, 0x18,
+  0x20, 0x12, 0x5c, 0x0e, 0x0e, 0x02, 0x36, 0x23, 0x02, 0x1a, 0x00, 0x60, 0x52, 0x5c, 0x53, 0x64, 0x8f, 0x43, 0xb4, 0x03, 0x30, 0x11, 0x54, 0x11, 0x60, 0x15, 0x30, 0x4b, 0x8f, 0x4b, 0xbe, 0x11,
+  0x00, 0xc6, 0x0a, 0x11, 0x12, 0xda, 0x34, 0x10, 0x8f, 0xde, 0x2d, 0x01, 0x42, 0x1c, 0x00, 0xf0, 0x06, 0x40, 0xac, 0x2a, 0x4e, 0x43, 0xc4, 0x26, 0x22, 0x11, 0x5c, 0x6c, 0x03, 0x00, 0xb2, 0x03,
+  0xe0, 0xd4, 0x74, 0xf1, 0x5b, 0xb4, 0x6c, 0xf5, 0x7c, 0x93, 0x6c, 0xf5, 0x74, 0xb4, 0x74, 0x98, 0x0a, 0x40, 0xb0, 0x53, 0x52, 0x6c, 0x68, 0x23, 0x22, 0x90, 0x53, 0x9a, 0x38, 0x02, 0x5a, 0x07,
+  0x00, 0xd0, 0x26, 0xa0, 0x36, 0x8d, 0x15, 0x85, 0x93, 0x7c, 0x56, 0x95, 0xf5, 0x84, 0x90, 0x03, 0xf0, 0x1b, 0xf9, 0xb5, 0xb8, 0xad, 0xd9, 0xb5, 0x5b, 0xc6, 0x56, 0xa5, 0xb4, 0x94, 0xf9, 0xbd,
+  0x19, 0xc6, 0x19, 0xc6, 0x35, 0xa5, 0x34, 0xad, 0x71, 0x94, 0x13, 0xad, 0xd2, 0xa4, 0x70, 0x9c, 0xd1, 0xa4, 0xf2, 0xac, 0x90, 0xa4, 0xd1, 0xac, 0xd1, 0xac, 0xb1, 0xa4, 0x04, 0x00, 0xb2, 0xb1,
+  0xa4, 0x13, 0xb5, 0x33, 0xb5, 0x33, 0xb5, 0x53, 0xb5, 0x54, 0x20, 0x07, 0x25, 0xb5, 0x94, 0x26, 0x07, 0x00, 0x56, 0x15, 0x80, 0x37, 0xd6, 0xd6, 0xcd, 0x91, 0x9c, 0x17, 0xce, 0x4a, 0x0e, 0xc0,
+  0x58, 0xd6, 0xb9, 0xe6, 0x17, 0xd6, 0x57, 0xde, 0xf5, 0xcd, 0x12, 0xb5, 0x34, 0x07, 0x60, 0x94, 0xc5, 0xf2, 0xac, 0x32, 0xb5, 0xd4, 0x06, 0x21, 0xf7, 0x54, 0xbc, 0x06, 0x21, 0x54, 0xd7, 0xe4,
+  0x06, 0x01, 0x02, 0x11, 0x00, 0x9a, 0x14, 0x12, 0x44, 0x00, 0x11, 0x02, 0x98, 0x14, 0x01, 0x8a, 0x14, 0x01, 0x0c, 0x00, 0x00, 0xbe, 0x03, 0x00, 0x8a, 0x22, 0x11, 0x30, 0x3a, 0x37, 0x20, 0x30,
+  0x23, 0x48, 0x03, 0x31, 0x51, 0x2b, 0x91, 0x3a, 0x22, 0x03, 0xd2, 0x0d, 0x03, 0x44, 0x0a, 0x11, 0xd2, 0x0c, 0x1f, 0x20, 0x13, 0x3c, 0x1a, 0x0e, 0x00, 0xb6, 0x03, 0x22, 0x96, 0x54, 0xc0, 0x06,
+  0x40, 0xd2, 0x3b, 0xef, 0x1a, 0xb8, 0x06, 0x00, 0xb8, 0x14, 0x30, 0xb2, 0x3b, 0x34, 0xd8, 0x02, 0x00, 0xde, 0x06, 0x10, 0x64, 0x9e, 0x06, 0xb0, 0xf3, 0x43, 0x91, 0x33, 0x30, 0x2b, 0x51, 0x2b,
+  0xf3, 0x43, 0xd2, 0x78, 0x14, 0x11, 0x33, 0x26, 0x00, 0x01, 0x48, 0x11, 0x22, 0x55, 0x4c, 0xc0, 0x14, 0x06, 0x82, 0x18, 0x51, 0x54, 0x4c, 0xd3, 0x3b, 0xf3, 0xe2, 0x06, 0x40, 0x13, 0x44, 0x75,
+  0x4c, 0x6c, 0x29, 0x02, 0xe0, 0x14, 0x30, 0x13, 0x44, 0x54, 0x86, 0x07, 0x12, 0x54, 0x88, 0x00, 0x00, 0x5c, 0x00, 0x80, 0xf6, 0x5c, 0xf6, 0x5c, 0xd6, 0x5c, 0x54, 0x4c, 0x86, 0x03, 0x01, 0x94,
+  0x03, 0x00, 0x6a, 0x07, 0x12, 0x5c, 0x9a, 0x03, 0x00, 0xbe, 0x06, 0x03, 0x2a, 0x0e, 0x22, 0x54, 0xf2, 0xcc, 0x06, 0x12, 0x33, 0x54, 0x07, 0x11, 0xf2, 0x78, 0x0a, 0x02, 0x14, 0x00, 0x40, 0xd1,
+  0x3b, 0xf2, 0x43, 0xe4, 0x41, 0x31, 0x90, 0x33, 0xd1, 0xce, 0x1b, 0x00, 0xe8, 0x14, 0x10, 0x74, 0x02, 0x0a, 0x10, 0x3b, 0x40, 0x03, 0x00, 0x6a, 0x1f, 0x00, 0xde, 0x22, 0x00, 0x46, 0x0e, 0x02,
+  0xb2, 0x0a, 0x00, 0x58, 0x0e, 0x01, 0xf8, 0x14, 0x21, 0x44, 0x74, 0xb4, 0x03, 0x00, 0x0a, 0x00, 0x11, 0x70, 0x24, 0x0e, 0x11, 0xd2, 0xb8, 0x03, 0x20, 0x33, 0x4c, 0x9e, 0x03, 0x01, 0xda, 0x30,
+  0x01, 0xaa, 0x11, 0xa0, 0x53, 0x54, 0xb5, 0x5c, 0x54, 0x54, 0x13, 0x4c, 0x90, 0x33, 0xce, 0x11, 0x02, 0xde, 0x0a, 0x02, 0xb8, 0x11, 0x00, 0x84, 0x07, 0x11, 0x53, 0x8e, 0x07, 0x31, 0x91, 0x3b,
+  0x54, 0xa8, 0x1f, 0x04, 0xba, 0x03, 0x31, 0x12, 0x4c, 0x91, 0x30, 0x26, 0x00, 0x92, 0x11, 0x00, 0x46, 0x03, 0x11, 0x53, 0xbe, 0x0a, 0x02, 0x8c, 0x11, 0x00, 0x68, 0x03, 0x40, 0x0f, 0x2b, 0xee,
+  0x2a, 0x10, 0x07, 0x02, 0x30, 0x23, 0x21, 0xee, 0x22, 0x5c, 0x1c, 0x14, 0x43, 0xa0, 0x2d, 0x02, 0x22, 0x3f, 0x20, 0x0e, 0x2b, 0x9a, 0x26, 0xb1, 0xcd, 0x22, 0x8d, 0x1a, 0xee, 0x2a, 0x8d, 0x1a,
+  0x6c, 0x12, 0x4f, 0x46, 0x15, 0x02, 0xa8, 0x03, 0x40, 0x2f, 0x33, 0xd6, 0x6c, 0xbc, 0x11, 0x11, 0xf2, 0xd4, 0x06, 0x02, 0x08, 0x4d, 0x00, 0x90, 0x11, 0x00, 0x44, 0x23, 0x60, 0x2f, 0x3b, 0x2f,
+  0x3b, 0x2e, 0x33, 0x7e, 0x03, 0x40, 0x6f, 0x3b, 0x2f, 0x3b, 0x46, 0x1c, 0x02, 0xc8, 0x18, 0x02, 0x98, 0x0a, 0x00, 0x5e, 0x0e, 0x00, 0xde, 0x11, 0x11, 0xf2, 0xd2, 0x42, 0x00, 0xec, 0x18, 0x22,
+  0xb1, 0x4b, 0xf4, 0x18, 0x10, 0x90, 0x1c, 0x00, 0x00, 0x0c, 0x00, 0x02, 0x9c, 0x0a, 0x12, 0x4b, 0xd6, 0x42, 0x00, 0xd2, 0x2d, 0x00, 0x0e, 0x07, 0x40, 0xf5, 0x74, 0xf5, 0x74, 0xf0, 0x34, 0x00,
+  0x20, 0x15, 0x00, 0xac, 0x0a, 0x02, 0x62, 0x03, 0x00, 0x1c, 0x07, 0x11, 0xd0, 0x0a, 0x00, 0x10, 0x93, 0x58, 0x23, 0x30, 0x64, 0x6f, 0x43, 0x20, 0x15, 0x12, 0xd0, 0xe2, 0x2d, 0xc1, 0x5b, 0x53,
+  0x6c, 0x93, 0x6c, 0xb4, 0x74, 0x73, 0x6c, 0x94, 0x6c, 0xb0, 0x82, 0x3f, 0x01, 0x06, 0x0e, 0x10, 0x64, 0x92, 0x03, 0x00, 0x70, 0x38, 0x10, 0xb4, 0x3e, 0x31, 0x12, 0x5b, 0x54, 0x2a, 0x01, 0x80,
+  0x03, 0x10, 0x4b, 0x4e, 0x23, 0x61, 0x93, 0x6c, 0x11, 0x64, 0xd4, 0x74, 0xa6, 0x38, 0x01, 0xe8, 0x2d, 0x02, 0x2c, 0x00, 0x32, 0x6f, 0x4b, 0x32, 0x50, 0x1c, 0xf0, 0x18, 0x74, 0xb4, 0x7c, 0x77,
+  0x9d, 0x94, 0x84, 0x56, 0x95, 0x98, 0xa5, 0x3e, 0xdf, 0x5b, 0xc6, 0x57, 0xa5, 0xd9, 0xbd, 0x32, 0x84, 0xd9, 0xbd, 0x9b, 0xd6, 0x52, 0x8c, 0xf4, 0x9c, 0xf8, 0xbd, 0x55, 0xad, 0x75, 0xb5, 0x74,
+  0xb5, 0xf2, 0xa4, 0xaa, 0x18, 0x00, 0x8c, 0x03, 0x40, 0xf2, 0xb4, 0xf2, 0xb4, 0x4c, 0x03, 0x60, 0x53, 0xbd, 0x53, 0xbd, 0x33, 0xb5, 0x80, 0x03, 0x70, 0x54, 0xbd, 0x53, 0xb5, 0x54, 0xb5, 0x74,
+  0x04, 0x00, 0x20, 0xbd, 0x94, 0x56, 0x0e, 0x14, 0xc5, 0x92, 0x03, 0x61, 0x58, 0xd6, 0x99, 0xde, 0x99, 0xde, 0xd6, 0x11, 0xf2, 0x06, 0xd6, 0x17, 0xce, 0x16, 0xce, 0x37, 0xd6, 0xd5, 0xcd, 0x57,
+  0xd6, 0xd5, 0xcd, 0x4f, 0x9c, 0x70, 0x9c, 0x73, 0xbd, 0x90, 0xa4, 0xbe, 0x25, 0x10, 0x10, 0x72, 0x29, 0x10, 0x0a, 0x8c, 0x2c, 0x20, 0xf3, 0x3b, 0x92, 0x22, 0x01, 0x56, 0x0a, 0x00, 0x98, 0x22,
+  0x00, 0x70, 0x06, 0x03, 0x90, 0x22, 0x00, 0x8e, 0x03, 0x00, 0x8a, 0x06, 0x00, 0x30, 0x0e, 0x00, 0x0a, 0x00, 0x00, 0x20, 0x00, 0x71, 0x96, 0x4c, 0xb6, 0x5c, 0x75, 0x54, 0x14, 0xd0, 0x0d, 0x11,
+  0xd3, 0x0e, 0x0a, 0x04, 0xea, 0x0d, 0x00, 0xa6, 0x06, 0x22, 0x14, 0x44, 0xc8, 0x0d, 0x00, 0xac, 0x06, 0x40, 0x55, 0x4c, 0x14, 0x44, 0x66, 0x03, 0x71, 0x14, 0x44, 0x34, 0x4c, 0xb6, 0x5c, 0x96,
+  0x0c, 0x03, 0x60, 0x91, 0x33, 0x74, 0x4c, 0x95, 0x54, 0x80, 0x33, 0x11, 0x70, 0x9c, 0x1e, 0x22, 0x13, 0x44, 0x1e, 0x30, 0x00, 0xd0, 0x36, 0x00, 0x00, 0x11, 0x13, 0x54, 0x9a, 0x0a, 0x80, 0x55,
+  0x4c, 0x96, 0x54, 0xb6, 0x54, 0x54, 0x4c, 0xf8, 0x06, 0x00, 0x2e, 0x07, 0x00, 0x8c, 0x18, 0x00, 0x62, 0x1f, 0x02, 0x5a, 0x0e, 0x00, 0x50, 0x0e, 0x01, 0xea, 0x14, 0x70, 0x44, 0xb6, 0x54, 0x74,
+  0x4c, 0x91, 0x33, 0x10, 0x00, 0x00, 0x24, 0x18, 0x20, 0x54, 0x4c, 0x7e, 0x0e, 0x00, 0x22, 0x07, 0x02, 0xa4, 0x03, 0x11, 0xf2, 0x34, 0x07, 0x02, 0xa4, 0x00, 0x00, 0xb4, 0x0a, 0x22, 0xce, 0x12,
+  0x12, 0x2d, 0x20, 0x91, 0x33, 0x1c, 0x07, 0x00, 0xaa, 0x11, 0x31, 0xf2, 0x3b, 0x34, 0x52, 0x0a, 0x02, 0x4a, 0x26, 0x00, 0x30, 0x07, 0x20, 0x70, 0x33, 0xe8, 0x22, 0x71, 0xee, 0x1a, 0x50, 0x2b,
+  0xee, 0x1a, 0x2f, 0x3e, 0x34, 0x00, 0xfc, 0x03, 0x00, 0x76, 0x11, 0x21, 0x13, 0x4c, 0x26, 0x1c, 0x01, 0xd0, 0x22, 0x00, 0x3c, 0x26, 0x02, 0x28, 0x26, 0x11, 0x91, 0xa6, 0x1f, 0x00, 0xce, 0x00,
+  0x00, 0x9a, 0x03, 0x22, 0x91, 0x33, 0x5a, 0x0e, 0x11, 0x33, 0x90, 0x03, 0x20, 0x70, 0x2b, 0x42, 0x00, 0x01, 0xe6, 0x06, 0x30, 0x2b, 0xee, 0x1a, 0x5e, 0x00, 0x00, 0x4a, 0x0e, 0x00, 0x04, 0x00,
+  0x11, 0x33, 0x4c, 0x00, 0x00, 0x70, 0x2d, 0x20, 0x50, 0x33, 0x68, 0x07, 0x00, 0xc4, 0x11, 0x70, 0x50, 0x33, 0x90, 0x33, 0xad, 0x12, 0x91, 0x92, 0x0e, 0x03, 0x5a, 0x15, 0x00, 0x6e, 0x00, 0x02,
+  0xba, 0x03, 0x00, 0x98, 0x07, 0x40, 0x2f, 0x2b, 0x91, 0x3b, 0xf6, 0x18, 0x40, 0xf2, 0x4b, 0x50, 0x33, 0x04, 0x07, 0x11, 0x91, 0x36, 0x0e, 0x00, 0x84, 0x0a, 0x10, 0x2f, 0x3c, 0x31, 0x41, 0x33,
+  0xce, 0x22, 0x91, 0x5c, 0x1c, 0x13, 0x91, 0x3e, 0x38, 0x00, 0xb8, 0x0a, 0x01, 0x38, 0x31, 0x21, 0x54, 0xb1, 0x96, 0x03, 0x13, 0xb1, 0x30, 0x31, 0x51, 0xd2, 0x4b, 0xd6, 0x6c, 0xd2, 0x56, 0x0e,
+  0x03, 0x52, 0x38, 0x52, 0x5c, 0x94, 0x64, 0xd1, 0x4b, 0xfc, 0x06, 0x31, 0xb5, 0x6c, 0xb1, 0x3a, 0x07, 0x11, 0x90, 0x6c, 0x15, 0x02, 0x24, 0x46, 0x00, 0x28, 0x07, 0x00, 0x70, 0x03, 0x02, 0x26,
+  0x15, 0x20, 0x12, 0x54, 0xe4, 0x1f, 0x22, 0x32, 0x54, 0x52, 0x38, 0x11, 0xb5, 0xe8, 0x18, 0x00, 0x8e, 0x0a, 0x21, 0x33, 0x5c, 0xf2, 0x11, 0x01, 0x42, 0x23, 0x22, 0x33, 0x5c, 0xfa, 0x34, 0x51,
+  0xed, 0x2a, 0xee, 0x32, 0xd1, 0x0c, 0x35, 0x20, 0x12, 0x54, 0xe2, 0x2d, 0x00, 0x8c, 0x18, 0x01, 0x4a, 0x0e, 0xf1, 0x01, 0x4b, 0xac, 0x2a, 0x8c, 0x22, 0xed, 0x32, 0x0e, 0x3b, 0xed, 0x32, 0x6b,
+  0x22, 0x6b, 0x22, 0x0e, 0x72, 0x1c, 0x22, 0xb0, 0x4b, 0x46, 0x1c, 0x11, 0x4f, 0x66, 0x0e, 0x00, 0xae, 0x03, 0x00, 0xe8, 0x34, 0x00, 0x08, 0x43, 0x11, 0xf1, 0x22, 0x0e, 0x11, 0x73, 0x8c, 0x46,
+  0x11, 0xd1, 0x00, 0x43, 0x00, 0xc8, 0x26, 0x80, 0x0e, 0x3b, 0xcc, 0x32, 0x8f, 0x4b, 0xb4, 0x74, 0xa8, 0x0a, 0x42, 0xd4, 0x74, 0x11, 0x5c, 0xb2, 0x0a, 0x00, 0x64, 0x2a, 0x00, 0x94, 0x0a, 0x00,
+  0x24, 0x0e, 0x20, 0xf5, 0x7c, 0x98, 0x3f, 0x00, 0x16, 0x00, 0x00, 0xca, 0x0a, 0x00, 0x54, 0x23, 0x30, 0xf1, 0x5b, 0xf1, 0x6c, 0x31, 0x10, 0x53, 0x84, 0x03, 0x80, 0x31, 0x64, 0x52, 0x6c, 0xb4,
+  0x74, 0x32, 0x6c, 0x80, 0x2a, 0xf0, 0x0f, 0x4f, 0x53, 0x32, 0x74, 0x11, 0x6c, 0xd1, 0x6b, 0x36, 0x95, 0xb0, 0x63, 0x6f, 0x63, 0x77, 0xad, 0x3a, 0xc6, 0x7b, 0xce, 0x9b, 0xd6, 0x77, 0xad, 0xb4,
+  0x94, 0xf4, 0x9c, 0xbb, 0xd6, 0x42, 0x15, 0xa0, 0xf7, 0xc5, 0x95, 0xb5, 0xf3, 0xa4, 0x91, 0x9c, 0xd2, 0xa4, 0x18, 0x07, 0x00, 0x02, 0x00, 0x00, 0xb0, 0x0a, 0x40, 0xf1, 0xb4, 0x12, 0xb5, 0x04,
+  0x0e, 0x51, 0xf2, 0xac, 0x13, 0xb5, 0x53, 0x28, 0x07, 0x11, 0x54, 0x92, 0x03, 0x04, 0x22, 0x07, 0x00, 0x98, 0x03, 0x20, 0xf6, 0xcd, 0x26, 0x07, 0x31, 0xd2, 0xa4, 0x57, 0xb0, 0x0a, 0x00, 0xda,
+  0x11, 0x20, 0x74, 0xbd, 0x60, 0x15, 0x80, 0x57, 0xde, 0x57, 0xde, 0x36, 0xd6, 0xd5, 0xcd, 0xc8, 0x06, 0x41, 0x14, 0x3c, 0x54, 0x44, 0xfc, 0x0d, 0x34, 0x5c, 0xb6, 0x54, 0x3e, 0x1b, 0x11, 0x34,
+  0xe8, 0x06, 0x11, 0x54, 0x28, 0x07, 0x00, 0xfc, 0x0d, 0x04, 0x76, 0x0a, 0x11, 0x14, 0x0a, 0x0e, 0x22, 0x55, 0x44, 0x20, 0x00, 0x11, 0x55, 0xd6, 0x1e, 0x11, 0x34, 0xf8, 0x02, 0x40, 0xf7, 0x64,
+  0xf7, 0x64, 0x42, 0x00, 0x00, 0xe8, 0x0d, 0x20, 0xb6, 0x54, 0xce, 0x0d, 0x12, 0xb6, 0x50, 0x03, 0x12, 0x44, 0x52, 0x03, 0x00, 0xb8, 0x03, 0x00, 0xbe, 0x03, 0x20, 0xf3, 0x43, 0x2a, 0x0a, 0x00,
+  0x9e, 0x06, 0x02, 0xb6, 0x0d, 0x00, 0x0c, 0x00, 0xe0, 0x17, 0x65, 0xd6, 0x64, 0x54, 0x54, 0xf7, 0x64, 0x17, 0x65, 0x17, 0x6d, 0xf7, 0x64, 0x2a, 0x11, 0x00, 0x2a, 0x00, 0x00, 0x58, 0x00, 0x00,
+  0x70, 0x1f, 0x02, 0x48, 0x03, 0x23, 0xb2, 0x33, 0x5e, 0x15, 0x10, 0x4c, 0xc6, 0x29, 0x11, 0x13, 0x36, 0x07, 0x20, 0xb1, 0x33, 0x0c, 0x07, 0x03, 0x58, 0x37, 0x02, 0xf8, 0x18, 0x01, 0x36, 0x00,
+  0x00, 0xd4, 0x11, 0x00, 0x92, 0x03, 0x00, 0x1e, 0x07, 0x60, 0xf3, 0x43, 0xb1, 0x33, 0x71, 0x2b, 0x00, 0x03, 0x11, 0xf3, 0x4e, 0x03, 0x00, 0x38, 0x15, 0x00, 0xe4, 0x14, 0x00, 0x18, 0x0b, 0x02,
+  0xae, 0x11, 0x00, 0xfa, 0x14, 0x00, 0x00, 0x1c, 0x50, 0xce, 0x1a, 0x30, 0x2b, 0xb2, 0x9a, 0x1b, 0x12, 0x3b, 0x52, 0x00, 0x02, 0xb8, 0x37, 0x20, 0xb5, 0x5c, 0x40, 0x07, 0x00, 0x0e, 0x03, 0x02,
+  0x98, 0x0a, 0x01, 0x4e, 0x15, 0x01, 0xd8, 0x06, 0x02, 0x08, 0x15, 0x20, 0x33, 0x4c, 0x9c, 0x11, 0x00, 0x10, 0x07, 0x12, 0xd2, 0xcc, 0x22, 0x12, 0x3b, 0x80, 0x03, 0x00, 0xa4, 0x0d, 0x02, 0x5c,
+  0x2d, 0x20, 0x90, 0x33, 0xd4, 0x03, 0x13, 0x0e, 0x16, 0x23, 0x00, 0xae, 0x03, 0x00, 0x20, 0x12, 0x00, 0xb8, 0x03, 0x31, 0x74, 0x54, 0xd2, 0xea, 0x0a, 0x00, 0xa6, 0x03, 0x02, 0xb8, 0x03, 0x00,
+  0x04, 0x3f, 0x20, 0x0e, 0x23, 0x64, 0x0e, 0x11, 0x90, 0x84, 0x03, 0x11, 0x12, 0xc2, 0x15, 0x11, 0x90, 0xde, 0x0a, 0x20, 0x4f, 0x2b, 0xfc, 0x11, 0x11, 0x12, 0x3e, 0x07, 0x00, 0x20, 0x3f, 0x00,
+  0xb0, 0x03, 0x01, 0x4c, 0x07, 0x01, 0xe2, 0x45, 0x00, 0x36, 0x46, 0x00, 0x52, 0x23, 0x00, 0xc4, 0x0a, 0x40, 0x91, 0x43, 0x50, 0x33, 0x2c, 0x00, 0x40, 0x50, 0x33, 0xb1, 0x43, 0x36, 0x38, 0x00,
+  0x26, 0x12, 0x02, 0xe6, 0x11, 0x00, 0x8c, 0x1c, 0x31, 0x95, 0x5c, 0xd2, 0x2a, 0x3f, 0x00, 0x5e, 0x3f, 0x82, 0x0f, 0x33, 0x2f, 0x33, 0x0f, 0x33, 0x0e, 0x33, 0xba, 0x18, 0x22, 0xd1, 0x4b, 0xe2,
+  0x2d, 0x11, 0x12, 0x8a, 0x11, 0x00, 0x26, 0x0e, 0x02, 0x58, 0x38, 0x60, 0xb1, 0x43, 0x4f, 0x33, 0x33, 0x54, 0xc2, 0x18, 0x20, 0x33, 0x54, 0x2a, 0x07, 0x02, 0xb2, 0x0a, 0x11, 0x70, 0x32, 0x00,
+  0x00, 0x36, 0x1c, 0x00, 0x56, 0x46, 0x40, 0x0e, 0x33, 0x90, 0x43, 0xaa, 0x0a, 0x02, 0xf2, 0x26, 0x01, 0x5e, 0x4d, 0x00, 0xca, 0x03, 0x50, 0x53, 0x4f, 0x43, 0x90, 0x43, 0x12, 0x00, 0x21, 0x74,
+  0x64, 0xb8, 0x0a, 0x50, 0x53, 0x4f, 0x3b, 0x12, 0x5c, 0x14, 0x1c, 0x02, 0x30, 0x23, 0x11, 0xb0, 0xdc, 0x2d, 0xa0, 0x16, 0x7d, 0xf5, 0x74, 0x98, 0x8d, 0xb4, 0x6c, 0xd5, 0x74, 0x78, 0x23, 0x00,
+  0x2a, 0x07, 0x00, 0x1c, 0x0e, 0x02, 0x0a, 0x35, 0x11, 0x93, 0x38, 0x03, 0x00, 0xa0, 0x03, 0x02, 0x4e, 0x23, 0x02, 0x84, 0x38, 0x42, 0x0d, 0x3b, 0xb0, 0x53, 0x90, 0x03, 0x02, 0x1c, 0x15, 0x20,
+  0xd5, 0x7c, 0x8c, 0x3f, 0x02, 0x6e, 0x31, 0xa0, 0xb0, 0x53, 0x93, 0x74, 0x6f, 0x4b, 0x4e, 0x4b, 0x52, 0x6c, 0x66, 0x31, 0x62, 0xb4, 0x74, 0x52, 0x64, 0xb4, 0x74, 0x90, 0x0a, 0x11, 0x52, 0xa6,
+  0x03, 0x20, 0x93, 0x74, 0x86, 0x03, 0x00, 0x00, 0x35, 0x00, 0x40, 0x07, 0x20, 0xb4, 0x74, 0x96, 0x38, 0x20, 0xd0, 0x5b, 0xec, 0x26, 0x00, 0x88, 0x38, 0xf2, 0x25, 0x16, 0x8d, 0x15, 0x8d, 0x8f,
+  0x5b, 0x11, 0x74, 0xd8, 0xad, 0x77, 0x9d, 0x9b, 0xc6, 0xfc, 0xd6, 0xdc, 0xce, 0x97, 0xad, 0xab, 0x4a, 0x2d, 0x63, 0xd4, 0x94, 0xd4, 0x94, 0x93, 0x8c, 0x11, 0x7c, 0xb3, 0x94, 0x72, 0x8c, 0x10,
+  0x7c, 0x30, 0x84, 0xd3, 0x9c, 0xf3, 0xa4, 0xb2, 0x9c, 0xb2, 0xa4, 0xf3, 0xac, 0xf2, 0xac, 0xd4, 0x1f, 0x71, 0x33, 0xb5, 0xd1, 0xac, 0xf1, 0xac, 0x12, 0x8a, 0x03, 0x01, 0xb8, 0x0a, 0x00, 0x92,
+  0x03, 0x21, 0xbd, 0x54, 0x04, 0x00, 0x00, 0x10, 0x00, 0x00, 0xee, 0x11, 0x00, 0x04, 0x20, 0x20, 0xd6, 0xcd, 0x22, 0x07, 0x40, 0xf6, 0xcd, 0x78, 0xde, 0x02, 0x00, 0xe0, 0xfa, 0xee, 0x57, 0xd6,
+  0x74, 0xbd, 0x78, 0xde, 0x57, 0xde, 0xd5, 0xcd, 0xd9, 0xe6, 0x12, 0x11, 0x02, 0x02, 0x00, 0x00, 0x6a, 0x0a, 0x00, 0x98, 0x22, 0x00, 0x68, 0x06, 0x40, 0xb6, 0x5c, 0x96, 0x54, 0x7e, 0x03, 0x10,
+  0x55, 0xf8, 0x06, 0x00, 0x78, 0x29, 0x01, 0x30, 0x26, 0x20, 0xf3, 0x3b, 0xf2, 0x06, 0x02, 0x70, 0x22, 0x11, 0x14, 0x62, 0x0e, 0x00, 0x7e, 0x03, 0x40, 0x17, 0x65, 0x18, 0x6d, 0x4a, 0x03, 0x40,
+  0xd6, 0x5c, 0xb6, 0x5c, 0xca, 0x03, 0x00, 0x8c, 0x06, 0x03, 0x34, 0x1f, 0x01, 0x4e, 0x00, 0x00, 0x36, 0x00, 0x00, 0x2c, 0x0a, 0x21, 0x71, 0x33, 0x68, 0x22, 0x10, 0x3b, 0x06, 0x00, 0x00, 0xec,
+  0x1e, 0x20, 0xf3, 0x43, 0xfc, 0x06, 0x00, 0xe4, 0x05, 0x20, 0xf7, 0x64, 0xa2, 0x03, 0x00, 0x4a, 0x03, 0x11, 0xd2, 0x9c, 0x41, 0x02, 0x20, 0x45, 0x02, 0xd6, 0x25, 0x00, 0x28, 0x2d, 0x42, 0x2f,
+  0x1b, 0xef, 0x12, 0xf8, 0x06, 0x12, 0x13, 0x74, 0x26, 0x01, 0x28, 0x03, 0x00, 0x2e, 0x07, 0x00, 0x70, 0x3e, 0x02, 0xd0, 0x41, 0x22, 0xb2, 0x3b, 0x06, 0x0e, 0x13, 0x33, 0x70, 0x03, 0x00, 0x26,
+  0x15, 0x00, 0xf4, 0x0a, 0x00, 0x82, 0x26, 0x10, 0xb1, 0xec, 0x02, 0x02, 0x3c, 0x00, 0x01, 0x58, 0x2d, 0x11, 0xb2, 0x2e, 0x07, 0x02, 0xac, 0x26, 0x00, 0x9a, 0x18, 0x02, 0x60, 0x03, 0x00, 0x28,
+  0x04, 0x00, 0x2e, 0x00, 0x22, 0xae, 0x12, 0x7a, 0x00, 0x00, 0xc2, 0x11, 0x13, 0xd2, 0x9a, 0x03, 0x02, 0x46, 0x34, 0x02, 0xc0, 0x30, 0x00, 0xec, 0x06, 0x00, 0xca, 0x0d, 0x00, 0x12, 0x31, 0x02,
+  0x3e, 0x07, 0x41, 0x4f, 0x2b, 0xee, 0x1a, 0xcc, 0x37, 0x01, 0x5e, 0x34, 0x00, 0x50, 0x0e, 0x00, 0xd6, 0x0a, 0x12, 0xd1, 0x74, 0x34, 0x00, 0xf0, 0x06, 0x10, 0x44, 0xdc, 0x0a, 0x00, 0x9a, 0x1c,
+  0x40, 0x13, 0x4c, 0x50, 0x2b, 0x46, 0x07, 0x20, 0x4f, 0x23, 0x56, 0x2a, 0x00, 0xee, 0x2d, 0x02, 0xa4, 0x2d, 0x41, 0x50, 0x33, 0x0f, 0x23, 0xba, 0x53, 0x02, 0xb4, 0x2d, 0x00, 0x5a, 0x42, 0x21,
+  0x3b, 0xd1, 0x4c, 0x31, 0x31, 0x50, 0x2b, 0xd1, 0x42, 0x2a, 0x01, 0x5e, 0x07, 0x10, 0x33, 0x76, 0x0a, 0xd1, 0xce, 0x1a, 0x2b, 0x02, 0x6c, 0x0a, 0x4b, 0x02, 0xcd, 0x1a, 0xee, 0x22, 0x2f, 0x22,
+  0x31, 0x02, 0xce, 0x18, 0x60, 0x13, 0x54, 0x53, 0x54, 0xd2, 0x43, 0xec, 0x06, 0x02, 0x08, 0x00, 0x00, 0x80, 0x03, 0x00, 0x68, 0x23, 0x00, 0xfe, 0x26, 0x00, 0x24, 0x12, 0x02, 0xdc, 0x0a, 0x00,
+  0x2a, 0x00, 0x80, 0x4c, 0x12, 0x0f, 0x2b, 0xad, 0x1a, 0x91, 0x43, 0x0e, 0x19, 0x22, 0xce, 0x2a, 0x88, 0x0a, 0x00, 0xca, 0x18, 0x20, 0x50, 0x3b, 0xce, 0x50, 0x00, 0x24, 0x0e, 0x01, 0xd6, 0x42,
+  0x31, 0x4b, 0x13, 0x54, 0x96, 0x15, 0x41, 0x5c, 0x91, 0x43, 0x0f, 0xbc, 0x11, 0x11, 0x70, 0x56, 0x23, 0x02, 0x06, 0x00, 0x11, 0x33, 0x4e, 0x38, 0x00, 0x54, 0x5b, 0x00, 0xc0, 0x0a, 0x62, 0xd5,
+  0x6c, 0xb5, 0x6c, 0xb0, 0x43, 0x8c, 0x3f, 0x00, 0x12, 0x27, 0x02, 0xb6, 0x0a, 0x80, 0x32, 0x54, 0x2e, 0x33, 0x6c, 0x1a, 0xcd, 0x2a, 0xa8, 0x03, 0x31, 0xad, 0x2a, 0x90, 0x98, 0x03, 0x11, 0xb5,
+  0xc2, 0x11, 0x20, 0x2f, 0x3b, 0x5a, 0x15, 0x02, 0xe2, 0x18, 0x20, 0x6f, 0x43, 0x0c, 0x0e, 0x60, 0xcd, 0x32, 0x0e, 0x3b, 0xac, 0x2a, 0x4e, 0x0e, 0x00, 0xea, 0x18, 0x11, 0x32, 0x46, 0x1c, 0x01,
+  0x62, 0x3f, 0x01, 0x6a, 0x3f, 0x40, 0x73, 0x6c, 0xb4, 0x74, 0x22, 0x15, 0x22, 0x73, 0x6c, 0x12, 0x43, 0x40, 0x73, 0x6c, 0x6f, 0x4b, 0x60, 0x03, 0x30, 0x8f, 0x4b, 0x73, 0x9e, 0x18, 0x01, 0x02,
+  0x00, 0x80, 0x4f, 0x4b, 0x32, 0x64, 0x93, 0x74, 0x93, 0x74, 0x66, 0x03, 0x20, 0x2e, 0x43, 0x60, 0x2a, 0x42, 0x2e, 0x43, 0x32, 0x6c, 0xac, 0x46, 0x20, 0xaf, 0x53, 0xa0, 0x3f, 0x02, 0x1a, 0x00,
+  0x00, 0x08, 0x2e, 0x00, 0xb2, 0x3f, 0x60, 0x0d, 0x43, 0xac, 0x3a, 0x2e, 0x4b, 0x8e, 0x38, 0x40, 0x93, 0x74, 0x36, 0x85, 0x40, 0x43, 0x80, 0x93, 0x7c, 0x73, 0x74, 0x6f, 0x53, 0x4f, 0x53, 0x08,
+  0x27, 0x00, 0x1c, 0x3c, 0xf2, 0x1c, 0x32, 0x74, 0x72, 0x7c, 0xf4, 0x8c, 0x14, 0x95, 0x96, 0xa5, 0x76, 0xa5, 0x35, 0x9d, 0x11, 0x7c, 0xd0, 0x73, 0xb3, 0x94, 0x11, 0x7c, 0x35, 0x9d, 0x59, 0xc6,
+  0x14, 0x9d, 0xf4, 0x9c, 0x93, 0x94, 0xd3, 0x9c, 0xf4, 0xa4, 0x14, 0xad, 0xd3, 0xa4, 0xb2, 0xa4, 0xd2, 0x02, 0x00, 0x10, 0xac, 0x1c, 0x07, 0x00, 0x02, 0x00, 0x00, 0xe0, 0x11, 0x62, 0x13, 0xb5,
+  0x13, 0xad, 0x13, 0xad, 0x96, 0x03, 0x02, 0xc6, 0x0a, 0x02, 0xb8, 0x0a, 0x40, 0x17, 0xce, 0x37, 0xd6, 0x9e, 0x03, 0x60, 0x37, 0xd6, 0x17, 0xce, 0x57, 0xd6, 0xb0, 0x0a, 0x00, 0x36, 0x07, 0x80,
+  0x98, 0xe6, 0x57, 0xd6, 0xf6, 0xcd, 0xd5, 0xcd, 0x54, 0x1f, 0x00, 0xfa, 0x0d, 0x40, 0xae, 0x02, 0xce, 0x02, 0xf4, 0x2c, 0x82, 0x30, 0x23, 0xce, 0x0a, 0x0c, 0x02, 0x6d, 0x02, 0xd4, 0x2c, 0x00,
+  0x66, 0x11, 0x22, 0x34, 0x44, 0xb2, 0x22, 0x20, 0x92, 0x2b, 0xd0, 0x1b, 0x20, 0x92, 0x33, 0xe2, 0x1b, 0x00, 0xaa, 0x03, 0x00, 0x0c, 0x07, 0x11, 0x14, 0xfe, 0x02, 0x80, 0x71, 0x2b, 0xcf, 0x12,
+  0x4d, 0x02, 0xce, 0x12, 0xee, 0x4b, 0x00, 0xaa, 0x18, 0x00, 0x22, 0x00, 0x00, 0x06, 0x00, 0x01, 0x84, 0x3e, 0x01, 0xa0, 0x14, 0x00, 0x66, 0x0e, 0x13, 0xf3, 0x08, 0x45, 0x00, 0x68, 0x26, 0x30,
+  0x54, 0x54, 0xd2, 0x52, 0x29, 0x00, 0x50, 0x29, 0x41, 0x12, 0x30, 0x23, 0x50, 0xbc, 0x48, 0x00, 0xae, 0x4f, 0x00, 0x0a, 0x03, 0x11, 0xd2, 0xa6, 0x1b, 0x20, 0x50, 0x2b, 0x38, 0x07, 0x00, 0x5a,
+  0x03, 0x03, 0x20, 0x0e, 0x11, 0x54, 0xda, 0x41, 0x00, 0x2e, 0x04, 0x10, 0x5c, 0x12, 0x00, 0x00, 0x7a, 0x18, 0x00, 0x9a, 0x26, 0x40, 0xb5, 0x54, 0xb6, 0x5c, 0x12, 0x1c, 0x00, 0x36, 0x07, 0x11,
+  0x91, 0x2e, 0x07, 0x00, 0x7a, 0x06, 0x00, 0x5c, 0x03, 0x00, 0x46, 0x00, 0x02, 0xac, 0x06, 0x82, 0x91, 0x33, 0xef, 0x1a, 0xce, 0x1a, 0xb1, 0x33, 0x2a, 0x0e, 0x02, 0x34, 0x3b, 0x02, 0x7a, 0x1f,
+  0x20, 0x74, 0x54, 0x92, 0x1f, 0x22, 0xf3, 0x43, 0x2e, 0x15, 0x00, 0x6a, 0x03, 0x02, 0x48, 0x0e, 0x00, 0x38, 0x1c, 0x00, 0x3c, 0x00, 0x11, 0x95, 0x5c, 0x12, 0x00, 0x98, 0x03, 0x02, 0xc2, 0x26,
+  0x00, 0x42, 0x00, 0x00, 0x32, 0x23, 0x02, 0x96, 0x15, 0x02, 0x40, 0x31, 0x00, 0x98, 0x03, 0x31, 0x12, 0x44, 0x90, 0x54, 0x23, 0x11, 0x0f, 0xc4, 0x2d, 0x40, 0xad, 0x12, 0x2f, 0x2b, 0xce, 0x06,
+  0x10, 0x90, 0x58, 0x0e, 0x02, 0x6a, 0x3b, 0x11, 0x3b, 0xd8, 0x18, 0x10, 0x3b, 0xf2, 0x0a, 0x02, 0x4e, 0x00, 0x00, 0x38, 0x00, 0x40, 0x0f, 0x1b, 0x70, 0x2b, 0xc2, 0x06, 0x00, 0xfa, 0x26, 0x00,
+  0x44, 0x03, 0x22, 0x95, 0x5c, 0x7e, 0x11, 0x10, 0xb1, 0xc6, 0x0a, 0x01, 0xfe, 0x11, 0x00, 0xd6, 0x06, 0x04, 0xe6, 0x0a, 0x20, 0xb1, 0x3b, 0x46, 0x0e, 0x02, 0xba, 0x0a, 0x11, 0x13, 0x08, 0x00,
+  0x01, 0x84, 0x23, 0x00, 0x30, 0x1c, 0x00, 0xe8, 0x03, 0x50, 0x33, 0xce, 0x22, 0xee, 0x22, 0x02, 0x0e, 0x20, 0xcd, 0x1a, 0xb6, 0x03, 0x00, 0xf0, 0x06, 0x51, 0x50, 0x33, 0x4f, 0x33, 0x50, 0x06,
+  0x0b, 0x11, 0x70, 0xde, 0x49, 0x00, 0x86, 0x03, 0x41, 0x8d, 0x1a, 0xad, 0x1a, 0xfe, 0x11, 0x72, 0x2a, 0xce, 0x22, 0x2f, 0x33, 0xd2, 0x4b, 0xd6, 0x11, 0x00, 0x2e, 0x07, 0x22, 0x54, 0x5c, 0x06,
+  0x12, 0x10, 0x53, 0x4c, 0x5b, 0x10, 0x54, 0x12, 0x07, 0x00, 0x94, 0x03, 0x00, 0xa4, 0x03, 0x00, 0x84, 0x38, 0x11, 0x70, 0x32, 0x19, 0x00, 0x10, 0x0b, 0x00, 0x70, 0x03, 0x30, 0x6f, 0x3b, 0x4f,
+  0x20, 0x20, 0x10, 0x32, 0x5a, 0x3f, 0x00, 0x66, 0x03, 0x00, 0x94, 0x15, 0x00, 0x16, 0x2e, 0x40, 0x4b, 0x12, 0xac, 0x22, 0x54, 0x0e, 0x02, 0xb2, 0x11, 0x11, 0x90, 0x66, 0x23, 0x41, 0xd5, 0x74,
+  0xf2, 0x53, 0xea, 0x06, 0x01, 0x32, 0x27, 0x33, 0x70, 0x43, 0x12, 0x9c, 0x4d, 0x40, 0x73, 0x64, 0xb1, 0x4b, 0x24, 0x15, 0x00, 0xba, 0x11, 0x00, 0x74, 0x1c, 0x02, 0x12, 0x3c, 0x00, 0xa6, 0x03,
+  0x00, 0x90, 0x3f, 0xa0, 0x53, 0x64, 0xb0, 0x4b, 0x0e, 0x3b, 0x0e, 0x3b, 0x90, 0x4b, 0x76, 0x38, 0x04, 0xa6, 0x4d, 0x00, 0xa8, 0x46, 0x20, 0x32, 0x64, 0x92, 0x03, 0x00, 0x36, 0x07, 0x00, 0x94,
+  0x0a, 0x00, 0xfa, 0x0d, 0x20, 0x73, 0x6c, 0xb2, 0x11, 0x20, 0xd4, 0x7c, 0x9a, 0x0a, 0xf0, 0x07, 0x94, 0x74, 0xb4, 0x7c, 0x94, 0x74, 0xf5, 0x7c, 0x94, 0x74, 0x32, 0x64, 0xb4, 0x74, 0xf5, 0x84,
+  0x73, 0x74, 0x93, 0x74, 0xb4, 0x74, 0x14, 0x07, 0x20, 0x73, 0x6c, 0x06, 0x07, 0xc2, 0x2e, 0x43, 0xb3, 0x74, 0x15, 0x85, 0x35, 0x85, 0x15, 0x85, 0xd4, 0x7c, 0x04, 0x00, 0xf0, 0x07, 0x15, 0x85,
+  0x93, 0x74, 0x56, 0x8d, 0x36, 0x8d, 0x15, 0x8d, 0xd5, 0x84, 0x32, 0x6c, 0xd5, 0x84, 0x16, 0x8d, 0xd5, 0x84, 0x93, 0x7c, 0xfe, 0x1f, 0xf0, 0x03, 0x52, 0x7c, 0xf5, 0x8c, 0x31, 0x74, 0xb7, 0xa5,
+  0x9a, 0xc6, 0x5a, 0xbe, 0x97, 0xad, 0x3a, 0xbe, 0xd8, 0xb5, 0x6a, 0x15, 0x00, 0x80, 0x1c, 0x42, 0x93, 0x84, 0xf5, 0x94, 0x30, 0x07, 0xc0, 0x93, 0x94, 0x14, 0xa5, 0xd3, 0x9c, 0x71, 0x94, 0xd2,
+  0xa4, 0xf3, 0xac, 0xbe, 0x0a, 0x00, 0xc0, 0x0a, 0x05, 0x94, 0x03, 0x10, 0xad, 0x94, 0x03, 0x02, 0xb8, 0x0a, 0x15, 0x74, 0x00, 0x19, 0x02, 0x46, 0x0e, 0xf1, 0x02, 0x78, 0xde, 0x58, 0xd6, 0x57,
+  0xd6, 0x57, 0xd6, 0x16, 0xce, 0x77, 0xde, 0x98, 0xde, 0xb9, 0xe6, 0x36, 0x72, 0x15, 0x71, 0xb8, 0xe6, 0xf3, 0x3b, 0xf3, 0x33, 0xd2, 0xc4, 0x33, 0x02, 0x22, 0x11, 0x00, 0xfe, 0x10, 0x31, 0x18,
+  0x65, 0xd7, 0x6c, 0x0a, 0x20, 0x96, 0x54, 0x82, 0x0a, 0x00, 0x18, 0x0a, 0x00, 0xb8, 0x14, 0x02, 0x18, 0x5a, 0x31, 0x95, 0x54, 0x55, 0x84, 0x0d, 0x11, 0x51, 0x94, 0x48, 0x00, 0xd0, 0x11, 0x02,
+  0xac, 0x0d, 0x02, 0x22, 0x0e, 0x22, 0xf3, 0x3b, 0x1c, 0x34, 0x00, 0x14, 0x3b, 0x13, 0xd2, 0xde, 0x48, 0x13, 0xd2, 0x06, 0x00, 0x00, 0x44, 0x0a, 0x00, 0x1c, 0x06, 0x00, 0xfa, 0x06, 0x02, 0x82,
+  0x30, 0x10, 0x30, 0x0e, 0x3b, 0x00, 0xf0, 0x29, 0x00, 0xa8, 0x41, 0x01, 0x04, 0x1c, 0x00, 0xc2, 0x29, 0x60, 0x30, 0x23, 0x70, 0x2b, 0x75, 0x4c, 0x78, 0x45, 0x00, 0x88, 0x26, 0x00, 0xbc, 0x30,
+  0x02, 0xea, 0x06, 0x00, 0xfe, 0x02, 0x00, 0x08, 0x00, 0x00, 0x10, 0x34, 0x00, 0xf2, 0x48, 0x04, 0xa6, 0x0a, 0x00, 0x48, 0x34, 0x00, 0x64, 0x00, 0x02, 0x20, 0x00, 0x00, 0x42, 0x04, 0x30, 0xd2,
+  0x3b, 0x91, 0xaf, 0x1b, 0x30, 0x4c, 0xb6, 0x5c, 0xfc, 0x02, 0xa0, 0x12, 0x44, 0x94, 0x54, 0x16, 0x65, 0x17, 0x65, 0x37, 0x6d, 0x7a, 0x0a, 0x11, 0x74, 0x30, 0x19, 0x60, 0xb5, 0x5c, 0xd6, 0x64,
+  0xf6, 0x64, 0xb2, 0x06, 0x00, 0xa6, 0x18, 0x00, 0x10, 0x00, 0x02, 0x74, 0x11, 0x00, 0xc2, 0x1f, 0x11, 0x53, 0xe0, 0x30, 0x31, 0x13, 0x44, 0x94, 0x06, 0x00, 0x20, 0x2f, 0x23, 0xa4, 0x07, 0x20,
+  0x0f, 0x23, 0x3c, 0x50, 0x02, 0x60, 0x1c, 0x00, 0x06, 0x07, 0x00, 0x92, 0x34, 0x40, 0xcd, 0x12, 0xee, 0x1a, 0xfe, 0x3e, 0x01, 0xbe, 0x06, 0x00, 0x00, 0x2e, 0x01, 0x22, 0x03, 0x20, 0x13, 0x44,
+  0x3a, 0x07, 0x02, 0x8c, 0x03, 0x42, 0x4f, 0x2b, 0x0e, 0x23, 0xea, 0x18, 0x71, 0x90, 0x33, 0x0e, 0x23, 0x8d, 0x12, 0x0f, 0xca, 0x2d, 0x00, 0xcc, 0x34, 0x10, 0x2f, 0x2e, 0x00, 0x11, 0x3b, 0x9c,
+  0x2a, 0x01, 0xe2, 0x0d, 0x00, 0xe2, 0x18, 0x02, 0x02, 0x20, 0x30, 0x50, 0x33, 0xf2, 0x76, 0x3b, 0x32, 0x33, 0x0e, 0x2b, 0x50, 0x15, 0x00, 0xf4, 0x0a, 0x11, 0x90, 0x28, 0x20, 0x00, 0x9a, 0x23,
+  0x11, 0xd1, 0xd4, 0x49, 0x11, 0x90, 0x7a, 0x31, 0x02, 0x4e, 0x31, 0x01, 0x6e, 0x03, 0x00, 0x46, 0x2e, 0x50, 0x33, 0x0f, 0x2b, 0xd1, 0x43, 0x56, 0x0e, 0x11, 0x70, 0x46, 0x07, 0x21, 0x70, 0x3b,
+  0x96, 0x03, 0x70, 0x2b, 0x0f, 0x2b, 0x4f, 0x33, 0x0f, 0x2b, 0x08, 0x00, 0x00, 0x48, 0x38, 0x23, 0xf2, 0x4b, 0xe2, 0x57, 0x00, 0xe8, 0x0a, 0x01, 0x70, 0x15, 0x00, 0x00, 0x12, 0x13, 0x33, 0x94,
+  0x0a, 0x00, 0x42, 0x0e, 0x00, 0x9a, 0x07, 0x02, 0x1a, 0x43, 0x20, 0x70, 0x3b, 0x4e, 0x00, 0x00, 0x7a, 0x20, 0x20, 0xd2, 0x4b, 0x7c, 0x5b, 0x01, 0x6c, 0x54, 0x10, 0x4b, 0xbe, 0x03, 0x22, 0x32,
+  0x54, 0x96, 0x1f, 0x00, 0x4e, 0x1c, 0x11, 0x12, 0x6c, 0x1c, 0x00, 0xe0, 0x0a, 0x02, 0x8e, 0x38, 0x11, 0xd1, 0xb2, 0x1f, 0x04, 0x18, 0x27, 0x00, 0xe4, 0x11, 0x20, 0xee, 0x32, 0x2e, 0x1c, 0x00,
+  0xc8, 0x11, 0x00, 0xb8, 0x11, 0x13, 0xb1, 0x2e, 0x27, 0x20, 0x2f, 0x3b, 0xdc, 0x11, 0x20, 0x0e, 0x3b, 0x30, 0x0e, 0x00, 0xb2, 0x0a, 0x00, 0x74, 0x31, 0x00, 0x28, 0x07, 0x00, 0x98, 0x03, 0x02,
+  0xa0, 0x03, 0xc2, 0x94, 0x6c, 0xd5, 0x74, 0x73, 0x6c, 0x53, 0x6c, 0x90, 0x53, 0x4f, 0x4b, 0x30, 0x0e, 0x30, 0x11, 0x5c, 0x32, 0xca, 0x3f, 0x21, 0x5b, 0x94, 0x22, 0x15, 0x20, 0x11, 0x64, 0x08,
+  0x3c, 0x22, 0xd4, 0x74, 0x94, 0x0a, 0x60, 0x32, 0x6c, 0x73, 0x6c, 0xb4, 0x7c, 0x84, 0x03, 0x20, 0x53, 0x6c, 0x50, 0x51, 0xe0, 0x11, 0x64, 0xb4, 0x7c, 0x32, 0x6c, 0x2e, 0x43, 0x6f, 0x53, 0x8f,
+  0x53, 0x4e, 0x4b, 0x30, 0x43, 0x00, 0x00, 0x27, 0xc0, 0x73, 0x74, 0x36, 0x8d, 0xf4, 0x84, 0xf0, 0x63, 0x6e, 0x4b, 0xf0, 0x5b, 0x9e, 0x03, 0x60, 0xed, 0x42, 0xaf, 0x5b, 0x6f, 0x53, 0x36, 0x0e,
+  0xa0, 0x4e, 0x53, 0x90, 0x5b, 0xb0, 0x5b, 0x6f, 0x5b, 0x53, 0x74, 0x1c, 0x07, 0x00, 0x8c, 0x03, 0x40, 0x73, 0x7c, 0xf1, 0x73, 0x9e, 0x31, 0xf0, 0x00, 0x11, 0x74, 0x8e, 0x63, 0x6e, 0x63, 0xf0,
+  0x73, 0x4e, 0x63, 0x2e, 0x5b, 0x93, 0x8c, 0xf5, 0x84, 0x03, 0xf0, 0x08, 0x84, 0xd4, 0x8c, 0xb4, 0x8c, 0xb4, 0x8c, 0xf5, 0x9c, 0xd5, 0x94, 0x36, 0xa5, 0x15, 0xa5, 0xf4, 0x9c, 0xb3, 0x9c, 0xb2,
+  0x9c, 0xb2, 0x9c, 0x24, 0x07, 0x15, 0xf2, 0x8e, 0x03, 0x02, 0xc2, 0x0a, 0x04, 0x24, 0x07, 0x02, 0x72, 0x15, 0x11, 0x95, 0x90, 0x03, 0x60, 0x17, 0xce, 0xda, 0xe6, 0x37, 0xd6, 0xee, 0x18, 0x00,
+  0x84, 0x03, 0xa0, 0x98, 0xde, 0x98, 0xde, 0x78, 0xde, 0xb9, 0xe6, 0x98, 0xde, 0xfe, 0x18, 0x00, 0xfe, 0x14, 0x71, 0x95, 0x4c, 0x17, 0x65, 0x18, 0x65, 0xf7, 0x70, 0x0a, 0x00, 0x3e, 0x18, 0x01,
+  0x0c, 0x45, 0x21, 0x33, 0x30, 0x06, 0x34, 0x00, 0xe0, 0x22, 0x02, 0xaa, 0x1b, 0x01, 0xf2, 0x06, 0x10, 0x33, 0x02, 0x07, 0x00, 0x28, 0x4c, 0x00, 0x3e, 0x03, 0x03, 0xb2, 0x5d, 0x21, 0x3b, 0x55,
+  0x3a, 0x11, 0x04, 0xc6, 0x11, 0x00, 0x3e, 0x11, 0x00, 0xf4, 0x0d, 0x40, 0x95, 0x4c, 0x95, 0x4c, 0x74, 0x11, 0x02, 0x2c, 0x1c, 0x00, 0x2c, 0x03, 0x00, 0xea, 0x1e, 0x00, 0xde, 0x06, 0x00, 0xfa,
+  0x06, 0x00, 0x84, 0x03, 0x00, 0x40, 0x18, 0x00, 0x7a, 0x07, 0x00, 0x34, 0x00, 0x02, 0x4e, 0x2d, 0x00, 0x20, 0x15, 0x11, 0x71, 0x58, 0x53, 0x00, 0xfc, 0x18, 0x03, 0x64, 0x1c, 0x11, 0x44, 0xb4,
+  0x1f, 0x01, 0x18, 0x15, 0x02, 0x7a, 0x11, 0x20, 0x34, 0x4c, 0xbe, 0x03, 0x11, 0xf2, 0x84, 0x26, 0x00, 0x34, 0x15, 0x01, 0x52, 0x03, 0x20, 0x54, 0x54, 0x7a, 0x18, 0x01, 0xb4, 0x26, 0x40, 0x95,
+  0x5c, 0x13, 0x44, 0x32, 0x03, 0x42, 0xef, 0x22, 0x0f, 0x23, 0x28, 0x31, 0x40, 0xd6, 0x5c, 0x13, 0x44, 0xc8, 0x03, 0x40, 0xce, 0x12, 0xce, 0x12, 0x12, 0x38, 0x02, 0xe6, 0x37, 0x00, 0x50, 0x03,
+  0x20, 0xb1, 0x33, 0x54, 0x42, 0xf0, 0x09, 0x4f, 0x23, 0x70, 0x2b, 0x4f, 0x23, 0x0f, 0x1b, 0xee, 0x12, 0x0f, 0x1b, 0x6c, 0x02, 0xea, 0x01, 0xcd, 0x12, 0x8d, 0x02, 0x0b, 0x02, 0x8c, 0x02, 0x88,
+  0x1c, 0x00, 0x7e, 0x0e, 0x02, 0xb8, 0x0a, 0x02, 0x8e, 0x0a, 0x31, 0xd2, 0x43, 0xd2, 0xa2, 0x15, 0x22, 0xd6, 0x64, 0x76, 0x1c, 0x00, 0xa4, 0x34, 0x00, 0xfc, 0x1f, 0x00, 0x6a, 0x03, 0x40, 0xee,
+  0x1a, 0xad, 0x12, 0xdc, 0x0a, 0x03, 0xb0, 0x0a, 0x00, 0x06, 0x0e, 0x01, 0x3c, 0x03, 0x06, 0x70, 0x57, 0x31, 0xce, 0x1a, 0x2f, 0x68, 0x38, 0x11, 0x4f, 0xea, 0x0a, 0x80, 0xce, 0x1a, 0xee, 0x22,
+  0xce, 0x22, 0x4c, 0x0a, 0x44, 0x03, 0x00, 0xae, 0x0a, 0x04, 0x22, 0x5b, 0x00, 0x40, 0x0b, 0x00, 0xf6, 0x14, 0x20, 0x0e, 0x23, 0x7e, 0x03, 0x02, 0x56, 0x38, 0x40, 0x0f, 0x23, 0x12, 0x4c, 0x76,
+  0x03, 0x40, 0xce, 0x22, 0x2f, 0x2b, 0x20, 0x15, 0x00, 0x66, 0x03, 0x00, 0x02, 0x00, 0x00, 0x60, 0x00, 0x00, 0xac, 0x11, 0x00, 0x2a, 0x00, 0x02, 0xf2, 0x42, 0x13, 0xf2, 0x0c, 0x32, 0x11, 0x2f,
+  0x8c, 0x03, 0x00, 0xe8, 0x06, 0x22, 0x91, 0x3b, 0x48, 0x0e, 0x03, 0x80, 0x2a, 0x70, 0x3b, 0x13, 0x54, 0xd2, 0x43, 0x0f, 0x2b, 0x44, 0x07, 0x02, 0x86, 0x15, 0x20, 0xee, 0x2a, 0x5a, 0x19, 0x00,
+  0x64, 0x07, 0x00, 0x88, 0x00, 0x00, 0xbe, 0x31, 0x02, 0x1a, 0x19, 0x00, 0xf0, 0x0a, 0x00, 0x8c, 0x03, 0x40, 0x13, 0x54, 0xf2, 0x53, 0xa8, 0x0a, 0x00, 0xaa, 0x38, 0x02, 0x5a, 0x1c, 0x04, 0x9c,
+  0x46, 0x00, 0xfc, 0x06, 0x00, 0xec, 0x34, 0x00, 0x34, 0x2e, 0x20, 0x0e, 0x33, 0x98, 0x26, 0x11, 0xf1, 0xc8, 0x2d, 0x00, 0x12, 0x51, 0x20, 0x2f, 0x3b, 0xfc, 0x18, 0x00, 0x22, 0x00, 0x00, 0x10,
+  0x0e, 0x20, 0x33, 0x5c, 0x1a, 0x07, 0x71, 0xf1, 0x53, 0xf2, 0x53, 0x73, 0x64, 0x94, 0x24, 0x0e, 0x02, 0x02, 0x2e, 0x22, 0x94, 0x6c, 0x64, 0x15, 0x00, 0x26, 0x00, 0x20, 0x73, 0x6c, 0x22, 0x07,
+  0x20, 0x53, 0x64, 0xf2, 0x26, 0x00, 0x4e, 0x51, 0x00, 0xfc, 0x18, 0x00, 0x1e, 0x0e, 0x02, 0x20, 0x15, 0x20, 0x12, 0x64, 0x8a, 0x11, 0x02, 0x18, 0x4a, 0x31, 0x73, 0x6c, 0x16, 0xe4, 0x06, 0x60,
+  0xd4, 0x74, 0x94, 0x74, 0x93, 0x74, 0xb4, 0x11, 0x00, 0x86, 0x03, 0x20, 0xb4, 0x74, 0x78, 0x0a, 0x10, 0x52, 0x84, 0x38, 0x92, 0x64, 0x4e, 0x4b, 0xed, 0x3a, 0x32, 0x64, 0xd4, 0x7c, 0x42, 0x15,
+  0x00, 0x92, 0x31, 0x50, 0x8f, 0x53, 0xf1, 0x63, 0xd0, 0x98, 0x3f, 0x90, 0x64, 0x93, 0x74, 0x36, 0x8d, 0x11, 0x64, 0x31, 0x6c, 0x14, 0x00, 0x60, 0x73, 0x74, 0xf0, 0x63, 0x72, 0x74, 0x20, 0x07,
+  0xa0, 0x15, 0x85, 0xf5, 0x84, 0xd4, 0x84, 0x73, 0x7c, 0x93, 0x7c, 0xac, 0x0a, 0x50, 0xb4, 0x84, 0x94, 0x84, 0x73, 0x98, 0x03, 0xf4, 0x1e, 0x84, 0xd4, 0x8c, 0x36, 0x9d, 0xb4, 0x8c, 0x36, 0xa5,
+  0x57, 0xa5, 0x53, 0x84, 0x73, 0x8c, 0x93, 0x8c, 0x94, 0x8c, 0x94, 0x8c, 0xd4, 0x94, 0x94, 0x8c, 0xb4, 0x94, 0xd5, 0x94, 0x94, 0x8c, 0x93, 0x8c, 0x93, 0x8c, 0xb3, 0x94, 0xb3, 0x94, 0xd3, 0x9c,
+  0x14, 0xa5, 0x13, 0xad, 0x8a, 0x03, 0x02, 0x96, 0x03, 0x00, 0xb6, 0x0a, 0x01, 0x28, 0x07, 0x10, 0xad, 0x92, 0x03, 0x11, 0x74, 0x3e, 0x0e, 0x00, 0xb6, 0x2a, 0x20, 0x70, 0x9c, 0xb0, 0x0a, 0x00,
+  0xda, 0x11, 0x00, 0x06, 0x00, 0x00, 0x26, 0x07, 0x40, 0x78, 0xde, 0x17, 0xce, 0x0a, 0x00, 0x00, 0x5e, 0x15, 0x00, 0xd6, 0x3a, 0x11, 0x91, 0x88, 0x4f, 0x03, 0xd8, 0x1b, 0x12, 0x44, 0x02, 0x1c,
+  0x00, 0x3c, 0x03, 0x00, 0x38, 0x1c, 0x02, 0x8c, 0x37, 0x00, 0x32, 0x2d, 0x02, 0xd6, 0x1b, 0x02, 0x92, 0x11, 0x02, 0xba, 0x29, 0x10, 0x34, 0x62, 0x1c, 0x01, 0x4c, 0x61, 0x11, 0xd2, 0xc6, 0x14,
+  0x00, 0x48, 0x18, 0x20, 0x34, 0x44, 0x62, 0x1c, 0x01, 0x04, 0x38, 0x01, 0x0a, 0x1c, 0x11, 0xf2, 0xce, 0x02, 0x03, 0x98, 0x30, 0x01, 0xb8, 0x48, 0x00, 0x66, 0x1f, 0x11, 0x54, 0x80, 0x26, 0x00,
+  0x00, 0x15, 0x02, 0xce, 0x0d, 0x02, 0x3e, 0x1c, 0x60, 0xb1, 0x33, 0x34, 0x44, 0xd6, 0x5c, 0x02, 0x00, 0x00, 0x84, 0x0e, 0x00, 0x6e, 0x34, 0x02, 0x2c, 0x0a, 0x00, 0x8e, 0x00, 0x02, 0x90, 0x1f,
+  0x00, 0x1c, 0x1c, 0x00, 0xac, 0x0e, 0x22, 0xf2, 0x3b, 0xca, 0x1f, 0x13, 0x33, 0xa4, 0x11, 0x22, 0xf2, 0x3b, 0xac, 0x34, 0x05, 0x10, 0x15, 0x11, 0x23, 0x84, 0x5a, 0x10, 0x23, 0x1a, 0x0a, 0x22,
+  0x0e, 0x1b, 0x8c, 0x18, 0xe0, 0x94, 0x54, 0x33, 0x44, 0x53, 0x4c, 0xb1, 0x33, 0x0f, 0x1b, 0xad, 0x0a, 0xee, 0x1a, 0x18, 0x00, 0x22, 0x91, 0x33, 0x80, 0x23, 0x10, 0xd2, 0xc6, 0x02, 0x01, 0x7c,
+  0x07, 0x40, 0x33, 0x4c, 0xb5, 0x54, 0x1c, 0x27, 0x22, 0x94, 0x54, 0x8c, 0x2a, 0x00, 0xfa, 0x3b, 0x00, 0x5a, 0x07, 0x04, 0xc4, 0x11, 0x11, 0x74, 0x30, 0x23, 0x11, 0x70, 0xb6, 0x1f, 0x03, 0x66,
+  0x11, 0x01, 0x62, 0x20, 0x03, 0x34, 0x27, 0x21, 0x4c, 0x13, 0xea, 0x34, 0x00, 0xec, 0x11, 0x20, 0xd1, 0x3b, 0x40, 0x0e, 0x00, 0x26, 0x00, 0x01, 0x2a, 0x54, 0x01, 0xa2, 0x0b, 0x00, 0x42, 0x00,
+  0x00, 0x6c, 0x0e, 0x00, 0x20, 0x00, 0x00, 0x9c, 0x2a, 0x13, 0xf2, 0x9e, 0x42, 0x20, 0xd2, 0x43, 0x92, 0x06, 0x71, 0xce, 0x22, 0xcd, 0x1a, 0xce, 0x22, 0x0f, 0x74, 0x1c, 0x31, 0x2f, 0x2b, 0xd1,
+  0x74, 0x38, 0x40, 0x94, 0x5c, 0xb5, 0x5c, 0x4c, 0x0b, 0x00, 0xa8, 0x23, 0x00, 0x20, 0x1c, 0x22, 0x95, 0x5c, 0xb6, 0x31, 0x11, 0xb1, 0x22, 0x2e, 0x02, 0xbe, 0x03, 0x01, 0x84, 0x1c, 0x50, 0x2b,
+  0x8d, 0x12, 0x0f, 0x2b, 0x42, 0x12, 0x02, 0x9c, 0x00, 0x26, 0xd2, 0x43, 0xf0, 0x50, 0x40, 0x33, 0x54, 0xd2, 0x4b, 0x20, 0x35, 0x00, 0x12, 0x66, 0x51, 0xb5, 0x64, 0x13, 0x54, 0x91, 0x7e, 0x0a,
+  0x11, 0x74, 0x70, 0x27, 0x41, 0xd2, 0x4b, 0xb5, 0x64, 0xf0, 0x65, 0x01, 0x02, 0x00, 0x00, 0x64, 0x1c, 0x00, 0xf6, 0x31, 0x00, 0x1e, 0x07, 0x00, 0x90, 0x20, 0x00, 0x96, 0x5b, 0x11, 0xd2, 0x3e,
+  0x19, 0x02, 0x1e, 0x00, 0x40, 0xd5, 0x6c, 0xf2, 0x4b, 0x48, 0x35, 0x00, 0x3a, 0x0e, 0x11, 0xb1, 0xc8, 0x11, 0x01, 0x4c, 0x0e, 0x10, 0x53, 0x78, 0x03, 0x00, 0x62, 0x0a, 0x40, 0xee, 0x32, 0xcd,
+  0x2a, 0x3c, 0x35, 0x00, 0x22, 0x20, 0x20, 0x73, 0x64, 0x9c, 0x11, 0x00, 0xb6, 0x18, 0x00, 0x16, 0x15, 0x00, 0xb6, 0x3f, 0x00, 0x2c, 0x07, 0x00, 0x58, 0x2a, 0x00, 0x6e, 0x31, 0x02, 0xf4, 0x1f,
+  0x03, 0xa0, 0x38, 0x10, 0x4b, 0xe8, 0x1f, 0x00, 0xb4, 0x11, 0x20, 0xb1, 0x53, 0xc0, 0x54, 0x22, 0x90, 0x4b, 0x40, 0x51, 0x40, 0xf2, 0x5b, 0x53, 0x64, 0xd8, 0x06, 0x02, 0x46, 0x15, 0x91, 0x0e,
+  0x43, 0x0e, 0x3b, 0xd0, 0x5b, 0x32, 0x64, 0x8f, 0x9e, 0x46, 0x20, 0xd0, 0x5b, 0xb6, 0x0a, 0x20, 0x12, 0x64, 0xfa, 0x06, 0x00, 0x88, 0x31, 0x40, 0x12, 0x64, 0xb4, 0x74, 0x14, 0x43, 0x42, 0x52,
+  0x6c, 0x90, 0x53, 0x06, 0x35, 0x40, 0x15, 0x85, 0xb4, 0x74, 0x36, 0x07, 0xd1, 0x15, 0x85, 0xf5, 0x7c, 0xb4, 0x7c, 0xd4, 0x7c, 0xf5, 0x84, 0xf5, 0x84, 0x93, 0x96, 0x2a, 0x00, 0xb6, 0x03, 0xe0,
+  0x72, 0x74, 0xf0, 0x63, 0xb3, 0x7c, 0xf5, 0x84, 0xf0, 0x63, 0xd4, 0x84, 0x73, 0x74, 0xe6, 0x46, 0x00, 0x52, 0x3c, 0x00, 0x44, 0x43, 0x11, 0x32, 0x02, 0x00, 0x20, 0x52, 0x7c, 0x04, 0x00, 0xf0,
+  0x0d, 0x53, 0x7c, 0xf1, 0x73, 0x70, 0x63, 0xf1, 0x7b, 0x94, 0x8c, 0x19, 0xbe, 0x3a, 0xc6, 0x7b, 0xc6, 0xf5, 0x94, 0x94, 0x8c, 0xf5, 0x9c, 0x36, 0x9d, 0x36, 0xa5, 0xd5, 0x94, 0x90, 0x03, 0x42,
+  0xd5, 0x94, 0xf5, 0x94, 0xbc, 0x0a, 0x04, 0x24, 0x07, 0x22, 0xf2, 0xa4, 0x16, 0x20, 0x06, 0xb6, 0x0a, 0x24, 0x12, 0xad, 0xb6, 0x0a, 0x01, 0xde, 0x11, 0x30, 0xb5, 0x12, 0xad, 0xb8, 0x0a, 0x22,
+  0x12, 0xad, 0x46, 0x27, 0x20, 0x78, 0xde, 0x46, 0x0e, 0x00, 0x06, 0x00, 0x00, 0x26, 0x07, 0x02, 0xcc, 0x06, 0x02, 0x10, 0x34, 0x10, 0xf3, 0x38, 0x03, 0x01, 0x0e, 0x4c, 0x00, 0xd8, 0x02, 0x00,
+  0xd8, 0x0d, 0x02, 0x6e, 0x03, 0x00, 0x2e, 0x15, 0x22, 0xf7, 0x64, 0xb4, 0x11, 0x00, 0x3e, 0x03, 0x12, 0x55, 0x46, 0x18, 0x11, 0x43, 0x78, 0x30, 0x03, 0x66, 0x3e, 0x04, 0x98, 0x0a, 0x02, 0x8a,
+  0x0a, 0x01, 0xf8, 0x22, 0x11, 0x3c, 0x96, 0x3e, 0x23, 0x33, 0xd2, 0x74, 0x26, 0x20, 0xb5, 0x54, 0x04, 0x1c, 0x22, 0xb5, 0x5c, 0xce, 0x29, 0x02, 0x0e, 0x42, 0x13, 0xf2, 0x58, 0x18, 0x22, 0xb1,
+  0x33, 0xbe, 0x45, 0x02, 0x8a, 0x23, 0x31, 0x50, 0x2b, 0xf3, 0x32, 0x00, 0x02, 0xf8, 0x06, 0x02, 0xbe, 0x2d, 0x20, 0xf2, 0x3b, 0xc0, 0x03, 0x02, 0x32, 0x23, 0x40, 0xee, 0x12, 0xee, 0x1a, 0xae,
+  0x2d, 0x00, 0x90, 0x0e, 0x04, 0xb4, 0x18, 0x21, 0xb1, 0x33, 0x02, 0x07, 0x00, 0x5c, 0x0a, 0x10, 0x1b, 0x2c, 0x0a, 0x00, 0x18, 0x00, 0x22, 0xd1, 0x3b, 0x16, 0x1c, 0x02, 0x8e, 0x3b, 0x00, 0xbe,
+  0x11, 0x02, 0x76, 0x42, 0x71, 0xd1, 0x3b, 0x33, 0x44, 0xd5, 0x5c, 0xd5, 0x8a, 0x00, 0x02, 0x9e, 0x18, 0x13, 0x13, 0x52, 0x3f, 0x11, 0x53, 0x72, 0x15, 0x03, 0xd6, 0x18, 0x10, 0x44, 0x4c, 0x11,
+  0x00, 0x5c, 0x12, 0x20, 0xce, 0x12, 0xe2, 0x03, 0x04, 0xda, 0x1f, 0x00, 0xc6, 0x2d, 0x02, 0x9a, 0x18, 0x02, 0xf4, 0x34, 0x11, 0x90, 0x38, 0x07, 0x02, 0x36, 0x00, 0x00, 0xc2, 0x03, 0x00, 0x54,
+  0x2e, 0x04, 0x76, 0x15, 0x00, 0x04, 0x27, 0x00, 0x5a, 0x1c, 0x51, 0x57, 0x75, 0xb5, 0x64, 0x13, 0x38, 0x20, 0x02, 0x4c, 0x0e, 0x02, 0xc6, 0x18, 0x00, 0x0a, 0x27, 0x00, 0xe4, 0x02, 0x00, 0x90,
+  0x1c, 0x11, 0x4f, 0x52, 0x00, 0x02, 0x3a, 0x1c, 0x00, 0x12, 0x03, 0x40, 0x4f, 0x33, 0x70, 0x33, 0x50, 0x03, 0x40, 0xee, 0x22, 0xee, 0x22, 0x64, 0x0e, 0x02, 0x7e, 0x38, 0x00, 0x2e, 0x0e, 0x02,
+  0x44, 0x03, 0x00, 0xc2, 0x03, 0x02, 0xb6, 0x18, 0x11, 0xd2, 0x1c, 0x00, 0x40, 0x54, 0x54, 0xd6, 0x6c, 0x7e, 0x38, 0x00, 0xf8, 0x26, 0x00, 0x38, 0x0e, 0x22, 0xee, 0x22, 0x94, 0x54, 0x01, 0x18,
+  0x20, 0x03, 0x54, 0x69, 0x00, 0x0c, 0x19, 0x00, 0xb8, 0x38, 0x00, 0xaa, 0x31, 0x00, 0x84, 0x03, 0x00, 0xd0, 0x23, 0x02, 0xb4, 0x31, 0x23, 0xd2, 0x4b, 0x24, 0x58, 0x01, 0x0a, 0x32, 0x02, 0x4c,
+  0x43, 0x02, 0xea, 0x31, 0x00, 0x34, 0x07, 0x00, 0x06, 0x66, 0x10, 0x2f, 0xf0, 0x1f, 0x10, 0x3b, 0xe2, 0x1f, 0x42, 0x4f, 0x3b, 0xb1, 0x43, 0x04, 0x00, 0x01, 0x5c, 0x1c, 0x00, 0xd0, 0x4d, 0x10,
+  0x4b, 0x48, 0x0e, 0x01, 0x2c, 0x07, 0x00, 0xaa, 0x54, 0x01, 0x0e, 0x27, 0x00, 0x7e, 0x31, 0x11, 0x0d, 0x24, 0x43, 0x00, 0xb0, 0x18, 0x00, 0x0a, 0x0e, 0x22, 0xd1, 0x53, 0x78, 0x31, 0x00, 0x86,
+  0x31, 0x01, 0x08, 0x2e, 0x01, 0x20, 0x0e, 0x00, 0xd0, 0x11, 0x02, 0x00, 0x20, 0x40, 0xcd, 0x32, 0xb0, 0x53, 0x10, 0x07, 0x00, 0xdc, 0x1f, 0x11, 0xb1, 0x0e, 0x07, 0x42, 0xd1, 0x53, 0x90, 0x53,
+  0xac, 0x11, 0x00, 0xdc, 0x18, 0x00, 0x04, 0x00, 0x00, 0x9a, 0x03, 0x00, 0x78, 0x31, 0x00, 0x1e, 0x00, 0x00, 0x7e, 0x23, 0x51, 0xed, 0x3a, 0x0e, 0x43, 0x52, 0x2e, 0x07, 0xa2, 0x94, 0x74, 0x53,
+  0x6c, 0x0d, 0x43, 0x32, 0x6c, 0x94, 0x74, 0x1a, 0x3c, 0x60, 0x32, 0x6c, 0xf5, 0x7c, 0x32, 0x6c, 0x08, 0x00, 0x22, 0xb0, 0x53, 0x9a, 0x0a, 0x40, 0xb0, 0x5b, 0x32, 0x6c, 0x26, 0x63, 0x00, 0xba,
+  0x38, 0x60, 0xb0, 0x5b, 0x93, 0x74, 0xd4, 0x7c, 0x96, 0x03, 0x10, 0x8f, 0x62, 0x43, 0x00, 0xc6, 0x03, 0x10, 0x74, 0xe0, 0x0a, 0x40, 0xd4, 0x84, 0x93, 0x7c, 0xca, 0x11, 0xf0, 0x13, 0x36, 0x95,
+  0x93, 0x84, 0x8f, 0x63, 0x6f, 0x5b, 0xf1, 0x73, 0x12, 0x74, 0xf6, 0x94, 0x36, 0x9d, 0x57, 0xa5, 0x36, 0xa5, 0xf1, 0x7b, 0xd0, 0x73, 0x53, 0x84, 0x52, 0x84, 0x11, 0x7c, 0xf1, 0x7b, 0xf1, 0x7b,
+  0x28, 0x07, 0x11, 0x73, 0x2a, 0x07, 0x00, 0x98, 0x03, 0x80, 0xb4, 0x94, 0xd4, 0x9c, 0xb3, 0x94, 0x92, 0x94, 0x90, 0x03, 0x13, 0xb2, 0xb6, 0x0a, 0x01, 0x9a, 0x1c, 0x16, 0xac, 0x8e, 0x03, 0x03,
+  0x70, 0x15, 0x01, 0x26, 0x07, 0x00, 0x5c, 0x27, 0x20, 0xd2, 0xa4, 0xbc, 0x23, 0x21, 0xd5, 0xc5, 0x84, 0x1c, 0x03, 0x54, 0x0e, 0x21, 0x78, 0xde, 0xae, 0x4f, 0x01, 0x88, 0x3e, 0x00, 0xfa, 0x18,
+  0x01, 0x14, 0x15, 0x00, 0xc8, 0x06, 0x00, 0xd6, 0x3a, 0x21, 0x23, 0x50, 0x96, 0x3e, 0x00, 0xae, 0x0d, 0x04, 0x2e, 0x42, 0x00, 0xd6, 0x02, 0x00, 0x92, 0x06, 0x00, 0xf4, 0x0d, 0x11, 0x95, 0x32,
+  0x18, 0x11, 0x75, 0x42, 0x06, 0x20, 0xd6, 0x5c, 0x1e, 0x0e, 0x02, 0x42, 0x03, 0x00, 0x04, 0x11, 0x00, 0xd8, 0x37, 0x00, 0x42, 0x03, 0x11, 0x95, 0xb6, 0x15, 0x11, 0xd2, 0x94, 0x0a, 0x02, 0xa0,
+  0x3e, 0x00, 0x10, 0x0e, 0x00, 0x46, 0x00, 0x02, 0x98, 0x2d, 0x11, 0xd2, 0x1e, 0x03, 0x00, 0x66, 0x03, 0x04, 0x1c, 0x2a, 0x00, 0x20, 0x03, 0x00, 0xe8, 0x10, 0x02, 0xa8, 0x26, 0x22, 0x0f, 0x1b,
+  0x26, 0x11, 0x02, 0x72, 0x03, 0x00, 0x20, 0x00, 0x13, 0xb1, 0x5e, 0x15, 0x02, 0xe4, 0x0d, 0x11, 0x71, 0x42, 0x18, 0x00, 0xc8, 0x3b, 0x02, 0x80, 0x49, 0x20, 0xf2, 0x3b, 0xb8, 0x03, 0x00, 0x6e,
+  0x0d, 0x00, 0x4a, 0x0a, 0x22, 0xf2, 0x3b, 0x5c, 0x15, 0x02, 0x40, 0x0a, 0x00, 0xb6, 0x06, 0x02, 0x70, 0x18, 0x11, 0x70, 0x32, 0x0a, 0x11, 0x2f, 0x3c, 0x12, 0x00, 0x04, 0x1d, 0x00, 0x96, 0x03,
+  0x02, 0x3c, 0x00, 0x04, 0x2e, 0x46, 0x00, 0x7a, 0x00, 0x22, 0xce, 0x12, 0x5a, 0x07, 0x20, 0x2f, 0x2b, 0xe6, 0x0d, 0x00, 0x70, 0x00, 0x00, 0x1c, 0x38, 0x11, 0xd2, 0x4c, 0x49, 0x00, 0x7a, 0x49,
+  0x00, 0x2c, 0x23, 0x00, 0x10, 0x20, 0x00, 0xa8, 0x03, 0x00, 0xfa, 0x00, 0x40, 0x70, 0x33, 0xee, 0x1a, 0x02, 0x00, 0xa0, 0x8d, 0x0a, 0x6c, 0x02, 0xad, 0x0a, 0xcd, 0x12, 0x2f, 0x23, 0x58, 0x4d,
+  0x80, 0xce, 0x1a, 0xb1, 0x3b, 0xee, 0x22, 0x6c, 0x02, 0x08, 0x00, 0x00, 0x20, 0x15, 0x00, 0x14, 0x07, 0x01, 0xa4, 0x11, 0x01, 0x62, 0x4d, 0x00, 0xe4, 0x0d, 0x51, 0x6c, 0x0a, 0x2f, 0x33, 0x70,
+  0xfe, 0x26, 0x00, 0xe6, 0x03, 0x40, 0xee, 0x22, 0x8d, 0x12, 0xe8, 0x06, 0x82, 0xb1, 0x3b, 0x0e, 0x23, 0x6c, 0x12, 0xce, 0x22, 0x2c, 0x35, 0x24, 0x0e, 0x2b, 0x96, 0x2a, 0x00, 0xda, 0x06, 0x00,
+  0x1e, 0x03, 0x02, 0x14, 0x58, 0x00, 0xf8, 0x57, 0x22, 0xd2, 0x4b, 0x02, 0x00, 0x02, 0xea, 0x65, 0x20, 0xee, 0x2a, 0x0c, 0x00, 0x02, 0x10, 0x20, 0x00, 0x70, 0x03, 0x00, 0x92, 0x11, 0x00, 0xfe,
+  0x26, 0x02, 0xaa, 0x0a, 0xa0, 0xb5, 0x64, 0x95, 0x64, 0x74, 0x5c, 0x54, 0x5c, 0x53, 0x5c, 0x44, 0x00, 0x00, 0x1a, 0x00, 0x20, 0x54, 0x5c, 0x14, 0x0e, 0x00, 0x40, 0x15, 0x20, 0x4f, 0x33, 0x58,
+  0x0e, 0x73, 0x4b, 0x0a, 0xad, 0x22, 0x4f, 0x33, 0x91, 0x50, 0x66, 0x31, 0xee, 0x2a, 0x50, 0xd8, 0x31, 0x10, 0x91, 0x22, 0x20, 0x10, 0x53, 0x90, 0x03, 0x62, 0x33, 0x5c, 0xd2, 0x4b, 0x0e, 0x33,
+  0xde, 0x1f, 0x01, 0xc6, 0x11, 0x12, 0x5c, 0xbe, 0x1f, 0x00, 0x5e, 0x03, 0x00, 0x0a, 0x07, 0x00, 0xb8, 0x2a, 0x13, 0xb0, 0xe2, 0x3f, 0x00, 0xfa, 0x06, 0x04, 0xf0, 0x1f, 0x11, 0x53, 0xbe, 0x18,
+  0x00, 0xe6, 0x1f, 0x00, 0xb2, 0x26, 0x00, 0x2e, 0x3c, 0x02, 0x8a, 0x31, 0x00, 0x02, 0x00, 0x61, 0xac, 0x32, 0x2e, 0x3b, 0xed, 0x32, 0x06, 0x4a, 0x11, 0x53, 0x2e, 0x4a, 0x50, 0x4b, 0xf2, 0x5b,
+  0x74, 0x6c, 0x3c, 0x0e, 0x04, 0xc8, 0x1f, 0x11, 0x4e, 0x14, 0x43, 0x00, 0xee, 0x06, 0x10, 0x52, 0x66, 0x23, 0x30, 0x74, 0x11, 0x5c, 0xd4, 0x1f, 0x00, 0x32, 0x1c, 0x02, 0xc6, 0x11, 0xa0, 0x6f,
+  0x4b, 0x0e, 0x43, 0xac, 0x32, 0x6f, 0x4b, 0x11, 0x64, 0xe8, 0x06, 0x00, 0x58, 0x0e, 0xa0, 0x8f, 0x53, 0x4a, 0x2a, 0xcc, 0x3a, 0x2e, 0x4b, 0x4e, 0x4b, 0xce, 0x4d, 0x22, 0x2e, 0x4b, 0xd4, 0x18,
+  0xe0, 0x53, 0x74, 0xd4, 0x7c, 0x36, 0x8d, 0x93, 0x74, 0xf1, 0x63, 0xd4, 0x7c, 0xd0, 0x5b, 0xc0, 0x0a, 0x80, 0x52, 0x6c, 0x31, 0x6c, 0xb3, 0x7c, 0xb3, 0x7c, 0x90, 0x03, 0x10, 0xf4, 0x92, 0x23,
+  0x10, 0x6c, 0xcc, 0x11, 0xa0, 0x16, 0x95, 0xb4, 0x84, 0xd8, 0xad, 0xf9, 0xad, 0xf9, 0xb5, 0x10, 0x07, 0xf1, 0x12, 0x36, 0x9d, 0x98, 0xad, 0x57, 0xa5, 0xb4, 0x94, 0x73, 0x8c, 0x52, 0x84, 0x93,
+  0x8c, 0x97, 0xad, 0x3a, 0xc6, 0x19, 0xbe, 0x56, 0xa5, 0xf5, 0x94, 0x15, 0x9d, 0x15, 0x9d, 0xd4, 0x94, 0xf5, 0x94, 0xd5, 0x20, 0x07, 0x30, 0xd4, 0x9c, 0xd3, 0x02, 0x00, 0x18, 0xa4, 0x46, 0x0e,
+  0x04, 0x20, 0x07, 0x06, 0x94, 0x03, 0x02, 0x98, 0x1c, 0x00, 0xbc, 0x0a, 0x20, 0x16, 0xce, 0x2c, 0x20, 0x40, 0xf6, 0xcd, 0x16, 0xce, 0x02, 0x00, 0x00, 0xb4, 0x0a, 0x00, 0x40, 0x0e, 0x21, 0x34,
+  0x44, 0x28, 0x31, 0x00, 0x62, 0x1c, 0x01, 0xda, 0x34, 0x02, 0x64, 0x1f, 0x02, 0x90, 0x0d, 0x02, 0x5c, 0x03, 0x40, 0xb6, 0x54, 0xf7, 0x5c, 0x1a, 0x00, 0x62, 0x17, 0x65, 0x17, 0x65, 0x95, 0x54,
+  0xee, 0x14, 0x00, 0xd2, 0x09, 0x01, 0xa4, 0x26, 0x10, 0x43, 0x12, 0x00, 0x00, 0x28, 0x07, 0x11, 0x54, 0xb0, 0x18, 0x02, 0x88, 0x34, 0x00, 0xda, 0x14, 0x00, 0xb8, 0x11, 0x00, 0x7c, 0x23, 0x00,
+  0xe2, 0x03, 0x00, 0x4a, 0x0e, 0x11, 0x54, 0x1a, 0x31, 0x20, 0x94, 0x54, 0xf8, 0x17, 0x33, 0xf6, 0x64, 0x33, 0xae, 0x0a, 0x00, 0x92, 0x06, 0x11, 0xb5, 0xc8, 0x03, 0x51, 0x94, 0x54, 0x95, 0x54,
+  0x12, 0x36, 0x15, 0x12, 0xb1, 0xf4, 0x3e, 0x02, 0xc8, 0x2d, 0x12, 0x4c, 0x50, 0x27, 0x00, 0xae, 0x07, 0x02, 0x2c, 0x15, 0x04, 0xaa, 0x18, 0x00, 0xda, 0x03, 0x02, 0x6c, 0x11, 0x20, 0x91, 0x33,
+  0xc8, 0x0a, 0x02, 0x6e, 0x49, 0x22, 0x50, 0x23, 0xf4, 0x4c, 0x00, 0x0a, 0x03, 0x30, 0x0e, 0x1b, 0x70, 0x96, 0x26, 0x12, 0x2b, 0xa2, 0x03, 0x40, 0x2f, 0x23, 0x6c, 0x02, 0xc2, 0x42, 0x00, 0x3a,
+  0x07, 0x00, 0x1a, 0x00, 0x00, 0x88, 0x1f, 0x11, 0x50, 0x0e, 0x00, 0x02, 0x7c, 0x18, 0x20, 0xd2, 0x3b, 0x56, 0x15, 0x00, 0x9c, 0x23, 0x10, 0x70, 0x0a, 0x07, 0x00, 0xc2, 0x42, 0x51, 0x44, 0xb5,
+  0x54, 0x53, 0x4c, 0x16, 0x2e, 0x20, 0x3b, 0x90, 0x28, 0x18, 0x01, 0xa4, 0x1b, 0x00, 0xbe, 0x06, 0x30, 0x12, 0x54, 0x13, 0x38, 0x1f, 0x20, 0x5c, 0x13, 0xea, 0x34, 0x02, 0xe8, 0x14, 0x00, 0xfc,
+  0x10, 0x01, 0xd4, 0x11, 0x13, 0xd2, 0xbc, 0x1f, 0x00, 0x76, 0x1c, 0x02, 0xfa, 0x42, 0x21, 0xd1, 0x3b, 0xa8, 0x38, 0x01, 0x74, 0x03, 0x00, 0xb0, 0x38, 0x13, 0x12, 0x5a, 0x5b, 0x21, 0x53, 0x54,
+  0xf4, 0x50, 0x00, 0x40, 0x00, 0x01, 0x18, 0x3c, 0x00, 0x58, 0x15, 0x00, 0xea, 0x06, 0x02, 0xf4, 0x03, 0x00, 0x4c, 0x0e, 0x00, 0x52, 0x2a, 0x20, 0xee, 0x2a, 0x32, 0x0e, 0x13, 0x70, 0xca, 0x6c,
+  0x01, 0xe8, 0x1f, 0x00, 0x26, 0x00, 0x00, 0xd8, 0x2d, 0x00, 0xdc, 0x73, 0x10, 0x3b, 0x34, 0x03, 0x11, 0x70, 0xe0, 0x6c, 0x22, 0x54, 0x5c, 0xa4, 0x18, 0x00, 0x9a, 0x03, 0x00, 0x96, 0x03, 0x20,
+  0x33, 0x54, 0x1a, 0x35, 0x20, 0x70, 0x43, 0x78, 0x70, 0x02, 0x8e, 0x31, 0x42, 0x12, 0x54, 0x0f, 0x33, 0x88, 0x03, 0x00, 0x32, 0x00, 0x00, 0x5c, 0x00, 0x11, 0x91, 0x3e, 0x07, 0x00, 0xc6, 0x0a,
+  0x00, 0xc4, 0x31, 0x01, 0x76, 0x07, 0x20, 0x4b, 0xb1, 0xa4, 0x69, 0x01, 0x78, 0x07, 0x13, 0xd2, 0xea, 0x31, 0x11, 0x33, 0x76, 0x35, 0x11, 0xd1, 0x8c, 0x1c, 0x22, 0x4f, 0x3b, 0xac, 0x2a, 0x00,
+  0x20, 0x0e, 0x00, 0x2c, 0x2e, 0x00, 0x6a, 0x0a, 0x00, 0x54, 0x03, 0x00, 0xd2, 0x31, 0x21, 0xf2, 0x53, 0x2e, 0x3c, 0x30, 0x53, 0xed, 0x32, 0x2e, 0x2e, 0x00, 0xbe, 0x23, 0x00, 0xd6, 0x18, 0x02,
+  0x74, 0x03, 0x00, 0x1e, 0x07, 0x00, 0x0e, 0x00, 0x02, 0xe0, 0x2d, 0x02, 0x28, 0x15, 0x20, 0x73, 0x64, 0x28, 0x07, 0x20, 0xf5, 0x7c, 0x98, 0x23, 0x40, 0x16, 0x7d, 0xf5, 0x7c, 0x8a, 0x38, 0x80,
+  0x94, 0x6c, 0xb4, 0x74, 0xd5, 0x74, 0x12, 0x64, 0x84, 0x2a, 0x00, 0xe6, 0x18, 0x40, 0x16, 0x85, 0xd5, 0x7c, 0x24, 0x1c, 0x00, 0x28, 0x0e, 0x00, 0xe0, 0x18, 0x00, 0xca, 0x4d, 0x00, 0xcc, 0x4d,
+  0x00, 0xa6, 0x11, 0x00, 0xf2, 0x26, 0x01, 0xcc, 0x11, 0x30, 0x64, 0x56, 0x8d, 0xbe, 0x0a, 0x60, 0x53, 0x6c, 0x93, 0x74, 0xb0, 0x53, 0x1e, 0x0e, 0x80, 0xf5, 0x7c, 0x36, 0x85, 0xb4, 0x7c, 0xb4,
+  0x7c, 0xe6, 0x18, 0x00, 0xd0, 0x46, 0x00, 0xaa, 0x0a, 0x00, 0x2a, 0x2e, 0x60, 0x36, 0x8d, 0x52, 0x6c, 0x8f, 0x53, 0xdc, 0x46, 0x20, 0x4e, 0x4b, 0x28, 0x00, 0x70, 0xb4, 0x7c, 0xb3, 0x7c, 0xd4,
+  0x84, 0xb3, 0x14, 0x07, 0x50, 0x74, 0x93, 0x7c, 0xd0, 0x63, 0x96, 0x03, 0xf2, 0x09, 0x52, 0x74, 0xf1, 0x6b, 0x2e, 0x53, 0xb4, 0x84, 0x97, 0xa5, 0xb8, 0xa5, 0x15, 0x95, 0x36, 0x9d, 0xb8, 0xad,
+  0x77, 0xa5, 0x77, 0xa5, 0xb8, 0xad, 0xc0, 0x2a, 0xf1, 0x04, 0xf8, 0xb5, 0xb7, 0xad, 0x73, 0x84, 0x93, 0x8c, 0xb3, 0x8c, 0x32, 0x7c, 0xf1, 0x73, 0xf1, 0x73, 0x32, 0x7c, 0x32, 0x62, 0x2e, 0x72,
+  0x52, 0x8c, 0x92, 0x94, 0xb3, 0x9c, 0x92, 0xd4, 0x11, 0x03, 0x94, 0x03, 0x2e, 0x12, 0xad, 0x92, 0x03, 0x35, 0x12, 0xad, 0x53, 0x70, 0x15, 0x40, 0x94, 0xbd, 0xb5, 0xc5, 0x8c, 0x03, 0x02, 0xce,
+  0x2a, 0x11, 0x78, 0xb6, 0x23, 0x22, 0x54, 0x44, 0xd2, 0x26, 0x04, 0x1a, 0x49, 0x02, 0xb0, 0x1b, 0x00, 0x6a, 0x4c, 0x00, 0xfc, 0x48, 0x02, 0x4c, 0x31, 0x01, 0xd8, 0x3e, 0x10, 0x3c, 0x6e, 0x06,
+  0x00, 0xfc, 0x4f, 0x10, 0xee, 0xa2, 0x18, 0x01, 0xac, 0x17, 0x01, 0x38, 0x18, 0x01, 0x04, 0x50, 0x04, 0x08, 0x03, 0x13, 0xf3, 0x64, 0x06, 0x31, 0xb2, 0x3b, 0x33, 0x08, 0x19, 0x01, 0xf0, 0x3e,
+  0x01, 0x00, 0x07, 0x10, 0x33, 0x4e, 0x0a, 0x10, 0x23, 0x5a, 0x03, 0x00, 0x2a, 0x00, 0x40, 0x90, 0x2b, 0x50, 0x23, 0xe8, 0x4c, 0x00, 0xb4, 0x06, 0xd1, 0xee, 0x1a, 0x4f, 0x23, 0x90, 0x33, 0xee,
+  0x1a, 0xad, 0x0a, 0x2f, 0x23, 0xd1, 0x1e, 0x38, 0x02, 0x6e, 0x0a, 0x24, 0xf2, 0x3b, 0x80, 0x0a, 0x02, 0x84, 0x49, 0x00, 0x40, 0x0b, 0x00, 0x7e, 0x00, 0x42, 0x2f, 0x23, 0x50, 0x23, 0x78, 0x50,
+  0x02, 0x3c, 0x3f, 0x00, 0x08, 0x12, 0x11, 0xb2, 0x74, 0x07, 0x31, 0x74, 0x4c, 0x74, 0x9a, 0x03, 0x01, 0x12, 0x18, 0x01, 0x7c, 0x3f, 0x00, 0x24, 0x07, 0x20, 0x2f, 0x23, 0x44, 0x00, 0x31, 0xd2,
+  0x3b, 0xb5, 0xfc, 0x0a, 0x31, 0x4f, 0x23, 0x90, 0xb8, 0x31, 0x04, 0xc4, 0x50, 0x11, 0xd2, 0x7a, 0x03, 0x00, 0xb0, 0x18, 0x00, 0x52, 0x2a, 0x00, 0x40, 0x07, 0x00, 0xf2, 0x06, 0x40, 0x2f, 0x23,
+  0xcd, 0x12, 0x46, 0x07, 0x40, 0x12, 0x44, 0x13, 0x44, 0x16, 0x35, 0x00, 0x14, 0x23, 0x00, 0x8c, 0x26, 0x00, 0xec, 0x0d, 0x20, 0x94, 0x64, 0xea, 0x10, 0x11, 0x13, 0xa0, 0x26, 0x02, 0x3c, 0x23,
+  0x00, 0x4c, 0x20, 0x03, 0x9a, 0x23, 0x12, 0x33, 0xa2, 0x1c, 0x00, 0x30, 0x1c, 0x00, 0x54, 0x15, 0x20, 0x8c, 0x0a, 0xd8, 0x0d, 0x02, 0x00, 0x27, 0x20, 0x74, 0x54, 0x02, 0x3c, 0x01, 0xe2, 0x6c,
+  0x00, 0x74, 0x1f, 0x50, 0x23, 0xad, 0x1a, 0xf2, 0x43, 0xec, 0x50, 0x00, 0x8c, 0x03, 0x02, 0xfc, 0x0a, 0x00, 0xdc, 0x14, 0x11, 0x90, 0xa6, 0x1f, 0x60, 0x95, 0x5c, 0xf6, 0x6c, 0x74, 0x5c, 0xf8,
+  0x57, 0x20, 0xb5, 0x64, 0x86, 0x2a, 0x10, 0xd6, 0x02, 0x00, 0x30, 0x6c, 0x74, 0x5c, 0xe0, 0x06, 0x20, 0xd6, 0x6c, 0x0a, 0x5f, 0x20, 0x74, 0x5c, 0x94, 0x5b, 0x02, 0x0c, 0x51, 0x01, 0x0c, 0x0e,
+  0x30, 0x64, 0x13, 0x54, 0x58, 0x0a, 0x02, 0xe4, 0x14, 0x10, 0x13, 0x18, 0x4a, 0x12, 0x54, 0x48, 0x3c, 0x10, 0x33, 0x56, 0x74, 0x00, 0x26, 0x00, 0x10, 0x4b, 0xa4, 0x1c, 0x51, 0x0f, 0x33, 0x70,
+  0x3b, 0x94, 0x08, 0x5f, 0x02, 0x48, 0x5f, 0x00, 0x6a, 0x23, 0x00, 0x42, 0x4a, 0x00, 0xca, 0x1f, 0x02, 0xe6, 0x2a, 0x00, 0x60, 0x23, 0x00, 0xf8, 0x2a, 0x00, 0xf4, 0x31, 0x32, 0x13, 0x54, 0x12,
+  0x74, 0x58, 0x00, 0xcc, 0x1c, 0x01, 0x4e, 0x5f, 0x02, 0x32, 0x35, 0x00, 0xaa, 0x23, 0x02, 0xf8, 0x1f, 0x01, 0x76, 0x43, 0x00, 0x4e, 0x5f, 0x00, 0x64, 0x03, 0x10, 0x64, 0x06, 0x00, 0x00, 0x84,
+  0x35, 0x00, 0x54, 0x5f, 0x00, 0xa8, 0x38, 0x02, 0xcc, 0x54, 0x00, 0x32, 0x0e, 0x00, 0x5e, 0x2a, 0x00, 0x12, 0x07, 0x44, 0x4e, 0x43, 0xac, 0x2a, 0x44, 0x0e, 0x20, 0x11, 0x5c, 0xd8, 0x1f, 0x20,
+  0xed, 0x3a, 0x86, 0x1c, 0x10, 0x4f, 0xc8, 0x03, 0x30, 0x3a, 0x73, 0x6c, 0x28, 0x0e, 0x00, 0x78, 0x2a, 0x02, 0x14, 0x3c, 0x10, 0x0e, 0xc0, 0x54, 0x01, 0x2e, 0x19, 0x02, 0x48, 0x51, 0x60, 0xb4,
+  0x74, 0x36, 0x85, 0x36, 0x85, 0x70, 0x03, 0x00, 0xa4, 0x03, 0x00, 0xb2, 0x0a, 0x10, 0x12, 0xc2, 0x0a, 0x00, 0x28, 0x00, 0x00, 0x48, 0x3c, 0x01, 0x6c, 0x23, 0x00, 0x4e, 0x4a, 0x00, 0xaa, 0x0a,
+  0x00, 0x84, 0x03, 0x20, 0x15, 0x85, 0x08, 0x07, 0x00, 0xca, 0x38, 0x20, 0xb0, 0x5b, 0xd8, 0x18, 0x20, 0x4e, 0x4b, 0x4e, 0x15, 0x00, 0x76, 0x03, 0xa0, 0x36, 0x8d, 0xd4, 0x7c, 0x52, 0x74, 0x31,
+  0x6c, 0xf1, 0x63, 0x86, 0x03, 0x11, 0x31, 0x62, 0x15, 0xf0, 0x31, 0x8f, 0x5b, 0xd0, 0x63, 0xf1, 0x6b, 0x6f, 0x5b, 0x32, 0x74, 0xd4, 0x84, 0x4e, 0x5b, 0x2e, 0x53, 0x93, 0x7c, 0xb7, 0xa5, 0xd8,
+  0xad, 0xd8, 0xad, 0x35, 0x9d, 0x31, 0x7c, 0xf4, 0x94, 0x15, 0x9d, 0xd8, 0xb5, 0xd8, 0xb5, 0x56, 0xa5, 0x56, 0xa5, 0x35, 0x9d, 0xf9, 0xb5, 0x77, 0xa5, 0x15, 0x9d, 0xf9, 0xb5, 0x9b, 0xce, 0x19,
+  0xbe, 0x19, 0xb6, 0x19, 0xbe, 0x3a, 0xbe, 0xf8, 0xbd, 0x76, 0xad, 0xfa, 0x18, 0x15, 0xd3, 0x6a, 0x15, 0x00, 0xdc, 0x2a, 0x19, 0xf1, 0x24, 0x07, 0x00, 0x00, 0x19, 0x06, 0x90, 0x1c, 0x51, 0x53,
+  0xb5, 0xd5, 0xc5, 0x94, 0xb2, 0x23, 0x00, 0x92, 0x03, 0x00, 0x48, 0x0e, 0x00, 0x98, 0x03, 0x31, 0xf2, 0x3b, 0x74, 0x14, 0x11, 0x00, 0x84, 0x03, 0x51, 0x0f, 0x1b, 0xee, 0x0a, 0x91, 0x08, 0x03,
+  0x03, 0x62, 0x34, 0x00, 0xe8, 0x10, 0xf0, 0x02, 0x33, 0x91, 0x23, 0xb1, 0x2b, 0xb1, 0x2b, 0x70, 0x23, 0x2f, 0x13, 0xce, 0x02, 0xee, 0x0a, 0x70, 0x23, 0x9a, 0x03, 0x31, 0x12, 0x3c, 0xd2, 0x06,
+  0x2e, 0x22, 0x91, 0x2b, 0x6a, 0x26, 0x00, 0x28, 0x11, 0x02, 0x72, 0x26, 0x10, 0xf2, 0xf8, 0x02, 0x10, 0x5c, 0x82, 0x11, 0x00, 0x14, 0x11, 0xf0, 0x01, 0x12, 0x3c, 0xf2, 0x3b, 0x53, 0x44, 0x12,
+  0x3c, 0x12, 0x3c, 0x90, 0x2b, 0x2f, 0x1b, 0x4f, 0x23, 0x9a, 0x06, 0x60, 0x12, 0x3c, 0xd1, 0x33, 0xd2, 0x3b, 0x90, 0x03, 0x31, 0x91, 0x2b, 0x90, 0xce, 0x03, 0x02, 0x2c, 0x0a, 0x13, 0xb1, 0x72,
+  0x49, 0x11, 0x70, 0x94, 0x50, 0xc0, 0xee, 0x12, 0xcd, 0x0a, 0xee, 0x12, 0x0e, 0x1b, 0x2f, 0x1b, 0xd2, 0x33, 0x0e, 0x00, 0x10, 0x4f, 0x0e, 0x07, 0x00, 0x28, 0x54, 0x01, 0x38, 0x4d, 0x00, 0x50,
+  0x00, 0x01, 0xc2, 0x14, 0x72, 0x23, 0x90, 0x2b, 0xee, 0x12, 0xad, 0x02, 0x10, 0x04, 0x62, 0x0f, 0x1b, 0x2f, 0x1b, 0x30, 0x23, 0x1a, 0x54, 0x02, 0x3e, 0x04, 0x00, 0x12, 0x07, 0x40, 0x90, 0x2b,
+  0xd1, 0x33, 0x74, 0x00, 0x00, 0x6e, 0x00, 0x00, 0x44, 0x00, 0x60, 0xd1, 0x33, 0x2f, 0x1b, 0x70, 0x23, 0x14, 0x04, 0x22, 0xb1, 0x33, 0x6a, 0x15, 0x20, 0xee, 0x12, 0x62, 0x15, 0x00, 0x98, 0x03,
+  0x00, 0x8e, 0x00, 0x00, 0xa6, 0x18, 0x02, 0x58, 0x23, 0x00, 0x70, 0x46, 0x60, 0xad, 0x0a, 0xcd, 0x1a, 0xcd, 0x12, 0x48, 0x4d, 0x20, 0xee, 0x22, 0x04, 0x00, 0x81, 0xcd, 0x22, 0xad, 0x1a, 0xad,
+  0x1a, 0x4f, 0x33, 0x24, 0x0a, 0x01, 0x3c, 0x35, 0x10, 0x90, 0x08, 0x0f, 0x03, 0x06, 0x15, 0x02, 0x86, 0x54, 0x22, 0xad, 0x12, 0x9e, 0x4d, 0x11, 0x94, 0xde, 0x1c, 0x42, 0xd6, 0x64, 0x13, 0x44,
+  0xd6, 0x46, 0x20, 0xad, 0x12, 0xce, 0x31, 0x12, 0x53, 0xc4, 0x3f, 0x00, 0xd0, 0x34, 0x00, 0x6a, 0x00, 0x21, 0x33, 0xd2, 0xba, 0x38, 0x00, 0x5e, 0x0e, 0x00, 0xa2, 0x11, 0x00, 0x84, 0x03, 0x01,
+  0xdc, 0x26, 0x01, 0x34, 0x43, 0x02, 0x92, 0x5b, 0x22, 0x70, 0x3b, 0x28, 0x07, 0x02, 0xc2, 0x3f, 0x11, 0x70, 0xa4, 0x23, 0x20, 0x4f, 0x33, 0x16, 0x15, 0x51, 0x0f, 0x33, 0xee, 0x2a, 0x90, 0xfe,
+  0x65, 0x00, 0x82, 0x3c, 0x00, 0xec, 0x1f, 0x00, 0x3c, 0x23, 0x02, 0xf6, 0x31, 0x02, 0x92, 0x77, 0x02, 0x04, 0x1c, 0x00, 0xda, 0x0d, 0x11, 0x13, 0x0e, 0x43, 0x00, 0xba, 0x03, 0x02, 0x8a, 0x23,
+  0x00, 0x02, 0x20, 0x00, 0xde, 0x1f, 0x00, 0x08, 0x19, 0x00, 0x68, 0x03, 0x11, 0x70, 0x96, 0x31, 0x20, 0x0e, 0x33, 0xa4, 0x11, 0x22, 0xad, 0x22, 0x2e, 0x0e, 0x40, 0xb1, 0x4b, 0x50, 0x3b, 0x78,
+  0x03, 0x20, 0x94, 0x64, 0xb8, 0x03, 0xc0, 0x90, 0x43, 0xd2, 0x4b, 0x2f, 0x33, 0xb0, 0x43, 0xb1, 0x4b, 0xf1, 0x4b, 0x06, 0x00, 0x00, 0x62, 0x5f, 0x71, 0x16, 0x75, 0xd1, 0x4b, 0xcd, 0x2a, 0x2e,
+  0x4a, 0x15, 0x00, 0x72, 0x43, 0x42, 0xed, 0x32, 0xcd, 0x2a, 0xde, 0x54, 0x20, 0xd1, 0x53, 0xf8, 0x0d, 0x00, 0x2e, 0x15, 0x10, 0x32, 0x6c, 0x5f, 0x10, 0x74, 0xc0, 0x18, 0x00, 0x5a, 0x03, 0x50,
+  0x16, 0x7d, 0xd4, 0x74, 0x53, 0x1c, 0x1c, 0x10, 0x74, 0x6e, 0x23, 0x20, 0xb4, 0x74, 0x00, 0x07, 0x13, 0x94, 0x5c, 0x23, 0x00, 0x06, 0x00, 0x10, 0x94, 0xa6, 0x23, 0x03, 0xba, 0x18, 0x00, 0x72,
+  0x2a, 0x00, 0x8a, 0x03, 0x00, 0x82, 0x0a, 0x01, 0xae, 0x66, 0x50, 0x6c, 0xd1, 0x5b, 0xcd, 0x3a, 0x8e, 0x0a, 0x00, 0x10, 0x2e, 0x00, 0xae, 0x2a, 0x20, 0xb4, 0x7c, 0xec, 0x18, 0x00, 0x48, 0x15,
+  0x00, 0x3c, 0x0e, 0x00, 0x8e, 0x03, 0x00, 0xb2, 0x11, 0x11, 0x32, 0xf4, 0x18, 0x90, 0x6f, 0x53, 0xd0, 0x5b, 0x6f, 0x53, 0xf4, 0x84, 0x73, 0x1c, 0x0e, 0x00, 0xde, 0x0a, 0x10, 0x7c, 0xd0, 0x11,
+  0x41, 0xf5, 0x84, 0x93, 0x7c, 0x7a, 0x03, 0xb0, 0x63, 0xb4, 0x7c, 0x93, 0x7c, 0x93, 0x7c, 0x15, 0x8d, 0xb4, 0x84, 0x14, 0x07, 0x00, 0xa8, 0x0a, 0x00, 0x82, 0x43, 0xa0, 0x73, 0x7c, 0x73, 0x7c,
+  0x53, 0x7c, 0x93, 0x7c, 0xf5, 0x8c, 0x22, 0x07, 0xf0, 0x11, 0x93, 0x84, 0xf4, 0x94, 0xb7, 0xad, 0xb7, 0xad, 0x35, 0x9d, 0x97, 0xa5, 0x36, 0x9d, 0xf8, 0xb5, 0x39, 0xbe, 0xbb, 0xce, 0xfd, 0xd6,
+  0x9b, 0xce, 0xb8, 0xad, 0x19, 0xbe, 0x36, 0x9d, 0xd4, 0x94, 0xfa, 0x18, 0x00, 0x56, 0x0e, 0x02, 0x50, 0x0e, 0x30, 0xb4, 0x94, 0x72, 0x6c, 0x15, 0x03, 0xfa, 0x18, 0x01, 0x4a, 0x27, 0x14, 0xa4,
+  0x92, 0x03, 0x11, 0xf2, 0x54, 0x27, 0x14, 0x12, 0xb8, 0x0a, 0x21, 0xbd, 0x53, 0x22, 0x07, 0x00, 0xb2, 0x0a, 0x22, 0xd5, 0xc5, 0xb4, 0x0a, 0x00, 0xb2, 0x23, 0x00, 0x28, 0x03, 0x00, 0x02, 0x00,
+  0x02, 0xea, 0x10, 0x00, 0x76, 0x18, 0x20, 0xb1, 0x33, 0x52, 0x06, 0x00, 0x24, 0x03, 0x00, 0x7a, 0x03, 0x51, 0xb1, 0x2b, 0x91, 0x23, 0xd2, 0x56, 0x0e, 0x60, 0x12, 0x3c, 0xf2, 0x33, 0xd1, 0x33,
+  0x9a, 0x03, 0xa1, 0x4f, 0x1b, 0xee, 0x0a, 0x4f, 0x23, 0x6f, 0x23, 0x4f, 0x1b, 0x7a, 0x2d, 0x10, 0x33, 0xfa, 0x06, 0x03, 0x46, 0x00, 0x10, 0x23, 0x10, 0x4d, 0x00, 0x0a, 0x00, 0x00, 0xdc, 0x03,
+  0xa0, 0xee, 0x0a, 0x0f, 0x1b, 0x4f, 0x23, 0xad, 0x02, 0xee, 0x0a, 0x12, 0x00, 0x30, 0xb1, 0x33, 0x4f, 0x58, 0x18, 0x20, 0x23, 0xad, 0x48, 0x18, 0x61, 0x02, 0x2f, 0x1b, 0xd1, 0x33, 0x50, 0x68,
+  0x18, 0x00, 0x78, 0x18, 0x70, 0xcd, 0x12, 0xad, 0x0a, 0xce, 0x12, 0x8d, 0x18, 0x00, 0x00, 0x3e, 0x00, 0x12, 0x23, 0x4c, 0x00, 0x50, 0xd1, 0x33, 0x12, 0x44, 0x74, 0x98, 0x34, 0x01, 0xec, 0x06,
+  0x00, 0xe2, 0x03, 0x00, 0x7e, 0x07, 0x00, 0x82, 0x0a, 0x00, 0xac, 0x11, 0x00, 0x4c, 0x00, 0x00, 0xa6, 0x18, 0x00, 0x46, 0x2e, 0x00, 0x4e, 0x04, 0x20, 0xce, 0x12, 0x26, 0x16, 0x00, 0x82, 0x1c,
+  0x00, 0xea, 0x0a, 0x02, 0x6a, 0x0e, 0x00, 0xb8, 0x11, 0x31, 0xd1, 0x33, 0xb1, 0xa2, 0x00, 0x02, 0xba, 0x0e, 0x11, 0xb1, 0xe8, 0x0a, 0x04, 0x44, 0x12, 0x01, 0x1a, 0x00, 0x12, 0x2b, 0xf0, 0x18,
+  0x00, 0xf0, 0x50, 0x02, 0x36, 0x1c, 0x00, 0xc6, 0x03, 0x00, 0x2c, 0x03, 0x00, 0xb8, 0x26, 0x00, 0x5c, 0x23, 0x10, 0xb1, 0xb2, 0x26, 0x01, 0x40, 0x03, 0x00, 0x94, 0x03, 0x00, 0x68, 0x11, 0x11,
+  0x90, 0x1a, 0x03, 0x41, 0x6c, 0x12, 0x8d, 0x12, 0xa8, 0x1f, 0x01, 0xd6, 0x12, 0x00, 0x48, 0x0e, 0x01, 0xf0, 0x20, 0x41, 0x5c, 0xb5, 0x5c, 0xb1, 0xf0, 0x18, 0x02, 0xb8, 0x31, 0x11, 0x91, 0xd6,
+  0x1f, 0x02, 0xbe, 0x46, 0x20, 0x90, 0x33, 0x0e, 0x2e, 0x00, 0x60, 0x35, 0x00, 0x5a, 0x35, 0x11, 0x4f, 0x46, 0x15, 0x11, 0x4f, 0xa6, 0x18, 0x20, 0x2f, 0x2b, 0x4e, 0x35, 0x11, 0x4f, 0xd6, 0x1f,
+  0x11, 0xb1, 0xe8, 0x26, 0x02, 0xa8, 0x4d, 0x11, 0x53, 0x1e, 0x15, 0x02, 0x20, 0x66, 0x00, 0x5e, 0x11, 0x01, 0x70, 0x23, 0x01, 0x68, 0x1c, 0x40, 0x53, 0x54, 0x50, 0x3b, 0x0c, 0x2e, 0x05, 0x86,
+  0x51, 0x12, 0x4b, 0x16, 0x6d, 0x11, 0x70, 0xf6, 0x31, 0x00, 0xa4, 0x11, 0x11, 0x90, 0xae, 0x23, 0x02, 0x5c, 0x1c, 0x02, 0x4a, 0x35, 0x60, 0x8c, 0x1a, 0xad, 0x22, 0xad, 0x22, 0x60, 0x23, 0x11,
+  0xd2, 0x14, 0x00, 0x00, 0xe4, 0x26, 0x00, 0x8a, 0x03, 0x00, 0x72, 0x4a, 0x11, 0xd1, 0x14, 0x0e, 0x02, 0xd0, 0x70, 0x10, 0xd2, 0x66, 0x66, 0x00, 0x6e, 0x7b, 0x30, 0x5c, 0xd5, 0x6c, 0x68, 0x58,
+  0x11, 0x50, 0x00, 0x3c, 0x22, 0x13, 0x5c, 0x7c, 0x2a, 0x02, 0x24, 0x2e, 0x00, 0x76, 0x23, 0x30, 0xac, 0x22, 0x90, 0x1e, 0x2e, 0x10, 0x5c, 0x58, 0x4a, 0x22, 0xf6, 0x74, 0xa6, 0x43, 0x00, 0xf4,
+  0x70, 0x11, 0x32, 0x78, 0x66, 0x11, 0xd1, 0x70, 0x38, 0x11, 0x6f, 0xc4, 0x31, 0x21, 0x0e, 0x3b, 0x7a, 0x66, 0x01, 0xd0, 0x26, 0x22, 0x8f, 0x4b, 0xf4, 0x26, 0x00, 0xbc, 0x11, 0x00, 0x0a, 0x6a,
+  0x42, 0x4e, 0x43, 0x2e, 0x43, 0xb8, 0x11, 0x01, 0xee, 0x1f, 0x63, 0x5b, 0x2e, 0x43, 0x0e, 0x43, 0xf1, 0xaa, 0x6d, 0x31, 0x53, 0x6c, 0x12, 0x6c, 0x1c, 0x40, 0xf5, 0x7c, 0xf5, 0x7c, 0xa0, 0x0a,
+  0x00, 0x1a, 0x27, 0x00, 0xf8, 0x26, 0x00, 0x7a, 0x2a, 0x02, 0xc8, 0x31, 0x00, 0x6c, 0x23, 0x02, 0xf6, 0x54, 0x00, 0x2c, 0x00, 0x20, 0xd5, 0x7c, 0xca, 0x6d, 0x02, 0xde, 0x3f, 0x02, 0xfa, 0x18,
+  0x40, 0x73, 0x74, 0xf4, 0x84, 0x96, 0x5f, 0x02, 0x2c, 0x2e, 0x00, 0x12, 0x27, 0x02, 0x12, 0x5c, 0x00, 0xfe, 0x46, 0x00, 0x02, 0x00, 0xe2, 0x73, 0x74, 0xf1, 0x6b, 0xf1, 0x6b, 0x52, 0x74, 0xf5,
+  0x8c, 0x73, 0x74, 0x53, 0x74, 0xe8, 0x18, 0xf0, 0x19, 0x93, 0x7c, 0xb4, 0x84, 0x32, 0x74, 0x12, 0x74, 0xb4, 0x84, 0x15, 0x95, 0xb3, 0x8c, 0xd4, 0x94, 0x76, 0xa5, 0x7b, 0xc6, 0x9b, 0xce, 0x9b,
+  0xce, 0x76, 0xa5, 0xf9, 0xb5, 0x56, 0xa5, 0x93, 0x8c, 0xf1, 0x7b, 0x11, 0x7c, 0x4e, 0x63, 0x93, 0x8c, 0x46, 0x0e, 0x12, 0xd4, 0x64, 0x15, 0x10, 0x9c, 0x06, 0x00, 0x11, 0xb4, 0x46, 0x0e, 0x11,
+  0xb3, 0x22, 0x07, 0x10, 0xd1, 0x02, 0x00, 0x02, 0x94, 0x03, 0x03, 0x84, 0x35, 0x22, 0x12, 0xb5, 0x96, 0x03, 0x02, 0x46, 0x0e, 0x11, 0x53, 0xb4, 0x0a, 0x35, 0xf5, 0xcd, 0xd5, 0xb4, 0x0a, 0x00,
+  0x64, 0x2e, 0x11, 0x4f, 0x32, 0x06, 0x11, 0xd1, 0xb2, 0x02, 0x01, 0x1c, 0x03, 0x01, 0x3c, 0x03, 0x00, 0x56, 0x03, 0x03, 0xc0, 0x02, 0x00, 0x3e, 0x5e, 0x20, 0x33, 0xf2, 0xc2, 0x0a, 0x10, 0x2b,
+  0x62, 0x06, 0x00, 0x06, 0x03, 0x00, 0x5a, 0x06, 0x00, 0x58, 0x07, 0x02, 0x26, 0x07, 0x11, 0x70, 0xca, 0x50, 0x02, 0x32, 0x00, 0x00, 0x28, 0x4d, 0x02, 0x08, 0x00, 0x33, 0x54, 0x44, 0x53, 0x0e,
+  0x15, 0x00, 0x12, 0x07, 0x40, 0x33, 0x44, 0x91, 0x2b, 0x70, 0x07, 0x00, 0x94, 0x03, 0x00, 0x34, 0x07, 0x00, 0xd8, 0x0d, 0x00, 0x46, 0x00, 0x04, 0x1a, 0x07, 0x02, 0xba, 0x0a, 0x24, 0xb1, 0x33,
+  0x04, 0x5b, 0x01, 0x04, 0x0b, 0x01, 0x20, 0x00, 0x20, 0xee, 0x1a, 0xa4, 0x03, 0x00, 0xba, 0x34, 0x02, 0x2a, 0x19, 0x02, 0x48, 0x15, 0x04, 0x7e, 0x11, 0x00, 0x2c, 0x07, 0x21, 0x53, 0x4c, 0x0c,
+  0x0b, 0x02, 0xb0, 0x57, 0x03, 0x26, 0x20, 0x00, 0x38, 0x00, 0x02, 0xe6, 0x03, 0x40, 0xcd, 0x12, 0xcd, 0x0a, 0x3e, 0x07, 0x20, 0x33, 0x44, 0xe8, 0x0e, 0x02, 0xd8, 0x03, 0x02, 0x76, 0x0e, 0x00,
+  0x44, 0x0b, 0x00, 0x56, 0x1c, 0x00, 0x42, 0x00, 0x24, 0x12, 0x44, 0x9a, 0x03, 0x11, 0x70, 0x96, 0x03, 0x02, 0xc0, 0x1b, 0x11, 0x90, 0x7c, 0x3c, 0x10, 0x0e, 0xbc, 0x0a, 0x01, 0x64, 0x1f, 0x82,
+  0x0f, 0x23, 0x91, 0x3b, 0x4f, 0x2b, 0xd2, 0x43, 0x34, 0x1f, 0x00, 0x72, 0x2b, 0x11, 0xd1, 0xdc, 0x31, 0x11, 0x2f, 0xf6, 0x31, 0x02, 0xec, 0x38, 0x01, 0xc8, 0x5b, 0x00, 0xac, 0x0a, 0x10, 0x1b,
+  0xaa, 0x03, 0x11, 0x12, 0xf6, 0x4d, 0x00, 0x3c, 0x07, 0x02, 0x74, 0x43, 0x00, 0x48, 0x03, 0x02, 0x96, 0x35, 0x11, 0x53, 0xca, 0x18, 0x10, 0x74, 0x50, 0x0f, 0x31, 0x64, 0x74, 0x54, 0x92, 0x23,
+  0x00, 0x4c, 0x00, 0x00, 0x9c, 0x62, 0x52, 0x54, 0x2f, 0x2b, 0xf2, 0x4b, 0xf4, 0x6c, 0x00, 0x1e, 0x1c, 0x11, 0xce, 0x62, 0x15, 0x00, 0x06, 0x19, 0x11, 0x0f, 0xc0, 0x03, 0x11, 0x0f, 0xf8, 0x3f,
+  0x40, 0x2f, 0x33, 0xad, 0x1a, 0x58, 0x0e, 0x02, 0xe0, 0x3f, 0x00, 0x1a, 0x20, 0x00, 0x86, 0x11, 0x00, 0x1e, 0x07, 0x00, 0x7e, 0x03, 0x02, 0x82, 0x23, 0x00, 0xe2, 0x03, 0x30, 0xce, 0x2a, 0x2f,
+  0xd4, 0x1f, 0x01, 0xda, 0x3f, 0x00, 0x5c, 0x0a, 0x00, 0x8a, 0x18, 0x11, 0x54, 0x4a, 0x43, 0x00, 0x30, 0x0e, 0x11, 0x13, 0xde, 0x62, 0x00, 0x72, 0x23, 0x00, 0x1e, 0x0e, 0x00, 0xfa, 0x54, 0x00,
+  0x90, 0x11, 0x20, 0xf2, 0x4b, 0x04, 0x27, 0x00, 0x8e, 0x03, 0x31, 0x50, 0x3b, 0x70, 0x1c, 0x2e, 0x00, 0x5e, 0x1c, 0x02, 0x10, 0x4e, 0x22, 0x74, 0x64, 0x8a, 0x51, 0x00, 0xe6, 0x38, 0x00, 0x86,
+  0x5f, 0x11, 0xb1, 0xac, 0x18, 0x00, 0xa6, 0x11, 0x00, 0x4c, 0x43, 0x00, 0x42, 0x35, 0x13, 0x74, 0x6c, 0x1c, 0x20, 0x12, 0x5c, 0x20, 0x07, 0x00, 0x4c, 0x1c, 0x20, 0xb5, 0x74, 0x02, 0x07, 0x00,
+  0xf4, 0x1f, 0x31, 0x70, 0x4b, 0x53, 0x24, 0x15, 0x02, 0x10, 0x71, 0x00, 0x08, 0x2e, 0x00, 0x10, 0x0e, 0x00, 0x04, 0x00, 0x00, 0x98, 0x3c, 0x00, 0x30, 0x00, 0x50, 0xd1, 0x5b, 0xb0, 0x53, 0x12,
+  0x22, 0x00, 0x00, 0x14, 0x6a, 0x10, 0x53, 0x82, 0x5f, 0x00, 0x20, 0x00, 0x02, 0x20, 0x07, 0x02, 0x60, 0x15, 0x31, 0xd1, 0x5b, 0x52, 0x84, 0x2a, 0x20, 0x72, 0x6c, 0x20, 0x27, 0x51, 0xd5, 0x7c,
+  0x36, 0x8d, 0x73, 0x24, 0x2e, 0x00, 0x90, 0x03, 0x11, 0x32, 0xdc, 0x3f, 0x00, 0xfe, 0x18, 0x00, 0xfa, 0x18, 0x00, 0x68, 0x15, 0x02, 0x1a, 0x27, 0x00, 0xa4, 0x03, 0x20, 0x11, 0x6c, 0x14, 0x07,
+  0x00, 0x48, 0x07, 0x00, 0xa4, 0x03, 0x00, 0xb8, 0x11, 0x00, 0xd6, 0x18, 0x00, 0xaa, 0x5f, 0x20, 0x73, 0x74, 0x02, 0x00, 0x00, 0xec, 0x18, 0x20, 0xb4, 0x7c, 0x16, 0x00, 0x00, 0x8e, 0x03, 0x00,
+  0x00, 0x6e, 0x80, 0xb4, 0x84, 0xf1, 0x6b, 0x4e, 0x5b, 0xb0, 0x6b, 0x2a, 0x0e, 0x60, 0x52, 0x84, 0x73, 0x84, 0xd4, 0x94, 0x2e, 0x0e, 0x00, 0x08, 0x00, 0xd1, 0x15, 0x9d, 0x97, 0xad, 0x77, 0xa5,
+  0xb7, 0xad, 0xb8, 0xb5, 0x77, 0xad, 0xf5, 0xe8, 0x11, 0x51, 0x53, 0x84, 0xb4, 0x8c, 0xd4, 0x6a, 0x15, 0x13, 0x93, 0x20, 0x07, 0x04, 0x6a, 0x2e, 0x11, 0xb1, 0x4a, 0x0e, 0x06, 0x96, 0x03, 0x10,
+  0x33, 0x26, 0x07, 0x00, 0x20, 0x07, 0x00, 0x3e, 0x39, 0x03, 0x20, 0x39, 0x00, 0xba, 0x0a, 0x00, 0x94, 0x03, 0x31, 0x16, 0xce, 0x70, 0x1c, 0x0a, 0x51, 0x0e, 0x13, 0x70, 0x2b, 0xd1, 0x5a, 0x02,
+  0x00, 0xb6, 0x5a, 0x01, 0x9a, 0x03, 0x00, 0xba, 0x0d, 0x00, 0x30, 0x65, 0x00, 0x7a, 0x6f, 0x10, 0x1b, 0xf4, 0x06, 0x11, 0x4f, 0xba, 0x06, 0x00, 0x0a, 0x00, 0xa2, 0x0e, 0x1b, 0xad, 0x02, 0xad,
+  0x02, 0x0b, 0x02, 0x6c, 0x02, 0xb8, 0x1c, 0x80, 0x30, 0x23, 0xae, 0x0a, 0xce, 0x12, 0xef, 0x12, 0x3a, 0x0a, 0x20, 0xce, 0x0a, 0x8e, 0x03, 0x00, 0xfc, 0x0a, 0x02, 0xfc, 0x5a, 0x61, 0xce, 0x0a,
+  0xce, 0x0a, 0x2f, 0x1b, 0xd2, 0x61, 0x03, 0x20, 0x0a, 0x22, 0x33, 0x44, 0xc8, 0x0a, 0x00, 0x96, 0x0a, 0x01, 0x64, 0x00, 0x01, 0x24, 0x1c, 0x11, 0xd1, 0x60, 0x03, 0x00, 0x06, 0x00, 0x40, 0xd1,
+  0x3b, 0x0f, 0x23, 0xdc, 0x15, 0x02, 0x84, 0x15, 0x00, 0xac, 0x03, 0x00, 0xd2, 0x06, 0x80, 0xee, 0x12, 0x2b, 0x02, 0x0b, 0x02, 0x8d, 0x02, 0x5c, 0x0a, 0x02, 0x36, 0x00, 0x00, 0xde, 0x1f, 0x20,
+  0x2f, 0x23, 0x48, 0x07, 0x20, 0xf2, 0x3b, 0xbc, 0x00, 0x11, 0x12, 0xf2, 0x5e, 0x02, 0xac, 0x0e, 0x00, 0x84, 0x38, 0x00, 0xa8, 0x03, 0x00, 0x80, 0x18, 0x13, 0xb1, 0xc8, 0x03, 0x00, 0x2a, 0x03,
+  0x00, 0x02, 0x28, 0x00, 0x58, 0x00, 0x00, 0x5a, 0x1d, 0x04, 0x3c, 0x12, 0x01, 0x0a, 0x51, 0x00, 0x12, 0x07, 0x01, 0xf6, 0x00, 0x02, 0xc4, 0x2d, 0x02, 0x24, 0x4a, 0x00, 0x98, 0x03, 0x10, 0x74,
+  0x4e, 0x31, 0x01, 0x9e, 0x26, 0x00, 0x08, 0x1c, 0x00, 0x00, 0x2e, 0x00, 0xb8, 0x0d, 0x00, 0x34, 0x15, 0x00, 0x3c, 0x51, 0x02, 0x96, 0x5b, 0x00, 0xf6, 0x06, 0x00, 0x6c, 0x12, 0x02, 0x3c, 0x0e,
+  0x00, 0xf0, 0x4d, 0x02, 0x20, 0x07, 0x00, 0x6a, 0x3c, 0x42, 0x8c, 0x0a, 0x50, 0x2b, 0xc8, 0x54, 0x02, 0x74, 0x3c, 0x02, 0x26, 0x07, 0x02, 0x4e, 0x40, 0x00, 0x62, 0x1c, 0x11, 0x70, 0x22, 0x07,
+  0x13, 0x50, 0xba, 0x54, 0x00, 0x5e, 0x03, 0x02, 0xe2, 0x26, 0x00, 0xf2, 0x03, 0x10, 0x0e, 0xfc, 0x1f, 0x01, 0xec, 0x46, 0x10, 0x0f, 0xbc, 0x2a, 0x01, 0xaa, 0x5b, 0x12, 0x4f, 0xb4, 0x1f, 0x12,
+  0x2b, 0x0c, 0x12, 0x00, 0x26, 0x04, 0xc0, 0xc9, 0x01, 0xa9, 0x01, 0xcd, 0x22, 0x0e, 0x2b, 0xd1, 0x43, 0x74, 0x5c, 0x74, 0x23, 0x02, 0x7e, 0x2a, 0x02, 0x70, 0x15, 0x20, 0x70, 0x3b, 0x4a, 0x31,
+  0x22, 0x0f, 0x33, 0xfc, 0x7e, 0x00, 0xda, 0x06, 0x02, 0x50, 0x74, 0x00, 0xe0, 0x1f, 0x20, 0x91, 0x43, 0xca, 0x11, 0x00, 0xea, 0x06, 0x00, 0x42, 0x0e, 0x22, 0xf6, 0x74, 0x00, 0x55, 0x00, 0x96,
+  0x03, 0x00, 0xe4, 0x11, 0x00, 0xce, 0x1f, 0x60, 0xcd, 0x2a, 0x13, 0x54, 0x95, 0x6c, 0xc2, 0x31, 0x00, 0x16, 0x07, 0x11, 0xb1, 0x42, 0x55, 0x00, 0xbe, 0x03, 0x00, 0x16, 0x6a, 0x02, 0xd4, 0x4d,
+  0x22, 0xb1, 0x4b, 0x14, 0x78, 0x00, 0x40, 0x35, 0x00, 0x0c, 0x2e, 0x30, 0x53, 0x64, 0x74, 0x7c, 0x31, 0x01, 0x4e, 0x15, 0x00, 0x76, 0x58, 0x60, 0x12, 0x5c, 0xac, 0x32, 0x33, 0x64, 0x4a, 0x1c,
+  0x00, 0x34, 0x2e, 0x22, 0xb4, 0x74, 0x4c, 0x3c, 0x01, 0xfa, 0x06, 0x01, 0xe2, 0x11, 0x01, 0x18, 0x0e, 0x00, 0xe4, 0x54, 0x30, 0x74, 0x52, 0x64, 0x34, 0x07, 0x00, 0x98, 0x03, 0x00, 0x7a, 0x43,
+  0x11, 0x12, 0xe4, 0x0a, 0x22, 0x8f, 0x4b, 0xc8, 0x3f, 0x20, 0xf5, 0x7c, 0xe2, 0x46, 0x11, 0x4e, 0xb6, 0x5f, 0x00, 0x10, 0x07, 0x31, 0xd1, 0x5b, 0x11, 0x66, 0x0e, 0x60, 0x6f, 0x4b, 0x73, 0x6c,
+  0x6f, 0x53, 0x9a, 0x11, 0x20, 0x12, 0x64, 0x94, 0x0a, 0x01, 0x54, 0x03, 0x21, 0x64, 0x53, 0x08, 0x55, 0x02, 0x74, 0x03, 0x00, 0x7e, 0x03, 0x73, 0xf0, 0x63, 0x15, 0x85, 0xf4, 0x84, 0xb0, 0x5e,
+  0x1c, 0x01, 0xb0, 0x11, 0x01, 0x9c, 0x03, 0x11, 0xb0, 0x28, 0x0e, 0x20, 0x52, 0x74, 0x2e, 0x55, 0x00, 0x10, 0x00, 0xe0, 0xd4, 0x84, 0x32, 0x6c, 0x90, 0x5b, 0x73, 0x74, 0xb0, 0x63, 0xf1, 0x6b,
+  0x73, 0x7c, 0xa6, 0x23, 0x00, 0x80, 0x1c, 0x00, 0x90, 0x0a, 0x80, 0xb8, 0xad, 0x19, 0xb6, 0x3a, 0xbe, 0x97, 0xad, 0x3c, 0x0e, 0xf0, 0x07, 0x57, 0xa5, 0x77, 0xa5, 0x56, 0xa5, 0xb8, 0xad, 0x36,
+  0xa5, 0x3a, 0xc6, 0x3a, 0xc6, 0xb8, 0xb5, 0x36, 0xa5, 0xf5, 0x9c, 0x56, 0xa5, 0x5a, 0x0e, 0x32, 0x36, 0xa5, 0xd4, 0x8e, 0x03, 0x10, 0x94, 0x42, 0x0e, 0x60, 0x91, 0x9c, 0xb1, 0xa4, 0xf1, 0xac,
+  0x02, 0x00, 0x12, 0xd1, 0xfe, 0x18, 0x01, 0x48, 0x27, 0x02, 0xba, 0x3c, 0x00, 0xaa, 0x0a, 0x02, 0x96, 0x03, 0x22, 0xf2, 0xac, 0x4c, 0x0e, 0x24, 0xb5, 0xc5, 0xd6, 0x11, 0x44, 0xce, 0x0a, 0xee,
+  0x12, 0x02, 0x00, 0x22, 0x0f, 0x13, 0x22, 0x03, 0x00, 0xee, 0x02, 0x11, 0x91, 0xa6, 0x57, 0x04, 0x02, 0x00, 0x10, 0x30, 0xbc, 0x22, 0x10, 0x1a, 0x7e, 0x0a, 0x00, 0xa0, 0x03, 0x00, 0x36, 0x06,
+  0x00, 0xf2, 0x02, 0x02, 0x72, 0x11, 0x00, 0xcc, 0x0a, 0x04, 0x30, 0x15, 0x01, 0x32, 0x31, 0x00, 0xe0, 0x09, 0x03, 0xc2, 0x30, 0x20, 0xd2, 0x33, 0xf0, 0x03, 0x40, 0xce, 0x0a, 0x6c, 0x02, 0x04,
+  0x00, 0x40, 0x4c, 0x02, 0xad, 0x02, 0x68, 0x00, 0x00, 0x66, 0x00, 0x02, 0x0c, 0x0e, 0x11, 0x53, 0x26, 0x00, 0x00, 0x28, 0x0b, 0x02, 0xfc, 0x26, 0x02, 0xba, 0x5e, 0x22, 0x50, 0x23, 0xd4, 0x18,
+  0x00, 0x14, 0x04, 0x00, 0x02, 0x19, 0x02, 0x28, 0x2e, 0x20, 0x95, 0x54, 0x14, 0x51, 0x02, 0xa6, 0x0d, 0x02, 0x44, 0x07, 0x01, 0x24, 0x62, 0x00, 0x56, 0x3f, 0x10, 0x12, 0x78, 0x07, 0x44, 0xee,
+  0x1a, 0x70, 0x2b, 0x2c, 0x19, 0x01, 0x62, 0x0a, 0x21, 0x2b, 0x90, 0x0a, 0x58, 0x02, 0x50, 0x20, 0x00, 0x38, 0x0a, 0x00, 0x66, 0x12, 0x00, 0x36, 0x4a, 0x80, 0xf2, 0x43, 0x30, 0x2b, 0x70, 0x2b,
+  0xb2, 0x3b, 0x54, 0x27, 0x53, 0xd1, 0x3b, 0x95, 0x54, 0xb1, 0x0c, 0x40, 0x01, 0x20, 0x19, 0x12, 0x3b, 0x58, 0x69, 0x00, 0xc4, 0x18, 0x00, 0x88, 0x0a, 0x02, 0xde, 0x26, 0x20, 0xce, 0x1a, 0x08,
+  0x00, 0x02, 0xcc, 0x4d, 0x02, 0x26, 0x51, 0x20, 0xb5, 0x64, 0x20, 0x51, 0x00, 0x0c, 0x24, 0x20, 0x50, 0x33, 0x96, 0x23, 0x51, 0xea, 0x01, 0x6c, 0x02, 0x0f, 0xca, 0x43, 0x02, 0x72, 0x2e, 0x22,
+  0x50, 0x2b, 0x64, 0x51, 0x00, 0x04, 0x40, 0x02, 0x6c, 0x51, 0x00, 0x5c, 0x15, 0x11, 0xd1, 0xb2, 0x0a, 0x02, 0xce, 0x06, 0x00, 0x6e, 0x1f, 0x62, 0x6c, 0x0a, 0xad, 0x12, 0x0e, 0x23, 0x86, 0x0a,
+  0x20, 0x0f, 0x2b, 0x96, 0x03, 0x20, 0x8d, 0x12, 0xc0, 0x0a, 0x00, 0xf6, 0x03, 0x10, 0x91, 0xf4, 0x31, 0x12, 0x4b, 0xbc, 0x11, 0x00, 0x58, 0x35, 0x61, 0x95, 0x64, 0x95, 0x5c, 0x74, 0x5c, 0xd6,
+  0x26, 0x02, 0xbc, 0x47, 0x50, 0x4c, 0x34, 0x54, 0xf2, 0x43, 0xee, 0x3f, 0x20, 0xd5, 0x64, 0x10, 0x40, 0x01, 0xc0, 0x7e, 0x10, 0x3b, 0x1a, 0x19, 0x11, 0xf2, 0x72, 0x38, 0x00, 0x7a, 0x03, 0x11,
+  0x13, 0x0a, 0x16, 0x00, 0xd0, 0x11, 0x00, 0x0c, 0x07, 0x40, 0x91, 0x43, 0x2f, 0x3b, 0xe4, 0x0a, 0xc0, 0x6c, 0x1a, 0xca, 0x01, 0x6c, 0x22, 0x8d, 0x22, 0xad, 0x22, 0x89, 0x01, 0x2a, 0x0e, 0x80,
+  0xee, 0x2a, 0x2b, 0x12, 0x2b, 0x12, 0xad, 0x22, 0xee, 0x46, 0x00, 0x7a, 0x15, 0x40, 0xad, 0x22, 0x8c, 0x22, 0x9a, 0x31, 0x02, 0x6c, 0x43, 0x50, 0xb1, 0x4b, 0x2f, 0x3b, 0xd1, 0x44, 0x07, 0x01,
+  0x3e, 0x55, 0x02, 0xd4, 0x03, 0x13, 0x2f, 0xea, 0x0a, 0x13, 0xf2, 0xdc, 0x26, 0x20, 0xf1, 0x53, 0x06, 0x27, 0x02, 0x16, 0x2e, 0x22, 0x2e, 0x3b, 0x24, 0x63, 0x00, 0x34, 0x07, 0x00, 0xb2, 0x46,
+  0x00, 0x8c, 0x03, 0x11, 0x6f, 0x28, 0x2e, 0x82, 0x6f, 0x4b, 0x6f, 0x43, 0x4e, 0x43, 0xcd, 0x32, 0x74, 0x03, 0x10, 0xb0, 0xe8, 0x18, 0x10, 0x43, 0x16, 0x15, 0x21, 0x11, 0x5c, 0x1c, 0x40, 0x01,
+  0x3c, 0x07, 0x00, 0x56, 0x07, 0x13, 0x90, 0x48, 0x78, 0x00, 0x5c, 0x0e, 0x23, 0x12, 0x64, 0xd2, 0x74, 0x30, 0x6c, 0xd4, 0x74, 0x10, 0x07, 0x00, 0x66, 0x03, 0x40, 0xb4, 0x74, 0x93, 0x74, 0x56,
+  0x43, 0x20, 0x32, 0x6c, 0x28, 0x63, 0x20, 0x73, 0x74, 0xf2, 0x06, 0x20, 0xf1, 0x63, 0x6e, 0x0a, 0x22, 0x94, 0x74, 0x98, 0x0a, 0x62, 0xb4, 0x7c, 0xf1, 0x63, 0x4e, 0x4b, 0x60, 0x71, 0x40, 0x31,
+  0x6c, 0x93, 0x74, 0xa6, 0x0a, 0x40, 0xd1, 0x63, 0xd4, 0x7c, 0x1e, 0x00, 0x00, 0xce, 0x0a, 0xa0, 0xd4, 0x84, 0xf5, 0x8c, 0x93, 0x7c, 0x32, 0x6c, 0xf1, 0x6b, 0xb8, 0x0a, 0x00, 0x26, 0x07, 0x00,
+  0x12, 0x07, 0x42, 0x12, 0x6c, 0x94, 0x7c, 0x18, 0x75, 0x60, 0x94, 0x84, 0xf5, 0x8c, 0xd4, 0x84, 0xc8, 0x0a, 0xf0, 0x09, 0xf1, 0x73, 0xb0, 0x6b, 0xb0, 0x6b, 0x52, 0x84, 0x32, 0x7c, 0xb8, 0xad,
+  0x7b, 0xc6, 0x5b, 0xc6, 0x3a, 0xbe, 0x7b, 0xc6, 0x5a, 0xc6, 0xf9, 0xb5, 0x8a, 0x03, 0x40, 0xb4, 0x94, 0xb8, 0xb5, 0x30, 0x40, 0x40, 0x56, 0xad, 0x36, 0xa5, 0x3e, 0x0e, 0x60, 0x36, 0xa5, 0xf4,
+  0x9c, 0x72, 0x8c, 0x90, 0x03, 0x11, 0xb1, 0xb0, 0x0a, 0x33, 0xd0, 0xa4, 0xf1, 0xae, 0x0a, 0x01, 0x92, 0x35, 0x01, 0xbc, 0x23, 0x00, 0x86, 0x03, 0x00, 0x34, 0x07, 0x11, 0x12, 0x44, 0x0e, 0x31,
+  0x94, 0xc5, 0x94, 0x1a, 0x39, 0x02, 0x0e, 0x20, 0x00, 0x88, 0x1c, 0x00, 0x76, 0x1c, 0x02, 0x52, 0x15, 0x02, 0x34, 0x15, 0x24, 0xf2, 0x3b, 0x02, 0x00, 0x00, 0x18, 0x0a, 0x02, 0x98, 0x1b, 0x00,
+  0xee, 0x1b, 0x11, 0xd6, 0xcc, 0x1f, 0x02, 0x04, 0x00, 0x11, 0x95, 0xc4, 0x3b, 0x21, 0x33, 0x44, 0x8a, 0x2d, 0x03, 0xd4, 0x26, 0x00, 0xcc, 0x14, 0x00, 0x5e, 0x03, 0x00, 0xf0, 0x0d, 0x21, 0x12,
+  0x3c, 0xba, 0x14, 0x01, 0x1e, 0x15, 0x20, 0x71, 0x2b, 0xda, 0x0a, 0x01, 0xd8, 0x46, 0x12, 0x4c, 0x5c, 0x1c, 0x00, 0x94, 0x15, 0x02, 0xf8, 0x5e, 0x00, 0x5a, 0x00, 0x02, 0xdc, 0x18, 0x41, 0xee,
+  0x1a, 0xee, 0x12, 0xf2, 0x03, 0x01, 0xa8, 0x06, 0x02, 0xa6, 0x65, 0x00, 0x08, 0x2e, 0x01, 0xb2, 0x1c, 0x01, 0x08, 0x07, 0x02, 0x16, 0x70, 0x22, 0xf2, 0x3b, 0xa8, 0x31, 0x00, 0x34, 0x00, 0x02,
+  0x2c, 0x4a, 0x02, 0x2e, 0x58, 0x00, 0xb0, 0x18, 0x22, 0xee, 0x12, 0x00, 0x16, 0x01, 0x3a, 0x11, 0x30, 0x0a, 0x4b, 0x02, 0x02, 0x12, 0x00, 0xb0, 0x0a, 0x00, 0x93, 0x04, 0x00, 0x5a, 0x00, 0x11,
+  0x70, 0x2c, 0x58, 0xf0, 0x03, 0x4c, 0x02, 0xa9, 0x01, 0x4c, 0x02, 0xee, 0x1a, 0xae, 0x12, 0x2c, 0x02, 0x2b, 0x02, 0x0e, 0x1b, 0x4c, 0x02, 0x0e, 0x00, 0x02, 0x9e, 0x2e, 0x42, 0xce, 0x12, 0x0f,
+  0x1b, 0x72, 0x77, 0x12, 0x2f, 0x3c, 0x16, 0x01, 0xb4, 0x34, 0x11, 0x13, 0x1e, 0x0e, 0x00, 0x72, 0x7e, 0x04, 0x88, 0x38, 0x20, 0x70, 0x33, 0x1c, 0x27, 0x02, 0x20, 0x27, 0x02, 0xf4, 0x2d, 0x04,
+  0x56, 0x3c, 0x01, 0xd0, 0x62, 0x01, 0x3c, 0x5f, 0x91, 0x8d, 0x12, 0xad, 0x12, 0xcd, 0x1a, 0x8c, 0x12, 0x0e, 0xd0, 0x03, 0x00, 0x4e, 0x07, 0x00, 0x1c, 0x00, 0x31, 0x4f, 0x2b, 0x50, 0x44, 0x5f,
+  0x00, 0x78, 0x58, 0x00, 0xf4, 0x06, 0x00, 0xa6, 0x0e, 0x02, 0x9c, 0x43, 0x02, 0x7e, 0x38, 0x00, 0xac, 0x26, 0x11, 0x54, 0x2c, 0x0e, 0x11, 0x70, 0xca, 0x7e, 0x01, 0xea, 0x46, 0x01, 0xac, 0x0a,
+  0x51, 0xee, 0x2a, 0xad, 0x22, 0x2f, 0x0e, 0x4e, 0x22, 0x37, 0x75, 0x96, 0x35, 0x11, 0x54, 0x00, 0x71, 0x13, 0x33, 0x44, 0x47, 0x02, 0x2a, 0x40, 0x00, 0x16, 0x0e, 0x20, 0x0e, 0x2b, 0xec, 0x0d,
+  0x22, 0xce, 0x2a, 0xca, 0x85, 0x00, 0xf4, 0x8c, 0xe0, 0xce, 0x2a, 0x70, 0x43, 0x74, 0x64, 0x91, 0x43, 0x54, 0x5c, 0x17, 0x75, 0x54, 0x5c, 0x16, 0x07, 0xc4, 0x17, 0x75, 0xf6, 0x74, 0x74, 0x64,
+  0xd6, 0x6c, 0xd6, 0x74, 0xd5, 0x6c, 0x36, 0x0e, 0x11, 0x4f, 0x92, 0x82, 0x02, 0xb0, 0x74, 0x22, 0x91, 0x43, 0xa6, 0x31, 0x00, 0x66, 0x03, 0x60, 0x13, 0x5c, 0xf6, 0x74, 0xf6, 0x74, 0xa4, 0x7b,
+  0x02, 0xfe, 0x26, 0x00, 0x9a, 0x03, 0x02, 0xfa, 0x0d, 0x01, 0x0e, 0x47, 0x11, 0x4b, 0xb2, 0x11, 0x03, 0xa6, 0x46, 0x00, 0x2c, 0x43, 0x01, 0x4e, 0x0e, 0x14, 0x6c, 0x2c, 0x5c, 0x11, 0x90, 0xfe,
+  0x62, 0x00, 0x2e, 0x15, 0x02, 0xa6, 0x0a, 0x00, 0x78, 0x03, 0x20, 0x0d, 0x3b, 0xde, 0x06, 0x20, 0x4f, 0x43, 0x0c, 0x0e, 0x11, 0x94, 0x68, 0x51, 0x00, 0xe0, 0x1f, 0x20, 0xd5, 0x74, 0xbe, 0x38,
+  0x11, 0x53, 0x1c, 0x35, 0x00, 0xca, 0x11, 0x31, 0x90, 0x53, 0x6f, 0xd2, 0x18, 0x10, 0xd1, 0x86, 0x58, 0x12, 0x43, 0xe8, 0x18, 0xa0, 0x4f, 0x4b, 0xf1, 0x63, 0x4f, 0x4b, 0xcc, 0x3a, 0x73, 0x74,
+  0x20, 0x27, 0x00, 0x22, 0x35, 0x00, 0xa4, 0x11, 0x00, 0x2c, 0x0e, 0x20, 0xd5, 0x7c, 0x8e, 0x03, 0x00, 0x0c, 0x00, 0x00, 0xf6, 0x26, 0x00, 0xca, 0x18, 0x00, 0x94, 0x03, 0x00, 0x1e, 0x00, 0x20,
+  0xf4, 0x84, 0xc6, 0x0a, 0x00, 0xa0, 0x23, 0x02, 0x34, 0x07, 0x00, 0x06, 0x00, 0x00, 0x48, 0x15, 0x20, 0x32, 0x6c, 0x1c, 0x07, 0x00, 0x40, 0x0e, 0x00, 0x2c, 0x47, 0x20, 0xd1, 0x63, 0x14, 0x00,
+  0x00, 0x02, 0x00, 0x80, 0x32, 0x74, 0xf1, 0x6b, 0xb0, 0x63, 0xd1, 0x6b, 0x38, 0x07, 0x02, 0x20, 0x07, 0xe0, 0xf1, 0x73, 0xd4, 0x8c, 0x15, 0x9d, 0xf5, 0x94, 0x52, 0x84, 0xd5, 0x94, 0x77, 0xad,
+  0x10, 0x07, 0x40, 0xb8, 0xad, 0xd8, 0xb5, 0x88, 0x1c, 0x00, 0x70, 0x15, 0xf0, 0x06, 0xb7, 0xb5, 0x36, 0xa5, 0x19, 0xbe, 0x97, 0xad, 0x36, 0xa5, 0x15, 0x9d, 0x15, 0xa5, 0x35, 0xa5, 0xf4, 0x9c,
+  0xd3, 0x9c, 0xf3, 0xa6, 0x23, 0x01, 0x20, 0x07, 0x02, 0x60, 0x2e, 0x02, 0x1c, 0x07, 0x02, 0xb8, 0x0a, 0x11, 0xf1, 0xba, 0x3c, 0x00, 0x8e, 0x03, 0x04, 0x18, 0x39, 0x22, 0x16, 0xce, 0x24, 0x07,
+  0x40, 0x57, 0xde, 0x37, 0xd6, 0x98, 0x23, 0x11, 0xd2, 0x86, 0x3f, 0x11, 0xf3, 0x54, 0x0a, 0x00, 0x68, 0x65, 0x02, 0x5a, 0x65, 0x00, 0x4a, 0x03, 0x10, 0x34, 0x96, 0x57, 0x12, 0x4c, 0xf8, 0x1b,
+  0x02, 0x6e, 0x0a, 0x00, 0x44, 0x38, 0x11, 0xb1, 0x42, 0x73, 0x00, 0x1e, 0x00, 0x00, 0xaa, 0x26, 0x02, 0x1e, 0x51, 0x20, 0x30, 0x23, 0xf0, 0x2a, 0x01, 0xb2, 0x46, 0x21, 0x2b, 0x71, 0x60, 0x23,
+  0x02, 0xe4, 0x2a, 0x24, 0xf3, 0x3b, 0xca, 0x5e, 0x00, 0xbc, 0x0d, 0x31, 0xb6, 0x5c, 0xf6, 0x8e, 0x31, 0x00, 0x19, 0xf6, 0x00, 0x50, 0x20, 0x02, 0x0a, 0x0e, 0x20, 0x33, 0x4c, 0x50, 0x20, 0x00,
+  0x98, 0x1c, 0x50, 0x95, 0x54, 0x54, 0x54, 0x95, 0xb2, 0x31, 0x01, 0x1c, 0x39, 0x11, 0x34, 0x72, 0x03, 0x11, 0x34, 0x66, 0x31, 0x20, 0xb2, 0x3b, 0x36, 0x85, 0x01, 0xd2, 0x65, 0x10, 0x33, 0xd2,
+  0x38, 0x01, 0x48, 0x0b, 0x01, 0x02, 0x07, 0x02, 0x26, 0x27, 0x00, 0xe6, 0x14, 0x02, 0x38, 0x5f, 0x00, 0xc6, 0x03, 0x02, 0x4e, 0x07, 0x04, 0x60, 0x43, 0x01, 0x28, 0x27, 0x11, 0x4c, 0x06, 0x2a,
+  0x21, 0x2b, 0x53, 0x54, 0x00, 0x00, 0x38, 0x07, 0x00, 0xd0, 0x26, 0x00, 0x0c, 0x3c, 0x02, 0xce, 0x58, 0x02, 0xcc, 0x27, 0x01, 0x66, 0x23, 0x01, 0x1a, 0x27, 0x00, 0xf2, 0x35, 0x00, 0x72, 0x27,
+  0x11, 0xee, 0xd6, 0x34, 0x00, 0x04, 0x00, 0x11, 0xd2, 0x54, 0x0e, 0x00, 0x9e, 0x20, 0x00, 0x08, 0x07, 0x11, 0xb2, 0x52, 0x2a, 0x04, 0x16, 0x82, 0x00, 0xcc, 0x1f, 0x00, 0xd6, 0x46, 0x02, 0xfc,
+  0x46, 0xa0, 0xad, 0x1a, 0x6c, 0x12, 0xad, 0x1a, 0x0e, 0x23, 0xb1, 0x3b, 0x1a, 0x19, 0x02, 0x76, 0x66, 0x00, 0x8c, 0x0a, 0x02, 0x26, 0x00, 0x00, 0xa8, 0x11, 0x02, 0x6c, 0x58, 0x01, 0x40, 0x58,
+  0x00, 0x14, 0x32, 0x01, 0xb0, 0x03, 0x00, 0x94, 0x31, 0x00, 0xa0, 0x2a, 0x73, 0x0e, 0x2b, 0xea, 0x01, 0xad, 0x1a, 0xd2, 0x0a, 0x6a, 0x00, 0xc0, 0x23, 0x01, 0x04, 0x00, 0x01, 0xcc, 0x8c, 0x02,
+  0x1a, 0x0e, 0x20, 0xce, 0x1a, 0x3e, 0x07, 0xc0, 0x4c, 0x0a, 0xee, 0x2a, 0x50, 0x33, 0x8d, 0x1a, 0x4c, 0x12, 0x4f, 0x33, 0xf8, 0x11, 0x51, 0x54, 0x5c, 0xd6, 0x6c, 0x53, 0x24, 0x8d, 0x00, 0xee,
+  0x0d, 0x00, 0x56, 0x3c, 0x00, 0x22, 0x07, 0x40, 0x0f, 0x33, 0x13, 0x54, 0xc4, 0x1f, 0x30, 0xcd, 0x2a, 0x0f, 0x00, 0x20, 0x90, 0x3b, 0x8d, 0x22, 0x50, 0x3b, 0xd2, 0x4b, 0x2f, 0x3b, 0xae, 0x0a,
+  0x00, 0xfe, 0x06, 0x20, 0x2f, 0x3b, 0xf4, 0x89, 0x00, 0x14, 0x27, 0x00, 0xa2, 0x74, 0x00, 0x32, 0x15, 0x02, 0xa0, 0x0a, 0x00, 0x1e, 0x07, 0x11, 0x2f, 0x32, 0x86, 0x00, 0x94, 0x03, 0x40, 0x2b,
+  0x1a, 0xee, 0x32, 0x72, 0x07, 0x01, 0x68, 0x0e, 0x00, 0x74, 0x1c, 0x00, 0x9a, 0x3c, 0x10, 0x43, 0x8c, 0x2a, 0x00, 0x80, 0x0a, 0x20, 0xd5, 0x74, 0x4c, 0x03, 0x20, 0x53, 0x64, 0x56, 0x1c, 0x02,
+  0x16, 0x4e, 0x00, 0xea, 0x18, 0x00, 0x7a, 0x23, 0x20, 0x73, 0x64, 0x06, 0x27, 0x02, 0x5a, 0x35, 0x00, 0x2c, 0x15, 0x00, 0x48, 0x0e, 0x00, 0xb4, 0x18, 0x00, 0x1c, 0x3c, 0x11, 0x90, 0xc0, 0x38,
+  0x00, 0x24, 0x07, 0x00, 0x96, 0x66, 0x00, 0xb0, 0x03, 0x00, 0x0a, 0x00, 0x00, 0xda, 0x7b, 0x31, 0x93, 0x74, 0x12, 0x1a, 0x0e, 0x00, 0x1a, 0x2e, 0x40, 0x12, 0x64, 0x32, 0x6c, 0x8c, 0x0a, 0x51,
+  0x53, 0x6c, 0x73, 0x74, 0xd5, 0x54, 0x03, 0x00, 0x92, 0x03, 0x00, 0x8a, 0x03, 0x11, 0x73, 0xa4, 0x5f, 0x20, 0x90, 0x53, 0xfc, 0x06, 0x40, 0x53, 0x6c, 0xb0, 0x5b, 0x2c, 0x00, 0x40, 0x4f, 0x4b,
+  0x32, 0x6c, 0x30, 0x00, 0x20, 0xf5, 0x84, 0xee, 0x1f, 0x00, 0x42, 0x07, 0x00, 0x50, 0x6a, 0x20, 0x93, 0x74, 0xec, 0x18, 0x00, 0x18, 0x00, 0x11, 0x53, 0xa8, 0x03, 0x00, 0x26, 0x7c, 0x60, 0x52,
+  0x74, 0x94, 0x7c, 0x11, 0x6c, 0x60, 0x15, 0x02, 0x1c, 0x07, 0x51, 0xf5, 0x8c, 0xd5, 0x84, 0x12, 0xe4, 0x11, 0x20, 0x32, 0x74, 0x94, 0x03, 0x11, 0x73, 0x64, 0x55, 0xa0, 0x93, 0x84, 0xd5, 0x8c,
+  0x73, 0x84, 0x53, 0x84, 0x32, 0x7c, 0xfe, 0x1f, 0x40, 0x56, 0xa5, 0x36, 0x9d, 0xb4, 0x0a, 0x80, 0x97, 0xad, 0xb8, 0xb5, 0x39, 0xc6, 0xf8, 0xbd, 0x82, 0x03, 0xf4, 0x08, 0x39, 0xc6, 0xb8, 0xb5,
+  0xd8, 0xbd, 0xbc, 0xd6, 0xd8, 0xb5, 0x3a, 0xc6, 0xf9, 0xbd, 0xb8, 0xb5, 0xd4, 0x94, 0x72, 0x8c, 0x92, 0x94, 0xd3, 0x62, 0x15, 0x05, 0xd2, 0x11, 0x00, 0x6a, 0x15, 0x11, 0xf1, 0x8c, 0x03, 0x02,
+  0xd6, 0x11, 0x22, 0x33, 0xb5, 0x8e, 0x03, 0x80, 0x53, 0xbd, 0xf2, 0xac, 0x74, 0xbd, 0xf2, 0xac, 0x0c, 0x59, 0x00, 0x04, 0x00, 0x00, 0x92, 0x31, 0x11, 0xf3, 0x68, 0x6c, 0x00, 0xe2, 0x22, 0x60,
+  0xce, 0x0a, 0x8d, 0x02, 0xce, 0x0a, 0x62, 0x31, 0x00, 0xfe, 0x09, 0x00, 0xea, 0x09, 0x04, 0xe4, 0x1f, 0x20, 0x13, 0x44, 0x30, 0x35, 0x00, 0x0a, 0x11, 0x02, 0x78, 0x31, 0x22, 0xb2, 0x33, 0x9a,
+  0x4d, 0x00, 0xfe, 0x8b, 0x00, 0x96, 0x03, 0x02, 0xc7, 0xfc, 0x00, 0x14, 0x27, 0x20, 0x58, 0x6d, 0x5e, 0x03, 0x00, 0x62, 0x2a, 0x11, 0x14, 0xaa, 0x3c, 0x00, 0x14, 0x1c, 0x11, 0x75, 0x5e, 0x20,
+  0x01, 0x22, 0x8c, 0x21, 0x33, 0x13, 0x5e, 0x3c, 0x02, 0x54, 0x3c, 0x00, 0xee, 0x06, 0x00, 0x44, 0x43, 0x00, 0x78, 0x07, 0x00, 0x42, 0x0a, 0x00, 0x04, 0x2e, 0x11, 0xb1, 0xac, 0x06, 0x01, 0x06,
+  0x43, 0x01, 0xca, 0x1c, 0x01, 0x3c, 0x58, 0x01, 0x2a, 0x03, 0x01, 0xaa, 0x46, 0x01, 0x22, 0x07, 0x01, 0xec, 0x4d, 0x01, 0xdc, 0x0d, 0x02, 0xdc, 0x26, 0x00, 0x78, 0x69, 0x02, 0xa0, 0x11, 0x11,
+  0x50, 0x98, 0x77, 0x02, 0xde, 0x06, 0x01, 0x68, 0x70, 0x03, 0x80, 0x31, 0x06, 0xba, 0x46, 0x02, 0xfa, 0x26, 0x01, 0xb6, 0x26, 0x01, 0x94, 0x58, 0x22, 0x91, 0x33, 0x64, 0x0b, 0x01, 0x56, 0x00,
+  0x00, 0xde, 0x03, 0x01, 0xfc, 0x81, 0x00, 0xa6, 0x40, 0x20, 0x75, 0x54, 0xac, 0x06, 0x00, 0x96, 0x0a, 0x11, 0x74, 0x9a, 0x0a, 0x00, 0x6e, 0x00, 0x00, 0x1a, 0x32, 0x00, 0xa8, 0x4a, 0x00, 0x86,
+  0x35, 0x11, 0xf3, 0xbe, 0x2d, 0x00, 0x74, 0x3f, 0x00, 0x04, 0x0b, 0x02, 0x36, 0x2e, 0x22, 0x50, 0x33, 0xb6, 0x2d, 0x02, 0x78, 0x69, 0x00, 0xfc, 0x34, 0x00, 0xf4, 0x54, 0xa2, 0xad, 0x1a, 0xea,
+  0x01, 0x4b, 0x02, 0x0a, 0x02, 0xad, 0x1a, 0xb0, 0x8c, 0x00, 0x1a, 0x47, 0x02, 0x18, 0x0e, 0x00, 0x22, 0x12, 0x02, 0xd0, 0x2a, 0x20, 0xd2, 0x43, 0x4a, 0x0e, 0x00, 0xd4, 0x58, 0x00, 0x28, 0x12,
+  0x00, 0x16, 0x27, 0x02, 0x08, 0x78, 0x01, 0x50, 0x89, 0x01, 0x1e, 0x3c, 0x11, 0x0f, 0x38, 0x27, 0x20, 0x0e, 0x2b, 0x1c, 0x07, 0x20, 0xb1, 0x43, 0xa4, 0x1c, 0x00, 0x20, 0x07, 0x53, 0xd6, 0x6c,
+  0xd5, 0x64, 0x54, 0x88, 0x1c, 0x62, 0xee, 0x2a, 0x4b, 0x12, 0xee, 0x2a, 0x94, 0x82, 0x11, 0x90, 0xd2, 0x26, 0x02, 0x60, 0x1c, 0x20, 0x2f, 0x3b, 0x7c, 0x0a, 0x53, 0x95, 0x64, 0xf6, 0x74, 0x54,
+  0xda, 0x90, 0x02, 0x70, 0x5c, 0x22, 0xd1, 0x4b, 0x18, 0x94, 0x11, 0x95, 0xc6, 0x66, 0x00, 0x7a, 0x0e, 0x11, 0x53, 0xbe, 0x90, 0x00, 0x5c, 0x20, 0x00, 0xf0, 0x3f, 0x13, 0x54, 0xd6, 0x03, 0x20,
+  0xb1, 0x4b, 0xa4, 0x03, 0x00, 0xaa, 0x74, 0x00, 0x88, 0x3c, 0x00, 0x1a, 0x07, 0x02, 0x7a, 0x43, 0x20, 0x4f, 0x43, 0x3c, 0x1c, 0x51, 0x8c, 0x2a, 0xac, 0x2a, 0x6f, 0x9e, 0x31, 0x40, 0xb0, 0x4b,
+  0x16, 0x7d, 0x3a, 0x43, 0x20, 0x57, 0x85, 0x1a, 0x07, 0x00, 0x1c, 0x00, 0x00, 0x28, 0x2e, 0x00, 0x10, 0x35, 0x00, 0xec, 0x1f, 0x02, 0xd0, 0x18, 0x00, 0x24, 0x0e, 0x20, 0xed, 0x3a, 0x9c, 0x03,
+  0x00, 0x1e, 0x35, 0x00, 0xea, 0x1f, 0x00, 0xa0, 0x11, 0x00, 0x4e, 0x1c, 0x02, 0x18, 0x63, 0x02, 0x2e, 0x6a, 0x00, 0x38, 0x35, 0x00, 0xba, 0x03, 0x00, 0x28, 0x35, 0x10, 0x6f, 0x36, 0x3c, 0x21,
+  0x7c, 0xd5, 0x80, 0x2a, 0x40, 0x77, 0x8d, 0xd4, 0x7c, 0x48, 0x15, 0x00, 0x28, 0x35, 0x00, 0xe4, 0x1f, 0x00, 0xca, 0x31, 0x00, 0xcc, 0x18, 0x02, 0xae, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x58, 0x15,
+  0x00, 0x94, 0x0a, 0x02, 0xdc, 0x18, 0x00, 0x78, 0x63, 0x00, 0xb6, 0x23, 0x20, 0x12, 0x6c, 0x10, 0x07, 0x02, 0xf6, 0x1f, 0x80, 0x12, 0x6c, 0x15, 0x8d, 0xb4, 0x7c, 0xf1, 0x6b, 0xda, 0x18, 0x20,
+  0xd4, 0x84, 0xb6, 0x0a, 0x20, 0xb4, 0x84, 0x32, 0x0e, 0x60, 0x94, 0x7c, 0x94, 0x7c, 0xd5, 0x8c, 0x46, 0x2e, 0x50, 0xd5, 0x8c, 0x73, 0x7c, 0x73, 0x56, 0x2e, 0x90, 0x7c, 0xd0, 0x6b, 0x53, 0x84,
+  0x73, 0x84, 0xb4, 0x8c, 0xd6, 0x4a, 0x00, 0x3a, 0x2e, 0x10, 0x36, 0x92, 0x23, 0x50, 0x9c, 0x19, 0xbe, 0xd8, 0xb5, 0x98, 0x03, 0xa0, 0x5a, 0xc6, 0xb8, 0xb5, 0x15, 0xa5, 0x19, 0xbe, 0x77, 0xad,
+  0xbe, 0x23, 0x51, 0x11, 0x7c, 0x12, 0x7c, 0x73, 0x08, 0x52, 0x15, 0x92, 0x44, 0x0e, 0x13, 0xd1, 0x80, 0x35, 0x74, 0x70, 0x9c, 0x4f, 0x94, 0xb0, 0xa4, 0xf1, 0x68, 0x15, 0x23, 0xb5, 0x33, 0x24,
+  0x07, 0x30, 0xf6, 0xcd, 0x33, 0xd4, 0x43, 0x92, 0xc5, 0xee, 0x8b, 0xb1, 0xa4, 0x94, 0xc5, 0x37, 0xd6, 0xaa, 0x0a, 0x02, 0xe6, 0x6f, 0x02, 0x26, 0x11, 0x02, 0xae, 0x57, 0x00, 0xb2, 0x0a, 0x30,
+  0x50, 0x2b, 0x6c, 0x0a, 0x39, 0x11, 0x2b, 0x5c, 0x62, 0x01, 0x82, 0x1f, 0x02, 0x7c, 0x31, 0x20, 0xef, 0x12, 0x64, 0x0e, 0x02, 0xda, 0x38, 0x01, 0x9e, 0x7a, 0x03, 0x1e, 0x2a, 0x60, 0xce, 0x12,
+  0x6c, 0x02, 0x8c, 0x02, 0x7c, 0x11, 0x00, 0xfa, 0x0a, 0x02, 0x1a, 0x35, 0x02, 0x4a, 0x31, 0x02, 0x20, 0x07, 0x02, 0xfe, 0x2d, 0x13, 0xb2, 0xf2, 0x5e, 0x01, 0xb2, 0x8f, 0x21, 0x44, 0xd2, 0x44,
+  0x0a, 0x20, 0x8d, 0x0a, 0xa6, 0x0a, 0x00, 0xb0, 0x38, 0x31, 0xef, 0x22, 0x71, 0x54, 0x47, 0x00, 0xb4, 0x43, 0x02, 0x64, 0x3f, 0x00, 0xdc, 0x22, 0x02, 0xb2, 0x4d, 0x02, 0xdc, 0x0d, 0x03, 0x06,
+  0x20, 0x10, 0x54, 0x5c, 0x03, 0x13, 0x0f, 0x58, 0x66, 0x02, 0xc6, 0x35, 0x20, 0xce, 0x1a, 0xbe, 0x06, 0x01, 0x2c, 0x5c, 0x03, 0x12, 0x32, 0x02, 0x6e, 0x3c, 0x11, 0x90, 0xa6, 0x1f, 0x02, 0x14,
+  0x1c, 0x00, 0x16, 0x0e, 0x00, 0xea, 0x0a, 0x00, 0x94, 0x2e, 0x11, 0xb5, 0xe0, 0x14, 0x00, 0x94, 0x07, 0x00, 0xf6, 0x27, 0x11, 0x33, 0xd4, 0x38, 0x02, 0xe2, 0x38, 0x02, 0x2e, 0x44, 0x02, 0x52,
+  0x90, 0x22, 0x13, 0x4c, 0x04, 0x2e, 0x10, 0xf2, 0x24, 0x82, 0x01, 0x92, 0x11, 0x11, 0x95, 0xa6, 0x2a, 0x02, 0x34, 0x40, 0x00, 0xa8, 0x4d, 0x00, 0x18, 0x15, 0x11, 0xb2, 0xfc, 0x2d, 0x02, 0xb4,
+  0x7e, 0x00, 0x56, 0x6d, 0x11, 0x12, 0x6a, 0x6d, 0x13, 0xb0, 0x86, 0x58, 0x00, 0x26, 0x4e, 0x00, 0x0c, 0x3c, 0x02, 0xd4, 0x11, 0x22, 0x0f, 0x2b, 0xf4, 0x77, 0x02, 0xfe, 0x1f, 0x02, 0xa0, 0x5f,
+  0x03, 0x5e, 0x89, 0x01, 0x12, 0x0b, 0x11, 0x70, 0x80, 0x2a, 0x60, 0x2b, 0x02, 0x8d, 0x12, 0x6c, 0x12, 0x44, 0x23, 0x00, 0xf2, 0x4d, 0x00, 0x5e, 0x11, 0x20, 0x2f, 0x3b, 0x4c, 0x66, 0x02, 0xde,
+  0x46, 0x42, 0xf6, 0x6c, 0x54, 0x5c, 0x10, 0x27, 0x04, 0x66, 0x0a, 0x10, 0x50, 0x78, 0x90, 0x01, 0x32, 0x5c, 0x00, 0xc8, 0x3f, 0x02, 0x78, 0x43, 0xc0, 0x54, 0x64, 0x74, 0x64, 0xb5, 0x6c, 0x94,
+  0x64, 0x95, 0x6c, 0xf2, 0x53, 0x7e, 0x03, 0x00, 0x0c, 0x0e, 0x22, 0x50, 0x43, 0xf4, 0x34, 0x11, 0x4f, 0x30, 0x00, 0x11, 0x4f, 0x52, 0x0e, 0x20, 0xad, 0x2a, 0x60, 0x00, 0x71, 0xcd, 0x2a, 0xb1,
+  0x43, 0xee, 0x32, 0x90, 0xcc, 0x82, 0x00, 0xe6, 0x0a, 0x02, 0xbc, 0x4a, 0x10, 0xf2, 0x32, 0x86, 0x01, 0xf6, 0x7b, 0x00, 0x98, 0x0a, 0x00, 0xfe, 0x06, 0x42, 0xcd, 0x32, 0x4f, 0x43, 0x08, 0x27,
+  0x00, 0x30, 0x2e, 0xb0, 0xb4, 0x74, 0x56, 0x85, 0x15, 0x7d, 0xd4, 0x74, 0xb4, 0x6c, 0xd1, 0x76, 0x55, 0x90, 0x4b, 0x0e, 0x3b, 0x8c, 0x2a, 0xad, 0x32, 0x90, 0x4b, 0x02, 0x20, 0x00, 0x56, 0x15,
+  0x00, 0x72, 0x0a, 0x00, 0xd6, 0x18, 0x00, 0x96, 0x0a, 0x00, 0xb4, 0x6d, 0x00, 0x7a, 0x23, 0x00, 0xb2, 0x3f, 0x13, 0xd1, 0x56, 0x1c, 0x00, 0x84, 0x03, 0x00, 0xa8, 0x03, 0x00, 0x72, 0x1c, 0x00,
+  0x5e, 0x3c, 0x80, 0x36, 0x85, 0xd4, 0x74, 0x11, 0x64, 0x90, 0x53, 0x62, 0x3c, 0x31, 0xac, 0x32, 0xf1, 0xe8, 0x2d, 0x00, 0x72, 0x1c, 0xa0, 0x2e, 0x4b, 0xcd, 0x3a, 0x6f, 0x53, 0x0e, 0x43, 0x12,
+  0x64, 0x60, 0x03, 0x20, 0x4e, 0x4b, 0x90, 0x2a, 0x40, 0x90, 0x53, 0x52, 0x6c, 0xf2, 0x06, 0x21, 0x12, 0x64, 0x20, 0x07, 0x10, 0x6c, 0xdc, 0x0a, 0x20, 0x53, 0x74, 0x8e, 0x2a, 0x40, 0xf5, 0x84,
+  0x53, 0x74, 0x28, 0x27, 0x80, 0x6b, 0x32, 0x0d, 0x43, 0xd0, 0x5b, 0x94, 0x7c, 0x6a, 0x35, 0x60, 0x73, 0x74, 0x2e, 0x4b, 0x0e, 0x4b, 0x28, 0x00, 0x01, 0xd8, 0x18, 0x30, 0x7c, 0xd5, 0x84, 0x0c,
+  0x20, 0x40, 0xd5, 0x84, 0xf5, 0x8c, 0x42, 0x0e, 0x11, 0x32, 0x1a, 0x07, 0x00, 0x3c, 0x0e, 0x60, 0xf1, 0x6b, 0x12, 0x74, 0x11, 0x74, 0xda, 0x31, 0x40, 0x53, 0x7c, 0x32, 0x7c, 0x42, 0x0e, 0x22,
+  0x93, 0x8c, 0x1c, 0x07, 0x80, 0x73, 0x84, 0xf1, 0x7b, 0x15, 0x9d, 0x19, 0xbe, 0x90, 0x03, 0x40, 0x39, 0xc6, 0x19, 0xbe, 0x92, 0x03, 0x40, 0x5a, 0xc6, 0x15, 0x9d, 0x80, 0x1c, 0x02, 0x5e, 0x2e,
+  0x11, 0xb4, 0x02, 0x00, 0x00, 0xaa, 0x23, 0x00, 0x3c, 0x40, 0x02, 0x12, 0x39, 0x30, 0x70, 0x9c, 0x70, 0x9a, 0x03, 0x01, 0xce, 0x11, 0x57, 0xf1, 0xac, 0x12, 0xad, 0x32, 0x82, 0x1c, 0x73, 0x0e,
+  0x8c, 0xb5, 0xc5, 0xd5, 0xcd, 0x94, 0x7a, 0x4e, 0x42, 0x53, 0xbd, 0x71, 0x2b, 0x50, 0x06, 0x02, 0xb8, 0x06, 0x00, 0x3a, 0x27, 0x03, 0xc6, 0x34, 0x01, 0xde, 0x30, 0x00, 0x4e, 0x31, 0x00, 0x3a,
+  0x43, 0x00, 0xa0, 0x02, 0x00, 0x20, 0x07, 0x02, 0xc6, 0x3b, 0x02, 0xde, 0x0a, 0x02, 0xd4, 0x2a, 0x31, 0xef, 0x1a, 0x71, 0x56, 0x11, 0x02, 0x7c, 0x03, 0x11, 0xd2, 0x14, 0x11, 0x00, 0xf0, 0x22,
+  0x10, 0x91, 0xde, 0x1b, 0x03, 0x26, 0x58, 0x11, 0x33, 0x04, 0x07, 0x02, 0xd4, 0x03, 0x51, 0xce, 0x12, 0xad, 0x0a, 0x6c, 0xbc, 0x3c, 0x00, 0xdc, 0x03, 0x00, 0x1c, 0x18, 0x00, 0x32, 0x1f, 0x60,
+  0xf7, 0x64, 0xf6, 0x64, 0x95, 0x5c, 0x14, 0x03, 0x02, 0x70, 0x00, 0x20, 0x95, 0x5c, 0x92, 0x22, 0x80, 0x75, 0x5c, 0xd6, 0x64, 0x75, 0x54, 0xd6, 0x64, 0x5a, 0x18, 0x13, 0x50, 0x30, 0x40, 0x00,
+  0x92, 0x03, 0x02, 0x88, 0x00, 0x00, 0x36, 0x15, 0x00, 0x12, 0x0e, 0x31, 0xef, 0x1a, 0x50, 0x9a, 0x27, 0x00, 0xdc, 0x2e, 0x02, 0x28, 0x5c, 0x00, 0xce, 0x03, 0x02, 0x20, 0x40, 0x12, 0x33, 0xd4,
+  0x3c, 0x01, 0xb6, 0x4a, 0x20, 0x13, 0x44, 0x38, 0x0a, 0x00, 0xf6, 0x2a, 0x00, 0x6a, 0x0a, 0x20, 0x30, 0x2b, 0x0a, 0x27, 0x11, 0x74, 0xc0, 0x27, 0x02, 0x8c, 0x03, 0x02, 0xb8, 0x0a, 0x00, 0x36,
+  0x00, 0x22, 0x74, 0x54, 0x38, 0x1c, 0x00, 0x1c, 0x07, 0x11, 0x94, 0x8a, 0x00, 0x40, 0x58, 0x75, 0xf6, 0x64, 0x9e, 0x07, 0x44, 0xd6, 0x64, 0xb5, 0x5c, 0x4c, 0x7b, 0x20, 0x33, 0x4c, 0x38, 0x2e,
+  0x11, 0x95, 0x24, 0x23, 0x00, 0x42, 0x23, 0x20, 0x74, 0x5c, 0xc4, 0x5f, 0x03, 0xf8, 0x54, 0x00, 0x30, 0x27, 0x01, 0x78, 0x66, 0x00, 0x50, 0x07, 0x00, 0x92, 0x1c, 0x30, 0x53, 0x54, 0xb1, 0xb0,
+  0x3f, 0x00, 0x56, 0x5f, 0x31, 0x64, 0x37, 0x75, 0xec, 0x23, 0x10, 0x4c, 0x16, 0x5c, 0x22, 0x74, 0x54, 0x90, 0x74, 0x00, 0x82, 0x03, 0x00, 0x5a, 0x07, 0x00, 0x96, 0x27, 0x00, 0x92, 0x23, 0x11,
+  0xd5, 0x30, 0x12, 0xe0, 0xd5, 0x64, 0x16, 0x75, 0x37, 0x7d, 0x16, 0x75, 0xd5, 0x6c, 0x98, 0x85, 0x16, 0x7d, 0xe6, 0x5b, 0x00, 0x82, 0x4a, 0x11, 0x4f, 0x0e, 0x47, 0x13, 0x2f, 0xfe, 0x1f, 0x00,
+  0x48, 0x23, 0x02, 0x72, 0x4a, 0x00, 0x76, 0x11, 0x02, 0x16, 0x43, 0x00, 0xfe, 0x26, 0x00, 0x1a, 0x35, 0x11, 0x4f, 0xc6, 0x03, 0x20, 0x2f, 0x3b, 0x80, 0x03, 0x11, 0x12, 0x00, 0x20, 0x10, 0x91,
+  0x90, 0x31, 0x00, 0x04, 0x07, 0x00, 0x18, 0x78, 0x01, 0xde, 0x66, 0x00, 0x52, 0x0e, 0x00, 0xe0, 0x89, 0x00, 0x60, 0x0e, 0x00, 0x3e, 0x00, 0x00, 0x02, 0x00, 0x31, 0xb5, 0x6c, 0x54, 0xf8, 0x66,
+  0x11, 0xf2, 0xea, 0x26, 0x00, 0x6a, 0x3c, 0x02, 0x0a, 0x40, 0x30, 0xd1, 0x53, 0xb5, 0xd4, 0x0a, 0x50, 0x6c, 0xf6, 0x74, 0xb0, 0x4b, 0x46, 0x7f, 0x00, 0xe0, 0x5f, 0xa2, 0xcd, 0x32, 0x8c, 0x2a,
+  0x8b, 0x2a, 0x6b, 0x22, 0x6b, 0x2a, 0x38, 0x4a, 0x03, 0xd8, 0x46, 0x12, 0x4b, 0x12, 0x07, 0x02, 0xc8, 0x3f, 0x20, 0x77, 0x8d, 0xe2, 0x1f, 0x00, 0x9c, 0x03, 0x24, 0xf5, 0x7c, 0x1a, 0x2e, 0x02,
+  0x46, 0x15, 0x00, 0x6c, 0x51, 0x00, 0x26, 0x3c, 0x00, 0x40, 0x71, 0x40, 0xed, 0x3a, 0xcd, 0x3a, 0xee, 0x38, 0x00, 0x78, 0x51, 0x22, 0x90, 0x53, 0xc2, 0x6d, 0x00, 0xc6, 0x2a, 0x00, 0xbc, 0x31,
+  0x00, 0x56, 0x35, 0x02, 0xf0, 0x06, 0x00, 0x08, 0x2e, 0x12, 0xd1, 0xce, 0x1f, 0x01, 0xc8, 0x0a, 0x00, 0xdc, 0x18, 0x00, 0x4a, 0x15, 0x11, 0xb4, 0x20, 0x0e, 0x00, 0xee, 0x18, 0x00, 0x0a, 0x00,
+  0x40, 0xd1, 0x63, 0x32, 0x6c, 0x5e, 0x3c, 0x40, 0x77, 0x95, 0xf5, 0x84, 0x3c, 0x07, 0x00, 0x38, 0x83, 0x11, 0x52, 0x56, 0x35, 0x00, 0x88, 0x03, 0x02, 0xe8, 0x18, 0x35, 0x32, 0x6c, 0xb4, 0x5e,
+  0x35, 0x04, 0x0a, 0x20, 0x12, 0x11, 0x2e, 0x07, 0x20, 0x84, 0x52, 0xa2, 0x0a, 0xb0, 0x95, 0xb8, 0xad, 0x36, 0x9d, 0x77, 0xa5, 0x97, 0xad, 0xd4, 0x94, 0xba, 0x2a, 0x00, 0xe6, 0x18, 0x00, 0x02,
+  0x00, 0xe0, 0xf8, 0xbd, 0xb8, 0xb5, 0xd8, 0xb5, 0x35, 0xa5, 0xb7, 0xb5, 0x19, 0xbe, 0x35, 0x9d, 0xca, 0x11, 0x30, 0x93, 0x8c, 0xd4, 0x8c, 0x03, 0x43, 0x8c, 0xb5, 0x94, 0xd5, 0x90, 0x03, 0x20,
+  0xb3, 0x9c, 0x94, 0x03, 0x11, 0x91, 0x24, 0x07, 0x15, 0xb1, 0x5c, 0x15, 0x00, 0xf6, 0x4a, 0x04, 0x1e, 0x52, 0x20, 0x53, 0xb5, 0xf2, 0x18, 0xc0, 0xb5, 0xc5, 0x12, 0xb5, 0x90, 0xa4, 0x94, 0xc5,
+  0x74, 0xbd, 0xd5, 0xcd, 0x10, 0x20, 0x11, 0x91, 0x98, 0x62, 0x01, 0x18, 0x5f, 0x01, 0xfa, 0x0d, 0x02, 0xe6, 0x1b, 0x02, 0x48, 0x5b, 0x00, 0x12, 0x02, 0x02, 0x84, 0x96, 0x00, 0x40, 0x2e, 0x02,
+  0x3a, 0x2e, 0x11, 0xb6, 0xce, 0x11, 0x00, 0x22, 0x2e, 0x02, 0x84, 0x31, 0x00, 0x06, 0x03, 0x11, 0x71, 0x90, 0x5b, 0x13, 0xb1, 0xe4, 0x37, 0x02, 0xf8, 0x3f, 0x00, 0x14, 0x93, 0x43, 0xee, 0x1a,
+  0x30, 0x2b, 0xda, 0x42, 0x12, 0x33, 0x44, 0x27, 0x02, 0xa6, 0x35, 0x42, 0x17, 0x6d, 0x75, 0x54, 0x78, 0x58, 0x00, 0xfe, 0x06, 0x10, 0x33, 0x18, 0x1c, 0x12, 0x43, 0x30, 0x93, 0x00, 0xee, 0x09,
+  0x11, 0xb2, 0x14, 0x11, 0x01, 0x0e, 0x00, 0x03, 0xc4, 0x38, 0x42, 0xef, 0x1a, 0xee, 0x1a, 0x92, 0x26, 0x00, 0x48, 0x35, 0x64, 0xef, 0x22, 0x8d, 0x0a, 0xae, 0x12, 0x8c, 0x0a, 0x00, 0xc8, 0x2e,
+  0x00, 0x44, 0x03, 0x02, 0x44, 0x40, 0x02, 0xf8, 0x62, 0x22, 0xd6, 0x64, 0x14, 0x23, 0x00, 0xb4, 0x00, 0x01, 0xea, 0x0e, 0x03, 0xb2, 0x38, 0x02, 0x9e, 0x0e, 0x11, 0x74, 0x68, 0x2b, 0x00, 0x32,
+  0x00, 0x00, 0x64, 0x07, 0x02, 0xb4, 0x11, 0x04, 0x42, 0x35, 0x11, 0xb1, 0x04, 0x47, 0x02, 0x22, 0x63, 0x11, 0x74, 0x86, 0x0a, 0x00, 0xc8, 0x70, 0x41, 0x2b, 0x02, 0x6c, 0x12, 0x02, 0x35, 0x00,
+  0xe6, 0x26, 0x12, 0x12, 0xfc, 0x70, 0x83, 0xd1, 0x3b, 0x2f, 0x2b, 0x6c, 0x0a, 0xee, 0x1a, 0x36, 0x43, 0x10, 0x2b, 0xcc, 0x06, 0x60, 0x4c, 0x0a, 0xa9, 0x01, 0x4c, 0x0a, 0xa4, 0x3f, 0x20, 0x6c,
+  0x0a, 0xcc, 0x11, 0x20, 0xcd, 0x1a, 0xd8, 0x4d, 0xf2, 0x01, 0x8c, 0x12, 0x0e, 0x2b, 0x4f, 0x33, 0xcd, 0x1a, 0x6c, 0x12, 0x0e, 0x23, 0xce, 0x22, 0xcd, 0x22, 0x2e, 0x07, 0x00, 0x9e, 0x0a, 0x00,
+  0xb2, 0x07, 0x00, 0xe2, 0x0a, 0x00, 0x62, 0x23, 0x02, 0x0c, 0x59, 0x11, 0x74, 0x64, 0x4a, 0x02, 0x0e, 0x39, 0x00, 0x66, 0x07, 0x02, 0x58, 0x63, 0x00, 0xda, 0x1b, 0x00, 0x6e, 0x3f, 0x02, 0xde,
+  0x70, 0x70, 0xd5, 0x6c, 0xb5, 0x64, 0xb1, 0x43, 0x2f, 0x88, 0x38, 0x00, 0x32, 0x27, 0x00, 0x3c, 0x1c, 0x21, 0x43, 0x4f, 0x60, 0x2a, 0x01, 0x12, 0x5c, 0x21, 0x32, 0x0e, 0xd8, 0x5f, 0x11, 0x90,
+  0x14, 0x78, 0x00, 0x8a, 0x03, 0x00, 0xd8, 0x0d, 0x21, 0xf2, 0x53, 0xd2, 0x18, 0x01, 0x4a, 0x03, 0x02, 0x66, 0x6a, 0x01, 0xa4, 0x58, 0x01, 0x7c, 0x03, 0x00, 0xa6, 0x0a, 0x03, 0x20, 0x83, 0x22,
+  0x5c, 0x70, 0x14, 0x24, 0x00, 0xae, 0x07, 0x30, 0x4b, 0xd2, 0x4b, 0x22, 0x0b, 0x20, 0xd1, 0x53, 0xe4, 0x06, 0x20, 0x70, 0x43, 0x3c, 0x00, 0x11, 0x2f, 0x62, 0x7f, 0x02, 0x90, 0x51, 0x20, 0x74,
+  0x64, 0x20, 0x07, 0x00, 0x06, 0x63, 0x60, 0x94, 0x6c, 0x36, 0x85, 0xf5, 0x74, 0xca, 0x11, 0x00, 0x74, 0x51, 0x11, 0x11, 0x3c, 0x2e, 0x00, 0x78, 0x1c, 0x00, 0x02, 0x5c, 0xa0, 0xd4, 0x74, 0x53,
+  0x6c, 0xf5, 0x7c, 0x12, 0x5c, 0x0e, 0x3b, 0x6a, 0x1c, 0x02, 0x4e, 0x7f, 0x02, 0xf0, 0x89, 0x00, 0x32, 0x0e, 0x11, 0xd1, 0xda, 0x38, 0x13, 0x11, 0x2e, 0x55, 0x20, 0x53, 0x6c, 0x34, 0x0e, 0x00,
+  0xa8, 0x31, 0x00, 0x16, 0x27, 0x00, 0x56, 0x1c, 0x11, 0xd4, 0x30, 0x0e, 0x20, 0x16, 0x85, 0xb4, 0x3f, 0x01, 0xf8, 0x3f, 0x50, 0x7c, 0x93, 0x74, 0x90, 0x5b, 0xdc, 0x18, 0x10, 0x93, 0x68, 0x2a,
+  0x01, 0x6a, 0x71, 0x00, 0x00, 0x7c, 0x00, 0x12, 0x00, 0x04, 0x84, 0x7f, 0x20, 0xd4, 0x7c, 0x84, 0x15, 0x10, 0xb4, 0x66, 0x03, 0x01, 0x24, 0x00, 0x20, 0x94, 0x7c, 0xc2, 0x43, 0x01, 0xce, 0x0a,
+  0x10, 0x7c, 0x1c, 0x27, 0x00, 0xae, 0x03, 0x00, 0x0c, 0x07, 0x60, 0xf4, 0x84, 0xb3, 0x7c, 0xf1, 0x6b, 0x96, 0x03, 0x20, 0x8f, 0x5b, 0x22, 0x27, 0x10, 0x11, 0x68, 0x15, 0x00, 0x06, 0x00, 0xf0,
+  0x01, 0x84, 0xf1, 0x73, 0x8f, 0x63, 0xf1, 0x73, 0x56, 0x9d, 0xd8, 0xad, 0x19, 0xb6, 0xd8, 0xad, 0x93, 0x78, 0x23, 0x90, 0x84, 0x72, 0x84, 0xf1, 0x73, 0xf5, 0x94, 0x76, 0xa5, 0xda, 0x18, 0xe0,
+  0x7b, 0xce, 0x5a, 0xc6, 0x39, 0xc6, 0x15, 0x9d, 0x39, 0xbe, 0x9b, 0xce, 0xdc, 0xd6, 0x5a, 0x15, 0x02, 0x14, 0x20, 0x60, 0xb5, 0x94, 0xb5, 0x8c, 0xd5, 0x94, 0xf0, 0x31, 0x95, 0xd5, 0x9c, 0xb4,
+  0x9c, 0x93, 0x94, 0x92, 0x9c, 0xb3, 0xf0, 0x4a, 0x24, 0xf2, 0xac, 0x3c, 0x27, 0x02, 0x68, 0x15, 0x15, 0xf1, 0xac, 0x23, 0x11, 0x74, 0x88, 0x1c, 0x20, 0xd5, 0xcd, 0x9e, 0x23, 0x00, 0xaa, 0x23,
+  0x11, 0x50, 0xce, 0x1b, 0x11, 0x50, 0xf2, 0x1b, 0x00, 0xcc, 0x02, 0x01, 0x0a, 0x07, 0x01, 0x6c, 0x51, 0x00, 0x8e, 0x29, 0x00, 0xe4, 0x02, 0x02, 0xb4, 0x46, 0x11, 0xf3, 0xd4, 0x02, 0x00, 0x3c,
+  0x03, 0x13, 0xf2, 0x86, 0x06, 0x11, 0x95, 0x74, 0x15, 0x00, 0xa8, 0x51, 0x31, 0xb6, 0x5c, 0xf6, 0x62, 0x29, 0x20, 0x17, 0x6d, 0x0a, 0x39, 0x13, 0x74, 0x90, 0x11, 0x00, 0xf0, 0x06, 0x02, 0x10,
+  0x43, 0x20, 0x95, 0x5c, 0x70, 0x18, 0x02, 0x8c, 0x0e, 0x00, 0x60, 0x00, 0x00, 0x42, 0x38, 0x62, 0xd6, 0x64, 0x74, 0x54, 0xf3, 0x43, 0xb6, 0x69, 0x00, 0x96, 0x03, 0x02, 0xc0, 0x62, 0x00, 0x86,
+  0x9d, 0x00, 0x20, 0x0a, 0x01, 0xcc, 0x35, 0x01, 0xb8, 0x62, 0x11, 0x54, 0xec, 0x35, 0x00, 0xe8, 0x4a, 0x00, 0x86, 0x38, 0x00, 0x10, 0x55, 0x02, 0x08, 0x4b, 0x02, 0x72, 0x5f, 0x20, 0x95, 0x5c,
+  0xf8, 0x35, 0x00, 0x62, 0x03, 0x01, 0xf6, 0x62, 0x01, 0x5e, 0x4a, 0x11, 0xd2, 0x56, 0x0a, 0x11, 0x74, 0x40, 0x51, 0x00, 0x28, 0x00, 0x00, 0xca, 0x0e, 0x00, 0x9a, 0x03, 0x11, 0x33, 0x06, 0x0f,
+  0x01, 0x04, 0x40, 0x01, 0x9c, 0x1f, 0x02, 0xa0, 0x4a, 0x20, 0x54, 0x54, 0x06, 0x5c, 0x02, 0x2a, 0x5c, 0x02, 0x4e, 0x35, 0x00, 0x16, 0x00, 0x13, 0xd1, 0x44, 0x82, 0xa2, 0x74, 0x54, 0xf5, 0x64,
+  0x53, 0x54, 0xb5, 0x64, 0x16, 0x6d, 0x4c, 0x51, 0x04, 0x32, 0x43, 0x15, 0x13, 0x12, 0x4e, 0x02, 0x02, 0x00, 0x00, 0xce, 0x02, 0x11, 0x94, 0x96, 0x18, 0x00, 0x1a, 0x35, 0x00, 0x1a, 0x63, 0x00,
+  0x42, 0x35, 0x40, 0xed, 0x22, 0x0e, 0x2b, 0x3a, 0x15, 0x33, 0xd5, 0x64, 0x33, 0xe8, 0x66, 0x00, 0x1c, 0x13, 0x00, 0x22, 0x07, 0x13, 0x74, 0x14, 0x20, 0x00, 0x54, 0x00, 0x02, 0x48, 0x07, 0x03,
+  0x88, 0x6a, 0x01, 0xf6, 0x11, 0x22, 0x50, 0x33, 0xf8, 0x77, 0x00, 0xbc, 0x5f, 0x00, 0xc4, 0x06, 0x20, 0x73, 0x5c, 0x68, 0x11, 0x02, 0xfe, 0x1b, 0x24, 0x6f, 0x3b, 0xe0, 0x58, 0x20, 0xf1, 0x4b,
+  0x32, 0x27, 0x00, 0xaa, 0x58, 0x13, 0xf1, 0x52, 0x51, 0x11, 0xd1, 0xfa, 0x62, 0x00, 0xec, 0x4d, 0x00, 0xf4, 0x3b, 0x00, 0x32, 0x0e, 0x00, 0x8e, 0x74, 0x40, 0x4f, 0x3b, 0x94, 0x64, 0x64, 0x66,
+  0x01, 0xfc, 0x0d, 0x01, 0xb8, 0x66, 0x11, 0x6f, 0x08, 0x0e, 0x00, 0xa2, 0x3f, 0x00, 0x92, 0x38, 0x00, 0xee, 0x03, 0x00, 0x16, 0x27, 0x00, 0xc4, 0x2a, 0x02, 0x6c, 0x86, 0x42, 0x16, 0x75, 0x33,
+  0x5c, 0x08, 0x47, 0x60, 0x13, 0x5c, 0xd1, 0x53, 0x2f, 0x43, 0xd4, 0x03, 0x42, 0x2f, 0x3b, 0xad, 0x2a, 0xac, 0x11, 0x11, 0xd1, 0xe0, 0x66, 0x02, 0x24, 0x2e, 0x00, 0x4e, 0x00, 0x00, 0xf0, 0x46,
+  0x00, 0x5e, 0x58, 0x00, 0x42, 0x23, 0x00, 0x58, 0x2a, 0x11, 0xd1, 0xda, 0x2d, 0x00, 0xda, 0x38, 0x02, 0x70, 0x4a, 0x00, 0x2e, 0x15, 0x00, 0x20, 0x0e, 0x00, 0xd8, 0x3f, 0x11, 0x94, 0x3a, 0x3c,
+  0x02, 0xd4, 0x4d, 0x00, 0x5c, 0x1c, 0x13, 0x93, 0x4a, 0x43, 0x00, 0x6a, 0x3c, 0x01, 0xfa, 0x2d, 0x00, 0xdc, 0x0a, 0x30, 0x64, 0xd0, 0x5b, 0xea, 0x26, 0x00, 0x72, 0x4a, 0x00, 0x0a, 0x00, 0x00,
+  0xd4, 0x46, 0x31, 0x12, 0x64, 0x53, 0xfc, 0x06, 0x00, 0xec, 0x11, 0x11, 0xf1, 0x50, 0x3c, 0x10, 0x93, 0x40, 0x03, 0x00, 0xc0, 0x8d, 0x10, 0x64, 0xbe, 0x11, 0x31, 0x94, 0x7c, 0x53, 0xf2, 0x18,
+  0x00, 0x74, 0x03, 0x00, 0x28, 0x0e, 0x11, 0x52, 0x10, 0x07, 0x20, 0x93, 0x74, 0xf4, 0x3f, 0x00, 0xc0, 0x2a, 0x20, 0xd4, 0x84, 0xa2, 0x03, 0x01, 0x2e, 0x2e, 0x01, 0xb2, 0x2a, 0x31, 0x32, 0x74,
+  0x72, 0x9c, 0x23, 0x20, 0xb3, 0x7c, 0x20, 0x07, 0x00, 0xaa, 0x6a, 0x00, 0xee, 0x38, 0x42, 0xb0, 0x63, 0x11, 0x74, 0x02, 0x00, 0x80, 0x93, 0x8c, 0x31, 0x7c, 0x11, 0x7c, 0x52, 0x7c, 0x40, 0x75,
+  0x20, 0x15, 0x95, 0x90, 0x0a, 0x00, 0xbe, 0x2a, 0x20, 0x5a, 0xc6, 0xda, 0x31, 0x00, 0x1c, 0x07, 0xd0, 0x9b, 0xce, 0x7a, 0xc6, 0x19, 0xbe, 0xf5, 0x9c, 0x11, 0x7c, 0x73, 0x8c, 0xb3, 0x08, 0x20,
+  0x01, 0x30, 0x40, 0x00, 0x8e, 0x03, 0x00, 0x02, 0x00, 0x71, 0x73, 0x8c, 0x52, 0x8c, 0x72, 0x94, 0x92, 0x42, 0x0e, 0x05, 0xd2, 0x11, 0x10, 0xa4, 0xd0, 0x11, 0x04, 0x12, 0x20, 0x00, 0x00, 0x4b,
+  0x11, 0x12, 0xd2, 0x11, 0x51, 0x12, 0xb5, 0x94, 0xc5, 0xd5, 0xf6, 0x18, 0x20, 0x70, 0x9c, 0xfa, 0x51, 0x02, 0xa2, 0x31, 0x02, 0x2c, 0x15, 0x02, 0x5e, 0x06, 0x20, 0xb6, 0x5c, 0x50, 0x03, 0x02,
+  0xa2, 0x45, 0x00, 0x62, 0x0d, 0x13, 0xb2, 0x4c, 0x11, 0x20, 0x54, 0x4c, 0xf8, 0x4d, 0x11, 0xd6, 0x6c, 0x03, 0x02, 0xb6, 0x14, 0x02, 0xa4, 0x2a, 0x00, 0x24, 0x00, 0x11, 0x54, 0x1c, 0x58, 0x13,
+  0x74, 0x86, 0x46, 0x02, 0x0c, 0x35, 0x01, 0x1c, 0x2e, 0x12, 0x3b, 0xb6, 0x8f, 0x01, 0x8c, 0x37, 0x01, 0xa8, 0x1b, 0x00, 0x72, 0x1b, 0x22, 0x0f, 0x23, 0x02, 0x06, 0x11, 0x70, 0x9c, 0x06, 0x02,
+  0xb8, 0x70, 0x00, 0x9e, 0x1b, 0x01, 0x02, 0x0e, 0x21, 0x3b, 0x54, 0x16, 0x0a, 0x02, 0x3a, 0x07, 0x00, 0x3a, 0x03, 0x00, 0xfc, 0x69, 0x02, 0xcc, 0x14, 0x00, 0x98, 0x85, 0x00, 0x10, 0x5c, 0x00,
+  0x1c, 0x00, 0x02, 0xea, 0x0d, 0x04, 0x0c, 0x6a, 0x02, 0x78, 0x0d, 0x02, 0x7a, 0x11, 0x00, 0x01, 0x00, 0x00, 0xf8, 0x4d, 0x13, 0x95, 0x88, 0x38, 0x00, 0x1c, 0x18, 0x00, 0xb6, 0x0d, 0x02, 0x5c,
+  0x19, 0x00, 0xcc, 0x00, 0x02, 0x08, 0x4e, 0x00, 0x30, 0x0a, 0x11, 0x94, 0x9e, 0x69, 0x02, 0x18, 0x03, 0x50, 0x32, 0x4c, 0x53, 0x54, 0x53, 0x64, 0x70, 0x50, 0x54, 0x53, 0x54, 0xf1, 0x43, 0x40,
+  0x03, 0x01, 0xea, 0x54, 0x41, 0x3b, 0x6f, 0x33, 0xb0, 0x9c, 0x11, 0x35, 0xf2, 0x4b, 0xf1, 0xa8, 0x03, 0x02, 0xd2, 0x54, 0x02, 0xa8, 0x5f, 0x00, 0x1a, 0x0e, 0x02, 0x84, 0x15, 0x02, 0x06, 0x40,
+  0x00, 0xb2, 0x38, 0x00, 0xe4, 0x2a, 0xe0, 0xed, 0x22, 0xcd, 0x1a, 0xcd, 0x22, 0xcd, 0x1a, 0x4c, 0x0a, 0x6c, 0x0a, 0xad, 0x1a, 0xd8, 0x26, 0x20, 0xad, 0x1a, 0x62, 0x07, 0x40, 0xcd, 0x1a, 0x4b,
+  0x0a, 0x20, 0x00, 0x51, 0x2e, 0x2b, 0xac, 0x1a, 0xcd, 0x12, 0x00, 0x22, 0xb1, 0x43, 0xf2, 0x6d, 0x02, 0xac, 0x2a, 0x20, 0x4f, 0x33, 0x6e, 0x00, 0x40, 0x8c, 0x1a, 0x6c, 0x12, 0xaa, 0x4a, 0x20,
+  0xcd, 0x22, 0x76, 0x03, 0x00, 0xfa, 0x22, 0x00, 0x38, 0x1c, 0x00, 0x20, 0x27, 0x80, 0x6c, 0x12, 0x0a, 0x02, 0x6b, 0x12, 0xcd, 0x22, 0xcc, 0x38, 0x81, 0xed, 0x2a, 0x90, 0x43, 0xcc, 0x22, 0xed,
+  0x2a, 0xba, 0x70, 0x10, 0x64, 0xb4, 0x0a, 0x00, 0xb4, 0x74, 0x00, 0xca, 0x11, 0x20, 0x8c, 0x1a, 0x72, 0x78, 0x02, 0xfa, 0x34, 0x50, 0xf2, 0x53, 0x6f, 0x43, 0xb1, 0xa2, 0x26, 0x01, 0x12, 0x15,
+  0x02, 0x46, 0x9b, 0x22, 0x6f, 0x43, 0x8a, 0x66, 0x00, 0x52, 0x3c, 0x00, 0xac, 0x03, 0x00, 0xde, 0x0a, 0x02, 0x02, 0x12, 0x11, 0x0f, 0x0a, 0x20, 0x00, 0xaa, 0x03, 0x10, 0x70, 0x42, 0x20, 0x70,
+  0x5b, 0x95, 0x6c, 0xd1, 0x53, 0xf2, 0x5b, 0x4e, 0x5c, 0x02, 0x78, 0x8d, 0x00, 0xf2, 0x1f, 0x11, 0x90, 0x96, 0x23, 0x00, 0xca, 0x5f, 0x00, 0xec, 0x3f, 0x00, 0xa2, 0x66, 0x11, 0x53, 0x7c, 0x03,
+  0x20, 0xcd, 0x32, 0xca, 0x74, 0x00, 0xfc, 0x06, 0x00, 0x68, 0x1c, 0x02, 0x4a, 0x3c, 0x00, 0x14, 0x07, 0x00, 0xaa, 0x3f, 0x00, 0x38, 0x6a, 0x10, 0xd1, 0x34, 0x35, 0x00, 0x02, 0x27, 0x90, 0x6c,
+  0x94, 0x74, 0x15, 0x85, 0x36, 0x85, 0x77, 0x8d, 0x0e, 0x00, 0x00, 0xf8, 0x2d, 0x20, 0x94, 0x74, 0x02, 0x27, 0x13, 0xd1, 0x40, 0x03, 0x11, 0x93, 0x4a, 0x0e, 0x00, 0x6c, 0x03, 0x00, 0xd8, 0x11,
+  0x00, 0x9a, 0x0a, 0x00, 0x90, 0x03, 0x02, 0x4e, 0x03, 0x00, 0x9a, 0x11, 0x60, 0x53, 0x74, 0x6f, 0x53, 0xd1, 0x63, 0x82, 0x03, 0x11, 0x12, 0xf4, 0x1f, 0x02, 0x6a, 0x1c, 0x11, 0x73, 0x2c, 0x00,
+  0x00, 0xb6, 0x11, 0x02, 0xf6, 0x18, 0x11, 0x94, 0x26, 0x07, 0x04, 0xd0, 0x2a, 0x20, 0xb0, 0x5b, 0xf8, 0x11, 0x00, 0x5a, 0x0e, 0x80, 0x35, 0x8d, 0xb3, 0x7c, 0xaf, 0x63, 0x72, 0x74, 0x66, 0x35,
+  0x40, 0x72, 0x7c, 0x52, 0x7c, 0x2c, 0x0e, 0x00, 0x1c, 0x07, 0x31, 0xb4, 0x84, 0xb3, 0xaa, 0x0a, 0xd1, 0x52, 0x84, 0x93, 0x84, 0x15, 0x95, 0xf8, 0xb5, 0xf8, 0xb5, 0x76, 0xa5, 0xf4, 0x4c, 0x35,
+  0x00, 0x8e, 0x03, 0x60, 0x19, 0xbe, 0x5a, 0xc6, 0x19, 0xbe, 0xe8, 0x18, 0x60, 0x35, 0x9d, 0xd4, 0x94, 0x73, 0x84, 0xd8, 0x31, 0x02, 0x70, 0x35, 0x00, 0x8a, 0x03, 0x50, 0xb5, 0x8c, 0xb5, 0x8c,
+  0xd5, 0x98, 0x03, 0x01, 0x7a, 0x35, 0x13, 0xb3, 0x3e, 0x0e, 0x04, 0x52, 0x47, 0x00, 0x96, 0x03, 0x00, 0x5e, 0x15, 0x00, 0x40, 0x0e, 0x02, 0x4a, 0x0e, 0x02, 0x9a, 0x03, 0x04, 0x88, 0x1c, 0x00,
+  0xac, 0x0a, 0x00, 0xae, 0x0a, 0x40, 0x33, 0xb5, 0x54, 0x4c, 0xb0, 0x14, 0x02, 0x7c, 0x0a, 0x02, 0x12, 0x40, 0x01, 0x6a, 0x11, 0x23, 0x4b, 0x33, 0x50, 0x46, 0x00, 0x7a, 0x69, 0x20, 0x17, 0x6d,
+  0xba, 0x0a, 0x02, 0x56, 0x4d, 0x20, 0xee, 0x1a, 0xba, 0x50, 0x02, 0x8e, 0x26, 0x20, 0x8c, 0x02, 0x0c, 0x00, 0x90, 0xac, 0x0a, 0x8c, 0x0a, 0xcd, 0x1a, 0x0e, 0x1b, 0xad, 0xf8, 0x37, 0x30, 0x12,
+  0xce, 0x12, 0xa0, 0x3f, 0x00, 0x74, 0x4d, 0x20, 0xed, 0x1a, 0x82, 0x1b, 0x24, 0x4f, 0x2b, 0x0e, 0x5f, 0x22, 0x12, 0x4c, 0x9e, 0x11, 0x00, 0x3a, 0x0d, 0x11, 0xd6, 0x1e, 0x0d, 0x11, 0x33, 0x38,
+  0x8c, 0x62, 0xf6, 0x6c, 0x37, 0x75, 0x37, 0x6d, 0x12, 0x00, 0x02, 0xae, 0x1f, 0x22, 0x13, 0x4c, 0x82, 0x03, 0x31, 0xee, 0x22, 0x91, 0xee, 0x0a, 0x00, 0x06, 0x23, 0x11, 0x50, 0x66, 0x51, 0x51,
+  0x50, 0x2b, 0x8d, 0x0a, 0x2f, 0xba, 0x11, 0x00, 0x0a, 0x4b, 0x00, 0x06, 0x00, 0x10, 0x50, 0x44, 0x32, 0x01, 0xf0, 0x77, 0xc0, 0x12, 0x44, 0xf1, 0x3b, 0x4f, 0x2b, 0xd1, 0x3b, 0xf1, 0x43, 0x32,
+  0x4c, 0x18, 0x66, 0x11, 0x2f, 0x78, 0x46, 0x00, 0x10, 0x63, 0x00, 0x84, 0x66, 0x20, 0xf6, 0x6c, 0x96, 0x06, 0x02, 0x50, 0x6a, 0x00, 0x14, 0x5c, 0xf1, 0x1c, 0xb0, 0x3b, 0x90, 0x33, 0x2e, 0x2b,
+  0x2e, 0x2b, 0xed, 0x22, 0xac, 0x1a, 0x09, 0x02, 0x09, 0x02, 0x2a, 0x02, 0xe9, 0x01, 0x4a, 0x02, 0xac, 0x12, 0xcc, 0x1a, 0xac, 0x1a, 0xac, 0x1a, 0xcc, 0x1a, 0x0d, 0x2b, 0x0d, 0x23, 0x2e, 0x2b,
+  0x0d, 0x2b, 0x8f, 0x3b, 0x4e, 0x0a, 0x00, 0x80, 0x4f, 0x33, 0xac, 0x12, 0x6b, 0x0a, 0x6b, 0x0a, 0x44, 0x03, 0x42, 0xcd, 0x1a, 0xac, 0x12, 0x9c, 0x11, 0x10, 0x4f, 0xfe, 0x7e, 0x01, 0x86, 0x03,
+  0x00, 0x9a, 0x18, 0x02, 0xf0, 0x6d, 0x13, 0xf2, 0xe8, 0x2a, 0x20, 0x8c, 0x12, 0xb2, 0x0a, 0x00, 0x0a, 0x00, 0x02, 0xf4, 0x5f, 0x20, 0x70, 0x33, 0xee, 0x46, 0x01, 0xb2, 0x1f, 0x01, 0xa2, 0x1c,
+  0x00, 0x58, 0x51, 0x60, 0xed, 0x22, 0x4b, 0x0a, 0x4b, 0x0a, 0x2a, 0x00, 0x40, 0x8d, 0x1a, 0xcd, 0x22, 0x34, 0x2e, 0x00, 0x84, 0x03, 0x11, 0xd1, 0x5e, 0x2a, 0x02, 0x48, 0x2e, 0x00, 0xe0, 0x0a,
+  0x40, 0x90, 0x43, 0x74, 0x5c, 0x4a, 0x1c, 0x02, 0x9c, 0x2a, 0x00, 0x50, 0x6e, 0x00, 0xca, 0x5f, 0x20, 0x6f, 0x3b, 0xfe, 0x7b, 0x00, 0x8e, 0x03, 0x50, 0x6b, 0x1a, 0xed, 0x2a, 0x6f, 0xec, 0x11,
+  0x12, 0x2a, 0x56, 0x71, 0x11, 0x2e, 0x02, 0x4e, 0x00, 0x10, 0x00, 0x60, 0x0e, 0x33, 0xed, 0x2a, 0xed, 0x32, 0xee, 0x69, 0x10, 0xb1, 0x6e, 0x86, 0x01, 0x5a, 0x71, 0x00, 0x9e, 0x11, 0x02, 0xc0,
+  0x7b, 0x14, 0x53, 0x4e, 0x78, 0x61, 0x5c, 0xb5, 0x6c, 0x94, 0x6c, 0x33, 0x48, 0x5c, 0x00, 0xe6, 0x0a, 0x13, 0x54, 0x88, 0x6a, 0x10, 0x53, 0xd0, 0x0a, 0x20, 0x64, 0x91, 0x96, 0x0e, 0x41, 0x6c,
+  0xb1, 0x53, 0x70, 0xb6, 0x18, 0x22, 0x12, 0x5c, 0x1c, 0x4e, 0x11, 0xf2, 0x6a, 0x86, 0x02, 0x6e, 0x1c, 0x00, 0x98, 0x58, 0x33, 0x16, 0x7d, 0x32, 0x6a, 0x31, 0x00, 0x1a, 0x5c, 0x01, 0x50, 0x86,
+  0x41, 0x53, 0x12, 0x64, 0x90, 0x06, 0x5c, 0x00, 0x32, 0x07, 0x00, 0x8c, 0x18, 0x11, 0x8f, 0x66, 0x3c, 0x20, 0x4f, 0x4b, 0x26, 0x4e, 0x00, 0x90, 0x38, 0x80, 0x2e, 0x43, 0xed, 0x3a, 0x4f, 0x4b,
+  0xb0, 0x5b, 0x86, 0x03, 0x40, 0xcc, 0x3a, 0xed, 0x3a, 0x0c, 0x07, 0x00, 0xa8, 0x18, 0x22, 0x32, 0x64, 0x38, 0x07, 0x00, 0xbc, 0x0a, 0x00, 0x1c, 0x00, 0x02, 0x30, 0x15, 0x11, 0x32, 0xd4, 0x18,
+  0x00, 0xd2, 0x1f, 0x11, 0x53, 0x1e, 0x0e, 0x00, 0x98, 0x0a, 0x01, 0x0a, 0x19, 0x12, 0x74, 0x18, 0x07, 0x11, 0x73, 0x36, 0x0e, 0x20, 0x8f, 0x5b, 0x36, 0x0e, 0x30, 0xb4, 0x7c, 0x12, 0xbe, 0x2a,
+  0x01, 0xa6, 0x0a, 0x40, 0x56, 0x8d, 0x73, 0x74, 0x44, 0x07, 0x40, 0x15, 0x8d, 0xd4, 0x84, 0x0a, 0x20, 0x00, 0x7a, 0x23, 0x00, 0x64, 0x35, 0x00, 0xb2, 0x71, 0x00, 0x44, 0x2e, 0x80, 0xf4, 0x8c,
+  0xb3, 0x84, 0xb3, 0x84, 0x93, 0x84, 0x98, 0x03, 0x01, 0x32, 0x67, 0x10, 0x94, 0x94, 0x03, 0x20, 0x93, 0x8c, 0xae, 0x4a, 0x00, 0x72, 0x03, 0x60, 0x76, 0xa5, 0x77, 0xad, 0x7a, 0xc6, 0xb8, 0x11,
+  0x00, 0x54, 0x15, 0x11, 0xb4, 0x16, 0x00, 0x22, 0x73, 0x84, 0xbc, 0x11, 0x00, 0x8a, 0x03, 0x00, 0x1e, 0x07, 0x62, 0xf5, 0x94, 0xb5, 0x8c, 0xb4, 0x8c, 0x1e, 0x07, 0x20, 0x93, 0x94, 0xac, 0x0a,
+  0x00, 0x14, 0x20, 0x32, 0x91, 0xa4, 0x91, 0x90, 0x03, 0x12, 0xa4, 0xec, 0x18, 0x11, 0xd1, 0x68, 0x15, 0x02, 0xb6, 0x23, 0x01, 0xb0, 0x0a, 0x03, 0xe6, 0x4a, 0x60, 0x94, 0xc5, 0x12, 0xb5, 0xf6,
+  0xcd, 0xd6, 0x11, 0x24, 0xd1, 0xac, 0x6a, 0x51, 0x00, 0x44, 0x26, 0x30, 0xd6, 0x64, 0x54, 0xf6, 0x21, 0x01, 0x3c, 0x0a, 0x11, 0x54, 0x04, 0x34, 0x00, 0x30, 0x14, 0x11, 0x91, 0xe8, 0x30, 0x11,
+  0x8d, 0x56, 0x1f, 0x01, 0xe4, 0x1e, 0x00, 0x14, 0x2a, 0xa0, 0x12, 0xac, 0x0a, 0xcd, 0x12, 0x0e, 0x1b, 0xee, 0x1a, 0xed, 0x84, 0x46, 0x01, 0x52, 0x0d, 0x07, 0x78, 0x85, 0x01, 0x34, 0x43, 0x40,
+  0x2e, 0x23, 0x0e, 0x23, 0x04, 0x00, 0x11, 0x0f, 0xb4, 0x02, 0x04, 0x64, 0x7e, 0x02, 0xb4, 0x10, 0x00, 0x44, 0x06, 0x11, 0x0f, 0xa6, 0x03, 0x10, 0x2f, 0x02, 0x89, 0x03, 0x3e, 0x46, 0x00, 0xda,
+  0x37, 0x00, 0x92, 0x3b, 0x00, 0x10, 0x00, 0x04, 0x40, 0x07, 0x02, 0xda, 0x22, 0x00, 0x70, 0x11, 0x01, 0x7a, 0x3c, 0x03, 0xbe, 0x5b, 0x22, 0x33, 0x4c, 0x94, 0x58, 0x02, 0x16, 0x19, 0x02, 0x4a,
+  0x1c, 0xf0, 0x10, 0xb0, 0x3b, 0x11, 0x44, 0x12, 0x44, 0x6f, 0x2b, 0xcc, 0x12, 0xac, 0x12, 0xed, 0x1a, 0x2e, 0x2b, 0x8f, 0x33, 0x4f, 0x2b, 0xcd, 0x1a, 0x4e, 0x2b, 0xed, 0x22, 0xed, 0x22, 0x2e,
+  0x2b, 0x6f, 0xf6, 0x81, 0xb0, 0x2b, 0xcd, 0x1a, 0xed, 0x22, 0xed, 0x1a, 0xed, 0x22, 0xcc, 0x1a, 0x5c, 0x03, 0x10, 0x8b, 0x04, 0x00, 0x50, 0x12, 0xab, 0x1a, 0xec, 0x22, 0x06, 0x00, 0x11, 0xcc,
+  0x88, 0x03, 0x31, 0xec, 0x22, 0xec, 0x8c, 0x03, 0x40, 0x4e, 0x33, 0x4e, 0x2b, 0x96, 0x03, 0x00, 0x2c, 0x00, 0x80, 0x8b, 0x12, 0x8c, 0x12, 0xac, 0x12, 0x8c, 0x12, 0x40, 0x00, 0x31, 0xac, 0x1a,
+  0xad, 0x92, 0x03, 0x40, 0xcd, 0x22, 0x8c, 0x12, 0xfe, 0x06, 0x00, 0xe8, 0x06, 0x00, 0xa0, 0x03, 0x00, 0x54, 0x03, 0x13, 0xad, 0xac, 0x1c, 0x02, 0xfe, 0x2a, 0x11, 0xd1, 0x5a, 0x4a, 0x04, 0xae,
+  0x4a, 0x02, 0x32, 0x32, 0x00, 0x84, 0x03, 0x60, 0x6f, 0x33, 0xee, 0x22, 0x8c, 0x12, 0xf6, 0x03, 0x00, 0x34, 0x00, 0x00, 0x50, 0x23, 0x00, 0x60, 0x0e, 0x02, 0xc2, 0x66, 0x11, 0xb1, 0x90, 0x71,
+  0x00, 0x24, 0x27, 0x00, 0x28, 0x07, 0x00, 0xda, 0x38, 0x02, 0x4e, 0x5c, 0x11, 0x91, 0xae, 0x5f, 0x02, 0x22, 0x20, 0x11, 0x12, 0x6e, 0x04, 0x00, 0xcc, 0x03, 0xb1, 0xcd, 0x22, 0xac, 0x22, 0x8c,
+  0x22, 0x8b, 0x22, 0x8c, 0x22, 0x4e, 0x06, 0x71, 0x00, 0x7e, 0x38, 0x02, 0xf2, 0x74, 0x30, 0x6f, 0x3b, 0x6f, 0x6c, 0x66, 0x50, 0x4b, 0x6f, 0x3b, 0x12, 0x54, 0xa4, 0x46, 0xa0, 0xf1, 0x53, 0x0e,
+  0x3b, 0x0e, 0x33, 0xed, 0x32, 0xcd, 0x32, 0x9e, 0x03, 0x00, 0x7e, 0x58, 0x11, 0xed, 0x0a, 0x00, 0x10, 0x0e, 0x2c, 0x60, 0x00, 0x32, 0x15, 0x10, 0x2a, 0x04, 0x12, 0x02, 0xc8, 0x38, 0x00, 0xac,
+  0x0e, 0x20, 0xf2, 0x53, 0xbe, 0x11, 0x00, 0xbc, 0x0a, 0x82, 0x70, 0x4b, 0xb5, 0x74, 0xd1, 0x53, 0x0e, 0x3b, 0xa2, 0x9b, 0x22, 0xf2, 0x5b, 0xd4, 0x46, 0x01, 0xc0, 0x38, 0x03, 0x88, 0x86, 0x00,
+  0x50, 0x15, 0x00, 0x04, 0x00, 0x00, 0x94, 0x11, 0x00, 0xf4, 0x4d, 0x00, 0x90, 0x06, 0x01, 0x3a, 0x43, 0x01, 0xf0, 0x2d, 0x31, 0x0e, 0x43, 0x90, 0x16, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x1a, 0x00,
+  0x01, 0xf8, 0x89, 0xb1, 0x5c, 0x94, 0x74, 0x73, 0x6c, 0x4f, 0x4b, 0x6f, 0x4b, 0xed, 0x3a, 0x88, 0x03, 0x11, 0x4b, 0xa8, 0x94, 0x10, 0x5b, 0x6e, 0x71, 0x11, 0xd1, 0x04, 0x55, 0x00, 0x9c, 0x51,
+  0x00, 0x26, 0x19, 0x00, 0x48, 0x03, 0x00, 0x1a, 0x35, 0x00, 0x24, 0x0e, 0x40, 0x53, 0x6c, 0x12, 0x6c, 0xaa, 0x11, 0x00, 0x48, 0x0e, 0x00, 0x86, 0x03, 0x11, 0x8f, 0x9e, 0x03, 0x40, 0x2e, 0x4b,
+  0x4f, 0x53, 0xcc, 0x31, 0x11, 0x53, 0xb4, 0x11, 0x30, 0x53, 0x74, 0xb4, 0x30, 0x0e, 0x12, 0x6c, 0xde, 0x18, 0x02, 0x2e, 0x07, 0x30, 0x4e, 0x4b, 0xd0, 0x76, 0x07, 0x10, 0x63, 0x04, 0x00, 0x40,
+  0xf0, 0x63, 0xaf, 0x5b, 0x80, 0x23, 0x20, 0x10, 0x6c, 0xbc, 0x6a, 0xc0, 0xcb, 0x42, 0x49, 0x32, 0xec, 0x4a, 0x2d, 0x53, 0x8f, 0x63, 0x31, 0x7c, 0x92, 0x03, 0xe0, 0xf9, 0xb5, 0x19, 0xb6, 0xd4,
+  0x8c, 0xb3, 0x8c, 0xf4, 0x94, 0xf8, 0xb5, 0x55, 0xa5, 0xd6, 0x31, 0x60, 0xf8, 0xb5, 0x5a, 0xc6, 0xf8, 0xbd, 0x8c, 0x03, 0x60, 0x56, 0xa5, 0xb3, 0x8c, 0x52, 0x84, 0xb8, 0x43, 0x13, 0xb4, 0x38,
+  0x47, 0x02, 0xa4, 0x0a, 0x22, 0x94, 0x8c, 0x0a, 0x00, 0x32, 0x74, 0x84, 0x94, 0x0c, 0x00, 0x00, 0x8e, 0x03, 0x00, 0x90, 0x03, 0x04, 0x8a, 0x03, 0x01, 0xaa, 0x0a, 0x02, 0x20, 0x07, 0x02, 0x1a,
+  0x20, 0x01, 0xb6, 0x0a, 0x03, 0x64, 0x15, 0x00, 0x56, 0x2e, 0x00, 0xb2, 0x0a, 0x22, 0x16, 0xce, 0x0e, 0x20, 0x20, 0xf6, 0xcd, 0xe2, 0x14, 0x40, 0x30, 0x23, 0xee, 0x1a, 0x1e, 0x23, 0x00, 0x2c,
+  0x11, 0x00, 0x04, 0x00, 0x11, 0x50, 0x2a, 0x03, 0x06, 0x74, 0x22, 0x00, 0x10, 0x07, 0x00, 0x52, 0x02, 0x11, 0x4f, 0x1c, 0x4d, 0x00, 0x08, 0x00, 0x20, 0x2e, 0x23, 0x36, 0x1b, 0x00, 0x0a, 0x31,
+  0x11, 0x6f, 0xa0, 0x34, 0x00, 0xc0, 0x06, 0x02, 0x16, 0x7b, 0x11, 0x71, 0x2a, 0x1f, 0x11, 0x50, 0x1e, 0x31, 0x00, 0x90, 0x03, 0x00, 0x1a, 0x5b, 0x02, 0x1e, 0x0a, 0x13, 0x4f, 0x88, 0x26, 0x00,
+  0x3e, 0x14, 0x00, 0xde, 0x37, 0x40, 0x17, 0x6d, 0xd6, 0x64, 0x20, 0x07, 0x11, 0x75, 0x64, 0x0a, 0x02, 0x58, 0x18, 0x02, 0x6c, 0x93, 0x00, 0x62, 0x0a, 0x02, 0xac, 0x0a, 0x00, 0xd8, 0x0d, 0x11,
+  0x94, 0xfa, 0x1b, 0x11, 0x94, 0xec, 0x69, 0x80, 0xf6, 0x64, 0xd5, 0x64, 0xb5, 0x64, 0x73, 0x54, 0x3a, 0x0a, 0x00, 0x04, 0x00, 0x11, 0xb0, 0x4e, 0x0a, 0x40, 0x6f, 0x33, 0xed, 0x1a, 0xc6, 0x06,
+  0x21, 0x8f, 0x33, 0x7e, 0x03, 0x00, 0x42, 0x03, 0xf2, 0x10, 0x0a, 0x6b, 0x02, 0x8b, 0x0a, 0xac, 0x12, 0xed, 0x22, 0x2d, 0x23, 0x2d, 0x2b, 0x6e, 0x33, 0x8f, 0x3b, 0x6f, 0x33, 0x0d, 0x2b, 0xaf,
+  0x3b, 0x11, 0x4c, 0xd0, 0x3b, 0x0d, 0x23, 0xed, 0x22, 0x04, 0x00, 0xf1, 0x04, 0x0d, 0x23, 0x0d, 0x2b, 0x0d, 0x2b, 0xec, 0x22, 0xac, 0x1a, 0x2d, 0x2b, 0x0d, 0x23, 0xec, 0x22, 0xcc, 0x1a, 0xec,
+  0x02, 0x00, 0x20, 0x8f, 0x33, 0x4a, 0x00, 0x82, 0xec, 0x1a, 0x0d, 0x23, 0xec, 0x1a, 0x8b, 0x12, 0x52, 0x00, 0x20, 0xed, 0x22, 0x4e, 0x1c, 0x62, 0x2e, 0x2b, 0x0e, 0x23, 0xed, 0x22, 0x52, 0x63,
+  0x11, 0x70, 0x56, 0x63, 0x40, 0x12, 0x44, 0x6f, 0x33, 0x14, 0x00, 0x15, 0x2e, 0x6a, 0x23, 0x11, 0x90, 0xf8, 0x11, 0x42, 0x70, 0x33, 0xb0, 0x3b, 0xe2, 0x12, 0x11, 0x50, 0x16, 0x60, 0x00, 0x70,
+  0x04, 0x02, 0x10, 0x47, 0x02, 0x4a, 0x78, 0x00, 0x22, 0x04, 0x22, 0xd1, 0x43, 0x10, 0x55, 0x00, 0x02, 0x00, 0x00, 0x0e, 0x20, 0x02, 0xbe, 0x11, 0x00, 0x04, 0x0b, 0x00, 0x50, 0x0e, 0x01, 0x20,
+  0x19, 0x01, 0x56, 0x67, 0x02, 0x10, 0x00, 0x02, 0x44, 0x5c, 0x11, 0x2f, 0x16, 0x3d, 0x00, 0x3e, 0x0e, 0x11, 0x33, 0x0e, 0x6e, 0x20, 0xed, 0x32, 0x7e, 0x6d, 0x40, 0xac, 0x2a, 0x4b, 0x1a, 0x9c,
+  0x03, 0xa0, 0x2e, 0x33, 0xed, 0x2a, 0x2e, 0x33, 0x32, 0x54, 0xd0, 0x4b, 0x0e, 0x3c, 0x10, 0xb0, 0xb2, 0x7b, 0x30, 0x2a, 0x0e, 0x3b, 0x46, 0x23, 0x02, 0xa6, 0x66, 0x02, 0x36, 0x07, 0x40, 0x8c,
+  0x22, 0x8c, 0x22, 0x44, 0x03, 0x13, 0x6f, 0x08, 0x91, 0x00, 0xa2, 0x31, 0x00, 0x9c, 0x11, 0x00, 0x38, 0x1c, 0x00, 0x94, 0x58, 0x22, 0xb4, 0x6c, 0x08, 0x07, 0x22, 0x2e, 0x3b, 0x4e, 0x3c, 0x11,
+  0xb1, 0x82, 0x38, 0x02, 0xaa, 0x9b, 0x20, 0x4f, 0x43, 0xb4, 0x03, 0x04, 0x38, 0x55, 0x00, 0xda, 0x6d, 0x20, 0x11, 0x5c, 0xec, 0x6d, 0x00, 0x34, 0x0e, 0x00, 0x20, 0x0e, 0x22, 0x12, 0x64, 0x94,
+  0x31, 0x20, 0x11, 0x64, 0x96, 0x2a, 0x02, 0x48, 0x43, 0x02, 0x44, 0x0e, 0x40, 0x53, 0x6c, 0xd0, 0x5b, 0xac, 0x11, 0x00, 0xc4, 0x11, 0x43, 0x2e, 0x43, 0x12, 0x64, 0xbc, 0x11, 0x10, 0x7c, 0x72,
+  0x03, 0x11, 0x73, 0x8c, 0x1c, 0x02, 0x22, 0x5c, 0x22, 0x11, 0x64, 0x0c, 0x27, 0x40, 0x2e, 0x4b, 0x90, 0x53, 0xa6, 0x03, 0x20, 0x4e, 0x4b, 0x7e, 0x9f, 0x20, 0x53, 0x74, 0x1a, 0x20, 0x10, 0x90,
+  0x86, 0x2a, 0x00, 0xd4, 0x94, 0xb0, 0x63, 0x12, 0x6c, 0xf5, 0x84, 0xd5, 0x84, 0x94, 0x7c, 0xd5, 0x84, 0xde, 0x1f, 0x11, 0x73, 0x30, 0x0e, 0x00, 0x2e, 0x0e, 0x00, 0x06, 0x00, 0x00, 0x30, 0x00,
+  0x31, 0x8f, 0x5b, 0x90, 0xec, 0x8d, 0x04, 0xfc, 0x11, 0x00, 0xa0, 0x03, 0x11, 0x72, 0x72, 0x91, 0x60, 0xf0, 0x6b, 0x0d, 0x4b, 0xec, 0x4a, 0x40, 0x6e, 0x80, 0xb3, 0x84, 0x96, 0x9d, 0x59, 0xb6,
+  0xf4, 0x8c, 0x26, 0x0e, 0x00, 0x2c, 0x0e, 0x00, 0xc4, 0x6a, 0x22, 0x31, 0x7c, 0xec, 0x38, 0x80, 0x15, 0x9d, 0x76, 0xad, 0x59, 0xc6, 0xd8, 0xb5, 0x1e, 0x0e, 0x42, 0xf1, 0x73, 0x8f, 0x6b, 0x48,
+  0x2e, 0x20, 0xf5, 0x9c, 0x14, 0x07, 0x13, 0x94, 0xdc, 0x18, 0x00, 0x0a, 0x00, 0x13, 0xb5, 0x96, 0x03, 0x13, 0xd5, 0xee, 0x18, 0x12, 0xb3, 0x8e, 0x03, 0x73, 0x9c, 0xd1, 0xa4, 0xb1, 0xa4, 0xb0,
+  0xa4, 0x3a, 0x0e, 0x03, 0x86, 0x03, 0x15, 0xf1, 0xa8, 0x0a, 0x04, 0xe6, 0x31, 0x01, 0xce, 0x11, 0x10, 0xbd, 0x3e, 0x0e, 0x00, 0x24, 0x00, 0x00, 0x56, 0x0e, 0x20, 0x2e, 0x1b, 0x6a, 0x31, 0x02,
+  0x74, 0x57, 0x01, 0x3e, 0x4d, 0x01, 0x8a, 0x49, 0x13, 0x12, 0xe0, 0x46, 0x00, 0xfa, 0x37, 0x00, 0x7a, 0x03, 0x02, 0x4e, 0x34, 0x00, 0xc6, 0x2c, 0x02, 0x42, 0x15, 0x10, 0x2f, 0x0a, 0x31, 0x02,
+  0xaa, 0x34, 0x12, 0x2b, 0xb0, 0x4d, 0x02, 0x90, 0x18, 0x00, 0x78, 0x02, 0x00, 0x84, 0x58, 0x00, 0x7a, 0x0d, 0x00, 0xb2, 0x1b, 0x02, 0xc0, 0x09, 0x20, 0x50, 0x33, 0x54, 0x06, 0x02, 0xec, 0x06,
+  0x00, 0x0e, 0x00, 0x40, 0x6c, 0x12, 0x2b, 0x02, 0x88, 0x14, 0x20, 0xee, 0x22, 0x12, 0x54, 0x02, 0x12, 0x11, 0x00, 0xce, 0x10, 0x31, 0x71, 0x3b, 0x0f, 0x50, 0x06, 0x11, 0x0f, 0x50, 0x38, 0x00,
+  0xf8, 0x03, 0x31, 0x33, 0x4c, 0x73, 0xda, 0x0d, 0xf0, 0x01, 0x32, 0x4c, 0x8f, 0x33, 0x0d, 0x23, 0xcc, 0x1a, 0xab, 0x1a, 0xab, 0x1a, 0x6a, 0x12, 0x2d, 0x2b, 0x64, 0x03, 0xd0, 0x31, 0x54, 0xf0,
+  0x4b, 0x10, 0x4c, 0xcf, 0x3b, 0x6e, 0x33, 0x0c, 0x23, 0xec, 0x62, 0x0a, 0xf0, 0x16, 0x23, 0x6a, 0x0a, 0x8a, 0x12, 0x4a, 0x02, 0x8b, 0x12, 0xab, 0x12, 0xcb, 0x1a, 0x0c, 0x23, 0xec, 0x22, 0xcb,
+  0x1a, 0xcb, 0x1a, 0x69, 0x02, 0x8a, 0x0a, 0x8a, 0x0a, 0xcb, 0x1a, 0x6a, 0x0a, 0xab, 0x12, 0x8a, 0x0a, 0x6a, 0x02, 0x08, 0x07, 0x00, 0x2c, 0x00, 0x00, 0x4e, 0x00, 0x02, 0x94, 0x03, 0xc0, 0x6e,
+  0x33, 0x6e, 0x2b, 0x2d, 0x23, 0xec, 0x1a, 0x2d, 0x23, 0x4e, 0x2b, 0x10, 0x00, 0xa0, 0x6f, 0x2b, 0x0d, 0x23, 0x8b, 0x02, 0x8b, 0x02, 0x0d, 0x1b, 0x92, 0x03, 0x00, 0xac, 0x0a, 0x41, 0x4e, 0x33,
+  0x6f, 0x33, 0x9a, 0x6d, 0x21, 0x3b, 0x6f, 0x44, 0x8d, 0x02, 0x30, 0x4a, 0x22, 0x2f, 0x2b, 0x78, 0x6a, 0x00, 0x2a, 0x07, 0x11, 0x2e, 0xb6, 0x0a, 0x00, 0x5e, 0x0a, 0x02, 0x28, 0x07, 0x20, 0xcd,
+  0x1a, 0x0a, 0x07, 0x11, 0x0e, 0xf2, 0x2d, 0x00, 0x8a, 0x31, 0x02, 0x6e, 0x43, 0x02, 0xea, 0x66, 0x02, 0x5a, 0x03, 0x00, 0x7c, 0x03, 0x00, 0x9a, 0x11, 0x02, 0x1c, 0x55, 0x13, 0xb1, 0x3a, 0x08,
+  0x12, 0x90, 0x9c, 0x03, 0x12, 0x2a, 0xfc, 0x54, 0x00, 0xac, 0x27, 0x00, 0x62, 0x2e, 0x11, 0x90, 0xd0, 0x3f, 0x00, 0x56, 0x43, 0x33, 0xee, 0x32, 0xd2, 0xa4, 0x31, 0x00, 0x9e, 0x58, 0x00, 0xc2,
+  0x06, 0x40, 0xb0, 0x43, 0xb0, 0x4b, 0x48, 0x86, 0x00, 0xfe, 0x97, 0x00, 0x06, 0x00, 0x01, 0x50, 0x86, 0x52, 0x4b, 0x73, 0x64, 0x32, 0x54, 0x90, 0x15, 0x20, 0x2e, 0x3b, 0x78, 0x23, 0x02, 0x4c,
+  0x15, 0x20, 0xb4, 0x6c, 0x16, 0x5c, 0x00, 0x0a, 0x15, 0x02, 0x12, 0x2e, 0x00, 0x14, 0x0e, 0x00, 0x50, 0x00, 0x02, 0x58, 0x23, 0xf0, 0x05, 0x6b, 0x22, 0x66, 0x01, 0x8b, 0x2a, 0xcb, 0x32, 0xec,
+  0x32, 0x2d, 0x43, 0x0d, 0x3b, 0xcc, 0x32, 0x4a, 0x22, 0xab, 0x2a, 0x0a, 0x98, 0x02, 0x12, 0x47, 0x00, 0x42, 0x43, 0xb1, 0x33, 0x64, 0x94, 0x6c, 0x16, 0x7d, 0x37, 0x85, 0xb5, 0x74, 0x32, 0xb0,
+  0x9b, 0x00, 0x5c, 0x03, 0x40, 0x90, 0x4b, 0x52, 0x64, 0x02, 0x20, 0x00, 0x64, 0x03, 0x20, 0xcd, 0x3a, 0x08, 0x27, 0x00, 0xaa, 0x23, 0x00, 0x8a, 0x8d, 0x02, 0x3c, 0x6a, 0x11, 0xd1, 0x8e, 0x2a,
+  0x00, 0x8e, 0x03, 0x00, 0xfa, 0x18, 0x11, 0x12, 0x58, 0x1c, 0x00, 0xbe, 0x18, 0x30, 0xb0, 0x5b, 0x90, 0xa2, 0x2a, 0x12, 0x7c, 0x8e, 0x86, 0x11, 0x53, 0xa6, 0x51, 0x20, 0xd0, 0x5b, 0x1e, 0x07,
+  0x00, 0x7e, 0x2a, 0x00, 0x10, 0x15, 0x20, 0x16, 0x85, 0xac, 0x18, 0x40, 0x11, 0x64, 0xd4, 0x7c, 0x44, 0x83, 0x00, 0x48, 0x3c, 0x00, 0x6e, 0x0a, 0x00, 0x62, 0x2a, 0x02, 0x4e, 0x23, 0x02, 0x38,
+  0x00, 0x02, 0xbe, 0x23, 0x20, 0xd5, 0x84, 0x0c, 0x00, 0x00, 0x30, 0x20, 0x11, 0x53, 0x52, 0x07, 0x71, 0x56, 0x95, 0x56, 0x95, 0x16, 0x8d, 0x93, 0x5e, 0x00, 0x11, 0x31, 0xb0, 0x1c, 0x00, 0x4c,
+  0x2e, 0x40, 0xaf, 0x5b, 0x6e, 0x53, 0x88, 0x03, 0x40, 0xd0, 0x6b, 0x52, 0x7c, 0xf4, 0x8d, 0xf1, 0x0a, 0x18, 0xb6, 0x96, 0xa5, 0xb6, 0xad, 0x34, 0x9d, 0xd3, 0x94, 0x31, 0x7c, 0x92, 0x84, 0x18,
+  0xb6, 0x15, 0x9d, 0x14, 0x9d, 0x72, 0x84, 0xd4, 0x94, 0x19, 0x3a, 0x15, 0x82, 0x39, 0xbe, 0x15, 0x9d, 0x6e, 0x6b, 0x10, 0x74, 0xbc, 0x0a, 0x00, 0x50, 0x4e, 0x33, 0x74, 0x8c, 0x74, 0x94, 0x0a,
+  0x12, 0x94, 0x86, 0x03, 0x00, 0xc4, 0x11, 0x03, 0xb2, 0x0a, 0x13, 0x93, 0x68, 0x4e, 0x53, 0x72, 0x94, 0x92, 0x94, 0xb1, 0x08, 0x20, 0x04, 0xde, 0x31, 0x14, 0xf1, 0x98, 0x3c, 0x23, 0xb5, 0xf1,
+  0x2c, 0x59, 0x02, 0x7e, 0x1c, 0x02, 0xfc, 0x18, 0x00, 0x32, 0x27, 0x00, 0x40, 0x47, 0x20, 0xb5, 0xc5, 0x22, 0x40, 0x01, 0xe0, 0x2d, 0x01, 0x66, 0x34, 0x02, 0x2e, 0x0e, 0x04, 0x1c, 0x82, 0x02,
+  0x2a, 0x35, 0x11, 0xb1, 0x70, 0x31, 0x00, 0x12, 0x51, 0x20, 0xce, 0x12, 0x4a, 0x46, 0x00, 0x44, 0x07, 0x01, 0xba, 0x0d, 0x01, 0x12, 0x2a, 0x10, 0x0f, 0x22, 0x46, 0x12, 0x23, 0x30, 0x0e, 0x20,
+  0x2f, 0x23, 0xd6, 0x0d, 0x00, 0x14, 0x63, 0x00, 0xa2, 0x18, 0x11, 0x2f, 0xc6, 0x11, 0x00, 0xfe, 0x25, 0x62, 0x8c, 0x12, 0x4c, 0x0a, 0xee, 0x22, 0x62, 0x49, 0x00, 0x1c, 0x46, 0x20, 0x2f, 0x2b,
+  0x38, 0x34, 0x01, 0xac, 0x49, 0x01, 0x76, 0x42, 0x00, 0xe6, 0x17, 0x02, 0xba, 0x6d, 0x11, 0x34, 0x76, 0x1c, 0x00, 0x16, 0x12, 0x10, 0x94, 0x1a, 0x3f, 0x01, 0x4a, 0x51, 0xa1, 0xf1, 0x3b, 0x6f,
+  0x33, 0x6e, 0x33, 0x6e, 0x33, 0x2d, 0x2b, 0xbc, 0x06, 0xf1, 0x0b, 0x22, 0xab, 0x12, 0xab, 0x1a, 0x8a, 0x12, 0x49, 0x0a, 0xe7, 0x01, 0x8e, 0x3b, 0x10, 0x4c, 0x49, 0x0a, 0x0c, 0x2b, 0x0c, 0x23,
+  0xcb, 0x1a, 0xaa, 0x12, 0xab, 0x80, 0x03, 0x80, 0xec, 0x22, 0x0c, 0x23, 0x4d, 0x2b, 0x2d, 0x2b, 0x88, 0x03, 0x30, 0xeb, 0x22, 0xcb, 0xbe, 0x03, 0x00, 0x0a, 0x00, 0x10, 0x1a, 0x10, 0x00, 0x31,
+  0x8a, 0x12, 0xec, 0x2c, 0x07, 0x91, 0x0d, 0x23, 0xab, 0x12, 0xac, 0x12, 0x0d, 0x23, 0x4e, 0xe4, 0x06, 0xe0, 0x2e, 0x2b, 0x4e, 0x2b, 0x4e, 0x23, 0xcc, 0x12, 0xcc, 0x12, 0x0d, 0x23, 0x2e, 0x23,
+  0x7e, 0x03, 0xe1, 0x4e, 0x2b, 0x8b, 0x0a, 0x8b, 0x02, 0xac, 0x12, 0x6b, 0x02, 0xac, 0x0a, 0xed, 0x1a, 0xa0, 0x03, 0x41, 0x33, 0x8f, 0x33, 0x6f, 0x1e, 0x04, 0x11, 0x6f, 0xe2, 0x07, 0x01, 0x40,
+  0x04, 0x00, 0x4c, 0x40, 0x32, 0x33, 0xcd, 0x1a, 0x96, 0x03, 0x13, 0x6f, 0x2e, 0x07, 0x00, 0xda, 0x11, 0x00, 0x02, 0x20, 0x02, 0x76, 0x0a, 0x02, 0xba, 0x3c, 0x02, 0x4a, 0x8d, 0x00, 0xe8, 0x06,
+  0x11, 0x30, 0x52, 0x6a, 0x20, 0x8d, 0x1a, 0x0e, 0x20, 0x11, 0xb1, 0x92, 0x7f, 0x02, 0x46, 0x4a, 0x01, 0xfe, 0x4d, 0x04, 0x16, 0x20, 0x01, 0x70, 0x71, 0x40, 0xd6, 0x6c, 0x94, 0x64, 0xa2, 0x31,
+  0x13, 0x53, 0x12, 0x9f, 0x02, 0x7a, 0x71, 0x00, 0x44, 0x0a, 0x62, 0xd6, 0x74, 0x13, 0x5c, 0x50, 0x43, 0xd4, 0x18, 0x31, 0xad, 0x22, 0xce, 0x52, 0x55, 0x02, 0xfe, 0x34, 0x00, 0xbc, 0x82, 0x00,
+  0x6e, 0x1c, 0x11, 0x4f, 0xaa, 0x0a, 0x20, 0xb0, 0x43, 0x8a, 0x03, 0x11, 0x70, 0x1e, 0x19, 0x30, 0xf1, 0x53, 0x2f, 0xbe, 0x58, 0x00, 0x8a, 0x8d, 0x03, 0x42, 0x6a, 0x40, 0x2f, 0x3b, 0x53, 0x64,
+  0xfe, 0x18, 0x11, 0xb1, 0xe4, 0x1f, 0x00, 0x44, 0x15, 0x00, 0xa0, 0x38, 0xf4, 0x09, 0x6e, 0x43, 0x31, 0x5c, 0x96, 0x8d, 0x10, 0x5c, 0xcf, 0x53, 0x0c, 0x43, 0x8e, 0x4b, 0xcf, 0x53, 0x4d, 0x43,
+  0xd0, 0x53, 0x6e, 0x4b, 0xd0, 0x53, 0xc2, 0x78, 0x00, 0x3e, 0x00, 0x02, 0x84, 0x51, 0x44, 0x2f, 0x43, 0x90, 0x53, 0x0e, 0x00, 0x20, 0xf1, 0x5b, 0x16, 0x35, 0x04, 0x8e, 0x51, 0x00, 0x8a, 0x4a,
+  0x01, 0x46, 0x0e, 0x30, 0x3b, 0xb0, 0x53, 0xd0, 0x18, 0x20, 0x4e, 0x43, 0x7c, 0x03, 0x00, 0x0c, 0x07, 0x00, 0x58, 0x9f, 0x00, 0x9c, 0x03, 0x42, 0xb1, 0x5b, 0x94, 0x74, 0x64, 0x1c, 0x33, 0xf2,
+  0x63, 0x53, 0x50, 0x2a, 0x20, 0x93, 0x74, 0xaa, 0x38, 0x20, 0xd4, 0x7c, 0xfe, 0x26, 0x11, 0xb0, 0xd8, 0x9b, 0x00, 0x5e, 0x03, 0x00, 0x5c, 0x15, 0x00, 0x3e, 0x55, 0x01, 0x10, 0x27, 0x01, 0x2a,
+  0x00, 0x02, 0x0c, 0xa3, 0x20, 0xf1, 0x63, 0x06, 0x00, 0x04, 0x46, 0x0e, 0x11, 0x73, 0x22, 0x2e, 0x00, 0x7e, 0x2a, 0x00, 0x20, 0x00, 0xf4, 0x00, 0x6f, 0x53, 0x12, 0x6c, 0x90, 0x5b, 0xd1, 0x63,
+  0xf1, 0x6b, 0x8f, 0x5b, 0xed, 0x4a, 0x8f, 0x78, 0x83, 0x01, 0xf6, 0x86, 0x00, 0x74, 0x8a, 0x40, 0xaf, 0x63, 0xaf, 0x63, 0x58, 0x7c, 0xf0, 0x19, 0xcb, 0x4a, 0x8e, 0x63, 0xcf, 0x6b, 0xaf, 0x6b,
+  0x8a, 0x4a, 0x4d, 0x63, 0x92, 0x8c, 0x92, 0x8c, 0xf4, 0x94, 0xb3, 0x8c, 0x4e, 0x63, 0x11, 0x7c, 0x15, 0x9d, 0xf8, 0xbd, 0x39, 0xbe, 0xb7, 0xad, 0x76, 0xa5, 0xd0, 0x73, 0xb0, 0x73, 0x32, 0x84,
+  0xbc, 0x0a, 0x00, 0xf8, 0x71, 0x97, 0x32, 0x7c, 0x12, 0x7c, 0x53, 0x84, 0x74, 0x84, 0xb5, 0x8a, 0x03, 0x03, 0x9a, 0x03, 0x30, 0x84, 0x94, 0x84, 0x12, 0x00, 0x52, 0xb3, 0x8c, 0x93, 0x8c, 0x92,
+  0xd2, 0x4a, 0x03, 0x1e, 0x40, 0x04, 0xfa, 0x38, 0x13, 0xf1, 0xde, 0x63, 0x04, 0x14, 0x07, 0x02, 0x2e, 0x27, 0x20, 0x53, 0xb5, 0x9a, 0x03, 0x00, 0x6e, 0x35, 0x02, 0x94, 0x6e, 0x93, 0x37, 0xd6,
+  0x73, 0xbd, 0xb5, 0xc5, 0x74, 0xbd, 0x91, 0x58, 0x5b, 0x11, 0xce, 0x1e, 0x0e, 0x82, 0xef, 0x1a, 0xae, 0x12, 0xae, 0x12, 0xce, 0x1a, 0x24, 0x4e, 0x13, 0x71, 0xfc, 0x06, 0x00, 0x52, 0x46, 0x00,
+  0x06, 0x11, 0x02, 0x42, 0xa8, 0x01, 0x9a, 0x1b, 0x01, 0xf2, 0x66, 0x01, 0xc0, 0x03, 0x01, 0x20, 0x66, 0x02, 0x98, 0x9a, 0x04, 0x26, 0xb3, 0x02, 0xe4, 0x7e, 0x02, 0x6a, 0x5b, 0x31, 0xd1, 0x43,
+  0xb5, 0x0e, 0x1f, 0x00, 0x84, 0x0a, 0x02, 0x22, 0x07, 0x00, 0xc8, 0x18, 0x00, 0x80, 0x03, 0x60, 0xb5, 0x5c, 0x16, 0x6d, 0x17, 0x6d, 0x84, 0x42, 0x20, 0xb5, 0x64, 0x60, 0x74, 0x02, 0x50, 0x1f,
+  0x00, 0xda, 0x22, 0x00, 0x78, 0x74, 0xc0, 0x53, 0x54, 0x12, 0x44, 0x32, 0x4c, 0xcc, 0x12, 0x8b, 0x0a, 0xab, 0x12, 0xd2, 0x06, 0x00, 0xd8, 0x06, 0x32, 0x0c, 0x23, 0x0d, 0xf6, 0x06, 0x32, 0x22,
+  0xcb, 0x22, 0x6c, 0x03, 0x00, 0x66, 0x03, 0x00, 0x92, 0x03, 0x20, 0x2d, 0x2b, 0x18, 0x00, 0x20, 0x8b, 0x12, 0x02, 0x00, 0x40, 0xec, 0x1a, 0xcb, 0x1a, 0x14, 0x07, 0x31, 0x8a, 0x12, 0xab, 0x2a,
+  0x07, 0x60, 0xcb, 0x12, 0xaa, 0x12, 0x8a, 0x0a, 0x20, 0x07, 0x00, 0x22, 0x00, 0x20, 0x2d, 0x2b, 0xba, 0x0a, 0x40, 0xac, 0x1a, 0x0d, 0x23, 0x46, 0x03, 0x02, 0x9a, 0x0a, 0x60, 0x6f, 0x2b, 0xf1,
+  0x43, 0xd0, 0x3b, 0xf8, 0x0a, 0x40, 0x2e, 0x23, 0xac, 0x12, 0x02, 0x00, 0x10, 0xcc, 0x82, 0x0e, 0x01, 0xa8, 0x03, 0x00, 0xae, 0x0a, 0x40, 0x0e, 0x23, 0x2e, 0x2b, 0x84, 0x0a, 0x51, 0xce, 0x1a,
+  0xad, 0x12, 0x4c, 0xac, 0x5f, 0x80, 0x2b, 0x02, 0x0a, 0x02, 0xea, 0x01, 0x8c, 0x12, 0xc4, 0x0d, 0x04, 0x96, 0x03, 0x02, 0x8a, 0x1c, 0x20, 0x8c, 0x12, 0x04, 0x5c, 0x20, 0x8c, 0x1a, 0xe4, 0x06,
+  0x00, 0x04, 0x3c, 0x02, 0xae, 0x2a, 0x12, 0x33, 0x0e, 0x20, 0x11, 0x4b, 0xd4, 0x18, 0x00, 0xfc, 0x66, 0x32, 0x4b, 0x13, 0x4c, 0x5c, 0x35, 0x04, 0xfe, 0xac, 0x00, 0xa8, 0x04, 0x13, 0x90, 0x3e,
+  0x07, 0x11, 0x91, 0x1c, 0x5c, 0x24, 0xb1, 0x43, 0x12, 0x75, 0x00, 0x28, 0x23, 0x00, 0x6a, 0x11, 0x02, 0x0a, 0xad, 0x22, 0x94, 0x6c, 0xf2, 0x5b, 0x20, 0x94, 0x64, 0x8c, 0x38, 0x20, 0xee, 0x32,
+  0xcc, 0x26, 0x00, 0x0c, 0x1c, 0x11, 0xd1, 0xfc, 0xb3, 0x04, 0x44, 0x4a, 0x00, 0xd4, 0x18, 0x11, 0xf1, 0xe6, 0x9e, 0x00, 0x12, 0x20, 0x11, 0xd1, 0x28, 0x78, 0x02, 0x9c, 0x6a, 0x20, 0x53, 0x64,
+  0xe2, 0x46, 0x22, 0x6c, 0x22, 0xf0, 0x26, 0x20, 0xee, 0x32, 0x1a, 0x3c, 0x00, 0x70, 0x03, 0xf0, 0x06, 0x0d, 0x3b, 0x2d, 0x43, 0xcc, 0x32, 0xe8, 0x19, 0x8e, 0x4b, 0x2d, 0x43, 0x4d, 0x43, 0xcb,
+  0x32, 0x8e, 0x4b, 0x6e, 0x4b, 0x6e, 0xda, 0x38, 0x00, 0xce, 0x78, 0x00, 0x3c, 0x55, 0x10, 0x64, 0x80, 0x51, 0x11, 0x33, 0x4a, 0x35, 0x11, 0xb5, 0xd2, 0x3f, 0x00, 0x7c, 0x7f, 0x11, 0x32, 0x80,
+  0x31, 0x02, 0x0e, 0x07, 0x02, 0x9e, 0x31, 0x02, 0x80, 0x71, 0x00, 0x12, 0x07, 0x00, 0x68, 0x51, 0x11, 0xd1, 0x08, 0x07, 0x00, 0x72, 0x15, 0x10, 0x53, 0x56, 0x0a, 0x10, 0x5b, 0xa8, 0x23, 0x11,
+  0x74, 0xda, 0x0d, 0x00, 0xbc, 0x31, 0x00, 0x26, 0xb1, 0x11, 0x6f, 0x3c, 0x63, 0x00, 0x1e, 0x07, 0x00, 0x18, 0x0e, 0x00, 0x0c, 0x07, 0x00, 0xc6, 0x0a, 0x00, 0xae, 0x11, 0x31, 0x16, 0x8d, 0xb4,
+  0x12, 0x00, 0x11, 0xf5, 0xae, 0x18, 0x20, 0x94, 0x7c, 0x32, 0x15, 0x04, 0x80, 0x03, 0x20, 0xd1, 0x63, 0x98, 0x03, 0x02, 0x10, 0x00, 0x00, 0xe8, 0x26, 0x01, 0x70, 0x35, 0x21, 0x7c, 0xb4, 0x88,
+  0x23, 0x11, 0x94, 0xdc, 0x1f, 0x00, 0x32, 0x00, 0x02, 0x74, 0x3c, 0x22, 0x93, 0x7c, 0x4a, 0x15, 0x40, 0x93, 0x7c, 0x11, 0x74, 0x7a, 0x8a, 0x50, 0x6e, 0x63, 0x35, 0x9d, 0x11, 0x0a, 0x8e, 0xf0,
+  0x0a, 0x8c, 0xb7, 0xad, 0x55, 0xa5, 0x55, 0xa5, 0x76, 0xa5, 0xf8, 0xb5, 0x76, 0xad, 0xbb, 0xce, 0xdc, 0xd6, 0xbb, 0xce, 0xf9, 0xb5, 0x97, 0xad, 0xf1, 0x7b, 0x22, 0x27, 0x03, 0x80, 0x5c, 0x21,
+  0x8c, 0xb3, 0x14, 0x79, 0x00, 0x8e, 0x0a, 0x04, 0x8e, 0x03, 0x0f, 0x02, 0x00, 0x02, 0x21, 0x94, 0xb3, 0x3a, 0x0e, 0x11, 0xb2, 0x5a, 0x15, 0x14, 0xb2, 0x3c, 0x0e, 0x05, 0x1a, 0x07, 0x05, 0x02,
+  0x00, 0x10, 0xad, 0x0a, 0x79, 0x23, 0x32, 0xb5, 0x10, 0x6b, 0x01, 0x3e, 0x0e, 0x00, 0x12, 0x00, 0x80, 0x33, 0xb5, 0x73, 0xbd, 0x16, 0xd6, 0x16, 0xce, 0xbc, 0x38, 0x21, 0xae, 0x12, 0x1a, 0x2d,
+  0x00, 0xb4, 0x5f, 0x32, 0x22, 0x10, 0x23, 0x64, 0xaf, 0x11, 0x71, 0xb4, 0x74, 0x02, 0xce, 0x69, 0x02, 0x98, 0x7b, 0x00, 0xa4, 0x03, 0x02, 0xbe, 0x66, 0x81, 0x70, 0x33, 0x30, 0x2b, 0xce, 0x1a,
+  0x2f, 0x23, 0x6a, 0xa8, 0x10, 0x3b, 0xfc, 0x66, 0x00, 0x6e, 0x03, 0x22, 0x34, 0x4c, 0x9c, 0x15, 0x02, 0x0c, 0x3f, 0x01, 0xa4, 0x30, 0x03, 0x12, 0x9e, 0x00, 0x8a, 0x03, 0x01, 0x48, 0x38, 0x00,
+  0xe2, 0x3e, 0x02, 0xd0, 0x3e, 0x12, 0x3b, 0xbc, 0x1b, 0x11, 0xad, 0xde, 0x5e, 0x02, 0x78, 0x14, 0x40, 0x90, 0x3b, 0xed, 0x22, 0x0a, 0x43, 0x20, 0x6f, 0x33, 0x08, 0x00, 0x00, 0xac, 0x0d, 0x00,
+  0x98, 0x11, 0x01, 0x56, 0x0a, 0x21, 0x2b, 0x2d, 0xe8, 0x0d, 0x02, 0x98, 0x03, 0x00, 0x26, 0x07, 0x00, 0x9a, 0x0a, 0x06, 0x70, 0x03, 0x11, 0xcc, 0x84, 0x0a, 0x01, 0x8c, 0x11, 0x03, 0x04, 0x0e,
+  0x40, 0x2d, 0x2b, 0x4d, 0x2b, 0xc6, 0x0a, 0x02, 0xb4, 0x0a, 0x22, 0x2d, 0x2b, 0x02, 0x00, 0x40, 0x4d, 0x2b, 0xcc, 0x1a, 0x44, 0x15, 0x00, 0x10, 0x0e, 0x02, 0x4a, 0x15, 0x10, 0xcc, 0x8a, 0x11,
+  0x30, 0x0a, 0x8b, 0x0a, 0x06, 0x00, 0x00, 0x0e, 0x15, 0x00, 0x7c, 0x03, 0x20, 0x6f, 0x33, 0xbe, 0x4a, 0x01, 0x86, 0x03, 0x21, 0x23, 0x4f, 0x80, 0x11, 0x13, 0x90, 0x08, 0x5c, 0x00, 0x84, 0x6b,
+  0x02, 0x80, 0x1c, 0x00, 0xe4, 0x14, 0x02, 0xca, 0x51, 0x00, 0x4a, 0x04, 0x11, 0x33, 0xdc, 0x06, 0x11, 0x12, 0xf0, 0x07, 0x02, 0xe8, 0x5b, 0x00, 0xe6, 0x0e, 0x00, 0xda, 0x1f, 0x11, 0x74, 0x4e,
+  0x31, 0x02, 0x56, 0x1d, 0x21, 0x2f, 0x33, 0x90, 0x03, 0x01, 0x08, 0x23, 0x00, 0x9c, 0x5f, 0x11, 0xd1, 0x66, 0x51, 0x02, 0x76, 0xb7, 0x00, 0xbc, 0x11, 0x00, 0xda, 0x38, 0x02, 0x76, 0x2a, 0x11,
+  0x91, 0xb2, 0x7f, 0x00, 0x02, 0x07, 0x20, 0x50, 0x3b, 0x60, 0x6a, 0x00, 0xc6, 0x18, 0x80, 0x8d, 0x22, 0xce, 0x32, 0xcd, 0x2a, 0x2b, 0x1a, 0x00, 0x7c, 0x00, 0x04, 0x9f, 0x00, 0xf2, 0x06, 0x02,
+  0x9a, 0x58, 0x00, 0x12, 0x27, 0x22, 0x16, 0x7d, 0xc8, 0x3f, 0x00, 0x9a, 0x03, 0x01, 0x8a, 0x94, 0x21, 0x53, 0x33, 0xb2, 0x9b, 0x00, 0xf8, 0x1f, 0x02, 0x00, 0x9f, 0x02, 0x76, 0x11, 0xe0, 0xed,
+  0x32, 0x8c, 0x2a, 0x8c, 0x2a, 0x2e, 0x3b, 0xf2, 0x53, 0xf6, 0x74, 0x57, 0x85, 0x24, 0x07, 0x00, 0x22, 0x15, 0x22, 0x74, 0x6c, 0x32, 0x4a, 0xf0, 0x04, 0x72, 0x6c, 0x31, 0x64, 0x51, 0x64, 0x8e,
+  0x4b, 0xf0, 0x5b, 0x6e, 0x4b, 0xd0, 0x5b, 0xcc, 0x3a, 0xcc, 0x3a, 0x6e, 0x94, 0x94, 0x12, 0x4b, 0xca, 0x78, 0x11, 0x70, 0xd4, 0x3f, 0xa0, 0x33, 0x64, 0x70, 0x4b, 0xb1, 0x53, 0xd1, 0x5b, 0xd1,
+  0x53, 0x98, 0x03, 0x00, 0xa6, 0x18, 0x01, 0xc6, 0x46, 0x12, 0x5c, 0xaa, 0x94, 0x31, 0xb1, 0x53, 0x33, 0xce, 0x5f, 0x00, 0x16, 0x2e, 0x00, 0x5a, 0x71, 0x20, 0x0d, 0x43, 0x98, 0x03, 0x11, 0x12,
+  0xec, 0x18, 0x20, 0xcd, 0x3a, 0xdc, 0x11, 0x31, 0x33, 0x6c, 0x53, 0x7e, 0x18, 0x82, 0xf2, 0x63, 0xd1, 0x5b, 0xb4, 0x7c, 0x16, 0x85, 0xb8, 0x38, 0x00, 0xb2, 0x5f, 0x02, 0x70, 0x23, 0x01, 0x56,
+  0x91, 0x81, 0x63, 0x90, 0x5b, 0xed, 0x42, 0x6f, 0x53, 0xf1, 0xf4, 0x06, 0x00, 0x7c, 0x2a, 0x00, 0x9c, 0x03, 0x00, 0xc4, 0x0a, 0x02, 0x2a, 0x0e, 0x31, 0xb0, 0x5b, 0x94, 0x56, 0x3c, 0x15, 0x12,
+  0xc8, 0x18, 0x11, 0x53, 0x70, 0x0e, 0x40, 0xf1, 0x6b, 0x73, 0x74, 0x0a, 0x2e, 0x13, 0x53, 0xfc, 0x3f, 0x20, 0x73, 0x7c, 0xe2, 0x38, 0xf0, 0x0b, 0x31, 0x74, 0x72, 0x7c, 0xf0, 0x6b, 0xaf, 0x63,
+  0x8f, 0x63, 0x6e, 0x63, 0x11, 0x74, 0x19, 0xb6, 0x72, 0x84, 0x39, 0xbe, 0xd7, 0xb5, 0xf8, 0xb5, 0x18, 0xbe, 0x8a, 0x43, 0xc0, 0x59, 0xc6, 0x19, 0xbe, 0x7a, 0xc6, 0x39, 0xc6, 0x7a, 0xc6, 0xd8,
+  0xb5, 0x38, 0x0e, 0x51, 0x8f, 0x6b, 0xd0, 0x73, 0x93, 0xfe, 0x06, 0x02, 0x8c, 0x03, 0x35, 0xb3, 0x8c, 0xb4, 0x12, 0x07, 0x00, 0xd4, 0x18, 0x09, 0x86, 0x03, 0x00, 0xe4, 0x18, 0x01, 0x02, 0x00,
+  0x02, 0x8c, 0x3c, 0x15, 0xb3, 0xba, 0x2a, 0x02, 0x90, 0x03, 0x13, 0xd2, 0x8c, 0x03, 0x04, 0x92, 0x03, 0x31, 0x32, 0xb5, 0x32, 0xc0, 0x11, 0x02, 0x28, 0x07, 0x13, 0x53, 0x3c, 0x0e, 0x51, 0xb4,
+  0xc5, 0x94, 0xbd, 0xd5, 0x44, 0x47, 0x00, 0xb0, 0x75, 0x23, 0x71, 0x2b, 0xc4, 0x34, 0x23, 0x43, 0xb2, 0xec, 0x69, 0x01, 0x70, 0x26, 0x01, 0xe0, 0x1b, 0x02, 0x6a, 0x23, 0x00, 0xb8, 0x38, 0x20,
+  0x6c, 0x02, 0x96, 0x26, 0x02, 0x02, 0x00, 0x00, 0x9e, 0x0a, 0x02, 0x0a, 0x00, 0x53, 0x71, 0x33, 0x2f, 0x23, 0xce, 0x78, 0x58, 0x11, 0x0f, 0xf4, 0xbd, 0x41, 0x34, 0x4c, 0xd3, 0x43, 0x7e, 0x63,
+  0x34, 0x33, 0xb2, 0x3b, 0xa0, 0xb6, 0x00, 0xf8, 0x29, 0x11, 0xce, 0x62, 0x23, 0x00, 0x34, 0x15, 0x00, 0xf4, 0x18, 0x00, 0x88, 0x09, 0x02, 0x8c, 0x23, 0x02, 0x34, 0x89, 0x00, 0xb8, 0x17, 0x00,
+  0xe8, 0x1b, 0x00, 0x40, 0x0a, 0x10, 0xcd, 0x3e, 0x11, 0x30, 0x22, 0x0e, 0x2b, 0xd6, 0x14, 0x40, 0xac, 0x12, 0x2e, 0x2b, 0xd4, 0x0d, 0x31, 0xac, 0x12, 0xab, 0x3e, 0x03, 0x30, 0x8b, 0x12, 0xab,
+  0x30, 0x07, 0x10, 0x1a, 0x02, 0x07, 0x02, 0x84, 0x0a, 0xa0, 0x8b, 0x0a, 0x8a, 0x0a, 0x4a, 0x02, 0x6a, 0x02, 0xab, 0x12, 0xc4, 0x11, 0x00, 0xce, 0x06, 0x00, 0x64, 0x0a, 0x11, 0xed, 0x94, 0x03,
+  0x01, 0xa4, 0x03, 0x00, 0xb2, 0x03, 0x00, 0x32, 0x07, 0x11, 0x12, 0xa6, 0x03, 0x01, 0x0e, 0x0e, 0x22, 0xed, 0x1a, 0xa2, 0x11, 0x00, 0x8c, 0x03, 0x00, 0x2a, 0x15, 0x53, 0xcc, 0x12, 0xcd, 0x12,
+  0xcd, 0x0c, 0x00, 0x00, 0x54, 0x0b, 0x00, 0x16, 0x5c, 0x02, 0xda, 0x46, 0x22, 0x70, 0x33, 0xc6, 0x1f, 0x10, 0x2e, 0x80, 0x5f, 0x01, 0x14, 0x0f, 0x22, 0xce, 0x1a, 0x1a, 0x16, 0x11, 0x91, 0xa0,
+  0x03, 0x00, 0x5c, 0x5c, 0x11, 0xce, 0x64, 0x15, 0x00, 0xc6, 0x58, 0x00, 0xe2, 0x06, 0x00, 0x22, 0x2e, 0x00, 0x1a, 0x75, 0x00, 0x7a, 0x31, 0x02, 0x0c, 0x00, 0x00, 0x9e, 0x0b, 0x31, 0x71, 0x3b,
+  0x50, 0x4c, 0x51, 0x73, 0x30, 0x33, 0x30, 0x33, 0x71, 0x3b, 0xf3, 0x8c, 0x51, 0x20, 0x94, 0x64, 0xd8, 0x2d, 0x21, 0x70, 0x43, 0xa8, 0x46, 0x01, 0xe2, 0x7f, 0x01, 0xe6, 0x0a, 0x10, 0x2a, 0xa6,
+  0x18, 0x13, 0x0e, 0x04, 0x4e, 0x11, 0xd2, 0x8e, 0x0a, 0x00, 0x4c, 0x23, 0x10, 0x94, 0x80, 0x58, 0x32, 0x4b, 0xf6, 0x74, 0x8a, 0x26, 0x70, 0x74, 0x64, 0xd5, 0x74, 0x74, 0x64, 0x12, 0xe0, 0x26,
+  0x01, 0xaa, 0x1f, 0x40, 0x0e, 0x3b, 0xad, 0x2a, 0x3a, 0x23, 0x01, 0x24, 0x03, 0x21, 0x6c, 0xf2, 0x54, 0x78, 0x00, 0x08, 0x00, 0x02, 0x98, 0x18, 0x11, 0x32, 0xc8, 0x18, 0x02, 0x36, 0x9f, 0x60,
+  0xb5, 0x74, 0x37, 0x85, 0x36, 0x7d, 0xac, 0x0a, 0x11, 0x2f, 0xfe, 0x54, 0x32, 0x50, 0x43, 0x2f, 0x3a, 0x43, 0x12, 0x64, 0x2c, 0x23, 0x00, 0x70, 0x18, 0x70, 0x15, 0x85, 0x72, 0x6c, 0xaf, 0x53,
+  0x73, 0xa6, 0x34, 0x01, 0xe6, 0x8d, 0x00, 0xf6, 0x06, 0x00, 0x80, 0x03, 0x00, 0xfa, 0xb0, 0x10, 0xb1, 0x9c, 0x1f, 0x01, 0xac, 0x58, 0x02, 0x12, 0x35, 0x11, 0xd1, 0xa0, 0x0a, 0x02, 0x84, 0x6a,
+  0x00, 0x9a, 0x0a, 0x20, 0xd1, 0x5b, 0xec, 0x66, 0x33, 0xcd, 0x32, 0xf1, 0xc6, 0x3f, 0x00, 0xde, 0xa2, 0x31, 0x4f, 0x4b, 0x94, 0xd4, 0x31, 0x20, 0xd5, 0x7c, 0x60, 0x15, 0x11, 0x11, 0x42, 0x35,
+  0x20, 0x94, 0x74, 0x50, 0x03, 0x00, 0xce, 0x66, 0x00, 0x98, 0x38, 0x00, 0x0a, 0x00, 0x00, 0x62, 0x03, 0x00, 0xe8, 0x0d, 0x02, 0x12, 0x0e, 0x00, 0xae, 0x11, 0x00, 0x98, 0x03, 0x11, 0x53, 0xb0,
+  0x03, 0x00, 0x8a, 0x0a, 0x00, 0x14, 0x07, 0x11, 0x12, 0xcc, 0x18, 0x00, 0x28, 0x07, 0x01, 0x66, 0x15, 0x72, 0x84, 0xf6, 0x84, 0x94, 0x74, 0xd5, 0x84, 0x3e, 0x0e, 0x00, 0x94, 0x03, 0x00, 0x1a,
+  0x07, 0x30, 0x4f, 0x53, 0x6f, 0x48, 0xaa, 0x01, 0x28, 0x4e, 0x60, 0x72, 0x7c, 0x11, 0x74, 0x31, 0x74, 0xa0, 0x98, 0x10, 0xd0, 0x1c, 0x9c, 0xb0, 0x95, 0x7a, 0xc6, 0xf8, 0xbd, 0x96, 0xad, 0x18,
+  0xbe, 0x39, 0xbe, 0x4e, 0x1c, 0x80, 0x7a, 0xc6, 0x39, 0xbe, 0xb7, 0xb5, 0xd4, 0x94, 0x0a, 0x27, 0x60, 0x11, 0x7c, 0xb0, 0x73, 0x52, 0x84, 0x96, 0x0a, 0x04, 0x8a, 0x0a, 0x00, 0x92, 0x03, 0x02,
+  0x18, 0x0e, 0x13, 0x94, 0x8e, 0x03, 0x06, 0x1a, 0x00, 0x0a, 0x28, 0x07, 0x02, 0x2c, 0x00, 0x00, 0x8a, 0x3c, 0x13, 0xb3, 0xac, 0x43, 0x04, 0xf4, 0x51, 0x24, 0x12, 0xad, 0x8e, 0x03, 0x11, 0x32,
+  0x90, 0x03, 0x00, 0x8e, 0x6e, 0x11, 0x33, 0x0a, 0x00, 0x02, 0x16, 0x79, 0x11, 0x53, 0x06, 0x00, 0x00, 0x10, 0x20, 0x02, 0xee, 0x8a, 0x20, 0x94, 0xc5, 0xd2, 0x06, 0x02, 0x0a, 0x8d, 0x02, 0x6e,
+  0x66, 0x00, 0xde, 0x22, 0x00, 0xda, 0x66, 0x80, 0x8d, 0x02, 0x2c, 0x02, 0x6d, 0x02, 0x6d, 0x02, 0x7e, 0x03, 0x12, 0x71, 0x7c, 0x6d, 0x10, 0x4c, 0xee, 0x2d, 0x00, 0x1c, 0x94, 0x02, 0x66, 0x34,
+  0x00, 0xa2, 0xaf, 0x00, 0x8a, 0x1f, 0x00, 0x7a, 0x2d, 0x00, 0x74, 0x2a, 0x40, 0xd3, 0x43, 0x92, 0x3b, 0x26, 0x27, 0x06, 0x8c, 0x03, 0x61, 0xb2, 0x43, 0x74, 0x5c, 0xd6, 0x64, 0x96, 0x0a, 0x10,
+  0x54, 0x90, 0x29, 0x00, 0x28, 0x15, 0x02, 0xf8, 0x1f, 0x11, 0x50, 0x2a, 0x26, 0x02, 0xf0, 0x02, 0xc0, 0x8f, 0x3b, 0xb0, 0x43, 0x4e, 0x33, 0xac, 0x1a, 0xcc, 0x22, 0xed, 0x22, 0xf0, 0x14, 0x22,
+  0xcc, 0x22, 0x04, 0x1c, 0x02, 0xa0, 0x03, 0x00, 0x72, 0x18, 0x51, 0xec, 0x22, 0x0d, 0x2b, 0x2e, 0x02, 0x15, 0x11, 0xed, 0x00, 0x07, 0x40, 0xab, 0x12, 0xec, 0x22, 0x98, 0x18, 0x11, 0x4e, 0xae,
+  0x03, 0x20, 0x6f, 0x33, 0x08, 0x00, 0x20, 0x2e, 0x23, 0x4e, 0x1c, 0x60, 0xcc, 0x1a, 0xcd, 0x1a, 0xed, 0x1a, 0x06, 0x0e, 0x02, 0x6a, 0x15, 0x02, 0xa2, 0x11, 0x00, 0x0e, 0x0e, 0x20, 0xcc, 0x1a,
+  0x7e, 0x0a, 0x31, 0xec, 0x1a, 0xed, 0x20, 0x00, 0x22, 0x2e, 0x2b, 0x12, 0x0e, 0x01, 0xd8, 0x97, 0x01, 0x24, 0x1c, 0x22, 0xed, 0x1a, 0xf4, 0x0e, 0x02, 0x06, 0x7c, 0x02, 0xd2, 0x2d, 0x10, 0x8d,
+  0x1a, 0x00, 0x03, 0xe0, 0x46, 0x11, 0x90, 0xda, 0x20, 0x00, 0xd6, 0x00, 0x01, 0x3a, 0x08, 0x12, 0x43, 0x80, 0x12, 0x20, 0x13, 0x4c, 0x04, 0x00, 0x02, 0x4c, 0x1d, 0x00, 0x06, 0x0e, 0x11, 0x30,
+  0xa4, 0x6a, 0x00, 0xa4, 0xbe, 0x00, 0x8a, 0x03, 0x51, 0xd2, 0x4b, 0x74, 0x5c, 0x34, 0x76, 0x51, 0x10, 0x91, 0x2c, 0x00, 0x10, 0x54, 0x2a, 0x2a, 0x50, 0xb5, 0x64, 0x54, 0x5c, 0xf3, 0x78, 0x0a,
+  0x01, 0x94, 0xb0, 0x01, 0x34, 0x07, 0x01, 0xe4, 0x46, 0x00, 0x18, 0xb4, 0x01, 0xe8, 0x46, 0x10, 0x43, 0x58, 0x31, 0x00, 0x02, 0x35, 0x00, 0xfe, 0x74, 0x00, 0x6a, 0x43, 0x40, 0x16, 0x7d, 0xf6,
+  0x74, 0x7e, 0x03, 0x01, 0xf8, 0x62, 0x01, 0xf4, 0x3b, 0x00, 0x60, 0x0a, 0x00, 0xb2, 0x1f, 0x00, 0x9a, 0x2a, 0x02, 0x4c, 0x58, 0x00, 0xe6, 0x06, 0x01, 0x54, 0x83, 0x01, 0xaa, 0x4d, 0x04, 0x7c,
+  0x31, 0x22, 0x90, 0x4b, 0xe0, 0x31, 0x00, 0x0e, 0x20, 0x01, 0x38, 0x0e, 0x41, 0x43, 0xf2, 0x5b, 0x2f, 0xb2, 0x38, 0x00, 0x28, 0x07, 0x91, 0x91, 0x4b, 0x70, 0x43, 0x2f, 0x43, 0xb1, 0x53, 0x91,
+  0xa0, 0x5f, 0x00, 0x24, 0x07, 0x00, 0x20, 0x4a, 0x60, 0x0d, 0x43, 0x0d, 0x43, 0xcc, 0x3a, 0xb2, 0x46, 0x00, 0x02, 0x3c, 0x12, 0x12, 0x22, 0x43, 0x01, 0x82, 0xb4, 0x00, 0x96, 0x03, 0x11, 0xf2,
+  0xf2, 0x26, 0x12, 0xd1, 0x14, 0xb1, 0x20, 0x53, 0x32, 0x56, 0x2a, 0x21, 0x6c, 0xd5, 0x02, 0x55, 0x13, 0xd1, 0xf4, 0x74, 0x02, 0x84, 0x0a, 0x00, 0x64, 0x23, 0x00, 0x8c, 0x1c, 0x00, 0x72, 0x1c,
+  0x00, 0x44, 0x98, 0x31, 0x4f, 0x4b, 0x2e, 0x50, 0x9f, 0x11, 0xf1, 0x90, 0x2a, 0x00, 0x54, 0x0a, 0x00, 0xf4, 0x14, 0x00, 0xda, 0x03, 0x00, 0x42, 0x3c, 0x11, 0x52, 0x32, 0x0e, 0x02, 0x62, 0x43,
+  0x00, 0x6c, 0x03, 0x20, 0x12, 0x6c, 0x00, 0x07, 0x65, 0x4f, 0x53, 0x90, 0x5b, 0x32, 0x6c, 0xb6, 0xad, 0x00, 0x2e, 0x2e, 0x12, 0x63, 0x5e, 0x15, 0x20, 0x4f, 0x53, 0x06, 0x00, 0x02, 0x20, 0x9c,
+  0x02, 0x58, 0x0e, 0x41, 0x94, 0x7c, 0x16, 0x8d, 0xb4, 0x2a, 0x00, 0x20, 0x07, 0x00, 0x28, 0x15, 0xf0, 0x04, 0x84, 0x52, 0x7c, 0x8f, 0x5b, 0xf0, 0x6b, 0x11, 0x74, 0xd0, 0x6b, 0x51, 0x7c, 0xaf,
+  0x6b, 0x2d, 0x5b, 0xb3, 0x8c, 0x12, 0x07, 0x80, 0xb7, 0xb5, 0xf0, 0x7b, 0x56, 0xa5, 0x9b, 0xce, 0x0e, 0x2e, 0xa0, 0x76, 0xad, 0xf0, 0x73, 0xaf, 0x6b, 0xed, 0x5a, 0x11, 0x7c, 0x2c, 0x0e, 0x11,
+  0x73, 0x02, 0x60, 0x11, 0x94, 0x7e, 0x1c, 0x00, 0x64, 0x23, 0x00, 0x4e, 0x15, 0x08, 0x70, 0x03, 0x4c, 0x74, 0x84, 0x74, 0x84, 0x8a, 0x03, 0x02, 0x30, 0x07, 0x13, 0xd5, 0x80, 0x55, 0x02, 0xb0,
+  0x0a, 0x00, 0x5e, 0x15, 0x00, 0xb4, 0x2a, 0x19, 0xb2, 0x86, 0x55, 0x04, 0x2c, 0x27, 0x23, 0xf1, 0xac, 0x00, 0x39, 0x23, 0xb5, 0x32, 0x20, 0x40, 0x31, 0xf5, 0xcd, 0x74, 0x26, 0x07, 0x00, 0xca,
+  0x2a, 0x41, 0x57, 0xd6, 0x16, 0xd6, 0x24, 0x2a, 0x01, 0x56, 0x1f, 0x22, 0xf2, 0x43, 0x84, 0xaf, 0x11, 0x75, 0x5c, 0x34, 0x00, 0xa8, 0x2a, 0x00, 0x96, 0x2d, 0x02, 0xf6, 0x37, 0x02, 0x04, 0x6e,
+  0x60, 0x71, 0x2b, 0x34, 0x4c, 0x13, 0x4c, 0x0e, 0x31, 0x11, 0x74, 0x8c, 0x34, 0x00, 0xc0, 0x1f, 0x00, 0x9a, 0x89, 0x20, 0xd3, 0x43, 0x5e, 0x31, 0x02, 0x12, 0x31, 0x00, 0x0c, 0x2e, 0x00, 0x9a,
+  0x2a, 0x00, 0x8a, 0x03, 0x00, 0x40, 0x26, 0x00, 0xbe, 0x1c, 0x02, 0x18, 0x38, 0x00, 0xce, 0x11, 0x00, 0xbe, 0x62, 0x02, 0x02, 0x66, 0x11, 0xd2, 0xaa, 0x5b, 0x00, 0xb2, 0x18, 0x01, 0xa8, 0x53,
+  0x90, 0x3b, 0x6e, 0x33, 0x4e, 0x33, 0x4e, 0x33, 0xec, 0x2a, 0x92, 0x03, 0x00, 0x3e, 0x15, 0x24, 0x0d, 0x2b, 0xc4, 0x06, 0x20, 0xec, 0x22, 0x98, 0x18, 0x00, 0x2a, 0x07, 0x00, 0x94, 0x03, 0x42,
+  0x2d, 0x23, 0x2d, 0x23, 0xf6, 0x14, 0x21, 0x2d, 0x23, 0x14, 0x00, 0x01, 0x56, 0x19, 0x22, 0xed, 0x22, 0x16, 0x4e, 0x00, 0x02, 0x0e, 0x11, 0x4f, 0x14, 0x00, 0x02, 0x80, 0x11, 0x31, 0x4f, 0x2b,
+  0x2e, 0xa0, 0x19, 0x00, 0x20, 0x15, 0x12, 0x8f, 0x96, 0x55, 0x10, 0x23, 0x3e, 0x1c, 0x00, 0x46, 0x1d, 0x62, 0x4b, 0x02, 0xad, 0x12, 0xed, 0x1a, 0x30, 0x3c, 0x02, 0x02, 0x00, 0x00, 0x28, 0x04,
+  0x00, 0x44, 0x4e, 0x00, 0xa2, 0x18, 0x02, 0x60, 0xb0, 0x00, 0x74, 0x19, 0x00, 0x44, 0x24, 0x00, 0x70, 0x0a, 0x01, 0x3e, 0xc2, 0x00, 0x98, 0x6e, 0x21, 0x4b, 0xb2, 0x9c, 0x03, 0x11, 0xf3, 0x48,
+  0x03, 0x00, 0x6e, 0x66, 0x11, 0x71, 0xce, 0x18, 0x00, 0x68, 0x31, 0x11, 0xb2, 0x9c, 0x8d, 0x00, 0x3a, 0xc2, 0x02, 0xa4, 0x5f, 0x00, 0x9c, 0x03, 0x22, 0x71, 0x3b, 0xba, 0x03, 0x00, 0x98, 0xc5,
+  0x00, 0x48, 0x0e, 0x00, 0xdc, 0x6d, 0x20, 0x75, 0x64, 0xa0, 0x51, 0x00, 0x4a, 0x43, 0x40, 0xd1, 0x4b, 0x50, 0x3b, 0x52, 0x2a, 0x11, 0xd2, 0x5e, 0x58, 0x00, 0xc2, 0x26, 0x80, 0x6c, 0x1a, 0xce,
+  0x2a, 0x8d, 0x22, 0x0e, 0x33, 0x20, 0x2e, 0x10, 0xce, 0x90, 0x2a, 0x21, 0x3b, 0x0f, 0xd0, 0x1f, 0x04, 0x22, 0x3c, 0x62, 0x53, 0x5c, 0xb4, 0x6c, 0xb5, 0x6c, 0x78, 0x38, 0x51, 0xb5, 0x74, 0xb5,
+  0x74, 0x74, 0x9a, 0x46, 0x62, 0xb1, 0x53, 0x4f, 0x43, 0x6c, 0x22, 0x02, 0x5c, 0x04, 0xf0, 0x7b, 0x20, 0x90, 0x4b, 0xea, 0x26, 0x02, 0x7a, 0x58, 0x20, 0xf2, 0x5b, 0x9e, 0x31, 0x00, 0x26, 0x15,
+  0x02, 0x80, 0x78, 0x00, 0x76, 0x0a, 0x82, 0xf2, 0x53, 0xb5, 0x6c, 0xf2, 0x5b, 0x13, 0x5c, 0x70, 0x23, 0x11, 0x6f, 0x10, 0x43, 0x00, 0x56, 0x03, 0x11, 0x93, 0xc0, 0x26, 0x00, 0xd0, 0x06, 0x00,
+  0x32, 0x5c, 0x00, 0x1e, 0x0e, 0x00, 0x1c, 0x55, 0x02, 0x38, 0x35, 0xa0, 0xb4, 0x74, 0x74, 0x6c, 0xb5, 0x74, 0x36, 0x85, 0xf6, 0x7c, 0x20, 0x00, 0x11, 0xb4, 0x9c, 0xbb, 0x11, 0x94, 0x04, 0x7c,
+  0x00, 0xcc, 0x18, 0x02, 0x32, 0x27, 0x00, 0xd4, 0x46, 0x20, 0x36, 0x85, 0x84, 0x23, 0x40, 0x16, 0x85, 0xf1, 0x5b, 0xfe, 0x54, 0x00, 0x48, 0x55, 0x20, 0xd4, 0x7c, 0x80, 0x03, 0x11, 0x32, 0x64,
+  0x0a, 0x51, 0xcd, 0x3a, 0x6b, 0x32, 0x90, 0x92, 0x18, 0x31, 0xf5, 0x84, 0xd4, 0xd2, 0x1f, 0x02, 0x6a, 0x6a, 0x22, 0xb4, 0x7c, 0xbc, 0x11, 0x01, 0xd0, 0x18, 0x30, 0x8c, 0xf5, 0x84, 0x2c, 0x00,
+  0x22, 0xb4, 0x84, 0x34, 0x0e, 0x00, 0xe2, 0x3f, 0x00, 0x02, 0x00, 0x02, 0x0c, 0x07, 0x00, 0x04, 0x20, 0x00, 0xba, 0x03, 0x00, 0xe0, 0x18, 0x02, 0x3e, 0x07, 0x40, 0x32, 0x74, 0xd5, 0x84, 0x7c,
+  0x15, 0x01, 0x2e, 0x27, 0xf2, 0x04, 0x6b, 0x8f, 0x63, 0xaf, 0x63, 0x0d, 0x53, 0x8e, 0x63, 0x10, 0x74, 0x8e, 0x6b, 0xf4, 0x94, 0x96, 0xad, 0x7a, 0xc6, 0x10, 0x2e, 0xf2, 0x01, 0x2d, 0x63, 0x31,
+  0x84, 0xb7, 0xb5, 0x5a, 0xce, 0xec, 0x5a, 0xaf, 0x73, 0xaf, 0x73, 0xf0, 0x7b, 0x9a, 0x31, 0x00, 0xc6, 0x18, 0x11, 0x73, 0x98, 0x11, 0x00, 0x8e, 0x03, 0x00, 0x04, 0x00, 0x02, 0x62, 0x35, 0x02,
+  0x02, 0x00, 0x06, 0xc4, 0x11, 0x0f, 0x02, 0x00, 0x02, 0x00, 0x20, 0x27, 0x00, 0x22, 0x27, 0x23, 0x8c, 0x72, 0xae, 0x0a, 0x11, 0xb1, 0x48, 0x2e, 0x00, 0xd6, 0x31, 0x51, 0x90, 0x9c, 0x90, 0xa4,
+  0xb0, 0x02, 0x00, 0x13, 0xd1, 0xb2, 0x0a, 0x02, 0x46, 0x47, 0xa0, 0xd1, 0xac, 0x6f, 0x9c, 0x90, 0xa4, 0x32, 0xb5, 0x94, 0xc5, 0x4a, 0x2e, 0x00, 0xa6, 0x03, 0x00, 0xce, 0x11, 0x51, 0x36, 0xd6,
+  0xf5, 0xcd, 0x13, 0xd6, 0x29, 0x02, 0x5a, 0x03, 0x02, 0xe4, 0x34, 0x01, 0x9e, 0x78, 0x01, 0xb4, 0x0a, 0x02, 0xe2, 0x37, 0x00, 0xf4, 0x26, 0x11, 0x2f, 0x82, 0x3b, 0x11, 0x91, 0x22, 0x23, 0x01,
+  0x14, 0x63, 0x01, 0x0e, 0x00, 0x20, 0x2f, 0x2b, 0x48, 0x0e, 0x00, 0x3c, 0x2e, 0x04, 0x0e, 0x2e, 0x42, 0xd2, 0x43, 0xf3, 0x4b, 0xd2, 0x11, 0x00, 0x82, 0x49, 0x02, 0x76, 0x03, 0x00, 0x40, 0x00,
+  0x00, 0x28, 0x27, 0x22, 0xce, 0x1a, 0x42, 0x2d, 0x00, 0x64, 0x00, 0x02, 0x24, 0x58, 0x00, 0x4a, 0x15, 0x20, 0x32, 0x54, 0xb6, 0x1e, 0xd5, 0xec, 0x22, 0xab, 0x1a, 0x8b, 0x1a, 0x4a, 0x12, 0x8b,
+  0x1a, 0x6a, 0x12, 0x8a, 0x82, 0x03, 0x00, 0x16, 0x23, 0x11, 0x6f, 0xa8, 0x03, 0x31, 0x6f, 0x33, 0x6f, 0x5c, 0x1c, 0x00, 0x6c, 0x11, 0x00, 0x02, 0x07, 0x11, 0xcd, 0xe8, 0x06, 0x80, 0x8b, 0x0a,
+  0x8b, 0x0a, 0x8c, 0x0a, 0xed, 0x1a, 0xe4, 0x06, 0x00, 0x82, 0x03, 0x00, 0x3a, 0x0a, 0x01, 0xbe, 0x4d, 0x00, 0x3c, 0x00, 0x30, 0x23, 0xee, 0x22, 0x28, 0x00, 0x20, 0x6b, 0x02, 0xc0, 0x20, 0x11,
+  0xed, 0xb2, 0x1f, 0x02, 0xae, 0x0e, 0x04, 0x0a, 0x3c, 0x02, 0x42, 0x4a, 0x03, 0xe0, 0xc1, 0x11, 0x33, 0x28, 0x04, 0x03, 0x84, 0x20, 0x02, 0xf6, 0x26, 0x01, 0x40, 0x43, 0x03, 0x86, 0x19, 0x01,
+  0xdc, 0x59, 0x02, 0x18, 0x01, 0x30, 0x54, 0x33, 0x4c, 0xd2, 0x27, 0x22, 0xf6, 0x6c, 0x16, 0x07, 0x20, 0x95, 0x64, 0x1a, 0xc9, 0x40, 0x37, 0x75, 0xb6, 0x64, 0x70, 0x03, 0x00, 0x1e, 0x63, 0x80,
+  0xb6, 0x64, 0x17, 0x75, 0x17, 0x75, 0xd6, 0x6c, 0x1a, 0x3c, 0x40, 0xf6, 0x6c, 0x75, 0x5c, 0x18, 0xc9, 0x00, 0xf2, 0xc5, 0x31, 0x34, 0x54, 0xf3, 0x46, 0x31, 0x11, 0xd2, 0x4a, 0x2a, 0x80, 0x33,
+  0x5c, 0xd6, 0x74, 0x16, 0x75, 0xd6, 0x74, 0x64, 0x78, 0x02, 0x1a, 0x2e, 0x40, 0xb5, 0x6c, 0xb5, 0x6c, 0x4a, 0x71, 0x91, 0x57, 0x85, 0xd5, 0x74, 0x57, 0x85, 0x37, 0x7d, 0x54, 0xf8, 0x2d, 0xe3,
+  0x94, 0x6c, 0x17, 0x7d, 0x16, 0x7d, 0x12, 0x5c, 0x54, 0x64, 0x94, 0x64, 0x91, 0x43, 0x36, 0x6a, 0x00, 0x38, 0x91, 0x00, 0xee, 0x8d, 0x50, 0x3b, 0x6c, 0x22, 0xcd, 0x32, 0xc6, 0xc5, 0x00, 0x4c,
+  0xbb, 0x02, 0x5a, 0xbb, 0x02, 0xa0, 0x58, 0x60, 0x53, 0x64, 0xac, 0x2a, 0x2f, 0x3b, 0x20, 0x07, 0x00, 0x94, 0x38, 0x02, 0x64, 0xbb, 0xa0, 0x4f, 0x43, 0xcd, 0x32, 0x6c, 0x2a, 0x8c, 0x2a, 0x6b,
+  0x22, 0x08, 0x20, 0x00, 0x88, 0x23, 0x21, 0xee, 0x3a, 0x64, 0x83, 0x41, 0x5c, 0x91, 0x4b, 0xf2, 0x1a, 0x5c, 0x33, 0xd5, 0x7c, 0xd5, 0xda, 0x54, 0x02, 0x50, 0x23, 0xb1, 0xe9, 0x19, 0xac, 0x32,
+  0xed, 0x3a, 0x8c, 0x2a, 0x0e, 0x43, 0x4f, 0x4a, 0x23, 0x13, 0x70, 0xe6, 0x3f, 0x11, 0x90, 0x04, 0x00, 0x00, 0xae, 0x3f, 0x00, 0x7e, 0x4a, 0x00, 0x2a, 0x0e, 0x11, 0x4f, 0xcc, 0x18, 0x00, 0x4e,
+  0x23, 0x02, 0x22, 0x07, 0x11, 0xb0, 0x76, 0x71, 0x00, 0xd8, 0x0a, 0x00, 0xfa, 0x1f, 0x00, 0x00, 0x27, 0x00, 0x72, 0x03, 0x00, 0x60, 0x03, 0x03, 0x28, 0x5c, 0x10, 0x6c, 0xc8, 0x03, 0x00, 0xea,
+  0x1f, 0x02, 0xfc, 0x0d, 0x00, 0xd8, 0x66, 0x02, 0x16, 0xaa, 0x71, 0x12, 0x6c, 0x2e, 0x4b, 0xed, 0x42, 0xd1, 0x6e, 0x23, 0x04, 0x2a, 0x07, 0x20, 0x12, 0x6c, 0x68, 0x1c, 0x00, 0x66, 0x23, 0x11,
+  0x53, 0x44, 0x0e, 0x00, 0x86, 0x03, 0x11, 0x53, 0x16, 0x4e, 0x00, 0x3e, 0x00, 0x00, 0x74, 0x0e, 0x20, 0xf1, 0x6b, 0xb2, 0x2a, 0x42, 0x6f, 0x5b, 0x4e, 0x5b, 0x80, 0x2a, 0xf0, 0x05, 0xec, 0x4a,
+  0xcc, 0x4a, 0xcf, 0x6b, 0x72, 0x7c, 0xd3, 0x8c, 0x72, 0x84, 0xf4, 0x9c, 0xd7, 0xb5, 0x14, 0x9d, 0x76, 0xad, 0xec, 0x26, 0xa0, 0xb7, 0xb5, 0xd8, 0xbd, 0x0d, 0x5b, 0xd4, 0x94, 0x56, 0xad, 0xd0,
+  0x11, 0x00, 0xb8, 0x91, 0x00, 0xcc, 0x58, 0x31, 0x32, 0x84, 0x52, 0x78, 0x03, 0x12, 0x53, 0x7e, 0x03, 0x03, 0x04, 0x00, 0x5b, 0xb4, 0x8c, 0x93, 0x84, 0xb4, 0xe0, 0x18, 0x06, 0xca, 0x0a, 0x02,
+  0xa8, 0x2a, 0x02, 0x02, 0x00, 0x04, 0xaa, 0x0a, 0x62, 0x92, 0x9c, 0x92, 0x9c, 0x71, 0x94, 0x5e, 0x35, 0x00, 0x40, 0x0e, 0x04, 0xe4, 0x18, 0x02, 0x90, 0x23, 0x44, 0xd1, 0xac, 0xb0, 0xa4, 0x14,
+  0x20, 0x71, 0x12, 0xb5, 0xf5, 0xcd, 0xd5, 0xcd, 0x33, 0xd0, 0x4a, 0x40, 0x12, 0xad, 0xd5, 0xc5, 0xaa, 0x43, 0xf0, 0x01, 0x77, 0xde, 0x36, 0xd6, 0x94, 0xbd, 0xb2, 0x3b, 0x14, 0x4c, 0xb2, 0x3b,
+  0x51, 0x33, 0xef, 0x22, 0x5c, 0x03, 0x42, 0xae, 0x12, 0xef, 0x22, 0x2a, 0x2a, 0x00, 0xf8, 0x30, 0x31, 0x92, 0x3b, 0x71, 0xc2, 0x5f, 0x02, 0xb8, 0xb6, 0x00, 0x02, 0x00, 0x41, 0xef, 0x22, 0xef,
+  0x22, 0x40, 0x46, 0x00, 0x68, 0xc8, 0x01, 0x0c, 0x07, 0x20, 0xb6, 0x64, 0xd2, 0x78, 0x20, 0x75, 0x5c, 0xb6, 0x09, 0x00, 0xd8, 0x71, 0x00, 0xa6, 0x02, 0x00, 0xde, 0x6c, 0x00, 0x0e, 0x07, 0x00,
+  0x5c, 0x1c, 0x01, 0xbe, 0x1c, 0x01, 0x28, 0x94, 0x04, 0x04, 0x2e, 0x04, 0x54, 0x2a, 0x00, 0x90, 0x0d, 0x20, 0x6c, 0x0a, 0x12, 0x15, 0x00, 0xac, 0x0a, 0xf1, 0x00, 0xec, 0x2a, 0xec, 0x2a, 0xec,
+  0x22, 0xec, 0x2a, 0x4e, 0x33, 0xf0, 0x4b, 0x52, 0x54, 0x52, 0xf2, 0x1f, 0x00, 0x8a, 0x22, 0x00, 0xda, 0x06, 0x21, 0xb0, 0x3b, 0x06, 0x15, 0x10, 0x33, 0x56, 0x0a, 0x13, 0xed, 0x62, 0x23, 0x00,
+  0xec, 0x11, 0x02, 0xfe, 0x06, 0x22, 0xb0, 0x3b, 0x1c, 0x55, 0x11, 0x0e, 0x28, 0x24, 0x11, 0x4f, 0xee, 0x23, 0x00, 0x08, 0x07, 0x02, 0xc8, 0x66, 0x00, 0x8a, 0x31, 0x00, 0x7a, 0x27, 0x01, 0x14,
+  0xad, 0x01, 0x56, 0x4a, 0x10, 0xcd, 0xb2, 0x19, 0x03, 0xa8, 0x07, 0x12, 0x91, 0xa0, 0x71, 0x12, 0x3b, 0xa2, 0x00, 0x00, 0x6c, 0x19, 0x03, 0x7e, 0x3c, 0x01, 0x5e, 0x0b, 0x22, 0x33, 0x54, 0x88,
+  0xb0, 0x20, 0xf3, 0x4b, 0x26, 0x07, 0x02, 0x8c, 0x0a, 0x00, 0xb0, 0x0a, 0x01, 0x4e, 0x07, 0x10, 0x33, 0xce, 0x3f, 0x01, 0x3c, 0x38, 0x01, 0x44, 0x51, 0x00, 0x12, 0x91, 0x00, 0x28, 0x07, 0x00,
+  0x88, 0x38, 0x00, 0x28, 0x0e, 0x90, 0xae, 0x22, 0xef, 0x2a, 0x70, 0x3b, 0xef, 0x2a, 0x91, 0xe4, 0x20, 0x01, 0xf4, 0xcc, 0xa2, 0xf3, 0x4b, 0xb2, 0x4b, 0x95, 0x64, 0xb6, 0x6c, 0xf3, 0x53, 0xd2,
+  0x46, 0x11, 0x13, 0xf6, 0x34, 0x02, 0x70, 0x86, 0x02, 0x6e, 0x7f, 0x02, 0x74, 0x78, 0x40, 0x70, 0x43, 0xcd, 0x32, 0x28, 0x07, 0x20, 0x50, 0x43, 0xd0, 0x4d, 0x01, 0xe4, 0x3f, 0x30, 0x3b, 0x2f,
+  0x3b, 0xde, 0x38, 0x00, 0xae, 0x4a, 0x00, 0x24, 0x00, 0x21, 0xcd, 0x2a, 0x4a, 0x71, 0x00, 0x02, 0xc6, 0x10, 0x53, 0xc8, 0x26, 0x13, 0xb1, 0xb0, 0x66, 0x00, 0xe4, 0x11, 0x00, 0x9c, 0x0a, 0x00,
+  0x14, 0x15, 0x22, 0x53, 0x64, 0x9a, 0x2a, 0x00, 0xee, 0x14, 0x10, 0x4f, 0xa8, 0x2a, 0xb0, 0x5b, 0xf5, 0x7c, 0x94, 0x6c, 0xf2, 0x5b, 0xd5, 0x74, 0xf6, 0x7c, 0xd0, 0x3f, 0x00, 0xbe, 0x03, 0x00,
+  0xe4, 0x1f, 0x00, 0x38, 0x15, 0x00, 0x84, 0x11, 0x00, 0x08, 0x00, 0x00, 0xd8, 0x03, 0x00, 0x12, 0x0e, 0x00, 0x9a, 0x0a, 0x00, 0x2e, 0x1c, 0x02, 0xb2, 0x5f, 0x00, 0xee, 0x4d, 0x20, 0x2f, 0x43,
+  0x94, 0x11, 0x00, 0x1e, 0x00, 0x20, 0x2f, 0x43, 0x98, 0x11, 0x02, 0x98, 0x03, 0x11, 0x73, 0x56, 0x43, 0x03, 0x66, 0x0a, 0x10, 0x74, 0xba, 0x11, 0x00, 0x1c, 0x07, 0x20, 0x77, 0x95, 0x7a, 0x6a,
+  0x02, 0xcc, 0x38, 0x11, 0xf1, 0x74, 0x23, 0x22, 0x2e, 0x4b, 0x5c, 0x6a, 0x20, 0x12, 0x64, 0x66, 0x1c, 0x02, 0xb0, 0x58, 0x13, 0x6f, 0xb4, 0x03, 0x11, 0x4f, 0xb0, 0xad, 0x00, 0x86, 0x2a, 0x00,
+  0x5a, 0x23, 0x00, 0x4a, 0x35, 0x04, 0x00, 0x27, 0x24, 0xf1, 0x63, 0x7e, 0x03, 0x02, 0x8a, 0x03, 0x00, 0x9e, 0x11, 0x00, 0x34, 0x27, 0x00, 0x32, 0x75, 0x00, 0xc0, 0x0a, 0x00, 0x9a, 0x0a, 0x20,
+  0xf1, 0x6b, 0xc4, 0x0a, 0x11, 0xd0, 0xe0, 0x18, 0x00, 0xd6, 0x3f, 0xf0, 0x09, 0xf0, 0x6b, 0x2d, 0x53, 0x6e, 0x5b, 0xec, 0x52, 0xcf, 0x6b, 0xef, 0x6b, 0x6d, 0x63, 0x10, 0x74, 0x92, 0x84, 0xf4,
+  0x94, 0x55, 0xa5, 0x14, 0x9d, 0x02, 0x00, 0x20, 0x56, 0xa5, 0xd4, 0x3f, 0x80, 0x39, 0xc6, 0x7a, 0xce, 0xb3, 0x94, 0x31, 0x84, 0x90, 0x03, 0x00, 0x92, 0x03, 0x11, 0x52, 0xb0, 0x2a, 0x13, 0x53,
+  0x0a, 0x07, 0x14, 0x74, 0x12, 0x07, 0x06, 0x02, 0x00, 0x0b, 0x34, 0x0e, 0x05, 0x26, 0x07, 0x03, 0xea, 0x38, 0x00, 0xc4, 0x11, 0xb0, 0x72, 0x94, 0x31, 0x8c, 0x30, 0x8c, 0x51, 0x94, 0x71, 0x94,
+  0x71, 0x1a, 0x07, 0x01, 0x0a, 0x20, 0x11, 0x90, 0x02, 0x00, 0x71, 0x70, 0x9c, 0x6f, 0x9c, 0x6f, 0x9c, 0xb0, 0x10, 0x00, 0x00, 0xba, 0x2a, 0x22, 0x2e, 0x94, 0x5c, 0x4e, 0x20, 0x32, 0xb5, 0x06,
+  0x84, 0x00, 0x2a, 0x27, 0x00, 0x18, 0x07, 0x00, 0xa6, 0x87, 0x91, 0x94, 0xc5, 0xb1, 0xa4, 0xb4, 0xc5, 0xd5, 0xcd, 0xf3, 0xe8, 0x49, 0x02, 0xfa, 0x05, 0x00, 0x70, 0x38, 0x00, 0x7a, 0x02, 0x13,
+  0x91, 0xaa, 0x34, 0x00, 0xa0, 0x11, 0x11, 0x13, 0x28, 0x8d, 0x01, 0x3e, 0x0e, 0x23, 0x43, 0xd2, 0xdc, 0x69, 0x04, 0xc6, 0x09, 0x20, 0xf2, 0x43, 0x16, 0x07, 0xf4, 0x03, 0x8d, 0x12, 0xaa, 0x01,
+  0xeb, 0x01, 0x2c, 0x02, 0x89, 0x01, 0x2c, 0x02, 0x8d, 0x12, 0x0b, 0x02, 0x8d, 0x12, 0x6a, 0x66, 0x00, 0xf0, 0x62, 0x00, 0xdc, 0x18, 0x02, 0x36, 0x3f, 0x02, 0x22, 0x71, 0x00, 0xf6, 0x02, 0x02,
+  0x92, 0x66, 0x01, 0x5e, 0x58, 0x00, 0x74, 0x11, 0x70, 0x22, 0xac, 0x1a, 0x6b, 0x12, 0xab, 0x1a, 0x92, 0x03, 0x02, 0x30, 0x23, 0xa0, 0x8b, 0x1a, 0x4a, 0x0a, 0x8c, 0x1a, 0xac, 0x1a, 0x2a, 0x02,
+  0x30, 0x2a, 0x10, 0xac, 0x5e, 0x1f, 0x12, 0x23, 0xe6, 0x1b, 0x11, 0x4f, 0xb8, 0x7b, 0x31, 0xb0, 0x3b, 0x70, 0x98, 0x0a, 0x00, 0x90, 0x0a, 0x00, 0x7a, 0x11, 0x13, 0x90, 0x06, 0x9f, 0x22, 0x50,
+  0x2b, 0xc8, 0x7f, 0x13, 0x90, 0x1c, 0x63, 0x02, 0xba, 0x4d, 0x01, 0xe4, 0x75, 0x21, 0x43, 0x50, 0x92, 0x2e, 0x00, 0x5a, 0x86, 0x20, 0x74, 0x5c, 0x94, 0x00, 0x00, 0xb8, 0x06, 0x20, 0xd2, 0x43,
+  0xc4, 0x8a, 0x21, 0xd2, 0x3b, 0xec, 0x5c, 0x01, 0xfc, 0x31, 0x02, 0xe6, 0x00, 0x02, 0xec, 0x51, 0x10, 0xd1, 0x46, 0x1c, 0x00, 0xf6, 0x07, 0x00, 0xc0, 0x62, 0x01, 0xc0, 0x19, 0x00, 0x9c, 0x19,
+  0x21, 0x34, 0x54, 0xf4, 0x20, 0x01, 0x96, 0x18, 0x00, 0x82, 0x03, 0x80, 0xf2, 0x4b, 0x34, 0x54, 0xd2, 0x4b, 0xf3, 0x4b, 0x06, 0x07, 0x11, 0xb5, 0xa2, 0x11, 0x40, 0x38, 0x7d, 0x17, 0x75, 0x0e,
+  0x00, 0x01, 0xa6, 0x46, 0x22, 0x6c, 0x54, 0x20, 0x07, 0x01, 0x1c, 0xd0, 0x01, 0xb2, 0xd3, 0x01, 0x5c, 0x11, 0x40, 0x6c, 0x22, 0xee, 0x32, 0x94, 0x0a, 0x20, 0x33, 0x5c, 0xdc, 0x54, 0x60, 0xce,
+  0x2a, 0x6c, 0x1a, 0x0e, 0x33, 0x3a, 0x23, 0x40, 0x6c, 0x1a, 0xad, 0x2a, 0x12, 0x43, 0x00, 0x34, 0x2a, 0x20, 0xd2, 0x53, 0x72, 0x03, 0x02, 0xd8, 0x94, 0x02, 0x80, 0x51, 0x20, 0xd2, 0x4b, 0xb4,
+  0x58, 0x04, 0xba, 0x03, 0x00, 0x06, 0x00, 0x11, 0x91, 0x0c, 0x2e, 0x11, 0xb1, 0x9c, 0x94, 0x00, 0x54, 0x2e, 0x00, 0xe2, 0x11, 0x11, 0x32, 0x4e, 0x0e, 0x00, 0x06, 0x55, 0x02, 0x92, 0x03, 0x00,
+  0xaa, 0x0a, 0x00, 0xaa, 0x18, 0x11, 0x2f, 0xac, 0x66, 0x31, 0x74, 0x6c, 0x32, 0x88, 0xc2, 0x02, 0x9c, 0x78, 0x00, 0xe8, 0x0a, 0x00, 0x44, 0x0e, 0x00, 0xc2, 0x18, 0x00, 0x16, 0x20, 0x11, 0x74,
+  0x30, 0x83, 0x42, 0xd5, 0x74, 0x94, 0x6c, 0x86, 0x78, 0x02, 0xc8, 0x06, 0x00, 0x78, 0x0a, 0x60, 0xb5, 0x7c, 0x53, 0x6c, 0xf2, 0x63, 0x4e, 0x1c, 0x00, 0x36, 0x0e, 0x11, 0x94, 0xe4, 0x74, 0x60,
+  0xb0, 0x5b, 0x53, 0x6c, 0x16, 0x85, 0x8e, 0x18, 0x00, 0x3e, 0x03, 0x00, 0x1e, 0x3c, 0x60, 0x0e, 0x43, 0xed, 0x3a, 0xac, 0x32, 0x02, 0x27, 0x22, 0x90, 0x53, 0x06, 0x35, 0x04, 0x04, 0x35, 0x02,
+  0x24, 0x0e, 0x40, 0x8f, 0x53, 0x32, 0x6c, 0x78, 0x0a, 0x20, 0xb0, 0x5b, 0x72, 0x3c, 0x10, 0x4f, 0x00, 0xca, 0x01, 0x00, 0x67, 0x00, 0xb0, 0x31, 0x04, 0xde, 0x46, 0x02, 0xc0, 0x18, 0x02, 0x7e,
+  0x23, 0x00, 0x9c, 0x03, 0x30, 0xb5, 0x7c, 0x33, 0x76, 0x1c, 0x21, 0x6b, 0x32, 0x3a, 0x20, 0x21, 0xf5, 0x8c, 0x42, 0x27, 0x11, 0x84, 0x6c, 0x35, 0x10, 0x63, 0x14, 0x00, 0x11, 0xaf, 0x24, 0x8e,
+  0x31, 0x72, 0x7c, 0x72, 0xce, 0x18, 0xf0, 0x03, 0xb2, 0x84, 0xef, 0x6b, 0xd3, 0x8c, 0x75, 0xa5, 0xf3, 0x94, 0x54, 0x9d, 0x18, 0xb6, 0x75, 0xa5, 0xb7, 0xad, 0xc0, 0x11, 0x00, 0x50, 0x15, 0x60,
+  0x7a, 0xce, 0x9a, 0xce, 0x15, 0x9d, 0x14, 0x07, 0x52, 0xd0, 0x73, 0xf0, 0x7b, 0x11, 0xe6, 0x5f, 0x23, 0x84, 0x72, 0x82, 0x03, 0x22, 0x93, 0x84, 0x38, 0x0e, 0x07, 0x8a, 0x03, 0x0f, 0x90, 0x03,
+  0x02, 0x02, 0x08, 0x19, 0x02, 0xda, 0x51, 0x00, 0x6e, 0x55, 0x33, 0xb2, 0x9c, 0x92, 0x7c, 0x3c, 0x00, 0xa6, 0x0a, 0x06, 0xa0, 0x0a, 0x01, 0x02, 0x00, 0x31, 0xac, 0xb0, 0xac, 0x48, 0x2e, 0x11,
+  0xb4, 0x02, 0x00, 0x01, 0x3a, 0x0e, 0x22, 0x6f, 0x9c, 0x42, 0x0e, 0x62, 0xf1, 0xac, 0x70, 0x9c, 0xf2, 0xac, 0x44, 0xa0, 0x01, 0x12, 0x20, 0x10, 0xcd, 0x54, 0x2e, 0x20, 0x57, 0xde, 0x06, 0x31,
+  0x00, 0x9a, 0x02, 0x02, 0x2e, 0xc1, 0x00, 0xa8, 0x77, 0x02, 0x7e, 0x2d, 0x11, 0x74, 0xe6, 0x6c, 0x00, 0xb6, 0x34, 0x00, 0x90, 0x34, 0x00, 0x12, 0x15, 0x02, 0xd2, 0x4c, 0x02, 0x02, 0x07, 0x00,
+  0xe4, 0x3e, 0x02, 0xd8, 0x1f, 0x31, 0xf2, 0x43, 0x34, 0x26, 0x07, 0x20, 0xf6, 0x6c, 0xc2, 0x09, 0x82, 0xb5, 0x64, 0x17, 0x6d, 0x17, 0x6d, 0x33, 0x54, 0x8c, 0x97, 0x00, 0xc2, 0x17, 0xa0, 0x4f,
+  0x33, 0x6c, 0x12, 0xea, 0x01, 0x4c, 0x0a, 0x4c, 0x0a, 0xcc, 0x29, 0x02, 0x36, 0x07, 0x20, 0x8d, 0x12, 0x06, 0x00, 0x31, 0x90, 0x3b, 0x33, 0x1e, 0x31, 0x00, 0x90, 0x0a, 0xa0, 0x8f, 0x3b, 0xd0,
+  0x43, 0xf1, 0x4b, 0x8f, 0x3b, 0xec, 0x22, 0xd6, 0x11, 0x00, 0xd8, 0x11, 0x00, 0xda, 0x1b, 0x20, 0x2e, 0x2b, 0x78, 0x11, 0x00, 0xf0, 0x42, 0x00, 0x5c, 0x1f, 0x00, 0x04, 0x00, 0x00, 0xb1, 0x12,
+  0x02, 0x0c, 0x07, 0x13, 0x4f, 0x92, 0x27, 0x22, 0x90, 0x3b, 0xe4, 0x7b, 0x04, 0x68, 0x71, 0x22, 0x50, 0x33, 0x78, 0x0a, 0x02, 0x94, 0x11, 0x02, 0x12, 0x00, 0x12, 0x50, 0xae, 0x43, 0x11, 0x4c,
+  0x86, 0x3f, 0x01, 0xf2, 0x15, 0x02, 0x26, 0x4e, 0x11, 0x70, 0x20, 0x7c, 0x02, 0x02, 0x67, 0x51, 0xea, 0x01, 0x0b, 0x02, 0x0b, 0x06, 0x00, 0x00, 0x82, 0x32, 0x00, 0x50, 0x15, 0x00, 0xb0, 0x18,
+  0x00, 0xb8, 0x18, 0x00, 0xa2, 0x89, 0x00, 0x98, 0x18, 0x00, 0x4c, 0x71, 0x00, 0x0c, 0x07, 0x00, 0x62, 0x78, 0x00, 0x88, 0x51, 0x00, 0xb6, 0x11, 0x00, 0xcc, 0x0a, 0x00, 0x20, 0x15, 0x02, 0xbe,
+  0x4d, 0x00, 0x26, 0x07, 0x60, 0x6c, 0x12, 0x0b, 0x0a, 0xae, 0x22, 0xb6, 0x46, 0x00, 0xe6, 0x7b, 0x20, 0x71, 0x3b, 0x3a, 0xd7, 0x00, 0x9e, 0x11, 0xa0, 0x34, 0x5c, 0x95, 0x64, 0xb1, 0x43, 0xad,
+  0x22, 0x2f, 0x3b, 0x02, 0x19, 0x20, 0xd6, 0x74, 0x02, 0x00, 0x60, 0x95, 0x6c, 0x16, 0x7d, 0x95, 0x6c, 0xa8, 0x0a, 0x00, 0x58, 0x23, 0x02, 0x32, 0x23, 0x00, 0xba, 0x11, 0x71, 0xd1, 0x53, 0x91,
+  0x4b, 0xd2, 0x53, 0x13, 0xae, 0x18, 0x00, 0x98, 0x03, 0x10, 0x2f, 0x56, 0x0e, 0x21, 0x22, 0x70, 0xb0, 0x51, 0x10, 0x53, 0xd8, 0x0a, 0x12, 0x64, 0x2a, 0x7c, 0x60, 0x95, 0x6c, 0x16, 0x75, 0xf6,
+  0x74, 0x02, 0x00, 0x10, 0x33, 0x64, 0x78, 0x01, 0x82, 0x31, 0x02, 0x66, 0x71, 0x00, 0x46, 0x0e, 0x00, 0x60, 0x03, 0x40, 0xb5, 0x6c, 0x33, 0x64, 0x2c, 0x1c, 0x22, 0xb1, 0x53, 0x60, 0x23, 0x11,
+  0xb1, 0xc8, 0x1f, 0x82, 0x2e, 0x3b, 0x8c, 0x2a, 0xcd, 0x32, 0x2f, 0x43, 0x90, 0x2a, 0xf0, 0x03, 0x2e, 0x3b, 0x6c, 0x2a, 0xc9, 0x09, 0x2f, 0x43, 0x2f, 0x43, 0xee, 0x32, 0x0a, 0x1a, 0xee, 0x3a,
+  0xb0, 0x53, 0x98, 0x0a, 0x21, 0xf2, 0x5b, 0xfa, 0x0a, 0x50, 0x5b, 0x0e, 0x43, 0x4f, 0x4b, 0x9a, 0x0a, 0x00, 0x1a, 0x3c, 0x22, 0xf2, 0x63, 0x44, 0x3c, 0x40, 0x36, 0x85, 0xb4, 0x74, 0xde, 0x1f,
+  0x20, 0xac, 0x32, 0xd4, 0x11, 0x00, 0xa6, 0x11, 0x42, 0xf2, 0x63, 0x4f, 0x4b, 0xc8, 0x18, 0x40, 0x73, 0x74, 0x97, 0x95, 0x8a, 0x0a, 0x00, 0x2a, 0x23, 0x10, 0x53, 0x46, 0x43, 0x03, 0xbe, 0x5f,
+  0x02, 0xac, 0x18, 0x00, 0xfc, 0x18, 0x00, 0x7c, 0x71, 0x80, 0x98, 0x95, 0x16, 0x8d, 0x15, 0x85, 0x16, 0x8d, 0x5c, 0x8a, 0x22, 0x94, 0x7c, 0xa6, 0x23, 0x20, 0x11, 0x6c, 0x14, 0x55, 0x11, 0x53,
+  0xa0, 0x11, 0x00, 0xc6, 0x31, 0x10, 0x73, 0x12, 0x07, 0x41, 0x6c, 0x74, 0x7c, 0x53, 0x4e, 0x0e, 0x00, 0x0e, 0x55, 0x00, 0xca, 0x03, 0x00, 0x2c, 0x35, 0x11, 0xf1, 0x88, 0x03, 0x10, 0x8f, 0x3c,
+  0x27, 0x01, 0xee, 0x5f, 0xf0, 0x05, 0x93, 0x7c, 0x14, 0x8d, 0x92, 0x84, 0xcf, 0x63, 0xaf, 0x63, 0xb3, 0x84, 0xd3, 0x8c, 0x30, 0x7c, 0xae, 0x6b, 0x71, 0x84, 0x8c, 0x03, 0x30, 0x14, 0x9d, 0x96,
+  0x5e, 0x1c, 0xd0, 0xad, 0xd7, 0xb5, 0xd7, 0xb5, 0xb3, 0x8c, 0x6e, 0x6b, 0x0d, 0x5b, 0x8f, 0x6b, 0x10, 0x27, 0x22, 0x52, 0x84, 0x4e, 0x23, 0x04, 0x8e, 0x03, 0x11, 0x93, 0x10, 0x00, 0x0a, 0x7a,
+  0x03, 0x1d, 0x94, 0x02, 0x00, 0x17, 0xb4, 0x20, 0x07, 0x00, 0x84, 0x3c, 0x11, 0x72, 0x02, 0x00, 0x00, 0x2a, 0x0e, 0x04, 0x2e, 0x0e, 0x22, 0x70, 0x9c, 0x84, 0x03, 0x11, 0xd0, 0x04, 0x00, 0x11,
+  0xd1, 0x88, 0x03, 0x02, 0x06, 0x00, 0x00, 0xb0, 0x0a, 0x00, 0x30, 0x07, 0x02, 0x64, 0x15, 0x00, 0x44, 0x2e, 0x40, 0x73, 0xbd, 0x53, 0xbd, 0xba, 0x0a, 0x00, 0x22, 0x07, 0x04, 0x12, 0x59, 0x00,
+  0x36, 0x99, 0x02, 0x04, 0x94, 0x31, 0x16, 0x6d, 0xf5, 0x96, 0x1f, 0x20, 0x53, 0x54, 0xaa, 0x0d, 0x02, 0xfa, 0x45, 0x60, 0xee, 0x22, 0xb0, 0x3b, 0x2f, 0x2b, 0x24, 0x0a, 0x11, 0x0e, 0x50, 0x27,
+  0x00, 0x52, 0xba, 0x02, 0x88, 0x77, 0x00, 0xa4, 0x57, 0x00, 0xc6, 0x17, 0x00, 0x16, 0x0d, 0x02, 0xac, 0x42, 0x00, 0xf2, 0xc4, 0x01, 0xe8, 0x2d, 0x00, 0xe2, 0x3b, 0x03, 0x22, 0x94, 0x11, 0xd2,
+  0x54, 0x82, 0x00, 0x38, 0x70, 0x11, 0xd6, 0xae, 0x03, 0x00, 0x14, 0x62, 0x02, 0x98, 0xba, 0x02, 0xfe, 0x97, 0x11, 0x53, 0x3c, 0x4d, 0x01, 0x76, 0x74, 0xa1, 0x2b, 0x0d, 0x2b, 0x6b, 0x12, 0x0a,
+  0x02, 0x2a, 0x02, 0x8b, 0x68, 0x2d, 0x00, 0x12, 0x00, 0x02, 0xfe, 0x30, 0x00, 0x7a, 0x11, 0x11, 0x4f, 0x50, 0x7f, 0x02, 0xa2, 0x1c, 0x02, 0xf4, 0x42, 0x00, 0x5a, 0x07, 0x00, 0x02, 0x00, 0x13,
+  0x90, 0xc6, 0x7b, 0x01, 0xfa, 0x42, 0x01, 0xac, 0x15, 0x00, 0x04, 0x00, 0x02, 0xce, 0x66, 0x02, 0xc8, 0x8d, 0x00, 0xbe, 0x58, 0x02, 0x1a, 0xc2, 0x11, 0x91, 0x64, 0x3c, 0x01, 0xac, 0x07, 0x00,
+  0x26, 0x03, 0x50, 0x33, 0xef, 0x22, 0xae, 0x1a, 0x22, 0x0e, 0x00, 0xb8, 0x52, 0x02, 0x40, 0x2f, 0x02, 0x1c, 0x07, 0x00, 0x96, 0x04, 0x00, 0x64, 0x00, 0x22, 0xac, 0x1a, 0x6a, 0x31, 0x02, 0xce,
+  0x90, 0x00, 0x82, 0xb0, 0x22, 0x4f, 0x33, 0xc4, 0x8d, 0x12, 0x0f, 0x02, 0x9c, 0x01, 0x10, 0x55, 0x11, 0xad, 0x28, 0x8a, 0x00, 0x02, 0x4e, 0x00, 0x30, 0x51, 0x00, 0xe4, 0x7b, 0x02, 0x34, 0x63,
+  0x00, 0x5a, 0x15, 0x00, 0x40, 0x0e, 0x00, 0x6a, 0x23, 0x00, 0x3a, 0x43, 0x40, 0xd6, 0x74, 0x74, 0x64, 0xcc, 0x9b, 0x50, 0x37, 0x7d, 0x53, 0x5c, 0x2f, 0xfe, 0xa2, 0x01, 0x28, 0x71, 0x10, 0x4f,
+  0x60, 0x4a, 0x21, 0x2a, 0x8d, 0xe4, 0x74, 0x22, 0x70, 0x43, 0x1a, 0x63, 0x40, 0xad, 0x2a, 0x6c, 0x22, 0x8a, 0x5f, 0x42, 0xd2, 0x53, 0xee, 0x32, 0xd8, 0x3f, 0x11, 0x2f, 0x9a, 0x78, 0x00, 0x82,
+  0x43, 0x00, 0x02, 0xc6, 0x02, 0x2e, 0xbf, 0x02, 0xa6, 0x86, 0x02, 0x46, 0x43, 0x02, 0xd8, 0x38, 0x21, 0x6f, 0x43, 0x46, 0x98, 0x01, 0xba, 0x1f, 0x13, 0xb1, 0x16, 0x91, 0x00, 0x28, 0x35, 0x40,
+  0x70, 0x4b, 0x90, 0x53, 0x86, 0x58, 0x02, 0x60, 0x03, 0x00, 0xfa, 0x4d, 0x00, 0xa0, 0x51, 0x00, 0x94, 0x11, 0x00, 0xa8, 0x0a, 0x00, 0x18, 0x07, 0xa2, 0xf6, 0x7c, 0xf6, 0x7c, 0x37, 0x85, 0x33,
+  0x64, 0x54, 0x6c, 0xcc, 0xc2, 0xc0, 0x0e, 0x3b, 0x2f, 0x43, 0x0e, 0x3b, 0xcd, 0x32, 0xed, 0x3a, 0xcd, 0x32, 0xd2, 0x18, 0x40, 0x2e, 0x4b, 0x4f, 0x4b, 0x6a, 0x0a, 0x02, 0x56, 0x23, 0x00, 0x72,
+  0x38, 0x21, 0xed, 0x42, 0x26, 0x2e, 0x10, 0x63, 0x7e, 0x1c, 0x02, 0x1a, 0x07, 0x11, 0xd1, 0xf0, 0x2d, 0x02, 0xba, 0x26, 0x01, 0x8e, 0x11, 0x01, 0xba, 0x11, 0x00, 0x80, 0x03, 0x02, 0xa6, 0x03,
+  0x02, 0x46, 0x4a, 0x00, 0x02, 0x00, 0x00, 0xdc, 0x18, 0x20, 0x4f, 0x53, 0xf4, 0x0a, 0x11, 0x6f, 0x34, 0xd1, 0x12, 0xd0, 0x08, 0xc3, 0x01, 0x32, 0x75, 0x00, 0xe0, 0x31, 0x00, 0xac, 0x0a, 0x00,
+  0x42, 0x43, 0x20, 0x16, 0x8d, 0xb4, 0x0a, 0x00, 0xae, 0x0a, 0x00, 0x3e, 0x0e, 0x11, 0x74, 0xac, 0x0a, 0x12, 0x53, 0xe4, 0x31, 0x12, 0x6b, 0x4a, 0x55, 0x11, 0x32, 0xc2, 0x38, 0xf0, 0x1d, 0xf4,
+  0x8c, 0x14, 0x8d, 0xcf, 0x6b, 0x4d, 0x5b, 0x0c, 0x53, 0xf0, 0x6b, 0x6d, 0x63, 0xeb, 0x52, 0xcb, 0x4a, 0xf3, 0x94, 0x55, 0x9d, 0x96, 0xad, 0x14, 0x9d, 0x75, 0xa5, 0xb2, 0x8c, 0x71, 0x84, 0xb3,
+  0x8c, 0xf0, 0x73, 0x10, 0x7c, 0xaf, 0x6b, 0x6e, 0x6b, 0xf0, 0x7b, 0x44, 0x03, 0x02, 0x86, 0x03, 0x08, 0x1a, 0x07, 0x03, 0x20, 0x07, 0x0e, 0xcc, 0x18, 0x0b, 0x02, 0x00, 0x17, 0xd4, 0xa8, 0x0a,
+  0x00, 0xc4, 0x31, 0x01, 0xfe, 0x1f, 0x00, 0x4c, 0x15, 0x01, 0x2e, 0x0e, 0x04, 0xfe, 0x58, 0x11, 0xd0, 0x8a, 0x03, 0x04, 0x8e, 0x03, 0x02, 0x90, 0x03, 0x00, 0x22, 0x07, 0x04, 0x04, 0x59, 0x60,
+  0x73, 0xbd, 0xf1, 0xac, 0x53, 0xbd, 0xde, 0x8a, 0x00, 0x40, 0x47, 0x11, 0xb4, 0x1a, 0x07, 0x02, 0x64, 0x4e, 0x01, 0xca, 0x63, 0x10, 0xd6, 0x64, 0x22, 0x00, 0xfc, 0x02, 0x20, 0x8f, 0x3b, 0x14,
+  0x03, 0x20, 0x6b, 0x12, 0xf8, 0x1b, 0x00, 0x26, 0x0a, 0x00, 0x88, 0x34, 0x00, 0x94, 0x02, 0x00, 0x1e, 0x00, 0x00, 0x1c, 0x1f, 0x00, 0xf8, 0x17, 0x02, 0xec, 0x10, 0x02, 0x70, 0x70, 0x00, 0x58,
+  0x0d, 0x11, 0x54, 0xfc, 0x4c, 0x00, 0x36, 0x06, 0x00, 0x9e, 0x03, 0x02, 0x22, 0x0a, 0x02, 0xce, 0x57, 0x11, 0xd2, 0x48, 0xda, 0x11, 0x70, 0x2c, 0x2d, 0x11, 0xd2, 0x72, 0x74, 0x04, 0xec, 0x85,
+  0x22, 0x33, 0x54, 0x40, 0x03, 0x60, 0x4f, 0x33, 0xad, 0x1a, 0x2b, 0x02, 0x26, 0x38, 0x00, 0xb4, 0x11, 0x30, 0x2e, 0x2b, 0x4f, 0x86, 0x0a, 0x01, 0x84, 0x1c, 0x00, 0x64, 0x18, 0x02, 0x06, 0x15,
+  0x01, 0x26, 0x15, 0x01, 0x0e, 0x31, 0x13, 0xad, 0x7a, 0x18, 0x11, 0x50, 0x32, 0x31, 0x00, 0xae, 0x4d, 0x02, 0x58, 0x86, 0x12, 0xd1, 0xc2, 0xa2, 0x01, 0x88, 0x03, 0x11, 0x91, 0x12, 0x07, 0x20,
+  0x0e, 0x23, 0xd6, 0x11, 0x00, 0x44, 0x23, 0x31, 0x8c, 0x12, 0x90, 0x98, 0x11, 0x00, 0x0a, 0x1c, 0x02, 0x40, 0xbb, 0x42, 0x2b, 0x02, 0x6d, 0x12, 0xa2, 0x00, 0x00, 0xee, 0x46, 0x02, 0xfc, 0x46,
+  0x00, 0x2a, 0x07, 0x00, 0xc2, 0x12, 0x00, 0x02, 0x08, 0x02, 0xb6, 0xb7, 0x00, 0x30, 0x04, 0x00, 0x66, 0x12, 0x00, 0xa4, 0x62, 0x11, 0x8f, 0x7a, 0x54, 0x00, 0xaa, 0x82, 0x02, 0x0a, 0xa6, 0x00,
+  0xf0, 0x00, 0x00, 0xda, 0x89, 0x00, 0x12, 0x2f, 0x31, 0xd5, 0x6c, 0x33, 0x28, 0x43, 0x00, 0xfa, 0x5b, 0x11, 0x13, 0x38, 0x36, 0x00, 0xde, 0x00, 0x20, 0xf6, 0x6c, 0x70, 0xc2, 0x21, 0x17, 0x75,
+  0xe0, 0x26, 0x10, 0x5c, 0x10, 0x63, 0x00, 0xaa, 0x54, 0x11, 0x13, 0x88, 0x3f, 0x02, 0xd4, 0x54, 0x60, 0x37, 0x7d, 0x78, 0x85, 0x57, 0x7d, 0x62, 0x3c, 0x20, 0x78, 0x85, 0x24, 0x07, 0x20, 0xd6,
+  0x74, 0x08, 0x5c, 0x11, 0xd1, 0x9a, 0x0a, 0x02, 0x70, 0x78, 0x61, 0x50, 0x43, 0xad, 0x2a, 0x0f, 0x3b, 0xce, 0x26, 0x02, 0x8e, 0xbb, 0x70, 0x64, 0xd2, 0x53, 0x50, 0x43, 0x50, 0x43, 0xa0, 0x0a,
+  0x82, 0xee, 0x32, 0x4b, 0x1a, 0xad, 0x2a, 0x70, 0x43, 0x80, 0x78, 0x11, 0xce, 0xcc, 0x03, 0x00, 0x68, 0x1c, 0x02, 0x64, 0x71, 0x20, 0x8c, 0x2a, 0x38, 0x15, 0x00, 0xc2, 0x1f, 0x02, 0xfc, 0x06,
+  0x00, 0x02, 0x00, 0x91, 0x2f, 0x43, 0x4f, 0x4b, 0x2f, 0x43, 0x2e, 0x3b, 0xb1, 0x42, 0x1c, 0x00, 0x26, 0x00, 0x11, 0xb1, 0x24, 0x2e, 0x01, 0x20, 0x2e, 0x01, 0x8c, 0x11, 0x00, 0x3c, 0x07, 0x02,
+  0x72, 0x15, 0x20, 0xb1, 0x53, 0x82, 0x23, 0x00, 0x84, 0x23, 0x00, 0x88, 0x2a, 0x00, 0x30, 0x1c, 0x02, 0xf2, 0xb0, 0x01, 0x60, 0x03, 0x12, 0x64, 0x10, 0x43, 0x02, 0x30, 0x2e, 0x20, 0xd1, 0x5b,
+  0x2e, 0x07, 0x10, 0x74, 0x26, 0x03, 0x01, 0x74, 0x03, 0x02, 0x1a, 0x0e, 0x00, 0x3c, 0x3c, 0x00, 0x28, 0x0e, 0x11, 0xd1, 0xf8, 0x2d, 0x00, 0x56, 0xc6, 0x11, 0x94, 0x46, 0x43, 0x01, 0x2a, 0x4a,
+  0x03, 0x38, 0x43, 0x13, 0x94, 0x72, 0x23, 0x40, 0xd5, 0x84, 0x94, 0x74, 0xaa, 0x0a, 0x40, 0x94, 0x7c, 0xd4, 0x7c, 0x40, 0x2e, 0x02, 0x58, 0x1c, 0x00, 0x0c, 0x07, 0x02, 0xba, 0xcd, 0x22, 0xed,
+  0x42, 0xf4, 0x1f, 0xa0, 0xb5, 0x84, 0x94, 0x7c, 0x33, 0x74, 0xf1, 0x6b, 0x33, 0x74, 0xa0, 0x03, 0x00, 0xd2, 0x3f, 0x00, 0x72, 0xa3, 0x02, 0x48, 0x15, 0xf0, 0x13, 0x72, 0x7c, 0xaf, 0x63, 0xec,
+  0x4a, 0x4d, 0x5b, 0xf0, 0x73, 0xcf, 0x6b, 0x2c, 0x5b, 0x2d, 0x5b, 0xef, 0x73, 0x71, 0x84, 0xcf, 0x73, 0xae, 0x6b, 0x14, 0x9d, 0xf8, 0xbd, 0xd3, 0x94, 0x8e, 0x6b, 0x10, 0x7c, 0xf2, 0x26, 0x71,
+  0xf4, 0x94, 0x72, 0x84, 0x72, 0x8c, 0xb3, 0x14, 0x07, 0x08, 0xa0, 0x0a, 0x04, 0xc2, 0x11, 0x02, 0x44, 0x15, 0x0e, 0x0c, 0x07, 0x0a, 0x8e, 0x03, 0x02, 0xac, 0x63, 0x00, 0x8e, 0x03, 0x10, 0x94,
+  0xc0, 0x11, 0x01, 0xbe, 0x9c, 0x3b, 0x71, 0x94, 0x91, 0x8e, 0x03, 0x13, 0xb0, 0x92, 0x03, 0x04, 0x02, 0x00, 0x00, 0x8a, 0x03, 0x02, 0x9c, 0x03, 0x40, 0x12, 0xb5, 0x32, 0xbd, 0x0c, 0x00, 0x00,
+  0x82, 0x1c, 0x80, 0xd5, 0xcd, 0x90, 0xa4, 0x73, 0xbd, 0xf6, 0xcd, 0x22, 0x27, 0x02, 0x9e, 0x5c, 0x04, 0xb2, 0x0a, 0x20, 0x6f, 0x33, 0x80, 0x22, 0x30, 0x2e, 0x33, 0xcc, 0xae, 0x1b, 0x10, 0x33,
+  0xe0, 0x22, 0x00, 0xec, 0x14, 0x00, 0xc6, 0x0d, 0x00, 0xf6, 0x1b, 0x42, 0x4e, 0x33, 0x0d, 0x23, 0xf2, 0x37, 0x00, 0xa8, 0x37, 0x00, 0xc6, 0x50, 0x00, 0x9a, 0x06, 0x00, 0x12, 0x06, 0x00, 0x3e,
+  0x90, 0x00, 0x2a, 0x3b, 0x00, 0xca, 0x17, 0x20, 0xd6, 0x64, 0x86, 0x69, 0x00, 0x3a, 0x54, 0x00, 0x4a, 0x74, 0x02, 0x66, 0x4d, 0x11, 0xf2, 0x6e, 0x66, 0x00, 0x68, 0xa9, 0x00, 0xf6, 0x4c, 0x00,
+  0x4a, 0x06, 0x00, 0xf8, 0x4c, 0x02, 0xde, 0x1b, 0x00, 0x48, 0x06, 0x11, 0x8c, 0x06, 0x07, 0x00, 0xce, 0xb3, 0x00, 0x06, 0x1c, 0x02, 0xfe, 0x3b, 0x00, 0x74, 0x03, 0x00, 0xfa, 0x70, 0x03, 0xdc,
+  0xd6, 0x01, 0xe6, 0x89, 0x02, 0x08, 0x9f, 0x22, 0xb1, 0x43, 0xf6, 0xc8, 0x00, 0x90, 0x35, 0x00, 0x44, 0x5f, 0x02, 0x80, 0x6d, 0x00, 0x8a, 0x03, 0x10, 0xad, 0xd4, 0x3b, 0x11, 0x33, 0x4c, 0xda,
+  0x01, 0xb6, 0x07, 0x02, 0xd6, 0x74, 0x02, 0x20, 0x98, 0x11, 0x2e, 0x62, 0x78, 0x11, 0x13, 0xe2, 0x89, 0x00, 0x2c, 0x23, 0x02, 0xec, 0x46, 0x00, 0x74, 0x0b, 0x00, 0x30, 0x04, 0x11, 0x2f, 0x46,
+  0x3c, 0x00, 0xd0, 0x0a, 0x01, 0x38, 0x4a, 0x10, 0x22, 0x0a, 0x00, 0x22, 0x0e, 0x2b, 0x88, 0x03, 0xa0, 0xf1, 0x4b, 0x11, 0x54, 0x31, 0x54, 0x11, 0x54, 0xd0, 0x4b, 0xde, 0x49, 0x00, 0xec, 0x90,
+  0xd0, 0x4f, 0x3b, 0xed, 0x2a, 0x8c, 0x1a, 0x4b, 0x0a, 0x8b, 0x1a, 0xcd, 0x22, 0x4f, 0xac, 0x07, 0x03, 0x50, 0xc2, 0x02, 0x66, 0x9f, 0x13, 0x4f, 0x68, 0x98, 0x02, 0x9e, 0x66, 0x00, 0xf6, 0x07,
+  0x81, 0xc9, 0x01, 0x4b, 0x12, 0x2b, 0x0a, 0x88, 0x01, 0x84, 0x38, 0x12, 0x32, 0x1a, 0x8a, 0xe0, 0x50, 0x43, 0x0a, 0x12, 0xad, 0x2a, 0x4b, 0x1a, 0x4b, 0x1a, 0xce, 0x2a, 0xd2, 0x53, 0xf2, 0x82,
+  0x10, 0xb1, 0x7e, 0x6a, 0x10, 0x64, 0x58, 0x15, 0x12, 0xd2, 0x6a, 0x6a, 0x00, 0x28, 0x0e, 0x12, 0x64, 0x0a, 0x00, 0x20, 0x95, 0x6c, 0x38, 0x0e, 0x02, 0x76, 0xd0, 0x00, 0x98, 0x4a, 0x40, 0x91,
+  0x4b, 0xd1, 0x53, 0x54, 0x0e, 0x02, 0x6a, 0x98, 0x00, 0x44, 0x07, 0x02, 0xb8, 0xc9, 0x01, 0xb4, 0xd0, 0x01, 0xea, 0x82, 0x00, 0xa8, 0x23, 0x11, 0x33, 0xc0, 0x03, 0x62, 0x74, 0x6c, 0xd5, 0x7c,
+  0xf6, 0x7c, 0xb6, 0x38, 0x00, 0x22, 0x07, 0x20, 0xf2, 0x5b, 0x70, 0x03, 0x30, 0xb0, 0x4b, 0x70, 0xba, 0x23, 0x01, 0x6e, 0x03, 0x20, 0xb1, 0x53, 0x90, 0x1c, 0x60, 0x12, 0x5c, 0xb5, 0x74, 0x94,
+  0x74, 0xca, 0x0a, 0x51, 0x53, 0x6c, 0xd2, 0x5b, 0x91, 0x88, 0x15, 0x20, 0x74, 0x6c, 0x40, 0x00, 0x20, 0x94, 0x74, 0x7a, 0x1c, 0x00, 0xd0, 0x46, 0x11, 0xb0, 0xb4, 0x03, 0x00, 0xd8, 0x26, 0x00,
+  0x16, 0x07, 0x11, 0xb4, 0x50, 0x0e, 0x00, 0xe6, 0x0d, 0x00, 0x56, 0x0e, 0x11, 0x33, 0x54, 0x0e, 0x40, 0x74, 0x74, 0x94, 0x7c, 0xbc, 0x26, 0x00, 0xaa, 0x26, 0x00, 0xe8, 0x54, 0x11, 0xd5, 0xfe,
+  0x0d, 0x73, 0x36, 0x8d, 0x37, 0x95, 0x74, 0x74, 0x53, 0xf8, 0x1f, 0x00, 0x06, 0x00, 0x11, 0xd1, 0xa4, 0x03, 0x01, 0xf2, 0x06, 0x00, 0xcc, 0x31, 0x00, 0xae, 0x18, 0x01, 0xde, 0x5f, 0x00, 0x7a,
+  0x0a, 0x13, 0x52, 0xce, 0x38, 0x00, 0xe8, 0x0a, 0x10, 0x94, 0xac, 0x03, 0x03, 0xfe, 0x26, 0x00, 0x48, 0x15, 0x00, 0xc2, 0x0a, 0x20, 0x74, 0x7c, 0x8c, 0x03, 0x00, 0x3c, 0x00, 0x02, 0x8c, 0x03,
+  0x00, 0x0e, 0xb5, 0xe0, 0xaf, 0x5b, 0xec, 0x4a, 0x8e, 0x5b, 0x10, 0x74, 0xcf, 0x6b, 0x2c, 0x53, 0xae, 0x63, 0x94, 0x03, 0xf0, 0x09, 0x29, 0x3a, 0x96, 0xad, 0xb6, 0xad, 0xaf, 0x73, 0x0c, 0x5b,
+  0x4d, 0x63, 0x51, 0x84, 0x10, 0x7c, 0x10, 0x7c, 0xaf, 0x73, 0xf0, 0x73, 0x6e, 0x63, 0x32, 0x0e, 0x40, 0x32, 0x84, 0x11, 0x7c, 0x02, 0x00, 0x23, 0x32, 0x84, 0x24, 0x6e, 0x14, 0x7c, 0x96, 0x03,
+  0x00, 0xb0, 0x0a, 0x0e, 0x1c, 0x07, 0x0d, 0x90, 0x03, 0x07, 0x20, 0x07, 0x20, 0xb3, 0x94, 0xec, 0x71, 0x00, 0xd6, 0x51, 0x60, 0x91, 0x9c, 0x4f, 0x9c, 0x2e, 0x94, 0xb4, 0x11, 0x01, 0x8e, 0x03,
+  0x11, 0xa4, 0x8e, 0x03, 0x11, 0xb4, 0x8c, 0x03, 0x03, 0x36, 0x0e, 0x40, 0x11, 0xb5, 0xf1, 0xb4, 0x8a, 0x03, 0x01, 0xf0, 0x18, 0x02, 0x04, 0x20, 0x00, 0xa4, 0x0a, 0x51, 0xcd, 0xb4, 0xc5, 0x12,
+  0xb5, 0x7a, 0x1c, 0x10, 0xbd, 0x66, 0x4e, 0x00, 0x1c, 0x07, 0x00, 0x68, 0x15, 0x22, 0x2e, 0x2b, 0x4a, 0x37, 0x00, 0x10, 0x07, 0x10, 0xab, 0xe8, 0x14, 0x01, 0x8e, 0x03, 0x00, 0x64, 0x11, 0x02,
+  0x6a, 0x11, 0x00, 0xca, 0x0d, 0x00, 0x42, 0x0a, 0x13, 0xd1, 0xfa, 0x81, 0x00, 0xd4, 0x02, 0x02, 0x84, 0x69, 0x04, 0x6c, 0xdd, 0x02, 0xda, 0x1f, 0x31, 0xad, 0x1a, 0xef, 0xd2, 0x02, 0x11, 0x74,
+  0x42, 0x26, 0x00, 0x52, 0x0e, 0x11, 0x95, 0x00, 0x03, 0x11, 0x95, 0x38, 0x54, 0x11, 0x13, 0x1c, 0x7b, 0x02, 0x0e, 0x6d, 0x00, 0x3a, 0x7b, 0x00, 0xfa, 0x30, 0x02, 0xc6, 0x97, 0x00, 0x18, 0x58,
+  0x00, 0x32, 0x27, 0x02, 0x78, 0x07, 0x02, 0x36, 0x0a, 0x02, 0x0e, 0x98, 0x02, 0xa8, 0x46, 0x02, 0x72, 0x9f, 0x02, 0x24, 0x51, 0x11, 0x50, 0x2e, 0x39, 0x20, 0xef, 0x22, 0x30, 0x0b, 0x80, 0xae,
+  0x1a, 0x6c, 0x12, 0xca, 0x01, 0xea, 0x01, 0x2e, 0x2a, 0xa0, 0x4c, 0x0a, 0xad, 0x22, 0xad, 0x1a, 0x2b, 0x0a, 0x8d, 0x1a, 0xc0, 0x0d, 0x00, 0xea, 0x03, 0x11, 0x2f, 0xae, 0xb7, 0x11, 0x6f, 0x14,
+  0x9f, 0x40, 0x2b, 0x0a, 0x8c, 0x12, 0x6c, 0x3f, 0x02, 0xd8, 0xa9, 0x00, 0x1c, 0x23, 0x00, 0xf8, 0x62, 0x04, 0xa4, 0x0a, 0x02, 0x58, 0x51, 0x02, 0x96, 0x78, 0x00, 0x5a, 0xb4, 0x00, 0xf2, 0x97,
+  0x00, 0x8e, 0x03, 0xf0, 0x01, 0xb0, 0x43, 0xd0, 0x4b, 0xcc, 0x22, 0x93, 0x64, 0xd4, 0x6c, 0x93, 0x64, 0x15, 0x75, 0x15, 0x75, 0x08, 0x00, 0x00, 0x9e, 0xb0, 0x00, 0x1c, 0x00, 0x11, 0x32, 0xaa,
+  0x9b, 0x00, 0x6e, 0x58, 0x00, 0x36, 0x2e, 0x00, 0xd2, 0x89, 0x00, 0x5e, 0x67, 0x00, 0x7a, 0xbb, 0x00, 0x6c, 0x4a, 0x00, 0x46, 0xbb, 0x04, 0x20, 0xaa, 0x02, 0x26, 0xb4, 0x11, 0xd1, 0xa8, 0x3f,
+  0x11, 0xb0, 0x7a, 0x66, 0x00, 0x68, 0x03, 0x20, 0xf6, 0x74, 0x34, 0x0e, 0x11, 0x94, 0x22, 0x07, 0x20, 0x17, 0x7d, 0x6c, 0x03, 0x00, 0xfc, 0x0d, 0x02, 0x7c, 0x58, 0x51, 0x70, 0x43, 0xad, 0x2a,
+  0x91, 0x94, 0x5f, 0x00, 0x80, 0x43, 0x00, 0xd2, 0x0a, 0x11, 0x2f, 0x10, 0x4e, 0x00, 0xe8, 0x06, 0x02, 0xc0, 0x0a, 0x62, 0x0e, 0x3b, 0x2b, 0x1a, 0x4b, 0x22, 0x24, 0x4e, 0x11, 0x91, 0x5c, 0xc6,
+  0x01, 0x4a, 0xd4, 0x03, 0x42, 0x23, 0x00, 0x58, 0x91, 0x20, 0x70, 0x4b, 0x40, 0x0a, 0x01, 0xec, 0x06, 0x10, 0x6c, 0x8c, 0x0a, 0x20, 0x16, 0x85, 0x44, 0x0e, 0x00, 0x58, 0x15, 0x00, 0xea, 0xc9,
+  0x02, 0xa4, 0x03, 0x20, 0x33, 0x64, 0x7a, 0x03, 0x32, 0xf6, 0x7c, 0xd1, 0x5a, 0x38, 0x30, 0x64, 0x91, 0x53, 0x12, 0x00, 0x62, 0xf2, 0x63, 0x70, 0x4b, 0xd2, 0x5b, 0x3a, 0x07, 0x22, 0xb0, 0x5b,
+  0x80, 0x31, 0x40, 0x74, 0x74, 0x33, 0x6c, 0x72, 0x03, 0x60, 0x16, 0x85, 0x37, 0x8d, 0xf5, 0x84, 0xb4, 0x4d, 0x11, 0x90, 0x84, 0xd4, 0x11, 0xb0, 0xf2, 0x4d, 0x22, 0xf1, 0x63, 0xd2, 0x26, 0x02,
+  0x34, 0xb8, 0x00, 0xbc, 0x03, 0x00, 0x74, 0x03, 0x20, 0x4f, 0x53, 0xec, 0x0d, 0x31, 0x70, 0x53, 0xd1, 0xc0, 0x1f, 0x00, 0x02, 0x35, 0x02, 0x14, 0x0e, 0x11, 0x94, 0xb8, 0x0a, 0x12, 0x94, 0x58,
+  0x8a, 0x12, 0x4b, 0x58, 0x35, 0x02, 0x76, 0x0e, 0x01, 0x3a, 0x63, 0x12, 0x6c, 0x2a, 0x2e, 0x02, 0x4a, 0xd1, 0x02, 0x64, 0x15, 0x02, 0xf8, 0x1f, 0x00, 0x58, 0x07, 0x00, 0x0e, 0x27, 0x40, 0x56,
+  0x95, 0x53, 0x74, 0xf0, 0x7f, 0x50, 0xb0, 0x63, 0xaf, 0x63, 0xd0, 0x92, 0x03, 0x70, 0x63, 0x8e, 0x63, 0x2d, 0x5b, 0x8e, 0x63, 0x34, 0x0e, 0x40, 0xcb, 0x4a, 0xaa, 0x4a, 0x88, 0xb1, 0xf2, 0x03,
+  0xef, 0x73, 0xd7, 0xb5, 0xcf, 0x73, 0xcf, 0x73, 0x31, 0x84, 0xf0, 0x7b, 0xd0, 0x73, 0xaf, 0x6b, 0xd0, 0x73, 0x9e, 0x0a, 0x00, 0x64, 0x5c, 0x02, 0xdc, 0x18, 0x16, 0x53, 0xa6, 0x0a, 0x0e, 0xb4,
+  0x11, 0x0e, 0x8a, 0x03, 0x06, 0x02, 0x00, 0x01, 0x3c, 0x67, 0x00, 0x08, 0x72, 0x00, 0x36, 0x67, 0x82, 0x92, 0x94, 0x50, 0x94, 0x2f, 0x8c, 0x90, 0x9c, 0x56, 0x35, 0x11, 0xb0, 0x8c, 0x03, 0x32,
+  0xf1, 0xb4, 0xd0, 0x36, 0x0e, 0x10, 0xb4, 0x8e, 0x03, 0x00, 0xb8, 0x95, 0x23, 0x12, 0xb5, 0x2a, 0x27, 0xd4, 0xbd, 0x32, 0xbd, 0x33, 0xbd, 0x73, 0xc5, 0xb0, 0xac, 0x12, 0xb5, 0x73, 0xbd, 0x90,
+  0x03, 0x20, 0x94, 0xc5, 0xc4, 0x11, 0x22, 0xf6, 0xcd, 0xae, 0x0a, 0x00, 0x5a, 0x2e, 0x02, 0x60, 0x3b, 0x10, 0xed, 0x46, 0x11, 0x31, 0x2a, 0xed, 0x2a, 0x78, 0x1f, 0x32, 0x33, 0x0d, 0x2b, 0xfe,
+  0x1b, 0x00, 0xbc, 0x29, 0x00, 0x4e, 0x0a, 0x04, 0x5a, 0x62, 0x10, 0xd1, 0x9e, 0x6c, 0x01, 0x1c, 0x74, 0x01, 0x94, 0x5e, 0x03, 0x56, 0x97, 0x20, 0x4c, 0x0a, 0xb0, 0x0a, 0x11, 0x2f, 0xf0, 0x1f,
+  0x00, 0xaa, 0x42, 0x80, 0xce, 0x1a, 0xa9, 0x01, 0x27, 0x01, 0xca, 0x01, 0xf8, 0x10, 0x00, 0xce, 0x30, 0x12, 0x33, 0x94, 0x7b, 0x12, 0x5c, 0x76, 0x74, 0x00, 0x92, 0x70, 0x00, 0xb6, 0x1b, 0x02,
+  0xd4, 0x30, 0x13, 0x4f, 0x5a, 0x7f, 0x02, 0x84, 0xcc, 0x11, 0xb2, 0x76, 0x54, 0x00, 0x90, 0xe1, 0x00, 0xa6, 0x4d, 0x01, 0x98, 0x46, 0x01, 0x38, 0x0e, 0x00, 0x90, 0x3b, 0x02, 0x22, 0x7c, 0x03,
+  0xac, 0x46, 0x11, 0x4c, 0x8e, 0x43, 0x70, 0x64, 0x54, 0x54, 0x34, 0x54, 0xb5, 0x64, 0xf4, 0x14, 0x00, 0x72, 0x62, 0x00, 0xd2, 0x14, 0x02, 0x9c, 0x2e, 0x42, 0x16, 0x6d, 0x74, 0x5c, 0xae, 0x00,
+  0x20, 0xb0, 0x43, 0xaa, 0x4d, 0x51, 0xd5, 0x6c, 0x58, 0x7d, 0xf6, 0xa6, 0x54, 0x11, 0x53, 0xce, 0x70, 0x13, 0x50, 0x22, 0x55, 0x11, 0x50, 0x1c, 0x98, 0x11, 0xf2, 0xec, 0x0d, 0x41, 0x16, 0x6d,
+  0x54, 0x5c, 0xf8, 0x90, 0x01, 0x78, 0xb0, 0xf0, 0x09, 0x4e, 0x3b, 0xab, 0x22, 0x2d, 0x33, 0xcc, 0x22, 0xa7, 0x01, 0x87, 0x01, 0xc8, 0x01, 0xe8, 0x01, 0xec, 0x2a, 0xcc, 0x2a, 0xcc, 0x22, 0x0d,
+  0x2b, 0xae, 0x03, 0x11, 0x8f, 0x06, 0xb8, 0x01, 0x4a, 0x66, 0x00, 0x30, 0x5f, 0x10, 0x54, 0xbe, 0x46, 0x00, 0x56, 0x07, 0x02, 0x72, 0x8d, 0x11, 0xb1, 0x48, 0x51, 0x00, 0x58, 0x86, 0x11, 0xf1,
+  0x56, 0x03, 0x04, 0x8a, 0xa2, 0x02, 0x08, 0x27, 0x00, 0x28, 0x07, 0x02, 0xb2, 0xc9, 0x80, 0x0f, 0x3b, 0x4f, 0x3b, 0x0f, 0x3b, 0x4b, 0x1a, 0x9a, 0x0a, 0x40, 0xee, 0x32, 0xce, 0x2a, 0x0c, 0x20,
+  0x02, 0x1e, 0x00, 0x00, 0xfa, 0x0d, 0x11, 0x91, 0xb6, 0xd0, 0x01, 0x86, 0x86, 0x01, 0xc4, 0x9b, 0x00, 0xa0, 0x0a, 0x31, 0x54, 0x64, 0x74, 0xfe, 0x5b, 0x71, 0xb1, 0x53, 0x74, 0x6c, 0x95, 0x6c,
+  0x13, 0x20, 0x5c, 0x01, 0x34, 0x07, 0x00, 0x2c, 0x43, 0x00, 0x78, 0x71, 0x12, 0x64, 0x72, 0x7f, 0x00, 0xf4, 0x06, 0x02, 0x8c, 0x38, 0x00, 0x14, 0x0e, 0x20, 0x74, 0x6c, 0x44, 0x0e, 0x21, 0x6f,
+  0x4b, 0x36, 0x47, 0x30, 0x4b, 0xad, 0x32, 0x86, 0x2a, 0x00, 0x02, 0x00, 0x82, 0xee, 0x3a, 0xcd, 0x32, 0xee, 0x3a, 0x2f, 0x43, 0xba, 0x03, 0x40, 0xb1, 0x5b, 0x90, 0x53, 0x5c, 0x2a, 0x00, 0x2e,
+  0x07, 0x70, 0x54, 0x6c, 0xb5, 0x74, 0xd5, 0x7c, 0xf5, 0xe4, 0x06, 0x01, 0x42, 0x0a, 0x01, 0xc0, 0x2d, 0x10, 0x5b, 0xd4, 0x06, 0x02, 0x10, 0x0e, 0x00, 0x34, 0x43, 0x00, 0x48, 0x43, 0x02, 0xf6,
+  0x26, 0x00, 0xb2, 0x03, 0x00, 0x28, 0x27, 0x00, 0x1a, 0x00, 0xa0, 0x77, 0x95, 0xd9, 0xa5, 0x36, 0x8d, 0x16, 0x8d, 0xf5, 0x84, 0x30, 0x0e, 0x00, 0xa4, 0x0a, 0x00, 0xbe, 0x18, 0x00, 0xf6, 0x34,
+  0x11, 0xd5, 0x08, 0x35, 0x51, 0x16, 0x8d, 0x53, 0x74, 0xb0, 0x9e, 0x31, 0x00, 0xd6, 0x1f, 0x11, 0x94, 0x08, 0x27, 0x01, 0x66, 0x5c, 0x70, 0x63, 0x6f, 0x53, 0x0d, 0x4b, 0x4f, 0x53, 0xca, 0x18,
+  0x00, 0xba, 0x2a, 0x00, 0x22, 0x0e, 0x01, 0x62, 0x1c, 0x01, 0xa8, 0x03, 0x10, 0x12, 0xec, 0x31, 0x01, 0x00, 0xa7, 0x00, 0xa4, 0x71, 0x60, 0xb0, 0x63, 0xb0, 0x63, 0x8f, 0x5b, 0x14, 0xb5, 0x00,
+  0xac, 0x31, 0xf0, 0x0f, 0xcf, 0x6b, 0x2d, 0x5b, 0x6d, 0x63, 0xf3, 0x94, 0x35, 0x9d, 0xaf, 0x6b, 0x10, 0x7c, 0x71, 0x84, 0x51, 0x84, 0x35, 0x9d, 0xf0, 0x7b, 0x8b, 0x4a, 0xab, 0x52, 0x10, 0x7c,
+  0xf0, 0x7b, 0x90, 0x03, 0x00, 0x5a, 0x1c, 0x00, 0x8a, 0x03, 0x11, 0x11, 0x8c, 0x03, 0x06, 0x2e, 0x0e, 0x23, 0x73, 0x84, 0xe8, 0x26, 0x0d, 0x76, 0x23, 0x04, 0x7a, 0x23, 0x03, 0xf6, 0x78, 0x14,
+  0x94, 0x08, 0x00, 0x04, 0x58, 0x15, 0x00, 0x54, 0x35, 0x11, 0x51, 0xde, 0x18, 0x33, 0xb1, 0x9c, 0xd1, 0xd8, 0x18, 0x00, 0xc8, 0x11, 0x00, 0x40, 0x15, 0x13, 0xd0, 0x3a, 0x0e, 0x02, 0xaa, 0x0a,
+  0x02, 0x90, 0x03, 0x42, 0x11, 0xb5, 0x32, 0xbd, 0x40, 0x0e, 0x42, 0xf2, 0xb4, 0x90, 0xa4, 0x12, 0x07, 0x00, 0x0a, 0x40, 0x11, 0x74, 0x94, 0x03, 0x20, 0x94, 0xc5, 0xee, 0x31, 0x00, 0xdc, 0x11,
+  0x11, 0x94, 0x0a, 0x72, 0x11, 0x4f, 0x2a, 0x8d, 0x02, 0xa6, 0x22, 0x02, 0xc0, 0x26, 0x11, 0xf2, 0x76, 0x9e, 0x02, 0x30, 0x1f, 0x12, 0x12, 0xa4, 0x11, 0x01, 0x86, 0x70, 0x00, 0x6a, 0x70, 0x02,
+  0xd4, 0x49, 0x00, 0xbe, 0x1e, 0x02, 0x1e, 0xb0, 0x02, 0x0e, 0x82, 0x00, 0x2a, 0x78, 0x05, 0x0a, 0x7f, 0x12, 0x4b, 0x2c, 0x03, 0x20, 0xb5, 0x64, 0xd0, 0x7e, 0x02, 0x5e, 0x77, 0x00, 0xaa, 0xa9,
+  0x00, 0x72, 0x0d, 0x80, 0xb1, 0x43, 0xcd, 0x22, 0xad, 0x22, 0x91, 0x3b, 0x84, 0x35, 0x02, 0xc6, 0x49, 0x00, 0xde, 0x0a, 0x11, 0x2f, 0x62, 0x26, 0x11, 0x91, 0x04, 0xd7, 0x00, 0x90, 0x34, 0x21,
+  0xce, 0x22, 0x4a, 0x62, 0x01, 0x26, 0x11, 0x00, 0x2c, 0x8d, 0x02, 0xfe, 0x4c, 0x10, 0xb1, 0x10, 0xec, 0x03, 0xbe, 0x1f, 0x21, 0x8d, 0x1a, 0x86, 0x20, 0x01, 0x4e, 0x58, 0x22, 0xee, 0x2a, 0x2c,
+  0x00, 0x02, 0x08, 0x86, 0x00, 0x34, 0x00, 0x60, 0x6c, 0x1a, 0xad, 0x22, 0xcd, 0x22, 0x12, 0x00, 0x00, 0xa2, 0x00, 0x22, 0x2e, 0x33, 0xc0, 0x90, 0x13, 0xd1, 0xc0, 0x3b, 0x20, 0x33, 0x54, 0xcc,
+  0x50, 0x13, 0x13, 0xc6, 0x34, 0x11, 0x70, 0x1a, 0x20, 0x12, 0xb0, 0x2e, 0xaa, 0x01, 0x94, 0x04, 0xf1, 0x00, 0xcd, 0x22, 0xed, 0x2a, 0x2a, 0x0a, 0x2a, 0x0a, 0x6a, 0x12, 0x2a, 0x0a, 0x29, 0x0a,
+  0x8b, 0x34, 0x08, 0x02, 0x02, 0x00, 0xe0, 0xec, 0x2a, 0x8b, 0x1a, 0xcc, 0x22, 0x6b, 0x12, 0xed, 0x22, 0x8c, 0x1a, 0xac, 0x22, 0x16, 0x0e, 0x10, 0xd1, 0x1e, 0xbb, 0x01, 0x86, 0x07, 0x02, 0x14,
+  0xc6, 0x00, 0x92, 0x07, 0x04, 0x64, 0x7f, 0x11, 0x4f, 0x84, 0x46, 0x00, 0x9c, 0x0a, 0x23, 0x32, 0x5c, 0x80, 0xde, 0x02, 0x80, 0x71, 0x01, 0x8c, 0x11, 0x20, 0x94, 0x6c, 0x08, 0x71, 0x00, 0x48,
+  0x2a, 0x00, 0x08, 0x00, 0x11, 0xd5, 0x88, 0x66, 0x02, 0xa8, 0x66, 0x02, 0xfa, 0x7b, 0x02, 0x94, 0x11, 0x00, 0x78, 0x51, 0x20, 0x12, 0x5c, 0x40, 0x07, 0x00, 0x1a, 0x15, 0x00, 0x1c, 0x15, 0x30,
+  0xad, 0x2a, 0xd1, 0x46, 0xd4, 0x10, 0x64, 0x8c, 0x0a, 0x10, 0xb5, 0xee, 0x5f, 0x12, 0x74, 0x5e, 0x0e, 0x31, 0x33, 0x5c, 0xb1, 0xc4, 0x3f, 0x10, 0x74, 0xbc, 0x2d, 0xf0, 0x00, 0x5c, 0xd2, 0x5b,
+  0x13, 0x64, 0x13, 0x5c, 0x91, 0x4b, 0x91, 0x4b, 0x70, 0x4b, 0xee, 0x3a, 0xd4, 0x18, 0x00, 0xa6, 0x03, 0x00, 0x06, 0x00, 0x02, 0x32, 0x3c, 0x80, 0x70, 0x4b, 0x53, 0x6c, 0x33, 0x64, 0xb4, 0x74,
+  0xe0, 0x03, 0x80, 0x70, 0x4b, 0x32, 0x64, 0x33, 0x64, 0x4f, 0x4b, 0x72, 0x98, 0x60, 0x4f, 0x4b, 0xee, 0x3a, 0xcd, 0x3a, 0xe6, 0x46, 0x00, 0x72, 0x0e, 0x11, 0xb1, 0x3a, 0x07, 0x00, 0x5a, 0x71,
+  0x11, 0xb4, 0x90, 0x18, 0x02, 0x88, 0x38, 0x00, 0x1a, 0x35, 0x00, 0x94, 0x1c, 0x02, 0xc8, 0x2d, 0x22, 0x16, 0x85, 0x12, 0x1c, 0x00, 0x2a, 0x00, 0x80, 0xf5, 0x84, 0xd1, 0x5b, 0x2e, 0x4b, 0x6f,
+  0x53, 0x78, 0x23, 0x00, 0x40, 0x03, 0x02, 0x1a, 0x2e, 0x11, 0x73, 0xd8, 0x2d, 0x11, 0x53, 0x5e, 0x51, 0x00, 0x3a, 0x07, 0x02, 0x8e, 0x03, 0x11, 0x73, 0x24, 0x15, 0x13, 0xd0, 0x28, 0x35, 0x10,
+  0x52, 0xa8, 0x0a, 0x10, 0x8c, 0x18, 0x07, 0x00, 0x2a, 0x35, 0x11, 0xd5, 0x9e, 0x2a, 0x02, 0xbe, 0x0a, 0x00, 0x2e, 0xb5, 0x02, 0xaa, 0x71, 0x00, 0xfa, 0x66, 0x00, 0xe0, 0x5f, 0x20, 0xb0, 0x63,
+  0x9c, 0x51, 0x00, 0xc6, 0x38, 0xf2, 0x0b, 0xaf, 0x63, 0x6d, 0x5b, 0x29, 0x32, 0x4d, 0x5b, 0x96, 0xad, 0xd3, 0x94, 0xf7, 0xb5, 0x34, 0x9d, 0x51, 0x84, 0x31, 0x7c, 0x10, 0x7c, 0x6e, 0x63, 0x10,
+  0x7c, 0x3c, 0x15, 0x02, 0x48, 0x15, 0x31, 0x31, 0x7c, 0x32, 0x24, 0x87, 0x01, 0xba, 0x1f, 0x03, 0x1a, 0x07, 0x17, 0x93, 0xa2, 0x0a, 0x00, 0x2c, 0x00, 0x07, 0x0c, 0x07, 0x12, 0x94, 0xa8, 0x2a,
+  0x01, 0x06, 0x27, 0x30, 0x8c, 0xd4, 0x8c, 0x1c, 0x47, 0x24, 0x36, 0x9d, 0x8c, 0x03, 0x11, 0xd3, 0xc6, 0x51, 0x31, 0xf3, 0xa4, 0xd2, 0xc6, 0x11, 0x10, 0x91, 0x80, 0x23, 0x30, 0xa4, 0x6f, 0x9c,
+  0xa6, 0x0a, 0x13, 0xd1, 0xc6, 0x11, 0x06, 0x50, 0x15, 0x13, 0xf1, 0x5e, 0x15, 0x13, 0xb1, 0x98, 0x23, 0x00, 0x1c, 0x27, 0x00, 0xc2, 0x11, 0x00, 0x50, 0x15, 0x02, 0x06, 0x00, 0x00, 0xae, 0x2a,
+  0x00, 0x8a, 0x1c, 0x00, 0x5e, 0x4e, 0x20, 0x74, 0xbd, 0xfe, 0x38, 0x00, 0x62, 0x15, 0x00, 0x3a, 0x55, 0x01, 0x0c, 0x6a, 0x01, 0xa0, 0x3f, 0x00, 0xbc, 0x31, 0x42, 0xae, 0x1a, 0xad, 0x12, 0x92,
+  0x49, 0x00, 0xf8, 0x5e, 0x15, 0xce, 0x58, 0x43, 0x40, 0x8d, 0x12, 0x8d, 0x1a, 0xec, 0x45, 0x80, 0x6b, 0x0a, 0xcd, 0x22, 0x6b, 0x12, 0x6c, 0x12, 0x22, 0x1c, 0x11, 0x2f, 0x22, 0x6d, 0x00, 0x72,
+  0x03, 0x00, 0x40, 0x15, 0x00, 0x00, 0x0a, 0x00, 0xc2, 0x38, 0x00, 0xe0, 0x65, 0x00, 0x8e, 0x14, 0x02, 0xbe, 0x7e, 0x00, 0xf4, 0x5a, 0x00, 0x56, 0xa9, 0x00, 0x96, 0xc1, 0x01, 0x58, 0x54, 0x10,
+  0x64, 0x06, 0x00, 0x00, 0xc0, 0x0a, 0x01, 0x0e, 0x40, 0x21, 0x5c, 0xb5, 0xf2, 0x77, 0x11, 0x91, 0x18, 0x18, 0x00, 0x7e, 0x34, 0x02, 0x9c, 0x14, 0x00, 0xe6, 0x0a, 0x00, 0x52, 0x18, 0x00, 0xda,
+  0x03, 0x01, 0x7a, 0x1b, 0x03, 0x98, 0x51, 0x42, 0x54, 0x54, 0xb2, 0x43, 0xd8, 0x15, 0x10, 0x2f, 0xb6, 0x0a, 0x22, 0x22, 0x71, 0x2e, 0x8d, 0x00, 0xee, 0x06, 0x03, 0x50, 0x7c, 0x11, 0xd2, 0x9a,
+  0xb0, 0x04, 0x0a, 0x4a, 0x14, 0x90, 0xbe, 0xda, 0x21, 0x43, 0x0e, 0x20, 0x6a, 0x04, 0xd8, 0xe1, 0x02, 0xd6, 0xb0, 0x00, 0x5e, 0x74, 0x40, 0x0d, 0x2b, 0x8c, 0x1a, 0x02, 0x00, 0x00, 0x5a, 0x9f,
+  0x20, 0xed, 0x22, 0x60, 0x03, 0x31, 0x4e, 0x33, 0x2e, 0x84, 0x19, 0x00, 0xe4, 0x12, 0x42, 0x2e, 0x33, 0x0d, 0x2b, 0x00, 0x43, 0x20, 0xaf, 0x43, 0xe0, 0x11, 0x20, 0x90, 0x43, 0xdc, 0xbe, 0x02,
+  0xb6, 0x0a, 0x00, 0x62, 0x51, 0x00, 0x58, 0x0e, 0x00, 0x58, 0x4a, 0x00, 0xd8, 0xa2, 0x00, 0x86, 0x15, 0x00, 0xae, 0x0a, 0x00, 0x5c, 0x51, 0x10, 0x74, 0xf4, 0x1b, 0x02, 0xd0, 0x89, 0x10, 0x64,
+  0x7c, 0x11, 0x11, 0x90, 0x64, 0x5c, 0x13, 0x94, 0x8c, 0x31, 0x00, 0x84, 0x3f, 0x00, 0xe6, 0x26, 0x00, 0x66, 0x3f, 0x00, 0xee, 0x46, 0x00, 0xd6, 0x0a, 0x00, 0x10, 0x07, 0x20, 0x4f, 0x3b, 0x98,
+  0x1f, 0x11, 0xf2, 0x24, 0xd4, 0x11, 0x90, 0xbe, 0x58, 0x10, 0x2f, 0xcc, 0x23, 0x23, 0x64, 0x13, 0xde, 0xde, 0x22, 0x32, 0x5c, 0x3a, 0x63, 0x11, 0x70, 0x86, 0x38, 0x10, 0x0e, 0x48, 0x27, 0x02,
+  0x46, 0x35, 0x21, 0x6c, 0x33, 0xc0, 0x3f, 0x20, 0x54, 0x6c, 0x86, 0x0a, 0x40, 0x54, 0x64, 0x2f, 0x43, 0x3a, 0x07, 0x40, 0x50, 0x43, 0x54, 0x64, 0xa6, 0x0a, 0x11, 0x94, 0x4a, 0x3c, 0x11, 0xf2,
+  0x04, 0x07, 0x01, 0xd8, 0x03, 0x10, 0x53, 0xf6, 0x2d, 0x22, 0xb1, 0x53, 0xfc, 0x74, 0x00, 0x4a, 0x1c, 0x00, 0x0a, 0x27, 0x00, 0x40, 0x43, 0x30, 0x12, 0x64, 0x12, 0x48, 0x00, 0x10, 0x63, 0xb4,
+  0x03, 0x00, 0x94, 0x03, 0xb0, 0x70, 0x4b, 0xcc, 0x3a, 0x4a, 0x2a, 0xed, 0x42, 0x4e, 0x4b, 0x0e, 0x7c, 0x6a, 0x01, 0x9a, 0x2a, 0x22, 0xb0, 0x5b, 0xc8, 0x38, 0x20, 0x32, 0x6c, 0x4c, 0x0a, 0x71,
+  0xd5, 0x7c, 0x15, 0x85, 0x56, 0x8d, 0x94, 0x1e, 0x5c, 0x00, 0xec, 0x2d, 0x00, 0x50, 0x07, 0x00, 0x70, 0x11, 0x01, 0xc0, 0x0a, 0x01, 0xfc, 0x1f, 0x00, 0x52, 0x51, 0x00, 0xe2, 0x4d, 0x02, 0x8a,
+  0x78, 0x00, 0x34, 0x07, 0x02, 0xd8, 0x18, 0x11, 0xf1, 0xd0, 0x3f, 0x11, 0x93, 0x56, 0x83, 0x01, 0x30, 0x00, 0x00, 0x12, 0x19, 0x10, 0x7c, 0xf4, 0x26, 0x60, 0xd1, 0x63, 0xed, 0x42, 0xac, 0x3a,
+  0x02, 0x00, 0x40, 0x6f, 0x53, 0x52, 0x74, 0x38, 0xbc, 0x00, 0xba, 0x38, 0x02, 0x12, 0xae, 0xf0, 0x09, 0x73, 0x7c, 0x8f, 0x63, 0x6a, 0x3a, 0x8e, 0x5b, 0xaf, 0x63, 0x8a, 0x42, 0xef, 0x6b, 0x96,
+  0xa5, 0x75, 0xa5, 0xcf, 0x73, 0xf0, 0x73, 0xcf, 0x73, 0x20, 0x8e, 0x41, 0x8f, 0x6b, 0x11, 0x7c, 0x3c, 0x15, 0x03, 0x44, 0x7c, 0x11, 0x31, 0xaa, 0x4a, 0x10, 0x72, 0xd8, 0x58, 0x05, 0xa6, 0x0a,
+  0x12, 0x93, 0x3a, 0x3c, 0x03, 0x3a, 0x0e, 0x02, 0x10, 0x00, 0x13, 0xb3, 0x56, 0x1c, 0x02, 0x10, 0x47, 0x02, 0x02, 0x00, 0x00, 0x16, 0x80, 0x00, 0x16, 0x00, 0x00, 0x58, 0x07, 0x00, 0x72, 0x2e,
+  0xa0, 0xd4, 0x9c, 0x72, 0x8c, 0x71, 0x8c, 0xb2, 0x9c, 0x71, 0x94, 0x82, 0x23, 0x11, 0x90, 0x8c, 0x03, 0x00, 0x6e, 0x03, 0x02, 0x54, 0x35, 0x03, 0x02, 0x00, 0x01, 0x4a, 0x15, 0x02, 0x0a, 0x00,
+  0x22, 0x11, 0xb5, 0x0e, 0x00, 0x02, 0xfc, 0x06, 0x02, 0x82, 0x3c, 0x40, 0xb4, 0xc5, 0xb4, 0xc5, 0xb0, 0x2a, 0x02, 0x8c, 0x03, 0x00, 0xba, 0x23, 0x22, 0x90, 0xa4, 0x46, 0x2e, 0x22, 0xd5, 0xcd,
+  0x22, 0x40, 0x20, 0x2f, 0x94, 0x2a, 0x23, 0x00, 0x2a, 0xe1, 0x02, 0xe0, 0x70, 0x31, 0xce, 0x22, 0x30, 0xc0, 0x14, 0x02, 0xc6, 0x09, 0x22, 0x74, 0x5c, 0x44, 0x15, 0x00, 0x14, 0x03, 0x00, 0x50,
+  0x27, 0x00, 0x24, 0x62, 0x40, 0x74, 0x5c, 0xd5, 0x64, 0x02, 0x54, 0xa2, 0x37, 0x75, 0x37, 0x75, 0xf6, 0x6c, 0x57, 0x75, 0x37, 0x75, 0x5e, 0xa2, 0x00, 0x72, 0x3c, 0x00, 0xbc, 0x06, 0x00, 0x4e,
+  0x74, 0x11, 0xd2, 0x4c, 0x89, 0x00, 0x72, 0x3b, 0xe0, 0x57, 0x75, 0x16, 0x75, 0xf5, 0x6c, 0xb5, 0x64, 0xb4, 0x64, 0x57, 0x7d, 0xb4, 0x64, 0x28, 0x00, 0x00, 0xa6, 0x50, 0x31, 0x53, 0x54, 0xd5,
+  0xfc, 0x18, 0x02, 0xd4, 0x06, 0x11, 0x33, 0x6c, 0x89, 0x00, 0xd0, 0x0a, 0x04, 0x10, 0x2a, 0x00, 0x7e, 0x2d, 0x00, 0x00, 0x7f, 0x00, 0x68, 0x26, 0x60, 0x0f, 0x2b, 0xef, 0x2a, 0x50, 0x33, 0x24,
+  0x23, 0x20, 0x2f, 0x33, 0xaa, 0x18, 0x00, 0x40, 0x2a, 0x15, 0xd2, 0xce, 0x2d, 0x00, 0xd4, 0x3b, 0x03, 0xba, 0x69, 0x20, 0x33, 0x91, 0x4a, 0x38, 0x00, 0x78, 0x03, 0x30, 0x2b, 0xad, 0x22, 0x3c,
+  0xc9, 0x01, 0x42, 0x7f, 0x01, 0xc0, 0xbe, 0x41, 0xed, 0x2a, 0xac, 0x22, 0x9c, 0x4d, 0x01, 0x20, 0x98, 0x20, 0xcd, 0x22, 0x7e, 0x1f, 0x00, 0xe4, 0x0d, 0x00, 0xba, 0x54, 0x22, 0xcd, 0x22, 0x54,
+  0x0e, 0x02, 0x9c, 0x3f, 0x11, 0x6f, 0x26, 0x4a, 0x00, 0x26, 0x07, 0x00, 0x64, 0x03, 0x60, 0xcc, 0x22, 0xcc, 0x2a, 0xed, 0x2a, 0x92, 0xbe, 0x00, 0xa4, 0x03, 0x20, 0xcd, 0x2a, 0x6a, 0x2b, 0x20,
+  0xcd, 0x2a, 0x4e, 0x00, 0x00, 0xf2, 0x42, 0x60, 0x6c, 0x1a, 0xed, 0x2a, 0x4f, 0x3b, 0x8e, 0x19, 0x00, 0x46, 0xbf, 0x02, 0x78, 0x0e, 0x02, 0xd2, 0x5b, 0x20, 0x12, 0x54, 0x1e, 0x07, 0x02, 0x2c,
+  0x91, 0x00, 0xe8, 0x06, 0x02, 0xfc, 0xa9, 0x10, 0x0f, 0xce, 0x23, 0xf0, 0x02, 0x32, 0x2b, 0x12, 0x6c, 0x22, 0xea, 0x09, 0x68, 0x01, 0x0b, 0x12, 0x6c, 0x22, 0x2b, 0x1a, 0x6b, 0x22, 0x4c, 0x9f,
+  0x40, 0x0a, 0x12, 0xed, 0x32, 0xa8, 0x2a, 0x20, 0x53, 0x64, 0x14, 0x07, 0x00, 0x5a, 0x23, 0x22, 0x17, 0x7d, 0x78, 0x58, 0x00, 0x7c, 0x0a, 0x50, 0xd6, 0x74, 0x54, 0x64, 0x13, 0x8c, 0x2a, 0x03,
+  0x22, 0x07, 0x24, 0x90, 0x4b, 0xc0, 0x11, 0x20, 0x54, 0x6c, 0x90, 0x0a, 0x11, 0x33, 0xb6, 0x1c, 0x00, 0x6a, 0x0a, 0x02, 0xc4, 0x11, 0x31, 0x95, 0x74, 0x13, 0x8c, 0x6a, 0x00, 0x04, 0x00, 0x20,
+  0x0e, 0x3b, 0x26, 0x47, 0x20, 0x70, 0x4b, 0x5e, 0x03, 0x30, 0x33, 0x64, 0xb5, 0x12, 0x07, 0x30, 0x6c, 0x0e, 0x43, 0x7a, 0x51, 0x80, 0xf2, 0x5b, 0xed, 0x3a, 0x2e, 0x43, 0x4f, 0x43, 0x88, 0x23,
+  0x10, 0x4f, 0x6e, 0x03, 0x12, 0x4b, 0xb8, 0x86, 0x11, 0x90, 0xda, 0xc9, 0x00, 0xf8, 0x1f, 0x51, 0xf6, 0x84, 0xd5, 0x7c, 0x74, 0x01, 0x00, 0x02, 0x88, 0x5f, 0x60, 0x74, 0x74, 0xd6, 0x84, 0xb5,
+  0x7c, 0x16, 0x00, 0x10, 0x95, 0xd4, 0x11, 0xb4, 0x7c, 0xf2, 0x63, 0x12, 0x6c, 0x33, 0x6c, 0xb1, 0x5b, 0x6f, 0x53, 0xbc, 0x58, 0x02, 0x00, 0x75, 0x02, 0x3a, 0x4a, 0x01, 0x80, 0x31, 0x00, 0xd8,
+  0x74, 0x11, 0x7c, 0xec, 0x18, 0x30, 0x74, 0x4e, 0x53, 0x6c, 0x0a, 0x01, 0x9c, 0x03, 0x21, 0x7c, 0x93, 0x7e, 0x4a, 0x62, 0x15, 0x8d, 0x98, 0x9d, 0x36, 0x8d, 0x18, 0x75, 0x00, 0x24, 0x07, 0x02,
+  0x08, 0x20, 0x00, 0x28, 0x0e, 0x00, 0x9c, 0x0a, 0x20, 0xd4, 0x84, 0x12, 0x07, 0x00, 0x96, 0x1c, 0x00, 0x28, 0x0e, 0x01, 0x3a, 0x75, 0xf0, 0x06, 0x7c, 0x31, 0x74, 0x93, 0x84, 0xcc, 0x4a, 0x31,
+  0x74, 0x35, 0x95, 0x8a, 0x42, 0x2d, 0x5b, 0xf0, 0x73, 0x0c, 0x53, 0x10, 0x74, 0x46, 0xc3, 0x00, 0x8e, 0x03, 0x20, 0xf0, 0x73, 0x2c, 0xae, 0x32, 0x72, 0x84, 0xf0, 0x32, 0xae, 0x10, 0x7c, 0xb0,
+  0x51, 0x02, 0xb6, 0x11, 0x26, 0x52, 0x7c, 0x30, 0x0e, 0x08, 0x52, 0x15, 0x02, 0x34, 0x07, 0x24, 0x53, 0x84, 0x3c, 0x07, 0x03, 0x48, 0x2e, 0x03, 0x7e, 0x1c, 0x20, 0x73, 0x8c, 0xac, 0x03, 0x00,
+  0x8e, 0x63, 0x32, 0xd0, 0x7b, 0xb3, 0x28, 0x2e, 0x10, 0x94, 0x42, 0xa0, 0x02, 0x44, 0xa0, 0x02, 0x1e, 0x2e, 0x33, 0xb0, 0xac, 0x90, 0x38, 0x4e, 0x02, 0x0a, 0x27, 0x15, 0xf1, 0xfe, 0x1f, 0x04,
+  0x5a, 0x15, 0x02, 0x5c, 0x35, 0x02, 0x12, 0x60, 0x02, 0xca, 0x6a, 0x22, 0x94, 0xc5, 0x90, 0x5c, 0x10, 0xb4, 0x68, 0x35, 0x01, 0x54, 0x15, 0x01, 0x3a, 0xab, 0x21, 0xa4, 0xf6, 0x24, 0x07, 0x33,
+  0x98, 0xe6, 0xd1, 0x0c, 0xbb, 0x01, 0x18, 0x74, 0x01, 0xe2, 0xa8, 0x00, 0xb6, 0x14, 0x00, 0xa8, 0x14, 0x00, 0x2c, 0x03, 0x20, 0xce, 0x22, 0x94, 0x18, 0x01, 0x52, 0x82, 0x30, 0x33, 0x53, 0x54,
+  0x7c, 0x57, 0x00, 0x5c, 0x06, 0x02, 0x1e, 0x1f, 0x02, 0x8e, 0x50, 0x01, 0x80, 0x97, 0x12, 0x2b, 0x9e, 0x69, 0x02, 0x28, 0x03, 0x20, 0x95, 0x5c, 0x1e, 0x07, 0x03, 0x44, 0xad, 0x00, 0x0c, 0x58,
+  0x01, 0x9a, 0x14, 0x00, 0x04, 0x00, 0x40, 0x6b, 0x1a, 0x6b, 0x1a, 0xa4, 0x14, 0x70, 0xe9, 0x01, 0xa8, 0x01, 0xc9, 0x01, 0x0a, 0x66, 0x58, 0x12, 0x33, 0x90, 0x77, 0x02, 0x34, 0x82, 0x00, 0x6a,
+  0x82, 0x02, 0x4a, 0xf3, 0x60, 0x95, 0x64, 0x75, 0x5c, 0x74, 0x5c, 0x3a, 0xf3, 0x14, 0x74, 0x94, 0x55, 0x00, 0x04, 0x07, 0x70, 0x33, 0xef, 0x22, 0x2f, 0x2b, 0xef, 0x2a, 0x86, 0x1f, 0x31, 0x8d,
+  0x1a, 0x30, 0xac, 0xf6, 0x10, 0xd2, 0xa8, 0x03, 0x01, 0xf0, 0x70, 0x00, 0x7a, 0x18, 0x00, 0x00, 0x66, 0x20, 0x74, 0x64, 0x22, 0x1f, 0x00, 0xd4, 0xb4, 0x02, 0x5c, 0x6d, 0x62, 0x2b, 0x0a, 0xcd,
+  0x2a, 0x70, 0x3b, 0x12, 0x07, 0x00, 0xf4, 0x42, 0x31, 0x8d, 0x22, 0xcd, 0xf0, 0x15, 0x11, 0x0e, 0x12, 0x15, 0x00, 0xd6, 0x06, 0x00, 0xca, 0x97, 0x00, 0x4c, 0x07, 0x01, 0xb2, 0xad, 0x01, 0x72,
+  0x5f, 0x13, 0x73, 0x64, 0xad, 0x00, 0xfe, 0x42, 0x30, 0xd0, 0x4b, 0xd0, 0xc0, 0xc5, 0x00, 0x4e, 0x9b, 0x01, 0x74, 0x38, 0x00, 0x0a, 0x07, 0x11, 0xf1, 0x32, 0x00, 0x00, 0x0e, 0x15, 0x00, 0xae,
+  0xbb, 0x00, 0xba, 0x0a, 0x00, 0x9c, 0x2d, 0x00, 0x90, 0x0a, 0x20, 0x95, 0x64, 0x06, 0x08, 0x02, 0xaa, 0x6d, 0x00, 0xda, 0x1f, 0x00, 0x32, 0x00, 0x00, 0xea, 0xa9, 0x00, 0x50, 0x15, 0x00, 0x3c,
+  0x98, 0x02, 0x16, 0xa3, 0x00, 0x28, 0x43, 0x02, 0x9c, 0x46, 0x22, 0x70, 0x43, 0x18, 0xb8, 0x00, 0xc4, 0x3f, 0x01, 0x7c, 0x83, 0x01, 0xd2, 0x11, 0x91, 0x68, 0x01, 0x4c, 0x22, 0xcd, 0x32, 0x6c,
+  0x22, 0x12, 0x10, 0x00, 0x00, 0x3a, 0x07, 0x40, 0x91, 0x4b, 0x54, 0x64, 0x0c, 0x2e, 0x31, 0xd6, 0x74, 0x12, 0xec, 0xa6, 0x60, 0xee, 0x3a, 0x70, 0x4b, 0x91, 0x53, 0x06, 0x0e, 0x02, 0x02, 0x00,
+  0x40, 0xee, 0x3a, 0x6c, 0x2a, 0x08, 0x00, 0x20, 0xd1, 0x53, 0x3c, 0x1c, 0x02, 0xc8, 0x2a, 0x00, 0x7c, 0x35, 0x00, 0xd4, 0x03, 0x02, 0x34, 0x15, 0x11, 0xd1, 0xcc, 0x18, 0x02, 0xea, 0x0d, 0x40,
+  0xd1, 0x5b, 0xb1, 0x53, 0xde, 0x26, 0x02, 0x68, 0x0e, 0x00, 0x1a, 0x8a, 0x00, 0xa4, 0x18, 0x03, 0x70, 0x31, 0x01, 0xc2, 0x18, 0x40, 0x33, 0x6c, 0x4f, 0x4b, 0x04, 0x07, 0xa0, 0x74, 0x74, 0x57,
+  0x8d, 0xf6, 0x84, 0xd6, 0x84, 0xd6, 0x7c, 0xa2, 0x23, 0xf1, 0x00, 0xd2, 0x63, 0x50, 0x53, 0x0f, 0x4b, 0x70, 0x53, 0x70, 0x53, 0xb1, 0x5b, 0xb1, 0x5b, 0x70, 0x4e, 0x3c, 0x00, 0x3c, 0x00, 0x00,
+  0x66, 0x23, 0x20, 0x2e, 0x4b, 0x3e, 0x71, 0x00, 0xe4, 0x0d, 0x00, 0xac, 0x18, 0x60, 0x2e, 0x53, 0x0d, 0x4b, 0x0e, 0x4b, 0x0c, 0x00, 0x02, 0x96, 0x7f, 0x22, 0xd4, 0x84, 0x9a, 0x03, 0x00, 0xf2,
+  0x2d, 0x00, 0x24, 0x7c, 0x60, 0x93, 0x7c, 0x4f, 0x53, 0x2e, 0x53, 0xa6, 0x03, 0x40, 0x0d, 0x4b, 0x73, 0x74, 0xfe, 0x11, 0x02, 0x86, 0x4a, 0x20, 0x73, 0x7c, 0x1a, 0x27, 0x00, 0x0e, 0x6e, 0x00,
+  0xb8, 0x11, 0x00, 0x26, 0x0e, 0x00, 0x22, 0x95, 0xf0, 0x09, 0x2d, 0x53, 0x0d, 0x53, 0x4d, 0x5b, 0x92, 0x84, 0xb3, 0x8c, 0x92, 0x84, 0x92, 0x84, 0x96, 0xa5, 0xf4, 0x94, 0x76, 0xa5, 0x92, 0x8c,
+  0xcf, 0x73, 0xd2, 0x18, 0x00, 0x56, 0xca, 0x00, 0xa4, 0x31, 0x02, 0x3e, 0x15, 0x24, 0x52, 0x84, 0x02, 0x00, 0x04, 0x76, 0x03, 0x11, 0x52, 0x1c, 0x07, 0x04, 0x02, 0x00, 0x19, 0x73, 0x90, 0x03,
+  0x24, 0x74, 0x8c, 0x86, 0x4a, 0x11, 0xb5, 0x02, 0x00, 0x04, 0xf4, 0x5f, 0x00, 0x2e, 0x07, 0x00, 0xb8, 0x11, 0x70, 0x15, 0x9d, 0x14, 0xa5, 0x72, 0x94, 0x71, 0x20, 0x67, 0x01, 0x84, 0x23, 0x02,
+  0x8e, 0x03, 0x00, 0x02, 0x00, 0x00, 0x7a, 0x23, 0x00, 0x1c, 0x0e, 0x04, 0x1c, 0x07, 0x00, 0xee, 0x06, 0x1d, 0xd1, 0x8c, 0x03, 0x01, 0x90, 0x03, 0x00, 0x9a, 0x95, 0x21, 0xc5, 0x94, 0x80, 0x03,
+  0x00, 0x12, 0x27, 0x00, 0x92, 0x03, 0x20, 0x32, 0xb5, 0x32, 0x00, 0x20, 0xb0, 0xa4, 0xf6, 0x18, 0xe0, 0x6b, 0x7b, 0xb5, 0xc5, 0x33, 0xb5, 0xf5, 0xcd, 0xd9, 0xee, 0x98, 0xe6, 0x74, 0xbd, 0x3e,
+  0x70, 0x00, 0x3c, 0x3b, 0x11, 0xd1, 0xc2, 0x1f, 0x02, 0x52, 0x50, 0x01, 0x14, 0x18, 0x01, 0x9c, 0xdd, 0x04, 0xbc, 0x3f, 0x00, 0x18, 0x0e, 0x00, 0x2e, 0x62, 0xe0, 0x4f, 0x33, 0xad, 0x22, 0x4b,
+  0x12, 0xc9, 0x01, 0xea, 0x01, 0xc9, 0x01, 0xad, 0x22, 0xe2, 0x09, 0x00, 0x22, 0x7b, 0x02, 0x32, 0x54, 0x02, 0xe2, 0x93, 0x00, 0x90, 0x23, 0x51, 0x6c, 0x1a, 0x8d, 0x1a, 0x2f, 0x3c, 0x9b, 0x11,
+  0x4f, 0xb4, 0x30, 0x01, 0x44, 0x49, 0x00, 0x88, 0x14, 0x01, 0x34, 0x12, 0x01, 0xfc, 0x4c, 0x00, 0x8c, 0x4a, 0x01, 0xfe, 0xe4, 0x00, 0x1c, 0x18, 0x02, 0x0a, 0x78, 0x00, 0x5e, 0x34, 0x11, 0x95,
+  0x72, 0x0e, 0x00, 0xec, 0x65, 0x11, 0xb2, 0x66, 0xf3, 0x11, 0x13, 0x92, 0x07, 0x13, 0x75, 0xa6, 0x18, 0x20, 0x75, 0x5c, 0xa6, 0x03, 0x02, 0x82, 0x26, 0x21, 0xb6, 0x64, 0x56, 0x24, 0x03, 0xdc,
+  0xef, 0x11, 0x91, 0xfe, 0x85, 0x00, 0x2e, 0x07, 0x00, 0x06, 0x23, 0x02, 0x54, 0x0e, 0x11, 0xee, 0x2a, 0x8d, 0x31, 0x94, 0x64, 0xf6, 0xfc, 0x22, 0x11, 0x33, 0xe6, 0x15, 0x04, 0x26, 0x9f, 0x00,
+  0xe0, 0x0a, 0x02, 0x74, 0x9b, 0x00, 0x32, 0x3c, 0x20, 0x70, 0x3b, 0xe8, 0x90, 0x00, 0xf0, 0x0e, 0x00, 0x68, 0x12, 0x00, 0xdc, 0x03, 0x02, 0xba, 0x07, 0x11, 0x4f, 0x6c, 0x0b, 0x00, 0xd2, 0x5b,
+  0x02, 0x46, 0x51, 0x02, 0xa6, 0x66, 0x02, 0x20, 0xbf, 0x00, 0xd8, 0x14, 0x01, 0xbe, 0x2a, 0x20, 0x22, 0x70, 0x06, 0x8e, 0x41, 0x5c, 0x4f, 0x3b, 0x0f, 0xec, 0x03, 0x20, 0x0e, 0x33, 0x4e, 0x43,
+  0x13, 0xd1, 0x10, 0x98, 0x60, 0x90, 0x4b, 0xb4, 0x6c, 0x37, 0x7d, 0x98, 0x18, 0x62, 0x13, 0x5c, 0x2f, 0x3b, 0x91, 0x4b, 0xa8, 0x11, 0x62, 0x95, 0x6c, 0x17, 0x7d, 0x74, 0x64, 0xaa, 0x3f, 0x00,
+  0x90, 0x23, 0x13, 0x32, 0x6a, 0x51, 0x00, 0x30, 0x15, 0x00, 0x8e, 0x2a, 0x00, 0x5c, 0x15, 0x40, 0x8d, 0x2a, 0x2b, 0x1a, 0x56, 0x27, 0x11, 0x50, 0x14, 0x00, 0x51, 0xd2, 0x53, 0x33, 0x64, 0xd2,
+  0xde, 0x1f, 0x00, 0xc6, 0x03, 0x02, 0x68, 0x03, 0x31, 0x13, 0x64, 0xb1, 0xa8, 0x8d, 0x00, 0x9a, 0x31, 0x10, 0x70, 0xca, 0x18, 0x02, 0xe2, 0x46, 0x10, 0x74, 0xb8, 0x8d, 0x13, 0x0e, 0x72, 0x35,
+  0x00, 0x18, 0x39, 0x00, 0x6e, 0x43, 0x02, 0xea, 0x8d, 0x22, 0x4f, 0x4b, 0xc2, 0x11, 0x22, 0xd1, 0x5b, 0xbe, 0x38, 0x11, 0x70, 0x2a, 0x0e, 0x00, 0x30, 0x15, 0x11, 0x32, 0xae, 0x11, 0x40, 0xb1,
+  0x5b, 0xd1, 0x5b, 0x62, 0x9f, 0x51, 0xf2, 0x63, 0xf2, 0x63, 0xb4, 0x5e, 0x6a, 0x00, 0x0a, 0x20, 0x22, 0xf2, 0x63, 0xa6, 0x1c, 0x00, 0x4e, 0x1c, 0x00, 0x48, 0x3c, 0x02, 0x1e, 0x1c, 0x00, 0x3c,
+  0x15, 0x20, 0xb5, 0x7c, 0xe8, 0x18, 0x22, 0xd5, 0x84, 0x86, 0x23, 0x40, 0x57, 0x95, 0x93, 0x74, 0x8c, 0x9f, 0x01, 0x76, 0x03, 0x00, 0x6c, 0x0e, 0x71, 0x84, 0xf5, 0x8c, 0x56, 0x95, 0xf5, 0x8c,
+  0x84, 0x03, 0x30, 0x74, 0x8f, 0x5b, 0xfe, 0xe9, 0x60, 0x4e, 0x53, 0x0e, 0x4b, 0xcc, 0x42, 0x4a, 0x43, 0x11, 0xd0, 0x32, 0x2e, 0x20, 0xb4, 0x84, 0x66, 0x6a, 0x00, 0x70, 0x0e, 0x10, 0x12, 0x2a,
+  0x27, 0x01, 0x3c, 0x7c, 0x00, 0x0a, 0x4e, 0x00, 0xa6, 0x03, 0xe0, 0xaf, 0x5b, 0xd0, 0x63, 0x8f, 0x63, 0xd0, 0x6b, 0x2d, 0x5b, 0xab, 0x4a, 0xf0, 0x73, 0xf8, 0x4d, 0xf0, 0x03, 0x6e, 0x63, 0xf8,
+  0xb5, 0xb7, 0xb5, 0x39, 0xbe, 0x14, 0x9d, 0x31, 0x7c, 0x96, 0xad, 0x6e, 0x6b, 0x30, 0x84, 0xea, 0x1f, 0x22, 0x31, 0x7c, 0x2c, 0x0e, 0x11, 0x32, 0x7a, 0x03, 0x02, 0xce, 0x18, 0x08, 0x02, 0x00,
+  0x06, 0x9a, 0x03, 0x17, 0x74, 0x34, 0x0e, 0x05, 0xd8, 0x38, 0x21, 0x94, 0x94, 0x8a, 0x03, 0x00, 0x56, 0x5c, 0x26, 0xd5, 0x9c, 0x08, 0x27, 0x51, 0xf4, 0x9c, 0xf4, 0x9c, 0xd4, 0x9e, 0x83, 0x44,
+  0x13, 0xad, 0x71, 0x94, 0xf8, 0x5f, 0x02, 0xca, 0x71, 0x02, 0x90, 0x0a, 0x27, 0x11, 0xb5, 0x2c, 0x0e, 0x01, 0x22, 0x07, 0x00, 0x0c, 0x00, 0x17, 0xd1, 0x96, 0x03, 0x00, 0x4a, 0x15, 0x00, 0x18,
+  0x07, 0x11, 0x95, 0x04, 0x00, 0x10, 0xb5, 0xcc, 0x31, 0x01, 0xea, 0x38, 0x11, 0x32, 0x22, 0x60, 0x00, 0x50, 0x2e, 0x00, 0xac, 0x0a, 0x20, 0x57, 0xde, 0xe0, 0xbc, 0x22, 0xb4, 0xc5, 0xbc, 0x03,
+  0x00, 0xaa, 0x57, 0x11, 0x91, 0xf6, 0x7a, 0x00, 0xa0, 0x29, 0x00, 0x0c, 0x62, 0x00, 0x4c, 0x23, 0x21, 0x33, 0x5c, 0x96, 0x37, 0x00, 0xb4, 0x14, 0x00, 0x26, 0x70, 0x30, 0x64, 0x94, 0x5c, 0x1c,
+  0x00, 0x11, 0xb5, 0x94, 0x85, 0x11, 0x74, 0x26, 0x22, 0x20, 0x74, 0x5c, 0x7a, 0x22, 0x02, 0xb0, 0x5e, 0x00, 0xd2, 0x0a, 0x02, 0x84, 0x82, 0x00, 0x4c, 0x18, 0x00, 0x7a, 0xa9, 0x01, 0x40, 0x54,
+  0x01, 0x60, 0x82, 0x00, 0xc0, 0x0d, 0x11, 0xf1, 0x2e, 0x2d, 0x00, 0x96, 0x22, 0x00, 0x8a, 0x0d, 0x00, 0x62, 0x11, 0x02, 0x86, 0x14, 0x02, 0xc8, 0x22, 0x02, 0x7e, 0x15, 0x02, 0x46, 0x0e, 0x20,
+  0xd2, 0x4b, 0x72, 0x00, 0x00, 0x50, 0x00, 0x11, 0x75, 0x38, 0x0e, 0x00, 0xb2, 0x0a, 0x00, 0x6e, 0x03, 0x00, 0x5c, 0x2b, 0x52, 0x13, 0x54, 0x75, 0x5c, 0x95, 0x66, 0xfa, 0x21, 0x54, 0xb6, 0x96,
+  0x00, 0x00, 0x9e, 0x03, 0x00, 0xbc, 0x03, 0x04, 0x60, 0xec, 0x02, 0x2c, 0x51, 0x02, 0x76, 0x1f, 0x22, 0x70, 0x3b, 0xbe, 0x5b, 0x00, 0xde, 0x57, 0x00, 0x5a, 0x03, 0x22, 0xce, 0x2a, 0xd4, 0xf6,
+  0x20, 0xee, 0x32, 0x4e, 0x07, 0x11, 0x13, 0xbe, 0x7b, 0x00, 0xd4, 0x54, 0x00, 0x68, 0x66, 0x02, 0x92, 0x66, 0x55, 0x71, 0x43, 0x30, 0x33, 0x70, 0x06, 0x3c, 0x11, 0x33, 0xde, 0x6d, 0x02, 0x74,
+  0x18, 0x03, 0xec, 0x34, 0x70, 0x5c, 0x91, 0x43, 0xee, 0x32, 0x2f, 0x33, 0xc6, 0x06, 0x00, 0x36, 0x2e, 0x04, 0x68, 0x78, 0x22, 0x12, 0x54, 0xba, 0x6d, 0x01, 0xe4, 0x03, 0x01, 0xc6, 0x11, 0x22,
+  0x70, 0x43, 0x3a, 0x71, 0x02, 0xa8, 0x9b, 0x00, 0x68, 0x23, 0x40, 0x6c, 0x22, 0x4c, 0x1a, 0xee, 0x6d, 0x30, 0xce, 0x32, 0xce, 0x80, 0x00, 0x10, 0x53, 0x08, 0x07, 0x00, 0xba, 0x46, 0x00, 0x32,
+  0x2a, 0x00, 0x98, 0x0a, 0x20, 0x13, 0x5c, 0x62, 0x3c, 0x41, 0x54, 0x64, 0xd5, 0x74, 0xee, 0x86, 0x50, 0x5b, 0x33, 0x5c, 0xf6, 0x7c, 0xaa, 0x0a, 0x00, 0x3a, 0x0e, 0x80, 0xb1, 0x53, 0xd2, 0x53,
+  0x91, 0x4b, 0x2f, 0x43, 0x20, 0x0e, 0x21, 0xb1, 0x53, 0x8c, 0x0a, 0x10, 0x64, 0x4a, 0x2e, 0x00, 0x54, 0x15, 0x20, 0xd5, 0x7c, 0x5e, 0x23, 0x20, 0x57, 0x85, 0x94, 0x5f, 0x00, 0xf4, 0x0d, 0x00,
+  0x02, 0x07, 0x02, 0x0e, 0x4e, 0x00, 0x58, 0x5c, 0x13, 0xd1, 0xb0, 0x3f, 0x00, 0xcc, 0xb4, 0x00, 0x44, 0x43, 0x00, 0x04, 0x07, 0x00, 0xd8, 0x0a, 0x02, 0xbe, 0x2a, 0x00, 0xe0, 0x11, 0x20, 0x73,
+  0x6c, 0x60, 0x03, 0x10, 0xb1, 0x7c, 0x91, 0x34, 0x63, 0xb1, 0x5b, 0xdc, 0x1f, 0x00, 0x60, 0x23, 0x02, 0x80, 0x5f, 0x44, 0xd5, 0x7c, 0xb5, 0x7c, 0x94, 0x58, 0x02, 0x08, 0x00, 0x43, 0xf5, 0x84,
+  0x52, 0x6c, 0x20, 0x1c, 0x01, 0xa4, 0x7f, 0x01, 0xca, 0x46, 0x01, 0x06, 0x00, 0x00, 0x10, 0x0e, 0x00, 0xcc, 0x26, 0x42, 0xed, 0x4a, 0x0e, 0x4b, 0xf4, 0x34, 0x00, 0x60, 0xe6, 0x11, 0x11, 0xdc,
+  0x6d, 0x00, 0x52, 0x0e, 0x22, 0xb4, 0x84, 0x26, 0x5c, 0x00, 0x0c, 0x75, 0x24, 0x73, 0x7c, 0xb8, 0x7f, 0x02, 0x8a, 0x15, 0x40, 0x52, 0x74, 0xb0, 0x5b, 0x60, 0x15, 0x02, 0x9e, 0x0a, 0x11, 0x31,
+  0xea, 0x1f, 0x11, 0x11, 0x1e, 0x2e, 0x60, 0xec, 0x52, 0xec, 0x52, 0x52, 0x84, 0x50, 0x83, 0xf0, 0x05, 0xf4, 0x94, 0xd8, 0xb5, 0x76, 0xad, 0xd8, 0xb5, 0x72, 0x8c, 0x4e, 0x63, 0xf0, 0x7b, 0x2d,
+  0x63, 0x2d, 0x63, 0x6e, 0x6b, 0xd6, 0x18, 0x01, 0x28, 0x0e, 0x10, 0x7c, 0xb8, 0x11, 0x00, 0x60, 0x6a, 0x05, 0xd2, 0x18, 0x03, 0x84, 0x0a, 0x08, 0x7c, 0x23, 0x19, 0x74, 0xa2, 0x31, 0x04, 0xdc,
+  0x1f, 0x06, 0x72, 0x23, 0x00, 0x88, 0x03, 0x01, 0x8a, 0x03, 0x20, 0xa4, 0xd3, 0x98, 0x2a, 0x50, 0x94, 0x91, 0x94, 0x91, 0x94, 0x0e, 0x67, 0x22, 0x50, 0x94, 0x14, 0x07, 0x02, 0x4a, 0x15, 0x01,
+  0xde, 0x18, 0x10, 0xa4, 0xae, 0x0a, 0x30, 0x2e, 0x9c, 0x8f, 0xe4, 0x18, 0x01, 0x06, 0x20, 0x25, 0x8f, 0xa4, 0xb0, 0x0a, 0x03, 0x32, 0x47, 0x00, 0x8c, 0x23, 0x01, 0xb4, 0x83, 0x00, 0xfa, 0xaa,
+  0x25, 0xc5, 0x95, 0xae, 0x0a, 0x00, 0x7a, 0x0e, 0x02, 0x8a, 0x75, 0x00, 0xe6, 0x11, 0x00, 0x50, 0x0e, 0x22, 0x4f, 0x9c, 0xd2, 0x11, 0x80, 0x77, 0xde, 0xb9, 0xe6, 0x17, 0x75, 0xd5, 0x64, 0x1c,
+  0x34, 0x01, 0x28, 0x3c, 0x00, 0x0e, 0xc2, 0x20, 0x33, 0x2f, 0xde, 0x7a, 0x03, 0x76, 0x9e, 0x60, 0xcd, 0x22, 0xa9, 0x01, 0x68, 0x01, 0x08, 0x07, 0xd1, 0x0b, 0x02, 0xa9, 0x01, 0x06, 0x01, 0x06,
+  0x01, 0xc9, 0x01, 0x8c, 0x1a, 0x70, 0xf8, 0x33, 0x11, 0xd2, 0x32, 0xd3, 0x00, 0x9c, 0x0a, 0x00, 0x30, 0x46, 0x13, 0x2f, 0xa8, 0xa2, 0x20, 0x54, 0x5c, 0x30, 0xe5, 0x15, 0x50, 0xfa, 0x09, 0x11,
+  0x54, 0x28, 0xe5, 0x00, 0x70, 0x1b, 0x11, 0xf2, 0x06, 0x03, 0x11, 0x53, 0x1a, 0x2d, 0x11, 0x53, 0x48, 0x03, 0x01, 0xa2, 0x18, 0x21, 0x6c, 0xf2, 0x5a, 0x7b, 0x11, 0x13, 0x30, 0x0b, 0x13, 0x91,
+  0x46, 0xec, 0x11, 0xb1, 0x70, 0x15, 0x20, 0x54, 0x5c, 0x46, 0x94, 0x02, 0x8c, 0xfa, 0x11, 0x13, 0x4e, 0x0e, 0x00, 0xa4, 0x27, 0x00, 0xa2, 0x03, 0x60, 0x30, 0x33, 0x8d, 0x1a, 0x71, 0x3b, 0xc8,
+  0x2d, 0x10, 0x95, 0xee, 0x1c, 0x01, 0xcc, 0x15, 0x01, 0xd8, 0x62, 0x12, 0x4b, 0x6c, 0x82, 0x02, 0xfc, 0x9e, 0x02, 0x2c, 0x03, 0x20, 0x13, 0x54, 0xac, 0x7b, 0x02, 0x04, 0xfe, 0x00, 0xd6, 0x3b,
+  0x20, 0x71, 0x43, 0x08, 0x00, 0x00, 0x94, 0x00, 0x41, 0xf6, 0x74, 0x17, 0x75, 0x3a, 0x12, 0x01, 0x62, 0x6d, 0x04, 0x4a, 0x78, 0x11, 0x91, 0x48, 0x31, 0x02, 0xd8, 0x1f, 0x22, 0x91, 0x43, 0x0c,
+  0x07, 0x00, 0x24, 0x03, 0x00, 0x34, 0x03, 0x02, 0x06, 0x15, 0x02, 0x98, 0xa6, 0x20, 0x30, 0x3b, 0x20, 0x00, 0x00, 0x5e, 0x0a, 0x00, 0xd6, 0x03, 0x02, 0x84, 0x78, 0x02, 0xec, 0x8d, 0x11, 0x0e,
+  0x14, 0x04, 0x02, 0xb2, 0x18, 0x02, 0x2a, 0x07, 0x00, 0x36, 0x00, 0x02, 0x14, 0x00, 0x13, 0xd2, 0xf6, 0x1f, 0x00, 0x02, 0x00, 0x00, 0x8c, 0x18, 0x00, 0xb4, 0x03, 0x00, 0x04, 0x07, 0x00, 0x68,
+  0x2e, 0x00, 0x14, 0x15, 0x41, 0x50, 0x43, 0xf2, 0x53, 0xa6, 0xf0, 0x30, 0x53, 0x54, 0x64, 0x3a, 0x0e, 0x82, 0x54, 0x64, 0xb5, 0x74, 0x75, 0x6c, 0x13, 0x64, 0x20, 0x07, 0x22, 0xf2, 0x5b, 0x76,
+  0x0a, 0x00, 0x3c, 0x0e, 0x40, 0x95, 0x74, 0x95, 0x74, 0x22, 0x07, 0xc0, 0x2e, 0x43, 0x4b, 0x22, 0x8c, 0x2a, 0x6c, 0x2a, 0x6c, 0x2a, 0xad, 0x32, 0x06, 0x00, 0x41, 0xce, 0x3a, 0x8d, 0x2a, 0x96,
+  0x51, 0x41, 0x5b, 0xd2, 0x53, 0xd2, 0x5a, 0x15, 0x00, 0xec, 0x11, 0x00, 0x2a, 0x00, 0x11, 0x53, 0x98, 0x15, 0x00, 0x40, 0x00, 0x40, 0x16, 0x7d, 0x94, 0x74, 0xaa, 0x03, 0x01, 0x4e, 0x27, 0x21,
+  0x53, 0xb0, 0x04, 0x0e, 0x02, 0x84, 0x03, 0xf0, 0x08, 0xd1, 0x63, 0x0e, 0x4b, 0xed, 0x42, 0x4f, 0x4b, 0xee, 0x42, 0x2e, 0x4b, 0xee, 0x42, 0x8c, 0x32, 0x0a, 0x2a, 0x2b, 0x2a, 0x2a, 0x2a, 0xac,
+  0x5a, 0x6a, 0x12, 0x4b, 0x92, 0x7f, 0x00, 0x6c, 0x38, 0x00, 0xa0, 0x0a, 0x02, 0x5a, 0x15, 0x00, 0xf6, 0x4d, 0x11, 0x90, 0x4c, 0x03, 0x00, 0xb0, 0x66, 0x11, 0x12, 0x40, 0x0e, 0x00, 0x54, 0x15,
+  0x02, 0xa2, 0x66, 0x20, 0xd1, 0x63, 0x80, 0x0a, 0x02, 0xdc, 0x26, 0x11, 0x11, 0x44, 0x83, 0x00, 0xae, 0x0a, 0x00, 0x8c, 0x2a, 0x00, 0x98, 0x03, 0x00, 0xd0, 0x86, 0x11, 0x73, 0xa6, 0x78, 0x20,
+  0x53, 0x74, 0xe6, 0x86, 0x00, 0xb2, 0x2a, 0x02, 0xe8, 0x46, 0x11, 0x93, 0xee, 0x34, 0x11, 0x31, 0xfe, 0x06, 0xf0, 0x03, 0x11, 0x7c, 0xcc, 0x52, 0x8e, 0x6b, 0x39, 0xc6, 0x76, 0xa5, 0xb7, 0xb5,
+  0xf4, 0x9c, 0xaf, 0x73, 0xb3, 0x94, 0x86, 0x03, 0x82, 0x10, 0x84, 0x72, 0x8c, 0x10, 0x84, 0x31, 0x84, 0x90, 0x2a, 0x13, 0x31, 0xce, 0x18, 0x15, 0x32, 0x98, 0x0a, 0x15, 0x32, 0x46, 0x35, 0x03,
+  0x34, 0x0e, 0x09, 0x8c, 0x03, 0x01, 0x02, 0x00, 0x01, 0x84, 0x03, 0x02, 0x34, 0x15, 0x02, 0xde, 0x1f, 0x10, 0xb3, 0xe2, 0x5f, 0x13, 0x94, 0x02, 0x00, 0x00, 0x08, 0x27, 0x03, 0x0c, 0x27, 0x14,
+  0xf1, 0x6c, 0x23, 0x01, 0x96, 0x0a, 0x04, 0xda, 0x18, 0x05, 0x24, 0x07, 0x01, 0x20, 0x2e, 0x20, 0x32, 0xb5, 0x14, 0x07, 0x11, 0x12, 0x88, 0x0a, 0x13, 0x32, 0x30, 0x0e, 0x13, 0x94, 0x12, 0x07,
+  0x02, 0xe6, 0x38, 0x13, 0x74, 0x16, 0xd2, 0x00, 0xda, 0x18, 0x00, 0xde, 0xc3, 0x40, 0x16, 0xd6, 0x37, 0xd6, 0x52, 0xc0, 0x20, 0x37, 0xd6, 0xde, 0x6a, 0x80, 0x98, 0xe6, 0x36, 0xd6, 0x16, 0xd6,
+  0xf5, 0xcd, 0xc4, 0x06, 0x42, 0xad, 0x1a, 0x8c, 0x1a, 0xe2, 0xf9, 0x21, 0x90, 0x3b, 0xf0, 0x73, 0x70, 0x2a, 0xce, 0x22, 0x8c, 0x1a, 0x6c, 0x1a, 0x04, 0x11, 0x11, 0x50, 0x0a, 0xa9, 0x10, 0x95,
+  0xf6, 0x09, 0x00, 0x86, 0x2a, 0x10, 0x74, 0x7a, 0xd3, 0x02, 0x52, 0x02, 0x20, 0xf2, 0x53, 0x94, 0x03, 0x02, 0xe2, 0xd6, 0x02, 0xf0, 0x70, 0x01, 0xd8, 0x97, 0x51, 0x54, 0xd6, 0x6c, 0x58, 0x7d,
+  0xe2, 0x03, 0x12, 0x54, 0x64, 0x70, 0x01, 0x18, 0x06, 0x03, 0x80, 0x5e, 0x20, 0xd2, 0x4b, 0x42, 0x06, 0x40, 0x8d, 0x22, 0xce, 0x2a, 0xd2, 0x02, 0x00, 0xbc, 0x77, 0x03, 0xaa, 0x62, 0x03, 0x00,
+  0x86, 0x22, 0xf2, 0x4b, 0x84, 0x46, 0x10, 0xb2, 0xde, 0x18, 0x10, 0x3b, 0x20, 0x00, 0xe0, 0xef, 0x2a, 0x2f, 0x33, 0x6d, 0x1a, 0x4c, 0x12, 0x8d, 0x1a, 0x2c, 0x0a, 0x2c, 0x0a, 0xca, 0x34, 0x02,
+  0x82, 0x3f, 0x20, 0x75, 0x5c, 0x98, 0x46, 0x11, 0x13, 0xf0, 0x1b, 0x02, 0xfa, 0x89, 0x11, 0x2f, 0xf8, 0xfd, 0x20, 0x0e, 0x33, 0x2c, 0xc6, 0x02, 0x02, 0xa6, 0x00, 0x6a, 0xde, 0x00, 0x60, 0x00,
+  0x20, 0x30, 0x3b, 0xe2, 0x3b, 0x00, 0x6c, 0x00, 0x11, 0xb2, 0x6c, 0x0a, 0x13, 0x0f, 0x36, 0x07, 0x00, 0x66, 0x11, 0x02, 0x68, 0x11, 0x00, 0xb8, 0x82, 0x40, 0x71, 0x43, 0x30, 0x3b, 0x02, 0x00,
+  0x30, 0x91, 0x43, 0x75, 0x32, 0x23, 0x21, 0x5c, 0x54, 0x24, 0x7c, 0x01, 0x06, 0x23, 0x12, 0x6c, 0x50, 0x1f, 0x00, 0x56, 0x04, 0x00, 0xcc, 0x1f, 0x20, 0xd6, 0x6c, 0x40, 0x15, 0x02, 0xea, 0x0e,
+  0x60, 0xf6, 0x74, 0x38, 0x7d, 0xf6, 0x74, 0x44, 0x19, 0x00, 0x2e, 0x07, 0x20, 0xf6, 0x74, 0xfc, 0x00, 0x11, 0xf6, 0x26, 0x0e, 0x02, 0xd0, 0x46, 0x40, 0xd5, 0x74, 0x16, 0x75, 0x6e, 0xc6, 0x11,
+  0x91, 0x90, 0xad, 0x60, 0xd2, 0x53, 0xf3, 0x53, 0x0f, 0x33, 0x24, 0x43, 0x00, 0xca, 0x1f, 0x00, 0x08, 0x00, 0x31, 0x0f, 0x3b, 0xad, 0xe4, 0x26, 0x22, 0x70, 0x43, 0x0a, 0x47, 0x00, 0x42, 0x27,
+  0x11, 0x13, 0x18, 0x5c, 0x00, 0x22, 0x27, 0x00, 0x08, 0x07, 0x00, 0x3a, 0x0e, 0xc0, 0x95, 0x74, 0xb5, 0x74, 0x58, 0x85, 0x58, 0x85, 0x37, 0x85, 0x95, 0x6c, 0x3a, 0x07, 0x51, 0x70, 0x4b, 0x2f,
+  0x43, 0x0f, 0x7a, 0xb8, 0x00, 0x16, 0x15, 0x03, 0xaa, 0x58, 0x01, 0xf0, 0x11, 0x20, 0xf2, 0x5b, 0xc2, 0x2a, 0x00, 0x7e, 0x03, 0x00, 0x6e, 0x03, 0x11, 0x50, 0x0e, 0x40, 0x00, 0x08, 0x00, 0x22,
+  0x0e, 0x3b, 0x24, 0x00, 0xc0, 0x12, 0x5c, 0x4f, 0x4b, 0xcd, 0x32, 0xea, 0x19, 0xad, 0x32, 0xad, 0x32, 0xc0, 0x38, 0x51, 0x70, 0x53, 0xd1, 0x5b, 0x2f, 0xa4, 0x2a, 0x22, 0xb0, 0x5b, 0x8e, 0x58,
+  0x00, 0x96, 0x03, 0x00, 0x16, 0x00, 0x00, 0x0a, 0x20, 0x00, 0x12, 0x07, 0x60, 0x15, 0x8d, 0x15, 0x8d, 0xd4, 0x7c, 0x3a, 0x71, 0x00, 0xc2, 0x54, 0x00, 0x04, 0x00, 0x02, 0x5a, 0x78, 0x11, 0xf0,
+  0x2e, 0xd8, 0x22, 0xf5, 0x84, 0xc8, 0x18, 0x02, 0x12, 0x20, 0x00, 0x7e, 0x0a, 0x50, 0x2e, 0x4b, 0xb0, 0x63, 0x73, 0x08, 0x00, 0x10, 0x53, 0x2a, 0x6a, 0x00, 0xa6, 0x66, 0x22, 0x94, 0x7c, 0x84,
+  0x78, 0x13, 0xb0, 0x1c, 0x35, 0x40, 0xd0, 0x63, 0x90, 0x63, 0xb2, 0x0a, 0x22, 0x6f, 0x5b, 0x54, 0x15, 0x04, 0x34, 0x7c, 0x22, 0x52, 0x74, 0x1e, 0x2e, 0x00, 0x4c, 0x3c, 0xc1, 0xab, 0x4a, 0xab,
+  0x4a, 0x31, 0x7c, 0x35, 0x9d, 0x35, 0xa5, 0xd4, 0x94, 0xae, 0x9f, 0x30, 0x94, 0x97, 0xad, 0x2e, 0x35, 0x42, 0xd3, 0x94, 0x10, 0x7c, 0x72, 0xca, 0x00, 0x8a, 0x78, 0x11, 0x92, 0x7c, 0xc3, 0x22,
+  0x72, 0x84, 0xf6, 0xbf, 0x00, 0xe0, 0x18, 0x05, 0x3c, 0x0e, 0x06, 0x50, 0x3c, 0x07, 0x86, 0x03, 0x06, 0xac, 0x0a, 0x22, 0xb3, 0x94, 0x02, 0x00, 0x13, 0x71, 0x02, 0x00, 0x71, 0x70, 0x94, 0x50,
+  0x94, 0x50, 0x94, 0x70, 0x88, 0x03, 0x02, 0xc2, 0x58, 0x00, 0x2e, 0x55, 0x23, 0x11, 0xad, 0xa2, 0x0a, 0x02, 0x72, 0x23, 0x04, 0x46, 0x15, 0x01, 0x3e, 0x15, 0x00, 0x6c, 0x1c, 0x02, 0x0a, 0x00,
+  0x08, 0xe4, 0x38, 0x02, 0xfe, 0x78, 0x03, 0xce, 0x8a, 0x03, 0x90, 0x03, 0x12, 0x74, 0xa6, 0x2a, 0x30, 0xcd, 0xb5, 0xcd, 0x22, 0x07, 0x40, 0xf6, 0xd5, 0xf6, 0xcd, 0xf0, 0x18, 0x42, 0xb1, 0xa4,
+  0x74, 0xbd, 0x08, 0x39, 0x20, 0x57, 0xde, 0x60, 0x15, 0x20, 0xf5, 0xcd, 0x26, 0x00, 0x02, 0xe2, 0x4c, 0x00, 0x10, 0x54, 0x02, 0xc0, 0x6c, 0x02, 0x08, 0x90, 0x20, 0xb5, 0x64, 0xe4, 0x6c, 0x71,
+  0xd5, 0x64, 0xd5, 0x64, 0x17, 0x75, 0x57, 0x44, 0x06, 0x12, 0x74, 0xb4, 0x18, 0x01, 0x0a, 0x15, 0x02, 0x42, 0x3b, 0x02, 0x18, 0x15, 0x11, 0xb5, 0x50, 0xd3, 0x00, 0xee, 0x65, 0x00, 0x24, 0x00,
+  0x00, 0x4e, 0x03, 0x40, 0xce, 0x22, 0x2b, 0x0a, 0xac, 0x42, 0x00, 0x50, 0x2d, 0x00, 0x0a, 0x3f, 0x20, 0x58, 0x7d, 0x1e, 0x7b, 0x21, 0x17, 0x7d, 0xc4, 0x02, 0x01, 0xd2, 0x6c, 0x00, 0x70, 0x02,
+  0x62, 0x91, 0x43, 0xd2, 0x53, 0x95, 0x6c, 0x6a, 0xc9, 0x00, 0x76, 0xb0, 0x22, 0xf2, 0x53, 0xe6, 0x18, 0x02, 0xc4, 0x03, 0x21, 0x34, 0x5c, 0xa2, 0x7f, 0x12, 0x64, 0x12, 0x00, 0x00, 0x04, 0x07,
+  0x51, 0xf3, 0x4b, 0x75, 0x5c, 0xb6, 0xec, 0x97, 0x02, 0x88, 0x03, 0x02, 0x08, 0x0e, 0x01, 0x8c, 0x69, 0x12, 0x4b, 0xb8, 0x22, 0x02, 0x00, 0x78, 0x00, 0xa8, 0x11, 0x11, 0xd2, 0xf8, 0x89, 0x02,
+  0x38, 0xb4, 0x00, 0x52, 0x0a, 0x22, 0xb2, 0x4b, 0x92, 0x0e, 0x31, 0x34, 0x5c, 0x75, 0x26, 0x04, 0x00, 0x82, 0x38, 0x00, 0x42, 0x03, 0x00, 0x24, 0x12, 0x00, 0x2c, 0x07, 0x00, 0x26, 0x03, 0x04,
+  0xe8, 0x82, 0x23, 0x54, 0x5c, 0xae, 0x38, 0x21, 0x53, 0x91, 0x6e, 0xfe, 0x00, 0x6e, 0x18, 0x00, 0x76, 0x11, 0x00, 0x96, 0x26, 0x00, 0x74, 0x31, 0x01, 0x3e, 0x07, 0x01, 0x8a, 0x18, 0x40, 0xd2,
+  0x53, 0x95, 0x64, 0xd4, 0x00, 0x00, 0xa6, 0x03, 0x00, 0x00, 0x0e, 0x80, 0xee, 0x32, 0x8c, 0x22, 0x2b, 0x12, 0x0a, 0x0a, 0xf2, 0x4d, 0x00, 0x74, 0x03, 0x30, 0x33, 0x64, 0x95, 0x52, 0x31, 0x10,
+  0x4b, 0x60, 0x03, 0x00, 0xfe, 0x06, 0x10, 0x0f, 0x44, 0x95, 0x70, 0x64, 0xf3, 0x53, 0xd6, 0x74, 0x58, 0x85, 0x10, 0x01, 0x00, 0x02, 0x00, 0xa0, 0xd6, 0x74, 0x17, 0x7d, 0x37, 0x85, 0xf6, 0x7c,
+  0x58, 0x85, 0x0c, 0x00, 0x11, 0xb5, 0xa0, 0x0a, 0xc2, 0xd6, 0x74, 0x38, 0x85, 0xb9, 0x95, 0x99, 0x95, 0x37, 0x85, 0x37, 0x85, 0x06, 0x32, 0x00, 0x18, 0x0e, 0x00, 0xc2, 0x03, 0x01, 0xd4, 0x11,
+  0x00, 0x40, 0x15, 0x10, 0x64, 0x4a, 0x1c, 0x40, 0xb5, 0x74, 0xd2, 0x5b, 0x64, 0x7f, 0x00, 0x0a, 0x00, 0x00, 0x3a, 0x00, 0x00, 0x26, 0x00, 0x11, 0x13, 0xf6, 0x18, 0x02, 0xb6, 0x0a, 0x62, 0x4f,
+  0x43, 0x94, 0x6c, 0x95, 0x74, 0x90, 0x2a, 0x40, 0x95, 0x74, 0xd2, 0x5b, 0x04, 0x20, 0x40, 0x0e, 0x3b, 0x0e, 0x43, 0x74, 0x0e, 0x02, 0x6a, 0x15, 0x00, 0xc0, 0x23, 0x04, 0x3e, 0x15, 0x11, 0x94,
+  0x54, 0x5f, 0x42, 0xf6, 0x84, 0x53, 0x6c, 0x9e, 0x46, 0x21, 0x33, 0x6c, 0xf8, 0x11, 0xf2, 0x16, 0x63, 0xf0, 0x63, 0xd3, 0x7c, 0x92, 0x7c, 0x51, 0x6c, 0x51, 0x6c, 0xcf, 0x5b, 0x6e, 0x53, 0xcf,
+  0x5b, 0x0c, 0x4b, 0xec, 0x42, 0x0c, 0x43, 0xeb, 0x42, 0x6d, 0x53, 0x2d, 0x4b, 0x2d, 0x4b, 0xcc, 0x42, 0x6b, 0x32, 0xcd, 0x42, 0xbc, 0x3f, 0x20, 0x90, 0x5b, 0x6e, 0x03, 0x00, 0xd6, 0x74, 0x11,
+  0x53, 0x98, 0x38, 0x00, 0x68, 0x03, 0x11, 0x12, 0xbe, 0x6d, 0x11, 0x12, 0xee, 0x38, 0x11, 0x73, 0xb8, 0x86, 0x00, 0x38, 0x07, 0x31, 0x12, 0x74, 0x32, 0x34, 0x07, 0x00, 0x78, 0x71, 0x20, 0x90,
+  0x5b, 0xd8, 0x0a, 0x20, 0x8f, 0x5b, 0x8e, 0x91, 0x00, 0x16, 0x00, 0x11, 0xaf, 0xc4, 0x11, 0x90, 0xec, 0x52, 0x4e, 0x63, 0x72, 0x84, 0xf8, 0xb5, 0xb3, 0x48, 0x1c, 0xd0, 0x84, 0x15, 0xa5, 0x18,
+  0xbe, 0x14, 0x9d, 0xb7, 0xb5, 0x72, 0x8c, 0x29, 0x42, 0x8c, 0xd8, 0x00, 0x04, 0xce, 0x00, 0xa2, 0x03, 0x53, 0xf0, 0x7b, 0x72, 0x8c, 0x31, 0xbe, 0x11, 0x16, 0x32, 0x88, 0x03, 0x01, 0x70, 0x03,
+  0x01, 0x90, 0x03, 0x12, 0x8c, 0x0c, 0x6e, 0x06, 0x14, 0x00, 0x02, 0x24, 0x8e, 0x10, 0xb4, 0x3a, 0x4e, 0xf3, 0x00, 0x94, 0x52, 0x8c, 0x10, 0x84, 0x30, 0x8c, 0x50, 0x8c, 0x70, 0x94, 0x90, 0x9c,
+  0x90, 0x9c, 0x34, 0x55, 0x01, 0x0e, 0x07, 0x11, 0xd0, 0x50, 0x1c, 0x00, 0x8a, 0x0a, 0x01, 0xbe, 0x38, 0x01, 0x4a, 0x15, 0x14, 0xd1, 0x26, 0x2e, 0x01, 0x9c, 0x03, 0x02, 0x24, 0x07, 0x02, 0x0c,
+  0x00, 0x00, 0x1a, 0x07, 0x02, 0x94, 0x03, 0x02, 0xbe, 0x31, 0x13, 0x94, 0x98, 0x0a, 0x02, 0x46, 0x35, 0x00, 0x5c, 0xc0, 0x00, 0xb0, 0x0a, 0x02, 0xc2, 0x83, 0x40, 0xf6, 0xd5, 0x16, 0xd6, 0x0c,
+  0x20, 0x00, 0xfc, 0x0a, 0x00, 0x24, 0x07, 0x62, 0xf2, 0xac, 0x6f, 0x9c, 0x37, 0xd6, 0x28, 0x00, 0x11, 0x37, 0xf8, 0x18, 0x10, 0xb1, 0x7e, 0xc5, 0x00, 0xd0, 0x7a, 0x01, 0xb0, 0x2d, 0x02, 0x20,
+  0x4d, 0x02, 0x3c, 0x54, 0x22, 0xee, 0x22, 0x7c, 0x31, 0x02, 0x5c, 0x1f, 0x00, 0x92, 0x90, 0x20, 0x8d, 0x22, 0xe6, 0x02, 0x00, 0xfa, 0xcf, 0x11, 0xd5, 0xec, 0x09, 0x20, 0x16, 0x75, 0xb6, 0x03,
+  0x00, 0x54, 0x0e, 0x00, 0x86, 0x0a, 0x00, 0x88, 0x63, 0x00, 0xfe, 0x11, 0x40, 0x17, 0x75, 0x98, 0x85, 0x0a, 0x00, 0x20, 0xd2, 0x4b, 0xfe, 0x0a, 0x11, 0x91, 0xf8, 0x6c, 0x02, 0xfe, 0x2c, 0x02,
+  0x24, 0x0a, 0x80, 0x58, 0x85, 0x78, 0x85, 0xd9, 0x8d, 0x99, 0x8d, 0x38, 0x06, 0x20, 0x17, 0x75, 0x3c, 0x34, 0x02, 0x22, 0x8d, 0x02, 0x08, 0x51, 0x02, 0x66, 0x23, 0x11, 0xd6, 0xb4, 0x1f, 0x00,
+  0xe6, 0x50, 0x11, 0x34, 0x20, 0x03, 0x04, 0xd4, 0x3b, 0x20, 0x54, 0x54, 0x40, 0x0e, 0x40, 0x78, 0x7d, 0xf7, 0x6c, 0x90, 0x3f, 0x60, 0x79, 0x85, 0x38, 0x7d, 0x95, 0x64, 0x8a, 0x00, 0x71, 0x74,
+  0x64, 0x17, 0x75, 0xd6, 0x74, 0x54, 0xcc, 0x0e, 0x10, 0x53, 0x82, 0x0d, 0x03, 0x96, 0xd0, 0x00, 0x0a, 0x0e, 0x02, 0x08, 0x00, 0x01, 0x0a, 0x0f, 0x12, 0x74, 0x3c, 0x03, 0x00, 0x88, 0x03, 0x00,
+  0x9e, 0x03, 0x00, 0x52, 0x00, 0x00, 0x5e, 0x11, 0x00, 0x2a, 0x2a, 0x10, 0x13, 0x0e, 0x04, 0x01, 0xf6, 0x54, 0x00, 0x52, 0xb8, 0x02, 0x0a, 0x71, 0x02, 0xb2, 0x06, 0x10, 0x74, 0x0e, 0x07, 0x00,
+  0x18, 0x07, 0x21, 0x74, 0x95, 0x84, 0x1f, 0x11, 0x33, 0x0a, 0x07, 0x02, 0x1a, 0xed, 0x11, 0x91, 0x6a, 0x0e, 0x11, 0xb1, 0xec, 0x06, 0x10, 0x71, 0x42, 0x23, 0x01, 0xac, 0x8d, 0x11, 0x50, 0xbe,
+  0x66, 0x40, 0x0f, 0x3b, 0x70, 0x43, 0xf8, 0x0d, 0x22, 0x6c, 0x22, 0x16, 0x4e, 0x00, 0x86, 0x04, 0x20, 0x34, 0x5c, 0x92, 0x07, 0x02, 0x9e, 0x11, 0x91, 0x50, 0x43, 0x0f, 0x3b, 0xee, 0x3a, 0xce,
+  0x32, 0x0f, 0x6c, 0x9f, 0x40, 0xb2, 0x53, 0x50, 0x43, 0xc6, 0x26, 0x11, 0x34, 0x18, 0x07, 0x20, 0x0f, 0x3b, 0xb8, 0x23, 0x00, 0xb0, 0x2a, 0x00, 0x6a, 0x1c, 0x00, 0x5c, 0x43, 0x00, 0x5c, 0x1c,
+  0x90, 0x13, 0x5c, 0x2f, 0x43, 0x50, 0x4b, 0xb1, 0x53, 0xd2, 0xd2, 0x38, 0x12, 0x64, 0x2e, 0x15, 0x00, 0x0a, 0x07, 0x02, 0x02, 0x27, 0x30, 0x0e, 0x3b, 0x0f, 0x6c, 0xed, 0x02, 0x5a, 0x27, 0x10,
+  0x43, 0xe2, 0x11, 0x00, 0xa6, 0x4a, 0xe0, 0x74, 0x6c, 0x17, 0x85, 0x53, 0x64, 0xd1, 0x5b, 0x33, 0x64, 0x37, 0x85, 0x57, 0x8d, 0xf8, 0xfe, 0x02, 0x02, 0x95, 0x00, 0x0c, 0x47, 0x00, 0x12, 0x75,
+  0x00, 0xc4, 0x11, 0x11, 0x53, 0x82, 0x23, 0x11, 0xd1, 0xe6, 0x1f, 0x01, 0xfe, 0x2d, 0x03, 0x18, 0x63, 0x00, 0x80, 0x18, 0xf0, 0x05, 0x72, 0x74, 0x10, 0x64, 0x2d, 0x4b, 0x6a, 0x32, 0x4d, 0x4b,
+  0x0c, 0x43, 0xec, 0x42, 0x2d, 0x4b, 0x6e, 0x53, 0x0c, 0x4b, 0x02, 0x00, 0x80, 0x2d, 0x4b, 0x2c, 0x4b, 0x4d, 0x53, 0xd0, 0x63, 0x34, 0x5c, 0x11, 0x6f, 0x0c, 0x75, 0x00, 0x02, 0x0e, 0x41, 0xd0,
+  0x63, 0xb4, 0x84, 0xee, 0x7b, 0x00, 0xb2, 0x58, 0x10, 0x8c, 0xb6, 0x18, 0x00, 0x6c, 0x71, 0x11, 0xd1, 0x7a, 0x6a, 0x00, 0xaa, 0x0a, 0x02, 0x5e, 0x23, 0x40, 0xb0, 0x63, 0x6f, 0x5b, 0x06, 0x00,
+  0x31, 0x2e, 0x53, 0x6f, 0x62, 0x0e, 0x02, 0xb8, 0x11, 0x02, 0x3a, 0x0e, 0x80, 0x11, 0x74, 0x4d, 0x5b, 0x31, 0x7c, 0xb3, 0x8c, 0xdc, 0x6d, 0x20, 0x10, 0x7c, 0x2e, 0x35, 0xf3, 0x05, 0xf8, 0xbd,
+  0x7a, 0xce, 0x96, 0xad, 0x76, 0xad, 0x76, 0xad, 0x39, 0xc6, 0x92, 0x8c, 0x72, 0x8c, 0xaf, 0x73, 0x51, 0x84, 0xc0, 0x38, 0x00, 0x28, 0x43, 0x05, 0x50, 0x15, 0x13, 0x72, 0x92, 0x03, 0x03, 0x22,
+  0x07, 0x03, 0x08, 0x07, 0x04, 0x08, 0x00, 0x03, 0xa8, 0x11, 0x01, 0x98, 0x43, 0xb3, 0x11, 0x7c, 0xf0, 0x7b, 0xcf, 0x7b, 0x30, 0x84, 0x71, 0x94, 0xb2, 0x88, 0x03, 0x01, 0x52, 0x43, 0x00, 0x82,
+  0x83, 0x05, 0xa4, 0x31, 0x31, 0xd0, 0xac, 0xf0, 0xfe, 0x26, 0x02, 0x16, 0x0e, 0x04, 0x2c, 0x2e, 0x00, 0x68, 0x43, 0x05, 0x8c, 0x03, 0x01, 0x16, 0x00, 0x93, 0x32, 0xb5, 0xf2, 0xb4, 0x32, 0xbd,
+  0x32, 0xb5, 0x33, 0x46, 0x35, 0x24, 0xb4, 0xc5, 0xaa, 0x0a, 0x02, 0x7a, 0xc7, 0x00, 0x1e, 0x07, 0x00, 0x22, 0x47, 0x01, 0x44, 0x87, 0x01, 0x8c, 0x03, 0x00, 0xe6, 0x11, 0x40, 0x37, 0xd6, 0xf5,
+  0xcd, 0x5a, 0x00, 0x00, 0x94, 0xce, 0x42, 0x53, 0xbd, 0xf5, 0xcd, 0x40, 0xb9, 0x60, 0x78, 0xde, 0x36, 0xd6, 0xee, 0x22, 0x1c, 0x07, 0x11, 0x0e, 0x94, 0x70, 0x00, 0x9a, 0x26, 0x00, 0xb6, 0x8c,
+  0x10, 0x90, 0x34, 0xbb, 0x02, 0xac, 0x11, 0x01, 0xae, 0xb3, 0x11, 0xb1, 0xa8, 0xe1, 0x00, 0x0c, 0x0e, 0x00, 0x16, 0x0e, 0x11, 0x95, 0xfa, 0x8f, 0x02, 0x8e, 0x49, 0x00, 0x6e, 0x15, 0xc0, 0x6c,
+  0x1a, 0x4b, 0x1a, 0x4b, 0x12, 0x4b, 0x12, 0x0b, 0x0a, 0x2b, 0x0a, 0xe6, 0x0a, 0x00, 0xa8, 0x06, 0x00, 0x7e, 0x0e, 0x02, 0xf4, 0xba, 0x20, 0x95, 0x64, 0x84, 0x03, 0x00, 0x6a, 0x22, 0x20, 0xb8,
+  0x8d, 0x16, 0x82, 0x00, 0x8c, 0x1b, 0x51, 0x6b, 0x1a, 0x6c, 0x22, 0xad, 0x28, 0x74, 0x11, 0x50, 0x5a, 0x0d, 0x00, 0xde, 0x2a, 0x00, 0x06, 0x0a, 0x10, 0x74, 0x3c, 0x51, 0x01, 0x34, 0x94, 0x02,
+  0x50, 0x23, 0x00, 0x30, 0x38, 0x00, 0x50, 0x00, 0x02, 0xc8, 0x1f, 0x02, 0x6e, 0x15, 0x00, 0x80, 0x0a, 0x00, 0x28, 0x20, 0x00, 0x52, 0x0e, 0x00, 0xd0, 0x07, 0x00, 0x86, 0x46, 0x11, 0x8d, 0xa0,
+  0x3f, 0x11, 0xb1, 0xe8, 0x29, 0x01, 0x1e, 0xa6, 0x21, 0x53, 0x53, 0x44, 0xb4, 0x60, 0x16, 0x75, 0x78, 0x85, 0xf6, 0x74, 0x5e, 0x38, 0x31, 0xd5, 0x6c, 0x54, 0x64, 0x0b, 0x00, 0x16, 0x07, 0x00,
+  0x6a, 0x00, 0x02, 0x32, 0x4a, 0x00, 0xae, 0x3f, 0x11, 0x95, 0xca, 0xd0, 0x00, 0x9c, 0x03, 0x62, 0x74, 0x64, 0x75, 0x64, 0x54, 0x64, 0x6e, 0x7f, 0x02, 0x34, 0x0e, 0x00, 0x12, 0x27, 0x21, 0x8d,
+  0x2a, 0xe2, 0x14, 0x01, 0x2c, 0xa6, 0x00, 0x12, 0x0e, 0x00, 0xa0, 0x11, 0x00, 0x24, 0x00, 0x00, 0x42, 0x78, 0x00, 0x6c, 0x78, 0x00, 0x94, 0x03, 0x20, 0x0f, 0x3b, 0xaa, 0x0d, 0x00, 0x76, 0x11,
+  0x00, 0x4a, 0x0e, 0x02, 0x08, 0x08, 0x11, 0x54, 0xcc, 0x5b, 0x62, 0x13, 0x5c, 0x95, 0x6c, 0x33, 0x5c, 0x7a, 0x43, 0x00, 0x18, 0x0e, 0x11, 0xd2, 0x10, 0x5c, 0x10, 0x95, 0x80, 0x00, 0x50, 0x5c,
+  0xf3, 0x5b, 0xb5, 0x74, 0x80, 0x0a, 0x00, 0x22, 0x0e, 0x20, 0xd2, 0x53, 0x34, 0x43, 0x00, 0x9a, 0x0a, 0x00, 0x10, 0x00, 0x00, 0x36, 0x00, 0x30, 0xb5, 0x74, 0x54, 0x06, 0x07, 0x00, 0x1e, 0x00,
+  0x00, 0xce, 0x4a, 0x51, 0x6c, 0x74, 0x6c, 0x54, 0x6c, 0x0c, 0x40, 0x00, 0x18, 0x0e, 0x10, 0x5b, 0xba, 0x03, 0x10, 0x74, 0x0c, 0x12, 0xa0, 0x74, 0xb5, 0x7c, 0x57, 0x8d, 0x78, 0x8d, 0xf6, 0x7c,
+  0x74, 0x38, 0x04, 0x30, 0x84, 0xf6, 0x7c, 0xda, 0x18, 0x60, 0x13, 0x64, 0x74, 0x6c, 0xd1, 0x5b, 0x28, 0x00, 0x31, 0x33, 0x64, 0x50, 0xe0, 0x31, 0x00, 0x28, 0x0e, 0x20, 0x2f, 0x4b, 0x4c, 0x15,
+  0x22, 0x0e, 0x43, 0x64, 0x7f, 0x00, 0x36, 0x83, 0x02, 0x9e, 0x0a, 0x02, 0xec, 0x18, 0x00, 0x86, 0x1c, 0x20, 0xed, 0x42, 0x38, 0x15, 0x31, 0x2f, 0x4b, 0x0e, 0x8a, 0x43, 0xc0, 0xee, 0x42, 0x8c,
+  0x3a, 0x0a, 0x22, 0x6b, 0x32, 0x6b, 0x32, 0x2e, 0x4b, 0xf0, 0x14, 0x80, 0x0d, 0x4b, 0xed, 0x42, 0xab, 0x3a, 0xcc, 0x42, 0x28, 0xff, 0xd0, 0x4e, 0x53, 0xcc, 0x42, 0x2e, 0x53, 0xcc, 0x42, 0x8b,
+  0x3a, 0x2e, 0x4b, 0x32, 0xd2, 0x7f, 0x01, 0x96, 0x23, 0x00, 0xb0, 0x0a, 0x00, 0x02, 0x4e, 0x00, 0xca, 0x3f, 0x00, 0x96, 0x0a, 0x00, 0xe8, 0x94, 0x20, 0x4f, 0x53, 0x6e, 0x78, 0x22, 0x12, 0x74,
+  0xc0, 0x3f, 0x02, 0x1a, 0x07, 0x20, 0x93, 0x7c, 0xd2, 0x11, 0x10, 0xb3, 0x0a, 0xe3, 0x10, 0x6c, 0x9a, 0x03, 0x40, 0x8f, 0x63, 0x11, 0x74, 0xa2, 0xe6, 0xf0, 0x01, 0x8f, 0x63, 0x8f, 0x63, 0xcc,
+  0x4a, 0x92, 0x84, 0x56, 0xa5, 0x96, 0xad, 0x55, 0xa5, 0x31, 0x84, 0xda, 0x3f, 0xa0, 0x55, 0xa5, 0xf8, 0xbd, 0x59, 0xc6, 0xd8, 0xbd, 0xf8, 0xbd, 0xde, 0x3f, 0x40, 0x18, 0xbe, 0x55, 0xa5, 0x14,
+  0x07, 0x70, 0x93, 0x94, 0x11, 0x84, 0x52, 0x8c, 0x32, 0x40, 0x0e, 0x47, 0x84, 0x51, 0x84, 0x52, 0x02, 0x00, 0x04, 0x0e, 0x07, 0x11, 0xb3, 0xd0, 0x31, 0x04, 0x18, 0x07, 0x12, 0x72, 0x98, 0xa3,
+  0x50, 0x73, 0xd0, 0x73, 0xf1, 0x73, 0x52, 0x2e, 0x40, 0x52, 0x8c, 0x51, 0x8c, 0xa6, 0x0a, 0x00, 0x42, 0x3c, 0x19, 0xb0, 0x42, 0x3c, 0x02, 0x76, 0x03, 0x06, 0xac, 0x31, 0x24, 0xb0, 0xac, 0xe4,
+  0x1f, 0x12, 0x11, 0xd2, 0x18, 0x02, 0xba, 0xbc, 0x05, 0x12, 0x67, 0x07, 0xca, 0x51, 0x01, 0x5e, 0xc0, 0x06, 0x2a, 0x0e, 0x03, 0x74, 0x1c, 0x01, 0x4e, 0x35, 0x00, 0x62, 0x15, 0x01, 0x32, 0x80,
+  0x01, 0xae, 0x0a, 0x00, 0x94, 0x03, 0x00, 0x10, 0x07, 0x00, 0xc2, 0xbc, 0x20, 0x36, 0xd6, 0x02, 0x19, 0x60, 0x98, 0xe6, 0xb1, 0xa4, 0x53, 0xbd, 0xca, 0x2a, 0x00, 0xe4, 0x06, 0x02, 0x36, 0x15,
+  0x06, 0x2a, 0x15, 0x11, 0x74, 0xec, 0x7a, 0x00, 0x2e, 0x07, 0x00, 0xa6, 0x0a, 0x10, 0xb5, 0x96, 0x09, 0x01, 0xf0, 0xc1, 0x01, 0x6e, 0x77, 0x23, 0x33, 0xf2, 0x10, 0x18, 0x11, 0x90, 0x22, 0x26,
+  0x00, 0xe0, 0x17, 0x11, 0xed, 0xce, 0x1b, 0x22, 0x4f, 0x3b, 0xda, 0x2a, 0x00, 0x5c, 0x06, 0x00, 0x24, 0x00, 0x00, 0x00, 0x07, 0x00, 0x60, 0x06, 0x00, 0xb6, 0x57, 0x00, 0x98, 0x06, 0x20, 0x4f,
+  0x3b, 0xce, 0xb3, 0x20, 0x90, 0x43, 0xba, 0x57, 0x02, 0x56, 0xde, 0x11, 0x90, 0xc0, 0x77, 0x11, 0x8d, 0xb6, 0x90, 0x02, 0x76, 0xc2, 0x11, 0xcd, 0x74, 0x5b, 0x02, 0x00, 0xbb, 0x20, 0x90, 0x43,
+  0x70, 0x0a, 0x02, 0xbe, 0x9e, 0x11, 0x2f, 0x42, 0x11, 0x02, 0x6c, 0x12, 0x00, 0xa4, 0x0a, 0x13, 0x50, 0x96, 0x23, 0x22, 0x33, 0x54, 0x0e, 0x78, 0x02, 0xde, 0x2d, 0x02, 0x0c, 0x03, 0x00, 0x96,
+  0x03, 0x02, 0x42, 0x3f, 0x02, 0xa6, 0xb0, 0x02, 0xb8, 0xb7, 0x00, 0x02, 0x00, 0x02, 0xea, 0x2d, 0x00, 0x60, 0x11, 0x02, 0xa8, 0x0a, 0x02, 0xa4, 0x03, 0x00, 0x3e, 0x03, 0x00, 0x02, 0x03, 0x51,
+  0x13, 0x54, 0xd2, 0x53, 0xb2, 0xf0, 0x06, 0x11, 0x54, 0xae, 0x46, 0x50, 0x54, 0x64, 0x53, 0x5c, 0x54, 0xa2, 0x03, 0x01, 0xc0, 0x1b, 0x20, 0xb5, 0x6c, 0x24, 0x00, 0x00, 0x40, 0x0a, 0x40, 0x37,
+  0x7d, 0x17, 0x7d, 0xe6, 0x07, 0x62, 0xb5, 0x6c, 0x58, 0x7d, 0x95, 0x6c, 0x60, 0x07, 0x00, 0xa4, 0x31, 0x20, 0x17, 0x7d, 0x86, 0x0a, 0x02, 0x24, 0x00, 0x00, 0x70, 0x4a, 0x11, 0x33, 0x38, 0x58,
+  0x00, 0x86, 0x03, 0x00, 0x38, 0x07, 0x00, 0x0a, 0x01, 0x20, 0x95, 0x6c, 0x04, 0x00, 0x00, 0x62, 0x5c, 0x01, 0xce, 0x0a, 0x00, 0x56, 0x15, 0x01, 0x8c, 0x0a, 0x20, 0x54, 0x64, 0x72, 0x0a, 0x00,
+  0x8c, 0x0a, 0x00, 0x78, 0x11, 0x00, 0xc8, 0x0b, 0x00, 0x40, 0x07, 0x02, 0x56, 0x43, 0x02, 0xba, 0x3f, 0x60, 0x54, 0x6c, 0x16, 0x7d, 0xf6, 0x7c, 0xac, 0x38, 0x30, 0x16, 0x85, 0x33, 0x66, 0x43,
+  0x70, 0x64, 0x33, 0x64, 0x90, 0x53, 0x74, 0x6c, 0xde, 0x06, 0xb1, 0x33, 0x6c, 0xb1, 0x53, 0x0e, 0x43, 0xf2, 0x63, 0x13, 0x64, 0x54, 0xf8, 0x11, 0x00, 0x4c, 0x00, 0x02, 0x7e, 0x3c, 0x21, 0x54,
+  0x6c, 0xc0, 0x4a, 0x52, 0x74, 0xb5, 0x7c, 0x16, 0x85, 0x94, 0x0a, 0x20, 0xd5, 0x84, 0xf6, 0x26, 0x00, 0x82, 0x26, 0x02, 0x0c, 0xaa, 0x00, 0xaa, 0x8d, 0x00, 0xfe, 0x6d, 0x10, 0x32, 0xb8, 0x7f,
+  0x03, 0x90, 0x2a, 0x21, 0x32, 0x6c, 0x4a, 0x5c, 0x11, 0x5b, 0x66, 0x15, 0x11, 0x6c, 0x78, 0x86, 0x12, 0x63, 0x68, 0x2a, 0x00, 0x58, 0x23, 0x31, 0x12, 0x6c, 0x32, 0xb6, 0x26, 0x00, 0xa6, 0x8d,
+  0x00, 0x34, 0x43, 0x20, 0x6f, 0x53, 0xf8, 0x54, 0x00, 0x28, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x5c, 0x4a, 0x40, 0x53, 0x7c, 0x2e, 0x53, 0xa0, 0x86, 0x70, 0xcc, 0x4a, 0x8c, 0x42, 0x6f, 0x5b, 0x94,
+  0xd6, 0x11, 0x11, 0x6b, 0x84, 0x98, 0x00, 0x7e, 0x00, 0x21, 0x84, 0x32, 0xf0, 0x8d, 0x00, 0xfc, 0x18, 0x20, 0x8f, 0x5b, 0xa2, 0x0a, 0x00, 0x34, 0x83, 0x00, 0x4c, 0x15, 0x00, 0x2e, 0x5c, 0x00,
+  0xb0, 0xed, 0x80, 0x51, 0x7c, 0xf4, 0x94, 0x56, 0xa5, 0xd7, 0xb5, 0x8a, 0x03, 0x40, 0xb7, 0xb5, 0x96, 0xad, 0x3a, 0x35, 0xf1, 0x04, 0x55, 0xa5, 0x96, 0xad, 0x59, 0xce, 0xb7, 0xb5, 0xf8, 0xbd,
+  0xbb, 0xd6, 0xd3, 0x94, 0xb3, 0x94, 0x14, 0x9d, 0x31, 0x8a, 0x03, 0x75, 0x11, 0x84, 0x32, 0x84, 0x72, 0x8c, 0x92, 0x14, 0x0e, 0x11, 0xb4, 0xc2, 0x58, 0x11, 0xb3, 0x2e, 0x27, 0x00, 0x92, 0x1c,
+  0x13, 0xf0, 0x94, 0x1c, 0x10, 0x11, 0x80, 0x15, 0x03, 0x34, 0x07, 0x02, 0x2a, 0x55, 0x00, 0xec, 0xd1, 0x00, 0x34, 0x0e, 0x24, 0xb1, 0x9c, 0xc8, 0x3f, 0x13, 0xb0, 0x2a, 0x35, 0x06, 0x90, 0x03,
+  0x28, 0xd1, 0xac, 0xd0, 0x18, 0x09, 0x88, 0x23, 0x03, 0xc2, 0x51, 0x13, 0x53, 0xea, 0x1f, 0x26, 0x74, 0xbd, 0x12, 0x07, 0x04, 0x8a, 0x03, 0x17, 0xb5, 0x12, 0x00, 0x04, 0x0e, 0x00, 0x00, 0xa2,
+  0x2a, 0x62, 0x2f, 0x94, 0x4f, 0x9c, 0x16, 0xd6, 0xaa, 0x43, 0x80, 0x94, 0xc5, 0xed, 0x8b, 0xed, 0x8b, 0x57, 0xde, 0xdc, 0x03, 0x00, 0x46, 0x0e, 0x00, 0x8c, 0xc7, 0x02, 0xfe, 0x53, 0x00, 0x8e,
+  0x0a, 0x00, 0x2e, 0x26, 0x42, 0xee, 0x2a, 0x6b, 0x12, 0xe2, 0x5e, 0x01, 0x5e, 0x5b, 0x10, 0x2b, 0x7e, 0xa5, 0x02, 0x6a, 0x14, 0x00, 0xd6, 0x22, 0x11, 0xac, 0xba, 0x29, 0x00, 0x7c, 0x5b, 0x11,
+  0x0f, 0xec, 0x65, 0x01, 0x4a, 0xec, 0x12, 0x33, 0x96, 0xd3, 0x11, 0x32, 0xd2, 0xfd, 0x02, 0xaa, 0xbe, 0x11, 0x6c, 0xa4, 0x3b, 0x01, 0x78, 0x34, 0x01, 0x12, 0xc9, 0x02, 0xbc, 0x77, 0x42, 0xb0,
+  0x43, 0x33, 0x5c, 0x02, 0xe9, 0x00, 0xd0, 0x5e, 0x00, 0xda, 0xf6, 0x00, 0x6e, 0x26, 0x02, 0xc6, 0x42, 0x11, 0x91, 0x2e, 0x38, 0x01, 0xa8, 0xa9, 0x01, 0xaa, 0x14, 0x00, 0xa4, 0x06, 0x11, 0xd1,
+  0x60, 0x23, 0x02, 0x7a, 0x54, 0x02, 0x00, 0x2b, 0x00, 0x28, 0x4a, 0x11, 0xf6, 0x28, 0x4a, 0x00, 0xd0, 0xb7, 0x02, 0xa2, 0x03, 0x00, 0xe8, 0x06, 0x00, 0xbe, 0x11, 0x00, 0xe6, 0x3b, 0x02, 0xc8,
+  0x46, 0x00, 0xb2, 0x00, 0x02, 0x62, 0xd4, 0x00, 0xd0, 0x03, 0x00, 0x0e, 0xe9, 0x00, 0x1a, 0x71, 0x02, 0x54, 0xd7, 0x00, 0xcc, 0x62, 0x40, 0xf5, 0x74, 0xb5, 0x6c, 0x32, 0x03, 0x00, 0x68, 0x31,
+  0x20, 0x95, 0x6c, 0xc6, 0x0a, 0x11, 0x75, 0x92, 0x03, 0x40, 0xd2, 0x4b, 0xf3, 0x53, 0x72, 0x11, 0x00, 0xe8, 0x14, 0x20, 0xb5, 0x6c, 0x8a, 0x0b, 0x00, 0x1c, 0x0e, 0x00, 0xa6, 0x0a, 0x02, 0x02,
+  0x35, 0x00, 0x34, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x62, 0x0e, 0x02, 0x3e, 0x15, 0x10, 0x33, 0x36, 0x00, 0x01, 0x18, 0x58, 0x00, 0x88, 0x3f, 0x00, 0x7a, 0x03, 0x00, 0xe0, 0x03, 0x01, 0xca, 0x5b,
+  0x00, 0xae, 0x4a, 0x10, 0x7d, 0x8c, 0x1f, 0x00, 0xc0, 0x03, 0x20, 0x34, 0x64, 0x2c, 0x15, 0x00, 0x74, 0x23, 0x00, 0x76, 0x00, 0x00, 0x0c, 0x00, 0x91, 0x37, 0x85, 0x75, 0x6c, 0xd2, 0x53, 0xf3,
+  0x5b, 0xb1, 0x18, 0x07, 0x00, 0x62, 0x0a, 0x40, 0xad, 0x32, 0xce, 0x32, 0xbc, 0x0a, 0x00, 0xc4, 0x0a, 0x02, 0x66, 0x1c, 0x20, 0x2f, 0x43, 0xc0, 0x18, 0x00, 0x98, 0x2a, 0x00, 0xb6, 0x11, 0x40,
+  0xa9, 0x11, 0x8c, 0x2a, 0x0e, 0x1c, 0x00, 0x8c, 0x58, 0x11, 0xb4, 0x5c, 0x03, 0x00, 0x46, 0x63, 0x40, 0x2f, 0x4b, 0x53, 0x6c, 0x32, 0x31, 0x00, 0x3e, 0x23, 0x11, 0x53, 0x7e, 0x1c, 0x11, 0x33,
+  0x8a, 0x4a, 0x11, 0xf2, 0x86, 0x0a, 0x00, 0xfa, 0x46, 0x33, 0x74, 0x74, 0xb4, 0xf0, 0x2d, 0x02, 0x98, 0xd4, 0x03, 0x94, 0xd4, 0x90, 0x5b, 0x2d, 0x4b, 0x10, 0x64, 0x6e, 0x53, 0x8f, 0x53, 0x10,
+  0x8a, 0x20, 0x93, 0x74, 0xae, 0x5f, 0x91, 0x15, 0x8d, 0x52, 0x74, 0x2e, 0x4b, 0x8b, 0x32, 0x0e, 0x84, 0x2a, 0x11, 0xd1, 0x70, 0x23, 0x02, 0x0a, 0xf8, 0x02, 0xb4, 0x86, 0x22, 0xd1, 0x63, 0x48,
+  0x91, 0x00, 0x8a, 0x11, 0x00, 0xe6, 0x1f, 0x20, 0x4f, 0x53, 0x6c, 0x0a, 0x30, 0x4f, 0x53, 0x12, 0x6e, 0x07, 0x01, 0x16, 0x83, 0x00, 0xbc, 0x8d, 0x20, 0x57, 0x95, 0x9c, 0x11, 0x02, 0x64, 0x63,
+  0x02, 0x0a, 0x00, 0x00, 0xd2, 0x03, 0x11, 0xd1, 0x4a, 0x8a, 0x20, 0x6f, 0x5b, 0xaa, 0x03, 0x00, 0xa4, 0x7f, 0x00, 0xf0, 0x11, 0x21, 0xb3, 0x84, 0x08, 0x00, 0x50, 0x74, 0xaf, 0x63, 0x4e, 0x5b,
+  0x54, 0x63, 0x11, 0x6e, 0xf0, 0x46, 0xf0, 0x01, 0xf0, 0x7b, 0x51, 0x84, 0xf4, 0x9c, 0x7a, 0xce, 0xb7, 0xb5, 0xd7, 0xb5, 0x18, 0xbe, 0xbb, 0xd6, 0x0a, 0x00, 0xf2, 0x01, 0x34, 0xa5, 0xf3, 0x9c,
+  0xb6, 0xb5, 0x31, 0x84, 0x55, 0xad, 0x0c, 0x5b, 0x93, 0x94, 0x92, 0x8c, 0x14, 0x07, 0x02, 0x48, 0x4a, 0x01, 0x6a, 0x51, 0x00, 0x6c, 0x51, 0x32, 0x8c, 0x72, 0x8c, 0x52, 0x35, 0x00, 0x9e, 0xaa,
+  0x13, 0x11, 0x04, 0x40, 0x02, 0x7e, 0x03, 0x07, 0x62, 0x43, 0x01, 0xb6, 0x03, 0x02, 0x98, 0x51, 0x10, 0x71, 0xc0, 0x11, 0x13, 0x9c, 0x0e, 0x2e, 0x16, 0xa4, 0x98, 0x03, 0x02, 0x28, 0x0e, 0x01,
+  0x34, 0x35, 0x14, 0xb4, 0xae, 0x0a, 0x06, 0x1a, 0x07, 0x04, 0xfc, 0x26, 0x00, 0xce, 0x18, 0x00, 0x7a, 0x03, 0x02, 0x20, 0x87, 0x02, 0x94, 0x03, 0x04, 0x14, 0x07, 0x02, 0x84, 0x23, 0x04, 0xae,
+  0x0a, 0x04, 0x94, 0x23, 0x20, 0xd5, 0xcd, 0x5c, 0x0e, 0x00, 0xa0, 0x0e, 0x00, 0x1c, 0x27, 0x00, 0x4a, 0x07, 0x20, 0x4f, 0x9c, 0x12, 0x40, 0x00, 0x56, 0x4e, 0x00, 0x6e, 0x15, 0x64, 0x78, 0xde,
+  0x12, 0xad, 0xf6, 0xcd, 0x22, 0xa2, 0x02, 0x64, 0xc5, 0x04, 0xc2, 0xcc, 0x12, 0xb0, 0xce, 0xe1, 0x21, 0x4b, 0x33, 0xa6, 0x11, 0x04, 0xa4, 0xe1, 0x00, 0xc6, 0x30, 0x00, 0xf2, 0x37, 0x01, 0x84,
+  0x3b, 0x00, 0xbc, 0x18, 0x30, 0x54, 0xd5, 0x6c, 0xd2, 0x81, 0x03, 0x38, 0x69, 0x21, 0x22, 0x0e, 0xbe, 0x70, 0x02, 0x6e, 0x34, 0x00, 0xcc, 0x0d, 0x00, 0xe2, 0x8c, 0x20, 0x17, 0x75, 0x08, 0x12,
+  0x02, 0x14, 0x7b, 0x00, 0x0e, 0x07, 0x01, 0xd4, 0x5e, 0x01, 0x5a, 0x62, 0x02, 0xc0, 0x50, 0x22, 0xd2, 0x4b, 0x7e, 0x03, 0x00, 0x20, 0x7b, 0x02, 0x44, 0x94, 0x11, 0x70, 0xea, 0x70, 0x13, 0xd2,
+  0x0e, 0xb4, 0x00, 0xac, 0x07, 0x00, 0x1e, 0x38, 0x04, 0x1e, 0x8d, 0x00, 0x62, 0x23, 0x04, 0xca, 0x1f, 0x01, 0x20, 0x38, 0x01, 0x90, 0x03, 0x00, 0x9e, 0x0a, 0x00, 0xa0, 0x0a, 0x00, 0xa2, 0x0e,
+  0x00, 0x22, 0x07, 0x02, 0x42, 0xb4, 0x01, 0x22, 0xdb, 0x60, 0x54, 0x8f, 0x43, 0xed, 0x32, 0xac, 0xe0, 0x7e, 0x00, 0x9c, 0x2a, 0x01, 0x4c, 0xe2, 0x13, 0xf1, 0xfc, 0x77, 0x00, 0xaa, 0x0a, 0x31,
+  0x54, 0x64, 0x34, 0x04, 0x35, 0x00, 0x02, 0x00, 0x20, 0xf3, 0x53, 0xfc, 0x70, 0x11, 0xb6, 0xe0, 0x14, 0x02, 0x0c, 0x4a, 0x02, 0x42, 0x03, 0x40, 0x95, 0x6c, 0x37, 0x7d, 0x3a, 0x63, 0x02, 0xb6,
+  0x03, 0x31, 0xd2, 0x4b, 0x54, 0x7c, 0x03, 0x00, 0xc6, 0x0a, 0x11, 0xf2, 0x66, 0x94, 0x00, 0xe4, 0x0d, 0x22, 0xad, 0x2a, 0x02, 0x00, 0x02, 0x14, 0x55, 0x10, 0x13, 0x66, 0x43, 0x00, 0xf4, 0x7b,
+  0x50, 0x53, 0xb1, 0x53, 0xb2, 0x53, 0x64, 0x23, 0x31, 0x8d, 0x2a, 0xae, 0x9a, 0x1c, 0x00, 0x7c, 0x1c, 0x40, 0xf3, 0x5b, 0xb2, 0x53, 0x02, 0x00, 0x00, 0x6e, 0x2a, 0x11, 0x95, 0xec, 0x26, 0x01,
+  0xec, 0x34, 0x21, 0x5b, 0x74, 0xac, 0x0a, 0x00, 0xf0, 0x34, 0x11, 0x95, 0x70, 0x11, 0x11, 0x94, 0x2e, 0x2e, 0x00, 0x0a, 0xaa, 0x01, 0x8e, 0x0a, 0x21, 0x7c, 0x74, 0x9e, 0x2a, 0x00, 0x6e, 0x4a,
+  0x00, 0xa8, 0x46, 0x80, 0x0a, 0x1a, 0xcd, 0x32, 0xcd, 0x3a, 0xcc, 0x3a, 0x74, 0x18, 0x01, 0x94, 0x26, 0x03, 0x52, 0x0e, 0x00, 0x1c, 0x15, 0x11, 0x4f, 0x2e, 0x5c, 0x00, 0x6c, 0x23, 0x00, 0xd4,
+  0x46, 0x30, 0xcd, 0x3a, 0x6f, 0x68, 0xfb, 0xf0, 0x10, 0x63, 0x2d, 0x4b, 0x4d, 0x4b, 0x2d, 0x4b, 0x0c, 0x43, 0xaf, 0x5b, 0xf0, 0x63, 0x4d, 0x53, 0xec, 0x42, 0x6e, 0x53, 0x0d, 0x4b, 0xcc, 0x3a,
+  0xab, 0x3a, 0x6a, 0x32, 0x6b, 0x32, 0x8b, 0x3a, 0x96, 0x0a, 0x00, 0x64, 0xbf, 0x01, 0xb2, 0x94, 0x00, 0x5c, 0x2a, 0x10, 0x63, 0x96, 0x03, 0x00, 0x52, 0x71, 0x00, 0x48, 0x63, 0x11, 0x6f, 0x5a,
+  0x63, 0x00, 0xce, 0x26, 0x01, 0x34, 0x5c, 0x01, 0xaa, 0x58, 0x00, 0x76, 0x0a, 0x42, 0x74, 0x7c, 0xb5, 0x84, 0xa4, 0x38, 0x20, 0xb4, 0x84, 0xa0, 0x0a, 0x60, 0x53, 0x74, 0x12, 0x74, 0xf5, 0x8c,
+  0x40, 0xaa, 0x00, 0x36, 0x27, 0x20, 0xd0, 0x6b, 0x28, 0x0e, 0x00, 0x2a, 0x00, 0x02, 0x74, 0xb1, 0x02, 0xe4, 0x8d, 0x40, 0x2d, 0x53, 0x2e, 0x53, 0x20, 0x20, 0x11, 0x6f, 0x0e, 0x4e, 0x20, 0x51,
+  0x7c, 0xb6, 0xdf, 0x00, 0xa2, 0xd8, 0xf0, 0x0d, 0xd3, 0x94, 0xaf, 0x73, 0x8e, 0x6b, 0xf4, 0x9c, 0x51, 0x8c, 0x96, 0xad, 0x7a, 0xce, 0x39, 0xc6, 0xf0, 0x7b, 0x10, 0x7c, 0x55, 0xad, 0x18, 0xc6,
+  0x59, 0xc6, 0xf8, 0xbd, 0xa6, 0xd1, 0x50, 0x75, 0xad, 0xd7, 0xbd, 0x92, 0xe4, 0x3f, 0x10, 0x94, 0x18, 0x4e, 0x00, 0xb8, 0x0a, 0x00, 0x24, 0xae, 0x02, 0x02, 0x00, 0x21, 0xf0, 0x7b, 0x88, 0x0a,
+  0x04, 0x50, 0xb5, 0x02, 0x56, 0x1c, 0x00, 0x82, 0x6a, 0x26, 0x94, 0x94, 0x40, 0x07, 0x03, 0xe0, 0x58, 0x00, 0x86, 0x4a, 0x00, 0x0a, 0x4e, 0x00, 0x12, 0x2e, 0x0a, 0x1e, 0x07, 0x19, 0xf1, 0x1e,
+  0x07, 0x13, 0xd1, 0x10, 0x27, 0x06, 0xa0, 0x0a, 0x00, 0x14, 0x2e, 0x04, 0x3e, 0x15, 0x04, 0xa0, 0xbc, 0x12, 0x74, 0x98, 0x03, 0x03, 0x72, 0x5c, 0x06, 0x18, 0x27, 0x12, 0x94, 0x04, 0xcb, 0x12,
+  0xcd, 0x08, 0x00, 0x00, 0x0a, 0x59, 0x00, 0x90, 0x1c, 0x71, 0x70, 0x9c, 0x74, 0xbd, 0xac, 0x83, 0xb4, 0xa0, 0x03, 0x80, 0x32, 0xb5, 0x36, 0xd6, 0x77, 0xde, 0xd5, 0xc5, 0xd4, 0xbc, 0x00, 0x48,
+  0x00, 0x00, 0x0e, 0x00, 0x02, 0x1e, 0x62, 0x00, 0x7a, 0x29, 0x00, 0x9e, 0x6c, 0x00, 0xfe, 0x7a, 0x12, 0xb0, 0xbc, 0x22, 0x03, 0xdc, 0x11, 0x00, 0x78, 0x22, 0x01, 0xe4, 0x6c, 0x01, 0xd0, 0x0d,
+  0x00, 0xb6, 0x9a, 0x03, 0xac, 0x0a, 0x00, 0x58, 0x3c, 0x00, 0x90, 0xa2, 0x21, 0x54, 0x93, 0x70, 0xd7, 0x91, 0xb4, 0x6c, 0xb4, 0x64, 0xd5, 0x6c, 0xf6, 0x6c, 0x53, 0x4a, 0x3f, 0x10, 0x94, 0x56,
+  0x82, 0x01, 0xb0, 0x06, 0x00, 0xb2, 0x31, 0x10, 0x6c, 0x84, 0xb4, 0x22, 0x33, 0xce, 0xaa, 0x3b, 0x01, 0x1e, 0x7b, 0x00, 0x54, 0x19, 0x10, 0xcd, 0xa4, 0x3c, 0x10, 0x32, 0x14, 0x15, 0x02, 0xb8,
+  0x1b, 0x04, 0x58, 0xad, 0x60, 0xf2, 0x53, 0x94, 0x64, 0x13, 0x54, 0x36, 0x7f, 0x00, 0x72, 0x19, 0x11, 0xcd, 0x12, 0x7f, 0x11, 0x2f, 0xf6, 0x22, 0x00, 0x10, 0x1d, 0x01, 0xa4, 0x46, 0x10, 0x1a,
+  0x18, 0x9f, 0x20, 0x8c, 0x1a, 0x0a, 0x00, 0x30, 0x2b, 0x12, 0x0f, 0xe0, 0x0a, 0x01, 0x80, 0x7b, 0x11, 0x91, 0x6e, 0x5f, 0x02, 0xc0, 0x70, 0x11, 0xb1, 0xb2, 0xa2, 0x00, 0x34, 0x94, 0xf2, 0x0b,
+  0x4e, 0x3b, 0x4e, 0x3b, 0x2d, 0x33, 0x0d, 0x33, 0x0d, 0x33, 0xcc, 0x2a, 0xac, 0x22, 0xac, 0x2a, 0xac, 0x22, 0xe9, 0x09, 0x0a, 0x12, 0x6c, 0x22, 0x8c, 0x22, 0x7a, 0xdb, 0x00, 0x04, 0x03, 0xa0,
+  0x71, 0x43, 0x71, 0x43, 0xf2, 0x53, 0x75, 0x64, 0x37, 0x7d, 0x4e, 0x0a, 0x62, 0x30, 0x3b, 0x8d, 0x2a, 0x70, 0x43, 0x82, 0x46, 0x00, 0x7c, 0x15, 0x00, 0x0e, 0x16, 0x40, 0x91, 0x4b, 0xb2, 0x4b,
+  0x60, 0x0e, 0x00, 0xe2, 0x0d, 0x00, 0x40, 0x07, 0x40, 0x34, 0x5c, 0xd2, 0x53, 0xe6, 0x0d, 0x00, 0x78, 0x5f, 0x20, 0x16, 0x7d, 0xca, 0x26, 0x11, 0x54, 0x20, 0x3c, 0x50, 0x37, 0x85, 0xb9, 0x8d,
+  0x17, 0xc8, 0x0a, 0x10, 0x5b, 0xca, 0x03, 0x10, 0xd6, 0x58, 0x16, 0x21, 0x7c, 0x75, 0x90, 0x07, 0x10, 0xb6, 0x88, 0x2a, 0x00, 0x5e, 0x00, 0x20, 0x43, 0x91, 0xfe, 0x11, 0x90, 0x4b, 0x91, 0x4b,
+  0xce, 0x3a, 0xad, 0x32, 0x0b, 0x1a, 0xd2, 0x38, 0x00, 0x98, 0x4a, 0x11, 0x50, 0x20, 0x2e, 0x02, 0xa6, 0x3f, 0x00, 0x1e, 0x15, 0x00, 0xd4, 0x26, 0x11, 0x90, 0x10, 0x83, 0x00, 0x7a, 0x2e, 0x20,
+  0x12, 0x64, 0xd8, 0x46, 0x01, 0x94, 0x00, 0x21, 0x74, 0xf1, 0xe0, 0x74, 0x00, 0x6c, 0x4a, 0x00, 0x30, 0x51, 0x00, 0xa0, 0x2d, 0x00, 0x14, 0x07, 0x11, 0x90, 0x7a, 0x51, 0x11, 0xf2, 0x4c, 0x51,
+  0x01, 0x1c, 0x55, 0x01, 0x76, 0x86, 0x00, 0x20, 0x0e, 0x11, 0xd4, 0x76, 0x38, 0x51, 0x10, 0x64, 0xcf, 0x63, 0x4d, 0x88, 0x11, 0xa0, 0x0c, 0x4b, 0x2c, 0x4b, 0x14, 0x85, 0xb2, 0x7c, 0x51, 0x74,
+  0xb4, 0x18, 0x11, 0x6e, 0xd2, 0x26, 0x02, 0xec, 0xf0, 0x20, 0x11, 0x6c, 0x1e, 0x0e, 0x20, 0xd0, 0x63, 0x7a, 0x11, 0x00, 0x14, 0xaa, 0x13, 0x52, 0x64, 0x51, 0x13, 0x94, 0xd8, 0x46, 0x02, 0x48,
+  0x5c, 0x80, 0xb1, 0x63, 0x32, 0x74, 0xb5, 0x84, 0x36, 0x95, 0xaa, 0x11, 0x11, 0x74, 0x06, 0x9c, 0x00, 0x8a, 0x03, 0x00, 0x2e, 0x07, 0x00, 0x6e, 0x03, 0x00, 0x0c, 0x00, 0x20, 0xb0, 0x63, 0x72,
+  0x78, 0x40, 0x6f, 0x5b, 0xb0, 0x63, 0x8a, 0x1c, 0x20, 0x53, 0x7c, 0xe2, 0x0a, 0x00, 0xe2, 0x03, 0x02, 0x0c, 0x00, 0x20, 0xf5, 0x8c, 0xac, 0x03, 0xf0, 0x0b, 0xd4, 0x8c, 0x31, 0x74, 0xf1, 0x6b,
+  0xf0, 0x6b, 0xf0, 0x73, 0x10, 0x74, 0x31, 0x7c, 0x55, 0xa5, 0x31, 0x7c, 0x72, 0x8c, 0x96, 0xad, 0x35, 0xa5, 0x51, 0x84, 0x82, 0x03, 0xf0, 0x0d, 0x18, 0xc6, 0xfc, 0xde, 0x59, 0xc6, 0x8e, 0x73,
+  0x2d, 0x6b, 0x2d, 0x63, 0xef, 0x7b, 0x10, 0x84, 0xf0, 0x7b, 0x30, 0x84, 0xcf, 0x7b, 0x10, 0x7c, 0xcf, 0x7b, 0xcf, 0x7b, 0x7c, 0x03, 0x42, 0x11, 0x84, 0xf0, 0x7b, 0xf6, 0x54, 0x00, 0xbc, 0x18,
+  0x15, 0x93, 0xbe, 0x11, 0x06, 0x02, 0x00, 0x05, 0x12, 0x00, 0x00, 0xa2, 0x03, 0x01, 0x22, 0x00, 0x02, 0x1e, 0x07, 0x00, 0x04, 0x00, 0x10, 0x73, 0x34, 0x35, 0x01, 0xdc, 0x3f, 0x04, 0xbe, 0x11,
+  0x08, 0xb2, 0x0a, 0x03, 0xac, 0x31, 0x03, 0x38, 0x0e, 0x02, 0x6a, 0x23, 0x02, 0x22, 0x0e, 0x26, 0x73, 0xbd, 0xe6, 0x1f, 0x02, 0x10, 0x07, 0x02, 0x40, 0x35, 0x11, 0x74, 0x40, 0xd9, 0x08, 0x88,
+  0x03, 0x05, 0x24, 0x07, 0x01, 0x7a, 0x03, 0x02, 0x20, 0x07, 0x00, 0x62, 0x1c, 0x00, 0x12, 0x07, 0x00, 0x3a, 0x0e, 0x00, 0xda, 0x11, 0x00, 0x32, 0x0e, 0x31, 0x94, 0xbd, 0x16, 0x3e, 0xb9, 0x00,
+  0xbc, 0xd5, 0x00, 0x86, 0x1c, 0x00, 0x1e, 0x07, 0x00, 0xbc, 0x18, 0x04, 0x2c, 0xe5, 0x00, 0x12, 0x27, 0x21, 0xed, 0x2a, 0x8c, 0x03, 0x03, 0x34, 0x18, 0x10, 0x90, 0xe4, 0x57, 0x01, 0x36, 0x38,
+  0x02, 0xb8, 0xcc, 0x01, 0x52, 0x89, 0x01, 0x66, 0x2e, 0x20, 0x12, 0x4c, 0x10, 0x27, 0x04, 0xb8, 0xda, 0x13, 0x4f, 0xf0, 0xba, 0x20, 0x2f, 0x33, 0xb0, 0x2d, 0x02, 0x94, 0x26, 0x00, 0xf6, 0x06,
+  0x11, 0xf3, 0xdc, 0x14, 0x04, 0x34, 0xb4, 0x02, 0x56, 0x46, 0x00, 0x84, 0x0d, 0x11, 0x78, 0xe4, 0x17, 0x02, 0x60, 0x18, 0x00, 0x50, 0x03, 0x00, 0xd4, 0x0d, 0x02, 0x44, 0x4d, 0x11, 0xad, 0x86,
+  0x26, 0x02, 0x86, 0xd4, 0x02, 0x54, 0x00, 0x01, 0xa8, 0x6d, 0x01, 0xa0, 0x00, 0x00, 0xb0, 0x18, 0x02, 0x98, 0x62, 0x02, 0x7a, 0x4d, 0x00, 0x90, 0x11, 0x02, 0x6a, 0x7b, 0x00, 0xca, 0x0e, 0x04,
+  0x44, 0xb4, 0x11, 0x4f, 0xec, 0x0e, 0x00, 0x8c, 0x3f, 0x00, 0x90, 0x03, 0x40, 0x6e, 0x3b, 0x0d, 0x33, 0xaa, 0x27, 0x00, 0x1e, 0x2e, 0x20, 0x8b, 0x22, 0xe0, 0x62, 0x00, 0xbc, 0x07, 0x00, 0x44,
+  0x94, 0x10, 0x74, 0x00, 0x19, 0x01, 0x48, 0x38, 0x00, 0xc6, 0x18, 0x11, 0x33, 0x90, 0x1f, 0x02, 0x28, 0x2a, 0x30, 0x95, 0x6c, 0x53, 0x08, 0x2b, 0x12, 0x7c, 0x20, 0x07, 0x11, 0xb5, 0x3e, 0x07,
+  0x02, 0x16, 0x07, 0xc0, 0xce, 0x2a, 0xad, 0x2a, 0xae, 0x2a, 0x50, 0x43, 0x13, 0x5c, 0xce, 0x32, 0x44, 0x15, 0x80, 0xad, 0x32, 0x4b, 0x22, 0x4b, 0x22, 0x4f, 0x43, 0xda, 0x18, 0x00, 0x74, 0x3f,
+  0x13, 0xad, 0x3a, 0x5c, 0x20, 0x4c, 0x22, 0xf0, 0x11, 0x20, 0x2f, 0x3b, 0x48, 0x07, 0x00, 0x32, 0x0e, 0x00, 0x18, 0x00, 0x00, 0x84, 0x15, 0x40, 0xb2, 0x53, 0x71, 0x4b, 0x0a, 0x07, 0x21, 0x34,
+  0x64, 0xda, 0x15, 0x20, 0x6c, 0x74, 0xb8, 0x46, 0x00, 0x3a, 0x0e, 0x30, 0x4b, 0xb5, 0x74, 0x22, 0x0e, 0x00, 0x7e, 0x38, 0x02, 0xe8, 0x58, 0x11, 0x94, 0xb8, 0x8d, 0x11, 0xd0, 0xea, 0x54, 0x60,
+  0x4f, 0x4b, 0x4e, 0x43, 0x90, 0x4b, 0xe2, 0x38, 0x00, 0x9c, 0x31, 0x02, 0xf6, 0x82, 0x02, 0x68, 0x0a, 0x50, 0xb3, 0x7c, 0x56, 0x8d, 0x35, 0xce, 0xa9, 0x12, 0x6c, 0x2a, 0x83, 0x11, 0x2e, 0xd4,
+  0x38, 0x00, 0x1c, 0xb1, 0x00, 0x26, 0x15, 0x11, 0x31, 0x7a, 0xa6, 0x00, 0xde, 0xe9, 0xf0, 0x0d, 0xcb, 0x42, 0x8a, 0x3a, 0xcb, 0x42, 0x2c, 0x4b, 0x8e, 0x5b, 0x8e, 0x5b, 0xaa, 0x3a, 0x08, 0x2a,
+  0xeb, 0x42, 0x4d, 0x53, 0x0c, 0x4b, 0xcf, 0x63, 0xaf, 0x5b, 0xaf, 0x5b, 0xfa, 0x1b, 0x60, 0x4e, 0x53, 0xed, 0x42, 0x8b, 0x3a, 0xa8, 0x11, 0xf0, 0x01, 0xac, 0x3a, 0x2a, 0x32, 0xac, 0x3a, 0xcc,
+  0x42, 0xcc, 0x42, 0x0e, 0x4b, 0x4f, 0x53, 0x2f, 0x53, 0x24, 0x0e, 0x00, 0xb2, 0x11, 0x02, 0x24, 0x5c, 0x00, 0x0c, 0x5c, 0x60, 0x74, 0x7c, 0xd1, 0x63, 0xb1, 0x63, 0x8e, 0x03, 0x42, 0xf6, 0x8c,
+  0x53, 0x74, 0x78, 0x6a, 0x11, 0xb4, 0x12, 0x4e, 0x01, 0xc4, 0x18, 0x70, 0x63, 0x32, 0x74, 0xd1, 0x6b, 0xd1, 0x6b, 0xdc, 0x18, 0x01, 0xb6, 0x58, 0x12, 0x74, 0xf4, 0x94, 0x50, 0x90, 0x63, 0xb0,
+  0x63, 0x11, 0xc8, 0x9f, 0x00, 0xa4, 0x0a, 0x10, 0x53, 0x68, 0xf8, 0x01, 0x18, 0x4e, 0x50, 0x84, 0x55, 0x9d, 0xd3, 0x8c, 0x08, 0x2e, 0x60, 0xf3, 0x94, 0xb2, 0x94, 0x76, 0xad, 0x90, 0x0a, 0xf0,
+  0x05, 0x14, 0x9d, 0x39, 0xc6, 0xd7, 0xbd, 0x5a, 0xce, 0x18, 0xc6, 0xd3, 0x9c, 0x75, 0xad, 0xcf, 0x7b, 0x51, 0x8c, 0xb3, 0x94, 0xe6, 0x18, 0x00, 0xf0, 0xe6, 0x02, 0x30, 0x0e, 0x00, 0x4c, 0x4a,
+  0x01, 0xa8, 0x7f, 0x05, 0x62, 0x15, 0x0a, 0x88, 0x03, 0x07, 0x10, 0x27, 0x27, 0x8c, 0x94, 0x20, 0x07, 0x02, 0xc0, 0x78, 0x52, 0x72, 0x94, 0xb2, 0x9c, 0x71, 0xb2, 0x58, 0x49, 0xa4, 0x8f, 0xa4,
+  0x90, 0x24, 0x07, 0x23, 0x8f, 0xa4, 0xf0, 0x1f, 0x04, 0xe0, 0x18, 0x16, 0xac, 0xa4, 0x0a, 0x02, 0x1a, 0x07, 0x15, 0x73, 0x20, 0x07, 0x04, 0xbe, 0x11, 0x01, 0x1a, 0x07, 0x04, 0x9a, 0x03, 0x12,
+  0xc5, 0xc8, 0x11, 0x60, 0xd5, 0xcd, 0x74, 0xc5, 0x33, 0xbd, 0xd6, 0x18, 0x00, 0xe8, 0x38, 0x02, 0xe0, 0xe3, 0x22, 0xb5, 0xc5, 0x0a, 0x40, 0x00, 0xd8, 0xa3, 0x02, 0x56, 0x15, 0x80, 0x78, 0xde,
+  0xf5, 0xcd, 0x98, 0xe6, 0x12, 0xad, 0xee, 0x8a, 0x71, 0x74, 0xbd, 0xf6, 0xcd, 0x4b, 0x12, 0xac, 0xba, 0x4d, 0x01, 0xf0, 0x18, 0x01, 0x12, 0x7b, 0x11, 0x32, 0xd0, 0x11, 0x00, 0xea, 0x1b, 0x00,
+  0xe6, 0xc8, 0x04, 0xb4, 0x0a, 0x00, 0x4c, 0x31, 0x11, 0xd1, 0x7e, 0x5b, 0x02, 0x32, 0xc2, 0x00, 0x0a, 0x00, 0x01, 0x4c, 0x23, 0x10, 0x43, 0x64, 0x0a, 0x03, 0x44, 0x89, 0x01, 0xa2, 0x22, 0x01,
+  0x08, 0x58, 0x10, 0x74, 0xc2, 0x10, 0x02, 0x28, 0x1f, 0x00, 0xee, 0x0d, 0x00, 0x1c, 0x0e, 0x00, 0x3e, 0x11, 0x11, 0xb2, 0x00, 0x07, 0x02, 0x32, 0x1c, 0x02, 0x66, 0x90, 0x02, 0x06, 0x12, 0x00,
+  0x8e, 0x2d, 0x02, 0xfe, 0x11, 0x00, 0x44, 0x2e, 0x00, 0xf8, 0x49, 0x00, 0x98, 0x18, 0x02, 0xd6, 0x26, 0x31, 0x37, 0x7d, 0x78, 0xc2, 0x1c, 0x11, 0xb5, 0x3a, 0x0e, 0x00, 0xa2, 0x0d, 0x00, 0x9c,
+  0x26, 0x02, 0x4a, 0x15, 0x01, 0x02, 0x0b, 0x01, 0x12, 0x04, 0x02, 0x92, 0xd7, 0x02, 0xd8, 0xec, 0x11, 0x4f, 0x50, 0x31, 0x02, 0xc2, 0x82, 0x02, 0xa2, 0x27, 0x11, 0x0d, 0xa8, 0x74, 0x00, 0xd8,
+  0x34, 0x00, 0xac, 0x19, 0x00, 0x10, 0x31, 0x02, 0xd2, 0x34, 0x02, 0x0e, 0x4a, 0x11, 0x70, 0x96, 0xd4, 0x02, 0xea, 0xa2, 0x00, 0xb6, 0x11, 0x00, 0xbe, 0x18, 0x20, 0x33, 0x5c, 0xa6, 0x34, 0x00,
+  0x02, 0x91, 0x00, 0x32, 0x78, 0x00, 0xd0, 0xc9, 0x22, 0x4f, 0x3b, 0x52, 0x3c, 0x22, 0x13, 0x5c, 0x84, 0xad, 0x00, 0x3e, 0x12, 0x00, 0x82, 0x38, 0x00, 0x18, 0x0e, 0x00, 0xc2, 0x2e, 0x00, 0xb8,
+  0x6d, 0x00, 0x00, 0x19, 0x00, 0x6c, 0x03, 0x00, 0xde, 0x0a, 0x20, 0x34, 0x64, 0x2a, 0x00, 0x00, 0xb4, 0x03, 0x02, 0x0c, 0x20, 0x02, 0x94, 0x23, 0x31, 0xb1, 0x4b, 0x75, 0x18, 0x20, 0x00, 0x08,
+  0x12, 0x00, 0xf0, 0x00, 0x02, 0x68, 0x43, 0x00, 0x3c, 0x5c, 0x20, 0xb5, 0x74, 0x96, 0x2a, 0x00, 0x34, 0x0e, 0x20, 0xd5, 0x7c, 0x66, 0x58, 0x00, 0x76, 0x31, 0x82, 0x8b, 0x2a, 0xac, 0x32, 0x0d,
+  0x3b, 0x93, 0x74, 0x66, 0xc6, 0x20, 0x11, 0x5c, 0xe6, 0xd0, 0x00, 0xee, 0x66, 0xf0, 0x3d, 0xcc, 0x3a, 0x6a, 0x2a, 0xc8, 0x19, 0x29, 0x22, 0x08, 0x1a, 0x29, 0x22, 0x0c, 0x43, 0xcb, 0x3a, 0xec,
+  0x42, 0xec, 0x3a, 0x0c, 0x43, 0x8e, 0x53, 0x2d, 0x4b, 0xcb, 0x3a, 0x8f, 0x53, 0xec, 0x42, 0x6a, 0x32, 0x8f, 0x5b, 0x31, 0x6c, 0x0d, 0x4b, 0x2d, 0x4b, 0x2d, 0x53, 0xef, 0x63, 0x2d, 0x4b, 0xcf,
+  0x63, 0xcf, 0x63, 0xae, 0x5b, 0x51, 0x74, 0x6d, 0x53, 0x4d, 0x53, 0xae, 0x5b, 0x6d, 0x5b, 0x30, 0x6c, 0xae, 0x5b, 0x10, 0x6c, 0xae, 0x5b, 0x8e, 0x5b, 0x0d, 0x4b, 0x2c, 0xb1, 0x80, 0x8b, 0x32,
+  0xcc, 0x42, 0xed, 0x42, 0x2e, 0x4b, 0xc0, 0x38, 0x02, 0x42, 0x2a, 0x20, 0xd1, 0x63, 0x08, 0x63, 0xc0, 0x0e, 0x4b, 0xad, 0x42, 0x2f, 0x53, 0x70, 0x5b, 0x32, 0x6c, 0x33, 0x74, 0x98, 0xc6, 0x00,
+  0x26, 0x07, 0x60, 0xf2, 0x6b, 0x2f, 0x53, 0x74, 0x74, 0xd4, 0x46, 0x31, 0x54, 0x74, 0x33, 0xe2, 0x6d, 0x11, 0x12, 0x0a, 0x6e, 0x02, 0x08, 0x4e, 0x60, 0x6f, 0x5b, 0xf2, 0x6b, 0x73, 0x7c, 0xc2,
+  0x0a, 0x00, 0x58, 0x91, 0x00, 0x9c, 0x03, 0x32, 0xd1, 0x6b, 0xb0, 0x88, 0x03, 0x22, 0x84, 0x73, 0x7a, 0x23, 0x12, 0x84, 0xee, 0xfb, 0xe2, 0x35, 0x95, 0x72, 0x84, 0x92, 0x84, 0x10, 0x7c, 0x8e,
+  0x6b, 0x2c, 0x5b, 0x8e, 0x6b, 0x2a, 0x15, 0x20, 0x72, 0x8c, 0x56, 0x15, 0xf2, 0x05, 0xd3, 0x9c, 0x93, 0x94, 0x51, 0x8c, 0x14, 0xa5, 0xf8, 0xbd, 0x5a, 0xce, 0x7a, 0xce, 0x9b, 0xd6, 0x55, 0xad,
+  0xcf, 0x73, 0xc2, 0x11, 0x11, 0x52, 0xc8, 0x11, 0x00, 0x9e, 0x11, 0x13, 0x32, 0x74, 0x1c, 0x01, 0x10, 0x20, 0x01, 0x9c, 0x03, 0x0e, 0x90, 0x03, 0x02, 0x8e, 0x03, 0x03, 0x0a, 0x00, 0x05, 0x68,
+  0x63, 0x01, 0xec, 0xb8, 0x05, 0xae, 0x91, 0x02, 0x62, 0x43, 0x08, 0x02, 0x00, 0x20, 0x11, 0xb5, 0x52, 0x0e, 0x00, 0xbc, 0x0a, 0x00, 0x54, 0x0e, 0x00, 0xe2, 0x7f, 0x00, 0x38, 0x15, 0x15, 0x32,
+  0xb4, 0x71, 0x02, 0x76, 0x03, 0x02, 0x9c, 0x0a, 0x00, 0xcc, 0x38, 0x00, 0x8c, 0x0a, 0x10, 0x33, 0xa8, 0x6a, 0x18, 0xbd, 0x14, 0x07, 0x00, 0x3c, 0x2e, 0x00, 0x60, 0x03, 0x00, 0x58, 0x15, 0x40,
+  0xb0, 0xa4, 0x16, 0xd6, 0x8a, 0x03, 0x00, 0x94, 0xee, 0x00, 0x20, 0x00, 0xf5, 0x0e, 0xb4, 0xc5, 0x33, 0xb5, 0xf1, 0xac, 0xf5, 0xcd, 0x94, 0xc5, 0x36, 0xd6, 0x53, 0xb5, 0x36, 0xd6, 0x57, 0xde,
+  0x12, 0xb5, 0x16, 0xd6, 0xb8, 0xe6, 0x16, 0xce, 0x57, 0xde, 0xb1, 0xc8, 0xe5, 0x00, 0x3c, 0x34, 0x20, 0xce, 0x2a, 0xc6, 0x22, 0x00, 0xc8, 0x18, 0x22, 0xb1, 0x4b, 0xba, 0xd3, 0x11, 0xd2, 0xce,
+  0x42, 0x01, 0xc4, 0x10, 0x01, 0xde, 0x06, 0x22, 0xf2, 0x4b, 0xf2, 0x25, 0x01, 0x98, 0x1f, 0x01, 0x1e, 0x26, 0x11, 0xb2, 0x82, 0xb0, 0x02, 0x6e, 0x02, 0x11, 0x54, 0xd2, 0x5e, 0x02, 0xd6, 0x1f,
+  0x02, 0x86, 0x26, 0x02, 0x56, 0xdb, 0x00, 0xe6, 0x23, 0x00, 0x8c, 0x14, 0x00, 0xbe, 0x23, 0x00, 0x4c, 0x00, 0x00, 0xae, 0x42, 0x02, 0x7a, 0x15, 0x10, 0xf6, 0xd2, 0x85, 0x01, 0x6e, 0x20, 0x02,
+  0xc6, 0x23, 0x00, 0xda, 0x26, 0x01, 0xb6, 0x0d, 0x02, 0x1a, 0x23, 0x01, 0x8a, 0x1c, 0x11, 0xb1, 0xec, 0x1f, 0x00, 0x6a, 0x0e, 0x02, 0x18, 0x00, 0x22, 0x33, 0x5c, 0x24, 0x07, 0x80, 0x54, 0x64,
+  0x57, 0x85, 0x57, 0x85, 0x16, 0x75, 0x7a, 0x00, 0x00, 0xca, 0x0e, 0x60, 0x93, 0x64, 0xd5, 0x6c, 0x93, 0x64, 0x3a, 0xe9, 0x11, 0xf5, 0xf2, 0x62, 0x02, 0x62, 0x8d, 0x00, 0xcc, 0x15, 0x11, 0xb4,
+  0x16, 0x91, 0x02, 0x64, 0xd4, 0x00, 0xa0, 0x3f, 0x00, 0x6e, 0x2d, 0x11, 0x74, 0x02, 0x07, 0x01, 0xfe, 0x1c, 0x03, 0xa4, 0x7b, 0x22, 0x53, 0x5c, 0x2c, 0x04, 0x00, 0x5c, 0x38, 0x00, 0x02, 0x23,
+  0x00, 0x7e, 0x66, 0x04, 0x1e, 0x16, 0x01, 0x3c, 0x5c, 0x01, 0x5c, 0x15, 0x20, 0x37, 0x7d, 0x92, 0x4a, 0x22, 0x78, 0x85, 0xda, 0x20, 0x20, 0xb1, 0x4b, 0xec, 0x3f, 0x02, 0x8e, 0x1c, 0x11, 0xb1,
+  0x8c, 0x03, 0x11, 0xd2, 0x5c, 0x20, 0x00, 0xfc, 0x06, 0x40, 0x75, 0x6c, 0x13, 0x5c, 0xd2, 0x31, 0x00, 0x32, 0x3c, 0x22, 0x12, 0x54, 0xcc, 0x11, 0x20, 0x95, 0x6c, 0xec, 0x0a, 0x01, 0xc4, 0x4a,
+  0x10, 0x43, 0xc6, 0x51, 0x40, 0xac, 0x2a, 0x90, 0x4b, 0xc6, 0x38, 0x40, 0x32, 0x5c, 0x70, 0x4b, 0xb0, 0x1f, 0x00, 0x20, 0x2e, 0x00, 0xda, 0xbb, 0x00, 0xc2, 0x2d, 0x11, 0x8f, 0x50, 0xfb, 0x80,
+  0x8a, 0x2a, 0x2d, 0x43, 0x6a, 0x2a, 0x6e, 0x4b, 0xd8, 0x5b, 0xf0, 0x01, 0x6e, 0x4b, 0x0c, 0x43, 0x29, 0x22, 0x8a, 0x32, 0x8b, 0x32, 0xcb, 0x3a, 0x8a, 0x32, 0x0c, 0x43, 0x02, 0x00, 0x81, 0xaa,
+  0x32, 0xcf, 0x5b, 0x2c, 0x4b, 0x6d, 0x4b, 0x06, 0x00, 0x50, 0x53, 0xaf, 0x5b, 0x51, 0x74, 0x40, 0xe6, 0xf0, 0x05, 0xb3, 0x7c, 0x51, 0x74, 0x92, 0x7c, 0xf4, 0x84, 0xf0, 0x6b, 0xae, 0x5b, 0x92,
+  0x7c, 0x10, 0x6c, 0x8a, 0x3a, 0x4d, 0x53, 0x10, 0x07, 0xe0, 0xcb, 0x42, 0xeb, 0x4a, 0x49, 0x32, 0xaa, 0x3a, 0x6e, 0x5b, 0x4d, 0x53, 0x6e, 0x5b, 0xaa, 0x0a, 0x42, 0x2e, 0x4b, 0xf1, 0x63, 0xec,
+  0x3b, 0x00, 0x78, 0x23, 0x00, 0xd8, 0x1f, 0x02, 0x38, 0x0e, 0x11, 0x32, 0xd8, 0x4d, 0x80, 0x33, 0x74, 0x74, 0x7c, 0xf2, 0x6b, 0xf2, 0x6b, 0x48, 0x27, 0x40, 0xcd, 0x42, 0x8c, 0x3a, 0xc0, 0x11,
+  0xa0, 0x33, 0x74, 0xf2, 0x6b, 0x91, 0x5b, 0x33, 0x6c, 0x53, 0x74, 0x6c, 0x4a, 0x00, 0x20, 0x00, 0x40, 0x12, 0x6c, 0xf2, 0x6b, 0x28, 0x0e, 0x30, 0x33, 0x74, 0xb4, 0xe8, 0x51, 0x10, 0x7c, 0xae,
+  0x03, 0x10, 0x32, 0xee, 0x46, 0x10, 0x74, 0x1c, 0x27, 0x20, 0xd5, 0x8c, 0x54, 0x63, 0x00, 0x22, 0x07, 0x60, 0xd0, 0x6b, 0xb0, 0x63, 0x31, 0x74, 0x02, 0x00, 0x00, 0x20, 0x35, 0xf0, 0x01, 0x10,
+  0x74, 0xaf, 0x6b, 0x30, 0x7c, 0x75, 0xa5, 0x34, 0x9d, 0x75, 0xa5, 0xb6, 0xb5, 0xf4, 0x9c, 0x66, 0x1c, 0x60, 0xb7, 0xb5, 0x76, 0xad, 0x97, 0xb5, 0xa4, 0x9f, 0x00, 0xd2, 0x2d, 0x81, 0x5a, 0xce,
+  0xd8, 0xbd, 0x76, 0xad, 0x56, 0xa5, 0x8c, 0x03, 0x34, 0x8c, 0x31, 0x84, 0x66, 0x51, 0x24, 0x72, 0x8c, 0xec, 0x1f, 0x0c, 0xaa, 0x0a, 0x09, 0x1e, 0x07, 0x05, 0x9e, 0x2a, 0x02, 0xfa, 0x46, 0x04,
+  0xe0, 0x3f, 0x04, 0x1a, 0x8e, 0x34, 0x91, 0xa4, 0x90, 0xc6, 0x11, 0x03, 0xa8, 0x51, 0x02, 0x9c, 0x2a, 0x02, 0xb6, 0x31, 0x18, 0xd1, 0x26, 0x6e, 0x03, 0xa6, 0x51, 0x00, 0x84, 0x03, 0x15, 0x32,
+  0xdc, 0xca, 0x11, 0x53, 0x84, 0x03, 0x11, 0x12, 0xc4, 0xdc, 0x00, 0xbe, 0x11, 0x11, 0x73, 0xae, 0x6a, 0x02, 0xf6, 0x3f, 0x02, 0xda, 0x0a, 0x00, 0x1c, 0x07, 0x00, 0x86, 0x03, 0x11, 0xb4, 0xc2,
+  0x0a, 0x11, 0xb4, 0x38, 0x47, 0x11, 0xb5, 0x5a, 0x15, 0x40, 0x57, 0xde, 0x98, 0xe6, 0x6e, 0x00, 0x02, 0xe2, 0x11, 0xc0, 0x57, 0xde, 0xb8, 0xe6, 0xf6, 0xcd, 0xf5, 0xcd, 0x77, 0xde, 0x4f, 0x33,
+  0x84, 0x43, 0x01, 0x4c, 0x82, 0x01, 0xf6, 0xba, 0x02, 0x84, 0x0d, 0x24, 0x33, 0x54, 0x4a, 0x4d, 0x10, 0x54, 0x84, 0x63, 0x02, 0x9a, 0x38, 0x01, 0x2c, 0x23, 0x11, 0x74, 0xf4, 0x57, 0x02, 0x18,
+  0x03, 0x12, 0x34, 0x3a, 0x2a, 0x01, 0x0c, 0x00, 0x00, 0x06, 0x00, 0x11, 0x33, 0x3c, 0x0e, 0x02, 0x1e, 0x46, 0x80, 0x17, 0x75, 0x37, 0x7d, 0x58, 0x7d, 0x74, 0x64, 0x3a, 0x03, 0x06, 0x68, 0x23,
+  0x42, 0xb6, 0x6c, 0x33, 0x5c, 0x2a, 0x00, 0x00, 0x1a, 0x03, 0x12, 0xd5, 0xe8, 0x02, 0x03, 0xc4, 0x1f, 0x81, 0xf6, 0x74, 0xda, 0x8d, 0xb9, 0x8d, 0x37, 0x7d, 0xe0, 0xd7, 0x03, 0xac, 0x70, 0x00,
+  0x48, 0x0e, 0x00, 0x0c, 0xbf, 0x11, 0xd6, 0x8e, 0x94, 0x02, 0x62, 0x1c, 0x00, 0xde, 0x26, 0x00, 0xd8, 0x90, 0x00, 0xd8, 0x69, 0x00, 0xd2, 0x02, 0x40, 0xcd, 0x2a, 0x0e, 0x3b, 0x1a, 0xad, 0x51,
+  0x6b, 0x22, 0xac, 0x22, 0xed, 0x9a, 0xd7, 0x00, 0x2a, 0x7f, 0x00, 0xcc, 0x06, 0x02, 0x80, 0x94, 0x11, 0x2f, 0x78, 0xdb, 0x00, 0xee, 0x31, 0x12, 0x13, 0x96, 0x46, 0x02, 0x70, 0x94, 0x01, 0xa4,
+  0xa2, 0x00, 0x52, 0x23, 0x00, 0x20, 0x71, 0x00, 0xe6, 0x07, 0x00, 0x52, 0x0a, 0x20, 0x0e, 0x33, 0xa8, 0x03, 0x00, 0x5e, 0x38, 0x04, 0xd0, 0x2d, 0x00, 0x8a, 0x00, 0x00, 0x98, 0x23, 0x02, 0x64,
+  0x43, 0x00, 0x86, 0x1c, 0x80, 0x0b, 0x12, 0x4c, 0x22, 0x4c, 0x1a, 0xca, 0x09, 0xa2, 0x23, 0x11, 0xb1, 0x28, 0x55, 0x00, 0xac, 0x03, 0x00, 0x54, 0x15, 0x02, 0xa8, 0x23, 0x00, 0x5e, 0x27, 0x11,
+  0xd6, 0xf0, 0xa9, 0x13, 0x54, 0x64, 0x4a, 0x20, 0x13, 0x5c, 0xca, 0x0a, 0x00, 0xac, 0x31, 0x20, 0xd2, 0x53, 0xc2, 0x0a, 0x10, 0x0f, 0x34, 0x0f, 0x03, 0x98, 0x9f, 0x00, 0xc6, 0x07, 0x00, 0xcc,
+  0x1f, 0x60, 0x6c, 0x2a, 0xad, 0x2a, 0x8c, 0x2a, 0x18, 0x55, 0x31, 0xd1, 0x5b, 0x94, 0x00, 0x6e, 0x02, 0x92, 0xb4, 0xf0, 0x02, 0xaf, 0x53, 0x14, 0x7d, 0x76, 0x8d, 0x93, 0x74, 0x6e, 0x4b, 0xf1,
+  0x5b, 0x2d, 0x43, 0x4e, 0x4b, 0xaf, 0x9a, 0x11, 0xa0, 0x5b, 0xcf, 0x5b, 0xaf, 0x53, 0x6e, 0x4b, 0x2d, 0x43, 0x6d, 0x10, 0x0e, 0xf0, 0x00, 0x43, 0x4d, 0x4b, 0xcf, 0x5b, 0x8e, 0x53, 0xaa, 0x32,
+  0xcb, 0x3a, 0x51, 0x6c, 0xaf, 0x5b, 0xb2, 0x11, 0xf2, 0x0d, 0xcb, 0x42, 0x92, 0x7c, 0x55, 0x95, 0x29, 0x2a, 0xaf, 0x5b, 0x31, 0x74, 0x8e, 0x5b, 0xeb, 0x42, 0x72, 0x7c, 0x31, 0x74, 0xab, 0x42,
+  0x2d, 0x53, 0x4d, 0x53, 0x10, 0x6c, 0xf2, 0xf0, 0x23, 0xf0, 0x6b, 0x08, 0x00, 0x12, 0x63, 0xde, 0x7b, 0x00, 0xa0, 0x2a, 0x00, 0x5a, 0x15, 0x02, 0xe0, 0x3f, 0xa0, 0x90, 0x5b, 0x2e, 0x53, 0x2e,
+  0x53, 0x0e, 0x4b, 0x70, 0x5b, 0x40, 0x23, 0x11, 0xb0, 0x6a, 0x63, 0x00, 0x88, 0x03, 0x64, 0xb5, 0x84, 0xf5, 0x8c, 0xf2, 0x6b, 0x84, 0x51, 0x00, 0x28, 0x00, 0x00, 0xaa, 0x03, 0x00, 0xf0, 0x18,
+  0x11, 0x33, 0x4a, 0x15, 0x00, 0xa6, 0x0a, 0x20, 0x90, 0x5b, 0x10, 0x07, 0x02, 0x74, 0x98, 0x11, 0xb4, 0x52, 0x63, 0x01, 0x36, 0x0e, 0x01, 0xf2, 0x94, 0x00, 0xb6, 0x58, 0x40, 0x31, 0x7c, 0x10,
+  0x74, 0xe8, 0xed, 0x00, 0xf6, 0x1f, 0x31, 0x8e, 0x6b, 0x71, 0x72, 0xf1, 0x51, 0xb2, 0x94, 0x92, 0x8c, 0x55, 0x2c, 0x55, 0xe0, 0x18, 0xbe, 0x9a, 0xd6, 0xd7, 0xbd, 0x9b, 0xd6, 0xbb, 0xd6, 0x39,
+  0xc6, 0x35, 0xa5, 0x6a, 0x63, 0x41, 0x39, 0xc6, 0xb7, 0xb5, 0xc6, 0x11, 0x01, 0x88, 0x03, 0x00, 0xc8, 0x11, 0x06, 0x10, 0x07, 0x02, 0x14, 0x00, 0x08, 0x90, 0x2a, 0x06, 0xfc, 0x18, 0x04, 0x7a,
+  0x4a, 0x17, 0xb4, 0x02, 0x00, 0x04, 0x82, 0x6a, 0x13, 0x92, 0xde, 0x3f, 0x13, 0xb0, 0x92, 0x03, 0x04, 0x44, 0x0e, 0x00, 0x06, 0x00, 0x00, 0x08, 0x35, 0x02, 0xfa, 0x26, 0x44, 0x53, 0xbd, 0xf1,
+  0xac, 0xdc, 0x98, 0x13, 0x73, 0x02, 0x00, 0x02, 0x0a, 0x00, 0x02, 0x5c, 0x3c, 0x00, 0x1a, 0x4e, 0x00, 0x32, 0x87, 0x31, 0x94, 0xc5, 0x94, 0x18, 0x00, 0x00, 0x26, 0x4e, 0x00, 0xe0, 0x1f, 0x02,
+  0x6e, 0x15, 0x00, 0x7a, 0x03, 0x00, 0x22, 0x47, 0x00, 0x08, 0x20, 0x20, 0xf6, 0xcd, 0xd0, 0x11, 0x00, 0x12, 0x07, 0x00, 0x36, 0x2e, 0x20, 0x16, 0xd6, 0xce, 0x03, 0x40, 0xd1, 0xac, 0x57, 0xde,
+  0x5a, 0x87, 0x00, 0xb6, 0x0a, 0x60, 0x98, 0xde, 0x36, 0xd6, 0x16, 0xce, 0xe8, 0x31, 0x01, 0xe6, 0xda, 0x01, 0x5a, 0x35, 0x02, 0x78, 0x4a, 0x11, 0x12, 0x32, 0xb7, 0x11, 0x53, 0xb2, 0x06, 0x00,
+  0x26, 0x31, 0x00, 0x56, 0xa9, 0x00, 0xa4, 0x1c, 0x20, 0x37, 0x75, 0xb0, 0x2d, 0x01, 0xbc, 0x2a, 0x01, 0x3a, 0xb0, 0x02, 0x3c, 0x15, 0x00, 0x58, 0x54, 0x02, 0x76, 0x3b, 0x02, 0x5c, 0x26, 0x10,
+  0x90, 0x2a, 0x0a, 0x12, 0x3b, 0x70, 0x97, 0x00, 0x5e, 0x7b, 0x00, 0xde, 0x18, 0x02, 0xc8, 0x2d, 0x00, 0xd4, 0x50, 0x02, 0xce, 0x03, 0x20, 0xf2, 0x53, 0x2e, 0x23, 0x32, 0xb1, 0x4b, 0x91, 0xc4,
+  0xcc, 0x01, 0x76, 0x35, 0x00, 0xe8, 0x18, 0x02, 0x5e, 0x15, 0x00, 0x0c, 0x31, 0x00, 0x80, 0x0d, 0x11, 0xad, 0x8e, 0x14, 0x02, 0x68, 0x07, 0x00, 0x9c, 0x0a, 0x02, 0x22, 0x2a, 0x00, 0x04, 0x00,
+  0x00, 0xcc, 0x15, 0x02, 0xb8, 0x31, 0x02, 0x6c, 0x0a, 0x01, 0x8e, 0x43, 0x12, 0x53, 0xb2, 0x0a, 0x00, 0x5a, 0xf0, 0x02, 0xa4, 0xec, 0x03, 0x76, 0xe2, 0x12, 0x53, 0x7a, 0x94, 0x00, 0x70, 0x03,
+  0x00, 0xe0, 0x11, 0x02, 0x6e, 0x8d, 0x11, 0x90, 0xbc, 0x23, 0x02, 0x4a, 0xed, 0x02, 0xda, 0x06, 0x00, 0x74, 0x03, 0x02, 0x60, 0x86, 0x02, 0x54, 0x20, 0x00, 0x5e, 0x03, 0x00, 0xb6, 0x2d, 0x20,
+  0x58, 0x85, 0xca, 0x06, 0x11, 0x13, 0xcc, 0x1f, 0x02, 0x6a, 0x58, 0x00, 0x1c, 0x00, 0x11, 0x54, 0x38, 0x3c, 0x02, 0x62, 0x2e, 0x11, 0xb5, 0xba, 0x23, 0x01, 0xfc, 0x20, 0x21, 0x6c, 0x74, 0x7e,
+  0x43, 0x12, 0x94, 0xd6, 0x4d, 0x22, 0x43, 0xd1, 0x7c, 0x15, 0x00, 0xfa, 0x38, 0x50, 0x53, 0xee, 0x32, 0x91, 0x4b, 0x02, 0x00, 0x01, 0xb6, 0x38, 0x11, 0x4b, 0x78, 0x15, 0x10, 0x4b, 0x72, 0x00,
+  0x03, 0x18, 0x4e, 0x01, 0xbe, 0x03, 0x11, 0xf1, 0x76, 0x00, 0x00, 0xec, 0x46, 0x00, 0xfc, 0x54, 0x00, 0x2e, 0x3c, 0x51, 0xac, 0x32, 0xec, 0x3a, 0xf0, 0xcc, 0xf0, 0x91, 0x93, 0x6c, 0x6e, 0x4b,
+  0x4e, 0x43, 0x2d, 0x43, 0x8f, 0xb0, 0x54, 0x00, 0x8a, 0x03, 0x20, 0x2d, 0x43, 0x06, 0x00, 0x60, 0x8e, 0x53, 0xaf, 0x53, 0x8e, 0x53, 0x3c, 0x23, 0xe0, 0xab, 0x3a, 0x4d, 0x4b, 0x51, 0x74, 0xaf,
+  0x5b, 0x6d, 0x53, 0xcf, 0x5b, 0x92, 0x74, 0x3e, 0x86, 0x11, 0x2c, 0x10, 0x00, 0x00, 0xaa, 0x0a, 0x11, 0x51, 0x1c, 0x2a, 0x40, 0xaf, 0x63, 0x2d, 0x53, 0xae, 0x18, 0x60, 0x6e, 0x53, 0x6e, 0x53,
+  0x6e, 0x5b, 0x1a, 0x03, 0x11, 0x8f, 0x88, 0x03, 0x00, 0x72, 0x4a, 0x11, 0x8f, 0x36, 0xff, 0x00, 0xb4, 0x3f, 0x02, 0xf8, 0x46, 0x51, 0x16, 0x8d, 0xf5, 0x8c, 0xb5, 0x10, 0x0e, 0x21, 0x94, 0x7c,
+  0xca, 0x58, 0x01, 0x2a, 0x07, 0x00, 0x12, 0x00, 0x00, 0x04, 0x07, 0x02, 0x64, 0x71, 0x30, 0xf2, 0x6b, 0x94, 0x96, 0x3c, 0x10, 0x6b, 0xfc, 0x4d, 0x02, 0x96, 0x03, 0x00, 0x7c, 0x03, 0x03, 0x04,
+  0x9c, 0x10, 0x7c, 0xfc, 0x1f, 0x00, 0x3a, 0x0e, 0x00, 0x7a, 0x98, 0x00, 0x3e, 0x0e, 0x02, 0x90, 0x03, 0x01, 0x28, 0x3c, 0x10, 0x74, 0x28, 0x2e, 0x31, 0x51, 0x7c, 0x72, 0x86, 0xff, 0x00, 0x4e,
+  0x1c, 0x40, 0x92, 0x8c, 0x75, 0xad, 0x30, 0x0e, 0x02, 0xe4, 0x18, 0x40, 0xd7, 0xb5, 0x35, 0xa5, 0x2c, 0x6a, 0x42, 0x7a, 0xce, 0x59, 0xce, 0x64, 0x2a, 0x00, 0xc6, 0xa6, 0x12, 0x31, 0x8e, 0x23,
+  0x03, 0x90, 0x03, 0x0e, 0x9e, 0x0a, 0x11, 0x94, 0x01, 0x00, 0x03, 0x90, 0x03, 0x00, 0x0e, 0x20, 0x05, 0xb8, 0x31, 0x13, 0xb3, 0x8a, 0x03, 0x02, 0xb0, 0x03, 0x09, 0x36, 0x95, 0x03, 0xae, 0x0a,
+  0x04, 0x3a, 0x0e, 0x04, 0xd8, 0x18, 0x02, 0x18, 0x2e, 0x02, 0xa4, 0x38, 0x06, 0x5e, 0xb5, 0x06, 0x94, 0x2a, 0x11, 0x53, 0x88, 0x23, 0x00, 0x4a, 0x07, 0x11, 0xb5, 0x58, 0x95, 0x13, 0x74, 0x8a,
+  0x03, 0x13, 0xb4, 0xb4, 0x51, 0x00, 0x46, 0x15, 0x00, 0x8a, 0x03, 0x00, 0x94, 0x03, 0x00, 0x96, 0x2a, 0x00, 0x88, 0x03, 0x00, 0x60, 0x1c, 0x00, 0x98, 0x03, 0x02, 0xde, 0x11, 0x00, 0xd8, 0x11,
+  0x41, 0x36, 0xd6, 0xf2, 0xac, 0xa6, 0x0a, 0x21, 0xd6, 0x57, 0x8c, 0x03, 0x00, 0x3e, 0xd2, 0x31, 0x98, 0xe6, 0x74, 0xda, 0xba, 0x02, 0xb6, 0x02, 0x11, 0xb1, 0xda, 0x30, 0x11, 0x13, 0x46, 0xa2,
+  0x00, 0xb6, 0x14, 0x00, 0xfe, 0x06, 0x00, 0x48, 0x18, 0x11, 0x95, 0x5e, 0xb0, 0x00, 0xdc, 0x3b, 0x00, 0x96, 0x49, 0x04, 0xe4, 0x1b, 0x00, 0x80, 0x1c, 0x02, 0x1e, 0x74, 0x02, 0xb2, 0x37, 0x01,
+  0xfa, 0xb3, 0x12, 0x3b, 0xda, 0x11, 0x11, 0x70, 0x04, 0x12, 0x00, 0x08, 0x00, 0x02, 0x66, 0x47, 0x00, 0x6c, 0x0d, 0x22, 0x95, 0x64, 0x44, 0x15, 0x02, 0x90, 0x97, 0x13, 0xd6, 0x50, 0x07, 0x13,
+  0x33, 0x06, 0xed, 0x01, 0xd0, 0x89, 0x01, 0x1c, 0x00, 0x00, 0xb2, 0x29, 0x00, 0x44, 0x58, 0x00, 0x68, 0x07, 0x02, 0xb6, 0x11, 0x02, 0x8a, 0x38, 0x11, 0x2f, 0x5e, 0x3f, 0x40, 0x0a, 0x12, 0xcd,
+  0x2a, 0x2a, 0x00, 0x11, 0x91, 0x5e, 0x00, 0x02, 0x38, 0x20, 0x00, 0x6e, 0xfe, 0x20, 0xcc, 0x2a, 0xba, 0x3f, 0x20, 0xcd, 0x2a, 0x46, 0x15, 0x00, 0x22, 0x07, 0x00, 0x7a, 0x00, 0x00, 0xa4, 0x0d,
+  0x02, 0x4e, 0x00, 0x11, 0x54, 0x66, 0x2a, 0x02, 0x4e, 0xd4, 0x11, 0x37, 0x4a, 0x2b, 0x00, 0xa4, 0x19, 0x02, 0xd4, 0x5b, 0x01, 0x00, 0x75, 0x10, 0x4b, 0x52, 0x00, 0x01, 0xd8, 0x0d, 0x12, 0x5b,
+  0x96, 0x66, 0x01, 0x08, 0x23, 0x00, 0x42, 0x43, 0x01, 0x0e, 0x91, 0x00, 0x36, 0x00, 0x11, 0x94, 0xca, 0x1c, 0x00, 0xfc, 0x6d, 0x00, 0x30, 0x12, 0x00, 0xd6, 0x34, 0x20, 0xee, 0x3a, 0xaa, 0x0e,
+  0x40, 0xa9, 0x09, 0xea, 0x11, 0x80, 0x6d, 0x00, 0x78, 0x4a, 0x00, 0x90, 0x3f, 0x40, 0x2a, 0x1a, 0xac, 0x2a, 0x00, 0xf1, 0x42, 0x2e, 0x43, 0x0e, 0x3b, 0x70, 0x6a, 0x00, 0x6e, 0x07, 0x60, 0x16,
+  0x7d, 0x16, 0x7d, 0xf2, 0x5b, 0xda, 0x03, 0x02, 0x32, 0x63, 0x00, 0xb8, 0x03, 0x02, 0x9e, 0xa6, 0x00, 0xae, 0x38, 0x40, 0x4b, 0x22, 0xee, 0x32, 0x44, 0x00, 0x00, 0xa4, 0x6d, 0x20, 0x12, 0x5c,
+  0x74, 0x9f, 0x40, 0x4e, 0x43, 0x0d, 0x43, 0x12, 0x8a, 0x51, 0x2d, 0x43, 0x4e, 0x43, 0xcc, 0x86, 0x86, 0x20, 0x0d, 0x43, 0x02, 0x00, 0xf0, 0x01, 0x2d, 0x43, 0x8b, 0x32, 0xcc, 0x3a, 0x2d, 0x4b,
+  0x2d, 0x43, 0xec, 0x3a, 0x6e, 0x53, 0x2d, 0x43, 0x9e, 0x9b, 0x00, 0x02, 0x0e, 0x40, 0x8e, 0x53, 0x93, 0x7c, 0x64, 0x2a, 0x20, 0xcf, 0x5b, 0x44, 0x86, 0xa2, 0x0c, 0x4b, 0x6e, 0x53, 0xae, 0x5b,
+  0x6e, 0x53, 0x4d, 0x53, 0x1a, 0x2a, 0x00, 0xac, 0x11, 0x60, 0x0d, 0x4b, 0xed, 0x4a, 0xed, 0x4a, 0x40, 0x15, 0x00, 0x42, 0x15, 0x20, 0x0d, 0x4b, 0x22, 0xd1, 0x00, 0xc4, 0x1f, 0x61, 0x11, 0x64,
+  0x8f, 0x5b, 0x8f, 0x53, 0xd2, 0x4d, 0x00, 0x32, 0x7c, 0x30, 0x5b, 0xed, 0x4a, 0x4e, 0x3c, 0x01, 0x22, 0x2e, 0x01, 0xa6, 0x11, 0x21, 0xf5, 0x8c, 0x80, 0x78, 0x10, 0x7c, 0x20, 0xaa, 0x40, 0x2f,
+  0x53, 0xf2, 0x6b, 0xae, 0x0a, 0x40, 0xd1, 0x6b, 0xd1, 0x63, 0x06, 0x00, 0x51, 0xb1, 0x63, 0xb1, 0x63, 0x74, 0x72, 0x4a, 0x31, 0x74, 0x7c, 0x74, 0xa4, 0x03, 0x50, 0x90, 0x63, 0x4f, 0x5b, 0x4f,
+  0x78, 0xd1, 0x01, 0x92, 0x03, 0x01, 0xe4, 0x18, 0x50, 0x6b, 0xb0, 0x6b, 0x11, 0x74, 0x0a, 0x27, 0xf1, 0x00, 0x73, 0x84, 0xb3, 0x8c, 0x11, 0x7c, 0x6e, 0x63, 0x0d, 0x5b, 0x4e, 0x63, 0x51, 0x84,
+  0x35, 0x3a, 0x5c, 0x10, 0x14, 0xec, 0x1f, 0x50, 0xc6, 0xd7, 0xb5, 0xf8, 0xbd, 0xaa, 0x0a, 0x60, 0x96, 0xad, 0xf8, 0xbd, 0xd7, 0xb5, 0xd2, 0x18, 0x80, 0xf0, 0x7b, 0x4e, 0x6b, 0x6e, 0x6b, 0xcf,
+  0x7b, 0x8c, 0x23, 0x00, 0x58, 0x0e, 0x00, 0x30, 0x43, 0x1b, 0x93, 0x8c, 0x2a, 0x1d, 0x93, 0x9e, 0x0a, 0x04, 0xa2, 0x0a, 0x11, 0xb3, 0x80, 0x03, 0x04, 0x34, 0x2e, 0x02, 0xbe, 0x98, 0x06, 0x1a,
+  0x07, 0x00, 0xd6, 0x5f, 0x03, 0x5a, 0x15, 0x16, 0xa4, 0x8a, 0x03, 0x04, 0x4a, 0x15, 0x15, 0xf1, 0xf2, 0x46, 0x02, 0x54, 0x15, 0x13, 0x33, 0x20, 0x07, 0x04, 0x24, 0x07, 0x00, 0x8c, 0x0a, 0x11,
+  0x74, 0xb8, 0x0a, 0x00, 0xfc, 0xf1, 0x17, 0x53, 0x78, 0x1c, 0x00, 0xaa, 0x0a, 0x04, 0x98, 0x03, 0x22, 0xf5, 0xcd, 0x20, 0x2e, 0x11, 0xf6, 0x50, 0x6e, 0x00, 0x38, 0x0e, 0x13, 0xb4, 0xd6, 0x31,
+  0x00, 0x00, 0x20, 0x00, 0xfa, 0x1f, 0x00, 0x2a, 0x07, 0x50, 0xf6, 0xcd, 0xd1, 0xa4, 0xd5, 0xf2, 0xc3, 0x12, 0xd6, 0x66, 0x15, 0x22, 0x90, 0x9c, 0x30, 0xd7, 0x02, 0x6a, 0x34, 0x00, 0x34, 0x1c,
+  0x00, 0x86, 0x38, 0x11, 0x50, 0x32, 0x0e, 0x00, 0x76, 0x18, 0x22, 0x4f, 0x33, 0x54, 0x1c, 0x11, 0x0e, 0xa8, 0xda, 0x00, 0x08, 0x00, 0x00, 0xc2, 0x18, 0x01, 0x18, 0x19, 0x01, 0x26, 0x4a, 0x02,
+  0x2e, 0xf7, 0x14, 0x94, 0xc6, 0x3b, 0x01, 0x92, 0xb7, 0x02, 0xca, 0x97, 0x02, 0x60, 0x34, 0x02, 0x18, 0x1c, 0x11, 0xb5, 0x4a, 0x54, 0x00, 0xa6, 0x06, 0x00, 0x06, 0x0e, 0x00, 0x5a, 0x07, 0x00,
+  0x0e, 0x00, 0x02, 0xf4, 0x49, 0x40, 0x0a, 0x0a, 0xcd, 0x22, 0xb0, 0x4a, 0x04, 0x3a, 0x07, 0x00, 0x04, 0x07, 0x02, 0xc6, 0x97, 0x24, 0x0f, 0x3b, 0x94, 0x18, 0x00, 0xe8, 0x42, 0x11, 0xad, 0x5c,
+  0x0e, 0x00, 0x22, 0x9f, 0x11, 0xb5, 0x24, 0x3f, 0x01, 0x12, 0x58, 0x11, 0x3b, 0x20, 0x04, 0x10, 0x2a, 0xb4, 0x0a, 0x00, 0x5a, 0x1c, 0x00, 0x48, 0x43, 0x51, 0x4b, 0x1a, 0x8c, 0x22, 0xad, 0x42,
+  0x86, 0x02, 0x1c, 0x00, 0x70, 0x6d, 0x22, 0x8d, 0x22, 0x8d, 0x2a, 0xad, 0xe0, 0x31, 0x21, 0x3b, 0x91, 0xf2, 0x34, 0x12, 0x12, 0xd8, 0x62, 0x00, 0xc4, 0x20, 0x03, 0x5e, 0x0e, 0x01, 0xc8, 0x9b,
+  0x02, 0x18, 0x4a, 0x00, 0x8c, 0x23, 0x01, 0x88, 0x11, 0x00, 0x1e, 0x03, 0x02, 0x12, 0x4a, 0x00, 0xa8, 0x46, 0x00, 0x4a, 0x6a, 0x00, 0x7c, 0xcd, 0x50, 0x8c, 0x2a, 0x2b, 0x1a, 0x8c, 0xac, 0x32,
+  0x10, 0x3a, 0x30, 0x31, 0x00, 0x34, 0x1c, 0x00, 0x14, 0xf8, 0x04, 0xfc, 0x62, 0x11, 0x12, 0xc4, 0xfe, 0x00, 0x24, 0x7c, 0x00, 0xec, 0x89, 0xa2, 0xcc, 0x32, 0xed, 0x32, 0x09, 0x12, 0x4b, 0x22,
+  0xcd, 0x32, 0xa4, 0x51, 0x22, 0xcd, 0x32, 0xaa, 0x71, 0x00, 0x36, 0xd8, 0x31, 0x2f, 0x43, 0x8c, 0x9e, 0x0a, 0x84, 0x2a, 0x1a, 0x0a, 0x1a, 0xed, 0x32, 0xb1, 0x53, 0x62, 0xbf, 0x00, 0x54, 0x98,
+  0x20, 0xac, 0x32, 0x4e, 0xb8, 0x00, 0x18, 0x75, 0x00, 0x26, 0x07, 0x60, 0xcc, 0x32, 0x4e, 0x4b, 0x6f, 0x4b, 0xaa, 0x0a, 0x20, 0x4e, 0x4b, 0xd6, 0x11, 0x50, 0xaf, 0x53, 0x52, 0x6c, 0x72, 0x68,
+  0x31, 0x10, 0x6c, 0x12, 0x00, 0x00, 0xd2, 0x1f, 0x71, 0x6e, 0x53, 0x11, 0x64, 0xf4, 0x84, 0x11, 0xaa, 0x0a, 0x40, 0xcf, 0x5b, 0xaf, 0x5b, 0xf0, 0x1f, 0x60, 0x8e, 0x53, 0x6e, 0x53, 0x10, 0x64,
+  0xf2, 0x1f, 0x00, 0x90, 0x26, 0x71, 0x2e, 0x4b, 0x2e, 0x53, 0x6f, 0x53, 0x73, 0x92, 0x2a, 0x10, 0xb4, 0x62, 0xd8, 0x01, 0x3c, 0x6a, 0x02, 0x8a, 0x86, 0x10, 0x8f, 0x6e, 0xb8, 0x01, 0x32, 0x3c,
+  0x00, 0x98, 0x0a, 0x10, 0x32, 0x9e, 0x18, 0x41, 0x74, 0xf6, 0x8c, 0x73, 0x40, 0x15, 0x73, 0x33, 0x74, 0x53, 0x74, 0xb1, 0x63, 0x90, 0xc6, 0x1f, 0x00, 0x3c, 0x00, 0xe0, 0x78, 0x9d, 0xd5, 0x84,
+  0xf2, 0x6b, 0x94, 0x84, 0x33, 0x74, 0xb1, 0x63, 0xd1, 0x6b, 0x58, 0x0e, 0x13, 0x12, 0x0a, 0x00, 0x00, 0x7e, 0x03, 0x60, 0x73, 0x7c, 0x33, 0x74, 0x53, 0x7c, 0x30, 0x78, 0x00, 0x02, 0x9c, 0x41,
+  0xf1, 0x6b, 0x73, 0x84, 0xa8, 0x0a, 0x50, 0x7c, 0x93, 0x84, 0x56, 0x9d, 0x38, 0x2a, 0x60, 0xaf, 0x6b, 0xec, 0x52, 0xd0, 0x73, 0x06, 0x43, 0xa0, 0xd8, 0xb5, 0x9a, 0xce, 0x35, 0xa5, 0x18, 0xbe,
+  0x76, 0xad, 0x94, 0x71, 0x00, 0x06, 0x00, 0xa0, 0x92, 0x8c, 0xb7, 0xb5, 0x19, 0xc6, 0xb7, 0xb5, 0x55, 0xa5, 0x4a, 0x35, 0x20, 0x76, 0xad, 0x40, 0xdc, 0x01, 0x28, 0x07, 0x01, 0x70, 0x1c, 0x00,
+  0x3c, 0x0e, 0x11, 0x72, 0xa4, 0x5f, 0x0f, 0x90, 0x03, 0x0d, 0x22, 0x93, 0x8c, 0xae, 0x58, 0x01, 0x0c, 0x07, 0x05, 0xa0, 0x0a, 0x02, 0x66, 0x63, 0x17, 0x91, 0x50, 0x9c, 0x04, 0xbe, 0x11, 0x02,
+  0x88, 0x03, 0x15, 0xd0, 0x90, 0x23, 0x03, 0x84, 0xa3, 0x05, 0x92, 0x03, 0x17, 0x12, 0xe0, 0x5f, 0x11, 0x73, 0x7c, 0x03, 0x00, 0xd4, 0x11, 0x04, 0x62, 0x15, 0x11, 0x94, 0xe8, 0x18, 0x00, 0xd6,
+  0xca, 0x21, 0x53, 0xb5, 0x0e, 0x00, 0x01, 0x18, 0x27, 0x00, 0x88, 0x23, 0x04, 0x96, 0x03, 0x00, 0x94, 0x03, 0x00, 0xae, 0x2a, 0x51, 0x36, 0xd6, 0x98, 0xe6, 0xf6, 0x1a, 0x07, 0x60, 0x33, 0xb5,
+  0x98, 0xe6, 0x37, 0xd6, 0x6e, 0x15, 0x02, 0x86, 0x03, 0x40, 0xd5, 0xc5, 0xf5, 0xcd, 0x1e, 0x07, 0x20, 0x77, 0xde, 0xd0, 0xd5, 0x00, 0x04, 0x03, 0x00, 0x08, 0x07, 0x20, 0xf3, 0x53, 0x1a, 0x15,
+  0x24, 0xd2, 0x4b, 0x92, 0x26, 0x02, 0xf6, 0x49, 0x00, 0x3e, 0x23, 0x00, 0xe6, 0x11, 0x00, 0x0c, 0x40, 0x22, 0xce, 0x2a, 0x76, 0x06, 0x11, 0x70, 0x22, 0x58, 0x04, 0xa6, 0x42, 0x02, 0x3e, 0x0a,
+  0x22, 0xee, 0x32, 0x92, 0xbe, 0x11, 0x90, 0xec, 0xba, 0x00, 0xaa, 0x03, 0x02, 0xee, 0x42, 0x00, 0xda, 0x85, 0x01, 0x0a, 0x39, 0x03, 0x3a, 0x31, 0x11, 0xd2, 0x5e, 0x3c, 0x02, 0x96, 0x2a, 0x20,
+  0x70, 0x43, 0xdc, 0x57, 0x00, 0x5a, 0x43, 0x00, 0x2a, 0xb4, 0x02, 0x04, 0x35, 0x00, 0x16, 0x00, 0x11, 0x0f, 0xec, 0x0a, 0x20, 0xce, 0x2a, 0x10, 0x31, 0x02, 0x90, 0x0a, 0x10, 0x50, 0x02, 0x32,
+  0x01, 0x14, 0x23, 0x00, 0x80, 0x0d, 0x00, 0x74, 0x1c, 0x20, 0x6c, 0x1a, 0xf0, 0x14, 0x00, 0xea, 0x50, 0x00, 0x1c, 0x4a, 0x20, 0x78, 0x85, 0x88, 0x5f, 0x11, 0x53, 0xae, 0x14, 0x00, 0xdc, 0xf3,
+  0x00, 0x78, 0x06, 0x02, 0x52, 0x31, 0x26, 0xb1, 0x4b, 0xa8, 0x26, 0x30, 0x54, 0x64, 0x54, 0xca, 0x69, 0x00, 0xe8, 0xa9, 0x10, 0x74, 0xc0, 0x15, 0x00, 0x56, 0x2a, 0x00, 0x4a, 0x15, 0x02, 0x4a,
+  0x0a, 0x00, 0xc6, 0x1f, 0x00, 0xe0, 0x0a, 0x00, 0xa0, 0x1f, 0x00, 0x80, 0x15, 0x00, 0xe4, 0x26, 0x00, 0x4a, 0x0a, 0x00, 0x60, 0x07, 0x24, 0xd2, 0x53, 0x7c, 0x38, 0x00, 0x1e, 0x0e, 0x00, 0x12,
+  0x0e, 0x20, 0xb9, 0x95, 0x76, 0x1c, 0x00, 0x16, 0x98, 0xc0, 0xf5, 0x7c, 0x77, 0x85, 0x16, 0x7d, 0x93, 0x6c, 0x36, 0x85, 0xd5, 0x74, 0xc0, 0xe9, 0x00, 0xa8, 0x4a, 0x00, 0xea, 0xa9, 0x00, 0x74,
+  0xad, 0x00, 0x24, 0xed, 0x22, 0x33, 0x64, 0x04, 0x83, 0x10, 0x73, 0xc6, 0x4d, 0x03, 0xfc, 0x9b, 0x01, 0x64, 0x9f, 0x00, 0x2e, 0xb8, 0x23, 0x64, 0x32, 0xca, 0xd4, 0x00, 0x66, 0x9f, 0x40, 0x0e,
+  0x3b, 0x4e, 0x43, 0x70, 0xcd, 0xa3, 0x6b, 0x2a, 0x8c, 0x32, 0x2e, 0x43, 0xcc, 0x3a, 0x90, 0x53, 0xb8, 0xbb, 0x21, 0x4b, 0xd0, 0x88, 0xfb, 0x00, 0x32, 0x0e, 0xf1, 0x00, 0xaf, 0x53, 0xaf, 0x53,
+  0x2d, 0x4b, 0xac, 0x3a, 0x8b, 0x32, 0x0c, 0x43, 0x8f, 0x5b, 0xf0, 0x2a, 0xb8, 0x20, 0x11, 0x64, 0x8a, 0x03, 0x60, 0x8f, 0x53, 0x2d, 0x4b, 0x0d, 0x4b, 0x8c, 0x0a, 0x91, 0x72, 0x74, 0x31, 0x6c,
+  0x31, 0x6c, 0x52, 0x74, 0x51, 0x34, 0x58, 0x00, 0x42, 0x23, 0x20, 0xed, 0x42, 0x72, 0x3f, 0x31, 0x2e, 0x53, 0x4f, 0x9e, 0x3f, 0x71, 0x8c, 0x3a, 0xcd, 0x42, 0x4b, 0x32, 0xcd, 0x10, 0x7c, 0x02,
+  0x3a, 0x71, 0x11, 0x93, 0x00, 0x4e, 0x00, 0x94, 0xad, 0x02, 0x6c, 0x1c, 0x20, 0x32, 0x74, 0x9c, 0x0a, 0x40, 0xb5, 0x84, 0x74, 0x7c, 0x92, 0x11, 0x20, 0x74, 0x7c, 0x0a, 0x00, 0xf0, 0x01, 0x53,
+  0x7c, 0xd1, 0x6b, 0x90, 0x63, 0x2f, 0x53, 0x4f, 0x5b, 0xd1, 0x6b, 0x12, 0x74, 0x90, 0x63, 0x0a, 0x07, 0x00, 0x2c, 0x07, 0x00, 0x9e, 0x2a, 0x00, 0xf4, 0x11, 0x00, 0x40, 0x07, 0x00, 0x94, 0x1c,
+  0x30, 0xb4, 0x84, 0x73, 0x6a, 0xb1, 0x03, 0x9e, 0x0a, 0xf0, 0x05, 0x6f, 0x63, 0x31, 0x7c, 0xd4, 0x8c, 0x31, 0x7c, 0xec, 0x52, 0x6f, 0x63, 0xaf, 0x6b, 0xec, 0x5a, 0x92, 0x8c, 0xf8, 0xb5, 0xf6,
+  0x6d, 0x00, 0x1c, 0x2e, 0x30, 0x39, 0xc6, 0x55, 0xa6, 0x0a, 0x10, 0xb5, 0xc4, 0x11, 0xf0, 0x01, 0xef, 0x7b, 0x4d, 0x6b, 0xaf, 0x73, 0xcf, 0x7b, 0xd0, 0x7b, 0x11, 0x84, 0xd3, 0x9c, 0x72, 0x8c,
+  0x5e, 0x1c, 0x33, 0x93, 0x94, 0x31, 0x2c, 0x0e, 0x01, 0x66, 0x1c, 0x01, 0x8c, 0x0a, 0x17, 0x72, 0x22, 0x07, 0x0c, 0x02, 0x00, 0x07, 0xc0, 0x0a, 0x05, 0x8c, 0x03, 0x13, 0xb2, 0x12, 0x07, 0x22,
+  0x71, 0x9c, 0x7a, 0x6a, 0x21, 0x91, 0xa4, 0x2a, 0x55, 0x03, 0x88, 0x03, 0x15, 0xf0, 0x92, 0x03, 0x06, 0x92, 0x4a, 0x00, 0x8a, 0x03, 0x44, 0x2e, 0x94, 0xf1, 0xac, 0x92, 0x2a, 0x06, 0x02, 0x00,
+  0x04, 0x90, 0x23, 0x33, 0x32, 0xb5, 0xb4, 0x60, 0x1c, 0x13, 0xb4, 0x5c, 0x1c, 0x01, 0x68, 0xce, 0x00, 0x94, 0x03, 0x03, 0xc2, 0x51, 0x11, 0xd5, 0x96, 0x0a, 0x00, 0x9c, 0x0a, 0x02, 0xd2, 0x11,
+  0x00, 0xbe, 0x3c, 0x71, 0x16, 0xd6, 0x4b, 0x7b, 0xee, 0x8b, 0x90, 0x9a, 0x0e, 0x00, 0x1a, 0x40, 0x40, 0xf6, 0xcd, 0xf9, 0xee, 0x1c, 0x00, 0x00, 0xe2, 0x11, 0x30, 0x78, 0xde, 0x77, 0x34, 0xd2,
+  0x00, 0x12, 0xcb, 0x72, 0xe6, 0xd6, 0x6c, 0xf7, 0x74, 0x95, 0x64, 0xb8, 0x29, 0x02, 0x06, 0x31, 0x00, 0xbc, 0x70, 0x00, 0x04, 0x00, 0x11, 0x75, 0xe0, 0x29, 0x11, 0xf2, 0x1e, 0x6d, 0x00, 0x72,
+  0x11, 0x02, 0xc4, 0x57, 0x11, 0x33, 0x68, 0x03, 0x00, 0xcc, 0x18, 0x10, 0x37, 0x74, 0x42, 0x03, 0xfc, 0xe1, 0x11, 0xd6, 0x9a, 0x11, 0x10, 0x53, 0x76, 0x42, 0x00, 0x12, 0x4a, 0x03, 0xf8, 0x34,
+  0x02, 0x38, 0x2a, 0x02, 0xee, 0xac, 0x11, 0xd2, 0x88, 0x11, 0x02, 0xe6, 0x69, 0x01, 0x46, 0xd4, 0x03, 0xe2, 0x2d, 0x11, 0x12, 0x2c, 0x0b, 0x02, 0x68, 0xa2, 0x21, 0x54, 0x5c, 0x7a, 0x3f, 0x10,
+  0x43, 0x74, 0x46, 0x02, 0x60, 0x3f, 0x02, 0xae, 0xd7, 0x10, 0xd1, 0xb2, 0xb0, 0x01, 0x3a, 0x03, 0x00, 0x28, 0x19, 0x11, 0x13, 0xfa, 0x23, 0x11, 0x74, 0x60, 0x2a, 0x02, 0xf8, 0x11, 0x04, 0x64,
+  0xdb, 0x00, 0xec, 0x06, 0x02, 0xcc, 0xde, 0x01, 0x64, 0x31, 0x01, 0x7e, 0x23, 0x02, 0xc4, 0x2d, 0x00, 0xb6, 0x0d, 0x00, 0xe6, 0x5b, 0x00, 0x92, 0x0a, 0x00, 0x7c, 0x07, 0x02, 0x72, 0x18, 0x00,
+  0xda, 0x2d, 0x00, 0xf4, 0x3b, 0x00, 0x50, 0x6a, 0x02, 0x9a, 0x03, 0x02, 0xa2, 0x0a, 0x12, 0x90, 0x34, 0x43, 0x72, 0x53, 0x0f, 0x3b, 0x90, 0x4b, 0x13, 0x5c, 0x60, 0x2a, 0x02, 0xa6, 0x82, 0x20,
+  0xb4, 0x74, 0x9e, 0x71, 0x02, 0x80, 0x3f, 0x02, 0x74, 0xbb, 0x00, 0x06, 0x07, 0xa0, 0xf1, 0x5b, 0x0d, 0x3b, 0x4a, 0x22, 0xe9, 0x11, 0x4a, 0x22, 0x08, 0x24, 0x20, 0xed, 0x32, 0x1c, 0xf8, 0x01,
+  0x62, 0xd4, 0x10, 0x53, 0x60, 0xa6, 0x00, 0x9e, 0x66, 0x00, 0xe0, 0x1f, 0x50, 0xac, 0x2a, 0x2e, 0x3b, 0x6f, 0x32, 0xf4, 0x12, 0x43, 0xb8, 0xb4, 0xb1, 0x4e, 0x43, 0x2d, 0x3b, 0x0d, 0x3b, 0x6e,
+  0x43, 0xb0, 0x53, 0x72, 0x52, 0x9f, 0x11, 0xd4, 0xe6, 0xc2, 0x02, 0x0a, 0xd1, 0x02, 0x22, 0x43, 0x00, 0xf0, 0xa2, 0x00, 0x16, 0xb1, 0x20, 0x8f, 0x53, 0xa6, 0xc6, 0x31, 0xd0, 0x5b, 0xb3, 0x2a,
+  0x71, 0x00, 0xf2, 0x7b, 0x20, 0x6e, 0x53, 0x84, 0x03, 0x00, 0x6e, 0x31, 0x80, 0xd0, 0x5b, 0xb3, 0x7c, 0x35, 0x8d, 0x93, 0x74, 0x3e, 0x86, 0x40, 0x4e, 0x4b, 0x6b, 0x32, 0xec, 0x18, 0x80, 0xcc,
+  0x3a, 0x0d, 0x4b, 0xec, 0x42, 0xcc, 0x42, 0xc4, 0x18, 0x20, 0x90, 0x5b, 0xdc, 0x6d, 0x20, 0xcd, 0x42, 0x66, 0x43, 0x40, 0xcd, 0x42, 0x2f, 0x4b, 0x72, 0x43, 0x04, 0xe2, 0x1f, 0x00, 0x00, 0x55,
+  0x00, 0x24, 0x0e, 0x00, 0xa2, 0x38, 0x11, 0x74, 0xfa, 0x0d, 0x00, 0xa2, 0x0a, 0x02, 0xa4, 0x11, 0x11, 0x90, 0xca, 0x8d, 0x00, 0xc4, 0x18, 0x44, 0x70, 0x5b, 0xf2, 0x6b, 0x98, 0x03, 0x72, 0x94,
+  0x7c, 0xf6, 0x8c, 0xf6, 0x8c, 0xd5, 0x04, 0x00, 0x10, 0x94, 0xa6, 0x03, 0x02, 0x98, 0x0a, 0x00, 0x58, 0xd1, 0x11, 0x32, 0x0e, 0x00, 0x00, 0x90, 0x9f, 0x40, 0xb0, 0x63, 0xf1, 0x73, 0xe4, 0x4d,
+  0x02, 0x9c, 0x38, 0x60, 0x2d, 0x5b, 0x29, 0x3a, 0x93, 0x8c, 0x7e, 0x98, 0x00, 0x7a, 0x03, 0x00, 0x9e, 0x11, 0x00, 0x1c, 0x2e, 0x40, 0x96, 0xb5, 0xf8, 0xc5, 0x94, 0x03, 0x60, 0x6e, 0x6b, 0x8e,
+  0x73, 0xf0, 0x7b, 0xc0, 0x26, 0x00, 0xc8, 0xad, 0x52, 0x93, 0x94, 0xd4, 0x9c, 0x52, 0xa4, 0x11, 0x11, 0x94, 0x6c, 0x63, 0x09, 0x2c, 0x0e, 0x17, 0x73, 0x3e, 0x35, 0x1e, 0x73, 0x56, 0x15, 0x04,
+  0x22, 0x0e, 0x01, 0x06, 0x00, 0x23, 0xb2, 0x94, 0x8a, 0x03, 0x05, 0x6c, 0x43, 0x3b, 0xb1, 0xac, 0xb1, 0xf6, 0x1f, 0x01, 0xc4, 0x31, 0x03, 0x22, 0x07, 0x04, 0x8e, 0x03, 0x00, 0x36, 0x0e, 0x02,
+  0xd8, 0x18, 0x26, 0x33, 0xb5, 0x18, 0xa7, 0x06, 0x1c, 0x07, 0x11, 0x94, 0x6c, 0x23, 0x00, 0xd0, 0x11, 0x10, 0x32, 0x8e, 0x43, 0x00, 0x64, 0x15, 0x02, 0x5a, 0x35, 0x01, 0xde, 0x18, 0x13, 0xd5,
+  0x8e, 0x03, 0x02, 0xa2, 0x0a, 0x60, 0x53, 0xbd, 0x90, 0xa4, 0x37, 0xd6, 0x08, 0x99, 0x02, 0xb8, 0x23, 0x62, 0xd9, 0xee, 0xd5, 0xcd, 0xf1, 0xac, 0x56, 0x4e, 0x40, 0xf6, 0xcd, 0xf2, 0xac, 0x8c,
+  0x1c, 0x01, 0x38, 0x0e, 0x10, 0xde, 0x3a, 0x0e, 0x20, 0x98, 0xde, 0x94, 0x3c, 0x13, 0xb2, 0x9e, 0xb3, 0x02, 0xb2, 0x18, 0x11, 0x95, 0x58, 0x0a, 0x22, 0xef, 0x2a, 0x24, 0x40, 0x02, 0xae, 0xcc,
+  0x33, 0x75, 0x64, 0xf6, 0x5c, 0x46, 0x02, 0x74, 0x15, 0x11, 0x33, 0x88, 0xbe, 0x01, 0x40, 0x4a, 0x03, 0x94, 0x62, 0x00, 0x4e, 0x03, 0x00, 0x72, 0x3f, 0x00, 0x6e, 0x69, 0x00, 0x1e, 0x03, 0x00,
+  0xd4, 0x4d, 0x00, 0x62, 0x15, 0x00, 0x0e, 0x27, 0x02, 0xde, 0x31, 0x01, 0x96, 0x15, 0x21, 0x6c, 0xb5, 0xec, 0x18, 0x04, 0x36, 0x11, 0x02, 0x68, 0x11, 0x02, 0x88, 0xe9, 0x02, 0x14, 0x12, 0x02,
+  0x7c, 0x2d, 0x00, 0xea, 0x03, 0x20, 0x16, 0x7d, 0x4e, 0x2d, 0x20, 0x16, 0x7d, 0x12, 0x4a, 0x02, 0x02, 0x38, 0x10, 0xb5, 0x06, 0x07, 0x21, 0x85, 0x37, 0x6e, 0x18, 0x02, 0xdc, 0x69, 0x11, 0x74,
+  0xe6, 0x1c, 0x00, 0xa0, 0x03, 0x11, 0x90, 0xb8, 0x03, 0x13, 0x70, 0xc8, 0x5b, 0x10, 0x74, 0x1a, 0x00, 0x10, 0x7c, 0x18, 0x23, 0x20, 0x95, 0x6c, 0x3e, 0x2a, 0x20, 0x37, 0x85, 0x96, 0x11, 0x00,
+  0x50, 0x0a, 0x00, 0xd6, 0x03, 0x11, 0xb1, 0x74, 0x5f, 0x00, 0x28, 0x2a, 0x00, 0x7a, 0xbf, 0x11, 0xb1, 0xfe, 0x03, 0x10, 0xd2, 0xc6, 0x46, 0x01, 0xce, 0x54, 0x24, 0x94, 0x6c, 0x30, 0x71, 0x00,
+  0xb2, 0x0a, 0x42, 0xb5, 0x74, 0x78, 0x8d, 0x36, 0x0e, 0x31, 0x73, 0x64, 0x93, 0xaa, 0x06, 0x11, 0x72, 0x18, 0xfb, 0xf1, 0x10, 0x0d, 0x3b, 0xec, 0x3a, 0xec, 0x3a, 0xcc, 0x32, 0xcc, 0x32, 0xab,
+  0x32, 0xab, 0x2a, 0x0d, 0x3b, 0x8b, 0x2a, 0xcc, 0x32, 0xec, 0x32, 0xaf, 0x4b, 0xd0, 0x53, 0x4e, 0x43, 0x0d, 0x3b, 0xf1, 0xd2, 0xf7, 0x00, 0xd4, 0xf7, 0x00, 0x8c, 0x91, 0x02, 0x8a, 0xad, 0x00,
+  0xec, 0x74, 0x00, 0x2e, 0x15, 0x00, 0xdc, 0x1f, 0x00, 0x26, 0x98, 0x60, 0x6b, 0x2a, 0xec, 0x32, 0x0d, 0x3b, 0x40, 0x00, 0xf0, 0x01, 0x29, 0x1a, 0x8b, 0x2a, 0x29, 0x22, 0x87, 0x01, 0xab, 0x2a,
+  0xab, 0x32, 0x2a, 0x22, 0x0d, 0x3b, 0x9e, 0xf4, 0x00, 0xbc, 0xdb, 0x60, 0x16, 0x85, 0x77, 0x8d, 0x36, 0x85, 0x86, 0x9f, 0x00, 0xf4, 0x4d, 0x20, 0x52, 0x64, 0xb0, 0xb4, 0x22, 0xed, 0x42, 0xd4,
+  0x7b, 0x20, 0x32, 0x6c, 0x9a, 0xdb, 0x00, 0x0a, 0x51, 0x00, 0x02, 0x00, 0x40, 0x92, 0x74, 0x0d, 0x43, 0x68, 0x23, 0x11, 0x11, 0x9e, 0x9b, 0x00, 0x76, 0x3f, 0x20, 0xcc, 0x42, 0x1e, 0x0e, 0x20,
+  0x4f, 0x53, 0xa2, 0x11, 0x00, 0x58, 0x03, 0x11, 0x33, 0x7e, 0x2a, 0x31, 0x74, 0x74, 0x33, 0x50, 0x71, 0x02, 0xd6, 0x3f, 0x04, 0xfa, 0x46, 0x01, 0x82, 0x98, 0x01, 0x06, 0x00, 0x00, 0x4c, 0x0e,
+  0x02, 0xaa, 0x03, 0x00, 0x2a, 0x0e, 0x02, 0x14, 0x0e, 0x02, 0x5a, 0x6a, 0x02, 0x2c, 0x07, 0x00, 0x1e, 0x0e, 0x00, 0xa8, 0x0a, 0x02, 0x18, 0x07, 0x00, 0x66, 0x1c, 0x10, 0x74, 0xca, 0x03, 0x01,
+  0x42, 0xb1, 0x20, 0xf5, 0x8c, 0x4e, 0xb1, 0x20, 0x32, 0x7c, 0x1a, 0xa3, 0x02, 0xb6, 0x11, 0x00, 0xb4, 0x11, 0x00, 0x02, 0x00, 0x20, 0x8b, 0x4a, 0x8c, 0x03, 0x20, 0x93, 0x8c, 0x8a, 0x03, 0x91,
+  0x18, 0xbe, 0x39, 0xc6, 0x18, 0xc6, 0x38, 0xc6, 0xb7, 0xb2, 0x11, 0x82, 0x51, 0x8c, 0x55, 0xad, 0x4d, 0x6b, 0x31, 0x84, 0x00, 0x07, 0x02, 0xd2, 0x18, 0x10, 0x72, 0x9c, 0x2a, 0x03, 0xd2, 0x18,
+  0x02, 0x7e, 0x23, 0x11, 0x32, 0xfc, 0xcd, 0x02, 0x02, 0x00, 0x0a, 0xca, 0x11, 0x0c, 0xe0, 0x18, 0x04, 0x5e, 0x15, 0x14, 0xb3, 0x5e, 0x63, 0x00, 0x10, 0x27, 0x14, 0x94, 0xee, 0x66, 0x06, 0x18,
+  0x27, 0x01, 0x90, 0x03, 0x24, 0xb4, 0xd0, 0x54, 0x15, 0x00, 0xa4, 0x0a, 0x05, 0xc8, 0x11, 0x00, 0x92, 0x23, 0x13, 0x33, 0x86, 0x4a, 0x15, 0x12, 0x72, 0x83, 0x02, 0xcc, 0xb1, 0x02, 0x12, 0x00,
+  0x13, 0x12, 0x42, 0x2e, 0x02, 0x2c, 0xa7, 0x00, 0xae, 0x0a, 0x20, 0x16, 0xd6, 0xc6, 0x51, 0x02, 0x06, 0x20, 0x00, 0x04, 0x27, 0x00, 0xe6, 0x3f, 0x00, 0xb0, 0x03, 0x00, 0xa2, 0x0a, 0x11, 0xf5,
+  0x24, 0x47, 0x26, 0xf1, 0xac, 0xb8, 0x23, 0x22, 0xd5, 0xcd, 0x8c, 0xce, 0x00, 0x92, 0x1c, 0x02, 0xba, 0x2a, 0x21, 0x77, 0xde, 0x98, 0x23, 0x30, 0xb5, 0xd5, 0xc5, 0xf2, 0x11, 0x30, 0xb6, 0x6c,
+  0x75, 0x8c, 0x46, 0x10, 0x6c, 0x96, 0x03, 0x13, 0xb2, 0xe8, 0xc1, 0x00, 0x66, 0x1c, 0x11, 0x70, 0x2e, 0x23, 0x00, 0x18, 0x40, 0x00, 0xc2, 0x42, 0x02, 0xb2, 0xbe, 0x02, 0x70, 0xa9, 0x02, 0xc2,
+  0x2d, 0x22, 0x50, 0x3b, 0xf8, 0x26, 0x01, 0x56, 0xb0, 0x03, 0x92, 0xec, 0x02, 0xbc, 0x5e, 0x00, 0x40, 0x07, 0x02, 0xdc, 0x31, 0x10, 0x74, 0x22, 0x0a, 0x01, 0x30, 0x4d, 0x00, 0xc4, 0x69, 0x01,
+  0xc2, 0x1f, 0x03, 0xf8, 0x1f, 0x22, 0x13, 0x54, 0x6c, 0x15, 0x02, 0x80, 0x46, 0x00, 0x88, 0x03, 0x11, 0x13, 0xba, 0x62, 0x02, 0xdc, 0x50, 0x01, 0x8c, 0x18, 0x01, 0x08, 0x2a, 0x57, 0x74, 0x64,
+  0x17, 0x7d, 0x33, 0x72, 0x0a, 0x00, 0x86, 0x03, 0x11, 0x54, 0x6a, 0x19, 0x20, 0x54, 0x64, 0xa0, 0x26, 0x00, 0x18, 0x00, 0x20, 0x2f, 0x3b, 0x54, 0x0e, 0x00, 0xbe, 0x0a, 0x31, 0xd6, 0x74, 0xf6,
+  0x40, 0x00, 0x20, 0x74, 0x6c, 0xc0, 0x34, 0x02, 0x1c, 0x6a, 0x11, 0x70, 0x20, 0x3f, 0x00, 0x18, 0x71, 0x02, 0xfa, 0xb7, 0x02, 0xd4, 0xc2, 0x00, 0xca, 0x31, 0x02, 0x1c, 0x3d, 0x00, 0x8e, 0x23,
+  0x00, 0x4e, 0x51, 0x00, 0x16, 0x00, 0x00, 0xb8, 0x86, 0x02, 0x1c, 0x20, 0x00, 0xc8, 0x46, 0x02, 0x0c, 0xff, 0x00, 0xa0, 0xf7, 0x00, 0x3a, 0xf4, 0xf0, 0x09, 0xf0, 0x53, 0xaf, 0x53, 0x8f, 0x4b,
+  0x31, 0x64, 0xd4, 0x74, 0x51, 0x64, 0xaf, 0x53, 0x8e, 0x4b, 0x8e, 0x4b, 0xaf, 0x53, 0x10, 0x5c, 0x31, 0x64, 0x46, 0x0a, 0x00, 0xec, 0x06, 0x00, 0x44, 0xc6, 0x11, 0x2d, 0x44, 0xed, 0x11, 0xd0,
+  0x24, 0x60, 0x00, 0x62, 0x9f, 0x00, 0x74, 0xa6, 0x31, 0x8f, 0x4b, 0x4f, 0xbe, 0x74, 0x02, 0x00, 0xb8, 0x33, 0x4e, 0x43, 0xd0, 0x82, 0xc6, 0x20, 0x6f, 0x4b, 0x3a, 0x00, 0x70, 0x0d, 0x3b, 0x6e,
+  0x4b, 0x8e, 0x4b, 0x0c, 0x9a, 0x03, 0xd1, 0x2a, 0xcc, 0x32, 0xed, 0x3a, 0xe9, 0x11, 0x8c, 0x2a, 0x8c, 0x32, 0x2a, 0x22, 0x98, 0x78, 0x00, 0xa6, 0x0e, 0x32, 0x43, 0x0e, 0x43, 0x14, 0xc3, 0x00,
+  0x4c, 0x0e, 0x11, 0xac, 0x8e, 0xfb, 0x00, 0x64, 0x15, 0x11, 0xd4, 0x88, 0x86, 0x00, 0x58, 0xcd, 0x00, 0x9a, 0x03, 0x20, 0x10, 0x64, 0xd4, 0x11, 0x40, 0x32, 0x6c, 0xed, 0x42, 0x02, 0x00, 0x22,
+  0xcd, 0x42, 0x0c, 0xa3, 0x02, 0x06, 0x3c, 0x02, 0xd4, 0x94, 0x11, 0x73, 0x7a, 0x31, 0x02, 0xa8, 0x31, 0x11, 0xb1, 0x22, 0x67, 0x00, 0xe0, 0x18, 0x00, 0x00, 0x20, 0xe0, 0x4b, 0x32, 0xc9, 0x21,
+  0x2a, 0x32, 0x4b, 0x32, 0x8c, 0x3a, 0xed, 0x4a, 0xf2, 0x6b, 0x3e, 0x43, 0x00, 0x9e, 0x38, 0x00, 0x50, 0x1c, 0x00, 0xce, 0x18, 0x20, 0xb1, 0x63, 0x7a, 0x03, 0x02, 0x9a, 0x23, 0x00, 0x5a, 0x15,
+  0x00, 0xbe, 0x11, 0x00, 0x6a, 0x15, 0x20, 0xd1, 0x6b, 0xb6, 0x11, 0x20, 0x70, 0x5b, 0x8a, 0x23, 0x00, 0x6e, 0x58, 0x40, 0xb0, 0x6b, 0x6f, 0x63, 0x9c, 0x5f, 0x20, 0xf1, 0x73, 0x88, 0x03, 0x00,
+  0x38, 0x35, 0xe0, 0xcf, 0x6b, 0x11, 0x7c, 0x8e, 0x63, 0xcc, 0x52, 0x52, 0x84, 0x35, 0xa5, 0xbb, 0xd6, 0x86, 0x9f, 0x02, 0xa6, 0x78, 0xf1, 0x04, 0xbb, 0xd6, 0xd7, 0xbd, 0x39, 0xc6, 0x9a, 0xd6,
+  0x72, 0x94, 0x2d, 0x63, 0xaf, 0x7b, 0x51, 0x8c, 0x10, 0x84, 0x51, 0x84, 0x03, 0x15, 0x51, 0x5a, 0x1c, 0x03, 0xd4, 0x38, 0x09, 0x80, 0x03, 0x17, 0x72, 0x78, 0x1c, 0x1c, 0x73, 0x44, 0x0e, 0x01,
+  0x16, 0xe7, 0x05, 0xa4, 0x0a, 0x00, 0x7e, 0x23, 0x01, 0x4c, 0x35, 0x00, 0x90, 0x03, 0x16, 0xb0, 0x4e, 0x35, 0x0b, 0x1a, 0x07, 0x04, 0x32, 0x0e, 0x43, 0x11, 0xb5, 0xb0, 0xa4, 0x50, 0x3c, 0x01,
+  0x04, 0x00, 0x02, 0x36, 0x0e, 0x11, 0x33, 0x92, 0x03, 0x02, 0x36, 0x0e, 0x11, 0x32, 0xe0, 0x5f, 0x04, 0x6a, 0x3c, 0x13, 0xb4, 0x3a, 0x2e, 0x01, 0x44, 0x55, 0x01, 0x94, 0x03, 0x20, 0xd1, 0xa4,
+  0x80, 0x03, 0x11, 0x74, 0x36, 0x6e, 0x04, 0x54, 0x15, 0x00, 0xfa, 0x06, 0x00, 0x12, 0x27, 0x02, 0x0e, 0x00, 0x22, 0xf2, 0xac, 0xb8, 0x4a, 0x00, 0xdc, 0x51, 0x20, 0x36, 0xd6, 0x3c, 0x0e, 0x02,
+  0xae, 0x43, 0x20, 0x77, 0xde, 0xd4, 0x31, 0x00, 0x3e, 0x27, 0x20, 0xd5, 0xc5, 0xac, 0x0a, 0x00, 0xc2, 0x03, 0x10, 0x8d, 0xf0, 0x10, 0x01, 0x40, 0x43, 0x22, 0xb2, 0x4b, 0x06, 0xc2, 0x02, 0x9a,
+  0x58, 0x40, 0x75, 0x64, 0x95, 0x64, 0x8a, 0x03, 0x00, 0x4a, 0x74, 0x13, 0xb2, 0xe4, 0x34, 0x04, 0x1c, 0x00, 0x02, 0x0e, 0x0e, 0x02, 0x90, 0x23, 0x22, 0xb1, 0x4b, 0x92, 0x03, 0x02, 0x84, 0x7b,
+  0x02, 0x88, 0x62, 0x20, 0xcd, 0x2a, 0xe0, 0x38, 0x11, 0xcd, 0x02, 0x00, 0x00, 0xa2, 0x2a, 0x00, 0x1c, 0x03, 0x00, 0x5e, 0x0a, 0x00, 0xe8, 0x69, 0x02, 0x62, 0x0a, 0x02, 0x84, 0x34, 0x00, 0x4c,
+  0x0a, 0x02, 0x72, 0x18, 0x02, 0x22, 0x00, 0x22, 0xd2, 0x53, 0xac, 0x15, 0x00, 0x74, 0x14, 0x02, 0x88, 0x14, 0x11, 0x94, 0xb4, 0x70, 0x11, 0x70, 0x4a, 0x0a, 0x11, 0xd2, 0x32, 0x03, 0x00, 0x3a,
+  0x00, 0x11, 0xd2, 0xa2, 0x18, 0x11, 0xb2, 0x36, 0x00, 0x00, 0x56, 0x11, 0x02, 0x60, 0x38, 0x22, 0xd2, 0x53, 0x26, 0x00, 0x02, 0x6a, 0x07, 0x02, 0x8e, 0x0a, 0x00, 0x66, 0x00, 0x02, 0xec, 0x97,
+  0x11, 0x33, 0x24, 0x1d, 0x00, 0x14, 0x00, 0x00, 0x5c, 0x2a, 0x02, 0x2a, 0xbf, 0x02, 0xca, 0x0a, 0x00, 0x9e, 0x03, 0x11, 0x4f, 0x40, 0x58, 0x20, 0x13, 0x5c, 0x60, 0x51, 0x00, 0x9a, 0x07, 0x00,
+  0xb8, 0x03, 0x00, 0x56, 0xa6, 0x02, 0x3c, 0x5c, 0xc0, 0xed, 0x3a, 0x8b, 0x2a, 0x2a, 0x22, 0x09, 0x1a, 0x09, 0x1a, 0x6a, 0x2a, 0x0c, 0x07, 0x51, 0x4e, 0x43, 0x8f, 0x4b, 0x6e, 0x72, 0x18, 0x40,
+  0x6e, 0x43, 0x6e, 0x4b, 0x90, 0x03, 0x41, 0xaf, 0x53, 0x31, 0x64, 0x0e, 0x83, 0x10, 0x3b, 0x1c, 0x00, 0x11, 0x6f, 0x58, 0x6a, 0x02, 0x14, 0x91, 0x00, 0xb6, 0x18, 0x80, 0x0a, 0x1a, 0xe9, 0x19,
+  0xe9, 0x19, 0x8b, 0x2a, 0x12, 0x07, 0x00, 0xf8, 0x7b, 0x00, 0xbc, 0x03, 0x40, 0xec, 0x32, 0xab, 0x32, 0x4a, 0x00, 0x80, 0xcf, 0x53, 0x49, 0x22, 0xcb, 0x32, 0x4e, 0x43, 0x38, 0x00, 0x00, 0x70,
+  0x78, 0x00, 0x04, 0x0b, 0x02, 0x9e, 0xad, 0x20, 0x2e, 0x43, 0x2e, 0x5c, 0x00, 0xb4, 0x0a, 0x00, 0x90, 0x38, 0x31, 0x0d, 0x43, 0x11, 0xc4, 0x6d, 0x51, 0xf0, 0x63, 0xcc, 0x3a, 0xaf, 0xa4, 0x11,
+  0x00, 0xa8, 0x18, 0x11, 0xaf, 0x4e, 0x15, 0x00, 0x48, 0x0e, 0x00, 0x3e, 0x0e, 0x22, 0xb0, 0x5b, 0xf8, 0x82, 0x20, 0x2e, 0x4b, 0x50, 0x03, 0x26, 0x70, 0x53, 0xa4, 0x8d, 0x04, 0xf8, 0x7b, 0x11,
+  0x33, 0x38, 0x1c, 0x26, 0x73, 0x74, 0xc6, 0x8d, 0x22, 0x12, 0x6c, 0xd2, 0x18, 0x00, 0x8c, 0x2a, 0x00, 0x94, 0x23, 0x00, 0x22, 0x27, 0x00, 0x4a, 0x0e, 0x20, 0xb0, 0x63, 0x1c, 0x0e, 0x40, 0xf2,
+  0x6b, 0xb1, 0x63, 0x04, 0x00, 0x01, 0xec, 0x7f, 0x00, 0x2e, 0x00, 0x10, 0x74, 0xf4, 0x26, 0x02, 0x28, 0xca, 0x00, 0x14, 0x07, 0x00, 0x6c, 0xdf, 0x00, 0x04, 0x5c, 0x00, 0xb0, 0xad, 0x40, 0xcf,
+  0x6b, 0xd0, 0x73, 0x22, 0x83, 0x20, 0x11, 0x7c, 0x36, 0x35, 0xd0, 0x31, 0x7c, 0x4d, 0x63, 0xaf, 0x6b, 0x14, 0x9d, 0xf4, 0x94, 0x14, 0x9d, 0xd7, 0x4c, 0xb1, 0x50, 0xc6, 0xd7, 0xb5, 0xbb, 0xd6,
+  0x02, 0x47, 0xa0, 0x92, 0x94, 0xd7, 0xbd, 0x35, 0xa5, 0x31, 0x8c, 0xb3, 0x9c, 0x3e, 0x03, 0x00, 0xa6, 0x0a, 0x06, 0x10, 0x07, 0x01, 0xee, 0x3f, 0x05, 0x0e, 0x00, 0x01, 0x0e, 0x27, 0x05, 0x02,
+  0x00, 0x0e, 0x90, 0x03, 0x1e, 0x93, 0x7a, 0x1c, 0x02, 0x92, 0x1c, 0x00, 0x78, 0x6a, 0x0b, 0x8e, 0x03, 0x17, 0xaf, 0x50, 0x35, 0x04, 0xfa, 0x1f, 0x04, 0x18, 0x6e, 0x00, 0xdc, 0x38, 0x24, 0x2e,
+  0x9c, 0x96, 0xf5, 0x06, 0xce, 0x38, 0x02, 0x06, 0x00, 0x02, 0x8c, 0x23, 0x02, 0x76, 0x23, 0x00, 0xa0, 0x51, 0x02, 0xf0, 0x18, 0x00, 0x82, 0x83, 0x00, 0xce, 0x11, 0xc0, 0x33, 0xb5, 0x57, 0xd6,
+  0x4f, 0x94, 0x73, 0xbd, 0x77, 0xde, 0x32, 0xb5, 0x66, 0x95, 0x00, 0x38, 0x0e, 0x00, 0x30, 0x07, 0x11, 0x73, 0x36, 0x00, 0x20, 0x2f, 0x94, 0x1e, 0x27, 0x80, 0x98, 0xe6, 0x77, 0xde, 0xb8, 0xe6,
+  0x12, 0xb5, 0x5c, 0x0e, 0x00, 0xf4, 0x38, 0x00, 0xac, 0x03, 0x11, 0xf5, 0x38, 0x27, 0x00, 0x8e, 0x03, 0x00, 0x90, 0x1c, 0x00, 0x6a, 0xe0, 0x20, 0xd5, 0xcd, 0xa4, 0x03, 0x11, 0x13, 0x58, 0xb7,
+  0x00, 0x02, 0x0e, 0x11, 0x17, 0xe8, 0x45, 0x21, 0xf3, 0x53, 0x7e, 0x06, 0x03, 0x56, 0x0a, 0x02, 0x0a, 0x3f, 0x01, 0xa6, 0x18, 0x01, 0x70, 0x23, 0x00, 0xd8, 0x0a, 0x02, 0xec, 0x3f, 0x02, 0x76,
+  0xb0, 0x00, 0xa2, 0x03, 0x02, 0x14, 0xb4, 0x11, 0x53, 0x7c, 0x06, 0x13, 0xb1, 0xce, 0x18, 0x00, 0x4a, 0x26, 0x10, 0x16, 0x12, 0x20, 0x30, 0x85, 0x99, 0x8d, 0x04, 0x23, 0x11, 0x95, 0x0a, 0x03,
+  0x02, 0x34, 0x26, 0x11, 0x12, 0x50, 0xb4, 0x02, 0xe0, 0x90, 0x10, 0x74, 0xcc, 0x57, 0x01, 0x90, 0x74, 0x01, 0x34, 0x38, 0x01, 0x52, 0x1f, 0x00, 0xb8, 0x29, 0x00, 0xac, 0x0a, 0x02, 0xc2, 0x70,
+  0x11, 0x94, 0x48, 0x0a, 0x01, 0xfc, 0x0d, 0x21, 0x64, 0xb5, 0xc6, 0x74, 0x20, 0xf6, 0x7c, 0x08, 0x07, 0x01, 0x56, 0x2a, 0x01, 0x6c, 0x46, 0x00, 0x98, 0x18, 0x00, 0x5a, 0x07, 0x01, 0x7e, 0x03,
+  0x03, 0x8c, 0x38, 0x11, 0xb5, 0x28, 0x23, 0x02, 0x60, 0x38, 0x00, 0x14, 0x7f, 0x00, 0xea, 0x1b, 0x42, 0x6c, 0x2a, 0x70, 0x43, 0x50, 0x2a, 0x22, 0xf2, 0x5b, 0xdc, 0x11, 0x00, 0x4c, 0x07, 0x02,
+  0xb4, 0xa2, 0x11, 0x33, 0x28, 0x8a, 0x00, 0xb4, 0x18, 0x02, 0xa4, 0x86, 0x00, 0xb6, 0xc2, 0x20, 0x2f, 0x3b, 0x1a, 0xb8, 0x34, 0xcc, 0x32, 0x8c, 0x82, 0x03, 0x00, 0xf2, 0x1b, 0x10, 0x3b, 0x80,
+  0x18, 0x00, 0x2a, 0x07, 0x00, 0x02, 0x00, 0x20, 0x2d, 0x43, 0xc0, 0x94, 0x00, 0xc0, 0x26, 0x00, 0xea, 0x06, 0x40, 0xec, 0x32, 0xed, 0x3a, 0xfc, 0x06, 0x11, 0x4f, 0x18, 0x2e, 0x00, 0xe4, 0x7b,
+  0x40, 0x2e, 0x43, 0x8c, 0x2a, 0xde, 0x06, 0x00, 0x0c, 0x2e, 0x00, 0xee, 0xa2, 0x00, 0x98, 0xa6, 0x00, 0xa4, 0xb4, 0x42, 0x56, 0x85, 0xb4, 0x74, 0xe4, 0xc9, 0x11, 0x6e, 0x46, 0x00, 0x24, 0xec,
+  0x32, 0x62, 0x07, 0x12, 0x6f, 0xac, 0x66, 0x01, 0xac, 0x3f, 0x02, 0x0e, 0x55, 0x11, 0xd5, 0x82, 0x58, 0x02, 0xb4, 0x3f, 0x22, 0x32, 0x64, 0x38, 0x91, 0x11, 0x32, 0x5c, 0x15, 0xa0, 0xec, 0x42,
+  0x8b, 0x3a, 0x8f, 0x5b, 0xaf, 0x5b, 0x8f, 0x53, 0x26, 0x07, 0x17, 0x31, 0x8c, 0x8d, 0x20, 0x12, 0x6c, 0xb2, 0x51, 0x11, 0x74, 0x36, 0x63, 0x11, 0x12, 0x1c, 0x6a, 0x08, 0x7a, 0x7f, 0x00, 0xd0,
+  0x2a, 0x31, 0x4b, 0x32, 0xb0, 0x40, 0x3c, 0x02, 0x9c, 0x7f, 0x04, 0xd0, 0x18, 0x00, 0x9a, 0x03, 0x20, 0x16, 0x8d, 0x66, 0x63, 0x11, 0x53, 0x34, 0xd1, 0x10, 0x33, 0xaa, 0x11, 0x00, 0x96, 0x15,
+  0xc1, 0x84, 0xb5, 0x84, 0xd5, 0x8c, 0x16, 0x8d, 0xb4, 0x84, 0x53, 0x7c, 0x94, 0xc6, 0x31, 0x00, 0x4e, 0x35, 0xe0, 0x15, 0x95, 0xb3, 0x84, 0x11, 0x74, 0x4e, 0x63, 0x4e, 0x63, 0x4d, 0x63, 0xcc,
+  0x52, 0x42, 0xea, 0x20, 0x0d, 0x5b, 0x58, 0x6a, 0x20, 0x2d, 0x63, 0xb4, 0x5f, 0x00, 0x1a, 0x55, 0x31, 0x9a, 0xce, 0xbb, 0xce, 0x1f, 0x00, 0xdc, 0x3f, 0x00, 0xb0, 0x31, 0x00, 0x52, 0x3c, 0x20,
+  0xbb, 0xde, 0xa6, 0x0a, 0x40, 0xcf, 0x7b, 0xf4, 0xa4, 0xe8, 0x7b, 0x02, 0x58, 0x1c, 0x00, 0x76, 0x03, 0x01, 0x30, 0x0e, 0x18, 0x94, 0x8a, 0x03, 0x06, 0x80, 0x03, 0x0f, 0xa6, 0x0a, 0x0c, 0x05,
+  0xf4, 0x11, 0x00, 0x02, 0x00, 0x02, 0x1a, 0xe7, 0x02, 0x98, 0x71, 0x03, 0x4a, 0x35, 0x09, 0x18, 0x07, 0x19, 0xb0, 0x12, 0x6e, 0x15, 0xd0, 0x50, 0x35, 0x22, 0x32, 0xbd, 0x1a, 0x6e, 0x06, 0xe8,
+  0x18, 0x04, 0xd6, 0x18, 0x13, 0x33, 0x86, 0x6a, 0x60, 0xd1, 0xac, 0xcd, 0x8b, 0x32, 0xb5, 0x2c, 0x15, 0x11, 0xd5, 0xaa, 0x11, 0x00, 0xd2, 0x18, 0x00, 0x88, 0x2a, 0x12, 0xb5, 0xe2, 0x58, 0x12,
+  0xbd, 0x8c, 0x03, 0x02, 0xac, 0x4a, 0x00, 0x3e, 0x00, 0x11, 0x36, 0x64, 0x1c, 0x13, 0x36, 0xbe, 0x2a, 0x00, 0x3a, 0x07, 0x00, 0x80, 0x03, 0x00, 0x70, 0x27, 0x00, 0x1e, 0x07, 0x11, 0x77, 0x50,
+  0xf9, 0x01, 0x20, 0xeb, 0x30, 0xe6, 0xb9, 0xe6, 0x94, 0x0e, 0x11, 0xf6, 0xd8, 0x11, 0x22, 0xb1, 0x43, 0x80, 0x26, 0x00, 0x6c, 0x03, 0x11, 0x33, 0x70, 0x23, 0x02, 0x9e, 0x0d, 0x01, 0x9c, 0x42,
+  0x01, 0xba, 0x49, 0x40, 0x16, 0x75, 0x17, 0x7d, 0x5a, 0x03, 0x20, 0x57, 0x7d, 0xa6, 0x29, 0x00, 0x80, 0x23, 0x02, 0x36, 0x26, 0x11, 0x16, 0xc8, 0x49, 0x02, 0xce, 0x1b, 0x22, 0x54, 0x64, 0x22,
+  0xc9, 0x11, 0x74, 0xea, 0x54, 0x02, 0xc8, 0xcc, 0x00, 0x20, 0x27, 0x00, 0xf6, 0x22, 0x01, 0xec, 0x06, 0x00, 0xba, 0x23, 0x01, 0x14, 0x11, 0x00, 0x24, 0x40, 0x00, 0xca, 0x22, 0x60, 0x36, 0x7d,
+  0x57, 0x85, 0x98, 0x8d, 0xb6, 0x82, 0x02, 0xc6, 0x29, 0x00, 0x9e, 0x03, 0x00, 0xe2, 0x09, 0x02, 0x90, 0x11, 0x04, 0x4a, 0x4d, 0x04, 0xb4, 0x06, 0x22, 0xf2, 0x53, 0x6a, 0x2d, 0x00, 0x18, 0xa6,
+  0x00, 0x30, 0x38, 0x00, 0xce, 0x0a, 0x02, 0xf0, 0x49, 0x02, 0x8a, 0x38, 0x02, 0x06, 0x4e, 0x11, 0xd2, 0x24, 0xad, 0x12, 0x2f, 0x2e, 0x4a, 0x21, 0x53, 0xf2, 0x70, 0x1f, 0x04, 0xce, 0x5b, 0x10,
+  0xb5, 0x28, 0x44, 0xb2, 0x8d, 0xb9, 0x95, 0x78, 0x8d, 0x78, 0x8d, 0x17, 0x7d, 0x94, 0x6c, 0x82, 0x0e, 0x11, 0x74, 0x42, 0x23, 0x00, 0x38, 0x2e, 0x20, 0x74, 0x64, 0xa6, 0x0a, 0x20, 0x36, 0x7d,
+  0xee, 0x7b, 0x00, 0x5e, 0x07, 0x02, 0xd6, 0x7b, 0x60, 0x4f, 0x43, 0x4e, 0x43, 0x6e, 0x4b, 0xbc, 0x18, 0x20, 0x2d, 0x43, 0xd6, 0x9b, 0x80, 0x4d, 0x43, 0x2d, 0x43, 0xaf, 0x4b, 0x4d, 0x43, 0x08,
+  0x00, 0x11, 0x8e, 0x18, 0x00, 0x22, 0xcc, 0x32, 0x2e, 0x98, 0x00, 0x74, 0x31, 0x11, 0x52, 0x38, 0xe6, 0x01, 0x7c, 0x5f, 0x32, 0x43, 0x90, 0x53, 0x2e, 0xd1, 0x00, 0x74, 0x15, 0x00, 0xb2, 0x1c,
+  0x02, 0x72, 0x0a, 0x00, 0x14, 0xaa, 0x00, 0x4e, 0x98, 0x13, 0xac, 0xe6, 0x03, 0x00, 0x30, 0x35, 0x00, 0xda, 0x03, 0x22, 0x2e, 0x43, 0x10, 0x83, 0x00, 0x18, 0x07, 0x11, 0xb0, 0xd0, 0x5f, 0x00,
+  0x4c, 0x19, 0x00, 0x30, 0x55, 0x00, 0x7a, 0x58, 0x00, 0x34, 0x35, 0x00, 0x14, 0x00, 0x02, 0x06, 0x5c, 0x01, 0xe0, 0xe2, 0x03, 0xa8, 0xc2, 0x00, 0x52, 0x63, 0x11, 0x52, 0x78, 0xcd, 0x02, 0x8e,
+  0x03, 0x11, 0xf1, 0xe4, 0x06, 0x11, 0x90, 0x6e, 0x23, 0x20, 0xee, 0x42, 0x0a, 0x00, 0x02, 0x5a, 0x2a, 0x10, 0xb4, 0xfe, 0x0d, 0x30, 0x63, 0xd1, 0x63, 0x4e, 0x15, 0x02, 0x76, 0x58, 0x02, 0x92,
+  0x43, 0x00, 0x8e, 0x71, 0x00, 0xba, 0x38, 0x00, 0x56, 0x43, 0xa0, 0x0e, 0x4b, 0x6f, 0x5b, 0x90, 0x63, 0x8c, 0x3a, 0x2f, 0x53, 0xa6, 0x31, 0x01, 0xd0, 0x8d, 0x01, 0x22, 0x07, 0x11, 0xd1, 0xe0,
+  0x3f, 0x01, 0x98, 0xc6, 0x00, 0x18, 0x4e, 0x00, 0x8c, 0xbf, 0xd0, 0x94, 0x73, 0x84, 0x8f, 0x63, 0x2d, 0x53, 0x2d, 0x5b, 0x0d, 0x53, 0x6e, 0x63, 0x04, 0x4e, 0x20, 0x55, 0xa5, 0x60, 0x71, 0x60,
+  0x72, 0x84, 0xaf, 0x6b, 0x72, 0x8c, 0xec, 0xf4, 0x20, 0x71, 0x84, 0xd8, 0x3f, 0x20, 0x14, 0x9d, 0xe0, 0x1f, 0x00, 0x4c, 0x15, 0x40, 0x96, 0xad, 0xb7, 0xb5, 0x3a, 0x35, 0x91, 0x39, 0xc6, 0x76,
+  0xb5, 0x18, 0xc6, 0x35, 0xad, 0x92, 0x1a, 0x07, 0x04, 0x3c, 0x0e, 0x13, 0x72, 0x18, 0x2e, 0x17, 0x72, 0x12, 0x07, 0x06, 0xa8, 0x0a, 0x1e, 0x52, 0xd6, 0x11, 0x0e, 0x9e, 0x03, 0x05, 0xde, 0x11,
+  0x02, 0x8a, 0x15, 0x01, 0xae, 0x0a, 0x0e, 0xa6, 0x0a, 0x0b, 0x02, 0x00, 0x00, 0xc2, 0x11, 0x00, 0xb0, 0x2a, 0x00, 0x04, 0x00, 0x02, 0x3e, 0x75, 0x02, 0xce, 0x11, 0x02, 0x90, 0x03, 0x02, 0x5e,
+  0x35, 0x22, 0x12, 0xb5, 0x86, 0x43, 0x40, 0xf2, 0xac, 0xb4, 0xc5, 0x82, 0x03, 0x20, 0x2f, 0x94, 0x98, 0x31, 0x11, 0xd5, 0xba, 0x71, 0x22, 0xb1, 0xa4, 0x4a, 0x0e, 0x00, 0x5c, 0x15, 0x13, 0xb4,
+  0x86, 0x1c, 0x02, 0xb8, 0x23, 0x60, 0x36, 0xd6, 0x74, 0xbd, 0x57, 0xde, 0xc6, 0x31, 0x00, 0x0e, 0x40, 0x60, 0x67, 0x5a, 0x6f, 0x9c, 0xcd, 0x8b, 0x4a, 0x4e, 0x15, 0x16, 0xe2, 0x31, 0x20, 0x36,
+  0xd6, 0xb8, 0x2a, 0x02, 0x56, 0xf9, 0x20, 0xd5, 0xc5, 0x7c, 0x1c, 0x20, 0xf9, 0xee, 0xb0, 0x03, 0x00, 0x84, 0x11, 0x20, 0x13, 0x54, 0x48, 0x70, 0x04, 0x5c, 0x46, 0x11, 0x54, 0xb4, 0xd3, 0x04,
+  0xde, 0x09, 0x01, 0x56, 0x15, 0x10, 0x6c, 0x58, 0x11, 0x04, 0xa0, 0x70, 0x11, 0xb5, 0x18, 0xd7, 0x02, 0x1c, 0x7b, 0x12, 0xd1, 0xac, 0x1f, 0x03, 0xe8, 0x7e, 0x11, 0x12, 0xa4, 0x82, 0x11, 0x90,
+  0x42, 0x18, 0x02, 0x48, 0xa9, 0x11, 0x95, 0x22, 0x2a, 0x01, 0x06, 0x07, 0x01, 0x78, 0x46, 0x00, 0x04, 0x0a, 0x42, 0x74, 0x64, 0xf5, 0x74, 0xa6, 0xec, 0x01, 0x82, 0xfe, 0x05, 0xcc, 0x42, 0x22,
+  0x53, 0x64, 0x3a, 0xbb, 0x11, 0x74, 0x74, 0x1f, 0x02, 0x02, 0x00, 0x02, 0x7a, 0x62, 0x11, 0x33, 0x6a, 0x00, 0x11, 0x70, 0x18, 0x46, 0x00, 0xc2, 0x06, 0x13, 0xb4, 0xd2, 0x1c, 0x01, 0xb6, 0x62,
+  0x01, 0x50, 0x1c, 0x11, 0x13, 0x16, 0x78, 0x01, 0x0a, 0x4e, 0x30, 0x6c, 0x78, 0x85, 0x2e, 0x04, 0x20, 0xf6, 0x7c, 0x7e, 0x94, 0x02, 0x86, 0x4a, 0x00, 0xfc, 0x06, 0x00, 0x64, 0x38, 0x11, 0x90,
+  0x22, 0x2a, 0x00, 0xcc, 0x1c, 0x11, 0xcd, 0x04, 0x00, 0x00, 0x58, 0x1c, 0x10, 0x0e, 0x34, 0x55, 0x30, 0x32, 0xee, 0x32, 0x2a, 0x55, 0x01, 0xd0, 0x1c, 0x01, 0xae, 0xc9, 0x02, 0xbc, 0xc2, 0x20,
+  0x12, 0x5c, 0x82, 0xe9, 0x31, 0x31, 0x64, 0x31, 0x08, 0x0e, 0x11, 0xaf, 0x42, 0x0e, 0x40, 0xd0, 0x53, 0xcf, 0x53, 0x12, 0x00, 0x20, 0x4e, 0x43, 0x12, 0x00, 0x11, 0x52, 0x34, 0x9f, 0x02, 0xfc,
+  0x62, 0x20, 0x90, 0x53, 0xa4, 0x94, 0x00, 0x78, 0x7f, 0x02, 0x86, 0x15, 0x71, 0x94, 0x6c, 0x37, 0x85, 0x36, 0x85, 0x73, 0x8a, 0x7f, 0x00, 0xa2, 0x03, 0x00, 0x42, 0x35, 0x00, 0xee, 0x66, 0x02,
+  0x2c, 0x3c, 0x02, 0x2c, 0x27, 0x02, 0xee, 0xbb, 0x00, 0x2c, 0x43, 0x30, 0xad, 0x32, 0x4f, 0xea, 0x1c, 0x05, 0x70, 0x35, 0x00, 0x9c, 0x86, 0x00, 0xe4, 0x03, 0x02, 0xee, 0x6d, 0x00, 0xbe, 0x5f,
+  0x12, 0xf2, 0xe4, 0x46, 0x21, 0x6c, 0xd0, 0xb2, 0xad, 0x22, 0x31, 0x6c, 0x72, 0x66, 0x00, 0x72, 0x23, 0x40, 0xed, 0x42, 0xcc, 0x42, 0x58, 0x2a, 0x00, 0xb0, 0x03, 0x00, 0xc6, 0x18, 0x11, 0x53,
+  0x22, 0x55, 0x10, 0xf6, 0x5e, 0x23, 0x21, 0x74, 0xb5, 0x56, 0x91, 0x11, 0x4f, 0x3a, 0x6a, 0x02, 0xea, 0x26, 0x02, 0x42, 0xaa, 0x02, 0x9e, 0x5f, 0x04, 0x44, 0x8a, 0x11, 0xb1, 0x60, 0x1c, 0x00,
+  0xc8, 0x11, 0xc0, 0x16, 0x95, 0x36, 0x95, 0x12, 0x6c, 0x94, 0x84, 0xd1, 0x63, 0x53, 0x7c, 0xac, 0x11, 0x21, 0x53, 0x7c, 0x60, 0xd8, 0x00, 0x82, 0x43, 0x10, 0x73, 0x50, 0xf1, 0x20, 0x8f, 0x63,
+  0x30, 0x83, 0xc0, 0xab, 0x4a, 0x4e, 0x63, 0xaf, 0x6b, 0xae, 0x6b, 0x10, 0x7c, 0xd3, 0x94, 0x84, 0x9f, 0x80, 0xd3, 0x94, 0x55, 0xa5, 0xf0, 0x7b, 0xf4, 0x9c, 0xca, 0x3f, 0x00, 0x50, 0x23, 0x80,
+  0xd7, 0xbd, 0x55, 0xad, 0xd7, 0xbd, 0xd7, 0xb5, 0x88, 0x03, 0x20, 0x18, 0xbe, 0x1c, 0x07, 0x40, 0x9b, 0xd6, 0xf4, 0x9c, 0x82, 0x23, 0x40, 0x35, 0xad, 0x96, 0xb5, 0xcc, 0x11, 0x11, 0x72, 0xaa,
+  0x0a, 0x00, 0x2c, 0x27, 0x11, 0x52, 0xea, 0x3f, 0x02, 0x4e, 0x2e, 0x15, 0x72, 0x8c, 0x03, 0x0a, 0x98, 0x03, 0x04, 0x02, 0x00, 0x19, 0x52, 0x0c, 0x00, 0x06, 0x2c, 0x00, 0x03, 0x36, 0x27, 0x02,
+  0x8c, 0x23, 0x01, 0xea, 0x86, 0x31, 0x71, 0x9c, 0xb1, 0x1e, 0x07, 0x18, 0xd0, 0xc6, 0x11, 0x0e, 0x90, 0x03, 0x01, 0x88, 0x43, 0x00, 0x68, 0x5c, 0x02, 0x6e, 0x5c, 0x02, 0x60, 0x15, 0x26, 0xf1,
+  0xac, 0x1e, 0x07, 0x22, 0x90, 0xa4, 0x0c, 0x20, 0x20, 0xd5, 0xcd, 0xa4, 0x03, 0x00, 0x0a, 0x2e, 0x02, 0xb2, 0x31, 0x00, 0x0c, 0x00, 0x02, 0x1c, 0x2e, 0x11, 0xb5, 0xec, 0x18, 0x00, 0x46, 0x1c,
+  0x20, 0x16, 0xce, 0xa0, 0x11, 0x02, 0x22, 0x0e, 0xa0, 0x98, 0xe6, 0xb5, 0xc5, 0x2f, 0x94, 0x90, 0xa4, 0xac, 0x83, 0xdc, 0x18, 0x60, 0xb8, 0xe6, 0xd9, 0xee, 0x78, 0xde, 0xaa, 0x23, 0x40, 0x37,
+  0xd6, 0xb4, 0xc5, 0xa8, 0x03, 0x13, 0x16, 0xae, 0x43, 0x11, 0x36, 0xd6, 0xf5, 0x00, 0x0e, 0xcb, 0x00, 0x7a, 0x20, 0x31, 0x36, 0xd6, 0x95, 0x9e, 0x23, 0x04, 0x7e, 0xac, 0x11, 0xd5, 0xd2, 0x51,
+  0x22, 0x95, 0x6c, 0x18, 0x18, 0x00, 0x5c, 0x03, 0x00, 0xe6, 0x29, 0x00, 0x2e, 0x14, 0x04, 0xc8, 0x9a, 0x00, 0x12, 0x7b, 0x00, 0xf8, 0x45, 0x40, 0xb9, 0x95, 0x37, 0x85, 0xb2, 0x06, 0x71, 0x16,
+  0x7d, 0x99, 0x8d, 0x37, 0x7d, 0xd5, 0xaa, 0x0d, 0x02, 0x0e, 0xbb, 0x01, 0x5a, 0xc2, 0x03, 0xc8, 0x3b, 0x10, 0xd2, 0x24, 0x11, 0x01, 0x44, 0xc2, 0x40, 0xcd, 0x32, 0x4b, 0x1a, 0x96, 0xc5, 0x00,
+  0xb8, 0x1f, 0x00, 0x16, 0x18, 0x00, 0xf8, 0x02, 0x00, 0x32, 0x11, 0x01, 0x52, 0x19, 0x01, 0x3e, 0x3f, 0x00, 0x76, 0x07, 0x00, 0x74, 0x07, 0x11, 0x94, 0x1a, 0x1c, 0x00, 0x88, 0x3b, 0x00, 0xf2,
+  0x2d, 0x04, 0xf2, 0xa5, 0x02, 0xe2, 0xa5, 0x10, 0x90, 0x1e, 0x11, 0x03, 0x30, 0x8a, 0x02, 0xa4, 0x62, 0x11, 0xd1, 0x92, 0x47, 0x00, 0xdc, 0x89, 0x00, 0x6c, 0x3f, 0x01, 0xc6, 0x69, 0x10, 0x53,
+  0x4a, 0x66, 0x01, 0x72, 0x9b, 0x00, 0x22, 0x12, 0x30, 0x7c, 0x74, 0x6c, 0x26, 0x0e, 0x00, 0xba, 0x4d, 0x01, 0xbc, 0x54, 0x01, 0x06, 0x07, 0x20, 0x74, 0x6c, 0xda, 0xd7, 0x10, 0x4f, 0x82, 0x3f,
+  0x01, 0x84, 0x00, 0x02, 0x34, 0x9f, 0x00, 0x6c, 0x00, 0x50, 0xb4, 0x6c, 0x36, 0x7d, 0x94, 0x38, 0x86, 0x01, 0xc4, 0xc9, 0x02, 0xce, 0x0d, 0x00, 0x7c, 0x03, 0x11, 0x4e, 0x2a, 0x23, 0x20, 0x6e,
+  0x43, 0xa2, 0x18, 0xc2, 0xaf, 0x53, 0xf0, 0x5b, 0x72, 0x6c, 0x35, 0x85, 0xd5, 0x7c, 0xd4, 0x74, 0x76, 0x38, 0x00, 0x3e, 0x03, 0x00, 0x42, 0x15, 0x11, 0x33, 0x04, 0xb1, 0x04, 0x64, 0x1c, 0x00,
+  0x30, 0xb1, 0x20, 0x6b, 0x2a, 0x48, 0x0e, 0x02, 0xfa, 0x89, 0x00, 0xd6, 0x46, 0x60, 0x0e, 0x3b, 0x50, 0x4b, 0x90, 0x53, 0x4e, 0x91, 0x00, 0x16, 0x40, 0xb1, 0xee, 0x3a, 0xce, 0x3a, 0x8d, 0x32,
+  0xad, 0x32, 0x0f, 0x43, 0x50, 0xe4, 0x46, 0x10, 0xd1, 0xf4, 0x46, 0x22, 0x6c, 0xf2, 0xb2, 0x66, 0x10, 0x53, 0x3c, 0x63, 0x31, 0xb1, 0x5b, 0x2f, 0x74, 0x4a, 0x20, 0x0e, 0x43, 0xfc, 0x46, 0x00,
+  0xe6, 0x7b, 0x00, 0xbc, 0xad, 0xc4, 0x8b, 0x32, 0x2a, 0x2a, 0xc8, 0x19, 0x8b, 0x32, 0x4a, 0x2a, 0x6b, 0x32, 0x34, 0x6a, 0x42, 0x4f, 0x53, 0x2e, 0x4b, 0x54, 0x5c, 0x00, 0x6e, 0x43, 0x00, 0x46,
+  0x15, 0x00, 0xb6, 0x0a, 0x00, 0xe0, 0x74, 0x00, 0x8a, 0x03, 0x00, 0x4a, 0x23, 0x00, 0x40, 0x07, 0x13, 0x33, 0x46, 0x8a, 0x10, 0xb4, 0xd2, 0x38, 0x00, 0x86, 0x98, 0x21, 0x7c, 0x32, 0x3e, 0x0e,
+  0x00, 0x64, 0x3c, 0x30, 0xb1, 0x63, 0x32, 0xc6, 0x58, 0x50, 0x63, 0x6f, 0x5b, 0xd1, 0x63, 0xd6, 0x11, 0x10, 0x0e, 0x6c, 0x35, 0x90, 0x63, 0xb0, 0x6b, 0x2e, 0x5b, 0xcd, 0x4a, 0x4e, 0x5b, 0x02,
+  0x00, 0x80, 0x0d, 0x53, 0x2d, 0x5b, 0x8f, 0x63, 0xf0, 0x73, 0xee, 0x26, 0xa0, 0xb2, 0x8c, 0xd3, 0x94, 0xb3, 0x8c, 0x31, 0x84, 0x4d, 0x63, 0x62, 0x4a, 0x00, 0x10, 0x07, 0x11, 0xd3, 0xc2, 0x1f,
+  0x20, 0x55, 0xad, 0xd2, 0x18, 0x11, 0x38, 0x9e, 0x0a, 0x20, 0xf8, 0xbd, 0x4a, 0x3c, 0x20, 0xd8, 0xbd, 0x02, 0x00, 0xc4, 0xbb, 0xde, 0xbb, 0xd6, 0x96, 0xb5, 0x56, 0xad, 0xf8, 0xbd, 0x72, 0x94,
+  0x18, 0x07, 0x11, 0x31, 0x70, 0x43, 0x28, 0x52, 0x84, 0x20, 0x0e, 0x03, 0xd2, 0x11, 0x01, 0x6c, 0x03, 0x00, 0x24, 0x47, 0x08, 0x62, 0x15, 0x1e, 0x52, 0x1c, 0x07, 0x03, 0x12, 0x27, 0x13, 0xd4,
+  0x14, 0xe7, 0x13, 0x93, 0x90, 0x03, 0x17, 0x91, 0xae, 0x0a, 0x15, 0xb0, 0x34, 0x0e, 0x17, 0xf1, 0x8a, 0x03, 0x03, 0x0a, 0x00, 0x21, 0xb4, 0xd0, 0xe8, 0x18, 0x02, 0x4e, 0x55, 0x00, 0x38, 0x75,
+  0x02, 0x36, 0x0e, 0x01, 0x6a, 0x55, 0x01, 0x36, 0x8e, 0x02, 0x9e, 0x03, 0x02, 0xce, 0x11, 0x00, 0xc6, 0x11, 0x40, 0x32, 0xb5, 0x0e, 0x94, 0x80, 0x0a, 0x00, 0x44, 0x2e, 0x31, 0xb0, 0xa4, 0x53,
+  0xf2, 0x18, 0x03, 0xe6, 0x78, 0x10, 0xc5, 0xb2, 0x31, 0x20, 0xb1, 0xa4, 0x0c, 0x07, 0x20, 0xee, 0x8b, 0x56, 0x15, 0x20, 0xb8, 0xe6, 0x94, 0x63, 0x00, 0xf4, 0x18, 0x00, 0x44, 0x00, 0x00, 0x4a,
+  0x15, 0x02, 0x34, 0x27, 0x02, 0xca, 0x11, 0x11, 0x77, 0xac, 0x0a, 0x60, 0x78, 0xde, 0x32, 0xb5, 0xb5, 0xc5, 0xc2, 0x03, 0x60, 0xd9, 0xe6, 0x98, 0xe6, 0xee, 0x2a, 0xce, 0x62, 0x01, 0x1e, 0xf0,
+  0x01, 0xce, 0x18, 0x00, 0x86, 0xfe, 0x00, 0x3a, 0x2a, 0x00, 0xba, 0x49, 0x42, 0x8c, 0x22, 0xee, 0x32, 0x44, 0xbe, 0x10, 0x6f, 0xc8, 0x53, 0x10, 0x43, 0xca, 0xac, 0x01, 0x78, 0x85, 0x00, 0x5c,
+  0x97, 0x01, 0x0a, 0xa9, 0x00, 0x6e, 0x03, 0x00, 0xc6, 0x1f, 0x00, 0xa0, 0x29, 0x02, 0xa4, 0x89, 0x02, 0x32, 0x20, 0x02, 0x24, 0x7f, 0x22, 0x70, 0x43, 0xa4, 0x2a, 0x02, 0xd6, 0x65, 0x00, 0xfe,
+  0x85, 0x02, 0x46, 0xd0, 0x02, 0x36, 0xd0, 0x02, 0x42, 0xad, 0x00, 0x44, 0x00, 0x00, 0xd8, 0x14, 0x02, 0x2e, 0x7f, 0x00, 0x7c, 0x62, 0x01, 0xa8, 0x06, 0x11, 0x32, 0xca, 0xec, 0x10, 0x4b, 0x08,
+  0x00, 0x00, 0xde, 0x3f, 0x00, 0x08, 0x00, 0x00, 0xf4, 0xa5, 0x02, 0xbc, 0x06, 0x00, 0x02, 0x0b, 0x01, 0x50, 0x4d, 0x01, 0x42, 0x55, 0x00, 0x64, 0x0e, 0x13, 0x54, 0x3c, 0x98, 0x00, 0x0e, 0x00,
+  0x00, 0x9a, 0x03, 0x02, 0x24, 0x91, 0x40, 0x73, 0x6c, 0x13, 0x64, 0xac, 0x4d, 0x31, 0x2f, 0x43, 0x91, 0x04, 0x27, 0x21, 0x2f, 0x43, 0xd2, 0xf7, 0x52, 0x2a, 0x2a, 0x1a, 0xed, 0x3a, 0xf6, 0x14,
+  0x04, 0x20, 0x07, 0x11, 0x6f, 0xac, 0xe2, 0x11, 0x12, 0xce, 0xc2, 0x00, 0x30, 0x04, 0x02, 0x72, 0x00, 0x10, 0x6f, 0x34, 0x1c, 0x70, 0x43, 0xcc, 0x32, 0x6b, 0x2a, 0x6b, 0x22, 0x2a, 0x23, 0x10,
+  0x2e, 0xbc, 0x94, 0x30, 0x32, 0x8b, 0x2a, 0x6c, 0x1c, 0x00, 0x48, 0x1c, 0x40, 0x0a, 0x1a, 0x4a, 0x22, 0x50, 0x86, 0x60, 0xad, 0x32, 0x0a, 0x22, 0xac, 0x32, 0x90, 0x58, 0x02, 0x52, 0x51, 0x00,
+  0x28, 0x27, 0x00, 0x10, 0x6a, 0x20, 0xd1, 0x53, 0xf0, 0x1f, 0x02, 0xac, 0x0a, 0x00, 0x3e, 0x83, 0x70, 0x8c, 0x32, 0x12, 0x64, 0xf6, 0x7c, 0x91, 0xae, 0x91, 0x01, 0xa2, 0x58, 0x00, 0x94, 0x03,
+  0x20, 0x13, 0x64, 0xec, 0x0d, 0x00, 0xae, 0x4a, 0x11, 0xd6, 0x62, 0x9f, 0x01, 0xa6, 0x0a, 0x21, 0x42, 0x70, 0x9e, 0x58, 0x40, 0x12, 0x64, 0xb5, 0x7c, 0x40, 0x0e, 0x80, 0x37, 0x8d, 0xb8, 0x9d,
+  0xd9, 0xa5, 0xf5, 0x84, 0x42, 0x71, 0x00, 0x62, 0x66, 0x22, 0x15, 0x85, 0x46, 0x43, 0x02, 0xdc, 0x5b, 0x51, 0x74, 0x74, 0x73, 0x74, 0xf2, 0x54, 0x43, 0x02, 0xdc, 0x18, 0x00, 0x06, 0x0e, 0x10,
+  0xb1, 0x22, 0x35, 0x10, 0x6c, 0x74, 0x5c, 0x02, 0x26, 0x15, 0x31, 0xd1, 0x63, 0x33, 0x76, 0x78, 0x00, 0xae, 0x38, 0x11, 0xb0, 0x2a, 0xaa, 0x20, 0x2f, 0x53, 0x72, 0x2a, 0x00, 0x38, 0x07, 0x00,
+  0x78, 0x55, 0x20, 0xcd, 0x42, 0x98, 0x51, 0x00, 0xbe, 0x5f, 0x00, 0x20, 0x27, 0x11, 0x53, 0xe6, 0x1f, 0x11, 0x94, 0x2e, 0x0e, 0x11, 0x52, 0xae, 0x6d, 0x00, 0x7e, 0x2a, 0x10, 0x72, 0xee, 0x26,
+  0xb0, 0x74, 0x52, 0x84, 0x6e, 0x63, 0xec, 0x52, 0xb2, 0x8c, 0x35, 0xa5, 0x24, 0x0e, 0xe0, 0x30, 0x84, 0x34, 0x9d, 0xb7, 0xb5, 0xd3, 0x9c, 0xd7, 0xb5, 0x92, 0x8c, 0x76, 0xad, 0x8c, 0x51, 0x02,
+  0x90, 0x03, 0xb1, 0x72, 0x8c, 0x14, 0xa5, 0x96, 0xb5, 0x96, 0xb5, 0xb7, 0xbd, 0xb7, 0xfe, 0x1f, 0xe0, 0x14, 0xa5, 0x55, 0xad, 0x55, 0xad, 0x52, 0x8c, 0x56, 0xad, 0x55, 0xad, 0xd4, 0x9c, 0xce,
+  0x58, 0x20, 0x10, 0x84, 0xa8, 0x66, 0x00, 0x2a, 0x4e, 0x02, 0x48, 0x35, 0x14, 0x51, 0x2e, 0x4e, 0x05, 0x9a, 0x03, 0x14, 0x52, 0xde, 0x38, 0x0d, 0x80, 0x03, 0x00, 0x4a, 0x5c, 0x0a, 0x02, 0x00,
+  0x04, 0x1a, 0x27, 0x03, 0x3a, 0xee, 0x00, 0x2e, 0x75, 0x01, 0xfc, 0x3f, 0x1b, 0xd1, 0x66, 0x3c, 0x02, 0x68, 0x1c, 0x0a, 0x06, 0x20, 0x11, 0x11, 0x22, 0x27, 0x02, 0x7c, 0x1c, 0x06, 0x9a, 0x23,
+  0x02, 0x46, 0x0e, 0x02, 0xc4, 0x78, 0x00, 0x00, 0x2e, 0x02, 0x0a, 0x27, 0x20, 0x73, 0xbd, 0x1a, 0x07, 0x00, 0x24, 0x07, 0x02, 0xb2, 0x0a, 0x00, 0x86, 0xbc, 0x06, 0x96, 0x63, 0x02, 0x7a, 0x1c,
+  0x40, 0xd5, 0xcd, 0x98, 0xe6, 0x50, 0xc7, 0x20, 0xd5, 0xcd, 0xd6, 0x51, 0x00, 0xde, 0x03, 0x02, 0x4e, 0x15, 0x01, 0xae, 0x4a, 0x11, 0xd6, 0x3e, 0x2e, 0x12, 0xe6, 0x46, 0x07, 0x20, 0x36, 0xd6,
+  0xde, 0x0a, 0x22, 0xf1, 0xac, 0xe8, 0x03, 0x00, 0xfe, 0x71, 0x20, 0xd1, 0xa4, 0x02, 0x35, 0x00, 0x26, 0xc9, 0x01, 0x0e, 0x43, 0x03, 0x44, 0x3c, 0x04, 0x48, 0x82, 0x10, 0x70, 0x06, 0x40, 0x00,
+  0x4a, 0xd0, 0x01, 0x84, 0x23, 0x23, 0x2f, 0x3b, 0x0a, 0xe9, 0x10, 0x5b, 0x50, 0xb0, 0x21, 0x8c, 0x2a, 0x98, 0x34, 0x03, 0xd6, 0x11, 0x01, 0x52, 0x5f, 0x01, 0x2a, 0x7b, 0x01, 0x38, 0x38, 0x00,
+  0xc6, 0x3e, 0x01, 0x30, 0x35, 0x00, 0xe6, 0x0a, 0x00, 0x36, 0x18, 0x00, 0x9c, 0x0a, 0x00, 0x28, 0x26, 0x00, 0xec, 0x2d, 0x00, 0xd2, 0x46, 0x20, 0x93, 0x6c, 0x24, 0xd7, 0x00, 0xac, 0x0d, 0x00,
+  0x64, 0xd0, 0x04, 0xd0, 0xec, 0x11, 0x32, 0xc8, 0x57, 0x02, 0x62, 0xf7, 0x02, 0x32, 0xbb, 0x02, 0x1c, 0x2e, 0x13, 0xd1, 0xf2, 0xec, 0x02, 0x28, 0xbf, 0x20, 0x33, 0x64, 0x52, 0x07, 0x02, 0x60,
+  0x6d, 0x00, 0xc6, 0x3b, 0x11, 0x70, 0x96, 0x6d, 0x00, 0x14, 0xc6, 0x31, 0xf1, 0x53, 0xf6, 0xd2, 0x90, 0x00, 0x96, 0xb7, 0x00, 0x58, 0x94, 0x00, 0x2a, 0x3f, 0x80, 0x57, 0x8d, 0x98, 0x95, 0x57,
+  0x8d, 0xb4, 0x74, 0x0a, 0x00, 0x02, 0x6a, 0xe2, 0x11, 0x73, 0x3e, 0x31, 0x02, 0x48, 0x66, 0x04, 0xa6, 0xa2, 0x01, 0x10, 0x91, 0x20, 0x53, 0x70, 0x8e, 0x9b, 0x03, 0x06, 0xdf, 0x00, 0x72, 0x04,
+  0x02, 0x90, 0x07, 0x02, 0x54, 0xa6, 0x11, 0x90, 0xf2, 0x14, 0x00, 0xf6, 0x97, 0x02, 0xee, 0xf7, 0x01, 0xd6, 0x1f, 0x01, 0x9c, 0xdb, 0x12, 0x8f, 0x0c, 0x91, 0x01, 0xca, 0x1f, 0x11, 0x32, 0x10,
+  0x55, 0x02, 0xf2, 0xe2, 0x02, 0x5c, 0x15, 0x13, 0xac, 0xec, 0x66, 0x20, 0x4f, 0x4b, 0xd0, 0x38, 0x01, 0x90, 0x71, 0x12, 0x4b, 0xee, 0x1f, 0x21, 0x2f, 0x43, 0xa0, 0x07, 0x10, 0x63, 0xf8, 0x46,
+  0x91, 0x70, 0x53, 0xf2, 0x63, 0x33, 0x6c, 0x54, 0x74, 0xb5, 0x7e, 0x03, 0x42, 0x37, 0x8d, 0x57, 0x95, 0x1c, 0x63, 0x33, 0xf2, 0x63, 0x90, 0xa6, 0x58, 0x40, 0x8b, 0x32, 0xed, 0x42, 0x1c, 0x07,
+  0x00, 0x64, 0x1c, 0x00, 0x90, 0x66, 0x41, 0x56, 0x95, 0xd5, 0x84, 0x1c, 0x0e, 0x01, 0xd2, 0x1f, 0x00, 0x0a, 0xa3, 0x11, 0xb5, 0x6a, 0x98, 0x00, 0x84, 0x11, 0x00, 0x5a, 0x1c, 0x31, 0x95, 0x7c,
+  0xb5, 0xd6, 0x5f, 0x00, 0x40, 0x3c, 0x00, 0xc6, 0x6d, 0x13, 0xd5, 0x40, 0x8a, 0x00, 0x9c, 0x0a, 0x10, 0x53, 0xc6, 0x0a, 0x10, 0x6b, 0x5a, 0x00, 0x20, 0x70, 0x5b, 0x2c, 0x00, 0x20, 0xb5, 0x84,
+  0x3e, 0x83, 0x80, 0xb1, 0x63, 0x2e, 0x53, 0x6b, 0x3a, 0x8c, 0x42, 0xda, 0x31, 0x40, 0xd0, 0x6b, 0x11, 0x74, 0x94, 0x6d, 0x20, 0x32, 0x7c, 0xa2, 0x0a, 0x20, 0xf0, 0x6b, 0x96, 0x03, 0x00, 0x7a,
+  0x2a, 0x80, 0x6e, 0x63, 0x49, 0x42, 0x35, 0xa5, 0xd7, 0xb5, 0x42, 0x1c, 0x20, 0xf7, 0xbd, 0x82, 0x2a, 0x00, 0x84, 0x2a, 0x00, 0x70, 0x03, 0x80, 0x14, 0xa5, 0x35, 0xa5, 0xf8, 0xc5, 0x55, 0xad,
+  0x84, 0x03, 0xf0, 0x07, 0x39, 0xce, 0x39, 0xce, 0xd7, 0xbd, 0x59, 0xce, 0x96, 0xb5, 0x75, 0xb5, 0xb6, 0xbd, 0x75, 0xad, 0x91, 0x94, 0x38, 0xc6, 0xd3, 0x9c, 0x56, 0x3c, 0x31, 0xaf, 0x7b, 0x31,
+  0xaa, 0x0a, 0x00, 0x78, 0x11, 0x04, 0x24, 0x2e, 0x22, 0x51, 0x84, 0x02, 0x00, 0x08, 0x06, 0x07, 0x06, 0x54, 0x15, 0x08, 0xea, 0x1f, 0x00, 0x02, 0x00, 0x1b, 0x94, 0x84, 0x03, 0x07, 0xa6, 0x2a,
+  0x05, 0x7c, 0x63, 0x13, 0xb3, 0xe0, 0x38, 0x11, 0x70, 0xb4, 0x0a, 0x06, 0xba, 0x31, 0x02, 0x1a, 0x27, 0x0a, 0xae, 0x0a, 0x20, 0xd0, 0xac, 0x18, 0x07, 0x04, 0x2a, 0x6e, 0x00, 0x54, 0x07, 0x11,
+  0x32, 0x46, 0x95, 0x04, 0x16, 0x07, 0x02, 0x94, 0x03, 0x00, 0xb6, 0x31, 0x22, 0x6f, 0x9c, 0x94, 0x03, 0x00, 0x1c, 0x4e, 0x11, 0xb4, 0x88, 0x63, 0x02, 0x30, 0x0e, 0x02, 0xfe, 0x46, 0x02, 0x64,
+  0x2e, 0x00, 0x00, 0x07, 0x00, 0x26, 0x07, 0x20, 0x77, 0xde, 0x86, 0x1c, 0x02, 0xcc, 0x18, 0x00, 0xde, 0x0a, 0x00, 0x8a, 0x03, 0x02, 0x8a, 0x3c, 0x22, 0x16, 0xce, 0xfe, 0x58, 0x11, 0x78, 0xce,
+  0x11, 0x20, 0xd9, 0xee, 0x7e, 0x47, 0x21, 0xfa, 0xee, 0x32, 0x20, 0x01, 0xe2, 0xdc, 0x01, 0xb8, 0x78, 0x11, 0x4b, 0x4c, 0x4a, 0x01, 0x24, 0x18, 0x01, 0x28, 0x26, 0x01, 0x82, 0x70, 0x00, 0x02,
+  0x2d, 0x01, 0xa4, 0x38, 0x01, 0x5c, 0x62, 0x00, 0x04, 0x0e, 0x20, 0xf1, 0x53, 0xf0, 0x77, 0x11, 0x2f, 0x1e, 0xf7, 0x11, 0x74, 0x40, 0x4d, 0x00, 0xd0, 0x11, 0x00, 0xf0, 0x0d, 0x04, 0x2a, 0x00,
+  0x00, 0x92, 0x62, 0x02, 0xb8, 0x26, 0x02, 0xee, 0x51, 0x00, 0x3a, 0x00, 0x00, 0xd0, 0x85, 0x00, 0x6a, 0x2d, 0x00, 0xa8, 0xe5, 0x02, 0x6a, 0xa2, 0x04, 0x4e, 0xa9, 0x00, 0x92, 0xa9, 0x00, 0x6a,
+  0x03, 0x10, 0xd5, 0x26, 0x03, 0x01, 0xf8, 0xda, 0x00, 0x0e, 0x15, 0x02, 0x2e, 0x66, 0x02, 0xac, 0x90, 0x02, 0xe0, 0xa5, 0x20, 0x32, 0x5c, 0x68, 0x7b, 0x00, 0x50, 0x2a, 0x01, 0xf6, 0x57, 0x03,
+  0x3e, 0x8d, 0x24, 0xf2, 0x5b, 0x3a, 0x35, 0x11, 0xd1, 0x8a, 0x62, 0x01, 0xae, 0xfe, 0x01, 0x38, 0x1f, 0x11, 0x0e, 0x08, 0x03, 0x00, 0xca, 0xb7, 0x02, 0xb2, 0xb7, 0x02, 0x54, 0xc9, 0x02, 0x76,
+  0x11, 0x02, 0x42, 0x9b, 0x00, 0xc6, 0xfe, 0x02, 0xc2, 0xd7, 0x11, 0x53, 0x44, 0x03, 0x02, 0x72, 0x8d, 0x02, 0xe8, 0xb0, 0x10, 0xd1, 0xc8, 0x07, 0x01, 0xb4, 0x18, 0x01, 0x78, 0x98, 0x01, 0xa6,
+  0xc9, 0x02, 0xc2, 0xa9, 0x00, 0x3c, 0x4a, 0x00, 0xa2, 0x74, 0x02, 0xe0, 0xd0, 0x11, 0x8f, 0x6e, 0x2a, 0x42, 0x11, 0x5c, 0x73, 0x6c, 0x8e, 0x8d, 0x11, 0x53, 0x56, 0xc6, 0x02, 0x58, 0x63, 0x20,
+  0x12, 0x5c, 0x94, 0xb4, 0x01, 0xa6, 0x0a, 0x12, 0x6c, 0xb0, 0xdb, 0x00, 0x34, 0x0e, 0x00, 0xf0, 0x0e, 0x00, 0x44, 0x0e, 0x00, 0x6c, 0x58, 0x42, 0x74, 0x74, 0x74, 0x6c, 0x08, 0x40, 0x02, 0x82,
+  0x7f, 0x50, 0xb5, 0x7c, 0xb5, 0x7c, 0x74, 0x58, 0x38, 0x00, 0xd0, 0x06, 0x01, 0xe8, 0x06, 0x31, 0xb5, 0x7c, 0x33, 0xa2, 0x86, 0x02, 0xa2, 0xad, 0x60, 0x56, 0x8d, 0xf9, 0xa5, 0x97, 0x95, 0x40,
+  0xc6, 0x01, 0xda, 0xe9, 0x01, 0xee, 0x54, 0x02, 0xe4, 0xbb, 0x11, 0xd1, 0x08, 0xb1, 0x11, 0xb1, 0x3e, 0x83, 0x31, 0xb1, 0x5b, 0xb1, 0x0a, 0x07, 0x00, 0x36, 0x1c, 0x20, 0xd2, 0x63, 0x1a, 0x07,
+  0x00, 0x36, 0x1c, 0x00, 0x04, 0x20, 0x20, 0xee, 0x4a, 0x50, 0x35, 0x22, 0xd1, 0x63, 0xbe, 0xdb, 0x00, 0xa2, 0x31, 0x91, 0x57, 0x95, 0x16, 0x8d, 0x36, 0x95, 0x53, 0x74, 0x4f, 0x4a, 0x27, 0x22,
+  0xcd, 0x42, 0xd0, 0x46, 0x40, 0x52, 0x7c, 0xf1, 0x73, 0xb6, 0xd4, 0x11, 0x52, 0x7e, 0x03, 0x51, 0x8f, 0x63, 0x71, 0x7c, 0x10, 0xfc, 0x4d, 0x20, 0x6e, 0x63, 0x04, 0x00, 0x60, 0x6a, 0x42, 0x0c,
+  0x5b, 0x11, 0x7c, 0x8c, 0x58, 0x00, 0x20, 0x0e, 0x11, 0x18, 0x12, 0x35, 0xf0, 0x13, 0x18, 0xc6, 0xd7, 0xbd, 0x96, 0xb5, 0xf7, 0xbd, 0xb3, 0x9c, 0x14, 0xa5, 0xb6, 0xb5, 0x96, 0xb5, 0x76, 0xb5,
+  0x39, 0xce, 0x76, 0xb5, 0x34, 0xad, 0xd7, 0xc5, 0xf0, 0x83, 0x96, 0xb5, 0x95, 0xb5, 0xaa, 0x5a, 0x1c, 0x6a, 0x51, 0x14, 0xad, 0x92, 0x9c, 0x92, 0xb6, 0x46, 0x00, 0x5e, 0x78, 0x02, 0x4c, 0x15,
+  0x04, 0x10, 0x27, 0x06, 0x16, 0x27, 0x09, 0xd0, 0x18, 0x07, 0xc4, 0x18, 0x08, 0x92, 0x03, 0x08, 0x10, 0x07, 0x1d, 0xb3, 0x8e, 0x03, 0x06, 0x90, 0x03, 0x02, 0x48, 0x9c, 0x0e, 0x70, 0x3c, 0x1a,
+  0xd0, 0x20, 0x07, 0x03, 0xe4, 0x7f, 0x01, 0xc8, 0x78, 0x05, 0xea, 0x18, 0x04, 0xa4, 0x2a, 0x22, 0x12, 0xb5, 0x5a, 0x15, 0x04, 0x90, 0x3c, 0x02, 0x0c, 0x07, 0x00, 0x90, 0x11, 0x13, 0x53, 0x5c,
+  0x5c, 0x00, 0x3e, 0x15, 0x42, 0xb0, 0xa4, 0x73, 0xbd, 0x34, 0x15, 0x20, 0x12, 0xb5, 0x10, 0x00, 0x40, 0xed, 0x8b, 0x6f, 0x9c, 0xb2, 0x1c, 0x02, 0x1c, 0x20, 0x22, 0xf6, 0xcd, 0x94, 0x15, 0x02,
+  0x58, 0x0e, 0x62, 0x57, 0xd6, 0xf6, 0xcd, 0x36, 0xd6, 0xce, 0x31, 0x02, 0x32, 0x60, 0x40, 0xfa, 0xee, 0x36, 0xd6, 0x92, 0x55, 0x21, 0xb9, 0xe6, 0x70, 0x35, 0x02, 0x9e, 0x18, 0x01, 0xa8, 0x58,
+  0x42, 0x17, 0x7d, 0x94, 0x64, 0x94, 0xc5, 0x04, 0xc4, 0xe1, 0x00, 0x1a, 0x03, 0x11, 0xf6, 0xd6, 0x14, 0x00, 0x9a, 0xb3, 0x02, 0xd0, 0x06, 0x02, 0xac, 0x06, 0x02, 0x76, 0x90, 0x00, 0xfe, 0x0d,
+  0x11, 0x94, 0x30, 0x2a, 0x00, 0x98, 0x0d, 0x00, 0x08, 0x54, 0x02, 0x0a, 0x11, 0x02, 0x82, 0xa2, 0x02, 0x18, 0x00, 0x24, 0x32, 0x5c, 0x34, 0x00, 0x00, 0x56, 0x00, 0x00, 0xb6, 0xec, 0x02, 0x98,
+  0xbe, 0x02, 0x68, 0x03, 0x02, 0xf2, 0xcc, 0x02, 0xde, 0x3f, 0x00, 0x72, 0x7b, 0x11, 0x4f, 0xb8, 0x46, 0x00, 0xa2, 0x06, 0x00, 0x2a, 0x66, 0x00, 0x5c, 0xf0, 0x20, 0xf2, 0x5b, 0x02, 0x07, 0x04,
+  0x2c, 0xdf, 0x11, 0x90, 0x74, 0x4d, 0x02, 0xfa, 0xf3, 0x00, 0x6a, 0x00, 0x00, 0x06, 0x19, 0x10, 0x73, 0xb8, 0x70, 0x01, 0xb0, 0x0d, 0x00, 0x46, 0x03, 0x04, 0x3c, 0x94, 0x00, 0xfa, 0x97, 0x00,
+  0x98, 0xde, 0x02, 0xa2, 0x97, 0x00, 0x2c, 0x31, 0x02, 0x2a, 0xd4, 0x00, 0x16, 0x11, 0x22, 0xd0, 0x5b, 0x9a, 0x46, 0x11, 0x4f, 0x2a, 0x1c, 0x11, 0x12, 0x96, 0x03, 0x02, 0xc6, 0xa9, 0x02, 0xaa,
+  0x6d, 0x00, 0xe0, 0x06, 0x02, 0x5a, 0xdb, 0x30, 0xf2, 0x5b, 0x32, 0x36, 0x2e, 0x03, 0x48, 0xed, 0x00, 0xea, 0x03, 0x22, 0x4f, 0x4b, 0xd2, 0xc9, 0x00, 0x08, 0xdf, 0x02, 0x74, 0xdb, 0x11, 0x12,
+  0x24, 0x43, 0x02, 0x92, 0x86, 0x02, 0xee, 0xf0, 0x21, 0x36, 0x85, 0xbc, 0x94, 0x00, 0x5c, 0xbf, 0x00, 0x2e, 0x63, 0x41, 0x85, 0x37, 0x85, 0xf5, 0x9e, 0xb4, 0x00, 0x32, 0x03, 0x10, 0x50, 0xb6,
+  0x78, 0x40, 0x42, 0x6c, 0x2a, 0xb1, 0xaa, 0x5f, 0x30, 0x43, 0x2f, 0x4b, 0x9a, 0x18, 0xd3, 0x90, 0x53, 0x2b, 0x2a, 0xea, 0x21, 0xee, 0x42, 0xd2, 0x63, 0xf2, 0x6b, 0x74, 0xc0, 0xc2, 0x11, 0xd1,
+  0x68, 0x51, 0x00, 0xc2, 0x58, 0x02, 0xfe, 0x94, 0x20, 0xd1, 0x63, 0x52, 0x03, 0x20, 0x70, 0x53, 0x3c, 0x15, 0x11, 0xd1, 0x58, 0x7f, 0x00, 0x2e, 0x63, 0x02, 0x8c, 0xa6, 0x11, 0xf5, 0x00, 0x07,
+  0x00, 0xb4, 0x86, 0x02, 0x76, 0x2a, 0x11, 0x74, 0x1c, 0x07, 0x00, 0x5e, 0x07, 0x21, 0x33, 0x74, 0x10, 0x2e, 0x11, 0x5b, 0xf4, 0x9b, 0x03, 0x44, 0x07, 0x00, 0xaa, 0x0a, 0x11, 0xb0, 0x4e, 0x00,
+  0x00, 0x38, 0x15, 0x00, 0x26, 0x27, 0x00, 0x68, 0x23, 0x20, 0xb4, 0x84, 0x24, 0x7f, 0x00, 0x12, 0x6a, 0x10, 0x31, 0xb2, 0x5f, 0x61, 0x6b, 0x93, 0x84, 0xd4, 0x94, 0xd0, 0x06, 0x7c, 0xa0, 0x92,
+  0x8c, 0xb2, 0x8c, 0xf0, 0x73, 0xec, 0x5a, 0x6e, 0x63, 0x48, 0x43, 0x80, 0x56, 0xad, 0xb3, 0x94, 0x34, 0xa5, 0xd7, 0xbd, 0xd8, 0x1f, 0x00, 0x94, 0x0a, 0xf0, 0x0b, 0xd3, 0x9c, 0x38, 0xc6, 0xb7,
+  0xbd, 0x79, 0xce, 0xd7, 0xbd, 0xb2, 0x9c, 0x76, 0xb5, 0x59, 0xd6, 0x7a, 0xd6, 0x30, 0x8c, 0xb2, 0x9c, 0x96, 0xb5, 0x6d, 0x73, 0xd4, 0x7b, 0xf0, 0x01, 0xef, 0x83, 0xb2, 0x9c, 0xf3, 0xa4, 0x91,
+  0x94, 0x30, 0x8c, 0x10, 0x8c, 0x51, 0x8c, 0x30, 0x8c, 0x20, 0x07, 0x00, 0x06, 0x20, 0x00, 0xc2, 0x11, 0x02, 0x94, 0x23, 0x17, 0x51, 0xa4, 0x0a, 0x08, 0xf0, 0x18, 0x03, 0x2e, 0x15, 0x09, 0x8c,
+  0x03, 0x06, 0x14, 0x27, 0x0f, 0x92, 0x03, 0x08, 0x25, 0x9c, 0xb3, 0x22, 0x07, 0x02, 0x64, 0x15, 0x0e, 0x8a, 0x03, 0x08, 0x42, 0x75, 0x02, 0x5c, 0x15, 0x00, 0x26, 0x07, 0x04, 0x10, 0x20, 0x02,
+  0x42, 0x95, 0x02, 0x34, 0x27, 0x02, 0xf8, 0x06, 0x04, 0xd2, 0x38, 0x00, 0x6e, 0x03, 0x00, 0xe6, 0x5f, 0x02, 0xe2, 0x1f, 0x00, 0xbe, 0x0a, 0x00, 0x76, 0x35, 0x20, 0xf5, 0xcd, 0xde, 0x0a, 0x00,
+  0xa8, 0x2a, 0xa2, 0xed, 0x8b, 0xb4, 0xc5, 0x8c, 0x83, 0x90, 0xa4, 0x16, 0xd6, 0xe2, 0x58, 0x02, 0x4e, 0x15, 0x01, 0xb6, 0x11, 0x00, 0xfa, 0x18, 0x30, 0xc5, 0x57, 0xd6, 0xca, 0x03, 0x00, 0x98,
+  0x03, 0x02, 0x7e, 0x55, 0x40, 0x78, 0xde, 0x6f, 0x9c, 0xe8, 0x18, 0x31, 0xb8, 0xe6, 0x78, 0x2c, 0x00, 0x21, 0xd9, 0xe6, 0xac, 0x18, 0x01, 0x5c, 0x97, 0x00, 0x7a, 0x14, 0x02, 0xf4, 0x9a, 0x02,
+  0xc6, 0xc1, 0x00, 0xde, 0xb3, 0x02, 0x84, 0xf3, 0x00, 0xf2, 0x0d, 0x00, 0xa8, 0x29, 0x20, 0xd0, 0x53, 0xec, 0xa8, 0x20, 0xb0, 0x4b, 0x16, 0x00, 0x00, 0xd8, 0x09, 0x22, 0x52, 0x64, 0x5a, 0xd7,
+  0x08, 0x20, 0x66, 0x13, 0x33, 0x54, 0x54, 0x00, 0x4e, 0x07, 0x11, 0x0e, 0x06, 0x12, 0x00, 0xb8, 0x11, 0x00, 0xca, 0xbe, 0x02, 0xbc, 0xc5, 0x00, 0xbc, 0x3f, 0x20, 0xb4, 0x74, 0xa2, 0x03, 0x02,
+  0x00, 0x03, 0x11, 0xd1, 0x8e, 0x0a, 0x13, 0xd1, 0x66, 0x5b, 0x71, 0xad, 0x32, 0x6f, 0x43, 0x2e, 0x43, 0xcd, 0x12, 0xbf, 0x00, 0x84, 0x0a, 0x00, 0x88, 0xf7, 0x02, 0x38, 0x18, 0x11, 0x74, 0x1c,
+  0x7f, 0x00, 0x22, 0x58, 0x00, 0xb6, 0x03, 0x02, 0x60, 0x18, 0x31, 0x31, 0x64, 0x93, 0xfa, 0xa5, 0x00, 0x5a, 0x2a, 0x02, 0x24, 0xbb, 0x20, 0x11, 0x5c, 0xe2, 0x1b, 0x00, 0x82, 0x03, 0x00, 0xe4,
+  0xc5, 0x11, 0x2d, 0x8a, 0x18, 0x00, 0xb0, 0x90, 0x10, 0xd4, 0xae, 0x26, 0x16, 0x6c, 0x02, 0x00, 0x11, 0xf1, 0x2c, 0x78, 0x00, 0x26, 0x00, 0x02, 0xa2, 0xc9, 0x02, 0x70, 0x8d, 0x20, 0x2e, 0x43,
+  0xd2, 0x2d, 0x20, 0x90, 0x4b, 0xa2, 0x3f, 0x02, 0x84, 0x38, 0x00, 0x92, 0xbb, 0x00, 0xe0, 0x0a, 0x11, 0x90, 0xb0, 0x0a, 0x02, 0x90, 0xb4, 0x02, 0x88, 0xd4, 0x02, 0x42, 0x4a, 0x00, 0x24, 0x00,
+  0x00, 0xb8, 0xd7, 0x00, 0x24, 0x98, 0x02, 0x2a, 0x15, 0x00, 0x12, 0x63, 0x80, 0xac, 0x32, 0xc9, 0x11, 0x2a, 0x22, 0x6b, 0x2a, 0xa6, 0x07, 0xa0, 0x8c, 0x32, 0x8c, 0x32, 0x4b, 0x22, 0xee, 0x3a,
+  0x6b, 0x2a, 0x6c, 0x98, 0x00, 0x6c, 0x58, 0x30, 0xee, 0x42, 0x0e, 0x86, 0x03, 0x30, 0x5b, 0x13, 0x64, 0x58, 0x7c, 0xe2, 0x94, 0x74, 0x57, 0x8d, 0x16, 0x85, 0x74, 0x74, 0x37, 0x8d, 0x98, 0x9d,
+  0x16, 0x8d, 0x72, 0x38, 0x00, 0xd6, 0x0d, 0x20, 0x2f, 0x4b, 0xc0, 0x94, 0x40, 0xee, 0x42, 0x12, 0x64, 0x78, 0x2a, 0x60, 0xad, 0x3a, 0x6b, 0x32, 0xea, 0x21, 0x06, 0x2e, 0x00, 0x00, 0x19, 0x11,
+  0xb4, 0x0c, 0x75, 0x00, 0x5a, 0x03, 0x00, 0x94, 0x0a, 0x00, 0x14, 0x75, 0x01, 0x52, 0x07, 0x10, 0x74, 0x50, 0x07, 0x13, 0x94, 0x9c, 0x0a, 0x40, 0x90, 0x5b, 0x70, 0x5b, 0x0c, 0x20, 0x00, 0x74,
+  0x23, 0x02, 0x40, 0x3c, 0x00, 0x92, 0x03, 0x00, 0xaa, 0x0a, 0x12, 0x33, 0xfa, 0x1f, 0x30, 0x5b, 0xd5, 0x8c, 0xc4, 0x66, 0x20, 0x11, 0x74, 0xc6, 0xdb, 0x11, 0x31, 0xfe, 0x2d, 0x20, 0x32, 0x7c,
+  0xb8, 0x3f, 0x20, 0x11, 0x74, 0xbe, 0xb4, 0x20, 0xd4, 0x94, 0x34, 0x3c, 0x20, 0xb3, 0x8c, 0xa6, 0x86, 0x00, 0x20, 0xa3, 0x80, 0x6e, 0x63, 0x38, 0xbe, 0x55, 0xa5, 0x35, 0xa5, 0x4a, 0x1c, 0x40,
+  0x18, 0xbe, 0xd3, 0x9c, 0xee, 0x26, 0xe0, 0x75, 0xad, 0x76, 0xb5, 0xb2, 0x9c, 0x18, 0xc6, 0xb6, 0xbd, 0x18, 0xc6, 0xba, 0xde, 0xbc, 0x2d, 0xf1, 0x04, 0x14, 0xa5, 0x71, 0x94, 0xd7, 0xc5, 0xd7,
+  0xbd, 0x34, 0xad, 0xcf, 0x83, 0x71, 0x94, 0x92, 0x94, 0x30, 0x8c, 0xd2, 0xa4, 0x66, 0x11, 0x71, 0x90, 0x03, 0x60, 0x30, 0x8c, 0xf0, 0x83, 0x51, 0x8c, 0x3c, 0x0e, 0x1b, 0x31, 0x66, 0x1c, 0x06,
+  0x8c, 0x03, 0x06, 0x70, 0x1c, 0x0e, 0x8a, 0x03, 0x0e, 0x8e, 0x03, 0x0e, 0x92, 0x03, 0x14, 0xd4, 0x5c, 0x35, 0x10, 0xa4, 0x7a, 0xfc, 0x01, 0xee, 0x58, 0x09, 0x8c, 0x03, 0x06, 0xa8, 0x0a, 0x19,
+  0xd0, 0xc8, 0x78, 0x11, 0x11, 0xd2, 0x11, 0x00, 0x86, 0x03, 0x00, 0x66, 0x0e, 0x02, 0x20, 0x07, 0x00, 0x72, 0x03, 0x02, 0x38, 0x75, 0x00, 0x2e, 0xae, 0x00, 0xc4, 0x18, 0x00, 0x68, 0x2e, 0x02,
+  0xa4, 0x0a, 0x02, 0x28, 0x07, 0x02, 0x4c, 0x1c, 0x02, 0x62, 0x1c, 0x02, 0xea, 0x18, 0x20, 0x32, 0xb5, 0x88, 0x03, 0x44, 0xb0, 0xa4, 0x2e, 0x94, 0x00, 0x12, 0x22, 0x16, 0xd6, 0x76, 0x15, 0x00,
+  0x20, 0x0e, 0x01, 0x4e, 0x4e, 0x21, 0xd6, 0xf6, 0xa2, 0x03, 0x11, 0x98, 0x48, 0x0e, 0x20, 0x98, 0xde, 0xae, 0x0a, 0x00, 0x74, 0x35, 0x11, 0x57, 0x62, 0x07, 0x00, 0xf6, 0x02, 0x00, 0xcc, 0x34,
+  0x00, 0x66, 0x09, 0x02, 0x5e, 0x0d, 0x13, 0x94, 0x18, 0xb7, 0x20, 0x0d, 0x3b, 0xc2, 0x37, 0x10, 0x8f, 0x72, 0xf3, 0x21, 0x32, 0x6e, 0x2e, 0x0d, 0x00, 0x68, 0x14, 0x01, 0xa4, 0x03, 0x00, 0x84,
+  0x29, 0x01, 0xea, 0xe1, 0x00, 0x30, 0x0a, 0x00, 0x48, 0x31, 0x00, 0xde, 0x77, 0x42, 0xce, 0x32, 0xee, 0x3a, 0x04, 0x19, 0x02, 0x8c, 0x97, 0x00, 0xd2, 0x0d, 0x02, 0x62, 0x34, 0x02, 0x5c, 0x0e,
+  0x11, 0x33, 0xfa, 0xac, 0x00, 0x2e, 0x1f, 0x40, 0xac, 0x2a, 0xed, 0x32, 0xc6, 0x34, 0x00, 0x3c, 0xa6, 0x00, 0x3c, 0x11, 0x00, 0x98, 0x1b, 0x40, 0x2e, 0x43, 0x70, 0x4b, 0x56, 0x00, 0x00, 0x70,
+  0x23, 0x00, 0x4e, 0xa2, 0x00, 0x12, 0x18, 0x00, 0x6e, 0x06, 0x02, 0xc6, 0x15, 0x10, 0x95, 0xac, 0x62, 0x10, 0x5c, 0xe4, 0x49, 0x60, 0x90, 0x4b, 0x2e, 0x43, 0x73, 0x6c, 0xa2, 0xa9, 0x31, 0xb3,
+  0x74, 0x6e, 0x78, 0x26, 0x00, 0xc2, 0x0d, 0x12, 0x4e, 0xc0, 0x2d, 0x10, 0x5b, 0x98, 0xc9, 0x31, 0x11, 0x5c, 0x8f, 0x94, 0x03, 0x42, 0xd0, 0x53, 0x52, 0x6c, 0x40, 0x1f, 0x00, 0x3e, 0x9b, 0x00,
+  0x6a, 0x26, 0x50, 0xed, 0x42, 0x8b, 0x32, 0xab, 0x6e, 0x2d, 0x10, 0x43, 0xc2, 0x69, 0x00, 0x22, 0xad, 0x11, 0x0d, 0xac, 0xf7, 0x00, 0xac, 0x1f, 0x00, 0x3a, 0x07, 0x00, 0x86, 0x00, 0x00, 0xf0,
+  0x11, 0x22, 0xed, 0x3a, 0x08, 0x00, 0xc0, 0xa8, 0x09, 0xc8, 0x11, 0x88, 0x09, 0xa4, 0x00, 0x2a, 0x22, 0xcc, 0x32, 0xae, 0xc2, 0x00, 0x60, 0x07, 0x13, 0xd1, 0x7e, 0x8d, 0x10, 0xd1, 0xe2, 0x9b,
+  0x00, 0x56, 0x9f, 0x50, 0x4b, 0xcc, 0x3a, 0x2e, 0x43, 0x0c, 0x8a, 0x00, 0x2c, 0x2e, 0x02, 0x40, 0x07, 0x20, 0x12, 0x64, 0x86, 0x1c, 0x22, 0x90, 0x53, 0x38, 0xdf, 0x00, 0x1a, 0x20, 0x11, 0x0e,
+  0xea, 0x1f, 0x00, 0x24, 0x5c, 0x22, 0x12, 0x64, 0xac, 0x1f, 0x51, 0xf2, 0x63, 0xf2, 0x5b, 0xb1, 0x7c, 0x9f, 0x00, 0xde, 0x74, 0x01, 0xd8, 0x66, 0x10, 0x63, 0x72, 0x0a, 0x00, 0x48, 0x0e, 0x11,
+  0x74, 0x50, 0x23, 0x01, 0x18, 0x91, 0x12, 0x84, 0x06, 0x0e, 0x24, 0x74, 0x74, 0x68, 0x23, 0x00, 0xf0, 0x0d, 0x02, 0xce, 0x18, 0x11, 0xd2, 0x5e, 0x23, 0x00, 0xe2, 0x18, 0x00, 0xf6, 0x46, 0x00,
+  0x28, 0x27, 0x22, 0x90, 0x5b, 0x60, 0x23, 0x40, 0x2e, 0x53, 0x70, 0x5b, 0xfc, 0x34, 0x00, 0x74, 0x15, 0x02, 0x40, 0x0e, 0x22, 0x94, 0x7c, 0x8a, 0x03, 0x60, 0xb5, 0x84, 0x6f, 0x5b, 0x4f, 0x5b,
+  0xa4, 0x31, 0x10, 0x93, 0xd4, 0xc2, 0x21, 0x84, 0xf0, 0x28, 0x3c, 0x02, 0x66, 0x71, 0x10, 0x6e, 0x36, 0x63, 0x10, 0x5b, 0xbc, 0x3f, 0x00, 0xe8, 0x74, 0x00, 0x6a, 0x23, 0x20, 0xcf, 0x73, 0xd2,
+  0x18, 0x00, 0xd6, 0x6d, 0x20, 0xab, 0x52, 0xe0, 0x1f, 0xf0, 0x0f, 0xb7, 0xb5, 0xb3, 0x94, 0xb2, 0x94, 0x14, 0xa5, 0xf4, 0x9c, 0x76, 0xb5, 0xf8, 0xbd, 0x76, 0xb5, 0xb3, 0x9c, 0x71, 0x94, 0x2c,
+  0x6b, 0xef, 0x83, 0x50, 0x8c, 0x30, 0x8c, 0xae, 0x7b, 0x16, 0x6a, 0x20, 0x0f, 0x84, 0x1c, 0x07, 0x60, 0xae, 0x7b, 0x10, 0x8c, 0x0f, 0x8c, 0x8e, 0x5f, 0x60, 0x51, 0x94, 0x50, 0x8c, 0x0f, 0x84,
+  0x26, 0x07, 0x00, 0x92, 0x03, 0x40, 0x51, 0x8c, 0x92, 0x94, 0x20, 0x07, 0x00, 0x00, 0x55, 0x02, 0x7e, 0x03, 0x02, 0x2a, 0x27, 0x0a, 0x5e, 0x15, 0x06, 0x06, 0x00, 0x2f, 0x93, 0x94, 0x92, 0x03,
+  0x1f, 0x02, 0x30, 0xee, 0x22, 0xb3, 0xa4, 0xa4, 0xb1, 0x00, 0x90, 0x03, 0x1d, 0xaf, 0x86, 0x1c, 0x02, 0x90, 0x03, 0x04, 0x8c, 0x63, 0x02, 0x18, 0x07, 0x22, 0xf1, 0xac, 0x24, 0x67, 0x00, 0x88,
+  0x03, 0x04, 0x14, 0x20, 0x02, 0x90, 0xc3, 0x40, 0xb0, 0xa4, 0x33, 0xb5, 0x70, 0x23, 0x42, 0x2f, 0x94, 0x73, 0xbd, 0x18, 0x47, 0x00, 0xb8, 0x18, 0x24, 0xb0, 0xa4, 0xb4, 0x23, 0x02, 0x18, 0x47,
+  0x20, 0x57, 0xde, 0x98, 0x0a, 0x20, 0xb0, 0xa4, 0x10, 0x99, 0x02, 0x9c, 0x0a, 0x40, 0x77, 0xde, 0x6f, 0x9c, 0xc8, 0xc3, 0x00, 0x90, 0x03, 0x13, 0x37, 0x28, 0x07, 0x00, 0x90, 0x1c, 0x00, 0x28,
+  0x80, 0x00, 0xe0, 0x18, 0x40, 0xd1, 0xa4, 0x12, 0xb5, 0xdc, 0x11, 0x00, 0xc0, 0x1c, 0x11, 0x57, 0x8c, 0x1c, 0x00, 0x06, 0xe4, 0x20, 0x8f, 0x4b, 0xe2, 0xaf, 0x91, 0x52, 0x64, 0xd4, 0x74, 0x15,
+  0x7d, 0xb4, 0x74, 0xb0, 0x78, 0x22, 0x00, 0x2a, 0x22, 0x00, 0x72, 0x14, 0x00, 0x80, 0xa5, 0x00, 0x98, 0x22, 0x10, 0x8f, 0xb4, 0x10, 0x30, 0x4b, 0xf1, 0x5b, 0x70, 0x14, 0x00, 0x26, 0x2d, 0x00,
+  0xb8, 0x06, 0x00, 0xae, 0x03, 0x20, 0xb0, 0x4b, 0x4a, 0x14, 0x02, 0x14, 0x07, 0x20, 0xb5, 0x6c, 0x60, 0x0a, 0x20, 0xf2, 0x5b, 0x94, 0x90, 0x20, 0xed, 0x32, 0xb0, 0x3b, 0x02, 0x62, 0x89, 0x00,
+  0x7e, 0x07, 0x00, 0x44, 0x23, 0x00, 0x28, 0x00, 0x00, 0x32, 0x11, 0x00, 0xea, 0x02, 0x00, 0x04, 0x3f, 0x02, 0x18, 0x1f, 0x11, 0x6f, 0x80, 0x34, 0x01, 0x06, 0x0b, 0x01, 0x36, 0xbb, 0x00, 0x0c,
+  0xbb, 0x00, 0x94, 0x14, 0x02, 0x4c, 0xa6, 0x02, 0x70, 0x0d, 0x11, 0x53, 0x2a, 0x5f, 0x00, 0x8c, 0x0d, 0x00, 0x66, 0x1f, 0x00, 0xa2, 0x06, 0x30, 0x72, 0x6c, 0x4e, 0x4e, 0x62, 0x60, 0x3a, 0xaf,
+  0x53, 0x0c, 0x43, 0x8f, 0x5c, 0x2a, 0x10, 0x5b, 0x3c, 0x0a, 0x00, 0x16, 0x1c, 0x80, 0x52, 0x6c, 0x72, 0x6c, 0xb0, 0x53, 0x4e, 0x4b, 0x6e, 0x46, 0x01, 0x48, 0x23, 0x70, 0x53, 0x6e, 0x4b, 0x2e,
+  0x4b, 0x6e, 0x4b, 0xc8, 0x3b, 0x20, 0x6f, 0x53, 0xaa, 0xbe, 0x10, 0x4e, 0xb6, 0x29, 0x01, 0xe4, 0xa9, 0x01, 0x12, 0x2a, 0x10, 0x32, 0x12, 0xed, 0x22, 0x0e, 0x43, 0xce, 0xf7, 0x02, 0xfa, 0x06,
+  0x00, 0x32, 0x2e, 0x02, 0x90, 0x0a, 0x00, 0xf6, 0xd7, 0x00, 0xf8, 0x0a, 0x22, 0x73, 0x6c, 0x9c, 0x11, 0x02, 0xd0, 0x11, 0x13, 0x90, 0x10, 0x0b, 0x11, 0x73, 0x22, 0x55, 0x60, 0x4e, 0x4b, 0x2e,
+  0x43, 0xac, 0x3a, 0x06, 0x27, 0x00, 0xf6, 0x18, 0x00, 0x04, 0x15, 0x22, 0x37, 0x8d, 0x36, 0x71, 0x02, 0x1a, 0xb1, 0x00, 0xaa, 0xdb, 0x00, 0x74, 0x0a, 0x70, 0x57, 0x8d, 0xb5, 0x7c, 0x12, 0x64,
+  0x12, 0xc2, 0x58, 0x50, 0x74, 0xf6, 0x84, 0x33, 0x6c, 0x50, 0x91, 0x60, 0xb5, 0x7c, 0x37, 0x8d, 0xf6, 0x84, 0x5c, 0x1c, 0x22, 0xf6, 0x84, 0x76, 0x03, 0x02, 0x12, 0x15, 0x00, 0x96, 0x11, 0x11,
+  0xf5, 0x20, 0xe6, 0x02, 0xcc, 0x1f, 0x02, 0xb4, 0xb4, 0x00, 0x90, 0x0a, 0x11, 0x73, 0x98, 0x31, 0x00, 0x5a, 0x23, 0x00, 0x2a, 0x00, 0x10, 0x33, 0xc6, 0x66, 0x00, 0xa0, 0x78, 0x02, 0x4a, 0xdf,
+  0x10, 0x84, 0xf8, 0x4d, 0x00, 0x08, 0x00, 0x00, 0xb4, 0x03, 0x11, 0xd1, 0x34, 0x43, 0x02, 0xe8, 0x3f, 0x00, 0xee, 0x94, 0x00, 0xb8, 0x38, 0x20, 0x4f, 0x53, 0xdc, 0x1f, 0x22, 0x74, 0x84, 0x36,
+  0x15, 0x60, 0x11, 0x74, 0x2d, 0x5b, 0xaf, 0x63, 0xaa, 0x3f, 0x00, 0x0a, 0x07, 0x02, 0x46, 0xb8, 0xf0, 0x07, 0x14, 0x9d, 0xb3, 0x8c, 0xf0, 0x7b, 0xf3, 0x9c, 0x92, 0x8c, 0x30, 0x84, 0xae, 0x73,
+  0x71, 0x8c, 0xb6, 0xb5, 0x38, 0xc6, 0x10, 0x7c, 0xd4, 0x06, 0x30, 0x34, 0xa5, 0xd3, 0x0a, 0x07, 0x20, 0xb5, 0x55, 0x46, 0x63, 0x10, 0x94, 0xa8, 0x0a, 0xc2, 0x2d, 0x6b, 0x4d, 0x6b, 0xcb, 0x5a,
+  0x0f, 0x84, 0x13, 0xa5, 0xef, 0x83, 0xca, 0x7b, 0x00, 0x14, 0x07, 0xa0, 0xcf, 0x83, 0x2c, 0x6b, 0x0f, 0x84, 0xef, 0x83, 0x50, 0x94, 0x6c, 0x7f, 0x00, 0x1c, 0x07, 0x20, 0xf3, 0xa4, 0x3a, 0x07,
+  0x13, 0x51, 0xae, 0x0a, 0x12, 0x31, 0x20, 0x07, 0x2d, 0x84, 0x51, 0x10, 0x27, 0x07, 0xd0, 0x18, 0x30, 0x94, 0x73, 0x94, 0x06, 0x00, 0x00, 0x7a, 0x03, 0x13, 0x73, 0x04, 0x00, 0x0f, 0x9a, 0x03,
+  0x12, 0x03, 0x3c, 0x6e, 0x04, 0x8e, 0x03, 0x0e, 0x3e, 0x0e, 0x17, 0xf1, 0xf4, 0x38, 0x08, 0x94, 0x6a, 0x02, 0x94, 0x03, 0x13, 0x11, 0x1e, 0x07, 0x13, 0x32, 0xf0, 0x58, 0x11, 0x73, 0x08, 0xe0,
+  0x13, 0x94, 0x84, 0x43, 0x00, 0x8c, 0x03, 0x02, 0x6a, 0x2e, 0x02, 0xa0, 0x31, 0x00, 0xd6, 0x11, 0x20, 0xf6, 0xcd, 0x60, 0x0e, 0x00, 0x34, 0x2e, 0x42, 0xee, 0x8b, 0xcd, 0x8b, 0xd0, 0x11, 0x13,
+  0xf5, 0x7c, 0x15, 0x00, 0x86, 0x03, 0x00, 0xe2, 0x18, 0x20, 0x74, 0xbd, 0x46, 0x07, 0x02, 0x28, 0x40, 0x00, 0x76, 0x03, 0x02, 0x5c, 0x15, 0x00, 0xf0, 0x38, 0x00, 0x66, 0x07, 0x22, 0x16, 0xce,
+  0x6c, 0x6e, 0x20, 0x37, 0xd6, 0x3e, 0x0e, 0xe0, 0x78, 0xde, 0x15, 0x7d, 0x15, 0x7d, 0xb3, 0x74, 0xf0, 0x5b, 0x8f, 0x4b, 0x2d, 0x3b, 0xc2, 0x02, 0x51, 0xd0, 0x53, 0xf0, 0x53, 0x8f, 0x0a, 0x07,
+  0x60, 0xf0, 0x5b, 0xf0, 0x53, 0x52, 0x64, 0xda, 0x37, 0x00, 0x92, 0x02, 0x11, 0xd0, 0x7a, 0x14, 0x60, 0x93, 0x6c, 0x36, 0x7d, 0x73, 0x6c, 0x00, 0xc9, 0x02, 0x1e, 0xbb, 0x02, 0xec, 0x29, 0x02,
+  0x02, 0xc2, 0x00, 0x8c, 0x18, 0x02, 0xea, 0x26, 0x00, 0x4a, 0x23, 0x00, 0x02, 0x00, 0x00, 0x8c, 0x0d, 0x00, 0x12, 0x58, 0x03, 0x92, 0x2a, 0x01, 0xe4, 0x85, 0x02, 0x1c, 0x0e, 0x00, 0x04, 0x3f,
+  0x00, 0x1e, 0x9b, 0x00, 0x08, 0x0e, 0x11, 0x32, 0xb2, 0x0d, 0x00, 0x32, 0x9b, 0x00, 0xe2, 0x10, 0x00, 0x8e, 0x03, 0x01, 0x42, 0x11, 0x01, 0x64, 0xa2, 0x00, 0x38, 0x1c, 0x00, 0xbe, 0x0d, 0x00,
+  0x78, 0x5b, 0xd1, 0xb0, 0x53, 0xd5, 0x7c, 0x15, 0x7d, 0x72, 0x6c, 0xd0, 0x5b, 0xab, 0x32, 0x51, 0x66, 0x4d, 0x20, 0x0c, 0x43, 0x20, 0x3f, 0x00, 0xc8, 0xec, 0x00, 0x9c, 0x2d, 0x00, 0x1e, 0x38,
+  0x20, 0x11, 0x5c, 0x18, 0x00, 0x20, 0x4e, 0x4b, 0x22, 0x07, 0x00, 0x38, 0x1f, 0x01, 0x0a, 0x00, 0x10, 0x53, 0x40, 0xf0, 0x00, 0x0c, 0x00, 0x00, 0x42, 0x4d, 0x22, 0x4e, 0x4b, 0x0c, 0x43, 0x02,
+  0x96, 0xf0, 0x00, 0x80, 0x03, 0x10, 0xd4, 0xca, 0x0a, 0x73, 0x64, 0x36, 0x85, 0x15, 0x85, 0x73, 0x6c, 0x02, 0x00, 0x00, 0xc6, 0x31, 0x12, 0x6c, 0x02, 0xc6, 0x02, 0x82, 0x0e, 0x00, 0xb8, 0x11,
+  0x00, 0x14, 0x16, 0x11, 0x53, 0xb0, 0x94, 0x00, 0x5a, 0xfb, 0x20, 0x2e, 0x43, 0x30, 0x15, 0x02, 0xf8, 0x97, 0x00, 0x5c, 0xd4, 0x00, 0x04, 0x00, 0x11, 0xb0, 0x5a, 0x11, 0x00, 0x0a, 0x2e, 0x60,
+  0x2a, 0x2a, 0x0a, 0x22, 0x6b, 0x2a, 0xac, 0x0a, 0x00, 0xfe, 0x03, 0x20, 0x8c, 0x32, 0x82, 0x2a, 0x02, 0xfa, 0x06, 0x00, 0x98, 0x03, 0x51, 0xb1, 0x5b, 0x12, 0x6c, 0xd6, 0x4c, 0x6a, 0x40, 0x70,
+  0x53, 0xd2, 0x63, 0x9c, 0x03, 0x20, 0xd1, 0x63, 0x38, 0x63, 0x31, 0x6c, 0x32, 0x4f, 0xa4, 0x38, 0x40, 0x90, 0x5b, 0x0e, 0x4b, 0x84, 0x2a, 0x00, 0x04, 0x83, 0x00, 0x32, 0x3c, 0x31, 0x0d, 0x4b,
+  0xcc, 0x2a, 0x2e, 0x00, 0xe8, 0x0d, 0x20, 0x8f, 0x5b, 0xe2, 0x74, 0x00, 0xf8, 0x06, 0x00, 0x76, 0x03, 0x00, 0x3a, 0x0e, 0x04, 0xbc, 0xb4, 0x00, 0x02, 0x00, 0x00, 0x80, 0x03, 0x40, 0xb4, 0x84,
+  0x12, 0x74, 0x82, 0x58, 0x00, 0xc0, 0x18, 0x20, 0xd1, 0x6b, 0x14, 0xca, 0x11, 0x2e, 0x32, 0x07, 0x60, 0xd5, 0x8c, 0x74, 0x7c, 0x12, 0x74, 0xf0, 0x66, 0x20, 0xd0, 0x6b, 0x26, 0x0e, 0x00, 0x1a,
+  0x07, 0x40, 0x92, 0x84, 0x31, 0x7c, 0xdc, 0x14, 0xf0, 0x0d, 0x8e, 0x6b, 0x30, 0x7c, 0x51, 0x84, 0xef, 0x73, 0xd3, 0x94, 0x92, 0x8c, 0xef, 0x7b, 0x2c, 0x63, 0x30, 0x84, 0xf3, 0x9c, 0x10, 0x7c,
+  0x10, 0x84, 0x71, 0x8c, 0xf3, 0x9c, 0xc8, 0x46, 0x22, 0xd7, 0xbd, 0xb4, 0x38, 0x10, 0x18, 0x44, 0x63, 0x90, 0xc6, 0xf7, 0xbd, 0x39, 0xce, 0x38, 0xce, 0xf3, 0xa4, 0xf6, 0x06, 0x00, 0x74, 0x03,
+  0x20, 0x50, 0x8c, 0x22, 0x07, 0x51, 0x71, 0x94, 0x6d, 0x73, 0x30, 0x18, 0x07, 0x71, 0xd2, 0xa4, 0x34, 0xad, 0x54, 0xb5, 0x71, 0x8a, 0x03, 0x40, 0x71, 0x94, 0x92, 0x9c, 0x2c, 0x63, 0x02, 0xaa,
+  0xad, 0x00, 0x3c, 0x0e, 0x11, 0x92, 0x70, 0x51, 0x08, 0xc4, 0x11, 0x05, 0x1c, 0x27, 0x02, 0x88, 0x03, 0x02, 0x08, 0x00, 0x03, 0x70, 0x03, 0x06, 0x0a, 0x00, 0x0f, 0x92, 0x03, 0x0e, 0x03, 0x36,
+  0x0e, 0x04, 0xea, 0xdf, 0x13, 0xb1, 0x0e, 0x20, 0x0f, 0xce, 0x11, 0x0c, 0x16, 0xac, 0x42, 0x0e, 0x04, 0x6a, 0x9c, 0x00, 0xac, 0x11, 0x04, 0x40, 0x4e, 0x04, 0x16, 0x40, 0x02, 0xaa, 0x23, 0x00,
+  0x7a, 0x0a, 0x00, 0x2a, 0x27, 0x02, 0x00, 0x27, 0x00, 0x88, 0x03, 0x22, 0x12, 0xb5, 0xe2, 0x31, 0x00, 0x18, 0x27, 0x13, 0x33, 0xe2, 0x11, 0x00, 0x12, 0x00, 0x20, 0xd9, 0xee, 0xd4, 0x23, 0x20,
+  0x90, 0xa4, 0x9e, 0x3c, 0x11, 0x37, 0xd6, 0x11, 0x11, 0x78, 0xc4, 0x11, 0x00, 0xb0, 0x15, 0x31, 0x77, 0xde, 0x77, 0x5c, 0x0e, 0x11, 0x57, 0x2a, 0x07, 0x11, 0xf5, 0x40, 0x0e, 0x04, 0x20, 0x07,
+  0x80, 0x2d, 0x43, 0xab, 0x2a, 0x8b, 0x2a, 0x8e, 0x4b, 0xca, 0x02, 0x00, 0xb8, 0x30, 0x02, 0x4c, 0x34, 0x00, 0x9c, 0x03, 0x51, 0x0c, 0x3b, 0x6e, 0x43, 0x4e, 0x70, 0x1b, 0x71, 0xe9, 0x11, 0x6b,
+  0x22, 0xcc, 0x32, 0x8f, 0x84, 0xb7, 0x00, 0xdc, 0x0d, 0x00, 0x94, 0x11, 0x02, 0x02, 0xe9, 0x00, 0x8a, 0x31, 0x21, 0xf2, 0x5b, 0x5a, 0x46, 0x01, 0xc8, 0x11, 0x11, 0x94, 0x50, 0x54, 0x02, 0xdc,
+  0xd3, 0x11, 0xb0, 0x88, 0x3b, 0x22, 0xce, 0x32, 0x62, 0x90, 0x02, 0x64, 0xa2, 0x00, 0x3e, 0x3f, 0x00, 0x70, 0xb0, 0x00, 0x8c, 0x03, 0x30, 0xd4, 0x74, 0xd4, 0x76, 0x18, 0x12, 0x6c, 0xd2, 0xec,
+  0x01, 0x56, 0x54, 0x21, 0x6c, 0xb0, 0x28, 0x1c, 0x11, 0x6f, 0xb8, 0x22, 0x00, 0xa6, 0x62, 0x00, 0x1a, 0x1f, 0x60, 0xee, 0x3a, 0xb1, 0x5b, 0x73, 0x6c, 0x2a, 0xa2, 0x00, 0xa8, 0x06, 0x11, 0x6f,
+  0xc8, 0x49, 0x91, 0xab, 0x3a, 0xcf, 0x5b, 0x2d, 0x43, 0xd3, 0x7c, 0x51, 0xca, 0x29, 0x41, 0xd0, 0x5b, 0x2d, 0x43, 0x2e, 0x31, 0x01, 0x20, 0x1c, 0xc0, 0x8f, 0x4b, 0x52, 0x64, 0xf4, 0x7c, 0x52,
+  0x64, 0xb3, 0x74, 0x8f, 0x4b, 0xfc, 0x49, 0x51, 0x52, 0x6c, 0x31, 0x64, 0xd0, 0x6e, 0x0e, 0x00, 0xaa, 0x14, 0x10, 0x52, 0x70, 0x00, 0x10, 0x64, 0x5e, 0xa2, 0x20, 0x4e, 0x4b, 0x0e, 0xd4, 0x11,
+  0x73, 0x16, 0xf4, 0x02, 0xd8, 0xd0, 0x01, 0xc8, 0x18, 0x10, 0x4b, 0xb4, 0x38, 0x00, 0x6e, 0x38, 0x20, 0x31, 0x64, 0x96, 0x3f, 0x40, 0xab, 0x32, 0xed, 0x3a, 0xd2, 0x18, 0x00, 0x00, 0x12, 0x11,
+  0x11, 0x4e, 0xf4, 0x01, 0x9c, 0x0a, 0x01, 0x90, 0x03, 0x01, 0xf8, 0xa9, 0x10, 0x5b, 0x98, 0x00, 0x02, 0x08, 0x00, 0x00, 0x10, 0x07, 0x00, 0x72, 0x43, 0x31, 0xac, 0x3a, 0x2f, 0x06, 0x7c, 0x10,
+  0xd1, 0x1c, 0xa6, 0x02, 0x24, 0x4a, 0x01, 0x2e, 0x4a, 0x00, 0x60, 0x0a, 0x80, 0x2f, 0x4b, 0x2f, 0x4b, 0xd5, 0x7c, 0x37, 0x8d, 0xc4, 0x5f, 0x31, 0x13, 0x6c, 0x54, 0x48, 0x03, 0x11, 0x33, 0x70,
+  0x2a, 0x00, 0x9a, 0x0a, 0x00, 0xe2, 0x18, 0x02, 0x62, 0xa6, 0x00, 0x9c, 0x11, 0x00, 0xa4, 0xdb, 0x00, 0x56, 0x58, 0x00, 0x78, 0x66, 0x11, 0xb0, 0xa8, 0x5f, 0x11, 0xaf, 0xf2, 0x03, 0x02, 0xf4,
+  0x82, 0x00, 0xee, 0x26, 0x20, 0x0e, 0x4b, 0xa8, 0x03, 0x00, 0xe2, 0x38, 0x51, 0xed, 0x4a, 0xb0, 0x63, 0x12, 0x1a, 0x63, 0x00, 0x90, 0x38, 0x00, 0xce, 0x1f, 0x00, 0x24, 0x63, 0x20, 0x4f, 0x5b,
+  0x04, 0x27, 0x21, 0xf1, 0x6b, 0x6e, 0x4a, 0x90, 0x6b, 0x2f, 0x5b, 0x90, 0x63, 0xed, 0x52, 0x90, 0x6b, 0x76, 0x2a, 0xf0, 0x1b, 0x2d, 0x5b, 0xcf, 0x73, 0x10, 0x7c, 0xae, 0x6b, 0x4d, 0x63, 0xeb,
+  0x5a, 0x8e, 0x6b, 0xef, 0x73, 0xcf, 0x73, 0x0c, 0x5b, 0xae, 0x73, 0xaa, 0x52, 0x6d, 0x6b, 0xae, 0x73, 0xcb, 0x5a, 0xef, 0x7b, 0x8d, 0x6b, 0x2c, 0x63, 0xae, 0x73, 0xb2, 0x94, 0xb2, 0x94, 0x1a,
+  0x07, 0x62, 0x39, 0xc6, 0xf8, 0xc5, 0x39, 0xce, 0xce, 0x18, 0x00, 0x4e, 0x15, 0xf0, 0x03, 0x55, 0xad, 0xf3, 0xa4, 0xae, 0x7b, 0xae, 0x73, 0xef, 0x83, 0xd2, 0x9c, 0x6d, 0x73, 0xcf, 0x83, 0x92,
+  0x9c, 0x96, 0x03, 0x00, 0x08, 0x03, 0x00, 0xe0, 0x7b, 0x00, 0x90, 0x03, 0x02, 0xaa, 0x03, 0x02, 0x04, 0x00, 0x11, 0x91, 0x06, 0x00, 0x51, 0x51, 0x8c, 0x31, 0x8c, 0x51, 0x58, 0x35, 0x01, 0xdc,
+  0x51, 0x0e, 0x3e, 0x0e, 0x03, 0xa4, 0x0a, 0x06, 0x1c, 0x07, 0x0f, 0x02, 0x00, 0x15, 0x0a, 0x8c, 0x03, 0x06, 0xea, 0x18, 0x0a, 0xbc, 0x2a, 0x06, 0x04, 0x20, 0x03, 0x90, 0x03, 0x04, 0x60, 0x9c,
+  0x03, 0x90, 0x03, 0x06, 0x42, 0x95, 0x00, 0xa4, 0x23, 0x02, 0x46, 0x2e, 0x02, 0xa0, 0x43, 0x02, 0x22, 0x07, 0x13, 0xb5, 0x48, 0x0e, 0x22, 0xcd, 0x8b, 0xce, 0x78, 0x02, 0x5e, 0x0e, 0x02, 0x52,
+  0x15, 0x02, 0x82, 0x3c, 0x13, 0x36, 0x3a, 0x6e, 0x02, 0x6a, 0xce, 0x00, 0x40, 0x07, 0x00, 0x90, 0x0a, 0x00, 0x50, 0x6e, 0x02, 0x9c, 0x63, 0x01, 0x60, 0x35, 0x52, 0xce, 0xb9, 0xe6, 0x98, 0xde,
+  0x5a, 0x15, 0x02, 0xd4, 0x11, 0x00, 0x94, 0x03, 0x20, 0xd5, 0xcd, 0xd2, 0x03, 0x00, 0x4e, 0x47, 0x00, 0x98, 0x29, 0x00, 0xd2, 0x2c, 0x40, 0x8b, 0x2a, 0x6a, 0x22, 0x94, 0x37, 0x13, 0x2d, 0x28,
+  0x3b, 0x21, 0x8e, 0x4b, 0xbe, 0x30, 0x32, 0x43, 0xed, 0x3a, 0x84, 0x11, 0x10, 0x56, 0x10, 0x3f, 0x11, 0x64, 0x82, 0x2a, 0x31, 0x7c, 0x94, 0x6c, 0x5e, 0x1f, 0x01, 0x3e, 0x0e, 0x00, 0x36, 0x15,
+  0x02, 0xee, 0x29, 0x01, 0xc0, 0xec, 0x01, 0xfe, 0x14, 0x02, 0x34, 0x2a, 0x00, 0xa0, 0x0a, 0x11, 0x32, 0xf0, 0x5e, 0x02, 0xf4, 0x57, 0x11, 0x12, 0xf4, 0xb3, 0x00, 0x94, 0x18, 0x02, 0xca, 0x11,
+  0x00, 0x4a, 0xc2, 0x00, 0x10, 0x38, 0x00, 0xd0, 0x1f, 0x22, 0xf5, 0x7c, 0xce, 0xc5, 0x01, 0xd0, 0xfa, 0x01, 0x8e, 0xf7, 0x11, 0x53, 0xae, 0x14, 0x02, 0x6e, 0xb0, 0x02, 0x6c, 0xde, 0x00, 0x64,
+  0x5b, 0x00, 0x22, 0x7b, 0xf0, 0x01, 0xb3, 0x7c, 0x92, 0x74, 0xb3, 0x74, 0xaf, 0x5b, 0x4e, 0x4b, 0x10, 0x64, 0xaf, 0x53, 0x4d, 0x4b, 0x20, 0x0e, 0x11, 0x72, 0xa6, 0x11, 0x00, 0x06, 0x00, 0x42,
+  0xb3, 0x74, 0xf4, 0x7c, 0x56, 0x23, 0x01, 0x58, 0x23, 0x12, 0x53, 0x08, 0x00, 0x00, 0x38, 0x66, 0x00, 0x56, 0x03, 0x13, 0x52, 0xf0, 0xe5, 0x02, 0x04, 0xc6, 0x40, 0x73, 0x6c, 0x8f, 0x53, 0xb8,
+  0x1f, 0x00, 0xc4, 0x0a, 0x00, 0x38, 0x9f, 0x00, 0x2e, 0x00, 0x00, 0x06, 0x00, 0x50, 0xed, 0x42, 0x6f, 0x4b, 0x4e, 0xd6, 0x0a, 0x00, 0x44, 0x07, 0x01, 0xb6, 0x15, 0x02, 0x0a, 0x8a, 0x11, 0x4e,
+  0xea, 0xa2, 0x02, 0xf8, 0x7b, 0x11, 0x32, 0xfa, 0x14, 0x20, 0x73, 0x6c, 0x90, 0x94, 0x31, 0xac, 0x3a, 0x11, 0xd2, 0x18, 0x02, 0xf4, 0xc2, 0x11, 0xd5, 0x40, 0x31, 0x00, 0x34, 0x83, 0x02, 0x76,
+  0x78, 0x00, 0x08, 0x00, 0xe0, 0xd5, 0x7c, 0x16, 0x8d, 0xf6, 0x84, 0x16, 0x8d, 0xb5, 0x7c, 0xb4, 0x7c, 0x57, 0x95, 0xca, 0x26, 0x00, 0x8c, 0x3f, 0x00, 0xe8, 0x7b, 0x00, 0xca, 0x11, 0x00, 0x74,
+  0x1c, 0x02, 0x4a, 0xc6, 0x71, 0x2f, 0x4b, 0x33, 0x6c, 0x57, 0x95, 0x52, 0x2c, 0x51, 0x11, 0x4f, 0x26, 0x43, 0x20, 0x4e, 0x53, 0xf8, 0x46, 0x31, 0xec, 0x42, 0xab, 0xa0, 0x58, 0x00, 0x7e, 0x43,
+  0x00, 0xce, 0x3f, 0x00, 0xf6, 0x3f, 0x02, 0xf2, 0xe2, 0x02, 0xe6, 0xbb, 0x11, 0x33, 0x46, 0xb8, 0x00, 0xfe, 0x74, 0x00, 0xe2, 0x26, 0x40, 0x0e, 0x53, 0x2e, 0x53, 0x34, 0x6a, 0x00, 0xda, 0x18,
+  0x20, 0xd0, 0x6b, 0x24, 0xf8, 0x10, 0xd0, 0x76, 0x23, 0x21, 0x63, 0xb0, 0x18, 0x07, 0x00, 0x62, 0x9f, 0xf0, 0x0b, 0x52, 0x84, 0xf0, 0x73, 0xef, 0x73, 0x8e, 0x6b, 0x91, 0x8c, 0x2c, 0x63, 0x0f,
+  0x7c, 0x8d, 0x6b, 0x4c, 0x63, 0xb2, 0x94, 0xef, 0x7b, 0x75, 0xad, 0x79, 0xce, 0x80, 0x58, 0xe0, 0xba, 0xd6, 0x14, 0xa5, 0x34, 0xa5, 0xd6, 0xbd, 0x59, 0xce, 0xf3, 0xa4, 0x30, 0x84, 0xc2, 0x18,
+  0x42, 0xf4, 0x9c, 0x35, 0xad, 0xe2, 0x18, 0x40, 0xdb, 0xde, 0xbb, 0xde, 0xae, 0x0a, 0x00, 0x12, 0x27, 0x40, 0xb2, 0x9c, 0x34, 0xad, 0xa8, 0x11, 0x40, 0x91, 0x9c, 0x50, 0x94, 0x20, 0x07, 0x30,
+  0x10, 0x8c, 0x92, 0x32, 0x0e, 0x05, 0x02, 0x00, 0x00, 0x94, 0x03, 0x00, 0x1c, 0x07, 0x10, 0x51, 0x1e, 0xaa, 0x01, 0x02, 0x00, 0x0c, 0xbe, 0x11, 0x0b, 0x3a, 0x2e, 0x02, 0x1e, 0x07, 0x0f, 0x8e,
+  0x03, 0x1c, 0x02, 0xa6, 0x4a, 0x04, 0x8e, 0x03, 0x02, 0x0a, 0x40, 0x15, 0xb1, 0xa8, 0x0a, 0x00, 0x52, 0x7c, 0x21, 0xaf, 0xa4, 0xa2, 0x2a, 0x01, 0x0e, 0x07, 0x11, 0xb0, 0xb0, 0x2a, 0x04, 0xd8,
+  0x31, 0x02, 0x40, 0x0e, 0x00, 0x0c, 0x00, 0x18, 0x32, 0x94, 0x03, 0x25, 0xb5, 0x73, 0xc0, 0x4a, 0x24, 0x12, 0xb5, 0x88, 0x3c, 0x11, 0x74, 0x16, 0xc0, 0x02, 0x40, 0x0e, 0x11, 0xb5, 0x44, 0x0e,
+  0x02, 0xc8, 0x18, 0x00, 0xb6, 0x11, 0x00, 0x22, 0x87, 0x00, 0x2e, 0x20, 0x00, 0x4c, 0x0e, 0x00, 0x12, 0x27, 0x02, 0x18, 0x20, 0x02, 0x5a, 0x27, 0x00, 0xae, 0x0a, 0x02, 0x0a, 0x20, 0x02, 0x06,
+  0x00, 0x00, 0xa6, 0x35, 0x10, 0x57, 0xf4, 0x38, 0x02, 0x8a, 0x3c, 0x03, 0xa8, 0x23, 0x12, 0x77, 0x94, 0x3c, 0x12, 0xe6, 0xa6, 0x11, 0x20, 0xd0, 0x53, 0xb2, 0x0a, 0x00, 0x4e, 0xbe, 0x22, 0x0d,
+  0x3b, 0x30, 0x0e, 0x00, 0xdc, 0x3e, 0x11, 0x6e, 0x64, 0xfa, 0x13, 0x73, 0x6c, 0x29, 0x04, 0xda, 0x29, 0x12, 0x6f, 0x48, 0xa9, 0x01, 0xe0, 0x29, 0x02, 0x02, 0xd4, 0x00, 0x10, 0x00, 0x02, 0xd8,
+  0x22, 0x00, 0x22, 0x9b, 0x02, 0x9c, 0x77, 0x01, 0x94, 0xbe, 0x02, 0x2c, 0xf7, 0x03, 0xfc, 0x26, 0x00, 0x48, 0x0d, 0x00, 0x0c, 0x0a, 0x71, 0x57, 0x85, 0x77, 0x8d, 0xd4, 0x74, 0x93, 0x90, 0x18,
+  0x01, 0x66, 0xfe, 0x01, 0xf4, 0x2d, 0x02, 0x1a, 0x1c, 0x02, 0x70, 0x00, 0x20, 0x52, 0x64, 0xc2, 0x0d, 0x01, 0xdc, 0xd3, 0x12, 0x53, 0xcc, 0xda, 0x00, 0x8a, 0x5b, 0x02, 0x5c, 0x4d, 0x30, 0xaf,
+  0x5b, 0xd0, 0xf2, 0x06, 0x01, 0x68, 0xb0, 0x00, 0x3c, 0x46, 0x31, 0xb3, 0x7c, 0xb3, 0x1e, 0x00, 0x22, 0x72, 0x6c, 0xae, 0x03, 0x20, 0xaf, 0x53, 0x46, 0x03, 0x00, 0x56, 0xe2, 0x13, 0xf1, 0xb0,
+  0x0a, 0x00, 0x70, 0x03, 0x30, 0x32, 0x64, 0xd0, 0xc2, 0xe5, 0x03, 0xb6, 0xbb, 0x00, 0x70, 0xe2, 0x00, 0xf0, 0x06, 0x11, 0xac, 0x9c, 0x46, 0x01, 0x6c, 0xdb, 0x20, 0x5b, 0x8f, 0x76, 0x03, 0x05,
+  0xf6, 0x11, 0x20, 0xac, 0x32, 0x4c, 0xa6, 0x00, 0xd6, 0xfe, 0x00, 0x8e, 0xbb, 0x11, 0xd0, 0x1a, 0xb8, 0x00, 0xf0, 0x34, 0x04, 0x58, 0x9f, 0x00, 0x4c, 0xed, 0x00, 0x06, 0x6a, 0x11, 0x94, 0xa0,
+  0xd0, 0x00, 0xb2, 0x9b, 0x00, 0xac, 0xd7, 0x11, 0xb4, 0x18, 0xaa, 0x00, 0x3e, 0xe6, 0x22, 0xed, 0x42, 0x00, 0x7c, 0x22, 0xb1, 0x5b, 0x24, 0xc6, 0x02, 0xc0, 0x18, 0x02, 0xa2, 0x18, 0x01, 0xd6,
+  0x54, 0x02, 0x4c, 0xc6, 0x10, 0x64, 0x98, 0x03, 0x00, 0xf8, 0x2d, 0x00, 0x3e, 0x07, 0x00, 0x1e, 0x00, 0x02, 0x62, 0x15, 0x00, 0xcc, 0x18, 0x00, 0x60, 0xcd, 0x80, 0x4e, 0x53, 0x4b, 0x32, 0x90,
+  0x63, 0x11, 0x6c, 0x94, 0x03, 0x20, 0xd0, 0x63, 0x06, 0x00, 0x00, 0x9a, 0x4a, 0x62, 0x2a, 0x2a, 0xcd, 0x42, 0xed, 0x4a, 0xa0, 0x51, 0x11, 0x2f, 0x5a, 0x63, 0x00, 0x62, 0x2a, 0x80, 0x2e, 0x53,
+  0x8c, 0x42, 0xac, 0x42, 0xed, 0x4a, 0xcc, 0x1f, 0x42, 0xd4, 0x8c, 0x56, 0x9d, 0x98, 0x0a, 0x20, 0xf1, 0x6b, 0xce, 0xbb, 0xf0, 0x01, 0x4e, 0x5b, 0xed, 0x52, 0xac, 0x4a, 0x6f, 0x63, 0xf1, 0x73,
+  0x32, 0x7c, 0x93, 0x84, 0x8f, 0x6b, 0x2c, 0x2a, 0xf0, 0x0f, 0x6d, 0x6b, 0xb2, 0x8c, 0x13, 0x9d, 0x50, 0x84, 0x50, 0x8c, 0x6d, 0x6b, 0xce, 0x7b, 0x10, 0x84, 0xaa, 0x52, 0x69, 0x4a, 0x30, 0x84,
+  0xd2, 0x9c, 0x75, 0xad, 0x17, 0xc6, 0x38, 0xc6, 0x14, 0x35, 0xf0, 0x09, 0x38, 0xce, 0x10, 0x84, 0xf3, 0xa4, 0x96, 0xb5, 0x35, 0xad, 0x76, 0xb5, 0xb7, 0xbd, 0xf8, 0xc5, 0xf8, 0xc5, 0x96, 0xb5,
+  0x72, 0x94, 0xb3, 0x94, 0xc6, 0x0a, 0x40, 0xf7, 0xbd, 0x96, 0xb5, 0x84, 0x2a, 0x11, 0x71, 0x86, 0x3f, 0x00, 0x5c, 0x1c, 0x00, 0xdc, 0x18, 0x11, 0x72, 0x10, 0x07, 0x00, 0x2c, 0x07, 0x21, 0xd3,
+  0xa4, 0x6e, 0x18, 0x03, 0x32, 0xb1, 0x02, 0xce, 0x94, 0x01, 0xb4, 0x2a, 0x07, 0xc2, 0x31, 0x1d, 0x52, 0x1a, 0x07, 0x0f, 0x1c, 0x07, 0x11, 0x2e, 0xb3, 0x94, 0x18, 0x07, 0x08, 0xc4, 0x51, 0x03,
+  0xe4, 0x18, 0x01, 0x90, 0x03, 0x35, 0xcf, 0xac, 0xcf, 0x74, 0x3c, 0x44, 0x6f, 0xa4, 0x2e, 0x94, 0x20, 0x27, 0x01, 0x06, 0x27, 0x01, 0x5e, 0x7c, 0x01, 0xe2, 0x18, 0x02, 0x9a, 0xca, 0x03, 0x1a,
+  0x07, 0x13, 0x32, 0x7a, 0x1c, 0x02, 0xf6, 0x58, 0x02, 0x72, 0x63, 0x02, 0x0e, 0x00, 0x20, 0xd5, 0xcd, 0x30, 0x0e, 0x02, 0x48, 0x55, 0x02, 0x26, 0x40, 0x00, 0xea, 0x51, 0x00, 0x18, 0x0e, 0x00,
+  0x82, 0x23, 0x00, 0x9c, 0x03, 0x00, 0xf4, 0x18, 0x11, 0xf6, 0xb2, 0x43, 0x00, 0xb0, 0x0a, 0x00, 0xa6, 0x2a, 0x22, 0x8c, 0x83, 0x70, 0x35, 0x40, 0x12, 0xb5, 0x90, 0x9c, 0x44, 0x0e, 0x00, 0x06,
+  0x32, 0x00, 0xd0, 0x2a, 0x42, 0x57, 0xd6, 0xb8, 0xe6, 0x92, 0x95, 0x21, 0x94, 0xbd, 0xbe, 0x0a, 0x02, 0x70, 0x15, 0x30, 0xde, 0x78, 0xde, 0x5e, 0x14, 0x00, 0x0e, 0x03, 0x00, 0x02, 0x03, 0x00,
+  0x42, 0x0a, 0x00, 0x60, 0xf3, 0x00, 0xc6, 0xe1, 0x00, 0xba, 0x06, 0x02, 0xda, 0x11, 0x00, 0x62, 0x69, 0x03, 0x6e, 0x49, 0x10, 0x43, 0x92, 0x23, 0x22, 0x33, 0x64, 0x92, 0x0a, 0x00, 0x18, 0xcd,
+  0x01, 0xc0, 0x8c, 0x12, 0x4b, 0x18, 0x26, 0x40, 0x15, 0x7d, 0x56, 0x85, 0xca, 0x18, 0x02, 0xce, 0x1f, 0x00, 0x7e, 0x0a, 0x02, 0x58, 0xf0, 0x10, 0x12, 0xc8, 0x1c, 0x10, 0x74, 0x5c, 0xb7, 0x02,
+  0xfa, 0xc1, 0x20, 0x0e, 0x43, 0x92, 0x14, 0x11, 0xd0, 0x10, 0x03, 0x11, 0x0d, 0x6e, 0x3b, 0x41, 0xb0, 0x53, 0xb4, 0x74, 0xae, 0xd3, 0x01, 0x62, 0xd0, 0x02, 0x1a, 0xbb, 0x11, 0x12, 0x5e, 0x15,
+  0x11, 0xf1, 0x72, 0xde, 0x40, 0xec, 0x3a, 0x2d, 0x43, 0xa4, 0x11, 0x00, 0x2e, 0x03, 0x02, 0xc4, 0x49, 0x00, 0x48, 0x0a, 0x31, 0xab, 0x32, 0x2e, 0xda, 0x18, 0x02, 0x18, 0x00, 0x20, 0x2d, 0x43,
+  0xe2, 0x06, 0x01, 0x12, 0x23, 0x10, 0x3a, 0x16, 0xd4, 0x10, 0x2e, 0xa0, 0x4d, 0x11, 0x4b, 0x88, 0x07, 0x10, 0x5b, 0xfe, 0x0e, 0x20, 0x4f, 0x4b, 0xf2, 0x26, 0x41, 0xcd, 0x3a, 0x8c, 0x32, 0x24,
+  0x9f, 0x01, 0x32, 0x31, 0x00, 0x14, 0x1c, 0x00, 0xe6, 0x1f, 0x02, 0x9c, 0xe9, 0x02, 0x94, 0x74, 0x20, 0x90, 0x53, 0x4e, 0xd4, 0x00, 0x8a, 0x6d, 0x02, 0x1c, 0xd8, 0x10, 0x0d, 0x12, 0x3c, 0x00,
+  0x88, 0x15, 0x21, 0x4b, 0xb0, 0x86, 0x86, 0x00, 0x40, 0x7f, 0x00, 0x12, 0x91, 0x02, 0x66, 0x86, 0x20, 0xb1, 0x5b, 0xf0, 0xa2, 0x10, 0x73, 0xdc, 0xa2, 0x01, 0x7a, 0xad, 0x02, 0xc4, 0xc9, 0x11,
+  0x4f, 0x76, 0x23, 0x00, 0x98, 0x31, 0x00, 0x66, 0x0b, 0x82, 0xb1, 0x5b, 0xb0, 0x5b, 0xad, 0x3a, 0x2f, 0x4b, 0x64, 0x58, 0x00, 0x3e, 0x00, 0x00, 0xce, 0x18, 0x00, 0x24, 0x0e, 0x20, 0x8c, 0x3a,
+  0x02, 0x00, 0x20, 0xb1, 0x5b, 0x56, 0x1c, 0x00, 0xa0, 0x03, 0x00, 0x1c, 0x98, 0x40, 0x0e, 0x4b, 0xed, 0x4a, 0x0a, 0x63, 0x02, 0x5c, 0x4a, 0x00, 0xc8, 0x2d, 0x22, 0x4f, 0x53, 0x6a, 0x5f, 0x00,
+  0x40, 0x00, 0x00, 0x86, 0x0a, 0x02, 0xb8, 0x38, 0x04, 0xa6, 0x5f, 0x11, 0x70, 0x2a, 0x55, 0x80, 0x6f, 0x5b, 0x73, 0x7c, 0x36, 0x95, 0xd5, 0x8c, 0x7c, 0x31, 0x80, 0x31, 0x74, 0x6f, 0x63, 0xed,
+  0x52, 0x8f, 0x63, 0x86, 0x03, 0x20, 0x2d, 0x53, 0xca, 0x18, 0x40, 0xaf, 0x6b, 0x11, 0x74, 0x9c, 0x8d, 0x60, 0x10, 0x74, 0x52, 0x84, 0xf4, 0x94, 0xe8, 0x26, 0xf0, 0x11, 0x8e, 0x6b, 0xce, 0x73,
+  0x2b, 0x63, 0x0f, 0x7c, 0x30, 0x84, 0x0f, 0x84, 0x0f, 0x84, 0xb2, 0x94, 0xca, 0x5a, 0x95, 0xb5, 0x95, 0xb5, 0x2c, 0x63, 0x4d, 0x6b, 0x13, 0xa5, 0x95, 0xb5, 0x50, 0x8c, 0x46, 0x15, 0x00, 0x8e,
+  0x0a, 0x11, 0xf3, 0x20, 0x11, 0x20, 0x55, 0xad, 0xae, 0x9b, 0x00, 0xaa, 0x0a, 0x60, 0x10, 0x84, 0x35, 0xad, 0xd3, 0x9c, 0x44, 0x63, 0xb1, 0xaf, 0x7b, 0x72, 0x94, 0x10, 0x84, 0x92, 0x94, 0xef,
+  0x83, 0x30, 0x4c, 0x71, 0x00, 0x7a, 0x03, 0x13, 0xd3, 0x8a, 0x03, 0x00, 0x9c, 0x3f, 0x00, 0x12, 0x00, 0x02, 0x9c, 0x03, 0x02, 0xbc, 0x8d, 0x11, 0x72, 0x04, 0x00, 0x1d, 0x51, 0xa0, 0x0a, 0x09,
+  0x1e, 0x07, 0x0f, 0x2e, 0x0e, 0x10, 0x0a, 0x16, 0x07, 0x56, 0x93, 0x9c, 0x93, 0x9c, 0x92, 0xac, 0x4a, 0x00, 0xa4, 0x91, 0x07, 0xac, 0x4a, 0x02, 0x90, 0x03, 0x36, 0x11, 0xb5, 0xf0, 0x86, 0x23,
+  0x12, 0xb4, 0x7e, 0x3c, 0x13, 0xb0, 0x1c, 0xc7, 0x11, 0xb0, 0xac, 0x0a, 0x20, 0x6f, 0x9c, 0x04, 0x59, 0x11, 0xb0, 0xde, 0x91, 0x04, 0x9e, 0x03, 0x04, 0x1e, 0x40, 0x02, 0x0c, 0x27, 0x08, 0xae,
+  0x43, 0x04, 0x8e, 0x63, 0x13, 0x12, 0xea, 0x91, 0x00, 0x90, 0x15, 0x00, 0xc0, 0x0a, 0x11, 0xf6, 0x7e, 0x5c, 0x04, 0x6c, 0x15, 0x13, 0xf5, 0xd6, 0x51, 0x00, 0x40, 0x15, 0x00, 0x48, 0x15, 0x02,
+  0xb0, 0x23, 0x20, 0xd5, 0xcd, 0xb4, 0x83, 0x01, 0x12, 0x40, 0x01, 0xb4, 0x0a, 0x01, 0x24, 0x07, 0x01, 0x98, 0x3c, 0x00, 0x1e, 0x07, 0x00, 0xa6, 0x03, 0x00, 0xbc, 0x1e, 0x00, 0x4a, 0x26, 0x00,
+  0x14, 0xfe, 0x00, 0xb6, 0x10, 0x11, 0x32, 0xa8, 0x65, 0x00, 0xbe, 0x06, 0x00, 0x2e, 0x42, 0x42, 0x15, 0x7d, 0x16, 0x7d, 0x62, 0x14, 0x20, 0xf5, 0x7c, 0x5c, 0x03, 0x00, 0xe4, 0x6c, 0x13, 0x73,
+  0x54, 0x38, 0x00, 0xba, 0x11, 0xc0, 0x36, 0x85, 0xf4, 0x74, 0xb3, 0x6c, 0xf4, 0x7c, 0xf4, 0x74, 0x73, 0x6c, 0x62, 0x03, 0x20, 0x6e, 0x43, 0xf0, 0xe8, 0x00, 0xa8, 0x1c, 0x11, 0x4e, 0xa6, 0x06,
+  0x00, 0x20, 0x03, 0x22, 0x8b, 0x2a, 0x8e, 0x06, 0x00, 0x66, 0x03, 0x02, 0x6a, 0x06, 0x00, 0xfa, 0x6c, 0x10, 0x31, 0x00, 0xe2, 0x01, 0x98, 0xbe, 0x00, 0xbe, 0xc5, 0x01, 0xce, 0x06, 0x01, 0x34,
+  0x1c, 0x20, 0xcd, 0x3a, 0xd4, 0xcc, 0x11, 0x52, 0x80, 0x1f, 0x00, 0x68, 0xfe, 0x00, 0x64, 0x90, 0x40, 0x76, 0x8d, 0x15, 0x85, 0x28, 0x5f, 0x00, 0x6c, 0xcc, 0x00, 0x14, 0x07, 0x20, 0x4e, 0x4b,
+  0x30, 0xa9, 0x01, 0x78, 0x31, 0x11, 0x64, 0xd0, 0x49, 0x00, 0x90, 0x90, 0x01, 0x46, 0xa9, 0x00, 0x88, 0x23, 0x00, 0xe8, 0xf3, 0x00, 0x20, 0xbf, 0x13, 0xd1, 0x9e, 0xe9, 0x00, 0x9c, 0x31, 0x00,
+  0xae, 0x1f, 0x00, 0xa8, 0x34, 0x00, 0xee, 0x03, 0x02, 0xae, 0x18, 0x11, 0xd1, 0x92, 0xb4, 0x00, 0x70, 0x11, 0x00, 0xce, 0xa9, 0x00, 0x40, 0x7f, 0x02, 0xd2, 0xb0, 0x11, 0x53, 0x42, 0x18, 0x02,
+  0x26, 0x2e, 0x40, 0x2e, 0x4b, 0xac, 0x3a, 0x0a, 0x3c, 0x11, 0x6f, 0xca, 0x2d, 0x62, 0x0d, 0x43, 0xcd, 0x3a, 0xac, 0x3a, 0x3c, 0x00, 0x04, 0x76, 0xdb, 0x22, 0xb0, 0x5b, 0x0c, 0x83, 0x00, 0x70,
+  0x20, 0x01, 0x58, 0x58, 0x01, 0x9c, 0x00, 0x01, 0x06, 0x9f, 0x01, 0xe6, 0xd7, 0x00, 0xba, 0x03, 0x24, 0x94, 0x7c, 0xd4, 0x26, 0x22, 0x16, 0x8d, 0xc2, 0x94, 0x00, 0x1c, 0x0e, 0x00, 0x30, 0x0e,
+  0x00, 0xa6, 0x26, 0x00, 0x0c, 0x43, 0x13, 0x53, 0xfc, 0xa2, 0x20, 0x0e, 0x4b, 0x76, 0x58, 0x00, 0x2c, 0x91, 0x00, 0x66, 0x2a, 0x02, 0x64, 0x71, 0x11, 0x70, 0x3e, 0x51, 0x00, 0x74, 0x03, 0x20,
+  0x90, 0x63, 0xf8, 0x34, 0x00, 0x54, 0x23, 0x11, 0x94, 0xb8, 0x03, 0x02, 0x6c, 0x51, 0xa0, 0x94, 0x7c, 0xd4, 0x84, 0x36, 0x95, 0x15, 0x8d, 0x52, 0x7c, 0xee, 0x2d, 0x00, 0xa8, 0x3f, 0x00, 0xbc,
+  0x6d, 0x00, 0x14, 0x07, 0xa0, 0x2d, 0x5b, 0xcf, 0x6b, 0x6e, 0x63, 0x4d, 0x5b, 0xaf, 0x6b, 0x2e, 0x91, 0x00, 0xb8, 0x8d, 0x00, 0x32, 0x0e, 0x10, 0xef, 0xf6, 0x0d, 0xf0, 0x06, 0x7b, 0xd2, 0x94,
+  0x0f, 0x7c, 0xd2, 0x9c, 0xb2, 0x94, 0x6c, 0x6b, 0xea, 0x5a, 0x89, 0x52, 0x50, 0x8c, 0x13, 0xa5, 0x34, 0xa5, 0x14, 0x07, 0x80, 0xba, 0xd6, 0x34, 0xa5, 0x30, 0x8c, 0xeb, 0x5a, 0x72, 0x03, 0x00,
+  0x56, 0x15, 0x82, 0x8e, 0x73, 0x8f, 0x73, 0xaf, 0x7b, 0x6e, 0x73, 0xca, 0x3f, 0x82, 0xf0, 0x83, 0x14, 0xa5, 0xb3, 0x9c, 0x72, 0x8c, 0x62, 0x03, 0x00, 0x24, 0x27, 0x00, 0x6a, 0x15, 0x33, 0xf7,
+  0xc5, 0xb3, 0x24, 0xb1, 0x00, 0xa4, 0x66, 0x03, 0x88, 0x03, 0x23, 0x94, 0x71, 0xd4, 0x6d, 0x24, 0x31, 0x8c, 0x3a, 0x0e, 0x11, 0x51, 0xf0, 0xbb, 0x0c, 0xb0, 0x0a, 0x07, 0x66, 0x3c, 0x0f, 0x8e,
+  0x03, 0x19, 0x02, 0x88, 0x03, 0x00, 0xf0, 0x23, 0x03, 0xa2, 0x0a, 0x39, 0x90, 0x9c, 0x91, 0x84, 0xaa, 0x02, 0x90, 0x03, 0x04, 0x1e, 0x07, 0x04, 0x90, 0x63, 0x04, 0xa6, 0x8a, 0x02, 0x1a, 0x07,
+  0x02, 0xdc, 0x51, 0x11, 0x11, 0x14, 0x07, 0x08, 0x2c, 0x07, 0x13, 0x32, 0x58, 0xd5, 0x03, 0x44, 0x4e, 0x07, 0xf2, 0x78, 0x11, 0xb4, 0x42, 0x0e, 0x02, 0x86, 0x4a, 0x02, 0x44, 0x55, 0x22, 0xf5,
+  0xcd, 0x34, 0x07, 0x11, 0xf5, 0xf8, 0x18, 0x02, 0xde, 0x18, 0x02, 0x96, 0x23, 0x00, 0xcc, 0x11, 0x02, 0x1c, 0x27, 0x00, 0x1a, 0xb9, 0x00, 0xc8, 0x0a, 0x02, 0x2c, 0x27, 0x20, 0xf6, 0xcd, 0x84,
+  0x03, 0x00, 0x3a, 0x47, 0x00, 0xd0, 0x6a, 0x00, 0xc4, 0x03, 0x00, 0xb0, 0x0a, 0x00, 0x14, 0x00, 0x00, 0x7e, 0x2e, 0x00, 0x2c, 0x06, 0x11, 0x8f, 0xb6, 0x02, 0x01, 0x70, 0xd3, 0x03, 0x42, 0xec,
+  0x10, 0x4e, 0x46, 0x49, 0x03, 0xf2, 0x22, 0x00, 0x26, 0x07, 0x00, 0xde, 0x18, 0x40, 0xac, 0x2a, 0x11, 0x5c, 0x74, 0x49, 0x00, 0x9e, 0x03, 0x51, 0x72, 0x64, 0xf1, 0x5b, 0x4e, 0xe6, 0xd3, 0x20,
+  0x8a, 0x2a, 0x02, 0x00, 0x91, 0x4d, 0x43, 0x51, 0x64, 0x6e, 0x4b, 0xcf, 0x53, 0xaf, 0xea, 0x14, 0x42, 0xcc, 0x32, 0x8f, 0x53, 0xee, 0x3e, 0x20, 0x4e, 0x4b, 0x84, 0xc5, 0x23, 0xd0, 0x53, 0x74,
+  0x0a, 0xb0, 0x64, 0xd4, 0x7c, 0x52, 0x64, 0xf0, 0x5b, 0x4e, 0x4b, 0x11, 0x5c, 0x72, 0xc9, 0x31, 0xf0, 0x5b, 0x8f, 0x52, 0x19, 0x10, 0x12, 0x66, 0x20, 0x10, 0x53, 0xb0, 0xc5, 0x00, 0x92, 0x0a,
+  0x11, 0x32, 0x74, 0x11, 0x20, 0x11, 0x5c, 0xfc, 0x06, 0x00, 0x0e, 0x15, 0x00, 0x06, 0x00, 0x40, 0x6a, 0x2a, 0xab, 0x32, 0x20, 0x6d, 0x12, 0x2d, 0x12, 0x07, 0x00, 0x4a, 0x15, 0x11, 0x64, 0x14,
+  0x51, 0x01, 0x4c, 0x15, 0x04, 0x1e, 0x20, 0x00, 0xec, 0x49, 0x11, 0xd0, 0xd6, 0xb7, 0x02, 0x5e, 0x31, 0x11, 0x32, 0xc2, 0xd0, 0x02, 0xb0, 0xa9, 0x11, 0x32, 0x6e, 0xbb, 0x00, 0xfc, 0x06, 0x11,
+  0x2e, 0x1c, 0x35, 0x00, 0x2a, 0x23, 0x31, 0xb0, 0x53, 0x33, 0x8c, 0x82, 0x42, 0xb4, 0x7c, 0x74, 0x74, 0x76, 0x11, 0x00, 0x40, 0x03, 0x00, 0x98, 0x11, 0x00, 0x86, 0xe9, 0x11, 0xb5, 0xd4, 0xf7,
+  0x01, 0x3c, 0x78, 0x03, 0x20, 0x3c, 0x00, 0x64, 0x38, 0x02, 0xa2, 0x11, 0x01, 0x2a, 0xad, 0x12, 0x64, 0xd2, 0x2d, 0x11, 0x53, 0x04, 0xaa, 0x00, 0x8c, 0xb4, 0x00, 0xd6, 0x11, 0x01, 0xfc, 0xd7,
+  0x10, 0x6c, 0xaa, 0x0a, 0x00, 0xde, 0x9b, 0x00, 0x02, 0x75, 0x00, 0xde, 0x18, 0x24, 0x32, 0x6c, 0xbc, 0xc9, 0x00, 0xb8, 0x54, 0x11, 0x4f, 0x04, 0xa3, 0x02, 0xb4, 0x38, 0x11, 0xf1, 0x2c, 0x23,
+  0x11, 0x6f, 0x0e, 0x0e, 0x11, 0x11, 0x7a, 0x4a, 0x02, 0x96, 0x5f, 0x22, 0xd1, 0x63, 0xe8, 0x5b, 0x22, 0x70, 0x5b, 0x86, 0xfb, 0x00, 0x46, 0x51, 0x13, 0x32, 0xe4, 0x46, 0x02, 0x88, 0xc6, 0x40,
+  0x37, 0x95, 0x53, 0x74, 0x1e, 0x3c, 0x00, 0x92, 0x31, 0x80, 0x8f, 0x63, 0xb0, 0x63, 0x93, 0x84, 0xd4, 0x8c, 0x66, 0xc6, 0x00, 0x18, 0x3c, 0x40, 0xf0, 0x73, 0x72, 0x84, 0x22, 0x78, 0xf0, 0x03,
+  0xef, 0x73, 0xcf, 0x6b, 0x51, 0x84, 0xf0, 0x73, 0x8e, 0x6b, 0xcf, 0x73, 0xb2, 0x8c, 0xef, 0x73, 0xef, 0x7b, 0x2e, 0x0e, 0xf1, 0x04, 0xee, 0x7b, 0x6c, 0x6b, 0x2f, 0x84, 0x2f, 0x84, 0x0f, 0x84,
+  0x2b, 0x63, 0x30, 0x84, 0x50, 0x8c, 0xef, 0x7b, 0x55, 0xa6, 0x0a, 0x00, 0xfc, 0x14, 0xf0, 0x08, 0xe7, 0x41, 0x28, 0x4a, 0x71, 0x8c, 0x8e, 0x73, 0x8e, 0x73, 0x2c, 0x63, 0xef, 0x7b, 0x72, 0x8c,
+  0x8e, 0x73, 0xcf, 0x7b, 0xf0, 0x83, 0x11, 0xd6, 0x46, 0x01, 0xe0, 0x06, 0x91, 0xf0, 0x83, 0x72, 0x94, 0xcf, 0x7b, 0x35, 0xa5, 0x55, 0xe6, 0x66, 0xb2, 0x14, 0xa5, 0x75, 0xb5, 0x55, 0xb5, 0x72,
+  0x94, 0xd3, 0xa4, 0xb3, 0x0c, 0x07, 0x03, 0x20, 0x07, 0x02, 0x68, 0xbf, 0x02, 0xae, 0x0a, 0x00, 0x38, 0x00, 0x02, 0x22, 0x07, 0x11, 0x52, 0xca, 0x03, 0x0e, 0x20, 0x07, 0x04, 0x1e, 0x07, 0x04,
+  0xe0, 0x18, 0x0f, 0x02, 0x00, 0x0b, 0x02, 0xaa, 0x15, 0x04, 0x36, 0x4e, 0x13, 0x71, 0x8a, 0x03, 0x1b, 0xb1, 0xdc, 0x58, 0x15, 0xd0, 0xc0, 0x31, 0x02, 0x7a, 0xa3, 0x04, 0x0c, 0x00, 0x05, 0x44,
+  0x2e, 0x03, 0x02, 0x20, 0x00, 0xe2, 0x1f, 0x15, 0x11, 0x14, 0x60, 0x22, 0xf1, 0xb4, 0xa8, 0x8a, 0x02, 0x44, 0x0e, 0x02, 0x18, 0x07, 0x17, 0x73, 0x92, 0x03, 0x15, 0xf5, 0xbc, 0x11, 0x13, 0xd5,
+  0x94, 0x23, 0x00, 0xda, 0x18, 0x02, 0x18, 0x0e, 0x02, 0x30, 0x0e, 0x04, 0xda, 0x18, 0x20, 0x77, 0xde, 0xa0, 0x11, 0x02, 0xae, 0x0a, 0x00, 0x52, 0x00, 0x20, 0x57, 0xde, 0x8e, 0x03, 0x00, 0xc6,
+  0x11, 0x02, 0x68, 0x35, 0x00, 0x4c, 0x15, 0x02, 0xb6, 0x2a, 0x20, 0xfa, 0xee, 0x28, 0x07, 0x00, 0xd0, 0x4a, 0x00, 0x1c, 0x59, 0x20, 0xd4, 0x7c, 0xf6, 0x25, 0x00, 0x6c, 0x49, 0x02, 0x1e, 0x07,
+  0x20, 0x11, 0x64, 0xa8, 0x14, 0x01, 0xfa, 0x18, 0x10, 0x5b, 0x0e, 0x00, 0x00, 0x76, 0x15, 0x00, 0x06, 0x19, 0x00, 0x62, 0x34, 0x12, 0xf5, 0x4e, 0x03, 0x11, 0x43, 0xaa, 0x06, 0x30, 0x5b, 0x10,
+  0x5c, 0x04, 0x00, 0xf1, 0x02, 0x72, 0x6c, 0x10, 0x5c, 0x8e, 0x4b, 0xab, 0x32, 0xec, 0x3a, 0x4d, 0x43, 0x0c, 0x3b, 0x0c, 0x3b, 0x4d, 0xca, 0x57, 0x00, 0x62, 0x0a, 0x30, 0x93, 0x74, 0xd4, 0xba,
+  0x03, 0x10, 0x6c, 0x3c, 0x00, 0x02, 0xbc, 0x14, 0xb1, 0xaf, 0x53, 0xcc, 0x32, 0x66, 0x01, 0xab, 0x32, 0xaf, 0x53, 0x2d, 0xe4, 0x57, 0x40, 0x8a, 0x32, 0x0d, 0x43, 0xe6, 0x14, 0x20, 0xd0, 0x53,
+  0x4a, 0x03, 0x12, 0xb0, 0x5a, 0x23, 0x30, 0x4b, 0x11, 0x64, 0x10, 0x0e, 0x00, 0xb0, 0x03, 0x00, 0xfe, 0x06, 0x00, 0x72, 0x54, 0x20, 0x4e, 0x4b, 0x94, 0x03, 0x00, 0x54, 0x4d, 0x00, 0x16, 0x3f,
+  0x11, 0x4e, 0x0c, 0x58, 0x20, 0xcc, 0x3a, 0x3a, 0x43, 0x20, 0xcc, 0x3a, 0x9c, 0x54, 0x10, 0xcc, 0x2c, 0x58, 0x30, 0x3b, 0xac, 0x32, 0x8a, 0x4d, 0x00, 0xfc, 0x1f, 0x02, 0xb2, 0xc9, 0x00, 0xb2,
+  0x03, 0x02, 0xa8, 0xd0, 0x00, 0xa4, 0x23, 0x00, 0x0e, 0x4a, 0x00, 0xaa, 0x0a, 0x02, 0xc8, 0xb0, 0x20, 0xf2, 0x63, 0x48, 0x11, 0x00, 0x1a, 0x23, 0x02, 0x02, 0xa6, 0x20, 0x74, 0x74, 0x58, 0x0a,
+  0x11, 0x74, 0x50, 0xb4, 0x02, 0x6e, 0x38, 0x00, 0xae, 0x6d, 0x00, 0x62, 0x86, 0x00, 0x4e, 0x38, 0x00, 0x54, 0x1c, 0x00, 0xce, 0x03, 0x02, 0x58, 0xbb, 0x00, 0xac, 0x3f, 0x00, 0x98, 0x03, 0x00,
+  0x4a, 0x66, 0x00, 0x8c, 0x1f, 0x11, 0x90, 0xe2, 0x5b, 0x00, 0x74, 0x15, 0x01, 0x50, 0xb4, 0x21, 0x5b, 0xd1, 0xa2, 0x1f, 0x00, 0x54, 0x0a, 0x00, 0x92, 0x1c, 0x00, 0x7c, 0xc6, 0x00, 0x7e, 0x03,
+  0x00, 0xbe, 0x26, 0x02, 0xf2, 0xa2, 0x11, 0x73, 0x32, 0xff, 0x11, 0x12, 0x2a, 0xb8, 0x00, 0x52, 0x78, 0x00, 0x44, 0x00, 0x00, 0xca, 0x1f, 0x20, 0xac, 0x3a, 0x8a, 0x03, 0x00, 0xfa, 0xb0, 0x00,
+  0x66, 0x00, 0x00, 0x7a, 0x5f, 0x02, 0xcc, 0x26, 0x00, 0x76, 0x03, 0x00, 0x08, 0x83, 0x02, 0xa4, 0x58, 0x11, 0xb0, 0x80, 0x4a, 0x00, 0xa2, 0x5f, 0x00, 0xca, 0x5f, 0xa0, 0x53, 0x7c, 0x12, 0x74,
+  0x93, 0x84, 0xf5, 0x8c, 0x52, 0x7c, 0x14, 0x07, 0x00, 0xe6, 0x26, 0x20, 0x6a, 0x42, 0xc8, 0x94, 0xf0, 0x0b, 0x8e, 0x6b, 0x28, 0x3a, 0x0c, 0x53, 0x89, 0x42, 0xcb, 0x4a, 0x8a, 0x4a, 0x2c, 0x63,
+  0xae, 0x6b, 0xef, 0x7b, 0x10, 0x7c, 0x8d, 0x6b, 0x6c, 0x6b, 0xad, 0x73, 0xa8, 0x0a, 0x60, 0x2f, 0x84, 0xee, 0x7b, 0x2b, 0x63, 0x1a, 0x07, 0x60, 0xce, 0x7b, 0x6d, 0x6b, 0xd3, 0x9c, 0x98, 0x11,
+  0x80, 0x71, 0x8c, 0xb2, 0x94, 0xb3, 0x9c, 0x71, 0x8c, 0x7a, 0x23, 0x51, 0xaf, 0x73, 0xef, 0x7b, 0x51, 0x0e, 0x35, 0xa1, 0x8e, 0x73, 0x11, 0x84, 0x72, 0x94, 0xd3, 0x9c, 0xd4, 0x9c, 0xda, 0x5b,
+  0x30, 0x94, 0xd0, 0x7b, 0x22, 0x8a, 0xb0, 0x72, 0x94, 0x55, 0xad, 0xf4, 0xa4, 0x51, 0x8c, 0xf4, 0xa4, 0xf3, 0x26, 0x2e, 0x10, 0x94, 0x18, 0x83, 0x32, 0xb3, 0x9c, 0x51, 0xc0, 0x11, 0x01, 0x80,
+  0x03, 0x04, 0xb6, 0x86, 0x11, 0x72, 0x24, 0x07, 0x02, 0x94, 0x03, 0x02, 0xb2, 0x0a, 0x0e, 0x32, 0x2e, 0x07, 0xb6, 0x2a, 0x0f, 0x1a, 0x07, 0x12, 0x04, 0x8c, 0x03, 0x04, 0xa2, 0x0a, 0x0a, 0x20,
+  0x47, 0x0e, 0xea, 0x38, 0x02, 0xe8, 0x1f, 0x01, 0xb4, 0x91, 0x03, 0x14, 0xa7, 0x00, 0x0a, 0x07, 0x11, 0x8f, 0xb8, 0x0a, 0x04, 0xb6, 0x8a, 0x04, 0xca, 0x11, 0x04, 0x8c, 0x3c, 0x02, 0xae, 0xca,
+  0x02, 0x8a, 0x03, 0x02, 0x36, 0x2e, 0x06, 0x90, 0x4a, 0x02, 0x4e, 0x2e, 0x00, 0x74, 0x03, 0x04, 0x84, 0x03, 0x02, 0x9c, 0x0a, 0x11, 0xf6, 0x36, 0x47, 0x11, 0x33, 0x20, 0x67, 0x00, 0x4e, 0x27,
+  0x11, 0x36, 0x30, 0xa0, 0x04, 0x24, 0x00, 0x22, 0x37, 0xd6, 0xf8, 0x58, 0x00, 0x1e, 0x00, 0x02, 0xde, 0x51, 0x20, 0x37, 0xd6, 0x20, 0x07, 0x80, 0xd9, 0xe6, 0x36, 0xd6, 0xb9, 0xe6, 0xb9, 0xe6,
+  0x9c, 0x15, 0x00, 0xf4, 0x0a, 0x02, 0xd2, 0x09, 0x60, 0x72, 0x6c, 0x92, 0x6c, 0xb3, 0x74, 0x02, 0x00, 0x02, 0xa8, 0x14, 0x00, 0x02, 0x00, 0x00, 0x50, 0x57, 0x20, 0xcf, 0x5b, 0xec, 0x37, 0x20,
+  0x31, 0x64, 0x34, 0x11, 0x00, 0x7a, 0x03, 0x40, 0x6e, 0x4b, 0xcf, 0x5b, 0xc4, 0x49, 0x80, 0xeb, 0x3a, 0xeb, 0x3a, 0x6d, 0x4b, 0x6d, 0x4b, 0x08, 0x00, 0xa0, 0x2c, 0x43, 0x8d, 0x4b, 0x4d, 0x43,
+  0xeb, 0x3a, 0x92, 0x6c, 0x86, 0xd7, 0x00, 0x24, 0x00, 0x20, 0xcb, 0x32, 0x32, 0x03, 0x51, 0x6a, 0x2a, 0x4a, 0x2a, 0xb0, 0x36, 0x18, 0x20, 0x0d, 0x43, 0x44, 0x19, 0x11, 0x6e, 0x12, 0x1c, 0x00,
+  0xa4, 0x18, 0x80, 0x72, 0x6c, 0xcf, 0x5b, 0xd0, 0x5b, 0x72, 0x6c, 0xec, 0x03, 0x00, 0x42, 0x0e, 0x00, 0x56, 0x03, 0x20, 0xb4, 0x74, 0x42, 0x03, 0x00, 0xbe, 0x18, 0x20, 0xf1, 0x5b, 0x10, 0x07,
+  0x00, 0x72, 0x03, 0x00, 0x68, 0x03, 0x02, 0x08, 0x58, 0x31, 0x6e, 0x4b, 0xb0, 0x22, 0x58, 0x40, 0x0d, 0x43, 0xaf, 0x5b, 0xc4, 0x18, 0x20, 0xf0, 0x5b, 0x94, 0x0a, 0x00, 0xe2, 0x03, 0x00, 0xd0,
+  0x1f, 0x00, 0xd4, 0x2d, 0x00, 0x64, 0xfe, 0x00, 0xb8, 0x23, 0x20, 0x32, 0x64, 0xea, 0x2d, 0x00, 0x3c, 0x2a, 0x01, 0x60, 0x7b, 0x50, 0x74, 0xf5, 0x7c, 0x12, 0x64, 0x02, 0xb8, 0x00, 0x02, 0x1c,
+  0x00, 0x22, 0x0e, 0x11, 0x4f, 0x90, 0x18, 0x11, 0x90, 0x4c, 0xcd, 0x30, 0x4f, 0x53, 0xad, 0x9c, 0x46, 0x31, 0x53, 0x70, 0x53, 0xb0, 0x3b, 0x21, 0x53, 0x94, 0x48, 0x0a, 0x02, 0x66, 0x46, 0x00,
+  0x40, 0x07, 0x00, 0x0c, 0x3c, 0x00, 0x1a, 0xb8, 0x10, 0x2f, 0x0e, 0x1c, 0x12, 0x64, 0xce, 0x06, 0x00, 0x36, 0xcd, 0x00, 0xd2, 0xe9, 0x02, 0x84, 0xe9, 0x20, 0x73, 0x74, 0x2c, 0x00, 0x21, 0x90,
+  0x5b, 0x5a, 0x9f, 0x12, 0x84, 0xb2, 0xa9, 0x02, 0x10, 0x1c, 0x00, 0x5c, 0x23, 0x31, 0x33, 0x6c, 0x90, 0xe4, 0x03, 0x00, 0x24, 0x00, 0x02, 0x0a, 0x27, 0x33, 0x6f, 0x53, 0xb0, 0xea, 0x9b, 0x21,
+  0x0d, 0x4b, 0x18, 0xdf, 0x30, 0x63, 0x4f, 0x53, 0x40, 0x91, 0x00, 0x92, 0x0a, 0x00, 0x94, 0x7f, 0x00, 0x7a, 0x9f, 0x00, 0x40, 0x3c, 0x02, 0x12, 0x00, 0x40, 0xac, 0x42, 0xd0, 0x63, 0x80, 0xad,
+  0x01, 0xd6, 0xa2, 0x00, 0xcc, 0x94, 0x10, 0x84, 0xb6, 0x18, 0x82, 0x8b, 0x3a, 0xd0, 0x63, 0x94, 0x84, 0xd1, 0x6b, 0x38, 0x8a, 0xf0, 0x0b, 0x6f, 0x5b, 0x0d, 0x53, 0x6b, 0x3a, 0x29, 0x32, 0xc8,
+  0x29, 0x8b, 0x42, 0xaf, 0x6b, 0xcb, 0x4a, 0x92, 0x8c, 0x51, 0x7c, 0x4d, 0x63, 0xeb, 0x52, 0x2c, 0x5b, 0x06, 0x00, 0x80, 0xeb, 0x52, 0x6d, 0x63, 0xae, 0x73, 0x30, 0x84, 0x54, 0x1c, 0xf1, 0x08,
+  0xad, 0x73, 0xee, 0x7b, 0xee, 0x7b, 0xce, 0x7b, 0x70, 0x8c, 0x70, 0x94, 0xee, 0x83, 0xce, 0x7b, 0xad, 0x73, 0x8d, 0x73, 0xce, 0x7b, 0x0f, 0xfc, 0x34, 0xc0, 0xb2, 0x94, 0xf0, 0x83, 0x10, 0x84,
+  0x30, 0x84, 0xf0, 0x83, 0x92, 0x94, 0xa8, 0xa6, 0x21, 0xaf, 0x7b, 0x06, 0x00, 0xf0, 0x0c, 0x73, 0x72, 0x8c, 0x55, 0xad, 0xb3, 0x94, 0xd0, 0x7b, 0x4e, 0x6b, 0x4d, 0x6b, 0xf0, 0x83, 0xb3, 0x9c,
+  0x76, 0xb5, 0xd4, 0x9c, 0x56, 0xad, 0x76, 0xad, 0x96, 0xb5, 0x5e, 0x3c, 0x00, 0xbc, 0x03, 0x24, 0xb3, 0x9c, 0x86, 0x03, 0x20, 0x51, 0x8c, 0x60, 0x1c, 0x03, 0x6a, 0x1c, 0x01, 0x22, 0x07, 0x01,
+  0x92, 0x43, 0x03, 0x8e, 0x03, 0x02, 0x60, 0x07, 0x1e, 0x31, 0x3a, 0x0e, 0x0a, 0x36, 0x4e, 0x0f, 0xa4, 0x0a, 0x0c, 0x02, 0x90, 0x03, 0x11, 0x71, 0x2c, 0x6e, 0x19, 0x90, 0xfc, 0x7f, 0x5d, 0xaf,
+  0xa4, 0xaf, 0xac, 0xcf, 0xae, 0x4a, 0x13, 0xd1, 0x18, 0x07, 0x04, 0x60, 0x1c, 0x00, 0x46, 0x15, 0x04, 0x6e, 0x1c, 0x01, 0x5a, 0x6e, 0x01, 0x0a, 0x00, 0x02, 0xba, 0xb1, 0x02, 0x78, 0x1c, 0x02,
+  0x92, 0x5c, 0x19, 0x73, 0xac, 0x0a, 0x04, 0x76, 0x5c, 0x02, 0x4e, 0x2e, 0x04, 0x7e, 0xbc, 0x24, 0xd5, 0xcd, 0x88, 0x5c, 0x04, 0x0e, 0x00, 0x00, 0x9a, 0x03, 0x00, 0x02, 0x00, 0x02, 0xd4, 0x0a,
+  0x02, 0xd0, 0x31, 0x00, 0xb8, 0x83, 0x22, 0xb4, 0xc5, 0xd8, 0x18, 0x04, 0x26, 0xb9, 0x00, 0xce, 0x2a, 0x11, 0x37, 0x5c, 0x15, 0x11, 0x36, 0xe8, 0x2a, 0x80, 0xd9, 0xe6, 0x2e, 0x94, 0x74, 0xbd,
+  0xd9, 0xe6, 0xe2, 0x6a, 0x40, 0x4d, 0x43, 0x8e, 0x4b, 0xdc, 0x18, 0xf0, 0x09, 0x0c, 0x3b, 0x2c, 0x43, 0x4d, 0x43, 0x2c, 0x43, 0xcb, 0x3a, 0x0c, 0x43, 0x4d, 0x4b, 0x4d, 0x4b, 0x8e, 0x4b, 0x8e,
+  0x53, 0xcf, 0x5b, 0xef, 0x5b, 0xe8, 0x1b, 0x60, 0x0c, 0x3b, 0xcb, 0x32, 0x0c, 0x3b, 0x04, 0x07, 0x00, 0x6a, 0x69, 0x03, 0x0c, 0x07, 0xf0, 0x08, 0x43, 0xeb, 0x3a, 0x0c, 0x43, 0x2c, 0x43, 0x2c,
+  0x43, 0xaa, 0x32, 0xaa, 0x32, 0x2c, 0x43, 0x6d, 0x4b, 0x0c, 0x3b, 0xcb, 0x3a, 0x6d, 0x4b, 0x4c, 0x62, 0x00, 0x82, 0x77, 0x00, 0xd8, 0x0d, 0x02, 0x7e, 0xd0, 0x00, 0x44, 0x07, 0x00, 0xf0, 0x03,
+  0x70, 0x51, 0x64, 0xf0, 0x5b, 0xcf, 0x53, 0xf0, 0xe4, 0x06, 0x12, 0x3a, 0xa4, 0x03, 0x00, 0x06, 0x4a, 0x00, 0xb8, 0x14, 0x00, 0xea, 0x18, 0x80, 0x0d, 0x43, 0x6b, 0x2a, 0x8f, 0x53, 0xd4, 0x7c,
+  0xbc, 0x30, 0x11, 0x2e, 0xa4, 0x03, 0x11, 0xd0, 0x7e, 0x90, 0x00, 0xa0, 0x03, 0x02, 0x26, 0x0e, 0x00, 0x44, 0x4d, 0x32, 0xf4, 0x84, 0xb3, 0x6e, 0x15, 0x00, 0x7e, 0x7b, 0x01, 0xc2, 0x07, 0x02,
+  0x0c, 0xf4, 0x00, 0x30, 0x0e, 0x00, 0x22, 0x15, 0x00, 0xda, 0x07, 0x13, 0x53, 0x8e, 0x66, 0x02, 0x88, 0x9b, 0x00, 0xa0, 0x3b, 0x11, 0x90, 0x2e, 0x6a, 0x11, 0xad, 0xfe, 0x0d, 0x00, 0xb0, 0xbe,
+  0x20, 0x77, 0x95, 0x8c, 0x1f, 0x02, 0xea, 0x29, 0x00, 0x6c, 0x18, 0x20, 0x16, 0x8d, 0x30, 0x07, 0x00, 0x04, 0xdf, 0x02, 0x02, 0x4a, 0x02, 0x62, 0x11, 0x20, 0xb0, 0x5b, 0x3c, 0x0a, 0x00, 0xfe,
+  0x26, 0x10, 0x73, 0x4e, 0x18, 0x12, 0x7c, 0xce, 0x46, 0x80, 0x32, 0x6c, 0x36, 0x8d, 0x36, 0x8d, 0x12, 0x6c, 0x08, 0x0e, 0x00, 0x02, 0x83, 0x11, 0xcd, 0xa8, 0x26, 0x00, 0x3c, 0x98, 0x00, 0x68,
+  0x07, 0x00, 0x26, 0x35, 0x00, 0xf8, 0x69, 0x02, 0x12, 0x0e, 0x02, 0x80, 0x31, 0x02, 0x94, 0xdb, 0x02, 0x10, 0x27, 0x00, 0xf2, 0x90, 0x02, 0x06, 0x35, 0x02, 0xb6, 0x3f, 0x11, 0x8f, 0xfa, 0x3b,
+  0x00, 0x2e, 0x15, 0x02, 0x32, 0xf8, 0x11, 0x94, 0x3c, 0xf8, 0x00, 0x6e, 0x63, 0x10, 0xb4, 0x44, 0x51, 0x11, 0x84, 0xc8, 0xcd, 0x21, 0x74, 0xd0, 0x28, 0x3c, 0x00, 0xa0, 0x03, 0x60, 0x8b, 0x3a,
+  0x0d, 0x4b, 0xd0, 0x6b, 0xba, 0x8d, 0x20, 0xec, 0x4a, 0x2e, 0x6a, 0x00, 0x02, 0x00, 0x91, 0xec, 0x4a, 0x6e, 0x5b, 0x10, 0x74, 0x51, 0x7c, 0x30, 0x70, 0x2a, 0xe0, 0x6d, 0x63, 0x0c, 0x5b, 0x89,
+  0x4a, 0x6d, 0x63, 0xce, 0x73, 0xce, 0x73, 0x34, 0x9d, 0xd0, 0x18, 0x11, 0xae, 0x76, 0x03, 0x31, 0xce, 0x73, 0x8d, 0x90, 0x03, 0xf0, 0x04, 0x6c, 0x6b, 0xcd, 0x7b, 0xea, 0x5a, 0x2b, 0x6b, 0xad,
+  0x7b, 0x8c, 0x73, 0x0a, 0x63, 0xee, 0x83, 0x6d, 0x6b, 0xef, 0x6c, 0x86, 0x10, 0x8c, 0xa0, 0x11, 0x00, 0xba, 0x11, 0x80, 0x31, 0x8c, 0xd3, 0x9c, 0x76, 0xad, 0xf4, 0xa4, 0x08, 0x07, 0x20, 0xf4,
+  0x9c, 0xf8, 0x82, 0x00, 0x1e, 0x55, 0x40, 0x15, 0xa5, 0xf4, 0xa4, 0x32, 0x5c, 0x00, 0xfc, 0xa9, 0x40, 0x11, 0x84, 0x72, 0x8c, 0x2a, 0x00, 0x42, 0xf4, 0x9c, 0x31, 0x84, 0x14, 0x0e, 0x20, 0x51,
+  0x8c, 0x26, 0x27, 0x55, 0xd3, 0x9c, 0x71, 0x8c, 0x72, 0x8e, 0x03, 0x03, 0xd4, 0x11, 0x03, 0x1a, 0x07, 0x04, 0x5a, 0x15, 0x01, 0x2a, 0x27, 0x09, 0xb2, 0x0a, 0x27, 0x93, 0x94, 0x5c, 0x15, 0x0f,
+  0x1c, 0x07, 0x12, 0x14, 0x92, 0xba, 0x71, 0x03, 0x8e, 0x03, 0x06, 0xbc, 0x11, 0x09, 0x90, 0x03, 0x02, 0x9e, 0xb1, 0x01, 0xd0, 0x18, 0x04, 0x10, 0x60, 0x03, 0xf4, 0x18, 0x11, 0xb4, 0x76, 0x3c,
+  0x34, 0xbd, 0x52, 0xbd, 0x98, 0xaa, 0x15, 0x12, 0x92, 0x03, 0x08, 0x8a, 0xfc, 0x04, 0xde, 0x71, 0x06, 0x1c, 0x07, 0x03, 0x0e, 0x40, 0x03, 0x16, 0x60, 0x06, 0x68, 0x75, 0x02, 0x2a, 0x07, 0x20,
+  0xf5, 0xcd, 0xd0, 0x38, 0x00, 0x0c, 0x20, 0x04, 0x02, 0x00, 0x02, 0xc0, 0x0a, 0x02, 0x2a, 0x2e, 0x02, 0x9e, 0x03, 0x02, 0x8a, 0x03, 0x04, 0xb6, 0x0a, 0x00, 0x78, 0x1c, 0x00, 0xea, 0x4a, 0x40,
+  0x36, 0xd6, 0xd9, 0xe6, 0xd6, 0x11, 0x00, 0xa2, 0x5c, 0x42, 0x6d, 0x4b, 0xef, 0x5b, 0xe8, 0x06, 0x60, 0x4c, 0x4b, 0x8e, 0x53, 0x8d, 0x53, 0x64, 0x03, 0xf2, 0x0d, 0x0b, 0x43, 0x4d, 0x4b, 0x0b,
+  0x43, 0xaa, 0x32, 0x69, 0x2a, 0x69, 0x2a, 0xcb, 0x3a, 0x4d, 0x4b, 0x0c, 0x3b, 0xaf, 0x53, 0xcf, 0x53, 0x4d, 0x4b, 0x6e, 0x4b, 0x4d, 0x43, 0x02, 0x07, 0x00, 0xa6, 0x50, 0x02, 0xe2, 0x65, 0x00,
+  0xe8, 0x14, 0x40, 0xcb, 0x32, 0xec, 0x3a, 0x04, 0x00, 0x40, 0x0d, 0x43, 0x8a, 0x2a, 0x02, 0x66, 0x11, 0xb0, 0x58, 0x62, 0x02, 0x1c, 0x0e, 0x11, 0x4e, 0x9e, 0xd7, 0x00, 0x1c, 0x00, 0x00, 0x32,
+  0x07, 0x40, 0x8b, 0x32, 0x29, 0x22, 0x38, 0x03, 0x00, 0xa8, 0x69, 0x22, 0x32, 0x64, 0xfe, 0x0a, 0x40, 0x8f, 0x53, 0x8b, 0x32, 0x72, 0x0e, 0x11, 0xb0, 0x64, 0x1f, 0x02, 0x1e, 0x1c, 0x00, 0x68,
+  0x7b, 0x00, 0x0c, 0x15, 0x41, 0xed, 0x3a, 0xf1, 0x63, 0x7a, 0x31, 0x03, 0xe2, 0xec, 0x20, 0xcc, 0x3a, 0x12, 0x3f, 0x00, 0x98, 0x15, 0x00, 0x32, 0x94, 0x02, 0x6c, 0x46, 0x10, 0x4f, 0x72, 0xfb,
+  0x70, 0x32, 0xea, 0x19, 0xe9, 0x19, 0x6c, 0x2a, 0x08, 0x07, 0x00, 0x44, 0x2a, 0x00, 0x72, 0x46, 0x02, 0xa2, 0x2a, 0x40, 0xee, 0x42, 0xb1, 0x5b, 0x9c, 0x2d, 0x00, 0x3c, 0x0a, 0x40, 0xf6, 0x84,
+  0x12, 0x6c, 0x18, 0x03, 0x00, 0x24, 0x07, 0x00, 0x36, 0x03, 0x10, 0x70, 0xdc, 0x42, 0x01, 0x2a, 0x1c, 0x11, 0xd5, 0x76, 0xad, 0x02, 0x26, 0x7f, 0x02, 0xa6, 0x5b, 0x04, 0x2c, 0xd4, 0x00, 0x84,
+  0xa2, 0x20, 0x94, 0x74, 0x7c, 0x1c, 0x00, 0x12, 0x07, 0x00, 0x28, 0x2a, 0x00, 0x9c, 0x34, 0x00, 0x88, 0x00, 0x42, 0x88, 0x19, 0xcd, 0x42, 0x5e, 0x58, 0x00, 0x04, 0x07, 0x00, 0x36, 0x15, 0x20,
+  0xb1, 0x5b, 0x3e, 0x2a, 0x00, 0xcc, 0x18, 0x00, 0x30, 0x35, 0x02, 0xaa, 0x46, 0x02, 0xce, 0x94, 0x22, 0x94, 0x7c, 0x18, 0x0b, 0x04, 0xca, 0x3f, 0x20, 0x12, 0x6c, 0x14, 0x35, 0x02, 0xa8, 0x3f,
+  0x00, 0x86, 0xdb, 0x20, 0x36, 0x95, 0x46, 0x4a, 0x04, 0x06, 0x47, 0x00, 0xc6, 0x58, 0x00, 0x88, 0x43, 0x00, 0xd4, 0x86, 0x20, 0x6b, 0x32, 0x3a, 0x5c, 0xf0, 0x01, 0xcc, 0x42, 0x6b, 0x3a, 0xac,
+  0x42, 0xcd, 0x4a, 0x90, 0x63, 0xcd, 0x4a, 0x4f, 0x5b, 0xf1, 0x6b, 0x8a, 0x31, 0x20, 0x72, 0x7c, 0x1e, 0xb1, 0xf0, 0x2b, 0x4d, 0x5b, 0xef, 0x73, 0x8d, 0x63, 0x4c, 0x5b, 0x4c, 0x5b, 0xae, 0x6b,
+  0x0b, 0x5b, 0x4c, 0x63, 0x4c, 0x63, 0x0f, 0x7c, 0x50, 0x84, 0x0f, 0x7c, 0x71, 0x8c, 0x13, 0x9d, 0x2f, 0x7c, 0x70, 0x8c, 0xcd, 0x7b, 0x2f, 0x84, 0x4b, 0x6b, 0xc9, 0x5a, 0x0a, 0x63, 0xad, 0x73,
+  0x0e, 0x84, 0x4b, 0x6b, 0x4f, 0x8c, 0xcd, 0x7b, 0xb1, 0x94, 0xee, 0x7b, 0x6c, 0x73, 0x30, 0x07, 0xc0, 0xad, 0x73, 0xae, 0x7b, 0x6d, 0x73, 0x0b, 0x63, 0xce, 0x7b, 0x51, 0x8c, 0x50, 0x03, 0x00,
+  0x76, 0x11, 0x03, 0x68, 0x4a, 0x50, 0x8c, 0x11, 0x84, 0x31, 0x8c, 0x36, 0x3c, 0xf0, 0x09, 0x10, 0x84, 0xaf, 0x73, 0x10, 0x84, 0x6e, 0x73, 0x4e, 0x6b, 0x0c, 0x63, 0x4d, 0x6b, 0x51, 0x8c, 0x11,
+  0x84, 0xb3, 0x94, 0x31, 0x8c, 0xf0, 0x7b, 0x5e, 0x15, 0x00, 0x0a, 0x00, 0x20, 0x14, 0xa5, 0x74, 0x15, 0x00, 0xb8, 0x51, 0x46, 0x71, 0x8c, 0xb3, 0x9c, 0x80, 0x03, 0x06, 0x9a, 0x03, 0x0a, 0x96,
+  0x03, 0x03, 0xa4, 0x0a, 0x05, 0xa4, 0x03, 0x17, 0x72, 0xa8, 0x2a, 0x0a, 0x0e, 0x00, 0x0f, 0xc4, 0x11, 0x01, 0x13, 0x72, 0x60, 0x1c, 0x04, 0x16, 0x07, 0x0c, 0xaa, 0x0a, 0x15, 0xb0, 0xee, 0x38,
+  0x04, 0x34, 0x8e, 0x01, 0x0c, 0x27, 0x05, 0x14, 0x27, 0x01, 0xc8, 0x9f, 0x04, 0xfe, 0x9f, 0x01, 0xc6, 0x4a, 0x15, 0x32, 0x80, 0x3c, 0x01, 0xc4, 0x11, 0x05, 0x2c, 0x27, 0x04, 0x00, 0x60, 0x17,
+  0xb5, 0x02, 0x00, 0x02, 0xf0, 0x58, 0x02, 0xb6, 0x0a, 0x10, 0x74, 0x62, 0x1c, 0x01, 0xb8, 0x0a, 0x11, 0xf5, 0x0a, 0x19, 0x00, 0x80, 0x03, 0x20, 0x70, 0x9c, 0x5c, 0x15, 0x02, 0x0a, 0x60, 0x04,
+  0x6c, 0x2e, 0x02, 0x0c, 0x39, 0x00, 0x10, 0x19, 0x01, 0x20, 0x47, 0x01, 0x28, 0x07, 0x11, 0x77, 0x1a, 0x39, 0x11, 0x78, 0xe2, 0x8a, 0x00, 0x26, 0x27, 0x60, 0x98, 0xde, 0xd9, 0xe6, 0xb9, 0xe6,
+  0xf2, 0x18, 0xa0, 0xcf, 0x5b, 0x4d, 0x4b, 0x8d, 0x53, 0x6d, 0x4b, 0x2c, 0x43, 0xb8, 0x6c, 0xf1, 0x04, 0x8e, 0x53, 0x6d, 0x53, 0xce, 0x5b, 0xef, 0x5b, 0x30, 0x6c, 0x51, 0x6c, 0x91, 0x74, 0xb2,
+  0x74, 0x51, 0x6c, 0x30, 0xb4, 0x0a, 0x00, 0x1a, 0x00, 0x51, 0x51, 0x6c, 0x8e, 0x53, 0x8e, 0xbc, 0x0d, 0x11, 0x4d, 0x90, 0x03, 0x02, 0x52, 0x46, 0x20, 0x11, 0x5c, 0xba, 0x1c, 0x40, 0xec, 0x3a,
+  0x4e, 0x43, 0xbc, 0x1c, 0x00, 0x3e, 0x19, 0x00, 0x80, 0x0e, 0x00, 0x0c, 0x12, 0x80, 0x6e, 0x4b, 0x8b, 0x2a, 0xed, 0x3a, 0xf0, 0x5b, 0x80, 0x11, 0x62, 0xb3, 0x74, 0x15, 0x85, 0xf4, 0x7c, 0xc0,
+  0x11, 0x00, 0xd2, 0x2d, 0x00, 0xa4, 0x1f, 0x20, 0x0e, 0x43, 0x6c, 0x0a, 0x02, 0x52, 0x23, 0x11, 0x32, 0x4e, 0x15, 0x11, 0x73, 0x6c, 0xf0, 0x02, 0x68, 0xa2, 0x13, 0x33, 0x70, 0xe9, 0x11, 0xb0,
+  0xac, 0xa9, 0x00, 0x2a, 0x07, 0x10, 0xd0, 0x08, 0x12, 0x03, 0x5c, 0xe5, 0x00, 0x84, 0x18, 0x00, 0x1a, 0x15, 0x20, 0x8c, 0x32, 0xe6, 0x90, 0x02, 0xba, 0xa9, 0x00, 0xe0, 0x90, 0x02, 0xa6, 0xa2,
+  0x20, 0xf2, 0x63, 0x22, 0x03, 0x02, 0x16, 0x4a, 0x00, 0x5a, 0x11, 0x00, 0xf0, 0x42, 0x00, 0xba, 0x03, 0x00, 0xb8, 0x2d, 0x00, 0x34, 0x86, 0x00, 0x5c, 0x38, 0x00, 0x8c, 0x0a, 0x11, 0xb4, 0xe8,
+  0xc5, 0x22, 0x53, 0x6c, 0x8c, 0xa9, 0x11, 0xd1, 0xc4, 0x0a, 0x13, 0xf2, 0x4c, 0x18, 0x00, 0xfa, 0x89, 0x40, 0x90, 0x5b, 0xee, 0x42, 0x20, 0x0e, 0x00, 0x66, 0x27, 0x20, 0x32, 0x6c, 0xea, 0x03,
+  0x22, 0x11, 0x64, 0x26, 0x98, 0x00, 0xc2, 0x2d, 0x02, 0x78, 0xbb, 0x01, 0x30, 0x71, 0x10, 0x53, 0x86, 0x07, 0x10, 0x70, 0x32, 0xa3, 0x01, 0xc4, 0xd0, 0x40, 0xb1, 0x63, 0xb1, 0x5b, 0xb6, 0x54,
+  0x11, 0xb1, 0xd0, 0x2d, 0x00, 0xd6, 0x74, 0x20, 0x0d, 0x4b, 0xa4, 0x66, 0x00, 0xe4, 0x1f, 0x00, 0xf8, 0x18, 0x03, 0xf0, 0xf0, 0x00, 0xd8, 0x3f, 0x23, 0x6b, 0xd0, 0xd8, 0xe9, 0x01, 0x28, 0x19,
+  0x01, 0xea, 0xc9, 0x21, 0xb5, 0x7c, 0x74, 0x12, 0x01, 0xee, 0x66, 0x00, 0x46, 0x7c, 0x22, 0x4e, 0x53, 0x64, 0x8a, 0x30, 0x11, 0x6c, 0x8f, 0xbe, 0x7f, 0x50, 0x7c, 0xf5, 0x94, 0x52, 0x7c, 0x50,
+  0xe6, 0xf1, 0x08, 0x8e, 0x63, 0x51, 0x7c, 0x0c, 0x53, 0x8a, 0x42, 0xae, 0x6b, 0x70, 0x84, 0xef, 0x73, 0x0f, 0x7c, 0x89, 0x4a, 0xea, 0x5a, 0x6c, 0x6b, 0x4c, 0xae, 0x11, 0xd1, 0xf2, 0x9c, 0xd2,
+  0x9c, 0x50, 0x8c, 0xd2, 0x9c, 0xea, 0x5a, 0xee, 0x7b, 0x88, 0x15, 0x2a, 0xf0, 0x0d, 0x2e, 0x84, 0x33, 0xa5, 0xee, 0x7b, 0xd1, 0x9c, 0x2f, 0x8c, 0xca, 0x5a, 0x4f, 0x8c, 0x0e, 0x84, 0x4c, 0x6b,
+  0x4b, 0x6b, 0x2b, 0x63, 0xce, 0x7b, 0x8d, 0x73, 0xae, 0x73, 0x86, 0x31, 0x51, 0xef, 0x83, 0xaa, 0x52, 0xaf, 0xc6, 0x18, 0x03, 0x88, 0x98, 0x70, 0x8c, 0xf0, 0x83, 0xaf, 0x7b, 0xd0, 0x7b, 0x80,
+  0x11, 0x00, 0x5a, 0x9f, 0x20, 0x76, 0xad, 0xdc, 0x3f, 0x20, 0x76, 0xb5, 0x16, 0x07, 0x20, 0xf0, 0x83, 0x40, 0x0e, 0x20, 0xb3, 0x9c, 0x3e, 0x03, 0x02, 0x26, 0x07, 0x20, 0xf4, 0xa4, 0x10, 0x40,
+  0x11, 0xb3, 0x0c, 0x00, 0x07, 0xfa, 0x1f, 0x08, 0x0c, 0x07, 0x1f, 0x94, 0x02, 0x00, 0x06, 0x1f, 0x8c, 0x0e, 0x27, 0x0d, 0x09, 0x54, 0x15, 0x00, 0x1e, 0x07, 0x16, 0xa4, 0x8c, 0x43, 0x00, 0xc8,
+  0x51, 0x08, 0x94, 0x43, 0x33, 0x8f, 0xa4, 0xb0, 0xa2, 0x0a, 0x02, 0xc8, 0xb8, 0x03, 0x70, 0xa3, 0x21, 0xac, 0xd0, 0x6c, 0x3c, 0x04, 0x8e, 0x23, 0x06, 0xc4, 0x11, 0x13, 0x32, 0x3a, 0x2e, 0x13,
+  0x32, 0xe2, 0x38, 0x02, 0x7a, 0xdc, 0x06, 0x8e, 0x03, 0x0c, 0x90, 0x03, 0x04, 0xce, 0x11, 0x11, 0xd5, 0x58, 0x15, 0x13, 0xf5, 0x94, 0x0a, 0x02, 0x9e, 0x0a, 0x11, 0xf6, 0x2a, 0x0e, 0x11, 0x94,
+  0x08, 0x0e, 0x00, 0xb2, 0x0a, 0x11, 0x37, 0x8e, 0x0a, 0x00, 0x22, 0x27, 0x02, 0xba, 0x23, 0x11, 0x77, 0x24, 0x27, 0x00, 0x32, 0x07, 0x02, 0x14, 0x59, 0x00, 0xa2, 0x1c, 0x00, 0xa6, 0x0a, 0x20,
+  0x77, 0xde, 0x48, 0x27, 0x00, 0xd6, 0x4a, 0x40, 0x1a, 0xef, 0x8e, 0x53, 0x64, 0x0a, 0x20, 0x6d, 0x4b, 0x18, 0x07, 0x00, 0x84, 0x0a, 0x40, 0xae, 0x5b, 0xf0, 0x63, 0x0c, 0x00, 0xf0, 0x0d, 0x10,
+  0x64, 0xae, 0x53, 0xcf, 0x5b, 0xb2, 0x74, 0x92, 0x74, 0x51, 0x6c, 0x55, 0x8d, 0x96, 0x95, 0xb3, 0x74, 0x2d, 0x43, 0x10, 0x64, 0x92, 0x74, 0x72, 0x6c, 0xd3, 0x74, 0x00, 0x0e, 0x00, 0x6e, 0x18,
+  0x50, 0xf0, 0x5b, 0x11, 0x5c, 0x31, 0x1c, 0x23, 0x10, 0x64, 0x06, 0x00, 0x00, 0xc4, 0x1b, 0x00, 0xd6, 0x34, 0x10, 0xb0, 0x28, 0x5f, 0x01, 0xd4, 0x22, 0x11, 0x11, 0xfe, 0x1b, 0x11, 0x8f, 0x00,
+  0x4a, 0x20, 0xb0, 0x53, 0x12, 0x1c, 0x11, 0xb0, 0x1c, 0x07, 0x02, 0x24, 0x3c, 0x02, 0xda, 0x3b, 0x22, 0x8f, 0x4b, 0x22, 0x58, 0x02, 0x98, 0x38, 0x02, 0x4e, 0xe9, 0x02, 0xb6, 0x1f, 0x02, 0x66,
+  0x0a, 0x21, 0x8c, 0x32, 0x40, 0x31, 0x10, 0x4b, 0xd6, 0x69, 0x30, 0xf1, 0x63, 0x6f, 0xee, 0x1f, 0x03, 0xb4, 0xe5, 0x00, 0x22, 0x12, 0x02, 0x38, 0xa6, 0x00, 0xbe, 0x11, 0x00, 0xc0, 0x03, 0x00,
+  0xf0, 0x35, 0x00, 0x34, 0x00, 0x20, 0xb1, 0x53, 0xd6, 0x34, 0x20, 0x4f, 0x4b, 0xfa, 0x42, 0x00, 0x1c, 0x07, 0x00, 0x22, 0x2a, 0x00, 0xf4, 0x0d, 0x40, 0x57, 0x95, 0x94, 0x7c, 0x40, 0x9f, 0x00,
+  0x60, 0x46, 0x02, 0x10, 0x5f, 0x00, 0xe6, 0x49, 0x00, 0x54, 0x0a, 0x51, 0xf6, 0x84, 0x77, 0x95, 0x94, 0xc8, 0x11, 0x00, 0xee, 0x2d, 0x00, 0x74, 0x46, 0x13, 0x74, 0x14, 0xbf, 0x50, 0x57, 0x8d,
+  0xb4, 0x7c, 0x90, 0xee, 0x14, 0x00, 0x76, 0x38, 0x00, 0x68, 0xc6, 0x41, 0x53, 0x33, 0x74, 0xf2, 0xb4, 0x7b, 0x80, 0xb9, 0x9d, 0x36, 0x8d, 0x77, 0x95, 0x57, 0x95, 0xe6, 0x26, 0x00, 0xc2, 0x18,
+  0x00, 0x4e, 0x2a, 0x02, 0x4a, 0x15, 0x00, 0xd8, 0x18, 0x00, 0xc8, 0x18, 0x00, 0xba, 0xc9, 0xa2, 0x57, 0x95, 0xd9, 0xa5, 0xb8, 0xa5, 0x77, 0x95, 0x36, 0x8d, 0xa0, 0x3f, 0x00, 0xae, 0x66, 0x24,
+  0xd5, 0x84, 0x82, 0x51, 0x00, 0xb0, 0x11, 0x01, 0xe0, 0x66, 0x00, 0xe2, 0x18, 0x21, 0x5b, 0xf1, 0x00, 0x55, 0x00, 0xa2, 0x07, 0x20, 0xb5, 0x84, 0x3c, 0xd8, 0x00, 0x18, 0x07, 0x60, 0xac, 0x42,
+  0x6b, 0x32, 0x2e, 0x53, 0x8c, 0x03, 0x20, 0x2a, 0x32, 0xb4, 0x3f, 0x31, 0xb0, 0x6b, 0x93, 0xb4, 0x9b, 0x80, 0x4e, 0x63, 0x8e, 0x63, 0x8e, 0x63, 0x6d, 0x63, 0x6c, 0xc6, 0x20, 0x13, 0x9d, 0xda,
+  0x1f, 0xc0, 0xee, 0x7b, 0x4c, 0x63, 0x4b, 0x6b, 0x8d, 0x73, 0xb1, 0x94, 0x91, 0x94, 0x68, 0x03, 0xf0, 0x0d, 0xad, 0x73, 0xad, 0x73, 0xce, 0x7b, 0xea, 0x62, 0xa9, 0x5a, 0xa9, 0x5a, 0xee, 0x83,
+  0x8c, 0x73, 0xad, 0x7b, 0xad, 0x7b, 0x4c, 0x6b, 0x8c, 0x73, 0xb1, 0x9c, 0xce, 0x83, 0x0a, 0x00, 0x40, 0x8d, 0x73, 0xad, 0x7b, 0x90, 0x31, 0x20, 0xae, 0x73, 0x44, 0x15, 0x20, 0xef, 0x7b, 0xe6,
+  0x42, 0x00, 0x3e, 0x0e, 0x00, 0x84, 0x0a, 0x00, 0xc4, 0x06, 0x11, 0x92, 0xea, 0x6d, 0xf0, 0x01, 0xd3, 0x9c, 0x52, 0x8c, 0xd0, 0x7b, 0x8e, 0x73, 0x0c, 0x63, 0x6e, 0x73, 0xcf, 0x7b, 0x6e, 0x73,
+  0x22, 0x07, 0x00, 0x0e, 0x07, 0x00, 0xfe, 0x18, 0x00, 0x38, 0x35, 0x00, 0x70, 0x15, 0x72, 0x35, 0xad, 0xf8, 0xc5, 0xb3, 0x9c, 0x31, 0x3e, 0x15, 0x0d, 0x6e, 0x03, 0x0f, 0x8c, 0x03, 0x03, 0x02,
+  0xde, 0x18, 0x00, 0xec, 0x31, 0x0c, 0x24, 0x07, 0x0f, 0xe4, 0x18, 0x0c, 0x02, 0x3c, 0x0e, 0x05, 0x2c, 0x8e, 0x0c, 0xae, 0x4a, 0x13, 0xb0, 0xae, 0x0a, 0x15, 0xd0, 0xae, 0xb1, 0x05, 0x92, 0xca,
+  0x02, 0x86, 0x23, 0x03, 0xd0, 0x11, 0x11, 0xd1, 0xa2, 0x63, 0x00, 0x76, 0x1c, 0x06, 0x7c, 0xdc, 0x0a, 0xaa, 0x63, 0x0e, 0x20, 0x07, 0x02, 0x92, 0x03, 0x02, 0xb6, 0x6a, 0x03, 0x0a, 0x00, 0x03,
+  0xe4, 0x11, 0x00, 0x94, 0x03, 0x00, 0x46, 0x00, 0x00, 0x56, 0x15, 0x00, 0x74, 0x35, 0x20, 0xf5, 0xcd, 0x24, 0x27, 0x00, 0x6e, 0x55, 0x00, 0x3a, 0x47, 0x00, 0x86, 0x03, 0x24, 0xb5, 0xc5, 0x5e,
+  0x4e, 0x00, 0x8e, 0x03, 0x02, 0x48, 0x47, 0x00, 0x86, 0x75, 0x82, 0xf5, 0xcd, 0x6f, 0x9c, 0xb8, 0xe6, 0xb4, 0xc5, 0x10, 0x20, 0x42, 0x90, 0x9c, 0xec, 0x3a, 0x66, 0x77, 0x80, 0x6e, 0x4b, 0x4d,
+  0x4b, 0xaf, 0x53, 0xae, 0x53, 0x60, 0x57, 0x11, 0x4d, 0x6e, 0x1f, 0xa0, 0x49, 0x22, 0x08, 0x1a, 0x49, 0x2a, 0xeb, 0x3a, 0x8a, 0x32, 0x8a, 0x77, 0xa0, 0xef, 0x5b, 0x10, 0x64, 0xd3, 0x7c, 0xf4,
+  0x7c, 0x92, 0x74, 0x96, 0x03, 0xc0, 0x14, 0x85, 0x14, 0x85, 0x15, 0x85, 0xb3, 0x74, 0x14, 0x7d, 0x31, 0x64, 0x92, 0x35, 0x00, 0x72, 0x11, 0x00, 0x5e, 0x1c, 0x80, 0xed, 0x3a, 0x09, 0x22, 0x2a,
+  0x22, 0x4a, 0x2a, 0xa6, 0x18, 0x11, 0xd0, 0x38, 0x19, 0x01, 0x9a, 0x1f, 0x02, 0xb8, 0x5b, 0x12, 0x5b, 0xc0, 0x2d, 0x00, 0x8a, 0x0d, 0x00, 0x6c, 0xd7, 0x00, 0xdc, 0x0d, 0x62, 0xf5, 0x7c, 0x16,
+  0x85, 0x36, 0x85, 0x32, 0xd4, 0x00, 0xdc, 0x14, 0x02, 0xa4, 0x4d, 0x94, 0x2a, 0x22, 0x47, 0x01, 0xe5, 0x00, 0x47, 0x01, 0x0e, 0x06, 0x51, 0x01, 0xde, 0x1b, 0x64, 0x4e, 0x4b, 0x8c, 0x3a, 0x2e,
+  0x4b, 0xd0, 0xec, 0x11, 0x11, 0xa8, 0xb0, 0x02, 0x16, 0x07, 0x00, 0x5e, 0x1c, 0x02, 0x26, 0x51, 0x11, 0x53, 0xac, 0x3f, 0x11, 0x94, 0x18, 0x3c, 0x00, 0x54, 0xcd, 0x00, 0x7c, 0x8d, 0x00, 0x0a,
+  0x00, 0x00, 0x8c, 0xbb, 0x00, 0x28, 0x38, 0x00, 0xa0, 0x11, 0x02, 0x54, 0x4d, 0x00, 0xdc, 0x2d, 0x00, 0xe6, 0x14, 0x11, 0x74, 0x0a, 0xb8, 0x00, 0xe6, 0x18, 0x00, 0x08, 0x00, 0x00, 0x26, 0x23,
+  0x00, 0x62, 0x0a, 0x40, 0x2e, 0x4b, 0x0e, 0x4b, 0x32, 0x51, 0x60, 0x53, 0x74, 0x0e, 0x4b, 0x2f, 0x4b, 0xcc, 0x14, 0x00, 0xf8, 0x0a, 0x00, 0x40, 0x00, 0x00, 0xc4, 0x3f, 0x00, 0xce, 0x0a, 0x00,
+  0x36, 0x1c, 0x06, 0x28, 0x0e, 0x11, 0x32, 0xee, 0xde, 0x11, 0xf1, 0xb2, 0x1f, 0x02, 0xfc, 0x62, 0x11, 0x73, 0x6a, 0x31, 0x02, 0xf6, 0xde, 0x31, 0x11, 0x6c, 0xd1, 0x1a, 0xb1, 0x01, 0xc0, 0x6d,
+  0x00, 0x1c, 0x6a, 0x01, 0x00, 0x12, 0x60, 0xcd, 0x42, 0xee, 0x42, 0xcd, 0x42, 0x6a, 0x00, 0x00, 0xae, 0x7f, 0x00, 0xda, 0x18, 0x20, 0x0e, 0x4b, 0x7a, 0x4a, 0xe0, 0x70, 0x5b, 0x2f, 0x53, 0xee,
+  0x4a, 0x4b, 0x32, 0x4b, 0x32, 0x2f, 0x53, 0x73, 0x7c, 0xb6, 0x11, 0xf0, 0x01, 0xec, 0x4a, 0xa8, 0x21, 0x0d, 0x4b, 0x52, 0x7c, 0x76, 0x9d, 0x15, 0x95, 0x35, 0x9d, 0x72, 0x84, 0xba, 0x3f, 0xf0,
+  0x2b, 0x6d, 0x63, 0x8e, 0x63, 0xef, 0x73, 0x13, 0x9d, 0xae, 0x73, 0x8d, 0x6b, 0x50, 0x84, 0x0b, 0x5b, 0x0f, 0x84, 0xcd, 0x73, 0xa9, 0x52, 0x0a, 0x63, 0x54, 0xad, 0x0f, 0x84, 0xf6, 0xbd, 0x91,
+  0x94, 0xb1, 0x9c, 0x13, 0xa5, 0x0b, 0x63, 0xef, 0x83, 0xad, 0x7b, 0x0e, 0x84, 0xee, 0x83, 0x4c, 0x6b, 0xee, 0x83, 0x2b, 0x6b, 0x2f, 0x8c, 0x8d, 0x7b, 0x6c, 0x73, 0x06, 0x00, 0x31, 0x2f, 0x8c,
+  0xb2, 0x72, 0x2a, 0x40, 0x6d, 0x73, 0xcb, 0x5a, 0x78, 0x0a, 0x00, 0xd2, 0x06, 0x00, 0x60, 0x03, 0x11, 0xb3, 0x84, 0x11, 0x00, 0x06, 0x00, 0x04, 0x14, 0x00, 0x40, 0x8e, 0x73, 0xaf, 0x73, 0x0a,
+  0x00, 0x00, 0xfa, 0x0d, 0x20, 0x10, 0x84, 0x70, 0x43, 0x13, 0x31, 0xe8, 0x54, 0x00, 0x22, 0x00, 0x00, 0xf4, 0x31, 0x81, 0x76, 0xb5, 0x55, 0xad, 0x92, 0x94, 0xcf, 0x7b, 0x56, 0xb8, 0x0c, 0x1e,
+  0x07, 0x0f, 0x02, 0x00, 0x0e, 0x0f, 0xfe, 0x1f, 0x16, 0x03, 0xfc, 0x1f, 0x02, 0xe2, 0x18, 0x08, 0x1e, 0x07, 0x0d, 0x2c, 0x2e, 0x16, 0xb4, 0x0a, 0x00, 0x04, 0x50, 0x35, 0x02, 0x6e, 0x3c, 0x02,
+  0x78, 0x03, 0x02, 0x2a, 0x47, 0x13, 0x32, 0x64, 0xbc, 0x02, 0xce, 0x31, 0x0a, 0x3e, 0x67, 0x06, 0xce, 0x91, 0x0e, 0x90, 0x03, 0x04, 0x08, 0x99, 0x02, 0x52, 0x4e, 0x13, 0xb5, 0x78, 0x1c, 0x02,
+  0x18, 0x80, 0x02, 0x7a, 0x3c, 0x02, 0x82, 0x75, 0x20, 0x37, 0xd6, 0x18, 0x80, 0x42, 0x57, 0xde, 0x90, 0xa4, 0x3c, 0x2e, 0x02, 0x64, 0x15, 0x02, 0x86, 0x03, 0x02, 0x48, 0x2e, 0x00, 0x46, 0x0e,
+  0x00, 0x3c, 0x0e, 0x11, 0x57, 0x2c, 0x07, 0x01, 0xfc, 0x63, 0x32, 0xbd, 0x98, 0xde, 0x56, 0x1f, 0x00, 0xc0, 0x18, 0x00, 0x4e, 0x15, 0x91, 0x31, 0x6c, 0x51, 0x6c, 0xb3, 0x74, 0x31, 0x64, 0x6e,
+  0xce, 0x11, 0x00, 0x8a, 0x2d, 0x20, 0xf0, 0x63, 0xde, 0x6c, 0x00, 0xa4, 0x03, 0x00, 0x3e, 0x07, 0x20, 0xec, 0x3a, 0x16, 0x00, 0x11, 0xcf, 0xa0, 0x77, 0x02, 0x20, 0x1c, 0x02, 0x64, 0x03, 0x00,
+  0xce, 0x06, 0x00, 0xda, 0x1f, 0x00, 0x3a, 0x26, 0x02, 0x42, 0xd0, 0x00, 0xaa, 0x2d, 0x02, 0xd4, 0x57, 0x00, 0xb8, 0xfa, 0x02, 0x26, 0x23, 0x00, 0x70, 0xfe, 0x00, 0x20, 0x0a, 0x00, 0x22, 0x31,
+  0x01, 0x70, 0xbb, 0x01, 0xa8, 0x97, 0x22, 0xd0, 0x5b, 0xd0, 0x42, 0x00, 0x90, 0xa9, 0x02, 0x90, 0x18, 0x00, 0x02, 0x43, 0x02, 0x22, 0x86, 0x12, 0x73, 0x5c, 0xf0, 0x01, 0x26, 0x46, 0x11, 0x36,
+  0x28, 0xbb, 0x02, 0x76, 0x89, 0x11, 0x6f, 0x94, 0xa2, 0x02, 0x24, 0x23, 0x00, 0x70, 0x3c, 0x00, 0xd6, 0x18, 0x33, 0xb5, 0x7c, 0xb4, 0xea, 0x97, 0x00, 0xd8, 0xb0, 0x00, 0x10, 0x0a, 0x00, 0x22,
+  0x51, 0x00, 0xaa, 0x2d, 0x00, 0x30, 0x23, 0x13, 0xb5, 0x68, 0x11, 0x02, 0x80, 0xa2, 0x00, 0xe0, 0x18, 0x04, 0x28, 0x0e, 0x11, 0x94, 0x58, 0x03, 0x02, 0x8c, 0x03, 0x20, 0xd1, 0x63, 0x74, 0x15,
+  0x00, 0x00, 0x1c, 0x00, 0xb0, 0x0a, 0x21, 0x53, 0x74, 0xbe, 0x46, 0x03, 0x18, 0xbf, 0x10, 0xb5, 0x92, 0xad, 0x10, 0x74, 0x50, 0x00, 0x00, 0x20, 0x35, 0x31, 0x13, 0x6c, 0xf2, 0x20, 0x43, 0x11,
+  0x94, 0x08, 0xb1, 0x00, 0x6c, 0xbb, 0x00, 0xae, 0x9b, 0x00, 0xd0, 0x82, 0x02, 0x02, 0x00, 0x11, 0x53, 0x18, 0x00, 0x00, 0x36, 0x23, 0x42, 0x93, 0x7c, 0xd1, 0x63, 0x7a, 0x8d, 0x00, 0xc2, 0x0a,
+  0x00, 0xe2, 0x26, 0x00, 0xf4, 0x5b, 0x02, 0xb6, 0xe2, 0x02, 0xcc, 0x66, 0x31, 0xd4, 0x84, 0x53, 0xb0, 0x86, 0x02, 0x42, 0x07, 0x80, 0xd2, 0x6b, 0xb1, 0x63, 0x53, 0x7c, 0x74, 0x7c, 0x8e, 0x31,
+  0x00, 0x54, 0x98, 0x00, 0x9e, 0x38, 0x80, 0x93, 0x84, 0x97, 0xa5, 0x96, 0xa5, 0x31, 0x7c, 0x88, 0x03, 0x00, 0x74, 0x58, 0xf0, 0x01, 0x2c, 0x5b, 0x6d, 0x63, 0x6c, 0x63, 0xee, 0x73, 0x2b, 0x5b,
+  0x8d, 0x6b, 0x0e, 0x7c, 0xce, 0x73, 0x24, 0x0e, 0x00, 0xb6, 0x11, 0x20, 0x2b, 0x6b, 0x90, 0x9b, 0x80, 0xad, 0x7b, 0x91, 0x94, 0xee, 0x83, 0x8d, 0x73, 0x02, 0x00, 0x70, 0xea, 0x62, 0x4c, 0x6b,
+  0x2b, 0x6b, 0xad, 0xd2, 0x11, 0xf0, 0x08, 0x7b, 0xef, 0x83, 0xee, 0x83, 0xef, 0x83, 0x6d, 0x73, 0x4c, 0x6b, 0x8e, 0x73, 0xeb, 0x62, 0x4d, 0x6b, 0x4c, 0x6b, 0xae, 0x7b, 0xf3, 0xa4, 0xea, 0x0d,
+  0x60, 0xb3, 0x9c, 0xf4, 0xa4, 0xb3, 0x94, 0xee, 0x1f, 0x20, 0x11, 0x84, 0x78, 0x23, 0x00, 0x74, 0x1c, 0x00, 0x7a, 0x1c, 0x00, 0xc4, 0x51, 0x22, 0xb3, 0x94, 0x48, 0x15, 0x51, 0xaf, 0x73, 0x8e,
+  0x73, 0x92, 0x00, 0x1c, 0x20, 0x52, 0x8c, 0xac, 0x0a, 0x10, 0x52, 0xd2, 0x0a, 0x10, 0x73, 0xbc, 0x51, 0x11, 0xcf, 0x10, 0x67, 0x2f, 0x31, 0x8c, 0x1c, 0x07, 0x15, 0x08, 0x18, 0x00, 0x0f, 0x90,
+  0x03, 0x1d, 0x14, 0x92, 0x90, 0x03, 0x01, 0x8e, 0x03, 0x1f, 0xaf, 0xbe, 0x31, 0x09, 0x14, 0xb4, 0x58, 0x15, 0x04, 0x02, 0x00, 0x02, 0x62, 0x55, 0x02, 0x9e, 0x03, 0x06, 0xf8, 0x58, 0x13, 0x32,
+  0x02, 0x79, 0x06, 0x3a, 0x67, 0x08, 0x1c, 0x07, 0x0a, 0x92, 0x03, 0x03, 0x30, 0x67, 0x00, 0xf6, 0x58, 0x03, 0x48, 0xe7, 0x02, 0x32, 0x27, 0x11, 0x73, 0xae, 0x2a, 0x02, 0xf8, 0x31, 0x00, 0x1a,
+  0x0e, 0x04, 0x36, 0x07, 0x33, 0xee, 0x8b, 0xf5, 0xe6, 0x6a, 0x02, 0xa8, 0x43, 0x00, 0x1a, 0x07, 0x03, 0xac, 0x0a, 0x00, 0x96, 0x23, 0x01, 0x82, 0x3c, 0x00, 0x40, 0x0e, 0x00, 0x2a, 0x52, 0x00,
+  0x80, 0x1c, 0x20, 0xb8, 0xe6, 0xd0, 0x30, 0x00, 0x58, 0x03, 0x02, 0x78, 0x26, 0x00, 0x96, 0x26, 0x20, 0x8b, 0x32, 0xae, 0x7e, 0x00, 0x46, 0x31, 0x11, 0xaf, 0x98, 0x26, 0x51, 0xcb, 0x3a, 0x8e,
+  0x53, 0x0c, 0x14, 0x7b, 0x00, 0x1a, 0x07, 0xe0, 0xf4, 0x84, 0x92, 0x74, 0xd0, 0x5b, 0x4d, 0x4b, 0xec, 0x3a, 0x8b, 0x32, 0xec, 0x3a, 0x6c, 0xfe, 0x02, 0x16, 0x5f, 0x10, 0xb0, 0x40, 0x51, 0x01,
+  0xa2, 0x3b, 0x00, 0xcc, 0x06, 0x00, 0x32, 0x11, 0x00, 0x46, 0x2d, 0x11, 0x36, 0xfe, 0x06, 0x02, 0x80, 0xe9, 0x00, 0xf8, 0xd3, 0x00, 0xa8, 0x26, 0x00, 0xfe, 0x29, 0x00, 0x3e, 0x18, 0x13, 0x74,
+  0x02, 0x15, 0x04, 0x2e, 0x86, 0x02, 0x26, 0x24, 0x00, 0xc4, 0x03, 0x02, 0x90, 0x46, 0x02, 0xd0, 0x97, 0x02, 0x36, 0x2d, 0x02, 0x70, 0xd0, 0x00, 0x5c, 0x3c, 0x00, 0x50, 0x03, 0x02, 0xce, 0xec,
+  0x02, 0xa6, 0x90, 0x01, 0xb4, 0x0d, 0x01, 0x64, 0x0a, 0x11, 0x33, 0x70, 0x0e, 0x02, 0x66, 0x07, 0x04, 0x34, 0xc6, 0x00, 0x0c, 0x00, 0x11, 0x33, 0x56, 0xb4, 0x00, 0x8c, 0x06, 0x00, 0xbe, 0x0a,
+  0x00, 0x72, 0x03, 0x11, 0x4f, 0x76, 0x1f, 0x00, 0x74, 0x03, 0x10, 0x53, 0xc0, 0x11, 0x01, 0xa2, 0x66, 0x00, 0xf4, 0x34, 0x03, 0x48, 0xbf, 0x01, 0x26, 0x1c, 0x20, 0xf2, 0x63, 0xae, 0x0a, 0x02,
+  0xa4, 0xf0, 0x11, 0xd5, 0x3e, 0x0a, 0x04, 0x2e, 0xcd, 0x40, 0x74, 0x7c, 0x70, 0x53, 0x0a, 0x43, 0x10, 0xf2, 0xdc, 0x62, 0x01, 0xc2, 0xe9, 0x00, 0x3e, 0x58, 0x11, 0xb4, 0xdc, 0xa9, 0x20, 0x73,
+  0x7c, 0x5a, 0x31, 0x00, 0xc0, 0x1f, 0x02, 0x3a, 0x15, 0x42, 0x53, 0x74, 0x56, 0x95, 0xfa, 0x34, 0x11, 0x73, 0xc2, 0x2a, 0x20, 0x2f, 0x53, 0x52, 0x0e, 0x00, 0xc2, 0x0e, 0x02, 0xf6, 0x4d, 0x40,
+  0xf2, 0x6b, 0xb0, 0x5b, 0xa8, 0x38, 0x20, 0x90, 0x5b, 0x06, 0x9c, 0x00, 0x76, 0x71, 0x00, 0x14, 0x63, 0x91, 0x13, 0x74, 0x53, 0x7c, 0x2f, 0x53, 0x0e, 0x53, 0x12, 0x58, 0x91, 0x40, 0x72, 0x7c,
+  0xb3, 0x84, 0x14, 0x07, 0x00, 0xc4, 0x18, 0xf0, 0x11, 0xeb, 0x52, 0x4c, 0x5b, 0x2f, 0x7c, 0x0f, 0x7c, 0xee, 0x7b, 0x8d, 0x6b, 0xee, 0x73, 0x6c, 0x63, 0x8d, 0x6b, 0x8d, 0x6b, 0x4b, 0x63, 0x4b,
+  0x63, 0x4b, 0x6b, 0xad, 0x7b, 0xea, 0x5a, 0xea, 0x62, 0xfe, 0x06, 0x20, 0x2f, 0x8c, 0x96, 0x03, 0x22, 0x6c, 0x73, 0x7a, 0x03, 0x11, 0x8d, 0xd6, 0x18, 0x60, 0xce, 0x7b, 0x6d, 0x73, 0xae, 0x7b,
+  0xb2, 0x03, 0x40, 0x8e, 0x73, 0x10, 0x84, 0x1e, 0x35, 0x00, 0xde, 0x06, 0x02, 0x9e, 0x18, 0x20, 0x31, 0x84, 0x58, 0x03, 0x20, 0x6e, 0x73, 0xd4, 0x9b, 0x00, 0xc0, 0x11, 0x00, 0x9e, 0x0a, 0x00,
+  0x06, 0x07, 0x00, 0xfe, 0x06, 0x20, 0xb3, 0x94, 0x60, 0x15, 0x00, 0x98, 0xdf, 0x00, 0x86, 0x6a, 0x11, 0x51, 0xe4, 0x11, 0x00, 0x14, 0x6e, 0x02, 0x56, 0x3c, 0x02, 0xca, 0x4d, 0x00, 0x5e, 0x03,
+  0x02, 0x08, 0x12, 0x13, 0x51, 0x0a, 0x00, 0x05, 0x5a, 0x1c, 0x02, 0x7c, 0x03, 0x0f, 0x1a, 0x07, 0x04, 0x0f, 0x20, 0x27, 0x1e, 0x07, 0x90, 0x03, 0x00, 0xc6, 0x91, 0x1f, 0xaf, 0x90, 0x03, 0x07,
+  0x05, 0xf2, 0x3f, 0x08, 0x94, 0x03, 0x02, 0x2e, 0x0e, 0x02, 0x8a, 0x03, 0x0a, 0xe2, 0x71, 0x06, 0xae, 0x0a, 0x0a, 0xaa, 0x0a, 0x04, 0x92, 0x03, 0x07, 0x3c, 0x0e, 0x03, 0xac, 0x0a, 0x12, 0xb4,
+  0x1e, 0x27, 0x01, 0x0a, 0x07, 0x02, 0xea, 0x71, 0x00, 0x0a, 0x39, 0x02, 0x02, 0x20, 0x20, 0x2f, 0x94, 0xde, 0x6a, 0x00, 0x56, 0x15, 0x20, 0x6f, 0x9c, 0x34, 0x0e, 0x20, 0x73, 0xbd, 0x36, 0x07,
+  0x04, 0xd2, 0x31, 0x11, 0xf6, 0x86, 0x1c, 0x12, 0x37, 0xbe, 0x63, 0x12, 0xd6, 0x76, 0x67, 0x00, 0xa0, 0x23, 0x00, 0xc6, 0x0a, 0x00, 0xa6, 0x23, 0x00, 0xc8, 0x1b, 0x02, 0xf2, 0x14, 0x01, 0xea,
+  0x1b, 0x01, 0xdc, 0x88, 0x22, 0x11, 0x64, 0x4a, 0x97, 0x00, 0x1a, 0x15, 0x31, 0x93, 0x74, 0xf4, 0x50, 0x31, 0x20, 0x10, 0x64, 0xbc, 0x8c, 0x00, 0x18, 0x23, 0x02, 0x50, 0x07, 0x02, 0xac, 0x26,
+  0x00, 0x80, 0x11, 0x02, 0xfa, 0x3e, 0x02, 0x6e, 0x46, 0x00, 0x06, 0x00, 0x20, 0x33, 0x6c, 0xe0, 0x10, 0x02, 0x9e, 0x22, 0x00, 0xc4, 0x0d, 0x02, 0xee, 0x9e, 0x02, 0x5c, 0x0a, 0x00, 0x52, 0x6d,
+  0x02, 0xb8, 0x03, 0x13, 0xb0, 0x70, 0x2d, 0x00, 0x7e, 0x03, 0x00, 0x70, 0x11, 0x00, 0x00, 0x38, 0xa2, 0xad, 0x3a, 0xc9, 0x19, 0x4b, 0x2a, 0xad, 0x3a, 0x8c, 0x32, 0xa0, 0x26, 0x21, 0xb0, 0x5b,
+  0xb2, 0x34, 0x00, 0x70, 0x31, 0x01, 0x62, 0x1f, 0x00, 0xfc, 0x02, 0x22, 0x36, 0x8d, 0x90, 0x42, 0x11, 0x73, 0x5c, 0x5b, 0x00, 0x88, 0x18, 0x11, 0xd5, 0xa4, 0x14, 0x04, 0x10, 0x9f, 0x00, 0x32,
+  0x00, 0x02, 0xce, 0xfe, 0x02, 0x9c, 0xd7, 0x00, 0x20, 0x91, 0x00, 0x26, 0xed, 0x00, 0x18, 0x0e, 0x51, 0x98, 0x95, 0x78, 0x95, 0x73, 0x74, 0xd0, 0x00, 0xe8, 0x0d, 0x04, 0x04, 0x2a, 0x10, 0x73,
+  0xc6, 0x03, 0x01, 0xe0, 0xc9, 0x02, 0x86, 0x46, 0x04, 0xca, 0xfe, 0x60, 0x90, 0x5b, 0x4b, 0x32, 0x2e, 0x4b, 0x5c, 0x18, 0x22, 0x90, 0x5b, 0x98, 0xc9, 0x02, 0x6e, 0x5f, 0x00, 0x1e, 0x00, 0x11,
+  0x74, 0x24, 0x3c, 0x00, 0x86, 0x00, 0x02, 0x4e, 0x9f, 0x01, 0x58, 0xad, 0x10, 0x84, 0x5e, 0x86, 0x11, 0xd1, 0x42, 0xaa, 0x20, 0xb0, 0x63, 0xa0, 0x18, 0x00, 0x80, 0x8d, 0x40, 0x6b, 0x3a, 0xed,
+  0x4a, 0xc2, 0x46, 0x00, 0xf0, 0x82, 0x00, 0x6c, 0xcd, 0x00, 0x74, 0x51, 0x31, 0x95, 0x7c, 0xb1, 0x98, 0x15, 0x01, 0x60, 0x2e, 0x00, 0x72, 0x43, 0x14, 0x74, 0xf4, 0x0a, 0x00, 0xd2, 0x0a, 0x00,
+  0x3e, 0x6a, 0xe2, 0x2e, 0x53, 0xb4, 0x84, 0x16, 0x95, 0x36, 0x9d, 0x16, 0x95, 0xd0, 0x6b, 0x0c, 0x53, 0xa0, 0x0a, 0xf0, 0x03, 0x71, 0x84, 0x30, 0x7c, 0x91, 0x8c, 0x0e, 0x7c, 0x70, 0x84, 0x90,
+  0x8c, 0xad, 0x73, 0x8c, 0x6b, 0x0a, 0x5b, 0x20, 0x15, 0x40, 0x4f, 0x84, 0xb1, 0x94, 0x3a, 0x15, 0x00, 0xc8, 0x18, 0xa0, 0x2b, 0x6b, 0x0b, 0x63, 0x23, 0x29, 0xea, 0x62, 0x50, 0x8c, 0x80, 0x03,
+  0x31, 0x8d, 0x73, 0x30, 0xb8, 0x3f, 0x71, 0xce, 0x7b, 0x30, 0x8c, 0xce, 0x7b, 0xef, 0xf2, 0x26, 0x00, 0x64, 0x1c, 0x20, 0x51, 0x8c, 0x78, 0x03, 0x01, 0x96, 0xdb, 0x00, 0xe4, 0x06, 0x10, 0x7b,
+  0x0a, 0x9c, 0x02, 0xb4, 0x06, 0x22, 0x11, 0x84, 0x44, 0x63, 0x02, 0x44, 0x0e, 0x00, 0x42, 0x15, 0x00, 0x94, 0x03, 0x00, 0x2e, 0x7c, 0x00, 0x42, 0x07, 0x00, 0x4c, 0x15, 0x00, 0xae, 0xad, 0x00,
+  0x0c, 0x00, 0x00, 0x44, 0x00, 0x00, 0xf4, 0x11, 0x00, 0xca, 0x58, 0x02, 0x88, 0x03, 0x12, 0x52, 0x9a, 0x15, 0x0f, 0xa6, 0x0a, 0x14, 0x06, 0x8e, 0x03, 0x1f, 0x73, 0x98, 0x03, 0x1a, 0x06, 0x40,
+  0x0e, 0x17, 0x90, 0x58, 0x15, 0x0e, 0x8c, 0x03, 0x07, 0x5e, 0xbc, 0x03, 0xf0, 0x1f, 0x09, 0xc0, 0x11, 0x31, 0xbd, 0x73, 0xc5, 0xf0, 0x18, 0x25, 0xb5, 0x52, 0x24, 0x47, 0x13, 0x53, 0x5a, 0x8e,
+  0x05, 0x68, 0x75, 0x03, 0x42, 0xae, 0x06, 0x90, 0x03, 0x02, 0xa6, 0x0a, 0x02, 0x26, 0xa0, 0x02, 0x52, 0xce, 0x13, 0xf5, 0x66, 0x35, 0x11, 0x94, 0x82, 0x4e, 0x02, 0x38, 0x40, 0x02, 0x98, 0x9c,
+  0x00, 0xce, 0x7c, 0x40, 0x98, 0xe6, 0xd5, 0xcd, 0x42, 0x0e, 0x02, 0xc6, 0x11, 0x13, 0xf5, 0xae, 0x63, 0x11, 0x37, 0xac, 0x63, 0x00, 0xb6, 0x23, 0x00, 0xce, 0x0a, 0x02, 0x4c, 0x0e, 0x11, 0x98,
+  0x22, 0x20, 0x00, 0x66, 0x15, 0x24, 0xb9, 0xe6, 0x78, 0x11, 0x01, 0x78, 0x70, 0x01, 0xd0, 0x65, 0x02, 0x8a, 0xda, 0x40, 0x11, 0x5c, 0x11, 0x64, 0x96, 0x3b, 0x02, 0x30, 0x07, 0x60, 0x4a, 0x2a,
+  0x0d, 0x43, 0x31, 0x64, 0x4a, 0xbe, 0x31, 0xb3, 0x74, 0x8f, 0x44, 0xe9, 0x00, 0x9a, 0x34, 0x00, 0xe4, 0x8c, 0x00, 0x2e, 0x4d, 0x22, 0x12, 0x64, 0x90, 0x11, 0x02, 0x66, 0x46, 0x11, 0xf2, 0x1c,
+  0xf0, 0x02, 0x1e, 0x38, 0x00, 0xc6, 0x0a, 0x00, 0xf2, 0x22, 0x02, 0x2a, 0x66, 0x00, 0x28, 0x15, 0x00, 0x70, 0x0a, 0x00, 0xce, 0xa5, 0x00, 0x56, 0x0a, 0x11, 0xd1, 0x40, 0xc9, 0x00, 0x50, 0x46,
+  0x13, 0x70, 0x40, 0x2a, 0x02, 0xde, 0x06, 0x00, 0x82, 0x1f, 0xa2, 0xed, 0x42, 0x4a, 0x2a, 0x06, 0x01, 0x05, 0x01, 0xa8, 0x19, 0xe2, 0x10, 0x02, 0x8e, 0xbe, 0x02, 0xde, 0x06, 0x02, 0xfe, 0xac,
+  0x13, 0x32, 0x30, 0xe9, 0x10, 0x0d, 0x0a, 0xd4, 0x01, 0x90, 0x54, 0x00, 0xd8, 0x38, 0x20, 0xac, 0x3a, 0x94, 0x2a, 0x00, 0x08, 0x2a, 0x00, 0xa6, 0x0e, 0x00, 0xea, 0x0a, 0x11, 0x74, 0xd2, 0xc9,
+  0x00, 0x86, 0x18, 0x11, 0x70, 0x9e, 0x06, 0x00, 0x00, 0x4a, 0x02, 0xf4, 0x42, 0x00, 0x32, 0x8d, 0x20, 0x12, 0x64, 0x6e, 0x00, 0x10, 0xd1, 0x1e, 0x03, 0x03, 0xe2, 0x14, 0x00, 0x20, 0x20, 0x02,
+  0xb0, 0x4d, 0x01, 0x04, 0x35, 0x00, 0x46, 0xfb, 0x12, 0x8c, 0xc8, 0xa9, 0x00, 0xe2, 0xb0, 0x00, 0xac, 0x5f, 0x02, 0x16, 0x19, 0x00, 0x10, 0x04, 0x00, 0xc8, 0x62, 0x02, 0x7e, 0x3f, 0x11, 0x11,
+  0x8e, 0x00, 0x00, 0x02, 0x2e, 0x00, 0xf4, 0x69, 0x81, 0xb0, 0x63, 0xac, 0x42, 0x6f, 0x5b, 0x36, 0x95, 0x50, 0x7f, 0x01, 0xb0, 0x3f, 0x11, 0x33, 0x16, 0x35, 0x02, 0xd8, 0x7b, 0x40, 0x54, 0x74,
+  0x94, 0x7c, 0xd2, 0x51, 0x00, 0x46, 0x40, 0x00, 0x1a, 0x07, 0x00, 0xba, 0x66, 0x20, 0xcd, 0x42, 0x30, 0x0b, 0x00, 0xf4, 0x03, 0x00, 0xa6, 0x0a, 0xa0, 0x56, 0x9d, 0x15, 0x95, 0xf1, 0x6b, 0xcc,
+  0x4a, 0x4a, 0x3a, 0x48, 0x43, 0xf0, 0x13, 0xae, 0x6b, 0x6d, 0x63, 0xca, 0x52, 0x8d, 0x6b, 0xad, 0x6b, 0x8c, 0x6b, 0x4f, 0x84, 0xac, 0x6b, 0x67, 0x4a, 0x4b, 0x63, 0xed, 0x7b, 0x0e, 0x7c, 0x2b,
+  0x63, 0x47, 0x4a, 0x06, 0x42, 0x4b, 0x6b, 0x0a, 0x63, 0xd6, 0x18, 0xf0, 0x01, 0x0b, 0x63, 0x8d, 0x73, 0x4c, 0x6b, 0x0f, 0x8c, 0x6d, 0x73, 0x91, 0x94, 0x2c, 0x6b, 0x8d, 0x73, 0xea, 0x1f, 0x00,
+  0x84, 0x03, 0x20, 0xef, 0x7b, 0x86, 0x03, 0x40, 0xaf, 0x7b, 0xcf, 0x7b, 0x82, 0x0a, 0x00, 0x94, 0x11, 0x00, 0x48, 0x15, 0x00, 0x3e, 0x15, 0x00, 0xf4, 0x74, 0x00, 0xae, 0x11, 0x00, 0x0e, 0x00,
+  0x00, 0x8a, 0x03, 0x00, 0xfa, 0x06, 0x00, 0x94, 0x23, 0x00, 0x8e, 0x03, 0x00, 0xe2, 0x18, 0x60, 0x31, 0x8c, 0xaf, 0x73, 0x4d, 0x6b, 0xcc, 0x11, 0x20, 0x8e, 0x73, 0xec, 0x18, 0x40, 0x6e, 0x73,
+  0xaf, 0x73, 0x00, 0x19, 0x00, 0x28, 0x00, 0x20, 0xd4, 0x9c, 0xaa, 0x71, 0x22, 0x31, 0x8c, 0x22, 0x07, 0x20, 0x31, 0x8c, 0xd4, 0x03, 0x0b, 0x76, 0x23, 0x0f, 0x8e, 0x03, 0x0e, 0x02, 0x0a, 0x00,
+  0x0f, 0xba, 0x0a, 0x19, 0x10, 0x92, 0x8c, 0x47, 0x29, 0x9c, 0x70, 0x9a, 0x63, 0x08, 0xe2, 0x38, 0x02, 0x4a, 0x15, 0x06, 0xa4, 0xaa, 0x02, 0x3c, 0x0e, 0x04, 0x7e, 0x43, 0x06, 0x92, 0x03, 0x42,
+  0xb0, 0xac, 0x4f, 0x9c, 0x82, 0x1c, 0x2a, 0x53, 0xbd, 0x78, 0x75, 0x08, 0x1e, 0x07, 0x11, 0x95, 0x02, 0x00, 0x0a, 0x42, 0x0e, 0x00, 0x72, 0x03, 0x02, 0x28, 0x47, 0x00, 0xae, 0x31, 0x02, 0x70,
+  0x35, 0x04, 0x58, 0x55, 0x00, 0x6a, 0x35, 0x20, 0x90, 0xa4, 0xa0, 0x03, 0x00, 0x1e, 0x00, 0x00, 0x52, 0x6e, 0x20, 0x90, 0xa4, 0x54, 0x00, 0x26, 0xcd, 0x8b, 0x94, 0x1c, 0x02, 0x1c, 0x59, 0x11,
+  0xd5, 0x5c, 0x0e, 0x04, 0x08, 0x32, 0x20, 0x36, 0xd6, 0x22, 0x07, 0x01, 0x3c, 0x59, 0x10, 0xde, 0xb0, 0x26, 0x12, 0x2e, 0x58, 0xec, 0x00, 0x0c, 0x0a, 0x10, 0x7c, 0x6c, 0x0a, 0x22, 0xcd, 0x3a,
+  0xd4, 0x30, 0x00, 0x14, 0x2e, 0x00, 0xae, 0x3b, 0x00, 0xcc, 0x26, 0x02, 0x74, 0x3f, 0x00, 0xa0, 0x49, 0x00, 0xf2, 0x30, 0x00, 0x3c, 0x2a, 0x03, 0xd4, 0x29, 0x63, 0x64, 0xb1, 0x5b, 0xad, 0x3a,
+  0x70, 0x78, 0x03, 0x00, 0x3c, 0x0a, 0x11, 0xd5, 0x4c, 0x18, 0x51, 0xf5, 0x84, 0x16, 0x85, 0x53, 0x12, 0xdb, 0x02, 0x30, 0x07, 0x00, 0xa2, 0x0a, 0x02, 0xe8, 0xd3, 0x00, 0xf2, 0xa5, 0x00, 0x96,
+  0x03, 0x01, 0x2e, 0x5b, 0x00, 0x8c, 0x49, 0x10, 0x53, 0x1a, 0xbb, 0x01, 0x16, 0x03, 0x01, 0x60, 0x15, 0x02, 0xc6, 0x3b, 0x00, 0x08, 0x0e, 0x00, 0xc0, 0x14, 0x02, 0x9a, 0x14, 0x02, 0xae, 0x42,
+  0x22, 0x53, 0x74, 0xba, 0x42, 0x00, 0x18, 0xdb, 0x11, 0xb4, 0x18, 0x3f, 0x02, 0x5a, 0xc9, 0x02, 0xb6, 0x62, 0x11, 0xb0, 0x9c, 0x06, 0x00, 0x36, 0x00, 0x40, 0x98, 0x9d, 0x98, 0x9d, 0x26, 0x00,
+  0x00, 0x2c, 0x00, 0x02, 0x8c, 0xc9, 0x02, 0x56, 0x4d, 0x11, 0x53, 0x02, 0x07, 0x11, 0xb5, 0x46, 0x8d, 0x00, 0x4c, 0x31, 0x02, 0xf4, 0x34, 0x00, 0xf8, 0xc9, 0x00, 0x00, 0x71, 0x00, 0x1e, 0x04,
+  0x02, 0xf6, 0xd0, 0x02, 0xa8, 0x46, 0x11, 0xb4, 0x3c, 0x9f, 0x02, 0xca, 0x4d, 0x22, 0xcc, 0x42, 0x5a, 0x78, 0x11, 0x12, 0xcc, 0xc2, 0x00, 0x92, 0x03, 0x02, 0x70, 0xdb, 0x02, 0xa8, 0x15, 0x10,
+  0x2e, 0x3a, 0xb1, 0x10, 0x7c, 0x02, 0x63, 0x02, 0x6c, 0x23, 0x51, 0x0e, 0x4b, 0xf1, 0x6b, 0x74, 0xfa, 0x18, 0x11, 0x53, 0x00, 0x20, 0x00, 0x5c, 0x07, 0x31, 0xb1, 0x63, 0x95, 0x84, 0x00, 0x00,
+  0x0e, 0x19, 0x00, 0x10, 0x19, 0x40, 0x8c, 0x3a, 0x0e, 0x4b, 0x0c, 0x00, 0x00, 0x8c, 0x51, 0x00, 0x38, 0x00, 0x00, 0x4c, 0x98, 0x02, 0xe2, 0x1f, 0x00, 0x0c, 0x87, 0x00, 0x96, 0xd4, 0x20, 0xcf,
+  0x6b, 0x02, 0x00, 0x20, 0x8e, 0x6b, 0x18, 0x07, 0xf0, 0x09, 0xce, 0x73, 0xee, 0x73, 0x70, 0x84, 0x2f, 0x84, 0x4f, 0x84, 0x6b, 0x6b, 0x4f, 0x8c, 0x2e, 0x84, 0xac, 0x73, 0xcd, 0x7b, 0x0a, 0x5b,
+  0x6b, 0x6b, 0xfa, 0x26, 0x20, 0x2f, 0x84, 0xbe, 0x18, 0xf0, 0x03, 0x2f, 0x84, 0x6c, 0x6b, 0x91, 0x94, 0xae, 0x7b, 0x8d, 0x73, 0x6d, 0x73, 0x10, 0x84, 0xef, 0x83, 0xef, 0x7b, 0xe8, 0x1f, 0x00,
+  0x02, 0x00, 0x00, 0x92, 0x03, 0x20, 0xf0, 0x7b, 0x80, 0x0a, 0x00, 0x7e, 0x0a, 0x00, 0x06, 0x00, 0x04, 0xcc, 0xe9, 0x11, 0x52, 0x2a, 0xa3, 0x20, 0xf5, 0xa4, 0x0e, 0x27, 0x00, 0x2a, 0x15, 0x00,
+  0x86, 0x0a, 0x00, 0x04, 0x00, 0x22, 0x8e, 0x73, 0x9e, 0x0a, 0x00, 0x02, 0x00, 0x00, 0x84, 0x1c, 0x20, 0x52, 0x8c, 0x7a, 0x15, 0x04, 0xee, 0x34, 0x01, 0x7e, 0x03, 0x00, 0xc2, 0x78, 0x10, 0x83,
+  0x76, 0x03, 0x01, 0x36, 0x00, 0x02, 0xe4, 0x11, 0x17, 0x94, 0x24, 0x2e, 0x1f, 0x94, 0xd2, 0x11, 0x13, 0x04, 0x94, 0x03, 0x04, 0x10, 0x20, 0x1f, 0x73, 0xce, 0x31, 0x0c, 0x02, 0x0e, 0xee, 0x00,
+  0x9a, 0x23, 0x05, 0xaa, 0x8a, 0x0c, 0x34, 0x0e, 0x07, 0x1a, 0x07, 0x08, 0x40, 0x0e, 0x11, 0x12, 0xbe, 0x11, 0x04, 0xb0, 0x0a, 0x01, 0x88, 0x03, 0x14, 0xbd, 0x48, 0x2e, 0x04, 0x24, 0x07, 0x06,
+  0x76, 0x1c, 0x00, 0xba, 0x6a, 0x00, 0x20, 0x07, 0x04, 0x24, 0x07, 0x01, 0x12, 0x60, 0x03, 0x7c, 0x03, 0x00, 0x92, 0xf5, 0x03, 0x9a, 0x83, 0x21, 0xc5, 0xb5, 0xdc, 0x4a, 0x02, 0xa6, 0x83, 0x00,
+  0x58, 0x79, 0x00, 0x30, 0x15, 0x20, 0x4f, 0x9c, 0xbc, 0x83, 0x20, 0x73, 0xbd, 0x4a, 0x15, 0x02, 0x84, 0x95, 0x02, 0xfe, 0x1f, 0x26, 0x16, 0xce, 0x18, 0x59, 0x20, 0x78, 0xde, 0xda, 0x31, 0x40,
+  0xb1, 0xa4, 0x78, 0xde, 0x98, 0x1c, 0x00, 0x56, 0x59, 0x00, 0x7e, 0x1c, 0x00, 0x30, 0x07, 0x11, 0x4e, 0x5e, 0x03, 0x00, 0x92, 0x03, 0x00, 0xc6, 0x1b, 0x00, 0xcc, 0x50, 0x04, 0x02, 0x3c, 0x40,
+  0xd4, 0x7c, 0x36, 0x85, 0xb6, 0x77, 0x31, 0x52, 0x64, 0x52, 0x44, 0x58, 0x10, 0x52, 0x6a, 0x3b, 0x01, 0x66, 0x54, 0x00, 0x6c, 0x11, 0x00, 0x1a, 0x15, 0x00, 0x6c, 0x58, 0x40, 0xd9, 0x9d, 0x37,
+  0x8d, 0xbe, 0x14, 0x00, 0x86, 0x69, 0x02, 0x4e, 0x5b, 0x00, 0xe4, 0x14, 0x02, 0x2e, 0xe2, 0x11, 0xf2, 0x88, 0xb7, 0x00, 0x6c, 0x11, 0x00, 0xf4, 0x02, 0x00, 0x68, 0x03, 0x00, 0xe4, 0x0d, 0x00,
+  0x88, 0x0d, 0x00, 0xc8, 0x54, 0x00, 0x2e, 0x0a, 0x02, 0xea, 0x0a, 0x00, 0xc2, 0x06, 0x11, 0xb5, 0xfe, 0xfa, 0x02, 0xe0, 0x69, 0x02, 0x6c, 0x35, 0x02, 0x2e, 0x23, 0x00, 0x64, 0x2d, 0x02, 0x8c,
+  0x06, 0x02, 0x80, 0x18, 0x00, 0x50, 0x03, 0x20, 0x77, 0x95, 0x0c, 0x11, 0x02, 0x8a, 0x62, 0x00, 0x88, 0x34, 0x00, 0x86, 0x06, 0x00, 0xee, 0x11, 0x04, 0x00, 0xd4, 0x22, 0xd1, 0x63, 0x1e, 0x38,
+  0x20, 0xed, 0x42, 0x38, 0x07, 0x00, 0x4e, 0x07, 0x11, 0xee, 0x44, 0x23, 0x11, 0x70, 0x5a, 0x07, 0x11, 0xf1, 0xea, 0x1f, 0x10, 0xf5, 0x8a, 0x2d, 0x14, 0x63, 0x22, 0x2e, 0x00, 0x12, 0x08, 0x00,
+  0x4a, 0x04, 0x13, 0xf1, 0x0c, 0x1c, 0x00, 0x9a, 0x03, 0x12, 0x32, 0xd2, 0x1f, 0x01, 0x48, 0x86, 0x00, 0x32, 0x1c, 0x02, 0x30, 0x19, 0x01, 0xbe, 0x3f, 0x01, 0xdc, 0xd0, 0x00, 0x1c, 0xbf, 0x00,
+  0x4e, 0x00, 0x00, 0x76, 0x0a, 0x02, 0xd2, 0x4d, 0x00, 0x4a, 0x0e, 0x01, 0x3a, 0x07, 0x21, 0x6b, 0x6f, 0x2e, 0x8a, 0x00, 0x3a, 0x35, 0x00, 0x70, 0x03, 0x02, 0x18, 0x8a, 0x00, 0x58, 0x91, 0x02,
+  0x22, 0x0b, 0x00, 0x66, 0x0e, 0x11, 0xb4, 0x98, 0x51, 0x02, 0x9a, 0xa6, 0x00, 0x64, 0x07, 0xc0, 0x93, 0x84, 0x35, 0x95, 0x97, 0xa5, 0x52, 0x7c, 0xaf, 0x63, 0x6e, 0x5b, 0x90, 0xd4, 0x20, 0x6d,
+  0x5b, 0xea, 0x1f, 0xf0, 0x21, 0xce, 0x6b, 0x8e, 0x6b, 0x4c, 0x63, 0x8d, 0x6b, 0x70, 0x84, 0x70, 0x8c, 0x6c, 0x6b, 0xa8, 0x52, 0x8c, 0x73, 0xcc, 0x7b, 0xed, 0x7b, 0xb0, 0x94, 0xac, 0x73, 0x2a,
+  0x63, 0x0e, 0x84, 0x2f, 0x84, 0x90, 0x94, 0x0b, 0x63, 0x68, 0x4a, 0x89, 0x52, 0xca, 0x5a, 0xca, 0x5a, 0x2c, 0x6b, 0xa9, 0x52, 0xbc, 0x46, 0x91, 0x51, 0x8c, 0x6d, 0x6b, 0x4d, 0x6b, 0xef, 0x7b,
+  0x30, 0xc8, 0x4d, 0x00, 0x8c, 0x3f, 0x00, 0xa0, 0x11, 0x00, 0x62, 0x03, 0x02, 0x18, 0x5c, 0x00, 0xde, 0x1f, 0x00, 0x68, 0x0a, 0x02, 0x3c, 0x03, 0x60, 0x11, 0x84, 0x32, 0x8c, 0xf0, 0x83, 0x56,
+  0x03, 0x02, 0x74, 0x1c, 0x04, 0xf4, 0x06, 0x11, 0xb3, 0x3c, 0x0e, 0x00, 0x06, 0x00, 0x00, 0xb6, 0x03, 0x00, 0x7e, 0x03, 0x02, 0xde, 0x3f, 0x21, 0xb3, 0x9c, 0xe6, 0x46, 0x12, 0x94, 0xd6, 0x03,
+  0x20, 0x11, 0x84, 0xca, 0x03, 0x00, 0x6e, 0x2e, 0x02, 0x22, 0x07, 0x18, 0x51, 0x86, 0x03, 0x0e, 0x84, 0x1c, 0x0d, 0xa4, 0x03, 0x0f, 0xb2, 0x0a, 0x1a, 0x05, 0x58, 0x35, 0x06, 0x90, 0x03, 0x0e,
+  0xc4, 0x11, 0x08, 0x8a, 0x03, 0x06, 0x62, 0x3c, 0x06, 0x08, 0x00, 0x04, 0x34, 0x2e, 0x04, 0x94, 0x23, 0x0c, 0xe6, 0x18, 0x01, 0xb4, 0x2a, 0x04, 0x5e, 0x15, 0x17, 0xbd, 0x78, 0x1c, 0x01, 0x02,
+  0x00, 0x02, 0xb4, 0x0a, 0x01, 0x72, 0x3c, 0x03, 0x3c, 0x27, 0x04, 0x9c, 0x23, 0x00, 0x46, 0x07, 0x11, 0x37, 0xbe, 0x43, 0x02, 0xd4, 0x6a, 0x22, 0x16, 0xd6, 0x00, 0x32, 0x00, 0x2a, 0x07, 0x00,
+  0x60, 0x55, 0x00, 0xec, 0x38, 0x00, 0x9c, 0x0a, 0x00, 0x4c, 0x87, 0x00, 0xb4, 0x0a, 0x00, 0x36, 0x40, 0x02, 0xb4, 0x0a, 0x60, 0x16, 0xd6, 0xb9, 0xe6, 0x98, 0xe6, 0x64, 0x07, 0x00, 0x74, 0x6e,
+  0x10, 0xcc, 0xec, 0x22, 0x01, 0x0e, 0xf7, 0x22, 0xf5, 0x7c, 0xa6, 0x22, 0x02, 0x1e, 0x66, 0x02, 0xb8, 0x4d, 0x01, 0x1e, 0x39, 0x32, 0x5b, 0x52, 0x6c, 0xb2, 0xf3, 0x00, 0x38, 0x35, 0x01, 0xbe,
+  0xac, 0x03, 0x74, 0x34, 0x02, 0x16, 0x2a, 0x00, 0xc4, 0x14, 0x02, 0xa8, 0x0a, 0x11, 0xd1, 0x08, 0x0e, 0x00, 0xfc, 0x37, 0x00, 0x04, 0x00, 0x40, 0x16, 0x8d, 0x57, 0x8d, 0xdc, 0x49, 0x00, 0x5e,
+  0x15, 0x00, 0x96, 0x2d, 0x00, 0x74, 0x03, 0x02, 0x82, 0xf3, 0x00, 0xde, 0x0d, 0x02, 0xf2, 0xfa, 0x00, 0x40, 0x0e, 0x00, 0x3a, 0x5c, 0x02, 0xe8, 0xc5, 0x22, 0x53, 0x6c, 0x7c, 0xd0, 0x01, 0x38,
+  0x2d, 0x01, 0x78, 0xf0, 0x82, 0x77, 0x95, 0x98, 0x9d, 0x1a, 0xae, 0xd9, 0xa5, 0xac, 0x34, 0x00, 0x04, 0x00, 0x02, 0x32, 0xf0, 0x20, 0xf2, 0x63, 0x0e, 0x00, 0x00, 0x92, 0xbe, 0x01, 0x74, 0x0a,
+  0x01, 0xe2, 0x9e, 0x20, 0xb0, 0x5b, 0x2a, 0xb4, 0x20, 0xac, 0x3a, 0xfa, 0x09, 0x00, 0xbc, 0x90, 0x40, 0x6b, 0x32, 0x0e, 0x4b, 0x0c, 0x00, 0x04, 0x9a, 0x11, 0x12, 0xb1, 0xb2, 0x11, 0x01, 0x54,
+  0x3f, 0x10, 0xd1, 0x86, 0x03, 0x03, 0xa4, 0x26, 0x13, 0xd5, 0x6a, 0xdb, 0x21, 0x12, 0x6c, 0x68, 0x1c, 0x01, 0xe2, 0xf7, 0x02, 0x92, 0xe2, 0x10, 0xb4, 0x28, 0xb1, 0x01, 0x34, 0x51, 0x02, 0x10,
+  0xe6, 0x02, 0x7a, 0x03, 0x00, 0x64, 0x11, 0x20, 0x4f, 0x5b, 0xa6, 0xbb, 0x01, 0x7e, 0x03, 0x00, 0x5a, 0x2e, 0x61, 0x5b, 0xac, 0x42, 0x8c, 0x3a, 0x32, 0x2e, 0x43, 0x00, 0x88, 0x00, 0x00, 0x54,
+  0x07, 0x00, 0x38, 0xe6, 0x02, 0x94, 0x4a, 0x00, 0x54, 0x35, 0x00, 0xd0, 0x11, 0x00, 0x92, 0x23, 0x00, 0xf2, 0xbb, 0x01, 0xd4, 0x15, 0x21, 0x7c, 0xf1, 0x6a, 0x9f, 0x00, 0x80, 0x2a, 0x60, 0xd4,
+  0x8c, 0x93, 0x84, 0xb3, 0x84, 0xb6, 0x11, 0x80, 0x31, 0x74, 0x10, 0x74, 0x0c, 0x53, 0x0c, 0x53, 0xb6, 0x11, 0xc0, 0xce, 0x6b, 0x4c, 0x5b, 0x48, 0x3a, 0x6c, 0x63, 0x0f, 0x7c, 0x2f, 0x84, 0xe2,
+  0x1f, 0xf0, 0x01, 0x0e, 0x7c, 0x90, 0x8c, 0x8f, 0x8c, 0x6b, 0x6b, 0x2e, 0x84, 0xed, 0x7b, 0xed, 0x7b, 0xcd, 0x7b, 0x28, 0x07, 0xf1, 0x00, 0x90, 0x94, 0xcd, 0x7b, 0xeb, 0x62, 0xef, 0x83, 0x0f,
+  0x84, 0x4c, 0x6b, 0xae, 0x73, 0x6d, 0x84, 0x03, 0x11, 0x6d, 0x62, 0x0a, 0x20, 0x10, 0x84, 0x0e, 0x15, 0x10, 0xae, 0xa0, 0x0a, 0x40, 0x73, 0xaf, 0x73, 0x31, 0x2e, 0x0e, 0x01, 0x12, 0x5c, 0x00,
+  0x2e, 0x63, 0x11, 0x92, 0x24, 0x0e, 0x00, 0x08, 0xa3, 0x00, 0x30, 0x0e, 0x02, 0x84, 0x03, 0x13, 0x52, 0x1e, 0x07, 0x13, 0x72, 0xb0, 0x18, 0x00, 0xda, 0x0a, 0x00, 0xc6, 0x11, 0x21, 0xf0, 0x83,
+  0x62, 0x63, 0x10, 0x94, 0x4c, 0x27, 0x00, 0xd0, 0x7f, 0x05, 0xa8, 0x51, 0x70, 0x94, 0xf1, 0x83, 0x11, 0x84, 0xd0, 0x7b, 0xca, 0x03, 0x04, 0xd2, 0x1f, 0x12, 0x92, 0x4e, 0x1c, 0x0e, 0x50, 0x15,
+  0x0f, 0x90, 0x03, 0x0a, 0x1f, 0x93, 0x1c, 0x07, 0x0c, 0x17, 0x92, 0x3a, 0x0e, 0x02, 0x48, 0x2e, 0x05, 0x96, 0xf1, 0x09, 0x3a, 0x6e, 0x0e, 0x90, 0x03, 0x02, 0xa2, 0xd1, 0x00, 0x04, 0x00, 0x17,
+  0xf2, 0x7e, 0xc3, 0x00, 0x3e, 0xae, 0x22, 0xf2, 0xb4, 0x3a, 0x2e, 0x01, 0x06, 0x00, 0x0b, 0x24, 0x80, 0x12, 0x94, 0x02, 0x00, 0x0e, 0xec, 0x18, 0x05, 0xd0, 0x11, 0x22, 0x16, 0xce, 0x50, 0x2e,
+  0x02, 0xd6, 0x6a, 0x11, 0xf6, 0xe0, 0x8a, 0x00, 0x54, 0x47, 0x00, 0x88, 0x63, 0x00, 0x36, 0x0e, 0x02, 0x72, 0x1c, 0x02, 0xee, 0x2a, 0x04, 0xb8, 0x9c, 0x00, 0xf4, 0x18, 0x02, 0xb0, 0x5c, 0x04,
+  0x1e, 0x79, 0x22, 0xd9, 0xee, 0x12, 0x20, 0x00, 0xd8, 0x31, 0x22, 0xd9, 0xee, 0x9e, 0x03, 0x42, 0x57, 0xd6, 0xb9, 0xe6, 0x3e, 0x5f, 0x00, 0xf8, 0x06, 0x20, 0x11, 0x64, 0x4a, 0x34, 0x00, 0x00,
+  0x07, 0x02, 0xa6, 0xec, 0x02, 0x14, 0x07, 0x13, 0x52, 0x78, 0x1f, 0x00, 0x94, 0x1f, 0x02, 0xb4, 0xc5, 0x04, 0xa2, 0xc5, 0x00, 0xec, 0x0d, 0x11, 0x33, 0x40, 0xa2, 0x00, 0xae, 0xcc, 0x42, 0x57,
+  0x8d, 0x36, 0x8d, 0x74, 0x03, 0x00, 0x1e, 0x0e, 0x00, 0xa0, 0x06, 0x31, 0xac, 0x3a, 0x4b, 0xd0, 0x49, 0x22, 0x12, 0x64, 0x06, 0x1c, 0x00, 0x42, 0x07, 0x00, 0xfe, 0x02, 0x01, 0xec, 0x9a, 0x10,
+  0x7c, 0x42, 0x31, 0x00, 0x34, 0x00, 0x00, 0xf6, 0x11, 0x00, 0xa6, 0x0a, 0x01, 0xd6, 0x49, 0x21, 0x5b, 0xb5, 0x2c, 0x38, 0x00, 0xa6, 0x0a, 0x40, 0x19, 0xa6, 0x36, 0x8d, 0x56, 0x12, 0x20, 0x94,
+  0x7c, 0xf8, 0x77, 0x50, 0x6b, 0x32, 0x4f, 0x53, 0x0e, 0x90, 0x23, 0x41, 0x3a, 0xed, 0x42, 0x2f, 0xb8, 0x90, 0x02, 0x54, 0x3f, 0x31, 0x2e, 0x53, 0xf1, 0x88, 0xa9, 0x11, 0x52, 0x40, 0x0a, 0x24,
+  0xf5, 0x84, 0x7e, 0x54, 0x40, 0x15, 0x85, 0x93, 0x7c, 0x64, 0xd0, 0x00, 0x72, 0xa9, 0x02, 0x32, 0xdb, 0x01, 0xa8, 0x4d, 0x14, 0x84, 0x38, 0x58, 0x11, 0x73, 0x42, 0x11, 0x00, 0x74, 0x03, 0x01,
+  0x84, 0x2a, 0x01, 0x0a, 0xcd, 0x20, 0x4f, 0x53, 0x9a, 0x5f, 0x51, 0xcd, 0x42, 0xac, 0x3a, 0x2e, 0x5c, 0x07, 0x11, 0x0e, 0x00, 0x4b, 0x00, 0xde, 0x89, 0x00, 0x64, 0x5f, 0x02, 0x02, 0x91, 0x00,
+  0x98, 0x6d, 0x00, 0xc2, 0x11, 0x11, 0xb0, 0xa8, 0xa2, 0x00, 0x00, 0x15, 0x00, 0x78, 0xb4, 0x11, 0x73, 0xba, 0x07, 0x40, 0x56, 0x95, 0x36, 0x95, 0xc8, 0x5f, 0x60, 0x36, 0x8d, 0x36, 0x95, 0x97,
+  0x9d, 0xe8, 0xc2, 0x00, 0xa0, 0xb4, 0x00, 0xb4, 0xbb, 0x00, 0x7e, 0x0e, 0x00, 0xc6, 0x03, 0x00, 0xca, 0x74, 0x00, 0xb4, 0x3f, 0x00, 0x44, 0xa3, 0x00, 0x4e, 0x4a, 0x20, 0x93, 0x7c, 0x9c, 0x0a,
+  0xf0, 0x06, 0x6e, 0x5b, 0x6e, 0x5b, 0xae, 0x63, 0xae, 0x63, 0x65, 0x21, 0x2c, 0x5b, 0x71, 0x84, 0x71, 0x84, 0x2f, 0x7c, 0x50, 0x7c, 0x2f, 0xb6, 0x11, 0x61, 0x84, 0x12, 0x95, 0xf2, 0x94, 0x2f,
+  0x4a, 0x23, 0xd0, 0xee, 0x7b, 0x8c, 0x73, 0xcd, 0x7b, 0xcc, 0x7b, 0xac, 0x7b, 0xcc, 0x7b, 0x2a, 0x3c, 0x0e, 0x90, 0x84, 0x0a, 0x63, 0x4f, 0x8c, 0x2b, 0x6b, 0x2c, 0x6b, 0xfa, 0x1f, 0x00, 0xbe,
+  0x11, 0x20, 0x6d, 0x6b, 0xd8, 0x38, 0x13, 0xae, 0xa2, 0x0a, 0x00, 0xca, 0xb4, 0x13, 0x72, 0x08, 0x1c, 0x00, 0x6e, 0xb8, 0x00, 0x96, 0x03, 0x11, 0x11, 0x3c, 0x15, 0x00, 0x1c, 0xb1, 0x11, 0x11,
+  0x80, 0xb8, 0x13, 0xb4, 0x22, 0x5c, 0x02, 0xac, 0x0a, 0x00, 0xe2, 0x06, 0x11, 0xd0, 0x5a, 0x35, 0x00, 0x4e, 0x2e, 0x01, 0xd6, 0x26, 0x01, 0x9c, 0x0a, 0x00, 0xf4, 0x18, 0x02, 0x20, 0x07, 0x31,
+  0xd0, 0x7b, 0x31, 0xc0, 0x03, 0x11, 0x8f, 0x14, 0x39, 0x00, 0x5e, 0x2e, 0xa0, 0x15, 0xa5, 0x56, 0xad, 0xb7, 0xb5, 0x97, 0xb5, 0x97, 0xb5, 0x60, 0x75, 0x03, 0x4c, 0x15, 0x0f, 0x7c, 0x1c, 0x18,
+  0x02, 0x44, 0x0e, 0x1f, 0x73, 0x5e, 0x35, 0x0e, 0x08, 0x22, 0x87, 0x02, 0x74, 0x9c, 0x08, 0x1a, 0x47, 0x0f, 0x90, 0x03, 0x03, 0x06, 0x80, 0x03, 0x0a, 0x90, 0x03, 0x04, 0x18, 0x07, 0x02, 0x02,
+  0xc0, 0x02, 0x2e, 0x27, 0x06, 0xee, 0x91, 0x08, 0xce, 0xaa, 0x1e, 0x94, 0x76, 0x1c, 0x03, 0x6e, 0x75, 0x11, 0xd5, 0x2c, 0x27, 0x02, 0x18, 0x20, 0x04, 0xfe, 0x38, 0x11, 0x36, 0xa6, 0x23, 0x04,
+  0x38, 0x87, 0x20, 0x57, 0xde, 0xcc, 0x11, 0x01, 0x74, 0x55, 0x01, 0x70, 0x75, 0x13, 0xf6, 0xac, 0x9c, 0x02, 0xa2, 0x43, 0x00, 0x5e, 0x6e, 0x00, 0xd2, 0x43, 0x00, 0xd8, 0x31, 0x40, 0x1a, 0xf7,
+  0x78, 0xde, 0x94, 0x1c, 0x40, 0xfa, 0xee, 0x57, 0xde, 0xa4, 0x5c, 0x00, 0x34, 0x43, 0x00, 0xfe, 0xf6, 0x11, 0x73, 0xb6, 0xe8, 0xc2, 0xf5, 0x84, 0x56, 0x8d, 0xf5, 0x84, 0x77, 0x8d, 0x16, 0x85,
+  0x56, 0x8d, 0xda, 0xf3, 0x20, 0x11, 0x64, 0x38, 0x43, 0x00, 0xb4, 0x3f, 0x02, 0x26, 0xc9, 0x40, 0xd1, 0x5b, 0x70, 0x4b, 0x04, 0xad, 0x00, 0x28, 0x07, 0x00, 0xb4, 0x0a, 0x20, 0x77, 0x95, 0x0a,
+  0x6d, 0x02, 0x62, 0x18, 0x11, 0xb1, 0x5e, 0x3f, 0x02, 0x30, 0x38, 0x00, 0xf6, 0x06, 0x71, 0x57, 0x95, 0x57, 0x95, 0x37, 0x8d, 0x74, 0x7e, 0xa9, 0x00, 0x5e, 0x1f, 0x41, 0x4b, 0x32, 0x2f, 0x4b,
+  0xfa, 0x9a, 0x00, 0xcc, 0x0d, 0x23, 0x6c, 0x12, 0xdc, 0xcc, 0x02, 0xe4, 0x2d, 0x10, 0xf6, 0xaa, 0x3b, 0x01, 0x10, 0x9b, 0x00, 0xc0, 0x3b, 0x00, 0x08, 0x38, 0x31, 0xed, 0x42, 0x4e, 0xca, 0x70,
+  0x00, 0x56, 0x7b, 0x02, 0x8e, 0xd7, 0x44, 0x16, 0x8d, 0xb8, 0x9d, 0x2a, 0x31, 0x20, 0xf6, 0x8c, 0x22, 0x07, 0x20, 0x57, 0x95, 0x78, 0x2d, 0x20, 0x77, 0x95, 0xda, 0x57, 0x02, 0x7e, 0x03, 0x24,
+  0x32, 0x6c, 0x7c, 0x18, 0x02, 0x04, 0xd4, 0x00, 0x58, 0x2a, 0x02, 0x86, 0x54, 0x10, 0xb4, 0x9c, 0xdb, 0x10, 0x53, 0xc4, 0x0a, 0x04, 0x80, 0x6d, 0x00, 0x68, 0x15, 0x11, 0xd5, 0x3e, 0xaa, 0x00,
+  0x2e, 0xd8, 0x02, 0xf0, 0x0a, 0x31, 0xb5, 0x7c, 0xf5, 0x88, 0x07, 0x00, 0x0c, 0x00, 0x00, 0x62, 0x58, 0x00, 0x0a, 0x15, 0x02, 0x58, 0x23, 0xa0, 0x70, 0x5b, 0x6f, 0x5b, 0xed, 0x4a, 0xcd, 0x4a,
+  0x6f, 0x5b, 0xdc, 0x11, 0xb3, 0xec, 0x4a, 0x4e, 0x53, 0xd0, 0x6b, 0x52, 0x7c, 0xd4, 0x84, 0xb3, 0x74, 0x03, 0x00, 0xde, 0xa2, 0x00, 0x50, 0x43, 0x20, 0xf1, 0x6b, 0x00, 0x0e, 0x20, 0xcc, 0x42,
+  0x3c, 0x1c, 0x00, 0x84, 0x2a, 0x00, 0x36, 0x07, 0x00, 0xa6, 0x9f, 0x60, 0xf0, 0x6b, 0x52, 0x74, 0xf0, 0x6b, 0x4c, 0x9f, 0x40, 0x49, 0x3a, 0xec, 0x4a, 0xda, 0xc9, 0x20, 0x2d, 0x53, 0xf2, 0xa9,
+  0x11, 0x8d, 0xb0, 0x11, 0xf0, 0x2b, 0xef, 0x73, 0xd2, 0x94, 0xb1, 0x8c, 0x0e, 0x7c, 0xd1, 0x94, 0xee, 0x73, 0xcd, 0x73, 0xcd, 0x73, 0x6c, 0x63, 0x2e, 0x7c, 0xee, 0x73, 0x8c, 0x6b, 0x8c, 0x6b,
+  0xcd, 0x7b, 0xf2, 0x9c, 0xd1, 0x9c, 0x6b, 0x6b, 0xe9, 0x5a, 0x2a, 0x63, 0x0d, 0x84, 0x2a, 0x63, 0xac, 0x7b, 0x6c, 0x6b, 0x4f, 0x8c, 0x2b, 0x63, 0x70, 0x8c, 0xad, 0x73, 0x30, 0x8c, 0x6d, 0x6b,
+  0x32, 0x15, 0x40, 0xef, 0x7b, 0x71, 0x8c, 0x64, 0x23, 0x00, 0x22, 0x63, 0x00, 0xb8, 0x18, 0x00, 0x84, 0x03, 0x20, 0xaf, 0x73, 0xc4, 0x8d, 0x42, 0xd0, 0x7b, 0xaf, 0x73, 0x4a, 0xf8, 0x00, 0x86,
+  0x03, 0x04, 0x64, 0x51, 0x40, 0xf0, 0x7b, 0xd0, 0x7b, 0x12, 0x00, 0x04, 0x02, 0x00, 0x30, 0x52, 0x8c, 0xd0, 0xe2, 0x86, 0x12, 0x7b, 0x78, 0x03, 0x11, 0x72, 0x9c, 0x11, 0x02, 0x6e, 0x15, 0x00,
+  0xb0, 0x26, 0x00, 0x08, 0x00, 0x00, 0xdc, 0x18, 0x01, 0x78, 0x8a, 0x01, 0x4c, 0x23, 0x00, 0xa8, 0x2a, 0x10, 0x31, 0x26, 0x8e, 0x00, 0xa6, 0x03, 0x10, 0x8c, 0xaa, 0x03, 0x00, 0xbe, 0x03, 0x0d,
+  0x3a, 0x0e, 0x01, 0xd6, 0x03, 0x0f, 0x54, 0x15, 0x09, 0x0f, 0x90, 0x03, 0x12, 0x05, 0x26, 0x87, 0x02, 0x54, 0x95, 0x06, 0x5c, 0x15, 0x0e, 0x20, 0x07, 0x04, 0x1c, 0x07, 0x0c, 0x82, 0x03, 0x0c,
+  0x02, 0x00, 0x00, 0x6c, 0xdc, 0x0a, 0xae, 0x0a, 0x04, 0x62, 0x6e, 0x1b, 0x73, 0xc8, 0xaa, 0x01, 0x02, 0x00, 0x16, 0xcd, 0x3c, 0x2e, 0x04, 0x1a, 0x47, 0x02, 0xe4, 0x91, 0x11, 0xf6, 0x08, 0x00,
+  0x00, 0xa4, 0x11, 0x00, 0x5c, 0xe7, 0x13, 0x37, 0x04, 0x40, 0x02, 0xfc, 0x1f, 0x02, 0x9a, 0x2a, 0x02, 0x22, 0x27, 0x00, 0x66, 0x15, 0x01, 0x26, 0x60, 0x02, 0x48, 0x87, 0x01, 0xb0, 0x03, 0x20,
+  0xd9, 0xee, 0x84, 0x03, 0x00, 0xe2, 0x0a, 0x11, 0x78, 0xf0, 0x18, 0x11, 0x57, 0x9c, 0x75, 0x02, 0x62, 0xfe, 0x00, 0x20, 0x3f, 0x00, 0xa8, 0x50, 0x11, 0x4f, 0x1a, 0x74, 0x00, 0x42, 0x0d, 0x00,
+  0x4e, 0x23, 0x20, 0x8c, 0x32, 0x54, 0x38, 0x00, 0x52, 0x0e, 0x00, 0x44, 0x4d, 0x00, 0x60, 0x0d, 0x00, 0xfa, 0x29, 0x00, 0x3c, 0x03, 0x01, 0x16, 0x31, 0x02, 0xc8, 0x5e, 0x21, 0x74, 0xf2, 0x6c,
+  0x62, 0x00, 0x64, 0x5b, 0x02, 0x90, 0x43, 0x15, 0xf2, 0xb2, 0xf3, 0x00, 0x64, 0x11, 0x00, 0x88, 0x03, 0x11, 0xb1, 0xb6, 0x65, 0x42, 0x74, 0x74, 0xf6, 0x84, 0xc2, 0x34, 0x41, 0x74, 0x74, 0x95,
+  0x7c, 0x6c, 0x62, 0x12, 0x5b, 0x3c, 0x0e, 0x02, 0xe8, 0x03, 0x70, 0xcd, 0x3a, 0xad, 0x3a, 0xcd, 0x42, 0xac, 0x46, 0x2e, 0x30, 0x42, 0x12, 0x6c, 0xde, 0x06, 0x00, 0x58, 0xd0, 0x00, 0xb4, 0x0a,
+  0x00, 0x6e, 0x2d, 0x00, 0x28, 0x07, 0x02, 0x5c, 0x23, 0x00, 0x82, 0x0d, 0x00, 0x3e, 0x00, 0x00, 0x9c, 0x0d, 0x00, 0x34, 0x8d, 0x10, 0x2e, 0x7c, 0x62, 0x00, 0x8e, 0xd0, 0x01, 0xce, 0xd7, 0x00,
+  0xee, 0x49, 0x10, 0x8f, 0xdc, 0x3b, 0x00, 0x16, 0xdb, 0x31, 0x5b, 0xd0, 0x63, 0x14, 0x23, 0x01, 0x8e, 0x26, 0x02, 0x94, 0x03, 0x00, 0x5c, 0x03, 0x00, 0x0a, 0x0e, 0x22, 0x12, 0x6c, 0xd0, 0x82,
+  0x02, 0x16, 0xdf, 0x00, 0xb8, 0x03, 0x00, 0xf4, 0x15, 0x02, 0xc0, 0x15, 0x13, 0xb1, 0xe8, 0x0d, 0x04, 0x6e, 0x07, 0x11, 0xb4, 0xfc, 0xb7, 0xf0, 0x00, 0x97, 0x9d, 0x36, 0x95, 0x11, 0x6c, 0x36,
+  0x95, 0xf4, 0x8c, 0x72, 0x7c, 0xf4, 0x8c, 0x31, 0x52, 0x31, 0x10, 0x74, 0x6e, 0x66, 0x00, 0xf2, 0x0d, 0x31, 0x0d, 0x4b, 0x6e, 0xc4, 0xb4, 0x00, 0x02, 0x2e, 0x80, 0xec, 0x4a, 0xec, 0x4a, 0xd0,
+  0x63, 0x72, 0x7c, 0x9c, 0xbb, 0xf0, 0x09, 0xcf, 0x63, 0x10, 0x6c, 0xf0, 0x6b, 0x8e, 0x5b, 0x6e, 0x5b, 0xec, 0x4a, 0x2d, 0x53, 0x6a, 0x3a, 0x49, 0x3a, 0x0c, 0x53, 0x72, 0x84, 0x75, 0x9d, 0x78,
+  0xd4, 0x60, 0x30, 0x7c, 0x51, 0x7c, 0x0f, 0x74, 0x7e, 0x2a, 0xc0, 0x0f, 0x74, 0xee, 0x73, 0x4f, 0x84, 0x90, 0x8c, 0x70, 0x8c, 0x4f, 0x84, 0x4e, 0x1c, 0xf0, 0x05, 0x0e, 0x7c, 0xcd, 0x73, 0x2b,
+  0x63, 0x84, 0x29, 0xc9, 0x52, 0x0e, 0x7c, 0x0a, 0x63, 0xa8, 0x52, 0x26, 0x42, 0x8c, 0x73, 0xaa, 0x0a, 0xc0, 0xcd, 0x7b, 0x47, 0x4a, 0x6f, 0x8c, 0xee, 0x7b, 0x2b, 0x6b, 0xa9, 0x52, 0xc0, 0x38,
+  0x40, 0x2c, 0x63, 0xaa, 0x52, 0x4e, 0x35, 0x11, 0x71, 0x76, 0x11, 0x11, 0xef, 0x46, 0x43, 0x13, 0x31, 0x32, 0x6a, 0x00, 0x2e, 0x3c, 0x00, 0xfe, 0x06, 0x00, 0xf2, 0x06, 0x15, 0x31, 0x78, 0x03,
+  0x20, 0x8f, 0x73, 0x40, 0x03, 0x02, 0xac, 0x5f, 0x00, 0x26, 0x15, 0x02, 0x18, 0x0e, 0x02, 0x02, 0x0e, 0x04, 0xe0, 0x11, 0x00, 0x02, 0x00, 0x01, 0x18, 0x00, 0x10, 0x84, 0xb6, 0x78, 0x03, 0x10,
+  0x19, 0x01, 0x24, 0x00, 0x02, 0xc8, 0x78, 0x11, 0x31, 0xea, 0x3f, 0x40, 0xf4, 0xa4, 0x15, 0xa5, 0x82, 0x1c, 0x33, 0xb7, 0xbd, 0x15, 0x1c, 0x07, 0x0f, 0x5a, 0x15, 0x0d, 0x0e, 0x8e, 0x03, 0x04,
+  0xa6, 0x0a, 0x0f, 0x40, 0x0e, 0x09, 0x06, 0xb2, 0x8a, 0x10, 0x91, 0x36, 0xd5, 0x0e, 0x8e, 0x03, 0x0d, 0x8c, 0x03, 0x02, 0x90, 0x03, 0x0e, 0x16, 0x07, 0x06, 0x1c, 0x07, 0x12, 0x32, 0xa2, 0x63,
+  0x02, 0x14, 0x60, 0x07, 0x60, 0x15, 0x19, 0x73, 0xba, 0xa3, 0x06, 0x7e, 0x1c, 0x06, 0xb4, 0x2a, 0x02, 0xa0, 0x2a, 0x02, 0x90, 0x9c, 0x00, 0x5a, 0x4e, 0x02, 0xba, 0x2a, 0x13, 0xf5, 0x6e, 0x35,
+  0x15, 0xf6, 0xe8, 0x8a, 0x11, 0x57, 0x66, 0x55, 0x02, 0x56, 0x2e, 0x00, 0x46, 0x27, 0x02, 0x88, 0x03, 0x03, 0x42, 0x0e, 0x03, 0xa8, 0x0a, 0x00, 0x78, 0x47, 0x06, 0x0e, 0x00, 0x13, 0x78, 0x52,
+  0x2e, 0x13, 0x90, 0x76, 0x5b, 0x00, 0xd6, 0x3e, 0x11, 0xb4, 0xa8, 0x1f, 0x00, 0xec, 0x17, 0x02, 0xa0, 0xec, 0x00, 0x4c, 0x66, 0x22, 0xd4, 0x7c, 0xf6, 0xef, 0x00, 0xda, 0x34, 0x02, 0xdc, 0x18,
+  0x00, 0x00, 0x0d, 0x00, 0xbe, 0x34, 0x51, 0xad, 0x3a, 0x4b, 0x2a, 0x4f, 0x36, 0x31, 0x26, 0xb5, 0x7c, 0x74, 0x26, 0x00, 0xe8, 0x06, 0x00, 0x74, 0xde, 0x00, 0xae, 0x03, 0x00, 0xe6, 0x02, 0x10,
+  0xd5, 0x20, 0x58, 0x12, 0x84, 0x44, 0x7b, 0x00, 0x40, 0x00, 0x00, 0xf6, 0x57, 0x02, 0xb8, 0x23, 0x40, 0xf6, 0x84, 0x16, 0x85, 0x3c, 0x3f, 0x00, 0x5e, 0x66, 0x02, 0x7e, 0x3f, 0x02, 0x30, 0x4a,
+  0x02, 0x48, 0x15, 0x02, 0xb0, 0x82, 0x12, 0xf5, 0xe4, 0xcc, 0x32, 0x84, 0xf1, 0x63, 0x24, 0x19, 0x06, 0x1c, 0x4a, 0x00, 0xe2, 0x11, 0x02, 0x32, 0xb4, 0x02, 0x86, 0x54, 0x01, 0x7a, 0xdb, 0x01,
+  0xd0, 0xbe, 0x00, 0x80, 0x03, 0x20, 0x11, 0x64, 0x12, 0x15, 0x32, 0x8f, 0x53, 0x4f, 0x90, 0x9b, 0x00, 0xaa, 0x03, 0x01, 0xbc, 0x89, 0x00, 0x96, 0x26, 0x00, 0xb4, 0x26, 0x02, 0x96, 0x5f, 0x02,
+  0xb6, 0x46, 0x00, 0x90, 0x00, 0x11, 0x74, 0x82, 0x15, 0x02, 0x66, 0x6a, 0x11, 0x53, 0x34, 0x04, 0x00, 0x8c, 0x5f, 0x00, 0x0a, 0x00, 0x02, 0xd6, 0xe2, 0x00, 0x36, 0xf4, 0x00, 0x70, 0x51, 0xf0,
+  0x11, 0xd4, 0x84, 0xcf, 0x6b, 0x71, 0x7c, 0xae, 0x63, 0x49, 0x3a, 0x6d, 0x5b, 0x2c, 0x53, 0xeb, 0x4a, 0x8e, 0x63, 0x4d, 0x53, 0x8e, 0x5b, 0x8a, 0x3a, 0xab, 0x42, 0x4d, 0x53, 0xec, 0x4a, 0x10,
+  0x6c, 0x04, 0x0e, 0x02, 0x7e, 0x5f, 0xf0, 0x0b, 0xaf, 0x63, 0x8a, 0x3a, 0x6a, 0x3a, 0xe8, 0x29, 0xe8, 0x29, 0x49, 0x3a, 0xcb, 0x4a, 0x6e, 0x5b, 0x30, 0x74, 0x14, 0x95, 0x34, 0x95, 0x55, 0x9d,
+  0x55, 0x9d, 0xe2, 0xf0, 0x60, 0xef, 0x73, 0x4c, 0x63, 0xae, 0x6b, 0x5e, 0x23, 0x20, 0x2f, 0x7c, 0x66, 0x23, 0xf0, 0x01, 0xed, 0x73, 0xc9, 0x52, 0xa8, 0x52, 0xa8, 0x52, 0xe9, 0x5a, 0x4b, 0x63,
+  0xac, 0x73, 0x0a, 0x5b, 0x08, 0x00, 0xf0, 0x15, 0x70, 0x8c, 0x90, 0x94, 0x4f, 0x84, 0xac, 0x73, 0x2e, 0x84, 0x4f, 0x8c, 0x4f, 0x8c, 0x6f, 0x8c, 0xd1, 0x9c, 0xb0, 0x94, 0xf1, 0x9c, 0x6f, 0x8c,
+  0x2b, 0x6b, 0xea, 0x62, 0x6c, 0x6b, 0x8d, 0x73, 0xeb, 0x5a, 0x4c, 0x6b, 0x2c, 0x0e, 0x11, 0xaf, 0xda, 0x06, 0x20, 0x10, 0x84, 0x16, 0x15, 0x00, 0x16, 0x07, 0x00, 0xb0, 0x0a, 0x11, 0x72, 0x46,
+  0x1c, 0x00, 0x42, 0x1c, 0x00, 0x48, 0x03, 0x00, 0xb4, 0x11, 0x01, 0xda, 0x06, 0x01, 0x2e, 0x35, 0x02, 0xd0, 0x1f, 0x01, 0x22, 0x63, 0x01, 0x32, 0x15, 0x00, 0xba, 0x18, 0x02, 0xa2, 0x4d, 0x01,
+  0xb2, 0x11, 0x03, 0xd8, 0x11, 0x20, 0x31, 0x8c, 0x4a, 0x71, 0x00, 0x12, 0x19, 0x15, 0x93, 0xc8, 0x18, 0x00, 0x36, 0x00, 0x01, 0xd2, 0x58, 0x00, 0x6e, 0xc3, 0x50, 0xad, 0xd4, 0x9c, 0x35, 0xad,
+  0x10, 0x39, 0x20, 0x11, 0x84, 0xe0, 0x11, 0x00, 0x0a, 0x07, 0x14, 0x32, 0x52, 0x55, 0x0b, 0x40, 0x15, 0x08, 0x9e, 0x0a, 0x0a, 0x6e, 0x03, 0x1e, 0x73, 0x0a, 0x00, 0x0d, 0x90, 0x03, 0x05, 0x7e,
+  0x3c, 0x07, 0x8c, 0x03, 0x0c, 0x42, 0x6e, 0x08, 0x36, 0x0e, 0x13, 0xf2, 0x20, 0x07, 0x0f, 0x24, 0x07, 0x05, 0x00, 0x7c, 0xbc, 0x00, 0x48, 0x27, 0x00, 0x80, 0x03, 0x00, 0xf4, 0x18, 0x15, 0x52,
+  0x8c, 0x03, 0x02, 0xb2, 0x0a, 0x12, 0x73, 0x8e, 0x03, 0x16, 0xbd, 0xc8, 0xaa, 0x0a, 0x92, 0x03, 0x04, 0x88, 0x95, 0x00, 0x62, 0x3c, 0x02, 0x6e, 0x55, 0x13, 0xb4, 0x26, 0x20, 0x02, 0x82, 0x23,
+  0x02, 0x22, 0x07, 0x02, 0x5e, 0x6e, 0x02, 0xe2, 0x38, 0x00, 0x18, 0x60, 0x02, 0x8a, 0x03, 0x00, 0xc0, 0x11, 0x00, 0xe0, 0x31, 0x00, 0xa4, 0x0a, 0x02, 0x04, 0x20, 0x20, 0xb9, 0xe6, 0xc6, 0x4a,
+  0x00, 0x94, 0x1c, 0x02, 0x9a, 0x03, 0x00, 0x64, 0x14, 0x11, 0xf2, 0x18, 0xd0, 0x00, 0xa8, 0x50, 0x00, 0x74, 0x0a, 0x12, 0xf2, 0x86, 0x7e, 0x03, 0x58, 0x4a, 0x11, 0x0e, 0x00, 0x8d, 0x00, 0x28,
+  0x20, 0x11, 0x2f, 0xbe, 0x34, 0x20, 0x70, 0x53, 0x16, 0x4d, 0x00, 0x84, 0x03, 0x02, 0x46, 0x18, 0x80, 0xf2, 0x63, 0xcd, 0x42, 0x4b, 0x2a, 0x0e, 0x43, 0xd4, 0x1f, 0x11, 0x2f, 0x0a, 0x43, 0x00,
+  0xda, 0x03, 0x00, 0x00, 0x1c, 0x00, 0x2e, 0x0e, 0x00, 0x4a, 0x03, 0x00, 0x24, 0x2a, 0x01, 0x3e, 0xc2, 0x00, 0x68, 0x2d, 0x01, 0x58, 0x15, 0x00, 0x8a, 0x15, 0x01, 0xb6, 0x0a, 0x10, 0x5b, 0xd2,
+  0x11, 0x02, 0x58, 0x58, 0x00, 0xbc, 0x0e, 0x00, 0xa4, 0x06, 0x11, 0x12, 0xc8, 0xb7, 0x00, 0xaa, 0x34, 0x00, 0xd6, 0xb7, 0x00, 0x6c, 0x4d, 0x04, 0x50, 0x31, 0x11, 0x32, 0x12, 0x78, 0x02, 0x0a,
+  0x27, 0x00, 0x84, 0x38, 0x02, 0x3e, 0xe9, 0x11, 0x4f, 0xc2, 0x20, 0x11, 0x73, 0x90, 0x11, 0x02, 0x80, 0xd7, 0x20, 0x12, 0x6c, 0x3a, 0xd4, 0x20, 0x93, 0x7c, 0xca, 0x0d, 0x00, 0x88, 0x15, 0x00,
+  0x14, 0xad, 0x11, 0xd5, 0x80, 0xc9, 0x01, 0x4a, 0x12, 0x01, 0x3a, 0x1c, 0x00, 0x0e, 0x1c, 0x02, 0xce, 0xa9, 0x00, 0xb6, 0x00, 0x00, 0x14, 0x63, 0x00, 0x82, 0x2e, 0x00, 0x08, 0x15, 0x00, 0xa8,
+  0x1f, 0x02, 0x02, 0x12, 0x11, 0x33, 0x14, 0x35, 0x20, 0x11, 0x6c, 0x5c, 0x98, 0x00, 0x92, 0x58, 0xf0, 0x0b, 0x0c, 0x4b, 0x6e, 0x5b, 0xeb, 0x42, 0xcb, 0x42, 0xae, 0x63, 0xef, 0x6b, 0xae, 0x63,
+  0xcb, 0x4a, 0x4c, 0x53, 0x2b, 0x53, 0xcb, 0x4a, 0x2d, 0x53, 0xec, 0x4a, 0xfc, 0xde, 0x00, 0x38, 0x78, 0x00, 0x78, 0x31, 0x11, 0x2d, 0x80, 0xbf, 0x40, 0xc7, 0x21, 0xcb, 0x4a, 0x28, 0x00, 0x40,
+  0x92, 0x7c, 0x92, 0x7c, 0xf4, 0xf7, 0x20, 0xb2, 0x84, 0x28, 0x6a, 0xa0, 0x0f, 0x74, 0x8d, 0x63, 0xca, 0x4a, 0x0b, 0x5b, 0x6c, 0x63, 0x4c, 0x1c, 0x20, 0x8d, 0x6b, 0x90, 0x0a, 0xf0, 0x1b, 0x6b,
+  0x63, 0x0a, 0x5b, 0x2e, 0x84, 0x4a, 0x63, 0x0e, 0x7c, 0x09, 0x5b, 0x4b, 0x6b, 0x0d, 0x84, 0xed, 0x7b, 0x8c, 0x73, 0xed, 0x7b, 0xf1, 0xa4, 0x6f, 0x8c, 0xcd, 0x7b, 0x4b, 0x6b, 0xe6, 0x39, 0x0e,
+  0x84, 0xf1, 0x9c, 0x2a, 0x63, 0x4f, 0x8c, 0xd1, 0x9c, 0x04, 0x00, 0x71, 0x2b, 0x6b, 0xa5, 0x31, 0x0f, 0x84, 0xee, 0x30, 0x0e, 0x11, 0xef, 0x84, 0x03, 0x00, 0xfa, 0x0d, 0x02, 0x6e, 0x78, 0x20,
+  0xf4, 0xa4, 0xd0, 0x46, 0x02, 0xde, 0x54, 0x04, 0xc4, 0x11, 0x11, 0x31, 0x20, 0x07, 0x00, 0x10, 0x07, 0x11, 0xf1, 0x08, 0x00, 0x02, 0xf8, 0x02, 0x02, 0x8c, 0x0a, 0x11, 0xd0, 0x8a, 0x1c, 0x00,
+  0x84, 0x91, 0x40, 0x8f, 0x73, 0xf0, 0x83, 0x26, 0x47, 0x00, 0x24, 0x07, 0x20, 0xf4, 0xa4, 0x42, 0x15, 0x02, 0x90, 0x0a, 0x22, 0xf1, 0x83, 0x84, 0x0a, 0x11, 0x93, 0xfe, 0x06, 0x02, 0x5a, 0x15,
+  0x02, 0x58, 0x0e, 0x00, 0x96, 0x03, 0x00, 0x8c, 0x03, 0x22, 0x6e, 0x73, 0x24, 0x19, 0x12, 0x31, 0x84, 0x2e, 0x1c, 0x94, 0x4a, 0x35, 0x0f, 0xb0, 0x2a, 0x0f, 0x1f, 0x73, 0x20, 0x27, 0x0a, 0x14,
+  0xb2, 0xa6, 0x0a, 0x01, 0xe2, 0x98, 0x07, 0x3e, 0x2e, 0x06, 0xa4, 0x2a, 0x0d, 0x50, 0x15, 0x04, 0x1a, 0x07, 0x0f, 0x90, 0x03, 0x03, 0x15, 0x53, 0xa6, 0x0a, 0x02, 0xdc, 0x11, 0x17, 0x73, 0xb0,
+  0x0a, 0x07, 0xee, 0x18, 0x05, 0x2a, 0x2e, 0x08, 0x3c, 0x0e, 0x04, 0x14, 0x27, 0x20, 0xd5, 0xcd, 0x40, 0x0e, 0x02, 0xa8, 0x2a, 0x06, 0x1a, 0x40, 0x02, 0x52, 0x15, 0x23, 0x74, 0xbd, 0x78, 0x95,
+  0x03, 0x70, 0x6e, 0x02, 0xb8, 0x43, 0x02, 0x08, 0x00, 0x02, 0x84, 0x3c, 0x02, 0xc8, 0x11, 0x02, 0x04, 0x00, 0x04, 0x0c, 0x00, 0x01, 0x9c, 0x23, 0x01, 0x28, 0x07, 0x11, 0x73, 0xfe, 0x45, 0x00,
+  0xd4, 0x06, 0x00, 0x86, 0x26, 0x00, 0xd2, 0x18, 0x00, 0x22, 0x1f, 0x00, 0x8a, 0xbe, 0x01, 0x84, 0x46, 0x00, 0x0a, 0xe9, 0x00, 0x76, 0x7e, 0x01, 0xa8, 0x26, 0x00, 0x06, 0x31, 0x11, 0x16, 0xf8,
+  0x5e, 0x02, 0x6c, 0x46, 0x02, 0xdc, 0x09, 0x20, 0xf5, 0x84, 0xbe, 0xb7, 0x00, 0x3c, 0x0e, 0x02, 0x2a, 0xdb, 0x02, 0x2a, 0x07, 0xa2, 0x12, 0x64, 0xcd, 0x42, 0x0e, 0x43, 0x4e, 0x4b, 0x53, 0x74,
+  0xba, 0x0a, 0x13, 0xac, 0xc2, 0xf3, 0x11, 0xb0, 0x84, 0x15, 0x01, 0x40, 0x63, 0x21, 0x53, 0xd1, 0x8e, 0x89, 0x00, 0x4a, 0x18, 0x02, 0x60, 0x03, 0x13, 0xb4, 0xa2, 0x62, 0x02, 0x1e, 0x8d, 0x02,
+  0xca, 0x3b, 0x00, 0xd4, 0x03, 0x02, 0x66, 0xf0, 0x02, 0xee, 0x9e, 0x20, 0xf1, 0x63, 0xc2, 0x18, 0x02, 0x72, 0x11, 0x02, 0x64, 0x2a, 0x02, 0x7c, 0x15, 0x02, 0x94, 0xd7, 0x01, 0x2e, 0x1c, 0x00,
+  0x80, 0xe2, 0x01, 0x14, 0x07, 0x11, 0x8f, 0x90, 0xc2, 0x02, 0xa6, 0xd0, 0x11, 0x52, 0x7a, 0x5f, 0x02, 0x64, 0x86, 0x00, 0x1c, 0x27, 0x13, 0xb1, 0x04, 0x00, 0x31, 0x50, 0x53, 0xf2, 0x32, 0x04,
+  0x15, 0xd5, 0x44, 0xe6, 0x20, 0xb5, 0x84, 0xb6, 0x3f, 0x60, 0x4b, 0x32, 0xee, 0x4a, 0x70, 0x5b, 0xc4, 0xb4, 0x00, 0xd6, 0xd7, 0x02, 0x52, 0xfb, 0x22, 0x6e, 0x5b, 0xa6, 0xa6, 0x00, 0x72, 0x03,
+  0x60, 0x8e, 0x5b, 0xeb, 0x4a, 0xef, 0x6b, 0x88, 0x0a, 0x00, 0x3a, 0xd8, 0x11, 0x4e, 0x7e, 0xb4, 0x20, 0x6e, 0x5b, 0x3e, 0xc6, 0xf0, 0x0d, 0x92, 0x84, 0x30, 0x74, 0x55, 0x9d, 0x34, 0x95, 0xb2,
+  0x84, 0x91, 0x7c, 0x50, 0x7c, 0xee, 0x6b, 0x8c, 0x63, 0xea, 0x4a, 0x89, 0x42, 0xea, 0x4a, 0x2b, 0x5b, 0x0a, 0x53, 0x8c, 0x03, 0x00, 0x78, 0x31, 0xf0, 0x05, 0x4b, 0x63, 0xcd, 0x73, 0x0d, 0x7c,
+  0xcc, 0x73, 0x8b, 0x6b, 0xac, 0x73, 0xed, 0x7b, 0xcc, 0x7b, 0xec, 0x7b, 0x6b, 0x6b, 0x36, 0x15, 0xa0, 0x2e, 0x84, 0xcc, 0x7b, 0x8f, 0x94, 0x0e, 0x84, 0x6b, 0x6b, 0x2e, 0x3c, 0xf1, 0x13, 0x6b,
+  0x6b, 0x6f, 0x8c, 0x12, 0xa5, 0x6f, 0x94, 0x4f, 0x8c, 0x6b, 0x6b, 0xb0, 0x94, 0x0e, 0x84, 0x68, 0x4a, 0x0f, 0x84, 0xae, 0x73, 0x2c, 0x63, 0x2c, 0x6b, 0x2c, 0x6b, 0xae, 0x73, 0xae, 0x73, 0x0c,
+  0x63, 0x04, 0x15, 0x01, 0x0a, 0x0e, 0x01, 0xf4, 0x26, 0x41, 0x6b, 0x2d, 0x63, 0x8f, 0x2a, 0xaa, 0x00, 0x40, 0x6a, 0x04, 0xd6, 0x18, 0x02, 0x36, 0x1c, 0x02, 0xe0, 0x06, 0x22, 0xf0, 0x7b, 0x20,
+  0x00, 0x04, 0x8c, 0x23, 0x02, 0xc4, 0x1f, 0x13, 0x92, 0xd4, 0x34, 0x00, 0xbc, 0x11, 0x20, 0x6e, 0x73, 0xfe, 0x06, 0x00, 0xba, 0x18, 0x11, 0xd4, 0xec, 0x18, 0x00, 0x6a, 0x07, 0x02, 0x80, 0x35,
+  0x11, 0x11, 0xc0, 0x0a, 0x00, 0x5c, 0x07, 0x00, 0x8e, 0x07, 0x40, 0x55, 0xad, 0x15, 0xad, 0x0c, 0x04, 0x54, 0x52, 0x94, 0x52, 0x94, 0x52, 0x84, 0x63, 0x06, 0x20, 0x27, 0x0e, 0x6e, 0x35, 0x0b,
+  0x52, 0x15, 0x0e, 0x02, 0x20, 0x08, 0x32, 0x0e, 0x02, 0x88, 0x23, 0x02, 0x78, 0x3c, 0x16, 0x8f, 0x16, 0xa7, 0x07, 0x1c, 0x07, 0x11, 0xf0, 0x02, 0x00, 0x07, 0xdc, 0xdf, 0x03, 0x88, 0x23, 0x06,
+  0xce, 0x11, 0x0a, 0xd8, 0x11, 0x09, 0x76, 0x3c, 0x03, 0x7e, 0x1c, 0x02, 0xb6, 0x0a, 0x37, 0x33, 0xbd, 0x33, 0x90, 0x03, 0x04, 0x2e, 0x47, 0x04, 0x66, 0x55, 0x00, 0x9e, 0x0a, 0x06, 0x06, 0x40,
+  0x02, 0xd6, 0x18, 0x00, 0x1c, 0x59, 0x02, 0xa6, 0x43, 0x06, 0xcc, 0x4a, 0x11, 0x36, 0x6e, 0x1c, 0x02, 0xb0, 0x63, 0x04, 0xca, 0x31, 0x02, 0x42, 0xa0, 0x00, 0x12, 0x19, 0x13, 0x78, 0xc8, 0x4a,
+  0x22, 0x78, 0xde, 0x44, 0x0e, 0x00, 0x1c, 0x07, 0x01, 0x34, 0x47, 0x01, 0x02, 0x00, 0x02, 0x60, 0x87, 0x20, 0x78, 0xde, 0x74, 0x15, 0x00, 0x9c, 0x02, 0x00, 0xbc, 0x06, 0x10, 0xb0, 0x0e, 0xe2,
+  0x01, 0x3c, 0x03, 0x00, 0x34, 0x03, 0x02, 0x68, 0x1c, 0x02, 0x60, 0x3f, 0x02, 0x76, 0xec, 0x00, 0x5a, 0x06, 0x02, 0xb4, 0x3b, 0x00, 0x08, 0x11, 0x01, 0x7c, 0x2a, 0x01, 0x42, 0x2a, 0x21, 0x74,
+  0x74, 0xd0, 0x77, 0x00, 0x9e, 0x89, 0x12, 0x42, 0xee, 0xbe, 0x11, 0xf1, 0xc6, 0x2d, 0x04, 0x5e, 0xf7, 0x20, 0x94, 0x74, 0x6a, 0x43, 0x00, 0x84, 0xfe, 0x00, 0x5e, 0x2a, 0x02, 0xac, 0x70, 0x02,
+  0xda, 0x0a, 0x00, 0x12, 0x0b, 0x00, 0x78, 0x07, 0x00, 0x62, 0x5b, 0x02, 0x72, 0x23, 0x00, 0x36, 0x19, 0x00, 0x6c, 0x00, 0x02, 0xa0, 0xd7, 0x00, 0x62, 0x03, 0x11, 0x90, 0xc4, 0x2a, 0x03, 0xfe,
+  0xfa, 0x21, 0x74, 0xd0, 0xe6, 0x89, 0x04, 0xee, 0x50, 0x02, 0xb4, 0x0a, 0x01, 0x86, 0xe2, 0x01, 0x08, 0x1c, 0x02, 0x56, 0x07, 0x01, 0xcc, 0xc2, 0x01, 0xd8, 0x14, 0x02, 0x52, 0xdb, 0x00, 0x80,
+  0xe2, 0x31, 0x73, 0x74, 0xd0, 0xc4, 0x03, 0x00, 0x18, 0x19, 0x00, 0x08, 0x00, 0x01, 0x7e, 0x78, 0x00, 0x54, 0x43, 0x01, 0x18, 0x15, 0x11, 0xb5, 0x62, 0x78, 0x01, 0xae, 0x51, 0x01, 0x3e, 0x0e,
+  0x00, 0x80, 0x9f, 0x02, 0x02, 0x12, 0x00, 0xfe, 0x0a, 0x00, 0x88, 0x18, 0x40, 0xd3, 0x84, 0x92, 0x7c, 0xfe, 0x3b, 0x00, 0x8c, 0x03, 0x60, 0x2d, 0x53, 0x6e, 0x5b, 0xf0, 0x6b, 0x02, 0x00, 0x20,
+  0x4d, 0x53, 0x62, 0xfb, 0x40, 0x52, 0x7c, 0x52, 0x74, 0x84, 0x8d, 0x00, 0xa0, 0xd4, 0x31, 0x76, 0x9d, 0x72, 0x6e, 0x2a, 0xf0, 0x13, 0x10, 0x74, 0xef, 0x73, 0x2c, 0x5b, 0x6c, 0x63, 0x6c, 0x5b,
+  0xa9, 0x4a, 0x2a, 0x53, 0xcd, 0x6b, 0xcd, 0x6b, 0xad, 0x6b, 0x0e, 0x74, 0xed, 0x73, 0x6b, 0x63, 0x6b, 0x63, 0xed, 0x73, 0x8c, 0x6b, 0xac, 0x73, 0xd2, 0x1f, 0xf0, 0x0f, 0x8b, 0x6b, 0xed, 0x7b,
+  0x8b, 0x6b, 0x6a, 0x6b, 0x0d, 0x7c, 0xab, 0x73, 0x8b, 0x73, 0x8b, 0x6b, 0x6f, 0x8c, 0xac, 0x73, 0x8b, 0x73, 0x4e, 0x8c, 0x6b, 0x6b, 0x09, 0x63, 0xac, 0x73, 0x74, 0x23, 0x40, 0x8c, 0x73, 0xe9,
+  0x5a, 0xa6, 0x03, 0xa0, 0xb1, 0x9c, 0xd1, 0x9c, 0x68, 0x52, 0x6c, 0x6b, 0x0b, 0x63, 0x1a, 0x63, 0x20, 0x8e, 0x73, 0x18, 0x07, 0x00, 0x44, 0x15, 0x00, 0x30, 0x03, 0x02, 0x5e, 0x2a, 0x20, 0xcf,
+  0x7b, 0x54, 0x11, 0x71, 0xd4, 0x9c, 0x15, 0xa5, 0x14, 0xa5, 0xd3, 0x48, 0x8a, 0x22, 0x31, 0x84, 0xc2, 0x11, 0x02, 0x78, 0x03, 0x00, 0x36, 0x15, 0x00, 0x5e, 0x15, 0x04, 0x74, 0x91, 0x04, 0x82,
+  0x2a, 0x02, 0xe8, 0x18, 0x13, 0x8f, 0x7c, 0x15, 0x02, 0x9c, 0x03, 0x24, 0x52, 0x8c, 0xec, 0x11, 0x11, 0x31, 0x6c, 0xdf, 0x02, 0x98, 0x03, 0x02, 0x20, 0x07, 0x02, 0xf8, 0x18, 0x20, 0x93, 0x9c,
+  0x8c, 0x07, 0x02, 0xe4, 0x2a, 0x06, 0x02, 0x00, 0x21, 0x52, 0x8c, 0xa0, 0x0a, 0x0a, 0xb6, 0x2a, 0x03, 0x76, 0x15, 0x06, 0x88, 0x35, 0x0f, 0xa4, 0x2a, 0x13, 0x14, 0x91, 0x8e, 0x03, 0x0d, 0xfe,
+  0xbf, 0x17, 0xd0, 0x90, 0x03, 0x15, 0xf1, 0xda, 0xd8, 0x06, 0x36, 0x2e, 0x04, 0xcc, 0x31, 0x08, 0x8e, 0x23, 0x08, 0x02, 0x00, 0x01, 0x64, 0x75, 0x00, 0x7e, 0x03, 0x23, 0xc5, 0x52, 0x40, 0x0e,
+  0x00, 0x3e, 0x27, 0x00, 0xd2, 0xf1, 0x15, 0x73, 0xce, 0x11, 0x04, 0x46, 0x2e, 0x04, 0xfa, 0x98, 0x08, 0x62, 0x15, 0x02, 0xc0, 0x4a, 0x04, 0x7e, 0xb5, 0x22, 0x94, 0xc5, 0xca, 0x51, 0x02, 0x28,
+  0x07, 0x02, 0xb2, 0x11, 0x02, 0xd0, 0xe3, 0x11, 0x37, 0x26, 0x92, 0x02, 0x06, 0x40, 0x13, 0x16, 0x04, 0x20, 0x11, 0x78, 0xfc, 0x38, 0x02, 0xb4, 0x5c, 0x11, 0xb9, 0x62, 0x6e, 0x00, 0xb8, 0x0a,
+  0x02, 0x6e, 0x80, 0x00, 0x84, 0x1c, 0x00, 0x06, 0x00, 0x11, 0x73, 0x9c, 0x49, 0x02, 0xb6, 0x18, 0x31, 0xad, 0x3a, 0xb0, 0x14, 0x3c, 0x02, 0x4a, 0x1c, 0x10, 0x73, 0x8e, 0x03, 0x01, 0x26, 0x4d,
+  0x20, 0x36, 0x8d, 0x04, 0x07, 0x00, 0x28, 0x3f, 0x01, 0x66, 0x26, 0x10, 0x7c, 0x96, 0x4d, 0x00, 0xc6, 0x42, 0x01, 0xde, 0x3e, 0x01, 0x3a, 0x1c, 0x21, 0x4f, 0x4b, 0x94, 0xd7, 0x01, 0x84, 0xde,
+  0x01, 0x72, 0x11, 0x01, 0x86, 0x0e, 0x01, 0xd8, 0x57, 0x21, 0x53, 0x11, 0x6a, 0x51, 0x02, 0x88, 0x0d, 0x04, 0x6e, 0x3c, 0x00, 0x10, 0x20, 0x04, 0x62, 0xd0, 0x02, 0x42, 0x23, 0x00, 0x42, 0x0e,
+  0x02, 0x12, 0x27, 0x00, 0x9a, 0x1c, 0x00, 0x9e, 0x4d, 0x02, 0x28, 0x12, 0x02, 0xc6, 0x26, 0x01, 0x7e, 0x5f, 0x01, 0x9a, 0xf7, 0x02, 0xca, 0xd7, 0x01, 0x94, 0x27, 0x01, 0x4e, 0x5f, 0x00, 0x9e,
+  0x4d, 0x02, 0xc6, 0xec, 0x02, 0xa8, 0x23, 0x22, 0xf1, 0x6b, 0x8c, 0xbb, 0xf0, 0x01, 0x8f, 0x5b, 0x6b, 0x32, 0xe9, 0x21, 0x09, 0x2a, 0x6b, 0x32, 0xc8, 0x21, 0x09, 0x2a, 0xcc, 0x42, 0xe2, 0x1f,
+  0x11, 0x90, 0x68, 0x03, 0x03, 0x32, 0x32, 0x14, 0x74, 0x86, 0x27, 0x00, 0x56, 0x1c, 0x00, 0xa2, 0x86, 0x00, 0x94, 0x0a, 0x02, 0xa4, 0xe2, 0x40, 0xf0, 0x6b, 0x11, 0x6c, 0xf4, 0x26, 0x00, 0xbe,
+  0x18, 0x40, 0x14, 0x8d, 0x8e, 0x5b, 0x94, 0x0a, 0x11, 0xec, 0x9a, 0x0a, 0x22, 0x4a, 0x32, 0x2a, 0x0e, 0x40, 0xc8, 0x29, 0xa7, 0x21, 0xdc, 0x54, 0x00, 0xb0, 0x18, 0x00, 0xba, 0x11, 0x20, 0xd0,
+  0x6b, 0x9a, 0x66, 0x80, 0xf0, 0x6b, 0xcf, 0x6b, 0xae, 0x63, 0xaa, 0x4a, 0x30, 0x15, 0xf0, 0x0f, 0x4c, 0x5b, 0x4b, 0x5b, 0x2b, 0x5b, 0x4b, 0x5b, 0xcd, 0x6b, 0x6b, 0x63, 0x8c, 0x6b, 0x4b, 0x63,
+  0x0a, 0x5b, 0x8c, 0x6b, 0xcd, 0x73, 0x8b, 0x6b, 0xcc, 0x73, 0xcc, 0x73, 0xac, 0x73, 0xb6, 0x18, 0xf0, 0x09, 0xac, 0x73, 0x29, 0x63, 0x2d, 0x84, 0x4e, 0x84, 0x0d, 0x7c, 0x6a, 0x6b, 0x6b, 0x6b,
+  0x4e, 0x8c, 0x09, 0x63, 0x2a, 0x63, 0x0d, 0x7c, 0x6b, 0x6b, 0xb0, 0x0a, 0x51, 0x2a, 0x63, 0x4b, 0x6b, 0x2b, 0xe6, 0x18, 0x70, 0xa9, 0x52, 0x6b, 0x6b, 0x26, 0x42, 0x6c, 0x3c, 0x3c, 0x00, 0xae,
+  0x38, 0x72, 0x84, 0xae, 0x7b, 0xb2, 0x94, 0x72, 0x94, 0x46, 0x91, 0x00, 0x2c, 0x0e, 0x26, 0x11, 0x84, 0x10, 0x07, 0x20, 0x8f, 0x73, 0xe0, 0x26, 0x60, 0x6e, 0x6b, 0x4e, 0x6b, 0x2d, 0x63, 0xf6,
+  0x1f, 0x00, 0x16, 0x00, 0x01, 0xb6, 0xed, 0x25, 0x7b, 0x31, 0x52, 0x0e, 0x01, 0x4c, 0x07, 0x21, 0x7b, 0x11, 0x16, 0x20, 0x01, 0x00, 0x12, 0x01, 0x56, 0x03, 0x02, 0xbe, 0x2a, 0x00, 0xdc, 0x31,
+  0x00, 0xe2, 0x0a, 0x04, 0x34, 0x0e, 0x02, 0x4a, 0x0e, 0x00, 0x00, 0x19, 0x00, 0xf0, 0x51, 0x11, 0x52, 0x46, 0x27, 0x00, 0xac, 0x8a, 0x51, 0xd3, 0x9c, 0xb7, 0xbd, 0x11, 0x4a, 0x0e, 0x11, 0x52,
+  0xf2, 0x23, 0x02, 0x6a, 0x03, 0x02, 0x2a, 0x07, 0x0e, 0x42, 0x2e, 0x04, 0x7e, 0x55, 0x02, 0x02, 0x00, 0x0f, 0xe0, 0x58, 0x07, 0x1a, 0x92, 0x4a, 0x55, 0x06, 0xfa, 0xbf, 0x0c, 0xe6, 0x38, 0x1a,
+  0xb4, 0xc4, 0x31, 0x06, 0xc0, 0x31, 0x0a, 0x8a, 0x03, 0x0d, 0x8e, 0x03, 0x01, 0x7c, 0x03, 0x00, 0x14, 0x00, 0x13, 0x52, 0xbc, 0x2a, 0x25, 0x73, 0xc5, 0xb8, 0xa3, 0x14, 0xc5, 0x8c, 0xbc, 0x02,
+  0x54, 0xae, 0x02, 0xaa, 0xbc, 0x04, 0x18, 0x47, 0x06, 0xb0, 0x0a, 0x11, 0xf6, 0x14, 0x60, 0x06, 0x6c, 0x55, 0x02, 0x1e, 0x59, 0x02, 0xd0, 0x11, 0x13, 0x94, 0x1c, 0x20, 0x11, 0xb4, 0xfc, 0x78,
+  0x11, 0x36, 0x34, 0x79, 0x02, 0xda, 0x6a, 0x02, 0x0c, 0x72, 0x02, 0xbc, 0x11, 0x11, 0x98, 0x34, 0x0e, 0x00, 0x1c, 0x00, 0x04, 0x94, 0x03, 0x00, 0x36, 0x80, 0x13, 0x78, 0x16, 0x20, 0x60, 0x78,
+  0xde, 0x4f, 0x4b, 0xf1, 0x5b, 0x48, 0x29, 0x12, 0xb5, 0x9e, 0xe1, 0x03, 0x38, 0xd0, 0x22, 0xd5, 0x7c, 0x42, 0xc2, 0x11, 0xb5, 0x3c, 0x38, 0x11, 0xd5, 0x82, 0x18, 0x02, 0xd8, 0x10, 0x11, 0x74,
+  0x56, 0x74, 0x02, 0xba, 0x1f, 0x00, 0x70, 0x06, 0x02, 0xa6, 0x18, 0x00, 0x3c, 0x15, 0x20, 0x78, 0x95, 0xbe, 0x1f, 0x80, 0xfa, 0xa5, 0x98, 0x9d, 0x78, 0x95, 0x37, 0x8d, 0x1a, 0x07, 0x02, 0xd0,
+  0x1f, 0x00, 0x4c, 0x7b, 0x11, 0x53, 0x42, 0x0e, 0x00, 0x84, 0x15, 0x00, 0x44, 0x2e, 0x11, 0x53, 0xe0, 0x30, 0x00, 0x26, 0x0a, 0x02, 0xe8, 0x11, 0x02, 0x18, 0x6d, 0x15, 0x70, 0xa6, 0x5b, 0x02,
+  0xf2, 0x85, 0x62, 0xb1, 0x5b, 0x91, 0x5b, 0x70, 0x53, 0x58, 0x38, 0x00, 0xee, 0x46, 0x02, 0x1c, 0xf4, 0x22, 0xd1, 0x63, 0x36, 0xfb, 0x01, 0x2e, 0xc6, 0x00, 0xda, 0x1b, 0x00, 0x56, 0x27, 0x30,
+  0x9d, 0x16, 0x8d, 0x22, 0xbb, 0x11, 0x53, 0x54, 0xdb, 0x00, 0xee, 0x77, 0x00, 0xfe, 0xb7, 0x00, 0xb8, 0xa2, 0x00, 0x4e, 0x78, 0x00, 0x1c, 0x00, 0x13, 0x73, 0xb4, 0xf0, 0x00, 0xfa, 0x03, 0x11,
+  0x73, 0x36, 0x07, 0x11, 0xb0, 0x70, 0x51, 0x20, 0x8f, 0x5b, 0x7e, 0x03, 0x20, 0x6e, 0x5b, 0x8a, 0x03, 0x60, 0x93, 0x7c, 0x14, 0x8d, 0x55, 0x95, 0x9c, 0x1f, 0x60, 0x56, 0x95, 0xf4, 0x8c, 0x93,
+  0x84, 0x04, 0x07, 0xc0, 0xec, 0x4a, 0x8b, 0x42, 0x0c, 0x53, 0x2d, 0x53, 0xcb, 0x4a, 0xec, 0x4a, 0xd0, 0xad, 0x13, 0x8e, 0x2a, 0x0e, 0x20, 0x31, 0x74, 0xb4, 0xa2, 0x60, 0x35, 0x95, 0xd4, 0x8c,
+  0xb3, 0x84, 0x36, 0x07, 0x11, 0xaf, 0x1e, 0x3c, 0x11, 0xae, 0x8e, 0x03, 0x80, 0x6d, 0x63, 0x2b, 0x5b, 0xca, 0x4a, 0x4c, 0x5b, 0xa8, 0x11, 0xc0, 0xcd, 0x73, 0x6b, 0x63, 0xac, 0x6b, 0xcd, 0x73,
+  0xcc, 0x73, 0xcd, 0x73, 0xc8, 0x1f, 0x62, 0x0d, 0x7c, 0xcd, 0x7b, 0x0d, 0x84, 0xa6, 0x0a, 0xf0, 0x05, 0x0d, 0x7c, 0x8b, 0x73, 0x6a, 0x6b, 0xe8, 0x5a, 0x8b, 0x73, 0x8b, 0x73, 0x2e, 0x84, 0x6f,
+  0x8c, 0xc9, 0x5a, 0x0a, 0x5b, 0x8a, 0x03, 0x00, 0x4c, 0x15, 0x40, 0xee, 0x83, 0x32, 0xa5, 0x38, 0x35, 0xc0, 0x6c, 0x73, 0x90, 0x94, 0x0e, 0x84, 0x0e, 0x84, 0xb1, 0x9c, 0xd2, 0x9c, 0xac, 0x0a,
+  0x20, 0x4d, 0x6b, 0x18, 0x3c, 0x20, 0x2c, 0x63, 0x58, 0x03, 0x00, 0x5e, 0x0a, 0x02, 0x04, 0x07, 0x02, 0x0c, 0x00, 0x22, 0x8f, 0x73, 0x5a, 0x0a, 0x03, 0xb2, 0x66, 0x12, 0x8c, 0x22, 0x07, 0x00,
+  0xdc, 0x06, 0x02, 0x20, 0xa3, 0x22, 0x52, 0x8c, 0x7a, 0x15, 0x11, 0xf0, 0x26, 0x07, 0x02, 0x0c, 0x27, 0x06, 0xb4, 0x0a, 0x20, 0xd0, 0x7b, 0x34, 0x03, 0x02, 0xfc, 0x18, 0x00, 0x6a, 0x03, 0x11,
+  0x93, 0x3e, 0x2e, 0x15, 0x93, 0x44, 0x03, 0x00, 0x42, 0x07, 0x00, 0xfe, 0x03, 0x60, 0x35, 0xad, 0x39, 0xce, 0xb7, 0xbd, 0xec, 0x03, 0x00, 0x82, 0x03, 0x07, 0x8c, 0x03, 0x01, 0xba, 0x0a, 0x0e,
+  0xd2, 0x31, 0x0e, 0xc0, 0x43, 0x0e, 0x94, 0x03, 0x08, 0x8e, 0x03, 0x02, 0xe0, 0x38, 0x06, 0x1c, 0x47, 0x0d, 0x1a, 0x07, 0x06, 0xd6, 0xff, 0x05, 0xa4, 0x2a, 0x0e, 0x20, 0x07, 0x0e, 0xc2, 0x31,
+  0x15, 0x12, 0x92, 0x03, 0x11, 0x53, 0xb8, 0x2a, 0x00, 0x10, 0x07, 0x1d, 0x52, 0x5c, 0x15, 0x12, 0x73, 0xf0, 0xb1, 0x01, 0xb0, 0x63, 0x02, 0xce, 0x1f, 0x0a, 0x3a, 0x0e, 0x00, 0x14, 0x15, 0x02,
+  0x96, 0x23, 0x02, 0x84, 0x3c, 0x02, 0x92, 0x0a, 0x04, 0xa2, 0x63, 0x02, 0x24, 0x00, 0x24, 0x74, 0xbd, 0xba, 0xbc, 0x02, 0xaa, 0xf5, 0x13, 0x57, 0xde, 0x51, 0x02, 0x86, 0x75, 0x00, 0x86, 0x03,
+  0x13, 0xb5, 0xb8, 0x2a, 0x13, 0xd9, 0xd2, 0x11, 0x04, 0xf0, 0x51, 0x00, 0x22, 0x07, 0x02, 0x0c, 0x38, 0x11, 0x74, 0xcc, 0x18, 0x02, 0x40, 0x15, 0x01, 0xaa, 0x06, 0x12, 0x53, 0xde, 0x50, 0x00,
+  0xa2, 0x31, 0x10, 0x6c, 0x24, 0x86, 0x11, 0x43, 0xdc, 0x06, 0x03, 0xe8, 0x57, 0x00, 0xee, 0x09, 0x04, 0xfc, 0x49, 0x00, 0xe8, 0x09, 0x11, 0xf6, 0xea, 0x30, 0x00, 0xa6, 0x0a, 0x00, 0x20, 0x07,
+  0x40, 0xee, 0x42, 0x6c, 0x32, 0x6e, 0x4d, 0x00, 0x6c, 0x1f, 0x13, 0x6f, 0x2e, 0x00, 0x11, 0x94, 0x92, 0xc9, 0x02, 0x24, 0x27, 0x00, 0x60, 0x00, 0x11, 0x33, 0x22, 0x58, 0x22, 0x33, 0x6c, 0x70,
+  0xfe, 0x04, 0x8e, 0x3f, 0x00, 0x4a, 0x19, 0x00, 0x82, 0x07, 0x00, 0x50, 0x5f, 0x00, 0x14, 0x23, 0x11, 0xb1, 0x4e, 0x23, 0x01, 0x9a, 0x15, 0x01, 0x10, 0x2e, 0x00, 0xdc, 0x18, 0x00, 0xd6, 0xb7,
+  0x00, 0x30, 0x07, 0x01, 0xe2, 0xe5, 0x03, 0x68, 0x66, 0x20, 0xb0, 0x63, 0x46, 0x38, 0x00, 0xac, 0xd0, 0x11, 0x52, 0xea, 0x77, 0x31, 0x11, 0x6c, 0x12, 0x5c, 0xc2, 0x02, 0xd6, 0xd7, 0x02, 0xc6,
+  0x03, 0x02, 0x2e, 0x9f, 0x00, 0x10, 0x63, 0x00, 0xe2, 0x34, 0x11, 0xd0, 0x82, 0xe9, 0x13, 0x52, 0xb0, 0x18, 0xc0, 0x92, 0x7c, 0x96, 0xa5, 0xd3, 0x8c, 0x92, 0x7c, 0xf0, 0x6b, 0x10, 0x6c, 0x38,
+  0xb1, 0xe0, 0xae, 0x63, 0x2c, 0x53, 0x51, 0x7c, 0x51, 0x7c, 0x8e, 0x63, 0x92, 0x7c, 0x10, 0x74, 0xb4, 0x18, 0x20, 0x30, 0x74, 0x4e, 0xb1, 0x40, 0xd3, 0x8c, 0xd3, 0x8c, 0x8e, 0x0a, 0x31, 0x15,
+  0x95, 0x51, 0xee, 0x5b, 0xc0, 0xe8, 0x31, 0x8a, 0x42, 0x4d, 0x5b, 0x30, 0x74, 0x30, 0x74, 0xef, 0x6b, 0xa8, 0x3f, 0x20, 0x2b, 0x5b, 0x0e, 0x35, 0xa0, 0xce, 0x6b, 0x4c, 0x63, 0xad, 0x6b, 0xac,
+  0x6b, 0xac, 0x6b, 0x9c, 0x0a, 0x30, 0x2e, 0x7c, 0xed, 0x94, 0x03, 0x01, 0x8e, 0x03, 0x00, 0x8a, 0x03, 0x80, 0xcc, 0x7b, 0xe9, 0x5a, 0x8b, 0x73, 0xcc, 0x7b, 0x04, 0x00, 0x80, 0x4e, 0x8c, 0x4e,
+  0x84, 0xec, 0x7b, 0xb0, 0x94, 0x38, 0x0e, 0xa0, 0xc9, 0x52, 0x4b, 0x6b, 0x47, 0x42, 0x67, 0x4a, 0xac, 0x73, 0x4e, 0x43, 0xf0, 0x01, 0x91, 0x94, 0x47, 0x4a, 0x88, 0x52, 0xea, 0x5a, 0x6c, 0x73,
+  0x27, 0x4a, 0x89, 0x52, 0x4c, 0x6b, 0xe4, 0x46, 0x00, 0xd6, 0x2d, 0x00, 0x04, 0x27, 0x02, 0xfa, 0x4d, 0x22, 0xcf, 0x7b, 0x4a, 0x15, 0x02, 0xf4, 0x06, 0x00, 0x7c, 0x23, 0x31, 0x15, 0xa5, 0x11,
+  0x2e, 0x43, 0x02, 0x74, 0x03, 0x11, 0xf0, 0x1c, 0x00, 0x00, 0x44, 0x07, 0x02, 0x24, 0x07, 0x02, 0x6a, 0x03, 0x04, 0xb4, 0x7f, 0x00, 0x7a, 0x23, 0x02, 0xba, 0x51, 0x22, 0x51, 0x8c, 0x82, 0x15,
+  0x04, 0xd6, 0x0d, 0x20, 0x52, 0x8c, 0x90, 0x3c, 0x00, 0x5a, 0x1c, 0x00, 0x0c, 0x39, 0x01, 0x92, 0x1c, 0x01, 0xc6, 0x03, 0x00, 0x80, 0x1c, 0x31, 0x35, 0xa5, 0xb7, 0xf6, 0x71, 0x33, 0x8e, 0x73,
+  0x11, 0xea, 0x2a, 0x02, 0x20, 0x07, 0x16, 0x52, 0x20, 0x07, 0x0f, 0x8a, 0x03, 0x04, 0x0f, 0x90, 0x03, 0x0d, 0x06, 0x1a, 0x07, 0x07, 0xa8, 0x4a, 0x0a, 0x9e, 0x6a, 0x13, 0xb4, 0x06, 0x00, 0x05,
+  0x96, 0x2a, 0x0e, 0x1c, 0x07, 0x0e, 0x90, 0x03, 0x04, 0x1c, 0x07, 0x08, 0x9a, 0x43, 0x00, 0x50, 0x15, 0x00, 0x22, 0x07, 0x06, 0x84, 0x5c, 0x08, 0xcc, 0x6a, 0x02, 0x4a, 0x6e, 0x15, 0x94, 0xf4,
+  0x06, 0x19, 0xb4, 0x5c, 0x15, 0x02, 0x0c, 0x60, 0x11, 0x16, 0xcc, 0x6a, 0x02, 0x68, 0xae, 0x00, 0x2c, 0x80, 0x00, 0x84, 0x03, 0x04, 0x74, 0x75, 0x02, 0x18, 0x99, 0x00, 0x92, 0x03, 0x00, 0x4e,
+  0x07, 0x00, 0xda, 0x38, 0x11, 0x36, 0x18, 0x00, 0x04, 0xc4, 0x11, 0x00, 0x26, 0x07, 0x02, 0xe8, 0x18, 0x02, 0x1a, 0x20, 0x10, 0x98, 0xb8, 0x23, 0x10, 0xd6, 0xda, 0x31, 0x02, 0x00, 0x39, 0x11,
+  0x94, 0xc6, 0xda, 0x02, 0xac, 0x26, 0x11, 0x53, 0xb4, 0x7e, 0x00, 0xae, 0x0a, 0x00, 0x68, 0x2a, 0x04, 0xc8, 0x5b, 0x00, 0x06, 0x0e, 0x02, 0xa4, 0x18, 0x02, 0x5e, 0x0a, 0x00, 0xe2, 0x14, 0x00,
+  0x1a, 0x18, 0x00, 0x56, 0x90, 0x00, 0xb2, 0x1b, 0x00, 0xb0, 0x1f, 0x40, 0x0a, 0x22, 0xad, 0x3a, 0xa0, 0x14, 0x00, 0x92, 0x03, 0x02, 0x28, 0x66, 0x00, 0x06, 0x0b, 0x02, 0xc2, 0x1b, 0x00, 0x6a,
+  0x7b, 0x40, 0x2f, 0x4b, 0xea, 0x21, 0xd2, 0xe5, 0x04, 0x74, 0x74, 0x20, 0x90, 0x5b, 0xd4, 0x14, 0x22, 0x73, 0x74, 0xa8, 0x4d, 0x00, 0x6e, 0x15, 0x00, 0xce, 0x7e, 0x11, 0xd5, 0x8e, 0x34, 0x02,
+  0x70, 0xd0, 0x00, 0xd6, 0x1f, 0x00, 0xe0, 0xc5, 0x02, 0x2e, 0x66, 0x04, 0xca, 0x90, 0x00, 0x98, 0xde, 0x11, 0xd5, 0x04, 0x19, 0x60, 0x93, 0x7c, 0x4e, 0x53, 0x73, 0x7c, 0xa2, 0xc2, 0x00, 0x58,
+  0x03, 0x40, 0xed, 0x4a, 0x0e, 0x53, 0xae, 0x1f, 0x00, 0x2e, 0x8d, 0x20, 0x6f, 0x5b, 0x86, 0x26, 0x02, 0xd6, 0xd0, 0x01, 0xc0, 0x46, 0x12, 0x53, 0xe8, 0x11, 0x11, 0x4f, 0x12, 0x3c, 0x02, 0x72,
+  0x9f, 0x40, 0x72, 0x7c, 0xf0, 0x6b, 0x7a, 0x03, 0xf1, 0x0e, 0xf4, 0x8c, 0x35, 0x95, 0x96, 0xa5, 0x75, 0x9d, 0xef, 0x6b, 0xce, 0x6b, 0xef, 0x6b, 0xcf, 0x6b, 0x0c, 0x53, 0xaa, 0x42, 0xeb, 0x4a,
+  0x4d, 0x5b, 0xcf, 0x6b, 0x4d, 0x5b, 0x6d, 0x48, 0x2a, 0x40, 0xec, 0x4a, 0xaf, 0x63, 0x18, 0x07, 0xe0, 0x4d, 0x5b, 0xcb, 0x4a, 0x29, 0x32, 0xcb, 0x4a, 0x8e, 0x63, 0xaf, 0x6b, 0x0c, 0x53, 0x76,
+  0x31, 0x00, 0xb0, 0x9b, 0x40, 0xd3, 0x8c, 0xf3, 0x94, 0x9e, 0x0a, 0xf0, 0x1d, 0x8d, 0x63, 0xad, 0x6b, 0x4b, 0x5b, 0x4b, 0x5b, 0xad, 0x6b, 0x0a, 0x5b, 0xea, 0x52, 0xac, 0x6b, 0x4b, 0x63, 0x4e,
+  0x84, 0x0e, 0x7c, 0x2a, 0x5b, 0x6b, 0x63, 0x6b, 0x6b, 0x8b, 0x6b, 0xab, 0x73, 0x8b, 0x6b, 0x6b, 0x6b, 0x8b, 0x73, 0xec, 0x7b, 0x2d, 0x84, 0xac, 0x73, 0x10, 0x07, 0x20, 0xab, 0x73, 0x9e, 0x03,
+  0x20, 0xac, 0x73, 0x6c, 0x23, 0x00, 0xde, 0x46, 0x42, 0xc9, 0x5a, 0x6b, 0x6b, 0x32, 0x0e, 0x82, 0x6c, 0x6b, 0x4b, 0x6b, 0x4b, 0x6b, 0xc6, 0x39, 0xdc, 0x74, 0x30, 0xee, 0x7b, 0xcf, 0xe2, 0x46,
+  0x30, 0x7b, 0x10, 0x84, 0x98, 0x5f, 0x11, 0xef, 0x36, 0x5c, 0x02, 0xf0, 0x7b, 0x11, 0xf0, 0x84, 0x0a, 0x02, 0x0a, 0x07, 0x02, 0x9a, 0x31, 0x31, 0x6e, 0x6b, 0xd0, 0x88, 0x0a, 0x02, 0x50, 0x23,
+  0x02, 0xca, 0x11, 0x00, 0x24, 0x00, 0x02, 0x82, 0x46, 0x04, 0x82, 0xb8, 0x13, 0x93, 0x48, 0x83, 0x00, 0xea, 0x26, 0x00, 0x28, 0x0e, 0x02, 0x20, 0x15, 0x00, 0x1a, 0x07, 0x11, 0x10, 0x1c, 0x00,
+  0x00, 0xa0, 0x03, 0x02, 0xd0, 0x2a, 0x20, 0xaf, 0x7b, 0x9a, 0x03, 0x00, 0xae, 0x03, 0x00, 0x7e, 0x07, 0x00, 0x22, 0x39, 0x82, 0x72, 0x94, 0xb7, 0xbd, 0x93, 0x9c, 0x8f, 0x7b, 0xc0, 0x51, 0x02,
+  0x76, 0x5c, 0x04, 0x94, 0x03, 0x02, 0x96, 0x03, 0x1f, 0x92, 0x16, 0x07, 0x1c, 0x06, 0xde, 0x58, 0x05, 0x1a, 0x07, 0x16, 0xa4, 0x8e, 0x03, 0x0d, 0x02, 0x00, 0x01, 0x4a, 0xfc, 0x06, 0x88, 0x03,
+  0x06, 0x46, 0x35, 0x0e, 0xf8, 0x1f, 0x08, 0x20, 0x07, 0x08, 0xb0, 0x0a, 0x03, 0xaa, 0x0a, 0x25, 0xbd, 0x53, 0xe8, 0x18, 0x00, 0x4c, 0x0e, 0x13, 0x73, 0x40, 0x0e, 0x02, 0x96, 0x03, 0x06, 0xe4,
+  0x51, 0x02, 0xe8, 0x51, 0x02, 0x0a, 0x92, 0x13, 0xd5, 0x20, 0x47, 0x02, 0xb0, 0x0a, 0x04, 0x4e, 0x15, 0x02, 0x10, 0x00, 0x20, 0x98, 0xe6, 0xa2, 0xbc, 0x00, 0xcc, 0x38, 0x02, 0x80, 0x55, 0x02,
+  0xda, 0x0a, 0x02, 0xea, 0x83, 0x06, 0xfa, 0x91, 0x01, 0xd0, 0x11, 0x01, 0x7c, 0x03, 0x00, 0x16, 0x07, 0x00, 0x02, 0x00, 0x00, 0x24, 0x27, 0x00, 0xea, 0x51, 0x02, 0x7c, 0x1c, 0x00, 0xd6, 0x11,
+  0x00, 0x7c, 0x03, 0x11, 0x33, 0xc0, 0xec, 0x00, 0x4c, 0x03, 0x00, 0x46, 0x0e, 0x02, 0x26, 0x07, 0x03, 0x74, 0x82, 0x01, 0x88, 0x03, 0x02, 0xe6, 0x1f, 0x01, 0xfc, 0x29, 0x12, 0x64, 0x32, 0x18,
+  0x02, 0x48, 0x11, 0x00, 0xf0, 0x1f, 0x03, 0x88, 0xd0, 0x01, 0x10, 0x27, 0x00, 0xc2, 0x69, 0x01, 0x14, 0x7b, 0x01, 0xda, 0x77, 0x02, 0x90, 0x18, 0x02, 0x02, 0x31, 0x00, 0xe0, 0x06, 0x04, 0x52,
+  0x66, 0x22, 0x90, 0x5b, 0xa0, 0x54, 0x40, 0x57, 0x95, 0xb5, 0x84, 0x1e, 0x15, 0x00, 0x8a, 0x90, 0x00, 0x08, 0x51, 0x02, 0x72, 0xf7, 0x01, 0x9c, 0xf7, 0x01, 0xea, 0xcc, 0x00, 0x5e, 0x1c, 0x00,
+  0x0a, 0xcd, 0x00, 0x32, 0x31, 0x02, 0x5c, 0xe2, 0x11, 0x32, 0xb0, 0xa2, 0x00, 0x0a, 0xd4, 0x12, 0xd0, 0x30, 0x0e, 0x10, 0x6b, 0x6a, 0xe9, 0x60, 0x31, 0x74, 0xd0, 0x63, 0x2d, 0x53, 0xb2, 0x94,
+  0x04, 0x0a, 0x3c, 0x00, 0x40, 0x00, 0x11, 0x93, 0x22, 0x2a, 0x11, 0x8f, 0xfe, 0x11, 0x02, 0x82, 0x00, 0x11, 0xb4, 0x7a, 0x11, 0x00, 0x2a, 0x2a, 0xa0, 0x51, 0x74, 0x31, 0x74, 0x92, 0x84, 0xd3,
+  0x8c, 0x72, 0x7c, 0xd8, 0x06, 0x40, 0x2c, 0x5b, 0xeb, 0x4a, 0x30, 0x2a, 0xc0, 0x0b, 0x53, 0xeb, 0x52, 0x8d, 0x63, 0x0b, 0x53, 0xca, 0x4a, 0x4d, 0x5b, 0x34, 0x23, 0x21, 0x0f, 0x74, 0x1e, 0x00,
+  0xf0, 0x03, 0x53, 0x2c, 0x53, 0x2d, 0x53, 0x8a, 0x42, 0x8a, 0x42, 0xcb, 0x4a, 0xf0, 0x73, 0xf3, 0x94, 0x72, 0x84, 0xae, 0x76, 0x31, 0x10, 0x63, 0x7c, 0x5f, 0xf0, 0x19, 0xf0, 0x73, 0x30, 0x7c,
+  0x0f, 0x7c, 0x4f, 0x7c, 0x2f, 0x7c, 0x4b, 0x63, 0xea, 0x52, 0x2a, 0x5b, 0x8c, 0x6b, 0x2a, 0x5b, 0x0e, 0x7c, 0x6f, 0x84, 0x6b, 0x63, 0x4b, 0x63, 0x09, 0x5b, 0xac, 0x6b, 0xcc, 0x73, 0xed, 0x7b,
+  0x4a, 0x63, 0x4a, 0x63, 0x80, 0x03, 0x00, 0xb4, 0x11, 0x40, 0x4a, 0x6b, 0x6a, 0x6b, 0x88, 0x03, 0x60, 0x4a, 0x6b, 0x4a, 0x6b, 0x2e, 0x84, 0x1a, 0x2e, 0x20, 0xd0, 0x9c, 0xba, 0x38, 0x80, 0x0a,
+  0x63, 0x27, 0x42, 0x68, 0x4a, 0x27, 0x42, 0x22, 0x0e, 0x20, 0xad, 0x73, 0xfe, 0x46, 0x11, 0x6d, 0x9c, 0x51, 0x20, 0x71, 0x8c, 0xb8, 0x11, 0x11, 0xd3, 0x20, 0xe6, 0x00, 0x34, 0x03, 0x00, 0xca,
+  0x4d, 0x00, 0x4a, 0x03, 0x02, 0x5c, 0x2a, 0x00, 0xd2, 0x1f, 0x02, 0x2e, 0x3c, 0x22, 0x8f, 0x73, 0x6a, 0x03, 0x02, 0xfa, 0x2d, 0x02, 0x56, 0x15, 0x02, 0xec, 0x11, 0x02, 0xa4, 0xc6, 0x02, 0x9c,
+  0x03, 0x11, 0x93, 0xe6, 0x11, 0x02, 0x80, 0x1c, 0x02, 0xc4, 0x0a, 0x02, 0xb6, 0x38, 0x02, 0x16, 0x20, 0x01, 0xea, 0x86, 0x02, 0x14, 0x20, 0x03, 0x8c, 0x23, 0x00, 0xdc, 0x51, 0x00, 0xec, 0x11,
+  0xc0, 0x10, 0x84, 0x14, 0xa5, 0x15, 0xa5, 0xd8, 0xbd, 0x5a, 0xce, 0x59, 0xce, 0xb4, 0x4a, 0x13, 0x11, 0xfc, 0x5f, 0x02, 0x04, 0x00, 0x0e, 0x12, 0x07, 0x0e, 0x90, 0x03, 0x0e, 0x8c, 0x03, 0x08,
+  0x7c, 0x4e, 0x06, 0xf6, 0x5f, 0x02, 0x32, 0x0e, 0x11, 0xaf, 0x02, 0x00, 0x18, 0xcf, 0x48, 0x15, 0x16, 0xb4, 0x18, 0x07, 0x0c, 0xf4, 0x3f, 0x0e, 0x30, 0x0e, 0x0a, 0x02, 0x00, 0x06, 0x9c, 0x43,
+  0x13, 0x52, 0x6c, 0x1c, 0x00, 0xa8, 0x0a, 0x00, 0x32, 0x0e, 0x00, 0x82, 0x15, 0x03, 0xf2, 0x38, 0x03, 0x20, 0x27, 0x00, 0x94, 0x03, 0x02, 0x26, 0x2e, 0x04, 0x64, 0xce, 0x04, 0x1e, 0x07, 0x06,
+  0x66, 0x55, 0x20, 0xb5, 0xc5, 0xd0, 0x18, 0x04, 0x2e, 0x07, 0x00, 0x68, 0x03, 0x00, 0x04, 0x16, 0x20, 0x37, 0xd6, 0xca, 0x75, 0x00, 0x38, 0x2e, 0x11, 0xb4, 0xf6, 0xb1, 0x02, 0x0e, 0x20, 0x02,
+  0x90, 0x5c, 0x03, 0xdc, 0x51, 0x12, 0xde, 0xaa, 0x43, 0x02, 0x98, 0x1c, 0x13, 0x98, 0xbe, 0x11, 0x00, 0xa0, 0x03, 0x00, 0x8e, 0x03, 0x01, 0x38, 0x99, 0x01, 0x20, 0x07, 0x00, 0xd0, 0x0d, 0x00,
+  0x3e, 0x2a, 0x00, 0xa4, 0x0a, 0x02, 0x08, 0x07, 0x00, 0xfa, 0x0d, 0x11, 0xb1, 0x98, 0x0a, 0x14, 0x33, 0x88, 0xd0, 0x12, 0x6c, 0xa2, 0x89, 0x11, 0x4f, 0x20, 0x66, 0x02, 0xd2, 0x0d, 0x11, 0x12,
+  0xee, 0x2d, 0x11, 0xf5, 0x04, 0x94, 0x02, 0xdc, 0x0d, 0x04, 0x62, 0xa9, 0x22, 0xed, 0x42, 0xac, 0x97, 0x11, 0x70, 0x3e, 0x15, 0x11, 0x0e, 0xba, 0xc5, 0x01, 0x4a, 0x18, 0x21, 0x74, 0xb4, 0x76,
+  0x6d, 0x11, 0xb5, 0xc2, 0x18, 0x11, 0x53, 0xc0, 0x74, 0x20, 0xf1, 0x6b, 0xec, 0xa5, 0x02, 0x3a, 0x03, 0x00, 0xba, 0x70, 0x11, 0x72, 0x6e, 0x54, 0x11, 0x72, 0xd8, 0x29, 0x31, 0x11, 0x6c, 0x31,
+  0x74, 0xe2, 0x60, 0x36, 0x95, 0xd4, 0x84, 0xb0, 0x63, 0x62, 0x66, 0x00, 0x88, 0xc2, 0x00, 0xba, 0xc9, 0x00, 0x76, 0x6d, 0x00, 0x02, 0xed, 0x00, 0xe6, 0xa9, 0x02, 0x0a, 0x07, 0x60, 0x8f, 0x5b,
+  0x6e, 0x5b, 0x6b, 0x3a, 0x72, 0x31, 0x02, 0x6c, 0xa6, 0x11, 0x6f, 0x98, 0xf0, 0x00, 0x96, 0x0a, 0x00, 0x84, 0x3f, 0x20, 0x32, 0x6c, 0x00, 0x32, 0x40, 0x32, 0x74, 0x31, 0x74, 0x40, 0xd4, 0x00,
+  0x82, 0x11, 0xf0, 0x01, 0x8e, 0x5b, 0xcb, 0x4a, 0x69, 0x3a, 0x4d, 0x5b, 0x71, 0x7c, 0x0f, 0x74, 0x30, 0x7c, 0xae, 0x6b, 0x34, 0x51, 0x00, 0x84, 0x03, 0x20, 0xca, 0x4a, 0xc8, 0x2d, 0xf0, 0x05,
+  0x2c, 0x5b, 0x0b, 0x53, 0x6d, 0x5b, 0x89, 0x42, 0xaa, 0x42, 0x4c, 0x5b, 0xcf, 0x6b, 0x30, 0x74, 0x51, 0x7c, 0xcf, 0x6b, 0x4e, 0x23, 0x33, 0x91, 0x84, 0x30, 0x30, 0x00, 0x60, 0x50, 0x7c, 0x50,
+  0x84, 0x50, 0x84, 0x9a, 0x0a, 0x00, 0x0c, 0x07, 0x20, 0x2a, 0x5b, 0x94, 0x0a, 0x00, 0x9c, 0x0a, 0x71, 0xaf, 0x8c, 0x4e, 0x84, 0x4a, 0x63, 0xcc, 0x3c, 0x15, 0xf1, 0x04, 0x29, 0x63, 0x6a, 0x6b,
+  0x2d, 0x84, 0x6f, 0x8c, 0xec, 0x7b, 0x4a, 0x63, 0x6b, 0x6b, 0x6b, 0x6b, 0x4a, 0x6b, 0xcc, 0x7e, 0x2a, 0x60, 0x09, 0x63, 0xe9, 0x62, 0xcd, 0x7b, 0x06, 0x07, 0xf1, 0x04, 0x2a, 0x63, 0x0a, 0x63,
+  0x0a, 0x63, 0x47, 0x4a, 0x27, 0x42, 0x2f, 0x84, 0xce, 0x7b, 0x91, 0x94, 0x2f, 0x84, 0x6d, 0x1e, 0x4e, 0x40, 0xeb, 0x5a, 0xad, 0x73, 0xba, 0x11, 0x60, 0x0c, 0x63, 0x6d, 0x6b, 0x2d, 0x6b, 0x44,
+  0x4a, 0x00, 0xb0, 0x06, 0x40, 0xcf, 0x7b, 0xcc, 0x5a, 0x14, 0xea, 0x40, 0x8f, 0x73, 0x6e, 0x6b, 0x86, 0x03, 0x00, 0x5c, 0x11, 0x00, 0x70, 0x23, 0x00, 0xe0, 0x26, 0x11, 0x11, 0x74, 0x1c, 0x01,
+  0xa0, 0x2a, 0x03, 0x08, 0x07, 0x04, 0x22, 0x07, 0x22, 0x72, 0x8c, 0x84, 0x03, 0x02, 0xc4, 0x11, 0x02, 0x16, 0x00, 0x04, 0x86, 0x03, 0x00, 0x9c, 0x0a, 0x00, 0x8a, 0x03, 0x02, 0x42, 0x1c, 0x00,
+  0xb0, 0x1c, 0x02, 0x78, 0x15, 0x00, 0x1c, 0x00, 0x00, 0x9c, 0x1c, 0x00, 0x3e, 0x07, 0x02, 0xdc, 0x6a, 0x40, 0x97, 0xb5, 0x15, 0xa5, 0xa4, 0x1c, 0x10, 0xaf, 0x6c, 0x20, 0x03, 0xa4, 0x0a, 0x1f,
+  0x52, 0xa4, 0x0a, 0x0a, 0x0c, 0x20, 0x07, 0x0e, 0x8a, 0x03, 0x06, 0x8e, 0x03, 0x06, 0x64, 0x3c, 0x01, 0x90, 0x03, 0x0e, 0x14, 0x47, 0x2e, 0xb4, 0xd0, 0x92, 0x03, 0x0d, 0x8c, 0x03, 0x0e, 0x90,
+  0x03, 0x07, 0x18, 0x07, 0x05, 0x92, 0x03, 0x05, 0x30, 0x0e, 0x14, 0xc5, 0x02, 0x00, 0x10, 0x74, 0xe2, 0x78, 0x05, 0x10, 0x20, 0x04, 0x78, 0xb5, 0x13, 0x94, 0x12, 0xc0, 0x04, 0x7a, 0x03, 0x04,
+  0x70, 0x55, 0x02, 0xea, 0x18, 0x02, 0xa4, 0x7c, 0x04, 0x1e, 0x40, 0x40, 0xfa, 0xee, 0x74, 0xbd, 0x1c, 0x07, 0x00, 0x6a, 0x87, 0x02, 0xf6, 0x11, 0x02, 0x7e, 0x3c, 0x00, 0xfe, 0x3f, 0x13, 0x57,
+  0x68, 0x35, 0x02, 0x7a, 0x1c, 0x02, 0xc4, 0x11, 0x02, 0x16, 0x20, 0x11, 0x98, 0x6a, 0x15, 0x40, 0xfa, 0xee, 0xb8, 0xe6, 0x5c, 0x0e, 0x00, 0xa0, 0x23, 0x00, 0x3a, 0x07, 0x11, 0x33, 0xfe, 0x50,
+  0x00, 0x78, 0x23, 0x00, 0x8e, 0x03, 0x02, 0x1e, 0x07, 0x13, 0xb0, 0x36, 0x2a, 0x10, 0x2f, 0xb8, 0x2d, 0x01, 0xfe, 0x3f, 0x00, 0x3c, 0x0e, 0x01, 0xbe, 0xda, 0x01, 0xde, 0x69, 0x00, 0x5e, 0x4d,
+  0x02, 0xcc, 0x49, 0x00, 0x68, 0xec, 0x00, 0x28, 0xc2, 0x13, 0x2e, 0xe2, 0x2d, 0x00, 0xac, 0x89, 0x02, 0xb6, 0x4d, 0x11, 0x90, 0xda, 0x18, 0x00, 0xa0, 0x06, 0x02, 0x7c, 0x2a, 0x02, 0xce, 0xf3,
+  0x02, 0x36, 0x19, 0x00, 0x6e, 0x15, 0x11, 0xd0, 0x18, 0x31, 0x60, 0x2e, 0x4b, 0x0d, 0x4b, 0xcf, 0x63, 0x52, 0x1f, 0xf0, 0x00, 0x52, 0x74, 0xd3, 0x84, 0x51, 0x74, 0x51, 0x74, 0x31, 0x6c, 0xb3,
+  0x84, 0x72, 0x74, 0x51, 0xba, 0x14, 0x24, 0x6c, 0xaf, 0x1c, 0xc2, 0x32, 0x63, 0xb3, 0x84, 0xcc, 0x14, 0x20, 0xf0, 0x6b, 0xfa, 0xfa, 0x20, 0xb0, 0x63, 0x42, 0x2a, 0x00, 0x42, 0x5f, 0x02, 0x08,
+  0xb8, 0x00, 0x16, 0x15, 0x00, 0x96, 0x38, 0x02, 0x34, 0x0e, 0x20, 0xb3, 0x7c, 0xb4, 0x03, 0x01, 0xfc, 0x70, 0x12, 0x63, 0xaa, 0x3c, 0x10, 0xf1, 0xc4, 0x03, 0x00, 0xce, 0x74, 0xd0, 0x63, 0x8f,
+  0x5b, 0xab, 0x42, 0xab, 0x42, 0xaa, 0x42, 0x0c, 0x53, 0x0f, 0x74, 0x92, 0x0a, 0x00, 0xb8, 0x54, 0x00, 0x06, 0x43, 0x60, 0x89, 0x42, 0x2c, 0x5b, 0xef, 0x73, 0xd6, 0x2d, 0x80, 0x71, 0x84, 0x91,
+  0x84, 0x0f, 0x74, 0x50, 0x7c, 0x32, 0x07, 0x40, 0x0f, 0x74, 0xb2, 0x8c, 0xba, 0x0a, 0x20, 0x4d, 0x5b, 0xb0, 0x46, 0xb3, 0xaa, 0x4a, 0xa6, 0x29, 0x48, 0x3a, 0xeb, 0x52, 0x6c, 0x63, 0x4b, 0xac,
+  0x11, 0xc1, 0x2b, 0x5b, 0xea, 0x52, 0x8c, 0x6b, 0x0e, 0x7c, 0xb0, 0x8c, 0x0d, 0x7c, 0x08, 0x07, 0x10, 0x6b, 0x02, 0x00, 0xf0, 0x03, 0x0d, 0x7c, 0x8b, 0x6b, 0xec, 0x7b, 0x8f, 0x8c, 0x8f, 0x8c,
+  0x2d, 0x84, 0x8b, 0x6b, 0x09, 0x63, 0x4a, 0x63, 0xa4, 0x11, 0x60, 0x4a, 0x6b, 0x6b, 0x6b, 0xac, 0x73, 0x1e, 0x0e, 0xc0, 0x6f, 0x94, 0x6c, 0x73, 0x8c, 0x73, 0x2b, 0x63, 0x0a, 0x63, 0xac, 0x73,
+  0xd0, 0x66, 0x20, 0x0a, 0x63, 0x88, 0x03, 0xa0, 0x6d, 0x6b, 0x8d, 0x73, 0xef, 0x7b, 0xef, 0x83, 0x2c, 0x63, 0x64, 0x43, 0x00, 0x10, 0x00, 0x20, 0x2c, 0x6b, 0x46, 0x15, 0x11, 0xaf, 0x64, 0x23,
+  0x10, 0xcf, 0xe4, 0x14, 0x10, 0x73, 0xa0, 0x26, 0x00, 0x5a, 0x11, 0x02, 0xbc, 0x8d, 0x00, 0x26, 0x07, 0x11, 0x8e, 0x9a, 0x2a, 0x01, 0xd2, 0x1f, 0x01, 0xe6, 0x0d, 0x01, 0xea, 0x26, 0x03, 0xf4,
+  0x0d, 0x11, 0x72, 0x82, 0x15, 0x02, 0x84, 0x03, 0x03, 0x96, 0x23, 0x12, 0x84, 0x62, 0x8a, 0x02, 0x50, 0x0e, 0x11, 0x72, 0xe6, 0x86, 0x02, 0xb4, 0x23, 0x01, 0xae, 0x15, 0x00, 0x88, 0x15, 0x01,
+  0xde, 0x11, 0x04, 0xb2, 0x4a, 0x40, 0xf8, 0xc5, 0xb7, 0xbd, 0x90, 0x03, 0x61, 0xaf, 0x7b, 0x2d, 0x6b, 0x31, 0x8c, 0x28, 0x12, 0x01, 0x78, 0x7c, 0x07, 0xb8, 0x4a, 0x0f, 0x1e, 0x07, 0x0e, 0x0e,
+  0x28, 0x07, 0x06, 0x86, 0x03, 0x02, 0xe0, 0x63, 0x04, 0xf8, 0x5f, 0x00, 0x7c, 0x23, 0x02, 0x80, 0x23, 0x0e, 0xa8, 0x0a, 0x16, 0xf0, 0x8a, 0x03, 0x16, 0xac, 0x0e, 0x47, 0x04, 0x9e, 0x4a, 0x08,
+  0xc2, 0x91, 0x04, 0x90, 0x43, 0x02, 0xdc, 0x38, 0x09, 0x92, 0x03, 0x02, 0xca, 0x11, 0x13, 0xb5, 0xa2, 0x0a, 0x03, 0xb8, 0x0a, 0x11, 0x32, 0x4c, 0x6e, 0x02, 0xba, 0x0a, 0x11, 0xb4, 0xf2, 0x91,
+  0x11, 0xb4, 0xb4, 0x0a, 0x04, 0xe4, 0x91, 0x02, 0x1a, 0x60, 0x04, 0xd0, 0x11, 0x02, 0x76, 0x15, 0x00, 0xae, 0x2a, 0x00, 0x3c, 0xc7, 0x00, 0x08, 0x0e, 0x00, 0x6e, 0xee, 0x02, 0x66, 0xa0, 0x60,
+  0xb0, 0xa4, 0xb4, 0xc5, 0xb9, 0xe6, 0xbe, 0x11, 0x05, 0x10, 0x40, 0x03, 0xae, 0x0a, 0x24, 0x16, 0xce, 0x00, 0x20, 0x02, 0x5a, 0x4e, 0x02, 0xda, 0x31, 0x00, 0x74, 0x55, 0x00, 0x5e, 0x52, 0x11,
+  0x57, 0x36, 0x60, 0x02, 0x8e, 0x03, 0x20, 0x78, 0xde, 0x92, 0x23, 0x00, 0x84, 0x18, 0x00, 0x3a, 0x6d, 0x04, 0x46, 0x23, 0x00, 0xc0, 0x06, 0x12, 0x94, 0x06, 0x07, 0x12, 0x64, 0x0a, 0x94, 0x02,
+  0x7c, 0x5f, 0x00, 0x82, 0x0a, 0x00, 0xbc, 0x1f, 0x71, 0xd4, 0x84, 0x52, 0x6c, 0x93, 0x7c, 0x11, 0xc2, 0x18, 0x04, 0x78, 0x15, 0x02, 0x26, 0x5f, 0x00, 0x0c, 0x3c, 0xe0, 0x77, 0x95, 0xb8, 0x9d,
+  0x16, 0x8d, 0x98, 0x9d, 0x15, 0x8d, 0xb8, 0x9d, 0x97, 0x9d, 0x04, 0x00, 0x10, 0xb4, 0x12, 0x18, 0x01, 0xae, 0xe5, 0x10, 0x8f, 0x5e, 0xde, 0x00, 0x5e, 0x2d, 0x10, 0x4b, 0xbc, 0xa9, 0x42, 0x72,
+  0x7c, 0x15, 0x8d, 0x86, 0x03, 0x20, 0xb3, 0x84, 0xca, 0x22, 0x71, 0xaf, 0x63, 0xef, 0x63, 0x10, 0x6c, 0x10, 0xac, 0xc9, 0x40, 0x51, 0x74, 0xef, 0x63, 0x0a, 0x00, 0x11, 0xcf, 0x92, 0x26, 0x20,
+  0x6e, 0x5b, 0x84, 0x18, 0x20, 0x2d, 0x53, 0xd6, 0xcc, 0x11, 0x6f, 0xf2, 0x69, 0x22, 0x6b, 0x3a, 0x6c, 0xe2, 0x22, 0x52, 0x74, 0x62, 0x46, 0x20, 0x11, 0x6c, 0x28, 0x71, 0x31, 0x32, 0x74, 0x72,
+  0x5a, 0xfb, 0x00, 0xba, 0xbb, 0x00, 0x3e, 0xdb, 0x40, 0x36, 0x95, 0x36, 0x8d, 0x72, 0x07, 0x20, 0xac, 0x42, 0x08, 0x0e, 0x50, 0xaf, 0x63, 0x4d, 0x5b, 0xae, 0x42, 0x58, 0x10, 0x6b, 0x28, 0x23,
+  0x20, 0xeb, 0x52, 0x24, 0x1c, 0xf3, 0x02, 0xeb, 0x52, 0xae, 0x6b, 0x8d, 0x63, 0xef, 0x73, 0x4c, 0x5b, 0x0b, 0x53, 0xce, 0x6b, 0xce, 0x6b, 0x0c, 0x1a, 0x07, 0x80, 0x48, 0x3a, 0xce, 0x6b, 0xaa,
+  0x42, 0xaa, 0x4a, 0xb8, 0x0a, 0x00, 0x1c, 0x00, 0x00, 0x30, 0x15, 0x80, 0x30, 0x7c, 0x2f, 0x7c, 0x13, 0x9d, 0xee, 0x73, 0xae, 0x11, 0xf2, 0x0b, 0x8c, 0x63, 0x67, 0x42, 0xac, 0x6b, 0x2e, 0x7c,
+  0xd1, 0x94, 0xac, 0x73, 0x87, 0x4a, 0xac, 0x73, 0x8f, 0x8c, 0x0d, 0x7c, 0x09, 0x5b, 0xec, 0x7b, 0x4d, 0x84, 0x98, 0x03, 0x20, 0x6a, 0x6b, 0xb4, 0x11, 0x80, 0x0d, 0x84, 0x0e, 0x84, 0xcc, 0x73,
+  0x6f, 0x8c, 0x0e, 0x2e, 0x00, 0x1a, 0x2e, 0x60, 0xed, 0x7b, 0x2b, 0x63, 0x68, 0x4a, 0x8c, 0x03, 0x80, 0xa9, 0x52, 0xc9, 0x5a, 0xea, 0x5a, 0xca, 0x5a, 0xc8, 0x18, 0x00, 0x74, 0x6a, 0x11, 0x10,
+  0xfa, 0x6d, 0x00, 0xd2, 0x18, 0x00, 0x48, 0x15, 0x00, 0xaa, 0x11, 0x11, 0xcf, 0xb0, 0x38, 0x04, 0x60, 0x0a, 0x15, 0x72, 0xe4, 0xa9, 0x13, 0x52, 0x64, 0x78, 0x11, 0xb3, 0xe8, 0x34, 0x13, 0xd4,
+  0x7c, 0xbf, 0x02, 0x28, 0x0e, 0x02, 0x0a, 0x00, 0x04, 0x72, 0xb8, 0x04, 0x94, 0x98, 0x04, 0x94, 0x11, 0x11, 0x72, 0xbc, 0x0a, 0x12, 0x31, 0x24, 0x20, 0x01, 0xe8, 0x26, 0x02, 0x2a, 0x40, 0x11,
+  0xd0, 0x9c, 0x5c, 0x00, 0x84, 0x5c, 0x00, 0xd6, 0x4a, 0x13, 0x11, 0x00, 0x87, 0x00, 0x7a, 0x00, 0x00, 0x18, 0x07, 0x06, 0x5e, 0x03, 0x11, 0x31, 0x18, 0x07, 0x02, 0xa4, 0x0a, 0x04, 0x06, 0x00,
+  0x0f, 0x92, 0x03, 0x13, 0x1e, 0x92, 0x1a, 0x07, 0x04, 0xc4, 0x11, 0x14, 0x94, 0xde, 0x18, 0x10, 0xb0, 0x86, 0xf1, 0x0f, 0x14, 0x47, 0x01, 0x0d, 0x1a, 0x07, 0x06, 0xb4, 0x11, 0x1f, 0x32, 0xd6,
+  0x18, 0x04, 0x05, 0x02, 0x00, 0x01, 0x98, 0x03, 0x04, 0x3a, 0x0e, 0x02, 0x18, 0x07, 0x02, 0xb2, 0x0a, 0x00, 0x8c, 0x03, 0x11, 0x93, 0x7e, 0x03, 0x12, 0x53, 0x48, 0x87, 0x01, 0x0a, 0x80, 0x00,
+  0x10, 0x52, 0x02, 0x96, 0x03, 0x02, 0xba, 0xaa, 0x02, 0x4c, 0x15, 0x06, 0x90, 0x03, 0x11, 0xb4, 0x96, 0x63, 0x00, 0xc8, 0x11, 0x02, 0x66, 0x1c, 0x03, 0xaa, 0x11, 0x30, 0xd6, 0x53, 0xb5, 0x44,
+  0xa0, 0x00, 0x58, 0x3c, 0x02, 0xbe, 0x31, 0x01, 0xde, 0xa3, 0x03, 0x18, 0x07, 0x02, 0x58, 0x15, 0x02, 0xe0, 0x31, 0x00, 0xce, 0x03, 0x01, 0x8c, 0x3c, 0x12, 0xde, 0xd8, 0xa3, 0x20, 0x16, 0xd6,
+  0x74, 0x55, 0x00, 0x8c, 0x03, 0x00, 0x58, 0x0e, 0x00, 0x08, 0x00, 0x22, 0xb4, 0x7c, 0x58, 0x97, 0x02, 0xb2, 0x4d, 0x00, 0xd0, 0x38, 0x00, 0x74, 0x1f, 0x11, 0x53, 0x68, 0x74, 0x20, 0x57, 0x95,
+  0x36, 0x23, 0x00, 0x3e, 0x31, 0x00, 0x44, 0x2a, 0x00, 0xba, 0xec, 0x02, 0xf6, 0x3b, 0x02, 0x26, 0x3c, 0x02, 0x1a, 0x11, 0x40, 0x15, 0x8d, 0x77, 0x95, 0x6c, 0x18, 0x31, 0x93, 0x74, 0x93, 0x54,
+  0x0e, 0x02, 0x8e, 0xc5, 0x00, 0xac, 0x03, 0x00, 0xc8, 0x0d, 0x00, 0xb8, 0xb7, 0x04, 0x1a, 0xd4, 0x80, 0x93, 0x7c, 0x93, 0x7c, 0x31, 0x6c, 0x52, 0x6c, 0xea, 0x0d, 0xa0, 0xf4, 0x84, 0x72, 0x74,
+  0xcf, 0x63, 0xf0, 0x63, 0x2d, 0x53, 0xde, 0x14, 0xf0, 0x0f, 0xef, 0x6b, 0x4c, 0x53, 0xcb, 0x42, 0x28, 0x32, 0xeb, 0x42, 0x0b, 0x4b, 0xca, 0x42, 0x0c, 0x4b, 0xca, 0x42, 0x48, 0x32, 0x08, 0x2a,
+  0xaa, 0x42, 0xca, 0x42, 0x4d, 0x53, 0x8d, 0x5b, 0xe0, 0x14, 0x40, 0x2c, 0x4b, 0xcf, 0x63, 0x2a, 0x0e, 0x00, 0xbe, 0x26, 0x00, 0xfa, 0xec, 0x11, 0x4e, 0x46, 0xcd, 0x40, 0xcc, 0x42, 0xd0, 0x63,
+  0x22, 0x07, 0x00, 0xb4, 0xe9, 0x00, 0xa8, 0x52, 0x00, 0x4e, 0x15, 0x20, 0x67, 0x11, 0x08, 0x6b, 0x01, 0x2e, 0x27, 0xd0, 0x95, 0x76, 0x9d, 0x32, 0x74, 0x46, 0x11, 0x09, 0x2a, 0xd0, 0x6b, 0xd4,
+  0x84, 0x02, 0x2e, 0x00, 0x7c, 0x2a, 0x31, 0x71, 0x84, 0xae, 0x1a, 0x4a, 0xf0, 0x13, 0x4c, 0x5b, 0x0f, 0x74, 0x2f, 0x7c, 0xad, 0x6b, 0x8d, 0x63, 0x71, 0x7c, 0x8d, 0x63, 0x89, 0x42, 0xae, 0x63,
+  0x30, 0x74, 0x8d, 0x63, 0xd2, 0x8c, 0xf3, 0x94, 0xca, 0x4a, 0x30, 0x74, 0xae, 0x6b, 0x91, 0x84, 0x84, 0x03, 0x00, 0x5a, 0x0e, 0x02, 0xf4, 0x5b, 0xf0, 0x23, 0x91, 0x8c, 0xad, 0x6b, 0x2f, 0x7c,
+  0x8d, 0x6b, 0x2b, 0x5b, 0x88, 0x4a, 0x47, 0x42, 0xa8, 0x52, 0xe9, 0x52, 0x6b, 0x63, 0xcc, 0x73, 0x4e, 0x84, 0x87, 0x4a, 0x2a, 0x63, 0xaf, 0x94, 0x6f, 0x8c, 0x09, 0x5b, 0x29, 0x63, 0x4e, 0x84,
+  0x6a, 0x6b, 0x09, 0x5b, 0x09, 0x5b, 0x0d, 0x84, 0x0d, 0x7c, 0xac, 0x73, 0x50, 0x1c, 0x80, 0x87, 0x52, 0x09, 0x5b, 0x0a, 0x5b, 0x0a, 0x5b, 0x22, 0x35, 0x00, 0x02, 0x2e, 0x00, 0xa0, 0x58, 0x20,
+  0x90, 0x94, 0x62, 0x43, 0xa0, 0x6c, 0x6b, 0xce, 0x7b, 0xee, 0x7b, 0x70, 0x8c, 0x8d, 0x73, 0xe6, 0x4d, 0xe0, 0xaa, 0x5a, 0x2c, 0x6b, 0x69, 0x4a, 0x0c, 0x63, 0xcf, 0x7b, 0xf3, 0x9c, 0x10, 0x84,
+  0xc8, 0x4d, 0x02, 0xee, 0x46, 0x01, 0x3c, 0x43, 0x02, 0xe2, 0x0d, 0x01, 0xa6, 0x11, 0x04, 0x54, 0x03, 0x60, 0x93, 0x94, 0xaf, 0x73, 0xec, 0x5a, 0xfe, 0x06, 0x00, 0xc0, 0x0a, 0x02, 0x3c, 0x0e,
+  0x00, 0x48, 0x0e, 0x02, 0x04, 0x07, 0x04, 0xd2, 0x11, 0x11, 0xf0, 0xcc, 0x0a, 0x13, 0x52, 0xca, 0x03, 0x13, 0x31, 0x12, 0x00, 0x00, 0x68, 0x03, 0x00, 0x32, 0x35, 0x00, 0x52, 0x27, 0x00, 0x18,
+  0x60, 0x11, 0x72, 0x6c, 0xa3, 0x02, 0x1a, 0x20, 0x00, 0x8c, 0x3c, 0x00, 0xd0, 0x2a, 0x00, 0xd0, 0xbf, 0x61, 0x7a, 0xd6, 0xf8, 0xc5, 0xd4, 0x9c, 0x20, 0x40, 0x09, 0x66, 0x1c, 0x06, 0x6c, 0x03,
+  0x0f, 0x3c, 0x0e, 0x0d, 0x0a, 0xb0, 0x0a, 0x0e, 0x8e, 0x03, 0x07, 0x5e, 0x3c, 0x03, 0x90, 0x03, 0x17, 0xaf, 0xc2, 0x51, 0x07, 0xf2, 0xdf, 0x0b, 0x8e, 0x03, 0x08, 0x70, 0x23, 0x0e, 0x9e, 0x0a,
+  0x06, 0x9e, 0x43, 0x0b, 0x22, 0x07, 0x05, 0xc2, 0x11, 0x30, 0x93, 0xc5, 0xd0, 0xb8, 0x71, 0x01, 0x72, 0xb5, 0x00, 0x4a, 0x47, 0x44, 0xb4, 0xcd, 0x73, 0xbd, 0x0c, 0xf9, 0x00, 0x4a, 0x87, 0x04,
+  0x9c, 0xfc, 0x02, 0xa6, 0x0a, 0x02, 0x1c, 0x60, 0x02, 0x04, 0x20, 0x02, 0x54, 0x1c, 0x02, 0x7c, 0x7c, 0x20, 0xb5, 0xc5, 0xfc, 0x06, 0x40, 0xf1, 0xac, 0xfa, 0xee, 0x04, 0x8b, 0x00, 0x9a, 0x11,
+  0x02, 0x9e, 0x83, 0x02, 0x32, 0x0e, 0x00, 0x0a, 0x00, 0x02, 0x58, 0x6e, 0x00, 0x6c, 0x03, 0x03, 0x30, 0x47, 0x21, 0xd6, 0x78, 0xec, 0x38, 0x04, 0x20, 0x27, 0x40, 0x98, 0xde, 0x1a, 0xf7, 0x62,
+  0x15, 0x02, 0x3c, 0x0e, 0x20, 0x98, 0xde, 0x02, 0x00, 0x22, 0x6f, 0x53, 0xda, 0x1f, 0x13, 0x94, 0x0c, 0x51, 0x21, 0x15, 0x8d, 0x62, 0xd3, 0x01, 0x22, 0xf0, 0x02, 0xb2, 0x7e, 0x20, 0xcc, 0x42,
+  0x94, 0xb7, 0x20, 0xac, 0x3a, 0xc4, 0x0a, 0x20, 0x8b, 0x3a, 0x4c, 0xbb, 0x00, 0x34, 0x18, 0x02, 0xb4, 0xa5, 0x11, 0xd0, 0xd8, 0x0d, 0x00, 0xd2, 0x22, 0x00, 0xcc, 0x26, 0x00, 0xea, 0x14, 0x00,
+  0x9c, 0x26, 0x00, 0xcc, 0x77, 0x00, 0xd6, 0x97, 0x51, 0xaf, 0x5b, 0x72, 0x74, 0x32, 0x56, 0xbb, 0x42, 0xd0, 0x63, 0x6e, 0x53, 0x92, 0x03, 0x11, 0x6e, 0xae, 0xa9, 0x00, 0x2c, 0xcd, 0x40, 0xaf,
+  0x5b, 0xae, 0x5b, 0xe4, 0x29, 0xf0, 0x07, 0x0c, 0x4b, 0x2c, 0x53, 0x8e, 0x5b, 0xae, 0x5b, 0xce, 0x63, 0xeb, 0x4a, 0x4c, 0x53, 0xae, 0x63, 0x6d, 0x5b, 0x0c, 0x4b, 0xaa, 0x42, 0xe8, 0x14, 0x00,
+  0xb2, 0x2d, 0x20, 0xca, 0x42, 0x52, 0xcd, 0x40, 0x8e, 0x5b, 0xcb, 0x42, 0x94, 0x1f, 0x40, 0x8b, 0x3a, 0x2a, 0x32, 0xbc, 0x34, 0x20, 0x73, 0x7c, 0x9e, 0x00, 0x62, 0x52, 0x74, 0x8f, 0x5b, 0xec,
+  0x42, 0x42, 0x43, 0x00, 0x04, 0x07, 0x11, 0x8f, 0xb2, 0x26, 0x40, 0x2d, 0x4b, 0x11, 0x6c, 0x68, 0x00, 0x60, 0x6a, 0x32, 0x4a, 0x32, 0x8f, 0x5b, 0x2c, 0x78, 0xe0, 0xb7, 0xa5, 0xb3, 0x84, 0x92,
+  0x84, 0xaf, 0x63, 0xef, 0x6b, 0x0f, 0x74, 0xaa, 0x4a, 0xfa, 0x06, 0x22, 0xce, 0x6b, 0xba, 0x11, 0x51, 0xee, 0x73, 0xce, 0x6b, 0x2c, 0xb8, 0x0a, 0x00, 0x12, 0x00, 0xf0, 0x09, 0xeb, 0x4a, 0xae,
+  0x6b, 0xeb, 0x52, 0x50, 0x7c, 0xb2, 0x8c, 0x8d, 0x63, 0x2c, 0x53, 0x4c, 0x5b, 0x6d, 0x63, 0x50, 0x7c, 0x34, 0x9d, 0x70, 0x84, 0x0c, 0x63, 0x10, 0x6c, 0x42, 0x15, 0xf0, 0x02, 0x63, 0x2b, 0x5b,
+  0x2a, 0x5b, 0x2a, 0x5b, 0xe9, 0x5a, 0xac, 0x73, 0x6f, 0x84, 0x4e, 0x84, 0xcc, 0x73, 0xb2, 0x11, 0x00, 0x02, 0x00, 0x20, 0xc8, 0x52, 0xb0, 0x0a, 0x60, 0xe8, 0x5a, 0xab, 0x73, 0x31, 0xa5, 0x42,
+  0x0e, 0x90, 0xe9, 0x5a, 0x4a, 0x6b, 0xac, 0x73, 0x6b, 0x6b, 0x0e, 0x5a, 0x43, 0x50, 0x73, 0x4b, 0x63, 0xea, 0x5a, 0x8a, 0x58, 0x00, 0x3e, 0x5c, 0x00, 0xda, 0x1f, 0x80, 0x8d, 0x73, 0x50, 0x8c,
+  0x4c, 0x6b, 0xaa, 0x52, 0x9c, 0x0a, 0x52, 0x0f, 0x84, 0x2c, 0x63, 0x30, 0x30, 0x4a, 0x10, 0x9c, 0x70, 0x1f, 0x71, 0x2d, 0x6b, 0xcb, 0x5a, 0x6e, 0x6b, 0x8e, 0xd6, 0x1f, 0x11, 0x10, 0x7e, 0x03,
+  0x00, 0x24, 0x0e, 0x02, 0xfc, 0x0d, 0xa2, 0x6f, 0x6b, 0xb0, 0x7b, 0x31, 0x84, 0x8f, 0x73, 0xf1, 0x7b, 0x98, 0x03, 0x02, 0x4a, 0x1c, 0x02, 0x80, 0x0a, 0x04, 0x40, 0x15, 0x15, 0x31, 0x68, 0x91,
+  0x02, 0x56, 0x15, 0x03, 0x6a, 0x23, 0x03, 0x38, 0x0e, 0x02, 0x38, 0x00, 0x02, 0x22, 0x07, 0x00, 0x92, 0x63, 0x11, 0xb3, 0x08, 0x40, 0x00, 0x12, 0x47, 0x02, 0x9a, 0x3c, 0x20, 0xd0, 0x7b, 0xc2,
+  0x6a, 0x00, 0x2a, 0x2e, 0x20, 0x15, 0xa5, 0x0e, 0x0b, 0x02, 0x68, 0x6e, 0x06, 0x9e, 0x0a, 0x04, 0x2e, 0x0e, 0x1f, 0x52, 0x90, 0x03, 0x1e, 0x0f, 0x8e, 0x03, 0x01, 0x05, 0x7c, 0x43, 0x09, 0xe0,
+  0x58, 0x07, 0x8e, 0x03, 0x03, 0x4e, 0x15, 0x0c, 0x7a, 0x43, 0x08, 0x10, 0x47, 0x06, 0x1e, 0x0e, 0x0c, 0x10, 0x07, 0x02, 0x20, 0x47, 0x04, 0x88, 0x03, 0x04, 0xf8, 0x1f, 0x13, 0x32, 0x26, 0x07,
+  0x42, 0xb4, 0xc5, 0x32, 0xbd, 0x3e, 0x0e, 0x00, 0xee, 0x46, 0x00, 0x0a, 0x00, 0x02, 0x9e, 0x9c, 0x13, 0x94, 0xee, 0xd1, 0x02, 0xb6, 0x83, 0x08, 0x68, 0x35, 0x02, 0xc2, 0xc3, 0x02, 0xa6, 0xbc,
+  0x02, 0xf8, 0x38, 0x00, 0xa2, 0x9c, 0x20, 0xd9, 0xee, 0x06, 0xdd, 0x20, 0xd9, 0xe6, 0xb4, 0x03, 0x00, 0x08, 0x0e, 0x00, 0x26, 0x00, 0x02, 0xd8, 0x71, 0x15, 0x16, 0x5a, 0x35, 0x01, 0x46, 0x67,
+  0x12, 0xce, 0xb6, 0x0a, 0x31, 0xd5, 0xc5, 0x78, 0x78, 0x1c, 0x00, 0xfa, 0x38, 0x20, 0xb9, 0xe6, 0x0e, 0x20, 0x33, 0x1a, 0xef, 0x78, 0x52, 0x2e, 0x00, 0x20, 0x07, 0x20, 0x15, 0x85, 0xfe, 0xda,
+  0x11, 0x52, 0x0a, 0x27, 0x20, 0xd0, 0x63, 0x80, 0xb0, 0x60, 0x93, 0x7c, 0x72, 0x74, 0xd0, 0x63, 0x7c, 0x69, 0x11, 0x72, 0x70, 0x3b, 0x40, 0x72, 0x74, 0x93, 0x7c, 0x96, 0x14, 0x11, 0x72, 0x6c,
+  0x1c, 0x11, 0x31, 0x56, 0x03, 0x22, 0x11, 0x6c, 0xee, 0x37, 0x00, 0x32, 0xd7, 0x00, 0x9c, 0x3b, 0x00, 0xc8, 0xb7, 0x02, 0x14, 0x07, 0x00, 0x02, 0x86, 0xa0, 0x72, 0x74, 0x56, 0x95, 0x52, 0x74,
+  0x10, 0x6c, 0xf0, 0x63, 0x3c, 0xdb, 0x00, 0xf2, 0x0d, 0x02, 0x96, 0x18, 0x00, 0x32, 0x6e, 0x10, 0x11, 0x38, 0x6b, 0x10, 0x6c, 0xb8, 0xc9, 0x00, 0xf0, 0xec, 0xd1, 0x2c, 0x53, 0x4c, 0x53, 0xeb,
+  0x4a, 0x6d, 0x53, 0x4c, 0x53, 0x2c, 0x4b, 0x6d, 0x14, 0x00, 0xa0, 0x49, 0x32, 0xeb, 0x4a, 0xcb, 0x42, 0x4d, 0x53, 0x6d, 0x5b, 0x02, 0x00, 0x20, 0xce, 0x63, 0xfe, 0xd7, 0x02, 0xb0, 0x34, 0xc0,
+  0x6a, 0x3a, 0x8b, 0x3a, 0xec, 0x4a, 0x8f, 0x5b, 0xf0, 0x6b, 0xd0, 0x63, 0xf8, 0xd7, 0x01, 0x5a, 0x00, 0x10, 0x5b, 0x5a, 0x2a, 0x00, 0x18, 0x00, 0x00, 0x02, 0x04, 0x02, 0xd2, 0xde, 0x00, 0x94,
+  0x1c, 0x00, 0x36, 0x07, 0x11, 0xb3, 0x50, 0x7f, 0x40, 0xb3, 0x84, 0xd4, 0x8c, 0xd8, 0x1f, 0xc0, 0xcb, 0x4a, 0x6d, 0x5b, 0xae, 0x6b, 0x6d, 0x5b, 0x0f, 0x74, 0x13, 0x95, 0xa0, 0x18, 0x40, 0xee,
+  0x73, 0x0f, 0x74, 0x8a, 0x0a, 0x00, 0xae, 0x0a, 0x00, 0x16, 0x04, 0x00, 0x98, 0x03, 0x40, 0xca, 0x4a, 0x48, 0x3a, 0x26, 0x0e, 0x22, 0x08, 0x32, 0x70, 0x15, 0x80, 0x50, 0x7c, 0x75, 0xa5, 0x2f,
+  0x7c, 0xcd, 0x73, 0x88, 0x03, 0x20, 0x6c, 0x63, 0xa8, 0x0a, 0x20, 0x0e, 0x7c, 0xee, 0x26, 0xa2, 0xd0, 0x94, 0x0e, 0x7c, 0x2e, 0x84, 0xe9, 0x5a, 0x6b, 0x6b, 0x96, 0x38, 0xa0, 0x2a, 0x63, 0xa8,
+  0x52, 0x09, 0x5b, 0x8b, 0x6b, 0x2d, 0x84, 0xdc, 0x18, 0x00, 0x72, 0x23, 0x60, 0xcc, 0x7b, 0x2a, 0x6b, 0x8c, 0x73, 0xda, 0x1f, 0x80, 0x6c, 0x6b, 0x4b, 0x63, 0xee, 0x7b, 0xea, 0x5a, 0xec, 0x6d,
+  0x20, 0x68, 0x4a, 0x74, 0x4a, 0x40, 0xeb, 0x62, 0x2c, 0x63, 0x1e, 0x0e, 0x00, 0x76, 0x6a, 0x00, 0x48, 0x8a, 0x11, 0xb2, 0xf0, 0x54, 0x00, 0xf2, 0x54, 0x11, 0xcf, 0x2c, 0x63, 0x00, 0xf2, 0x26,
+  0x11, 0xd3, 0x26, 0x4a, 0x00, 0xfa, 0x6d, 0x00, 0xe2, 0x06, 0x22, 0xd0, 0x7b, 0x34, 0x1c, 0x00, 0x62, 0x03, 0x00, 0x30, 0x0e, 0x00, 0xf4, 0xa2, 0x02, 0x0e, 0x35, 0x02, 0x56, 0x4a, 0x02, 0xc0,
+  0x11, 0x02, 0xe0, 0x18, 0x02, 0x1c, 0x27, 0x04, 0x96, 0x23, 0x11, 0xf0, 0x20, 0x07, 0x06, 0x06, 0x20, 0x04, 0x58, 0x15, 0x00, 0xee, 0x1f, 0x02, 0xdc, 0x51, 0x01, 0x56, 0x20, 0x21, 0x83, 0x92,
+  0x7a, 0x23, 0x00, 0x48, 0x6e, 0x01, 0xb4, 0x83, 0x10, 0xb5, 0x0e, 0x27, 0x11, 0x10, 0xa8, 0x63, 0x10, 0x92, 0x86, 0x4e, 0x09, 0x10, 0x07, 0x2f, 0x51, 0x8c, 0x8c, 0x03, 0x09, 0x1f, 0x92, 0x90,
+  0x03, 0x13, 0x21, 0x94, 0x92, 0x18, 0x6b, 0x04, 0xee, 0x3f, 0x0a, 0x62, 0x3c, 0x04, 0x12, 0x67, 0x08, 0x90, 0x03, 0x0a, 0x50, 0x15, 0x09, 0x90, 0x03, 0x0a, 0xa8, 0x0a, 0x00, 0x34, 0x4e, 0x03,
+  0xb8, 0x31, 0x02, 0xde, 0x18, 0x0a, 0x5c, 0x15, 0x02, 0x08, 0x07, 0x13, 0x52, 0x28, 0x07, 0x01, 0x02, 0x79, 0x10, 0xcd, 0x90, 0x03, 0x06, 0xea, 0x18, 0x02, 0x92, 0x03, 0x02, 0x64, 0xa7, 0x02,
+  0x66, 0x15, 0x15, 0xf5, 0x90, 0x03, 0x02, 0xac, 0x0a, 0x13, 0xf5, 0x12, 0x40, 0x00, 0x04, 0x00, 0x00, 0x5e, 0x75, 0x00, 0x34, 0x15, 0x00, 0x8c, 0x55, 0x04, 0x9e, 0x83, 0x01, 0x0c, 0x59, 0x01,
+  0x7a, 0x1c, 0x00, 0x1a, 0x00, 0x22, 0x77, 0xde, 0x64, 0x55, 0x00, 0xa2, 0x0a, 0x22, 0x74, 0xbd, 0x26, 0x20, 0x02, 0x2a, 0x40, 0x60, 0x70, 0x9c, 0x57, 0xd6, 0xf9, 0xee, 0x42, 0x0e, 0x32, 0xfa,
+  0xee, 0xb9, 0x3e, 0x07, 0x21, 0xe6, 0x2e, 0xe6, 0x51, 0x00, 0x28, 0x03, 0x11, 0x31, 0xea, 0x29, 0x11, 0xd4, 0x78, 0x38, 0x20, 0x15, 0x8d, 0xde, 0x06, 0x00, 0x8a, 0x0d, 0x01, 0x24, 0x07, 0x00,
+  0x92, 0x22, 0x10, 0x6c, 0x68, 0xf3, 0x20, 0xd0, 0x63, 0x0e, 0x3f, 0x00, 0xf2, 0x06, 0x11, 0x73, 0x06, 0x07, 0x00, 0x96, 0x03, 0x13, 0xaf, 0xd4, 0x1b, 0x00, 0x0e, 0x03, 0x02, 0x3e, 0x59, 0x02,
+  0x00, 0x07, 0x10, 0x4d, 0xde, 0xd7, 0x10, 0x42, 0x6a, 0xbb, 0x11, 0x8f, 0x68, 0x2d, 0x00, 0x8e, 0xc2, 0x00, 0x5a, 0x0a, 0x40, 0xcb, 0x42, 0x0c, 0x43, 0x22, 0x0e, 0x00, 0x70, 0x03, 0x00, 0x8a,
+  0x0a, 0x00, 0x00, 0xdf, 0xa0, 0x6d, 0x53, 0x0b, 0x4b, 0x0b, 0x4b, 0x0c, 0x4b, 0xef, 0x6b, 0xfa, 0x14, 0x40, 0xcb, 0x42, 0xab, 0x42, 0x14, 0x23, 0x20, 0x08, 0x2a, 0x7e, 0x11, 0x60, 0xcb, 0x42,
+  0x6e, 0x5b, 0xab, 0x42, 0x14, 0x23, 0x11, 0x4e, 0x42, 0x51, 0x00, 0x9a, 0x11, 0x00, 0x66, 0xe9, 0x00, 0x32, 0xd8, 0x20, 0xd4, 0x84, 0xbe, 0x31, 0x00, 0x1e, 0x71, 0x00, 0xe6, 0x11, 0x31, 0x0d,
+  0x4b, 0x8f, 0xe0, 0xde, 0xe0, 0xf0, 0x6b, 0xb4, 0x84, 0x36, 0x95, 0x35, 0x95, 0xd0, 0x63, 0xb3, 0x84, 0x4d, 0x5b, 0xe8, 0x62, 0x31, 0x10, 0x74, 0x4d, 0x34, 0x23, 0xe2, 0x0f, 0x74, 0xd2, 0x8c,
+  0x0f, 0x74, 0xad, 0x6b, 0xee, 0x73, 0xee, 0x73, 0x8d, 0x63, 0x1a, 0x0e, 0xa0, 0xce, 0x6b, 0xd2, 0x8c, 0x50, 0x7c, 0x0b, 0x53, 0x8d, 0x63, 0x08, 0x35, 0x00, 0x24, 0x00, 0x00, 0x2a, 0x43, 0xe0,
+  0xea, 0x52, 0x70, 0x84, 0x70, 0x84, 0x89, 0x42, 0x2f, 0x7c, 0xee, 0x7b, 0x8c, 0x6b, 0x48, 0x1c, 0x40, 0x2b, 0x63, 0x6b, 0x63, 0x86, 0x18, 0xf0, 0x33, 0x0e, 0x84, 0x8c, 0x6b, 0xc8, 0x52, 0x88,
+  0x4a, 0x6b, 0x6b, 0x2a, 0x63, 0x4b, 0x63, 0x4f, 0x8c, 0x53, 0xa5, 0x32, 0xa5, 0x8c, 0x6b, 0x0d, 0x84, 0xec, 0x7b, 0xe8, 0x5a, 0xec, 0x7b, 0x4e, 0x84, 0xab, 0x73, 0x29, 0x63, 0x4a, 0x6b, 0x4b,
+  0x6b, 0x8c, 0x73, 0xa8, 0x52, 0x2b, 0x63, 0x0a, 0x5b, 0xc9, 0x52, 0xa9, 0x52, 0xca, 0x5a, 0xa9, 0x52, 0xe7, 0x41, 0x2b, 0x63, 0x6c, 0x6b, 0x6d, 0x73, 0xae, 0x73, 0x48, 0x1c, 0x20, 0x50, 0x8c,
+  0x34, 0x0e, 0x00, 0xc2, 0x94, 0x02, 0xa6, 0x31, 0x02, 0x90, 0x78, 0x20, 0xcf, 0x7b, 0x92, 0x3f, 0x00, 0xfc, 0xc2, 0x02, 0x72, 0x0a, 0x02, 0x56, 0x23, 0x02, 0x52, 0x03, 0x00, 0x68, 0x03, 0x71,
+  0xb0, 0x73, 0x32, 0x84, 0xf1, 0x83, 0x31, 0x4a, 0x03, 0x00, 0x1e, 0x27, 0x00, 0x34, 0xca, 0x60, 0x6e, 0x6b, 0xaf, 0x73, 0xd4, 0x9c, 0x8e, 0x38, 0x02, 0xbe, 0x51, 0x00, 0x74, 0x2a, 0x04, 0xce,
+  0x18, 0x08, 0x54, 0x0e, 0x04, 0x44, 0x00, 0x02, 0x2e, 0x07, 0x22, 0x10, 0x84, 0xe4, 0x38, 0x00, 0x26, 0x47, 0x00, 0x24, 0x00, 0x60, 0xf4, 0x9c, 0x18, 0xc6, 0x39, 0xce, 0x2c, 0xae, 0x24, 0x72,
+  0x94, 0xdc, 0x1c, 0x02, 0x00, 0x19, 0x02, 0x34, 0x20, 0x12, 0x52, 0x2e, 0x6e, 0x05, 0x52, 0x15, 0x0f, 0x1c, 0x07, 0x11, 0x0a, 0x0c, 0x20, 0x0b, 0x62, 0x67, 0x03, 0xe4, 0x18, 0x06, 0x58, 0x15,
+  0x2f, 0xb0, 0xa4, 0x90, 0x03, 0x15, 0x05, 0xca, 0x18, 0x2d, 0xbd, 0x12, 0x34, 0x0e, 0x04, 0xa2, 0x03, 0x17, 0x52, 0x1c, 0x27, 0x17, 0x52, 0xaa, 0x0a, 0x04, 0x94, 0x5c, 0x21, 0x93, 0xc5, 0x50,
+  0x15, 0x03, 0x02, 0xf9, 0x13, 0x73, 0x44, 0x2e, 0x04, 0x5e, 0x15, 0x02, 0x70, 0x95, 0x06, 0xf0, 0x18, 0x08, 0x94, 0x03, 0x11, 0x36, 0xf4, 0xf1, 0x11, 0xd5, 0x72, 0x75, 0x02, 0xe0, 0x51, 0x00,
+  0xfc, 0x06, 0x13, 0x98, 0x3c, 0x2e, 0x11, 0x37, 0xc6, 0xdc, 0x20, 0x57, 0xd6, 0x22, 0x32, 0x00, 0x5c, 0x15, 0x02, 0xae, 0x0a, 0x00, 0x74, 0x47, 0x00, 0xb4, 0x03, 0x02, 0xee, 0x51, 0x40, 0xd9,
+  0xee, 0xb9, 0xe6, 0x52, 0x20, 0x02, 0x74, 0x1c, 0x40, 0x37, 0xd6, 0x1a, 0xef, 0x08, 0x00, 0x11, 0xd9, 0x92, 0x1c, 0x40, 0xf1, 0x63, 0x72, 0x74, 0x08, 0x7c, 0x00, 0x04, 0x00, 0x10, 0xf0, 0x06,
+  0xde, 0xa1, 0x4b, 0x8b, 0x32, 0xec, 0x42, 0x8e, 0x5b, 0x6e, 0x53, 0xaf, 0x8a, 0xde, 0x00, 0xea, 0x4c, 0x00, 0xb8, 0xf3, 0x22, 0xcf, 0x63, 0x70, 0xf3, 0x20, 0x52, 0x74, 0x24, 0x00, 0x00, 0xae,
+  0xb7, 0x20, 0x2e, 0x53, 0x0a, 0x03, 0x02, 0xd4, 0xfa, 0x11, 0x93, 0xa8, 0x18, 0x40, 0x35, 0x8d, 0x93, 0x7c, 0x16, 0xc6, 0x00, 0xa2, 0xd0, 0x20, 0xae, 0x5b, 0x90, 0x11, 0xf0, 0x01, 0x8e, 0x5b,
+  0xec, 0x4a, 0xcf, 0x63, 0x11, 0x6c, 0x8e, 0x5b, 0xaf, 0x5b, 0x8e, 0x5b, 0x4e, 0x53, 0x58, 0x00, 0xc0, 0xec, 0x42, 0xeb, 0x42, 0x49, 0x32, 0x48, 0x32, 0x8a, 0x3a, 0xaa, 0x42, 0x8c, 0x03, 0x51,
+  0xeb, 0x42, 0xec, 0x4a, 0xcb, 0x0a, 0x00, 0x60, 0xaa, 0x3a, 0x8a, 0x3a, 0xec, 0x4a, 0x32, 0x00, 0x20, 0xcf, 0x6b, 0x86, 0x03, 0x60, 0x10, 0x6c, 0xcf, 0x63, 0xf0, 0x6b, 0x82, 0x0e, 0x00, 0x04,
+  0x00, 0x00, 0xe2, 0x5b, 0x02, 0xd6, 0xe5, 0x01, 0xd2, 0x1f, 0x21, 0x74, 0x11, 0x96, 0x0e, 0x00, 0xd8, 0x90, 0x71, 0x0d, 0x4b, 0x0d, 0x53, 0xf0, 0x6b, 0xd0, 0xb6, 0x1c, 0x00, 0x1c, 0x4a, 0x20,
+  0x36, 0x95, 0x7e, 0xe2, 0x00, 0xce, 0xde, 0x80, 0x0c, 0x53, 0x10, 0x74, 0x6d, 0x5b, 0x6d, 0x63, 0x2c, 0x15, 0x41, 0x71, 0x84, 0x0f, 0x74, 0x0c, 0x43, 0x10, 0x74, 0x44, 0x23, 0x00, 0x6e, 0x31,
+  0xe0, 0x4c, 0x5b, 0xad, 0x6b, 0xa9, 0x42, 0xaa, 0x4a, 0x69, 0x42, 0x0b, 0x53, 0x30, 0x7c, 0xd8, 0x1f, 0x11, 0x6d, 0x34, 0x71, 0x40, 0x6c, 0x63, 0xb2, 0x8c, 0xec, 0x54, 0x00, 0xa2, 0x0a, 0xc0,
+  0x6b, 0x63, 0xc9, 0x52, 0x8b, 0x6b, 0x2e, 0x7c, 0xd4, 0xb5, 0x8f, 0x8c, 0x82, 0x0a, 0x20, 0x0a, 0x5b, 0x7a, 0x2a, 0x01, 0x92, 0x2a, 0x10, 0x63, 0x2e, 0x07, 0x20, 0x4b, 0x6b, 0x8e, 0x58, 0xa0,
+  0xf1, 0x9c, 0x52, 0xa5, 0x2e, 0x84, 0xcc, 0x73, 0x6e, 0x8c, 0xbe, 0x0a, 0x20, 0x09, 0x63, 0xca, 0x18, 0x20, 0xc9, 0x5a, 0xf4, 0x4d, 0xc0, 0x8c, 0x73, 0xce, 0x7b, 0x0a, 0x5b, 0xea, 0x5a, 0x68,
+  0x4a, 0xce, 0x7b, 0x32, 0x0e, 0x00, 0x12, 0x2e, 0x40, 0xce, 0x7b, 0xcf, 0x7b, 0x52, 0x6a, 0x22, 0xb2, 0x9c, 0xfe, 0x4d, 0x20, 0x31, 0x8c, 0x92, 0x03, 0x11, 0x31, 0x84, 0x5f, 0x02, 0x78, 0x11,
+  0x35, 0xd3, 0x9c, 0x31, 0x32, 0x0e, 0x04, 0xec, 0x3f, 0x02, 0x62, 0x03, 0x00, 0x5e, 0x15, 0x22, 0xf5, 0xa4, 0x60, 0x1c, 0x02, 0x68, 0x2a, 0x00, 0x54, 0x15, 0x01, 0x44, 0x43, 0x01, 0x24, 0x00,
+  0x04, 0x1e, 0x27, 0x02, 0xd0, 0x18, 0x02, 0x30, 0x0e, 0x13, 0x52, 0xbe, 0xbf, 0x02, 0x0e, 0xa3, 0x04, 0x46, 0x0e, 0x00, 0x4a, 0x00, 0x00, 0x76, 0x00, 0x10, 0x55, 0x14, 0xce, 0x30, 0xbd, 0xf4,
+  0xa4, 0x84, 0xca, 0x20, 0x2d, 0x63, 0xa4, 0x03, 0x08, 0xdc, 0x58, 0x06, 0x48, 0x15, 0x06, 0x06, 0x00, 0x1e, 0x52, 0x24, 0x07, 0x0f, 0x90, 0x03, 0x12, 0x1e, 0x72, 0x3e, 0x0e, 0x04, 0x62, 0x3c,
+  0x1c, 0xa4, 0x88, 0xc3, 0x01, 0x4e, 0xf5, 0x29, 0xb4, 0xd1, 0x36, 0x0e, 0x07, 0x90, 0x03, 0x03, 0x82, 0x83, 0x08, 0x9e, 0x0a, 0x0f, 0x02, 0x00, 0x05, 0x09, 0x92, 0x03, 0x21, 0xc5, 0x52, 0x52,
+  0x15, 0x31, 0xd4, 0xcd, 0x52, 0x64, 0x15, 0x11, 0x94, 0xf2, 0x18, 0x00, 0x06, 0x00, 0x00, 0x44, 0x0e, 0x02, 0x4e, 0xa7, 0x15, 0x73, 0x46, 0xc7, 0x04, 0xd4, 0xca, 0x0c, 0x84, 0x1c, 0x13, 0xf5,
+  0xec, 0x1f, 0x20, 0x90, 0xa4, 0x02, 0x07, 0x02, 0xee, 0xca, 0x00, 0x16, 0x00, 0x11, 0x78, 0x46, 0x4e, 0x02, 0x06, 0x39, 0x22, 0xb5, 0xc5, 0x86, 0x3c, 0x00, 0xbc, 0x0a, 0x02, 0x22, 0xb9, 0x00,
+  0xe0, 0xaa, 0x02, 0xe8, 0x38, 0x00, 0xac, 0xc0, 0x40, 0x1a, 0xef, 0x9c, 0xff, 0x0a, 0x00, 0x51, 0xb9, 0xe6, 0x5b, 0xf7, 0xb8, 0xd0, 0x11, 0x11, 0xb9, 0x62, 0x15, 0x11, 0x31, 0xee, 0xcc, 0x00,
+  0xe4, 0x14, 0x80, 0xf4, 0x84, 0xcf, 0x5b, 0xcf, 0x63, 0x8e, 0x5b, 0x6e, 0xd0, 0x50, 0x6a, 0x32, 0xab, 0x3a, 0x4d, 0xe4, 0xcc, 0x50, 0x6c, 0xaf, 0x63, 0xcb, 0x4a, 0xc6, 0x30, 0x00, 0x02, 0x15,
+  0x00, 0xfe, 0x06, 0x11, 0xb3, 0x2e, 0xfe, 0x00, 0x02, 0x00, 0x20, 0xb3, 0x7c, 0x94, 0x18, 0x00, 0x00, 0x1c, 0xe0, 0xec, 0x42, 0x29, 0x2a, 0x6a, 0x32, 0x2d, 0x4b, 0xaf, 0x5b, 0xec, 0x42, 0x10,
+  0x6c, 0x72, 0x03, 0x00, 0x6c, 0xe2, 0x20, 0x2c, 0x4b, 0x24, 0x07, 0x40, 0x31, 0x6c, 0x92, 0x7c, 0xb6, 0xd7, 0x20, 0xcb, 0x42, 0x54, 0x00, 0x00, 0x06, 0x00, 0x00, 0x94, 0x03, 0x00, 0x16, 0xe6,
+  0x00, 0x96, 0x0a, 0x00, 0xd2, 0xd0, 0x00, 0xf0, 0x18, 0x20, 0x49, 0x32, 0xd4, 0x3b, 0x40, 0xcf, 0x63, 0x31, 0x74, 0x82, 0x00, 0x00, 0x0c, 0x07, 0x00, 0x0a, 0x00, 0x60, 0x8f, 0x63, 0xec, 0x4a,
+  0xf0, 0x6b, 0x68, 0xe9, 0x00, 0x22, 0xe6, 0x02, 0xa4, 0xfe, 0x00, 0xba, 0x18, 0x11, 0x2d, 0xa0, 0x00, 0x00, 0x16, 0x04, 0x20, 0x8b, 0x3a, 0x18, 0x07, 0x20, 0x35, 0x95, 0x4a, 0x2a, 0x11, 0xd4,
+  0x46, 0xdb, 0x01, 0xe2, 0x2d, 0x10, 0x84, 0x9e, 0x03, 0x00, 0x6a, 0x2a, 0x00, 0xac, 0x38, 0x00, 0x5e, 0x1c, 0x01, 0x5c, 0x2a, 0x10, 0x6b, 0x7e, 0x66, 0x00, 0x1c, 0x07, 0xf0, 0x0f, 0x4c, 0x5b,
+  0xea, 0x52, 0xad, 0x63, 0x2f, 0x7c, 0xeb, 0x52, 0x6c, 0x5b, 0x8d, 0x63, 0x50, 0x7c, 0x2c, 0x5b, 0x27, 0x32, 0x89, 0x42, 0x65, 0x21, 0xae, 0x6b, 0x91, 0x8c, 0x8d, 0x63, 0x22, 0x07, 0xd1, 0xce,
+  0x73, 0x0a, 0x53, 0xca, 0x52, 0x06, 0x32, 0x68, 0x42, 0xa4, 0x31, 0xcc, 0x5e, 0x23, 0x00, 0xd6, 0x2d, 0x60, 0x2a, 0x63, 0xd1, 0x94, 0x4f, 0x8c, 0x8a, 0x58, 0xf3, 0x04, 0x4b, 0x63, 0x2f, 0x84,
+  0xcd, 0x7b, 0xad, 0x73, 0xc9, 0x5a, 0x8c, 0x6b, 0x2e, 0x84, 0x4f, 0x84, 0xc9, 0x5a, 0x4b, 0x30, 0x0e, 0x51, 0xed, 0x7b, 0x6b, 0x6b, 0xcd, 0xe0, 0x46, 0x11, 0xad, 0xce, 0x18, 0x00, 0xe8, 0x1f,
+  0x71, 0x4c, 0x63, 0xae, 0x73, 0x54, 0xad, 0x91, 0x3c, 0x98, 0x20, 0xae, 0x7b, 0x64, 0xfb, 0x40, 0x51, 0x8c, 0xef, 0x83, 0x04, 0x00, 0x00, 0xc8, 0x18, 0x31, 0xae, 0x7b, 0xef, 0xb0, 0x2d, 0x00,
+  0x16, 0x23, 0x00, 0x58, 0x1c, 0x00, 0x8a, 0x03, 0x00, 0x62, 0x1c, 0x11, 0x8f, 0x0a, 0x00, 0x05, 0x76, 0x9f, 0x05, 0x6a, 0xb8, 0x02, 0x7e, 0x03, 0x11, 0x11, 0xec, 0xdb, 0x02, 0x88, 0x43, 0x00,
+  0x18, 0x19, 0x02, 0x58, 0x35, 0x06, 0x04, 0x07, 0x20, 0xd0, 0x7b, 0x26, 0x00, 0x15, 0x31, 0x68, 0xff, 0x04, 0x00, 0xd5, 0x02, 0x36, 0x2e, 0x20, 0xb3, 0x94, 0xc4, 0x51, 0x40, 0x14, 0xa5, 0xd8,
+  0xbd, 0x36, 0x87, 0x20, 0xf4, 0xa4, 0xb8, 0x0e, 0x00, 0x96, 0x5c, 0x02, 0x26, 0x59, 0x13, 0x71, 0xde, 0x2a, 0x04, 0x6a, 0x1c, 0x04, 0x38, 0x0e, 0x13, 0x51, 0x60, 0x15, 0x0f, 0xd2, 0x11, 0x19,
+  0x0a, 0x90, 0x03, 0x17, 0x72, 0x98, 0x4a, 0x06, 0x1e, 0x07, 0x08, 0x1a, 0x07, 0x14, 0xf0, 0x4a, 0x35, 0x0d, 0x24, 0x4e, 0x04, 0xde, 0x1f, 0x04, 0x88, 0x03, 0x06, 0x90, 0x03, 0x02, 0x9c, 0x0a,
+  0x02, 0x9a, 0x03, 0x15, 0x52, 0xac, 0x0a, 0x04, 0x40, 0x0e, 0x17, 0x53, 0x06, 0xd9, 0x06, 0xc6, 0x31, 0x11, 0x53, 0x8c, 0x03, 0x26, 0x93, 0xc5, 0x8c, 0x7c, 0x04, 0x92, 0x9c, 0x04, 0x70, 0x1c,
+  0x17, 0xb4, 0x76, 0x75, 0x04, 0xe6, 0x71, 0x02, 0x10, 0x92, 0x13, 0xf1, 0xec, 0x58, 0x00, 0x2e, 0xc0, 0x02, 0x62, 0x1c, 0x13, 0xf6, 0x12, 0x99, 0x11, 0xf6, 0xce, 0xc3, 0x06, 0xea, 0x38, 0x00,
+  0xda, 0x71, 0x62, 0x4f, 0x94, 0xf5, 0xcd, 0x1a, 0xef, 0x54, 0x6e, 0x00, 0x8e, 0x95, 0x00, 0xb2, 0x9c, 0x00, 0xa2, 0x23, 0x00, 0x2a, 0xeb, 0x82, 0xdd, 0xff, 0x94, 0xbd, 0x4b, 0x73, 0xb5, 0xc5,
+  0x1c, 0x07, 0xf0, 0x0f, 0xd9, 0xe6, 0xfa, 0xee, 0xce, 0x63, 0xad, 0x63, 0xee, 0x63, 0xce, 0x63, 0x0b, 0x4b, 0x2c, 0x4b, 0x8d, 0x5b, 0xce, 0x63, 0x4c, 0x53, 0x8d, 0x5b, 0x4d, 0x53, 0x50, 0x74,
+  0x10, 0x6c, 0x02, 0x00, 0x90, 0x6d, 0x53, 0x10, 0x6c, 0xf4, 0x8c, 0x71, 0x74, 0x51, 0x46, 0x1f, 0x30, 0x74, 0x14, 0x8d, 0x5c, 0x0e, 0x40, 0xd3, 0x84, 0xf0, 0x6b, 0xaa, 0xd7, 0x00, 0x92, 0xc9,
+  0x20, 0xec, 0x42, 0xc4, 0x0d, 0x02, 0xfc, 0x06, 0x00, 0xb2, 0x11, 0x10, 0x4e, 0x8e, 0x34, 0x21, 0x63, 0x8e, 0x24, 0x07, 0x20, 0x2d, 0x4b, 0xb0, 0x1f, 0x80, 0x0d, 0x4b, 0x4a, 0x2a, 0x8b, 0x3a,
+  0x2d, 0x4b, 0x18, 0x0b, 0xf0, 0x05, 0xab, 0x3a, 0xcc, 0x3a, 0xec, 0x42, 0xcc, 0x3a, 0x09, 0x2a, 0xac, 0x3a, 0xcc, 0x3a, 0x6a, 0x32, 0x26, 0x09, 0xec, 0x42, 0xf4, 0x0a, 0x00, 0x4c, 0xf0, 0x02,
+  0xee, 0x0d, 0x00, 0x60, 0x1c, 0x00, 0x0c, 0x00, 0x00, 0x80, 0x0a, 0x00, 0xfc, 0xa5, 0x20, 0x55, 0x9d, 0xca, 0x18, 0x00, 0xda, 0x26, 0x02, 0x38, 0x0e, 0x00, 0x3e, 0x0b, 0x00, 0x76, 0x2a, 0x00,
+  0xe8, 0x18, 0x00, 0x78, 0x9b, 0x20, 0xf4, 0x8c, 0x2e, 0x00, 0xa0, 0x8e, 0x63, 0xc7, 0x29, 0x49, 0x3a, 0xab, 0x42, 0x8f, 0x63, 0xdc, 0x26, 0x60, 0xcf, 0x6b, 0x2d, 0x5b, 0x8e, 0x63, 0xc6, 0x1f,
+  0x00, 0xee, 0x1f, 0x00, 0xc4, 0x11, 0x11, 0x8d, 0xf6, 0x06, 0x20, 0xeb, 0x52, 0x44, 0x1c, 0xf0, 0x09, 0xaa, 0x4a, 0xea, 0x52, 0x4c, 0x5b, 0xeb, 0x52, 0xc6, 0x29, 0x89, 0x42, 0xca, 0x4a, 0x07,
+  0x32, 0xa9, 0x42, 0xea, 0x4a, 0x8d, 0x5b, 0x2f, 0x74, 0x3e, 0x0b, 0x20, 0x2c, 0x5b, 0x38, 0x07, 0x00, 0x46, 0x15, 0xe0, 0xca, 0x52, 0x4b, 0x63, 0x2e, 0x7c, 0x6f, 0x84, 0xcd, 0x73, 0xb0, 0x94,
+  0xd0, 0x94, 0xcc, 0x26, 0x40, 0x4b, 0x63, 0xd1, 0x9c, 0x08, 0x00, 0x60, 0x48, 0x4a, 0xce, 0x7b, 0x8c, 0x6b, 0x44, 0x4a, 0x00, 0x7e, 0x0a, 0x80, 0xb1, 0x94, 0x2e, 0x84, 0x2a, 0x63, 0x67, 0x4a,
+  0x62, 0x43, 0x10, 0xac, 0x68, 0x0e, 0x50, 0x63, 0xc9, 0x52, 0x8d, 0x73, 0x10, 0x07, 0x60, 0x0b, 0x63, 0xea, 0x5a, 0x27, 0x42, 0x54, 0x43, 0x31, 0xce, 0x7b, 0xae, 0xb8, 0x5f, 0x00, 0x8a, 0x51,
+  0x20, 0xae, 0x73, 0x72, 0x23, 0x20, 0xeb, 0x62, 0xbe, 0x5f, 0x22, 0x2c, 0x6b, 0x1e, 0x07, 0x00, 0xfc, 0x26, 0x01, 0x18, 0x07, 0x01, 0x7a, 0x3f, 0x11, 0x51, 0x06, 0x0e, 0x13, 0x92, 0x24, 0xaa,
+  0x13, 0x31, 0x38, 0x1c, 0x13, 0x10, 0x5a, 0x15, 0x04, 0x08, 0x00, 0x00, 0xa0, 0x03, 0x13, 0xd0, 0x98, 0x4a, 0x01, 0x90, 0x58, 0x03, 0x3c, 0x15, 0x02, 0xde, 0x1f, 0x02, 0x64, 0x35, 0x23, 0xb4,
+  0x9c, 0xb4, 0x58, 0x03, 0x44, 0x00, 0x02, 0x54, 0x3c, 0x00, 0x74, 0x0e, 0x24, 0xf4, 0xa4, 0x9e, 0x1f, 0x00, 0xf6, 0x58, 0x02, 0xe4, 0x1f, 0x02, 0x42, 0x67, 0x08, 0x44, 0x35, 0x26, 0x31, 0x8c,
+  0x96, 0x2a, 0x0e, 0xf6, 0x1f, 0x0f, 0xc8, 0x11, 0x15, 0x16, 0x72, 0x02, 0x72, 0x29, 0x9c, 0x72, 0xd8, 0x38, 0x02, 0xc6, 0x11, 0x0c, 0xf2, 0x3f, 0x0e, 0x64, 0x3c, 0x28, 0x32, 0xbd, 0x6a, 0x43,
+  0x04, 0x84, 0x2a, 0x04, 0xba, 0x11, 0x15, 0x12, 0x30, 0x0e, 0x02, 0x90, 0x03, 0x15, 0x11, 0x34, 0x4e, 0x22, 0x93, 0xc5, 0xe8, 0x38, 0x02, 0xe2, 0x18, 0x08, 0xf6, 0x58, 0x08, 0x2c, 0x0e, 0x08,
+  0x24, 0xe0, 0x00, 0xec, 0x18, 0x00, 0x60, 0x0e, 0x04, 0x1e, 0xa0, 0x06, 0x8e, 0x03, 0x04, 0x92, 0x23, 0x02, 0x3e, 0x87, 0x04, 0xba, 0x43, 0x02, 0x06, 0x00, 0x00, 0x28, 0x6e, 0x02, 0xc6, 0x51,
+  0x11, 0xd5, 0xc2, 0x4a, 0x20, 0xd1, 0xac, 0x64, 0x8e, 0x02, 0x2e, 0x80, 0x42, 0xac, 0x83, 0x77, 0xde, 0x22, 0x07, 0xa0, 0x4f, 0x94, 0x74, 0xbd, 0xd1, 0xa4, 0x94, 0xbd, 0xd9, 0xe6, 0xb4, 0x1c,
+  0x00, 0x98, 0x4e, 0x00, 0xbe, 0x11, 0x20, 0xd1, 0xa4, 0x08, 0x00, 0x02, 0x02, 0x00, 0x11, 0x98, 0xf0, 0x4a, 0xa0, 0x6c, 0x5b, 0x2b, 0x53, 0x2b, 0x53, 0x8d, 0x5b, 0x4c, 0x53, 0x8a, 0x03, 0x20,
+  0x2b, 0x4b, 0x06, 0x00, 0x30, 0x30, 0x74, 0xcf, 0x6c, 0x14, 0x10, 0x63, 0x28, 0x2d, 0x20, 0x51, 0x74, 0xe8, 0x06, 0x11, 0xcf, 0x0a, 0x46, 0x00, 0xb0, 0xde, 0x00, 0x7c, 0x34, 0x00, 0x52, 0x18,
+  0x00, 0xac, 0x11, 0x00, 0x3c, 0x11, 0x00, 0x2e, 0x0e, 0x00, 0x62, 0xdb, 0x20, 0x4e, 0x53, 0x1e, 0x0e, 0x00, 0x5a, 0x0e, 0x02, 0x9e, 0xfe, 0x00, 0x52, 0x46, 0x20, 0xd0, 0x63, 0x3c, 0x07, 0x22,
+  0x52, 0x74, 0x48, 0x31, 0x10, 0x6e, 0x1a, 0x87, 0x21, 0x53, 0x31, 0x8a, 0x1c, 0x02, 0xe8, 0xb7, 0x40, 0x16, 0x8d, 0x15, 0x85, 0xe2, 0x03, 0x11, 0xf4, 0x80, 0x0a, 0x00, 0x4e, 0x00, 0x00, 0xd6,
+  0x15, 0x01, 0x80, 0x23, 0x10, 0x63, 0x3e, 0x8d, 0x00, 0x00, 0x3c, 0x20, 0x4e, 0x5b, 0x2c, 0x20, 0x02, 0x88, 0x46, 0x00, 0x84, 0x1c, 0x00, 0x14, 0x20, 0x20, 0xd4, 0x84, 0x86, 0x31, 0x00, 0xc6,
+  0x5b, 0x00, 0x9e, 0x4d, 0xa0, 0x8e, 0x63, 0xae, 0x63, 0xb3, 0x84, 0x35, 0x9d, 0x35, 0x9d, 0xe0, 0xe5, 0x00, 0x0e, 0x43, 0xa0, 0xf3, 0x8c, 0x91, 0x84, 0x6c, 0x5b, 0xa9, 0x42, 0x4c, 0x5b, 0xca,
+  0x18, 0x00, 0x46, 0x1c, 0x60, 0xca, 0x4a, 0x0b, 0x53, 0xaa, 0x4a, 0x70, 0x03, 0x40, 0x07, 0x3a, 0xef, 0x73, 0x2c, 0x07, 0x20, 0xcf, 0x73, 0x82, 0x5f, 0xb1, 0xf3, 0x94, 0xb5, 0xa5, 0x13, 0x95,
+  0x70, 0x7c, 0xae, 0x63, 0x6c, 0x1c, 0x20, 0x00, 0xae, 0x03, 0x20, 0xca, 0x52, 0xb8, 0x46, 0x51, 0xed, 0x73, 0xa8, 0x4a, 0x2a, 0x6a, 0x23, 0x00, 0xd0, 0x1f, 0x00, 0x80, 0x58, 0x00, 0x9c, 0x11,
+  0x60, 0xc9, 0x5a, 0x4c, 0x6b, 0xb1, 0x94, 0x54, 0x71, 0x00, 0x7c, 0x0a, 0x60, 0x8d, 0x73, 0x2b, 0x63, 0x46, 0x42, 0xf6, 0x18, 0x20, 0xe9, 0x5a, 0x60, 0x0e, 0x00, 0x2e, 0x0e, 0xf1, 0x00, 0x6c,
+  0x6b, 0x4c, 0x63, 0x2c, 0x63, 0x69, 0x4a, 0xaa, 0x52, 0x07, 0x3a, 0x30, 0x84, 0xb2, 0x6e, 0x66, 0x00, 0xb2, 0x8d, 0x31, 0xae, 0x7b, 0x8e, 0xac, 0x6d, 0x60, 0xcf, 0x7b, 0xae, 0x7b, 0x92, 0x94,
+  0xae, 0x6d, 0x11, 0x30, 0x26, 0x07, 0x00, 0xd6, 0x18, 0x02, 0xbe, 0x6d, 0x00, 0x86, 0x03, 0x02, 0xc4, 0x46, 0x04, 0x7a, 0x4a, 0x13, 0xcf, 0xd6, 0x1f, 0x04, 0xc6, 0x18, 0x13, 0x10, 0xce, 0x1f,
+  0x02, 0x7c, 0x0a, 0x11, 0x92, 0x6e, 0x2a, 0x40, 0x4d, 0x6b, 0xf0, 0x7b, 0x50, 0x07, 0x00, 0x38, 0x5c, 0x02, 0x68, 0x4a, 0x20, 0x52, 0x8c, 0xae, 0x18, 0x91, 0xf5, 0xa4, 0x93, 0x94, 0xf1, 0x83,
+  0x8f, 0x73, 0x93, 0x70, 0x31, 0x02, 0x2c, 0x3c, 0x20, 0xd4, 0x9c, 0xa8, 0x11, 0x40, 0x4e, 0x6b, 0x0d, 0x63, 0xa6, 0x51, 0x00, 0xac, 0x0a, 0x02, 0xb6, 0x06, 0x04, 0x00, 0x87, 0x04, 0xfc, 0x7f,
+  0x04, 0xa2, 0x0a, 0x1e, 0x71, 0x60, 0x1c, 0x0f, 0xc4, 0x11, 0x12, 0x0e, 0xc8, 0x11, 0x03, 0x50, 0x80, 0x05, 0x16, 0x07, 0x09, 0x48, 0xf5, 0x0f, 0x0c, 0x67, 0x06, 0x08, 0xc0, 0x11, 0x15, 0x11,
+  0x34, 0x0e, 0x07, 0x3a, 0x15, 0x15, 0xb5, 0x8a, 0x03, 0x05, 0x58, 0x15, 0x11, 0x53, 0xa2, 0x03, 0x00, 0x1a, 0xce, 0x35, 0xf1, 0xb4, 0x73, 0xea, 0x1f, 0x04, 0x78, 0x1c, 0x02, 0xa8, 0x2a, 0x04,
+  0xaa, 0x2a, 0x06, 0xbc, 0x11, 0x44, 0xf1, 0xac, 0x73, 0xbd, 0x36, 0x0e, 0x04, 0xbe, 0xa3, 0x15, 0xb4, 0x08, 0x20, 0x04, 0x92, 0x3c, 0x02, 0x2a, 0x27, 0x22, 0x12, 0xb5, 0x06, 0x40, 0x13, 0xf5,
+  0xc6, 0x31, 0x03, 0x60, 0x1c, 0x14, 0xce, 0x80, 0x1c, 0x00, 0xa6, 0x6a, 0xa0, 0x53, 0xb5, 0xd5, 0xc5, 0x98, 0xde, 0xd5, 0xcd, 0xb8, 0xe6, 0xc4, 0x6a, 0x11, 0x37, 0xa0, 0x03, 0xc0, 0xb8, 0xe6,
+  0x3b, 0xf7, 0x1a, 0xef, 0x16, 0xce, 0x12, 0xad, 0x90, 0x9c, 0x56, 0x15, 0x11, 0xb9, 0xde, 0x31, 0x33, 0x7c, 0xff, 0x78, 0x0e, 0x20, 0x20, 0xb8, 0xe6, 0x36, 0x07, 0x00, 0x8a, 0x02, 0x22, 0x2c,
+  0x53, 0x02, 0x00, 0x40, 0xca, 0x42, 0xeb, 0x4a, 0x5a, 0x11, 0x51, 0xcb, 0x42, 0x2d, 0x53, 0x6d, 0x8e, 0x18, 0x00, 0x7c, 0x03, 0x12, 0x8f, 0xe0, 0x14, 0x30, 0x42, 0x0c, 0x4b, 0x68, 0x0a, 0x00,
+  0x0c, 0x07, 0x00, 0x2c, 0x94, 0x20, 0xf0, 0x63, 0x6a, 0x15, 0x00, 0x4a, 0x0a, 0x02, 0xc4, 0x11, 0x20, 0xf0, 0x63, 0x40, 0x0a, 0x60, 0x4e, 0x53, 0x4a, 0x32, 0x0c, 0x4b, 0xa6, 0x06, 0x00, 0x4e,
+  0x94, 0x40, 0x4a, 0x32, 0x6e, 0x53, 0xfa, 0x69, 0x20, 0xcc, 0x42, 0xbc, 0x26, 0x00, 0xae, 0x3f, 0x10, 0xd0, 0x72, 0xd4, 0x20, 0x74, 0x93, 0x76, 0x03, 0x01, 0xc6, 0x66, 0x00, 0x76, 0x38, 0x80,
+  0x72, 0x74, 0xd4, 0x84, 0xec, 0x4a, 0x0d, 0x4b, 0xb0, 0x1c, 0x00, 0x80, 0x31, 0x00, 0xda, 0x34, 0x22, 0xf0, 0x6b, 0x16, 0x07, 0x20, 0x8e, 0x63, 0xd0, 0x90, 0x33, 0xf0, 0x6b, 0x72, 0x8c, 0xa2,
+  0x60, 0x8f, 0x63, 0x10, 0x74, 0x52, 0x7c, 0xc8, 0x0a, 0x42, 0x4e, 0x5b, 0xf0, 0x6b, 0xda, 0x89, 0x60, 0x93, 0x84, 0x96, 0xa5, 0x14, 0x95, 0x56, 0xe2, 0x00, 0x92, 0x0a, 0x00, 0x6a, 0x23, 0x00,
+  0xee, 0x1f, 0x60, 0x2b, 0x53, 0xad, 0x63, 0x0b, 0x53, 0x6c, 0x04, 0x80, 0x0b, 0x53, 0xea, 0x4a, 0xce, 0x6b, 0xca, 0x4a, 0x18, 0x00, 0xe1, 0x0b, 0x5b, 0xee, 0x73, 0xf3, 0x94, 0xee, 0x73, 0x0f,
+  0x7c, 0x50, 0x7c, 0x0f, 0x74, 0xa2, 0x66, 0x30, 0x4a, 0x2b, 0x53, 0xae, 0x03, 0xb1, 0x2b, 0x5b, 0x89, 0x42, 0xce, 0x6b, 0x0f, 0x7c, 0xea, 0x52, 0xad, 0x44, 0x43, 0xb1, 0x8b, 0x6b, 0xed, 0x73,
+  0x2e, 0x84, 0x6b, 0x6b, 0x46, 0x42, 0x8b, 0x88, 0x2a, 0x00, 0xe2, 0x26, 0x60, 0x0a, 0x5b, 0x2f, 0x84, 0x8c, 0x73, 0xda, 0x4d, 0x31, 0x2f, 0x84, 0x2b, 0xd2, 0x38, 0x20, 0xee, 0x7b, 0xe4, 0x1f,
+  0x20, 0x6c, 0x6b, 0xd2, 0x18, 0xe0, 0x0a, 0x5b, 0xa9, 0x52, 0x68, 0x4a, 0x89, 0x4a, 0xca, 0x52, 0xca, 0x5a, 0xef, 0x7b, 0xb8, 0x86, 0x20, 0xd3, 0x9c, 0xc8, 0x54, 0x00, 0x0a, 0x0a, 0x00, 0x0c,
+  0x55, 0x20, 0x51, 0x8c, 0x9e, 0x31, 0x00, 0x22, 0x43, 0x51, 0x6d, 0x6b, 0xef, 0x83, 0xb3, 0x1e, 0x8a, 0x13, 0x51, 0x1c, 0x0a, 0x00, 0x90, 0x1f, 0x22, 0xaf, 0x7b, 0x14, 0x63, 0x15, 0xd0, 0x1e,
+  0x15, 0x11, 0x10, 0x86, 0x03, 0x02, 0x06, 0xa3, 0x11, 0x10, 0x0a, 0x00, 0x02, 0xd8, 0x66, 0x11, 0xf0, 0xd0, 0x7f, 0x02, 0x98, 0x9f, 0x02, 0x12, 0x27, 0x40, 0xd4, 0x9c, 0x35, 0xa5, 0xe0, 0x31,
+  0x80, 0x4e, 0x6b, 0x6e, 0x73, 0xd0, 0x7b, 0xf1, 0x83, 0x60, 0x1c, 0x20, 0xf1, 0x83, 0xce, 0x23, 0x11, 0xaf, 0x36, 0x07, 0x02, 0xda, 0x38, 0x11, 0xaf, 0x74, 0x3c, 0x11, 0x72, 0x94, 0x43, 0x04,
+  0x24, 0x4e, 0x14, 0x10, 0x14, 0x07, 0x03, 0xd6, 0x18, 0x02, 0x24, 0x2e, 0x03, 0x0e, 0x00, 0x09, 0x20, 0x07, 0x0f, 0x22, 0x07, 0x03, 0x1b, 0x52, 0x44, 0x4e, 0x0c, 0x96, 0x03, 0x02, 0x8a, 0x03,
+  0x06, 0x32, 0x2e, 0x13, 0x71, 0x50, 0x75, 0x05, 0x36, 0x0e, 0x09, 0x38, 0x2e, 0x0e, 0x58, 0x5c, 0x04, 0xf0, 0x5f, 0x1e, 0x11, 0xf0, 0x1f, 0x07, 0x86, 0x03, 0x05, 0xb2, 0x0a, 0x01, 0x72, 0x3c,
+  0x01, 0xa2, 0x63, 0x03, 0x20, 0x07, 0x0a, 0x16, 0x07, 0x13, 0x73, 0xc6, 0x31, 0x06, 0xbe, 0x11, 0x02, 0x26, 0xe7, 0x08, 0xca, 0x11, 0x04, 0x7c, 0x1c, 0x15, 0xd5, 0xd8, 0xc3, 0x06, 0xce, 0x11,
+  0x13, 0x16, 0xee, 0xc3, 0x00, 0x60, 0x35, 0x00, 0xa2, 0x11, 0x02, 0x84, 0x03, 0x04, 0xaa, 0x2a, 0x02, 0x70, 0xae, 0x01, 0x30, 0x0e, 0x12, 0xce, 0xb2, 0x0a, 0x20, 0x94, 0xbd, 0xa4, 0x55, 0x22,
+  0xf9, 0xee, 0x70, 0x87, 0x20, 0x94, 0xbd, 0x9c, 0x03, 0x00, 0xc4, 0x5c, 0x60, 0xd9, 0xe6, 0x77, 0xde, 0x5b, 0xf7, 0x3a, 0x20, 0x00, 0x88, 0x75, 0x20, 0xb9, 0xe6, 0x34, 0x27, 0x02, 0x7e, 0x35,
+  0x40, 0x2c, 0x53, 0x4d, 0x53, 0x28, 0x26, 0x31, 0x0b, 0x4b, 0x4c, 0x06, 0x07, 0x40, 0x71, 0x7c, 0x30, 0x6c, 0xa0, 0x0a, 0x42, 0xcf, 0x63, 0x6e, 0x5b, 0x10, 0x07, 0x01, 0x16, 0x15, 0x10, 0x4a,
+  0xfa, 0x37, 0x00, 0x04, 0x07, 0x11, 0x8e, 0x94, 0x1c, 0x00, 0x1e, 0x2a, 0x00, 0x7c, 0x18, 0x10, 0x6e, 0x9e, 0x1c, 0x10, 0x4a, 0xec, 0x1b, 0x41, 0xab, 0x42, 0x6a, 0x32, 0xce, 0xd7, 0x23, 0x7c,
+  0x52, 0xb6, 0x1f, 0x02, 0x78, 0x1c, 0x81, 0x2d, 0x4b, 0xed, 0x42, 0x93, 0x7c, 0xf5, 0x84, 0x74, 0x38, 0x01, 0x7e, 0x2a, 0x00, 0xa8, 0x6e, 0x00, 0x3c, 0x12, 0x00, 0x34, 0x78, 0x00, 0x10, 0x19,
+  0x00, 0xc4, 0x03, 0x12, 0xec, 0xbe, 0x18, 0x01, 0x0a, 0x3c, 0x00, 0x0e, 0x0e, 0x20, 0x56, 0x9d, 0xdc, 0xc5, 0x00, 0x90, 0x00, 0x61, 0x0d, 0x53, 0x0c, 0x53, 0xf0, 0x6b, 0xa4, 0xb0, 0x10, 0x63,
+  0xcc, 0xe5, 0x01, 0x02, 0x9f, 0xb0, 0x7c, 0xf0, 0x73, 0x72, 0x7c, 0xd3, 0x8c, 0xb3, 0x8c, 0x52, 0x7c, 0x38, 0x0e, 0x40, 0x11, 0x74, 0x8e, 0x63, 0x22, 0x00, 0xf0, 0x03, 0xb2, 0x8c, 0x70, 0x84,
+  0x13, 0x95, 0x91, 0x84, 0xad, 0x6b, 0x8c, 0x63, 0x2b, 0x53, 0xea, 0x4a, 0x2b, 0x53, 0x06, 0x00, 0x40, 0xca, 0x4a, 0x85, 0x21, 0x9e, 0x0a, 0x40, 0x91, 0x84, 0x74, 0xa5, 0x5e, 0x15, 0x00, 0xac,
+  0x2a, 0x10, 0x6c, 0xa4, 0x38, 0x30, 0x52, 0x30, 0x7c, 0x6c, 0x15, 0x11, 0xce, 0x2a, 0x6a, 0x01, 0xfc, 0x26, 0xf0, 0x12, 0x63, 0xad, 0x6b, 0xc9, 0x4a, 0xcd, 0x73, 0xac, 0x6b, 0x0d, 0x7c, 0x6b,
+  0x63, 0x09, 0x5b, 0x87, 0x4a, 0xc8, 0x52, 0xcc, 0x73, 0x6b, 0x6b, 0x8c, 0x6b, 0xed, 0x7b, 0x4f, 0x84, 0xd1, 0x94, 0x0e, 0x7c, 0x1a, 0x0e, 0x00, 0x18, 0x0e, 0x00, 0xc8, 0x66, 0x40, 0xcd, 0x7b,
+  0x12, 0x9d, 0x90, 0x51, 0x00, 0xe8, 0x1f, 0xe0, 0x2b, 0x63, 0xca, 0x5a, 0x48, 0x42, 0xaa, 0x52, 0xeb, 0x5a, 0x6c, 0x6b, 0xae, 0x73, 0x80, 0x03, 0x91, 0xb2, 0x94, 0x71, 0x8c, 0xae, 0x73, 0x92,
+  0x94, 0x30, 0xfc, 0x06, 0x22, 0x71, 0x8c, 0x06, 0x07, 0x00, 0x2c, 0x07, 0x02, 0xb8, 0x5f, 0x02, 0x04, 0x27, 0x02, 0xc2, 0x46, 0x00, 0x74, 0x18, 0x00, 0xba, 0x03, 0x00, 0xf2, 0x0d, 0x40, 0x8e,
+  0x73, 0x52, 0x8c, 0xee, 0x18, 0x00, 0x68, 0x03, 0x04, 0xb6, 0x3f, 0x04, 0xac, 0x23, 0x11, 0xaf, 0xf0, 0x1f, 0x02, 0xf2, 0x4d, 0x33, 0xf4, 0x9c, 0x72, 0x70, 0xd8, 0x00, 0x2a, 0x3c, 0x00, 0x34,
+  0x3c, 0x01, 0x2c, 0x0e, 0x01, 0x8c, 0x0a, 0x00, 0x1a, 0x55, 0x40, 0xd4, 0x9c, 0x93, 0x9c, 0x7e, 0x23, 0x02, 0x46, 0x3c, 0x12, 0x52, 0x20, 0x4e, 0x03, 0x0c, 0x07, 0x15, 0x31, 0x98, 0x0a, 0x15,
+  0x31, 0x08, 0x07, 0x06, 0xac, 0x0a, 0x04, 0xb2, 0x0a, 0x01, 0x30, 0x0e, 0x0f, 0xa2, 0x0a, 0x18, 0x0e, 0xb2, 0x03, 0x03, 0xba, 0x11, 0x01, 0x9c, 0xca, 0x16, 0x71, 0x8e, 0x03, 0x09, 0x1c, 0x07,
+  0x1c, 0xb0, 0x54, 0x9c, 0x0d, 0x64, 0x3c, 0x17, 0x32, 0xc4, 0x11, 0x04, 0x38, 0x0e, 0x07, 0x5c, 0x15, 0x17, 0xb5, 0x8c, 0x03, 0x03, 0xbe, 0x31, 0x1b, 0x52, 0x96, 0x63, 0x22, 0x73, 0xc5, 0xc6,
+  0x8a, 0x01, 0x06, 0x40, 0x05, 0x30, 0x0e, 0x02, 0x86, 0x03, 0x00, 0xbe, 0x03, 0x04, 0x88, 0x03, 0x04, 0x98, 0x23, 0x02, 0x04, 0x00, 0x13, 0xf5, 0xb0, 0x83, 0x00, 0x4e, 0x15, 0x13, 0xf5, 0xa0,
+  0x0a, 0x00, 0x38, 0x67, 0x00, 0x74, 0x5c, 0x08, 0x20, 0x80, 0x00, 0x30, 0x35, 0x01, 0xb4, 0x0a, 0x21, 0xde, 0xf5, 0x40, 0x4e, 0x02, 0x28, 0x40, 0x12, 0xf5, 0x70, 0x8e, 0x01, 0x40, 0xf9, 0x31,
+  0xd1, 0xa4, 0xb4, 0x02, 0xdd, 0x00, 0x48, 0x0e, 0x00, 0x6c, 0x27, 0x20, 0xf9, 0xee, 0x4e, 0x0e, 0x80, 0x0a, 0x6b, 0x90, 0x9c, 0x16, 0xce, 0x94, 0xbd, 0x56, 0x0e, 0x01, 0x2c, 0x27, 0x00, 0x20,
+  0x20, 0x70, 0xef, 0x6d, 0x53, 0x6d, 0x53, 0xcf, 0x63, 0xae, 0x26, 0x40, 0xb2, 0x7c, 0x92, 0x7c, 0xd2, 0x14, 0x00, 0xaa, 0x1f, 0x60, 0x6e, 0x5b, 0x8e, 0x5b, 0x0c, 0x4b, 0x52, 0x18, 0x00, 0x64,
+  0x03, 0x02, 0xac, 0x26, 0x20, 0x8f, 0x5b, 0x22, 0x0e, 0x02, 0x68, 0x18, 0x80, 0xf4, 0x84, 0xb3, 0x7c, 0x11, 0x6c, 0x0d, 0x4b, 0x16, 0x86, 0x00, 0xee, 0x50, 0x00, 0x22, 0x00, 0x80, 0x15, 0x8d,
+  0x15, 0x8d, 0xf4, 0x84, 0x93, 0x7c, 0x2e, 0x07, 0x02, 0x82, 0x31, 0x11, 0xd0, 0x24, 0x4e, 0x20, 0x52, 0x6c, 0x10, 0x15, 0x00, 0xea, 0x2a, 0x00, 0x6a, 0x0e, 0x00, 0x76, 0x2e, 0x30, 0x8b, 0x3a,
+  0xab, 0xfc, 0xd0, 0x01, 0x82, 0xfb, 0x20, 0xcc, 0x42, 0x98, 0x4d, 0x31, 0x92, 0x7c, 0x15, 0x52, 0x3c, 0x00, 0x02, 0x35, 0x20, 0x14, 0x8d, 0x30, 0x1c, 0x00, 0xf4, 0x0a, 0x20, 0x4d, 0x53, 0xc2,
+  0x2a, 0x00, 0xfa, 0x06, 0x60, 0xec, 0x52, 0x49, 0x3a, 0xae, 0x6b, 0x54, 0x8d, 0x50, 0x30, 0x7c, 0x92, 0x84, 0xef, 0x98, 0xa9, 0x10, 0x74, 0x92, 0x74, 0x00, 0xa8, 0xa9, 0xf0, 0x0f, 0x8f, 0x63,
+  0xec, 0x52, 0xcf, 0x6b, 0x34, 0x9d, 0xb2, 0x8c, 0x2f, 0x7c, 0x8c, 0x63, 0x0a, 0x53, 0x2b, 0x5b, 0xc9, 0x4a, 0xa9, 0x42, 0x2b, 0x53, 0x89, 0x42, 0x69, 0x42, 0x68, 0x3a, 0x72, 0x2a, 0xf1, 0x0c,
+  0x70, 0x7c, 0xd2, 0x8c, 0x70, 0x84, 0x71, 0x84, 0x4c, 0x63, 0xea, 0x52, 0xc9, 0x4a, 0xa9, 0x4a, 0xee, 0x73, 0xd1, 0x94, 0xb1, 0x8c, 0x2f, 0x7c, 0xce, 0x73, 0x8c, 0xac, 0x38, 0x20, 0x2b, 0x5b,
+  0x4a, 0x15, 0xa0, 0x0f, 0x7c, 0x8c, 0x6b, 0xd1, 0x94, 0xcd, 0x73, 0x2e, 0x7c, 0x0e, 0x2e, 0xc0, 0xac, 0x73, 0x09, 0x5b, 0x6b, 0x6b, 0xd0, 0x94, 0xac, 0x73, 0x88, 0x4a, 0x16, 0x0e, 0x80, 0xee,
+  0x7b, 0x74, 0xad, 0x4b, 0x6b, 0x91, 0x94, 0x58, 0x23, 0x00, 0xd0, 0x1f, 0x11, 0x8c, 0x14, 0x07, 0x00, 0x60, 0x15, 0x11, 0xca, 0x8e, 0x03, 0x00, 0x5a, 0x1c, 0x40, 0x0b, 0x63, 0x30, 0x84, 0x02,
+  0x00, 0x00, 0xf4, 0x06, 0x02, 0xc2, 0x18, 0x03, 0xea, 0x5b, 0x01, 0x3e, 0x3c, 0x11, 0x8e, 0x58, 0x43, 0x02, 0x82, 0x03, 0x02, 0x92, 0x46, 0x13, 0x92, 0x44, 0x8a, 0x11, 0x10, 0x26, 0x6a, 0x00,
+  0x18, 0x43, 0x01, 0xca, 0x31, 0x01, 0x9a, 0x2a, 0x11, 0xaf, 0x7e, 0x71, 0x02, 0x94, 0x5f, 0x11, 0x31, 0x56, 0x3c, 0x02, 0x5a, 0x0e, 0x02, 0xec, 0x26, 0x20, 0xd4, 0x9c, 0x32, 0x07, 0x00, 0xfa,
+  0x0d, 0x00, 0x0e, 0x67, 0x12, 0x92, 0x86, 0xad, 0x21, 0x94, 0x72, 0x90, 0x1c, 0x21, 0xf0, 0x83, 0xda, 0x1f, 0x21, 0x83, 0x8f, 0x4e, 0x0e, 0x04, 0x92, 0xd1, 0x00, 0x2a, 0x2e, 0x04, 0xd2, 0x3f,
+  0x02, 0xfc, 0x26, 0x00, 0x80, 0x75, 0x19, 0x51, 0x74, 0x43, 0x04, 0x28, 0x07, 0x01, 0x20, 0x07, 0x02, 0x24, 0x07, 0x09, 0x20, 0x07, 0x0f, 0x46, 0x0e, 0x0f, 0x2e, 0x92, 0x9c, 0x18, 0x40, 0x00,
+  0x46, 0x15, 0x04, 0xae, 0x0a, 0x09, 0xaa, 0x0a, 0x09, 0x0e, 0x67, 0x06, 0x18, 0x8e, 0x0a, 0x8e, 0x03, 0x08, 0x7a, 0x03, 0x06, 0x96, 0x2a, 0x08, 0x16, 0x00, 0x27, 0x32, 0xbd, 0xa6, 0x23, 0x02,
+  0x8c, 0x03, 0x03, 0xc2, 0x31, 0x13, 0x32, 0x64, 0xfc, 0x02, 0x1e, 0x07, 0x01, 0x84, 0x9c, 0x00, 0x08, 0x20, 0x01, 0x2a, 0xe7, 0x0a, 0x84, 0x23, 0x0c, 0xe0, 0x18, 0x08, 0xd0, 0x11, 0x02, 0x7a,
+  0x3c, 0x11, 0xf5, 0x50, 0x27, 0x02, 0x3a, 0xa7, 0x04, 0x5e, 0xce, 0x02, 0x5a, 0x2e, 0x04, 0xa8, 0x83, 0x02, 0xfa, 0x58, 0x00, 0xc0, 0x2a, 0x00, 0x1e, 0x07, 0x00, 0x02, 0x07, 0x00, 0x16, 0x00,
+  0x10, 0xb4, 0x68, 0x15, 0x01, 0xfc, 0x78, 0x00, 0x9a, 0x7c, 0x20, 0x1a, 0xef, 0xbc, 0x4e, 0x11, 0xb9, 0x68, 0x15, 0x42, 0x12, 0xb5, 0x3b, 0xf7, 0x7c, 0x1c, 0x02, 0xec, 0x11, 0x11, 0x98, 0xa6,
+  0x1c, 0x40, 0x6d, 0x53, 0xcb, 0x3a, 0xe0, 0x37, 0x20, 0x2d, 0x4b, 0x76, 0xf0, 0x00, 0xe4, 0x18, 0x00, 0x08, 0x07, 0x20, 0xaf, 0x63, 0x8c, 0x0a, 0x00, 0xbc, 0x06, 0x00, 0x32, 0x1c, 0x02, 0x78,
+  0x1c, 0x40, 0x93, 0x7c, 0xf5, 0x8c, 0x6c, 0x1f, 0x22, 0xf0, 0x6b, 0x70, 0x4d, 0x20, 0xec, 0x42, 0x4e, 0x7b, 0x00, 0x72, 0x1f, 0x00, 0x10, 0x86, 0x00, 0x18, 0x07, 0x00, 0x1a, 0x00, 0x00, 0xbc,
+  0x23, 0x02, 0x9e, 0x23, 0x21, 0x73, 0x7c, 0x70, 0x2e, 0x00, 0x9e, 0xc2, 0x70, 0x3a, 0xa8, 0x19, 0x6b, 0x32, 0xcc, 0x42, 0x10, 0x15, 0x00, 0xe2, 0x11, 0x11, 0x8f, 0xde, 0xd0, 0x02, 0xce, 0x2a,
+  0x00, 0x9a, 0x2a, 0x20, 0xb3, 0x84, 0x30, 0x00, 0x11, 0x2d, 0x9e, 0x31, 0x42, 0x29, 0x32, 0x0d, 0x4b, 0x04, 0x20, 0x80, 0x10, 0x6c, 0x71, 0x74, 0x8e, 0x5b, 0xae, 0x63, 0x56, 0x66, 0xa0, 0x51,
+  0x7c, 0x92, 0x84, 0x30, 0x7c, 0x8e, 0x6b, 0xeb, 0x52, 0x16, 0x78, 0xf0, 0x01, 0x51, 0x84, 0x30, 0x7c, 0x92, 0x8c, 0x50, 0x84, 0xef, 0x73, 0x30, 0x7c, 0xaf, 0x6b, 0x4d, 0x63, 0xf2, 0x06, 0xa0,
+  0xe7, 0x31, 0xa9, 0x4a, 0x0b, 0x53, 0x4b, 0x5b, 0x68, 0x42, 0x74, 0x03, 0x40, 0x0b, 0x53, 0x0f, 0x74, 0xe2, 0x1f, 0xa0, 0x4d, 0x5b, 0xce, 0x6b, 0xb1, 0x84, 0xb2, 0x8c, 0x50, 0x84, 0x0a, 0x07,
+  0xf0, 0x05, 0xca, 0x52, 0x2b, 0x5b, 0x4c, 0x63, 0x2f, 0x7c, 0xed, 0x73, 0x6f, 0x84, 0xb0, 0x8c, 0x0a, 0x5b, 0xac, 0x6b, 0x0e, 0x7c, 0x12, 0x2e, 0x00, 0xf0, 0x1f, 0x11, 0x2b, 0xda, 0x46, 0xf0,
+  0x11, 0xe9, 0x5a, 0xcc, 0x73, 0x8f, 0x8c, 0x09, 0x5b, 0x6a, 0x6b, 0x2e, 0x84, 0x4e, 0x84, 0xd0, 0x94, 0x8c, 0x6b, 0x88, 0x4a, 0xad, 0x73, 0x0e, 0x7c, 0x6c, 0x6b, 0x27, 0x42, 0xca, 0x5a, 0x2f,
+  0x84, 0xfe, 0x2d, 0x00, 0x14, 0x7c, 0x00, 0x64, 0x23, 0x60, 0x2f, 0x84, 0x74, 0xad, 0x91, 0x8c, 0x12, 0x00, 0x80, 0xeb, 0x62, 0xca, 0x5a, 0xeb, 0x5a, 0x2c, 0x63, 0x64, 0x4a, 0x20, 0x71, 0x94,
+  0x3a, 0xaa, 0x11, 0xae, 0x28, 0x35, 0x00, 0xd2, 0x06, 0x00, 0xf6, 0x02, 0x00, 0xba, 0x2d, 0x02, 0xa2, 0x6d, 0x13, 0x51, 0xb6, 0x46, 0x00, 0x3e, 0x2a, 0x02, 0xa2, 0x7f, 0x00, 0xca, 0x0d, 0x11,
+  0x93, 0x5e, 0x78, 0x00, 0x88, 0x03, 0x11, 0x4e, 0x08, 0x0e, 0x02, 0x20, 0x3c, 0x02, 0xaa, 0x2a, 0x02, 0x72, 0x2a, 0x00, 0xd6, 0x58, 0x13, 0x11, 0x3e, 0x03, 0x00, 0x0c, 0x07, 0x00, 0x3c, 0x7c,
+  0x06, 0xcc, 0x58, 0x02, 0x4a, 0x00, 0x00, 0x7c, 0x2e, 0x00, 0xcc, 0x23, 0x00, 0x44, 0x0a, 0x31, 0xd4, 0xa4, 0xd4, 0x94, 0x0a, 0x28, 0x72, 0x94, 0xb0, 0x18, 0x02, 0x46, 0x3c, 0x20, 0xd0, 0x83,
+  0xca, 0x15, 0x02, 0xa8, 0x31, 0x02, 0x04, 0x07, 0x08, 0x02, 0x00, 0x1b, 0x72, 0x0a, 0x00, 0x0f, 0x3c, 0x0e, 0x21, 0x08, 0x1c, 0x00, 0x11, 0x51, 0x48, 0xd5, 0x06, 0x10, 0x47, 0x06, 0xaa, 0x0a,
+  0x0f, 0x44, 0x75, 0x03, 0x0c, 0x7c, 0x43, 0x04, 0x1e, 0x2e, 0x05, 0xb0, 0x0a, 0x0a, 0xf4, 0x7f, 0x06, 0x36, 0x2e, 0x03, 0x62, 0x3c, 0x07, 0xbe, 0x0a, 0x07, 0xb2, 0x2a, 0x13, 0x94, 0x8a, 0x23,
+  0x02, 0x9e, 0x0a, 0x06, 0xb4, 0x4a, 0x04, 0x4a, 0x0e, 0x06, 0xce, 0x8a, 0x04, 0x94, 0x03, 0x04, 0x1c, 0x07, 0x08, 0x5e, 0x15, 0x02, 0x06, 0x59, 0x02, 0x94, 0x03, 0x02, 0xe6, 0xb1, 0x04, 0x3a,
+  0x2e, 0x21, 0x36, 0xd6, 0xaa, 0xbc, 0x02, 0xd6, 0x51, 0x01, 0x80, 0xee, 0x11, 0xf5, 0xc6, 0x23, 0x00, 0xe2, 0x91, 0x00, 0xf6, 0xc3, 0x11, 0x78, 0x54, 0x15, 0x80, 0x36, 0xd6, 0x0e, 0x8c, 0xb1,
+  0xa4, 0x1a, 0xf7, 0x9a, 0x23, 0x42, 0xd5, 0xc5, 0x1a, 0xf7, 0xba, 0x1c, 0x40, 0xb5, 0xc5, 0xb9, 0xe6, 0x94, 0x03, 0x00, 0xb0, 0x03, 0x00, 0xd0, 0x83, 0x11, 0xaf, 0xc2, 0xec, 0x00, 0x3a, 0x0a,
+  0x00, 0x3a, 0x4d, 0x40, 0xab, 0x42, 0xcc, 0x42, 0x64, 0xa9, 0x00, 0x5a, 0x0a, 0x20, 0x76, 0x9d, 0x68, 0x23, 0x00, 0x88, 0x03, 0x02, 0x78, 0x7b, 0x20, 0xed, 0x4a, 0x74, 0x89, 0x20, 0xcc, 0x42,
+  0x94, 0x03, 0x00, 0x0c, 0x2e, 0x40, 0xf5, 0x8c, 0x72, 0x7c, 0x0c, 0x20, 0x40, 0x97, 0xa5, 0x73, 0x7c, 0xee, 0x0d, 0x00, 0xb8, 0x23, 0x31, 0x6f, 0x5b, 0x6e, 0xec, 0x34, 0x10, 0x0d, 0xa8, 0xb0,
+  0x01, 0x0e, 0xa6, 0x11, 0x4e, 0xb6, 0xf7, 0x00, 0x44, 0x2e, 0x20, 0x2d, 0x4b, 0x82, 0x03, 0x00, 0xa2, 0x82, 0x30, 0x72, 0x74, 0xb3, 0xce, 0x2a, 0x32, 0x74, 0xb3, 0x84, 0xc4, 0x31, 0x40, 0x2d,
+  0x53, 0x0d, 0x4b, 0x2a, 0x12, 0x00, 0x6e, 0x15, 0x00, 0x90, 0x46, 0x00, 0xca, 0x11, 0x00, 0x32, 0x4a, 0xc0, 0x8a, 0x3a, 0x8e, 0x63, 0x72, 0x84, 0xd3, 0x8c, 0x14, 0x95, 0x51, 0x7c, 0x86, 0x11,
+  0xf0, 0x01, 0xd3, 0x94, 0x50, 0x7c, 0x13, 0x95, 0x54, 0x9d, 0xee, 0x73, 0x50, 0x84, 0x91, 0x8c, 0x0f, 0x7c, 0xbe, 0x18, 0xf0, 0x07, 0xad, 0x63, 0xae, 0x6b, 0x69, 0x42, 0x6c, 0x63, 0xea, 0x52,
+  0x0a, 0x53, 0xea, 0x52, 0x0b, 0x53, 0x0b, 0x53, 0x48, 0x3a, 0xca, 0x4a, 0x0c, 0x91, 0x01, 0x5c, 0x7f, 0x90, 0x95, 0x13, 0x95, 0xae, 0x6b, 0x0b, 0x53, 0xad, 0x6b, 0x92, 0x0a, 0x60, 0xc9, 0x52,
+  0x47, 0x42, 0xe5, 0x31, 0xde, 0x54, 0x20, 0x2a, 0x63, 0xd0, 0x46, 0x40, 0x6b, 0x6b, 0xc9, 0x52, 0x80, 0x58, 0x31, 0xed, 0x7b, 0xc9, 0x92, 0x2a, 0xf0, 0x09, 0x6b, 0x6b, 0x0d, 0x7c, 0x6e, 0x8c,
+  0xac, 0x73, 0x0d, 0x7c, 0x4e, 0x84, 0x2a, 0x63, 0xc5, 0x31, 0x84, 0x31, 0x0b, 0x5b, 0x0b, 0x5b, 0xeb, 0x5a, 0x52, 0x23, 0x40, 0xd6, 0xbd, 0xb1, 0x94, 0x86, 0x03, 0x40, 0xae, 0x7b, 0x0f, 0x84,
+  0x3c, 0x8a, 0x60, 0xce, 0x73, 0x0b, 0x63, 0xa9, 0x52, 0x0a, 0x27, 0x40, 0x0b, 0x63, 0x4c, 0x6b, 0x8a, 0x03, 0x51, 0x13, 0xa5, 0x51, 0x8c, 0xae, 0xee, 0x22, 0x00, 0xd6, 0x22, 0x22, 0x6e, 0x73,
+  0x0a, 0x7c, 0x02, 0xc6, 0x66, 0x11, 0x31, 0x4e, 0x03, 0x04, 0xc4, 0x14, 0x02, 0x76, 0x0d, 0x11, 0xd4, 0xe8, 0x06, 0x01, 0x78, 0x0a, 0x12, 0x94, 0x90, 0x5f, 0x02, 0xa0, 0x86, 0x11, 0xb3, 0xb8,
+  0x86, 0x11, 0xaf, 0xc0, 0x03, 0x02, 0x18, 0x15, 0x12, 0x92, 0xfc, 0x26, 0x12, 0x83, 0x50, 0x0e, 0x13, 0x72, 0x10, 0x07, 0x02, 0x12, 0x75, 0x00, 0x04, 0x12, 0x04, 0x90, 0x0a, 0x20, 0xf4, 0xa4,
+  0x88, 0xa3, 0x00, 0xd2, 0x7f, 0x51, 0x31, 0x8c, 0xec, 0x62, 0x92, 0x50, 0x3c, 0x00, 0xfa, 0x23, 0x00, 0x16, 0x07, 0x00, 0x46, 0x12, 0x21, 0x10, 0x8c, 0x88, 0x03, 0x00, 0x4c, 0x15, 0x08, 0x08,
+  0x07, 0x07, 0x02, 0x00, 0x15, 0x31, 0xa0, 0x03, 0x05, 0xcc, 0x0a, 0x2f, 0x94, 0x51, 0x5c, 0x15, 0x1c, 0x00, 0x4a, 0x15, 0x06, 0x50, 0x15, 0x02, 0x8e, 0x03, 0x04, 0x52, 0x15, 0x0e, 0xfc, 0x1f,
+  0x08, 0x90, 0xaa, 0x0b, 0x1a, 0x07, 0x07, 0x86, 0x23, 0x05, 0xfa, 0x1f, 0x0a, 0x08, 0x00, 0x05, 0x72, 0x15, 0x24, 0x32, 0xb5, 0x9c, 0x23, 0x06, 0x4c, 0x55, 0x13, 0x73, 0x5c, 0xee, 0x10, 0x74,
+  0x1c, 0xa0, 0x02, 0x80, 0x03, 0x12, 0xc5, 0x60, 0xae, 0x04, 0xce, 0x11, 0x06, 0xd2, 0x31, 0x04, 0x64, 0x15, 0x04, 0x80, 0x3c, 0x17, 0xd5, 0xc6, 0x11, 0x00, 0x08, 0x00, 0x02, 0x7a, 0xb5, 0x02,
+  0xb8, 0x03, 0x02, 0x80, 0x03, 0x02, 0xa8, 0xbc, 0x11, 0xf5, 0x44, 0x0e, 0x00, 0x9e, 0x0a, 0x02, 0x20, 0xd2, 0x03, 0x64, 0x8e, 0x21, 0xce, 0x37, 0x1e, 0x20, 0x00, 0x8c, 0x03, 0x40, 0xee, 0x8b,
+  0x33, 0xb5, 0x22, 0x39, 0xa0, 0x94, 0xc5, 0xb0, 0xa4, 0x78, 0xde, 0x1a, 0xf7, 0xf6, 0xcd, 0xe4, 0x18, 0x22, 0x12, 0xb5, 0xbc, 0x43, 0x11, 0xb8, 0xcc, 0x11, 0x02, 0x40, 0x07, 0x00, 0x04, 0x00,
+  0x20, 0xcc, 0x42, 0xb2, 0x06, 0x00, 0xba, 0x18, 0xa0, 0xec, 0x42, 0x2d, 0x53, 0xf0, 0x63, 0xd4, 0x84, 0x56, 0x95, 0xc2, 0x0d, 0x00, 0x80, 0x2d, 0x60, 0x2e, 0x53, 0x8b, 0x3a, 0x4a, 0x32, 0xe2,
+  0xe5, 0x02, 0xdc, 0x0d, 0x10, 0x93, 0xa8, 0x31, 0x01, 0x04, 0xa6, 0x00, 0x1a, 0x00, 0x11, 0x2e, 0x9e, 0x23, 0x00, 0x02, 0x15, 0x60, 0xac, 0x42, 0x2d, 0x53, 0x52, 0x74, 0x26, 0x5f, 0x00, 0x28,
+  0x00, 0x00, 0xac, 0x0a, 0x00, 0xa0, 0x38, 0x02, 0x42, 0x3c, 0x11, 0x11, 0x28, 0x98, 0x22, 0x8f, 0x5b, 0x56, 0x0e, 0x20, 0xb4, 0x84, 0xa4, 0x0a, 0x00, 0x20, 0x07, 0x71, 0x29, 0x32, 0xab, 0x42,
+  0x0d, 0x4b, 0x6a, 0x34, 0x58, 0x20, 0x6e, 0x5b, 0x8e, 0x0e, 0x00, 0x20, 0x07, 0x10, 0xb3, 0xe8, 0xe9, 0x01, 0x80, 0x35, 0x20, 0xb3, 0x84, 0x3e, 0x43, 0xf0, 0x07, 0x55, 0x95, 0xd3, 0x8c, 0x72,
+  0x84, 0x4d, 0x5b, 0x86, 0x21, 0x8e, 0x63, 0x34, 0x9d, 0x54, 0x9d, 0xd2, 0x94, 0xce, 0x73, 0x4c, 0x63, 0xd8, 0x89, 0xf1, 0x0a, 0x2b, 0x5b, 0xa9, 0x4a, 0x2b, 0x5b, 0x50, 0x84, 0x0e, 0x74, 0x0e,
+  0x74, 0xee, 0x73, 0x4b, 0x5b, 0x6c, 0x63, 0x0a, 0x53, 0xca, 0x4a, 0x0a, 0x53, 0x0b, 0x02, 0x00, 0x00, 0xde, 0x18, 0x60, 0xcf, 0x6b, 0xae, 0x6b, 0x4c, 0x5b, 0x78, 0x2a, 0xa0, 0x07, 0x3a, 0xd2,
+  0x94, 0x13, 0x9d, 0x68, 0x42, 0xac, 0x6b, 0x32, 0x3c, 0x20, 0x4e, 0x84, 0xc2, 0x18, 0x00, 0xd0, 0x18, 0x40, 0x4a, 0x63, 0xed, 0x7b, 0x82, 0x03, 0x33, 0xa8, 0x52, 0x67, 0xa2, 0x31, 0x11, 0xac,
+  0x18, 0x35, 0x80, 0x6f, 0x8c, 0x0d, 0x7c, 0x2a, 0x63, 0x47, 0x4a, 0xc6, 0x94, 0x00, 0x2c, 0x15, 0x00, 0xbc, 0x94, 0x40, 0x6d, 0x6b, 0x13, 0xa5, 0x6c, 0x78, 0x00, 0x7c, 0xad, 0x60, 0xae, 0x7b,
+  0x4c, 0x6b, 0xce, 0x7b, 0xb8, 0x0a, 0x20, 0x0b, 0x5b, 0x5a, 0x6a, 0x21, 0x6d, 0x6b, 0xa6, 0x0a, 0x10, 0x94, 0xe0, 0x46, 0x00, 0xf0, 0x49, 0x00, 0xde, 0x1f, 0x00, 0x12, 0xd1, 0x00, 0x5a, 0x98,
+  0x02, 0x2a, 0x0e, 0x02, 0x04, 0x35, 0x01, 0xd6, 0x3f, 0x01, 0x76, 0x51, 0x00, 0x18, 0x0e, 0x00, 0x58, 0x0e, 0x22, 0x8f, 0x73, 0x1e, 0x00, 0x02, 0xec, 0x18, 0x22, 0xaf, 0x7b, 0x3c, 0x43, 0x00,
+  0x1a, 0x00, 0x04, 0x2e, 0x3c, 0x04, 0x82, 0x1c, 0x00, 0x94, 0x11, 0x02, 0x2c, 0x07, 0x02, 0x50, 0x2e, 0x11, 0x52, 0x74, 0x07, 0x01, 0x34, 0x4e, 0x01, 0x54, 0x83, 0x30, 0x92, 0x94, 0x35, 0xe2,
+  0xc6, 0xe0, 0x94, 0x2d, 0x6b, 0xcc, 0x62, 0x4d, 0x6b, 0xec, 0x62, 0xd3, 0x9c, 0x76, 0xb5, 0x10, 0x20, 0x19, 0x16, 0x8c, 0xf8, 0x7f, 0x11, 0x92, 0x78, 0xff, 0x05, 0x18, 0x07, 0x02, 0x32, 0x0e,
+  0x01, 0x7a, 0x03, 0x04, 0x86, 0x03, 0x05, 0xc8, 0x31, 0x05, 0x22, 0x07, 0x0f, 0xda, 0x18, 0x13, 0x0c, 0xb6, 0x0a, 0x01, 0x98, 0x8a, 0x28, 0x94, 0x72, 0xc4, 0x11, 0x06, 0x5c, 0x5c, 0x0f, 0x56,
+  0x15, 0x08, 0x08, 0x8a, 0x03, 0x06, 0x68, 0x03, 0x09, 0xb0, 0x0a, 0x03, 0x84, 0x23, 0x08, 0x2e, 0x2e, 0x15, 0x53, 0xe2, 0x11, 0x15, 0x53, 0x00, 0x20, 0x14, 0x73, 0x4c, 0xae, 0x03, 0x84, 0x03,
+  0x04, 0x76, 0x03, 0x11, 0x94, 0x0c, 0xa7, 0x06, 0xc6, 0x11, 0x24, 0xf1, 0xac, 0x30, 0x0e, 0x02, 0x58, 0x15, 0x15, 0xf5, 0x6e, 0x5c, 0x02, 0x5e, 0x2e, 0x00, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x04,
+  0x10, 0x19, 0x04, 0x78, 0x5c, 0x04, 0x3e, 0xa7, 0x02, 0xfe, 0x98, 0x04, 0xa2, 0xbc, 0x00, 0x86, 0x03, 0x02, 0x8c, 0xee, 0x00, 0x44, 0x0e, 0x00, 0xbc, 0x4a, 0x60, 0x12, 0xad, 0xfa, 0xee, 0x1a,
+  0xf7, 0xae, 0x4a, 0x01, 0xd2, 0xc3, 0x41, 0xd6, 0x2f, 0x94, 0x12, 0xa8, 0xe0, 0x00, 0x46, 0x47, 0x13, 0xb9, 0x64, 0x35, 0x02, 0x92, 0x03, 0x11, 0xb9, 0xf6, 0x18, 0x20, 0xab, 0x3a, 0x28, 0x63,
+  0x11, 0x8f, 0xa6, 0x97, 0x20, 0x56, 0x95, 0x10, 0x07, 0x00, 0x84, 0x11, 0x62, 0xab, 0x42, 0x6b, 0x3a, 0xec, 0x4a, 0x36, 0x38, 0x11, 0x31, 0x06, 0x27, 0x00, 0xdc, 0x0d, 0x00, 0x02, 0x3c, 0x00,
+  0x00, 0x4a, 0x00, 0xc6, 0x06, 0x00, 0xa8, 0x0a, 0xa0, 0xd0, 0x63, 0x6e, 0x5b, 0xb0, 0x63, 0x11, 0x74, 0x15, 0x95, 0x18, 0xbb, 0x02, 0x42, 0x3c, 0x00, 0x8e, 0x54, 0x02, 0xaa, 0xa9, 0x20, 0x11,
+  0x6c, 0x32, 0x5c, 0x00, 0x1e, 0x98, 0x40, 0x35, 0x8d, 0xb4, 0x7c, 0x36, 0x27, 0x60, 0xac, 0x42, 0x2a, 0x32, 0x4a, 0x32, 0xe6, 0x0a, 0x20, 0x0d, 0x4b, 0xa6, 0x0a, 0x60, 0x6f, 0x5b, 0xf0, 0x6b,
+  0xf4, 0x8c, 0x72, 0x00, 0x00, 0xb2, 0x0a, 0x00, 0x9c, 0x0e, 0x11, 0xf0, 0xf0, 0xa9, 0x00, 0x32, 0x07, 0x00, 0x16, 0x32, 0x40, 0x35, 0x95, 0xcf, 0x6b, 0x5a, 0x2e, 0x82, 0xe7, 0x31, 0x51, 0x84,
+  0x75, 0xa5, 0x10, 0x7c, 0x6a, 0x8d, 0x20, 0x70, 0x84, 0x4a, 0x2a, 0x22, 0x0b, 0x5b, 0xa0, 0x74, 0xc0, 0xad, 0x6b, 0x2a, 0x5b, 0x88, 0x42, 0x4b, 0x5b, 0xa9, 0x4a, 0x88, 0x42, 0x72, 0x2a, 0x11,
+  0x6c, 0x4e, 0x4a, 0x40, 0x50, 0x84, 0x6c, 0x63, 0x36, 0x3c, 0x20, 0xce, 0x73, 0x14, 0x07, 0x60, 0xad, 0x73, 0xea, 0x52, 0x80, 0x08, 0xd0, 0x46, 0x00, 0x60, 0x23, 0xa0, 0x4a, 0x63, 0xb0, 0x94,
+  0xec, 0x73, 0xc8, 0x52, 0xed, 0x7b, 0x8e, 0x31, 0x00, 0x7c, 0x2a, 0xf0, 0x0d, 0x4a, 0x6b, 0x0d, 0x84, 0xa8, 0x52, 0xc9, 0x5a, 0x09, 0x63, 0x0e, 0x84, 0xc8, 0x5a, 0x0a, 0x63, 0x4a, 0x63, 0x6f,
+  0x8c, 0x8c, 0x6b, 0x8c, 0x73, 0x8d, 0x73, 0x2c, 0x63, 0x8a, 0x38, 0xa0, 0xca, 0x52, 0x89, 0x52, 0x2b, 0x63, 0x50, 0x8c, 0x70, 0x8c, 0x22, 0x07, 0x40, 0xca, 0x5a, 0x48, 0x4a, 0x7c, 0x1c, 0x10,
+  0x8d, 0x7c, 0x0e, 0xd2, 0x73, 0xef, 0x7b, 0x0c, 0x63, 0x91, 0x94, 0x30, 0x84, 0xce, 0x7b, 0xeb, 0x62, 0x52, 0x1f, 0x02, 0x0e, 0x83, 0x02, 0x30, 0x5c, 0x00, 0xa8, 0x11, 0x00, 0x42, 0x0e, 0x00,
+  0xf4, 0x06, 0x02, 0x6e, 0x58, 0x02, 0xbe, 0x02, 0x02, 0x26, 0x43, 0x02, 0xe2, 0x3b, 0x00, 0xf2, 0x26, 0x02, 0x94, 0x03, 0x00, 0x18, 0x0e, 0x01, 0xbc, 0x11, 0x10, 0x8c, 0xba, 0x46, 0x01, 0x46,
+  0x2e, 0x01, 0x1c, 0x15, 0x11, 0xcf, 0x70, 0x15, 0x11, 0x51, 0x46, 0x3c, 0x02, 0xaa, 0x31, 0x00, 0x48, 0x15, 0x00, 0xb6, 0x03, 0x04, 0x16, 0x0e, 0x11, 0x6e, 0xd2, 0x58, 0x40, 0x0c, 0x63, 0xd0,
+  0x83, 0x64, 0x43, 0x10, 0xd3, 0x9c, 0x91, 0x10, 0x94, 0xc2, 0x0a, 0x40, 0xb6, 0xbd, 0xb6, 0xbd, 0x32, 0xa7, 0x20, 0x75, 0xb5, 0xda, 0x3f, 0x40, 0xf0, 0x83, 0x51, 0x94, 0x56, 0xbc, 0x03, 0x28,
+  0x0e, 0x0e, 0x02, 0x00, 0x07, 0x94, 0x03, 0x0a, 0xbe, 0x0a, 0x06, 0x12, 0x00, 0x0c, 0xa2, 0x03, 0x06, 0x0e, 0x99, 0x07, 0x1a, 0x07, 0x01, 0x08, 0x00, 0x02, 0xe8, 0x9f, 0x04, 0x8e, 0x03, 0x18,
+  0x91, 0x54, 0x15, 0x0f, 0xee, 0x7f, 0x0a, 0x0a, 0x3e, 0x75, 0x35, 0x11, 0xb5, 0x52, 0x28, 0x2e, 0x19, 0x11, 0x3a, 0x0e, 0x06, 0xd0, 0x11, 0x00, 0x18, 0x00, 0x05, 0xf6, 0x18, 0x03, 0x8a, 0x43,
+  0x04, 0x88, 0x43, 0x16, 0x53, 0x06, 0x20, 0x03, 0x94, 0x03, 0x26, 0xd1, 0xac, 0x9e, 0x0a, 0x06, 0x1c, 0x4e, 0x08, 0x2a, 0x47, 0x02, 0x12, 0x39, 0x04, 0x72, 0x55, 0x22, 0x94, 0xc5, 0x2c, 0xae,
+  0x04, 0xea, 0x11, 0x13, 0xf5, 0xbe, 0x0a, 0x04, 0x42, 0x0e, 0x02, 0x16, 0x60, 0x02, 0x5c, 0xc7, 0x02, 0xb6, 0x0a, 0x01, 0xd8, 0xa3, 0x03, 0xd8, 0xaa, 0x00, 0xe4, 0x31, 0x00, 0xf2, 0x11, 0x20,
+  0xf2, 0xac, 0xd2, 0x11, 0x00, 0x26, 0x60, 0x03, 0xbc, 0x43, 0x10, 0xde, 0x4a, 0x67, 0x00, 0xb6, 0x2a, 0x00, 0x8e, 0x03, 0x33, 0xf9, 0xee, 0xb9, 0x02, 0x39, 0x00, 0x8c, 0x18, 0x00, 0x1c, 0x51,
+  0xa0, 0x6b, 0x32, 0x4a, 0x2a, 0xe5, 0x00, 0x42, 0x00, 0x05, 0x09, 0x32, 0x03, 0x40, 0xab, 0x3a, 0x6f, 0x5b, 0x08, 0x2a, 0x00, 0x06, 0x3c, 0x00, 0xc6, 0x18, 0x00, 0xbc, 0x18, 0x00, 0x7a, 0x54,
+  0x00, 0xbe, 0x0a, 0x00, 0x6e, 0x38, 0x00, 0x02, 0x00, 0x24, 0x52, 0x7c, 0x88, 0x18, 0xa2, 0x8f, 0x5b, 0x2d, 0x53, 0x4e, 0x5b, 0xab, 0x42, 0x4e, 0x53, 0x68, 0x0a, 0x40, 0x15, 0x8d, 0xb3, 0x84,
+  0xd2, 0x2d, 0x20, 0xf0, 0x63, 0x14, 0x2b, 0x00, 0x4e, 0x00, 0x51, 0x4a, 0x32, 0xe9, 0x29, 0xec, 0xde, 0x62, 0x11, 0xd0, 0x44, 0xed, 0x11, 0x93, 0xde, 0x62, 0x00, 0x4e, 0x00, 0x00, 0x92, 0x0e,
+  0x00, 0x88, 0x03, 0x00, 0x84, 0x0e, 0x00, 0x1c, 0x00, 0x00, 0x16, 0x00, 0x00, 0xca, 0x18, 0x00, 0xec, 0x03, 0x00, 0x5e, 0x51, 0x40, 0xaf, 0x6b, 0xcf, 0x6b, 0x56, 0x1c, 0x00, 0x16, 0x3c, 0x00,
+  0xc4, 0x11, 0x32, 0x2c, 0x5b, 0xad, 0x68, 0x5f, 0x00, 0x90, 0x9b, 0x40, 0x63, 0xc9, 0x52, 0xcd, 0x28, 0x1c, 0x30, 0x5b, 0x68, 0x42, 0x30, 0x07, 0xc0, 0x4c, 0x5b, 0x07, 0x32, 0xeb, 0x52, 0x71,
+  0x84, 0x91, 0x8c, 0x6d, 0x63, 0xb0, 0x11, 0x20, 0xcd, 0x6b, 0x9e, 0x03, 0x20, 0x70, 0x8c, 0x54, 0x31, 0x62, 0x0e, 0x7c, 0x8b, 0x6b, 0xe9, 0x5a, 0x40, 0x43, 0x80, 0xab, 0x73, 0x66, 0x4a, 0x87,
+  0x4a, 0x8b, 0x73, 0x50, 0x4a, 0x20, 0xcc, 0x7b, 0xe6, 0x4d, 0x00, 0xd4, 0x46, 0x40, 0xac, 0x73, 0x8f, 0x94, 0x20, 0x00, 0x40, 0xac, 0x73, 0x4b, 0x6b, 0x0a, 0x7c, 0x51, 0x0b, 0x63, 0xeb, 0x5a,
+  0x0b, 0x70, 0x9f, 0x40, 0x0f, 0x7c, 0xce, 0x7b, 0x04, 0x7c, 0x00, 0xa2, 0x31, 0x00, 0x1e, 0x7c, 0x40, 0xcd, 0x7b, 0xcd, 0x73, 0x92, 0x03, 0x53, 0xee, 0x7b, 0x50, 0x8c, 0x8d, 0xac, 0x38, 0x40,
+  0xef, 0x7b, 0x6d, 0x6b, 0x66, 0x86, 0x01, 0x76, 0x98, 0x00, 0x50, 0x43, 0x01, 0x1e, 0x2e, 0x00, 0x32, 0x58, 0x11, 0xcf, 0xc2, 0x06, 0x11, 0x6e, 0xd8, 0x11, 0x00, 0xe0, 0x5f, 0x00, 0xd4, 0x11,
+  0x02, 0xa4, 0x2a, 0x00, 0xdc, 0x11, 0x01, 0xd6, 0x26, 0x01, 0x1e, 0x5c, 0x20, 0x31, 0x8c, 0x48, 0x1c, 0x11, 0x11, 0x74, 0x63, 0x02, 0x06, 0x75, 0x02, 0x10, 0x55, 0x04, 0x7a, 0x38, 0x11, 0x51,
+  0x80, 0x31, 0x04, 0xfc, 0x0d, 0x04, 0x1a, 0x0e, 0x00, 0x78, 0x51, 0x00, 0x18, 0x0e, 0x00, 0xaa, 0x31, 0x02, 0xb2, 0x98, 0xc0, 0x10, 0x8c, 0xef, 0x83, 0x4d, 0x6b, 0x10, 0x8c, 0x14, 0xad, 0x51,
+  0x94, 0x80, 0x03, 0x00, 0x12, 0x00, 0x8a, 0xd3, 0xa4, 0xd3, 0xa4, 0xcf, 0x83, 0x10, 0x8c, 0x48, 0x03, 0x0f, 0x90, 0x03, 0x11, 0x0f, 0xaa, 0x0a, 0x1d, 0x02, 0x1c, 0x07, 0x19, 0x72, 0x50, 0x15,
+  0x18, 0x70, 0xa6, 0x2a, 0x0e, 0xfe, 0x1f, 0x0b, 0x72, 0x1c, 0x0e, 0x52, 0x35, 0x0e, 0xea, 0x38, 0x06, 0xa4, 0x2a, 0x17, 0x32, 0xf4, 0x5f, 0x04, 0xbc, 0x31, 0x05, 0x6a, 0x1c, 0x02, 0x02, 0x40,
+  0x05, 0xe2, 0x18, 0x00, 0x02, 0x00, 0x11, 0x12, 0xcc, 0x98, 0x06, 0xf2, 0x1f, 0x19, 0x94, 0x14, 0x27, 0x08, 0x74, 0x1c, 0x06, 0x08, 0x59, 0x01, 0xa4, 0x31, 0x23, 0xd6, 0xb4, 0xc6, 0x6a, 0x02,
+  0x82, 0x03, 0x04, 0xb4, 0x0a, 0x04, 0x0c, 0x00, 0x02, 0x62, 0x87, 0x00, 0x84, 0xc0, 0x02, 0xa0, 0x4a, 0x00, 0x18, 0xf2, 0x00, 0x54, 0x35, 0x50, 0xd9, 0xee, 0xd5, 0xc5, 0x57, 0xf0, 0xd5, 0x12,
+  0xb5, 0x80, 0x95, 0x12, 0x98, 0x34, 0x27, 0x01, 0x12, 0x59, 0x02, 0x94, 0x3c, 0x00, 0x9c, 0x23, 0x00, 0x7c, 0x1c, 0x02, 0x22, 0x07, 0x20, 0xcc, 0x3a, 0x0a, 0x40, 0x00, 0xae, 0x1f, 0x00, 0x64,
+  0x0a, 0x00, 0x4c, 0x2e, 0x00, 0xe6, 0x06, 0x20, 0x15, 0x8d, 0x92, 0x3f, 0x02, 0x10, 0x23, 0x31, 0x92, 0x7c, 0xaf, 0x0e, 0x3c, 0x00, 0xd6, 0x0d, 0x00, 0x92, 0x2a, 0x00, 0x94, 0x0a, 0x10, 0x31,
+  0xc0, 0x11, 0x10, 0x7c, 0x76, 0x31, 0x60, 0x0d, 0x53, 0x11, 0x74, 0xf0, 0x6b, 0x46, 0x07, 0x00, 0x20, 0x15, 0x00, 0xce, 0x23, 0x00, 0x4e, 0x03, 0x00, 0xa0, 0x0a, 0x02, 0x74, 0x38, 0x00, 0xfe,
+  0x4d, 0x02, 0xea, 0x1f, 0x02, 0x06, 0x07, 0x02, 0x7e, 0x03, 0x20, 0x8f, 0x5b, 0xa6, 0x0e, 0x00, 0x36, 0x0e, 0x00, 0xec, 0x62, 0x20, 0x6f, 0x5b, 0x02, 0x6a, 0x20, 0x2d, 0x53, 0xf2, 0xbe, 0x51,
+  0x11, 0x74, 0xaf, 0x63, 0x8e, 0x2c, 0x63, 0x11, 0x8e, 0x0a, 0x2e, 0x20, 0xb3, 0x8c, 0x5e, 0x1c, 0x40, 0x0c, 0x53, 0x4d, 0x5b, 0x68, 0x2a, 0x00, 0xb4, 0x1f, 0x00, 0xaa, 0x18, 0x20, 0xee, 0x73,
+  0x64, 0x58, 0x00, 0x12, 0x15, 0x40, 0x6c, 0x63, 0x6c, 0x63, 0x48, 0x4a, 0x10, 0x8d, 0x92, 0x4a, 0x12, 0x73, 0x1c, 0x35, 0x11, 0xad, 0x66, 0x23, 0x20, 0x12, 0x9d, 0xb6, 0x3f, 0xc0, 0x0a, 0x5b,
+  0x67, 0x4a, 0x63, 0x29, 0x2a, 0x63, 0x8f, 0x94, 0x0d, 0x7c, 0x3a, 0x3c, 0x00, 0xa0, 0x38, 0x62, 0xab, 0x73, 0x4e, 0x8c, 0x0d, 0x7c, 0x5a, 0x43, 0xf0, 0x03, 0x0d, 0x84, 0x2d, 0x84, 0xb0, 0x94,
+  0xd0, 0x9c, 0x0d, 0x84, 0x4f, 0x8c, 0x32, 0xad, 0x4b, 0x6b, 0x2e, 0x84, 0x56, 0x71, 0x11, 0xad, 0x9a, 0x0a, 0x51, 0x10, 0x84, 0x71, 0x94, 0xad, 0xc8, 0x8d, 0x20, 0x4f, 0x8c, 0xea, 0x18, 0x00,
+  0xd2, 0x66, 0x10, 0x6b, 0x70, 0x4a, 0x00, 0x4c, 0x5c, 0x10, 0x73, 0xe6, 0x03, 0x00, 0xa4, 0x58, 0x40, 0x2c, 0x63, 0x71, 0x94, 0x00, 0x75, 0x11, 0xb2, 0x8e, 0x03, 0x00, 0xae, 0x0a, 0x00, 0x6a,
+  0x03, 0x50, 0x8e, 0x73, 0x6e, 0x6b, 0xcf, 0x56, 0x15, 0x00, 0x36, 0x5c, 0x01, 0xea, 0x3f, 0x22, 0xf0, 0x83, 0x1e, 0x63, 0x02, 0x0e, 0x23, 0x11, 0xd3, 0x4e, 0x15, 0x00, 0x02, 0x3c, 0x00, 0x48,
+  0xca, 0x01, 0xb4, 0x6d, 0x12, 0xad, 0x46, 0x63, 0x00, 0x40, 0x23, 0x00, 0x64, 0x07, 0x02, 0x62, 0x0a, 0x24, 0x31, 0x84, 0xd2, 0x0a, 0x11, 0x10, 0x4c, 0x43, 0x04, 0xb6, 0x26, 0x02, 0x40, 0x19,
+  0x02, 0x0e, 0x07, 0x04, 0x0e, 0x0e, 0x20, 0x8e, 0x7b, 0x22, 0x0e, 0x00, 0x48, 0x03, 0x40, 0x34, 0xad, 0x96, 0xbd, 0x9c, 0x03, 0x71, 0x76, 0xb5, 0x92, 0x94, 0xae, 0x7b, 0x72, 0x08, 0x19, 0x4f,
+  0xf8, 0xc5, 0x92, 0x9c, 0x16, 0x07, 0x07, 0x0a, 0x0c, 0x07, 0x0c, 0xcc, 0x11, 0x0c, 0xa8, 0x03, 0x08, 0x34, 0x00, 0x02, 0x98, 0x0a, 0x24, 0x72, 0x9c, 0x46, 0xa0, 0x08, 0x8c, 0x03, 0x04, 0x68,
+  0x9c, 0x0c, 0x4c, 0x55, 0x0b, 0x30, 0xee, 0x0f, 0x12, 0x47, 0x04, 0x08, 0x62, 0x1c, 0x03, 0xb0, 0xca, 0x0a, 0x9e, 0x03, 0x21, 0xbd, 0x12, 0xac, 0x23, 0x02, 0x46, 0xa7, 0x22, 0xd0, 0xac, 0xa8,
+  0x4a, 0x06, 0x0c, 0x80, 0x06, 0x1e, 0x27, 0x13, 0x94, 0x08, 0x20, 0x02, 0x9e, 0x2a, 0x04, 0xca, 0x11, 0x04, 0xd0, 0x11, 0x08, 0x4e, 0x15, 0x02, 0xa4, 0x0a, 0x08, 0xd6, 0x11, 0x24, 0x36, 0xd6,
+  0x3e, 0x0e, 0x02, 0xe2, 0x51, 0x17, 0xf5, 0x2e, 0x67, 0x04, 0x14, 0x00, 0x00, 0x84, 0x23, 0x00, 0xfe, 0x46, 0x11, 0x78, 0x14, 0xd2, 0x00, 0x5c, 0xe7, 0x02, 0x46, 0x27, 0x40, 0x4f, 0x9c, 0x12,
+  0xad, 0xf0, 0xaa, 0x00, 0xbe, 0xdc, 0x00, 0x62, 0x8e, 0x02, 0x54, 0x2e, 0x20, 0x98, 0xe6, 0xa8, 0x43, 0x42, 0x98, 0xe6, 0xd9, 0xee, 0x28, 0x27, 0x02, 0x5e, 0x4e, 0x20, 0xfa, 0xee, 0x08, 0x00,
+  0x00, 0x2c, 0x03, 0x00, 0x84, 0x18, 0x00, 0x70, 0x03, 0x11, 0x6f, 0x26, 0x03, 0x00, 0xd6, 0x31, 0x00, 0x8c, 0x03, 0x13, 0x2e, 0x64, 0x1c, 0x00, 0x8e, 0x03, 0x00, 0x9e, 0x5b, 0x20, 0xb3, 0x84,
+  0x1c, 0x07, 0x11, 0x72, 0xb0, 0x03, 0xc0, 0x4e, 0x5b, 0x2d, 0x53, 0x8a, 0x3a, 0xcf, 0x63, 0x15, 0x95, 0xd4, 0x8c, 0x0e, 0xe9, 0x51, 0x72, 0x7c, 0x11, 0x74, 0x8e, 0xec, 0xfe, 0x00, 0x92, 0x15,
+  0x00, 0x86, 0x38, 0x42, 0x0d, 0x4b, 0xaf, 0x63, 0x08, 0x2e, 0x00, 0xbc, 0x03, 0x00, 0x40, 0x00, 0x00, 0xee, 0x0a, 0x60, 0x8b, 0x3a, 0x29, 0x32, 0xec, 0x4a, 0xe8, 0x03, 0x02, 0x24, 0x9f, 0x20,
+  0xf4, 0x8c, 0xf2, 0x62, 0x00, 0x7a, 0x07, 0x02, 0xba, 0x35, 0x00, 0x6a, 0x58, 0x91, 0x6a, 0x3a, 0xf0, 0x6b, 0xcc, 0x4a, 0xd0, 0x6b, 0xb3, 0x72, 0x4a, 0xc2, 0xec, 0x52, 0x08, 0x32, 0x08, 0x32,
+  0xcb, 0x4a, 0x0c, 0x53, 0x8d, 0x63, 0xf2, 0x2d, 0x90, 0xad, 0x6b, 0x70, 0x84, 0x54, 0xa5, 0x2b, 0x5b, 0x2b, 0x0e, 0x2e, 0x30, 0x4a, 0xc9, 0x52, 0xd4, 0x11, 0x10, 0xcd, 0x2c, 0x98, 0x10, 0x5b,
+  0x38, 0x07, 0xf0, 0x0b, 0xc9, 0x52, 0x88, 0x4a, 0xea, 0x5a, 0x4b, 0x63, 0x8b, 0x6b, 0x2d, 0x7c, 0xaf, 0x8c, 0x8f, 0x8c, 0x2e, 0x84, 0x8b, 0x73, 0x52, 0xad, 0x4e, 0x8c, 0x8f, 0x94, 0x6c, 0x51,
+  0xe0, 0x6a, 0x6b, 0xaf, 0x94, 0xcc, 0x73, 0xa7, 0x52, 0xcc, 0x73, 0x6a, 0x6b, 0xec, 0x7b, 0x8a, 0x31, 0x40, 0x4e, 0x8c, 0xcc, 0x7b, 0x6e, 0x4a, 0x20, 0x2e, 0x84, 0xde, 0x4d, 0x00, 0x8e, 0x03,
+  0xf0, 0x03, 0xb1, 0x9c, 0x70, 0x8c, 0xb1, 0x9c, 0x30, 0x8c, 0x0b, 0x63, 0xae, 0x73, 0xea, 0x5a, 0x4b, 0x6b, 0xea, 0x5a, 0x2e, 0x35, 0xe2, 0xe9, 0x5a, 0xa8, 0x52, 0x0a, 0x63, 0xc8, 0x5a, 0xc8,
+  0x5a, 0x09, 0x63, 0x0a, 0x63, 0x40, 0x35, 0x00, 0x44, 0x07, 0x00, 0x0e, 0x27, 0x02, 0xf6, 0x26, 0x02, 0xb4, 0x11, 0x02, 0x28, 0xaa, 0x20, 0x31, 0x8c, 0x60, 0x15, 0x02, 0x7e, 0xed, 0x04, 0x8c,
+  0xad, 0x02, 0x60, 0x78, 0x02, 0xd8, 0x8d, 0x01, 0x4a, 0x91, 0x01, 0x40, 0x07, 0x01, 0xf4, 0x74, 0x14, 0x8c, 0xce, 0x58, 0x11, 0xaf, 0x48, 0x55, 0x01, 0xac, 0x0a, 0x03, 0xe6, 0x4d, 0x22, 0x72,
+  0x94, 0x88, 0x03, 0x00, 0x16, 0x07, 0x06, 0x18, 0x15, 0x02, 0x42, 0x00, 0x01, 0xb4, 0x71, 0x50, 0x83, 0x8e, 0x7b, 0xf0, 0x83, 0x0e, 0x2b, 0x02, 0x46, 0x0e, 0x13, 0x51, 0x16, 0x03, 0x91, 0xf0,
+  0x83, 0x6e, 0x7b, 0xaf, 0x83, 0xf0, 0x83, 0xcf, 0xc2, 0x0a, 0x00, 0xb6, 0x06, 0x22, 0x96, 0xbd, 0x1a, 0x0e, 0x1e, 0x71, 0x10, 0x07, 0x07, 0x6e, 0x03, 0x0e, 0x8c, 0x03, 0x0e, 0x3c, 0x07, 0x0e,
+  0xb2, 0x0a, 0x15, 0x71, 0x98, 0x03, 0x06, 0x86, 0x23, 0x15, 0x91, 0xae, 0x71, 0x0a, 0x70, 0x1c, 0x1c, 0xb0, 0x64, 0x5c, 0x0e, 0x50, 0x35, 0x0a, 0xf4, 0x3f, 0x14, 0xbd, 0xac, 0x31, 0x04, 0x16,
+  0x07, 0x06, 0x0c, 0x00, 0x06, 0x3c, 0x0e, 0x12, 0x52, 0xde, 0xd1, 0x07, 0xea, 0x38, 0x04, 0x8e, 0x23, 0x03, 0x0a, 0x20, 0x07, 0xc0, 0x11, 0x02, 0x3a, 0x0e, 0x02, 0xb6, 0x0a, 0x06, 0xca, 0x51,
+  0x08, 0xd6, 0x51, 0x04, 0x92, 0x03, 0x02, 0x84, 0x23, 0x02, 0x36, 0x0e, 0x13, 0x36, 0x98, 0xee, 0x04, 0x44, 0x07, 0x04, 0x16, 0x60, 0x02, 0x5c, 0x2e, 0x84, 0x74, 0xbd, 0x70, 0x9c, 0xad, 0x83,
+  0xd5, 0xcd, 0xb0, 0x9c, 0x00, 0xa8, 0x2a, 0x00, 0x50, 0xa7, 0x00, 0x28, 0x2e, 0x00, 0x68, 0x15, 0x11, 0x57, 0xa4, 0x3c, 0x01, 0x58, 0x2e, 0x04, 0xec, 0x38, 0x04, 0x04, 0x00, 0x03, 0xfa, 0x38,
+  0x10, 0xd9, 0x0e, 0x72, 0x10, 0xef, 0x1a, 0x03, 0x00, 0x16, 0xfb, 0x00, 0xdc, 0x3b, 0x01, 0x26, 0x86, 0x10, 0x7c, 0x2e, 0x1c, 0x22, 0xf0, 0x6b, 0x8c, 0x62, 0x00, 0x6a, 0x35, 0x00, 0x80, 0x03,
+  0x00, 0x48, 0x0a, 0x20, 0xd3, 0x84, 0x5e, 0x2e, 0x02, 0x10, 0x15, 0x00, 0xb0, 0x1c, 0x00, 0x42, 0x07, 0x02, 0x3e, 0x23, 0x00, 0xba, 0x54, 0x00, 0xa8, 0x0a, 0x00, 0xae, 0x0a, 0x02, 0x5e, 0x66,
+  0x11, 0x31, 0xb0, 0x54, 0x31, 0x72, 0x7c, 0x92, 0x78, 0x15, 0x00, 0x1c, 0x00, 0x00, 0x02, 0x2b, 0x00, 0x1e, 0x07, 0x13, 0x32, 0x8a, 0x74, 0x02, 0x18, 0x27, 0x00, 0x30, 0x12, 0x30, 0x8f, 0x63,
+  0xf1, 0xe2, 0xec, 0x52, 0x5b, 0x09, 0x32, 0x29, 0x32, 0xf4, 0x5b, 0x20, 0x8f, 0x63, 0x1e, 0x71, 0x02, 0x4e, 0xad, 0x51, 0xf0, 0x73, 0x71, 0x84, 0x8e, 0x80, 0x2a, 0x00, 0xf2, 0x26, 0x20, 0x0b,
+  0x53, 0xaa, 0x31, 0xa0, 0x27, 0x3a, 0x68, 0x42, 0x2f, 0x7c, 0xd2, 0x94, 0x90, 0x8c, 0x1e, 0x6a, 0x11, 0x0f, 0x04, 0x00, 0xe0, 0x0a, 0x5b, 0xca, 0x52, 0xb1, 0x8c, 0x4f, 0x84, 0xed, 0x7b, 0x90,
+  0x8c, 0x0d, 0x7c, 0xc6, 0x46, 0xf1, 0x12, 0xe8, 0x5a, 0x6a, 0x6b, 0xb3, 0xbd, 0x31, 0xad, 0x8f, 0x9c, 0xf0, 0x9c, 0x10, 0xa5, 0x72, 0xad, 0xf0, 0xa4, 0xf0, 0x9c, 0x8f, 0x94, 0x86, 0x4a, 0xe8,
+  0x5a, 0x2d, 0x84, 0xec, 0x7b, 0xac, 0x73, 0x6a, 0x60, 0x4a, 0x60, 0x0d, 0x84, 0xd0, 0x9c, 0x6e, 0x8c, 0xa4, 0x0a, 0x20, 0x2e, 0x8c, 0xe0, 0x46, 0xa0, 0xd1, 0x9c, 0xee, 0x7b, 0x2f, 0x8c, 0xad,
+  0x7b, 0x27, 0x42, 0x8c, 0x31, 0x00, 0x80, 0x23, 0x00, 0x0a, 0x75, 0x20, 0xee, 0x7b, 0xe2, 0x5f, 0x00, 0x3a, 0x5c, 0x31, 0x4b, 0x6b, 0x2a, 0x5c, 0x63, 0x20, 0x2b, 0x6b, 0xda, 0x3f, 0x00, 0xca,
+  0x8d, 0x62, 0x2d, 0x6b, 0x6e, 0x6b, 0xae, 0x73, 0x9a, 0x0a, 0x00, 0x18, 0x07, 0x00, 0x9e, 0x66, 0x00, 0xae, 0x0a, 0x02, 0x08, 0x83, 0x02, 0x8a, 0x7f, 0x02, 0x3e, 0x03, 0x00, 0xe6, 0x11, 0x00,
+  0x6a, 0x58, 0x02, 0xa6, 0x51, 0x01, 0x46, 0x4a, 0x03, 0x18, 0x27, 0x02, 0xca, 0x46, 0x00, 0xbc, 0x86, 0x00, 0x7c, 0x98, 0x12, 0xd3, 0x2a, 0x95, 0x01, 0xa8, 0x15, 0x02, 0x70, 0x27, 0x00, 0x42,
+  0x00, 0x40, 0x93, 0x9c, 0xd3, 0x9c, 0x64, 0x0e, 0x00, 0x54, 0x23, 0x02, 0x98, 0x78, 0x11, 0x10, 0x70, 0x43, 0x11, 0xcf, 0xb6, 0x03, 0x00, 0x26, 0x71, 0x00, 0xf4, 0xa6, 0x02, 0xba, 0xb4, 0x60,
+  0x10, 0x8c, 0xcf, 0x83, 0x51, 0x94, 0x10, 0x07, 0x00, 0xc0, 0x78, 0x00, 0x70, 0x15, 0x00, 0x0a, 0x47, 0x12, 0x31, 0x1e, 0xae, 0x0f, 0x02, 0x00, 0x04, 0x04, 0x56, 0x03, 0x15, 0x71, 0x0e, 0x00,
+  0x1e, 0x71, 0x82, 0x03, 0x0e, 0x38, 0x00, 0x01, 0x88, 0x03, 0x06, 0x02, 0x00, 0x19, 0x71, 0x2e, 0x2e, 0x05, 0xcc, 0x78, 0x02, 0x8a, 0x03, 0x0b, 0xc6, 0x11, 0x0f, 0x90, 0x03, 0x01, 0x0a, 0x2e,
+  0x55, 0x04, 0x22, 0x07, 0x03, 0x00, 0xa0, 0x01, 0x3c, 0xae, 0x19, 0x52, 0xac, 0x0a, 0x06, 0xac, 0x23, 0x15, 0x52, 0x02, 0x07, 0x04, 0xae, 0x4a, 0x13, 0x93, 0x48, 0x35, 0x15, 0x73, 0x2a, 0x07,
+  0x17, 0x73, 0x26, 0x47, 0x02, 0x28, 0x07, 0x06, 0x02, 0x00, 0x06, 0xa2, 0x2a, 0x04, 0xc6, 0x11, 0x00, 0xb6, 0x31, 0x00, 0xf4, 0x78, 0x00, 0x14, 0x07, 0x02, 0x48, 0xe7, 0x04, 0xc4, 0x51, 0x04,
+  0x74, 0xae, 0x04, 0x24, 0x07, 0x20, 0x77, 0xde, 0x28, 0x80, 0x06, 0xe0, 0x11, 0x02, 0x44, 0xe0, 0x02, 0x40, 0x27, 0x22, 0x53, 0xbd, 0x40, 0x87, 0x01, 0x4c, 0x0e, 0x01, 0xa6, 0x43, 0x00, 0x02,
+  0x00, 0x00, 0x10, 0x39, 0x02, 0x7a, 0x1c, 0x04, 0x22, 0x07, 0x02, 0x0c, 0x00, 0x71, 0x4e, 0x53, 0xc8, 0x21, 0xac, 0x3a, 0xd0, 0x50, 0x3c, 0x00, 0x4a, 0x2a, 0x00, 0x78, 0x11, 0x00, 0x30, 0x0e,
+  0x00, 0xd8, 0x06, 0x00, 0x78, 0x0a, 0x00, 0xae, 0x31, 0x11, 0x6e, 0x30, 0x2e, 0x42, 0x8b, 0x3a, 0x4e, 0x53, 0x74, 0x11, 0x00, 0xd2, 0x46, 0x00, 0xac, 0x18, 0x00, 0x14, 0x07, 0x20, 0x51, 0x74,
+  0x4a, 0x31, 0x00, 0x46, 0x2a, 0x00, 0xe6, 0x77, 0x00, 0x0a, 0x00, 0x00, 0xf0, 0x70, 0x40, 0x0c, 0x53, 0xaf, 0x63, 0xd6, 0x23, 0x00, 0xe4, 0x23, 0x00, 0x02, 0x00, 0x71, 0x0d, 0x53, 0x8b, 0x42,
+  0x8b, 0x42, 0x0d, 0xa2, 0xbb, 0x00, 0x06, 0x98, 0x40, 0x8b, 0x42, 0xab, 0x42, 0x34, 0x0e, 0xe0, 0x76, 0x9d, 0x14, 0x8d, 0xec, 0x4a, 0x4a, 0x3a, 0xcc, 0x4a, 0x2d, 0x53, 0xb4, 0x84, 0xc6, 0xa9,
+  0x20, 0x52, 0x7c, 0xd0, 0x03, 0x00, 0x70, 0x1c, 0x62, 0x72, 0x84, 0x31, 0x74, 0x30, 0x74, 0x02, 0x27, 0x00, 0x36, 0x3c, 0xf0, 0x07, 0x6d, 0x63, 0x30, 0x7c, 0xd2, 0x8c, 0x6d, 0x63, 0x0b, 0x53,
+  0x70, 0x84, 0xd2, 0x94, 0x91, 0x8c, 0x50, 0x84, 0xee, 0x73, 0x0b, 0x5b, 0x9e, 0x38, 0x00, 0x0e, 0x71, 0xf0, 0x13, 0xe9, 0x5a, 0x2e, 0x7c, 0xed, 0x7b, 0x4b, 0x63, 0x0d, 0x7c, 0xc8, 0x52, 0x09,
+  0x63, 0xc8, 0x5a, 0xab, 0x73, 0x8a, 0x73, 0x09, 0x63, 0x6e, 0x94, 0x51, 0xad, 0x14, 0xce, 0x8e, 0x94, 0x69, 0x73, 0xc3, 0x39, 0x12, 0x07, 0xb1, 0x8e, 0x8c, 0xd0, 0x9c, 0xc8, 0x5a, 0xcc, 0x7b,
+  0x4e, 0x84, 0x29, 0x80, 0x4a, 0x00, 0x50, 0x15, 0x80, 0x09, 0x63, 0xa8, 0x52, 0x4e, 0x8c, 0x4b, 0x6b, 0x7a, 0x03, 0x00, 0x8c, 0x0a, 0x00, 0x16, 0x5c, 0x20, 0xee, 0x83, 0x84, 0x03, 0x00, 0xd6,
+  0x18, 0x00, 0x5a, 0x43, 0x30, 0x6c, 0x6b, 0x8c, 0xca, 0x31, 0x10, 0x73, 0x88, 0x03, 0x00, 0x96, 0x03, 0x00, 0xe0, 0x18, 0x00, 0x38, 0x0e, 0x73, 0x6d, 0x73, 0xef, 0x83, 0x30, 0x84, 0x92, 0x86,
+  0xb4, 0x02, 0x4e, 0x38, 0x02, 0x36, 0x38, 0x00, 0x06, 0x03, 0x02, 0x76, 0x38, 0x11, 0xf4, 0x88, 0x7f, 0x04, 0xfe, 0x7b, 0x00, 0xb0, 0x66, 0x11, 0xd0, 0xc2, 0x26, 0x04, 0x0a, 0x6e, 0x10, 0x72,
+  0xa0, 0x4a, 0x12, 0x9c, 0x56, 0xcd, 0x00, 0x58, 0x03, 0x64, 0xd0, 0x83, 0xd0, 0x83, 0xaf, 0x7b, 0x90, 0x98, 0x00, 0x22, 0x12, 0x00, 0xb6, 0x58, 0x02, 0x0a, 0x0b, 0x61, 0xcf, 0x83, 0xaf, 0x7b,
+  0x4d, 0x73, 0x58, 0x6e, 0x01, 0xb4, 0x98, 0x00, 0xb2, 0x03, 0x02, 0xf2, 0x0a, 0x60, 0x72, 0x94, 0x30, 0x8c, 0x92, 0x9c, 0x28, 0x07, 0xc0, 0xef, 0x83, 0xcf, 0x83, 0xf0, 0x8b, 0xcf, 0x83, 0xef,
+  0x83, 0x10, 0x8c, 0x06, 0x00, 0x20, 0x92, 0x9c, 0x18, 0x00, 0x60, 0x10, 0x8c, 0xb7, 0xbd, 0xf4, 0xa4, 0x08, 0xc0, 0x0a, 0x48, 0x03, 0x0a, 0x10, 0x00, 0x1d, 0x51, 0x90, 0x03, 0x1f, 0x71, 0x5e,
+  0x15, 0x0f, 0x01, 0x4a, 0x15, 0x04, 0xaa, 0x0a, 0x1b, 0x92, 0xa8, 0x0a, 0x1d, 0x70, 0xa0, 0xaa, 0x0e, 0x82, 0x63, 0x0a, 0x1e, 0x07, 0x0c, 0x0a, 0x87, 0x04, 0x62, 0x1c, 0x09, 0x60, 0x3c, 0x07,
+  0x4c, 0x55, 0x02, 0x30, 0x07, 0x02, 0xe4, 0x58, 0x00, 0x4e, 0x35, 0x08, 0x3e, 0x4e, 0x15, 0x93, 0x5c, 0x15, 0x04, 0x78, 0x1c, 0x24, 0x53, 0xbd, 0xbc, 0x11, 0x04, 0xb2, 0x0a, 0x0e, 0x1e, 0x07,
+  0x06, 0xf0, 0x38, 0x00, 0x70, 0x15, 0x00, 0x3c, 0x0e, 0x00, 0x84, 0x9c, 0x04, 0x64, 0x95, 0x02, 0x92, 0x03, 0x02, 0xc4, 0xe3, 0x02, 0xc0, 0xe3, 0x04, 0xbc, 0x0a, 0x02, 0x22, 0x60, 0x20, 0x53,
+  0xbd, 0x56, 0x2e, 0x00, 0x16, 0x27, 0x00, 0xc4, 0x9c, 0x02, 0x64, 0x4e, 0x02, 0xaa, 0x43, 0x02, 0x74, 0x03, 0x00, 0x7e, 0x03, 0x00, 0x8c, 0x75, 0x11, 0xd9, 0x9e, 0x0a, 0x02, 0xa4, 0xb5, 0x20,
+  0x98, 0xde, 0xae, 0x0a, 0xc0, 0x1a, 0xef, 0x3a, 0xf7, 0xb4, 0xc5, 0x2d, 0x4b, 0x31, 0x6c, 0xb3, 0x7c, 0x4e, 0x11, 0x20, 0xaf, 0x5b, 0xf8, 0x26, 0x31, 0xec, 0x42, 0x2d, 0xa6, 0x0a, 0x02, 0x80,
+  0x03, 0x00, 0x52, 0x74, 0x02, 0x1a, 0x43, 0x00, 0xb4, 0x0a, 0x00, 0x0c, 0x15, 0x00, 0xcc, 0x2a, 0x20, 0xcf, 0x63, 0x4e, 0x27, 0x40, 0xcb, 0x42, 0x0d, 0x53, 0x08, 0x07, 0x11, 0xb3, 0x92, 0x4a,
+  0x00, 0xd6, 0x54, 0x40, 0x8e, 0x63, 0x6d, 0x5b, 0x38, 0x5f, 0x31, 0x2c, 0x53, 0xef, 0xb8, 0x54, 0x40, 0xaa, 0x42, 0x6a, 0x3a, 0x62, 0x0e, 0x40, 0xec, 0x4a, 0xcc, 0x4a, 0x32, 0xdb, 0x00, 0xde,
+  0x0a, 0x20, 0x31, 0x74, 0xda, 0xb7, 0x11, 0x32, 0xb4, 0x35, 0x21, 0x6f, 0x5b, 0x12, 0x0b, 0x70, 0x63, 0x51, 0x74, 0x92, 0x7c, 0x52, 0x7c, 0x50, 0xad, 0x80, 0x52, 0x7c, 0xf4, 0x8c, 0x72, 0x84,
+  0x52, 0x7c, 0x26, 0xcd, 0x00, 0xc0, 0xd7, 0x60, 0x0c, 0x53, 0xef, 0x73, 0x71, 0x7c, 0xc6, 0x7b, 0x40, 0xef, 0x73, 0xef, 0x73, 0x3a, 0x0e, 0x00, 0xaa, 0x38, 0x04, 0x26, 0x0e, 0x80, 0x6c, 0x6b,
+  0xca, 0x52, 0x0a, 0x5b, 0xac, 0x73, 0x14, 0x43, 0x20, 0x8f, 0x8c, 0x6a, 0x31, 0x00, 0xca, 0x1f, 0x20, 0x4e, 0x8c, 0xfc, 0x5b, 0xf0, 0x21, 0x29, 0x6b, 0x6e, 0x94, 0xac, 0x7b, 0xe4, 0x41, 0xcb,
+  0x83, 0x8e, 0x9c, 0xd3, 0xc5, 0xd3, 0xc5, 0x10, 0xa5, 0xf3, 0xc5, 0x0c, 0x84, 0x69, 0x6b, 0xab, 0x73, 0x0c, 0x84, 0x87, 0x52, 0x25, 0x42, 0x66, 0x4a, 0x6a, 0x6b, 0xc8, 0x5a, 0xe5, 0x39, 0xc8,
+  0x5a, 0x2a, 0x63, 0xa8, 0x5a, 0x0a, 0x63, 0x0e, 0x2e, 0x10, 0x4b, 0xc4, 0x8d, 0x30, 0x63, 0x90, 0x94, 0x06, 0x00, 0x00, 0x18, 0x27, 0x40, 0x8c, 0x73, 0x70, 0x8c, 0x6a, 0x71, 0x00, 0xca, 0x11,
+  0x00, 0xa0, 0xa6, 0x40, 0x89, 0x52, 0x6c, 0x73, 0x98, 0x51, 0x13, 0x50, 0x94, 0x0a, 0x00, 0x08, 0x03, 0x02, 0x16, 0x0e, 0x02, 0x58, 0x18, 0x01, 0x2a, 0x78, 0x01, 0x7a, 0x86, 0x02, 0xd2, 0x74,
+  0x01, 0x76, 0x03, 0x03, 0xde, 0xc2, 0x03, 0x94, 0x58, 0x00, 0xa0, 0x03, 0x01, 0xac, 0x86, 0x02, 0x18, 0x20, 0x02, 0x00, 0x35, 0x82, 0xcf, 0x7b, 0x0d, 0x63, 0x4d, 0x6b, 0x4e, 0x6b, 0xea, 0x11,
+  0x00, 0x38, 0x00, 0x11, 0x92, 0x1e, 0x15, 0x02, 0xac, 0x18, 0x30, 0x6e, 0x73, 0xf0, 0x64, 0x03, 0x21, 0x83, 0x71, 0x4e, 0x1c, 0x00, 0x14, 0x00, 0x40, 0xd3, 0xa4, 0x92, 0x9c, 0x24, 0x12, 0x90,
+  0xf4, 0xa4, 0x55, 0xb5, 0x51, 0x94, 0xcf, 0x83, 0xcf, 0xa8, 0x7c, 0x12, 0x83, 0xa2, 0xd1, 0x31, 0x72, 0x9c, 0x51, 0xe8, 0xbf, 0x00, 0x6a, 0x03, 0x40, 0xb2, 0xa4, 0x92, 0x9c, 0xd8, 0x11, 0x20,
+  0x14, 0xad, 0x2a, 0x4e, 0x10, 0x8e, 0x3e, 0x4e, 0x13, 0x9c, 0x5c, 0x1c, 0x01, 0x02, 0x00, 0x0a, 0xe6, 0x06, 0x06, 0x26, 0x07, 0x08, 0x94, 0x03, 0x1d, 0x72, 0xda, 0x0a, 0x0d, 0xb8, 0x0a, 0x03,
+  0x68, 0x1c, 0x03, 0x98, 0x03, 0x0e, 0x38, 0x0e, 0x07, 0x8e, 0x23, 0x18, 0xd1, 0x38, 0x0e, 0x0d, 0x4c, 0x55, 0x0a, 0x6e, 0x3c, 0x1c, 0x12, 0x20, 0x4e, 0x06, 0x16, 0x87, 0x03, 0x62, 0x5c, 0x14,
+  0x73, 0xf6, 0x3f, 0x03, 0x38, 0x2e, 0x15, 0x52, 0xc6, 0x51, 0x11, 0x93, 0x02, 0x00, 0x04, 0x7c, 0x03, 0x06, 0x52, 0x35, 0x06, 0x62, 0x1c, 0x02, 0x72, 0xb5, 0x0e, 0x82, 0x5c, 0x1b, 0xf5, 0xb6,
+  0x0a, 0x04, 0x00, 0x80, 0x04, 0x98, 0x5c, 0x04, 0xae, 0x23, 0x04, 0xbc, 0x8a, 0x02, 0xc6, 0x11, 0x02, 0x8a, 0x9c, 0x42, 0xf5, 0xcd, 0xb8, 0xe6, 0xa4, 0x23, 0x02, 0x26, 0x60, 0x00, 0x20, 0x00,
+  0x21, 0xd9, 0xee, 0xde, 0x38, 0x03, 0xca, 0x11, 0x20, 0x16, 0xce, 0x74, 0x1c, 0x00, 0x36, 0x07, 0x11, 0xb9, 0x0e, 0x39, 0x00, 0x34, 0x60, 0x00, 0x0e, 0x20, 0x00, 0xae, 0x0a, 0x00, 0xba, 0x87,
+  0x20, 0x8c, 0x7b, 0x82, 0xf0, 0x00, 0xfc, 0x54, 0x10, 0x4e, 0xba, 0x31, 0x10, 0x42, 0x3c, 0x0e, 0x02, 0x92, 0x46, 0x20, 0x6e, 0x53, 0x70, 0x11, 0x31, 0xac, 0x42, 0xaf, 0x6e, 0x43, 0x00, 0x6c,
+  0x0a, 0x11, 0x11, 0x6e, 0x74, 0x00, 0x94, 0x74, 0x11, 0x52, 0x1e, 0x55, 0x00, 0xdc, 0x5b, 0x20, 0x31, 0x74, 0xf6, 0x69, 0x20, 0x2c, 0x4b, 0x4e, 0x23, 0x00, 0x84, 0x2e, 0x00, 0x88, 0x6d, 0x40,
+  0x6d, 0x5b, 0x8a, 0x3a, 0x6c, 0x3c, 0x00, 0xf6, 0x23, 0x80, 0x71, 0x7c, 0x51, 0x74, 0x0d, 0x53, 0x4e, 0x5b, 0x04, 0x07, 0x00, 0xa8, 0x11, 0x00, 0x14, 0x2e, 0x11, 0xd0, 0x9c, 0x38, 0x00, 0x8a,
+  0x03, 0x11, 0x4e, 0x9e, 0x0a, 0x42, 0x4e, 0x5b, 0xcc, 0x4a, 0xfe, 0x4d, 0x53, 0xd4, 0x8c, 0x55, 0x9d, 0xf0, 0xa6, 0x0a, 0x00, 0x0a, 0x4e, 0x20, 0x30, 0x7c, 0x44, 0x1c, 0x40, 0xce, 0x6b, 0xeb,
+  0x52, 0x38, 0x0e, 0xf0, 0x01, 0xee, 0x73, 0x2f, 0x7c, 0x2f, 0x7c, 0xad, 0x73, 0xb1, 0x94, 0x70, 0x84, 0x2b, 0x63, 0x8d, 0x6b, 0xbe, 0x2d, 0x60, 0x0e, 0x7c, 0xe9, 0x5a, 0x09, 0x5b, 0x62, 0x31,
+  0xf0, 0x23, 0xf0, 0x9c, 0x4a, 0x63, 0x6a, 0x6b, 0x0d, 0x84, 0xf0, 0x9c, 0x8e, 0x94, 0x6e, 0x8c, 0xaf, 0x9c, 0xac, 0x7b, 0xec, 0x83, 0x8b, 0x7b, 0xb0, 0x9c, 0xf0, 0xa4, 0x4d, 0x94, 0x6d, 0x94,
+  0x6e, 0x94, 0x6e, 0x94, 0x45, 0x4a, 0xaf, 0x9c, 0xaf, 0x94, 0x29, 0x63, 0x25, 0x42, 0x6e, 0x8c, 0xd0, 0x9c, 0xd0, 0x94, 0xbe, 0x31, 0x00, 0xca, 0x6d, 0x00, 0xb6, 0x86, 0x31, 0xac, 0x7b, 0xcd,
+  0x72, 0x4a, 0x93, 0x88, 0x52, 0x6b, 0x6b, 0x68, 0x4a, 0x4b, 0x6b, 0x6c, 0x82, 0x78, 0x20, 0x89, 0x52, 0x8a, 0x23, 0x20, 0x30, 0x84, 0x44, 0xc6, 0x00, 0xaa, 0x58, 0x00, 0x5e, 0x91, 0x00, 0x2e,
+  0x0e, 0x02, 0xee, 0x9b, 0x40, 0xaf, 0x7b, 0x4e, 0x6b, 0x88, 0x51, 0x00, 0xf8, 0x06, 0x02, 0x0e, 0x1c, 0x00, 0x08, 0x43, 0x00, 0x7a, 0x38, 0x01, 0xdc, 0x26, 0x02, 0x5a, 0x3f, 0x10, 0x84, 0x18,
+  0x07, 0x03, 0xe8, 0x11, 0x01, 0xf8, 0x06, 0x02, 0xd4, 0x0a, 0x02, 0x76, 0x71, 0x02, 0x30, 0x15, 0x00, 0x4e, 0x07, 0x20, 0x14, 0xa5, 0x0c, 0x19, 0x55, 0x52, 0x94, 0x93, 0x9c, 0xb3, 0x54, 0x51,
+  0x11, 0xef, 0x1a, 0x00, 0x01, 0x7a, 0xb1, 0x00, 0x42, 0x19, 0x01, 0xaa, 0x15, 0x20, 0x92, 0x94, 0x44, 0xbc, 0x81, 0x31, 0x8c, 0xf4, 0xa4, 0x51, 0x94, 0x30, 0x8c, 0x88, 0x51, 0x11, 0x94, 0xae,
+  0xb8, 0x01, 0xa6, 0x0a, 0x40, 0xf0, 0x8b, 0x8e, 0x7b, 0x06, 0x07, 0x11, 0x30, 0x94, 0x03, 0x20, 0x10, 0x8c, 0x8e, 0x03, 0x62, 0x55, 0xb5, 0xd7, 0xc5, 0x76, 0xbd, 0x34, 0x03, 0x1e, 0x10, 0xe8,
+  0x18, 0x0e, 0xb8, 0x0a, 0x0d, 0x24, 0x07, 0x0e, 0x3e, 0x0e, 0x1a, 0x71, 0x3e, 0x0e, 0x07, 0x4a, 0x35, 0x15, 0x91, 0x8e, 0x03, 0x0f, 0xfa, 0x3f, 0x01, 0x1b, 0xd1, 0xfe, 0xc6, 0x0e, 0x3a, 0x0e,
+  0x0b, 0x8e, 0x43, 0x07, 0xc8, 0x51, 0x04, 0xa6, 0x23, 0x13, 0x52, 0x7a, 0x23, 0x06, 0x5a, 0x15, 0x04, 0xaa, 0x03, 0x16, 0x52, 0xc2, 0x31, 0x06, 0x68, 0x3c, 0x07, 0xc8, 0x31, 0x04, 0x90, 0x03,
+  0x04, 0x0c, 0x00, 0x2c, 0x53, 0xbd, 0x1a, 0x07, 0x06, 0xca, 0x11, 0x06, 0x90, 0x03, 0x40, 0x77, 0xde, 0x2a, 0x73, 0x56, 0xae, 0x02, 0x40, 0x0e, 0x00, 0x8e, 0x03, 0x00, 0xf4, 0x06, 0x04, 0xac,
+  0x0a, 0x02, 0x46, 0x0e, 0x00, 0x36, 0xab, 0x02, 0x34, 0x67, 0x04, 0x68, 0xce, 0x11, 0x98, 0x24, 0xa0, 0x22, 0xd9, 0xee, 0x80, 0x4e, 0x11, 0xb8, 0xd4, 0x11, 0x00, 0x54, 0x0e, 0x00, 0x08, 0xf6,
+  0x20, 0x78, 0xde, 0x6e, 0x60, 0x00, 0x7e, 0x15, 0x11, 0xb9, 0x38, 0x0e, 0x00, 0x36, 0x00, 0x82, 0xfa, 0xee, 0x94, 0xbd, 0x2f, 0x94, 0x77, 0xde, 0x0a, 0x4a, 0x40, 0x2e, 0x53, 0x6e, 0x53, 0x28,
+  0x4a, 0x20, 0xec, 0x42, 0x8e, 0x03, 0x40, 0xed, 0x4a, 0xe8, 0x21, 0x88, 0x23, 0x10, 0x2d, 0xd2, 0x31, 0x01, 0xd6, 0x11, 0x30, 0xcc, 0x42, 0xec, 0x6a, 0xa2, 0x01, 0x04, 0xc6, 0x30, 0xcc, 0x42,
+  0xf0, 0xca, 0x69, 0x10, 0x63, 0x50, 0x23, 0x00, 0xd0, 0x26, 0x00, 0x46, 0x3c, 0x00, 0x4e, 0x03, 0x00, 0x3e, 0x0e, 0x40, 0x2c, 0x4b, 0x6a, 0x3a, 0x68, 0x3c, 0x00, 0x62, 0x0e, 0x00, 0xf4, 0x26,
+  0x10, 0xef, 0x66, 0xf0, 0x10, 0x4b, 0x26, 0x12, 0x00, 0x96, 0x2a, 0x00, 0x16, 0x00, 0x00, 0x96, 0x03, 0x00, 0x46, 0x71, 0x20, 0xcb, 0x42, 0x46, 0x40, 0x00, 0x60, 0x07, 0x11, 0x15, 0x3e, 0x2e,
+  0x20, 0x10, 0x74, 0x4a, 0x35, 0x00, 0x96, 0x5f, 0xa0, 0x10, 0x74, 0xb2, 0x8c, 0x51, 0x7c, 0x0b, 0x53, 0xae, 0x63, 0x50, 0x4a, 0x20, 0xd2, 0x8c, 0x68, 0x51, 0x00, 0x3a, 0x15, 0x60, 0xb1, 0x8c,
+  0xee, 0x73, 0x0e, 0x7c, 0x4c, 0x2a, 0xf2, 0x0b, 0x46, 0x42, 0x6f, 0x8c, 0x32, 0xa5, 0xd1, 0x94, 0x73, 0xad, 0x36, 0xc6, 0x4a, 0x6b, 0xe4, 0x39, 0x87, 0x52, 0xec, 0x7b, 0x49, 0x63, 0xec, 0x7b,
+  0xaf, 0x94, 0x34, 0x43, 0x40, 0xcc, 0x7b, 0x4a, 0x6b, 0x48, 0x71, 0xf0, 0x0b, 0x0d, 0x84, 0xec, 0x83, 0x8a, 0x73, 0x4d, 0x8c, 0xaa, 0x7b, 0xaa, 0x7b, 0x2d, 0x8c, 0xae, 0x9c, 0x69, 0x6b, 0xab,
+  0x7b, 0xe8, 0x5a, 0x09, 0x63, 0x66, 0x4a, 0x50, 0x15, 0x00, 0x0c, 0xaa, 0x11, 0x0e, 0xb4, 0x5f, 0x20, 0x6b, 0x73, 0xb4, 0x0a, 0x80, 0xcd, 0x7b, 0xd1, 0x9c, 0xf2, 0x9c, 0x8c, 0x73, 0x5e, 0x15,
+  0x20, 0x2b, 0x63, 0xd8, 0x8d, 0x40, 0x91, 0x94, 0xca, 0x5a, 0x08, 0x91, 0x40, 0xeb, 0x5a, 0xaa, 0x52, 0x0c, 0x0e, 0x11, 0x10, 0x28, 0x55, 0x42, 0x8e, 0x73, 0xec, 0x5a, 0x98, 0x78, 0x60, 0x2d,
+  0x63, 0x6e, 0x73, 0x8f, 0x73, 0xaa, 0x0a, 0x02, 0x18, 0xa3, 0x11, 0x31, 0x2a, 0x3c, 0x02, 0x9e, 0x78, 0x00, 0x5e, 0x35, 0x00, 0x78, 0x8a, 0x11, 0x2d, 0xd8, 0x18, 0x02, 0x20, 0x6e, 0x00, 0xbc,
+  0x03, 0x22, 0x2d, 0x63, 0x3c, 0x00, 0x00, 0x5a, 0x1c, 0x02, 0x14, 0x19, 0x01, 0x92, 0x23, 0x03, 0x78, 0x1c, 0x01, 0x00, 0x80, 0x01, 0xcc, 0x0a, 0x00, 0x96, 0x03, 0x11, 0x31, 0x7e, 0xb1, 0x00,
+  0x14, 0x00, 0x13, 0xef, 0xc8, 0x11, 0x10, 0xef, 0x98, 0x0e, 0x00, 0xfc, 0x03, 0x02, 0xd6, 0x18, 0x10, 0x73, 0x36, 0xdc, 0x00, 0x98, 0x03, 0x00, 0xa8, 0x0a, 0xb0, 0xce, 0x83, 0x71, 0x9c, 0x0f,
+  0x8c, 0xb2, 0xa4, 0x55, 0xb5, 0x71, 0x66, 0x1c, 0x90, 0x94, 0x72, 0x9c, 0x8e, 0x7b, 0x10, 0x8c, 0x55, 0xb5, 0x10, 0x00, 0x20, 0x8e, 0x7b, 0xac, 0x95, 0x17, 0x10, 0x3e, 0x0e, 0x10, 0x71, 0x5a,
+  0x00, 0x09, 0x32, 0x0e, 0x06, 0x80, 0x03, 0x01, 0xe2, 0x06, 0x07, 0x50, 0x0e, 0x08, 0xba, 0x0a, 0x02, 0x0a, 0x00, 0x06, 0x16, 0x00, 0x02, 0x3e, 0x55, 0x09, 0xc2, 0x11, 0x03, 0x6a, 0x1c, 0x06,
+  0x8e, 0x03, 0x08, 0xcc, 0x78, 0x03, 0xd4, 0xd8, 0x05, 0x4a, 0x55, 0x08, 0x20, 0x07, 0x17, 0x32, 0xf6, 0x66, 0x02, 0xe0, 0x7f, 0x04, 0xb4, 0x2a, 0x04, 0x68, 0x3c, 0x04, 0x78, 0xdc, 0x06, 0x52,
+  0xae, 0x06, 0x1c, 0x27, 0x02, 0x54, 0x55, 0x24, 0x94, 0xc5, 0xf4, 0x3f, 0x04, 0xfe, 0x5f, 0x15, 0xb4, 0x88, 0x43, 0x04, 0x10, 0x20, 0x02, 0xb0, 0x4a, 0x02, 0x4c, 0x15, 0x02, 0xaa, 0x63, 0x04,
+  0x26, 0x07, 0x06, 0x12, 0x20, 0x04, 0xf4, 0x3f, 0x00, 0x0c, 0x00, 0x00, 0x72, 0x2e, 0x04, 0x56, 0x15, 0x11, 0xb4, 0xa6, 0x0a, 0x11, 0xb5, 0xba, 0xa3, 0x04, 0x0a, 0x47, 0x04, 0x30, 0x79, 0x02,
+  0x7c, 0x5c, 0x11, 0x77, 0xb6, 0x4a, 0x02, 0xcc, 0x31, 0x00, 0xf8, 0x18, 0x02, 0x42, 0x4e, 0x03, 0xe6, 0x18, 0x10, 0xde, 0x54, 0x20, 0x00, 0x80, 0x35, 0x42, 0x3b, 0xf7, 0x98, 0xde, 0x4c, 0xa0,
+  0x40, 0x1a, 0xef, 0x37, 0xd6, 0xc0, 0x0a, 0x11, 0x57, 0xb8, 0x43, 0x00, 0x74, 0x03, 0x51, 0x2e, 0x53, 0xaf, 0x5b, 0x2e, 0x0e, 0x35, 0x02, 0x0e, 0x5c, 0x20, 0x11, 0x6c, 0x20, 0x27, 0x11, 0x72,
+  0x1e, 0x5c, 0x11, 0x31, 0xbc, 0x4d, 0x20, 0xaf, 0x5b, 0xd2, 0x0a, 0x00, 0x90, 0x23, 0x00, 0xca, 0x2a, 0x20, 0x2d, 0x53, 0xce, 0x1f, 0x00, 0x56, 0x03, 0x11, 0x8e, 0x62, 0x27, 0x31, 0xae, 0x63,
+  0x8e, 0xc2, 0x0a, 0x02, 0x3e, 0x0e, 0x11, 0x4e, 0x3c, 0x0e, 0x00, 0xf2, 0x3f, 0xa0, 0x08, 0x2a, 0x08, 0x2a, 0x4e, 0x53, 0xf0, 0x6b, 0xd3, 0x84, 0x30, 0x32, 0x40, 0x0c, 0x4b, 0xe4, 0x08, 0x08,
+  0x47, 0x00, 0x9a, 0x31, 0x13, 0x52, 0xc4, 0x1c, 0x20, 0xcf, 0x6b, 0xc8, 0xa9, 0x11, 0xaf, 0xb0, 0xfe, 0x00, 0x66, 0xe2, 0x00, 0x6a, 0x1c, 0xb1, 0x92, 0x84, 0x4c, 0x5b, 0xcb, 0x4a, 0x91, 0x84,
+  0xb1, 0x84, 0x50, 0x6a, 0x86, 0x00, 0x6c, 0x1c, 0x20, 0x90, 0x84, 0xea, 0x26, 0x80, 0xcd, 0x73, 0xa8, 0x52, 0xed, 0x73, 0xcc, 0x73, 0x96, 0x6d, 0xa0, 0x09, 0x5b, 0xed, 0x7b, 0xcc, 0x73, 0x01,
+  0x19, 0x6a, 0x6b, 0x16, 0x63, 0xf1, 0x05, 0x6e, 0x8c, 0xf0, 0x9c, 0x2d, 0x84, 0x8f, 0x94, 0xec, 0x7b, 0x6a, 0x6b, 0x87, 0x52, 0x09, 0x63, 0xa7, 0x52, 0x6a, 0x6b, 0xa6, 0x5f, 0xf0, 0x0a, 0x7b,
+  0xcb, 0x7b, 0xc7, 0x5a, 0xcb, 0x7b, 0x51, 0xad, 0xf0, 0x9c, 0xf0, 0xa4, 0x31, 0xa5, 0xaf, 0x9c, 0xf0, 0x9c, 0x32, 0xad, 0xb0, 0x9c, 0x20, 0x00, 0x16, 0xaa, 0x00, 0x66, 0x71, 0x22, 0x0e, 0x84,
+  0x48, 0x63, 0x80, 0xa9, 0x5a, 0xea, 0x62, 0x68, 0x4a, 0xca, 0x5a, 0xc4, 0x18, 0x00, 0xaa, 0xad, 0x00, 0x08, 0x55, 0x00, 0xb0, 0x11, 0x50, 0x6d, 0x6b, 0x10, 0x84, 0xcf, 0xcc, 0x8d, 0x12, 0x7c,
+  0xa4, 0x66, 0x02, 0xa0, 0x2d, 0x17, 0x72, 0xa8, 0x74, 0x13, 0x10, 0x96, 0x6d, 0x00, 0x32, 0x15, 0x11, 0x72, 0x52, 0x23, 0x00, 0x32, 0x00, 0x00, 0x46, 0x0e, 0x11, 0xb2, 0x5a, 0x0e, 0x00, 0x64,
+  0x0a, 0x11, 0xd3, 0xb8, 0x26, 0x11, 0x6e, 0x26, 0x35, 0x02, 0x64, 0x31, 0x11, 0x72, 0x54, 0x27, 0x00, 0xfa, 0x14, 0x02, 0xbc, 0x9f, 0x20, 0x8e, 0x73, 0x78, 0x0a, 0x60, 0xef, 0x83, 0x72, 0x94,
+  0xf3, 0xa4, 0xae, 0x0a, 0x11, 0xef, 0x46, 0x0e, 0xf0, 0x01, 0xaf, 0x7b, 0x8e, 0x73, 0xae, 0x7b, 0xef, 0x83, 0xae, 0x7b, 0xaf, 0x7b, 0x8e, 0x7b, 0xaf, 0x7b, 0x76, 0xca, 0x13, 0x30, 0xfa, 0x06,
+  0x00, 0x60, 0x03, 0x02, 0x30, 0x0e, 0x20, 0x10, 0x8c, 0xb6, 0x0a, 0x00, 0x10, 0x00, 0x22, 0x50, 0x94, 0xaa, 0x03, 0x10, 0xae, 0x40, 0x00, 0xb2, 0x83, 0xd3, 0xa4, 0xb7, 0xc5, 0x59, 0xd6, 0x75,
+  0xb5, 0xd3, 0xa4, 0xbe, 0x06, 0x17, 0x92, 0x68, 0x03, 0x0c, 0xc8, 0x11, 0x0e, 0x0a, 0x00, 0x06, 0x9e, 0x03, 0x06, 0x22, 0x0e, 0x0f, 0x02, 0x00, 0x02, 0x03, 0x22, 0x6e, 0x02, 0x4e, 0x15, 0x08,
+  0x90, 0x03, 0x1f, 0xb0, 0x7e, 0xa3, 0x04, 0x06, 0xa0, 0xd1, 0x0a, 0x0c, 0x67, 0x0a, 0xc0, 0x11, 0x04, 0x90, 0x23, 0x07, 0x12, 0x47, 0x04, 0xce, 0x11, 0x07, 0xd2, 0x58, 0x0a, 0xec, 0x98, 0x15,
+  0x94, 0x42, 0x6e, 0x02, 0xbe, 0x11, 0x00, 0x7c, 0xaa, 0x06, 0x10, 0x00, 0x15, 0xb4, 0x3a, 0x0e, 0x04, 0x90, 0x83, 0x06, 0x94, 0x0a, 0x08, 0x22, 0x07, 0x02, 0x98, 0x0a, 0x00, 0x20, 0x0e, 0x02,
+  0xd4, 0x0a, 0x00, 0xcc, 0x18, 0x02, 0xf4, 0x18, 0x00, 0x3c, 0x00, 0x04, 0x22, 0x07, 0x00, 0x96, 0x03, 0x02, 0xc0, 0x11, 0x06, 0xc6, 0xc3, 0x02, 0xce, 0xfc, 0x11, 0x77, 0x8e, 0x7c, 0x00, 0x98,
+  0x9c, 0x13, 0x77, 0xae, 0x11, 0x02, 0x56, 0x15, 0x00, 0xfc, 0x1f, 0x02, 0xaa, 0x2a, 0x00, 0xc0, 0x2a, 0x11, 0xb8, 0x90, 0x23, 0x02, 0x88, 0x75, 0x31, 0x1a, 0xf7, 0x57, 0x04, 0x72, 0x40, 0x32,
+  0xb5, 0x8f, 0x5b, 0xe2, 0x42, 0x22, 0xec, 0x42, 0xcc, 0x3f, 0x71, 0xaf, 0x63, 0x2e, 0x53, 0x4a, 0x32, 0x6f, 0xc2, 0x0a, 0x02, 0x88, 0x6d, 0x11, 0xec, 0x80, 0x5f, 0x12, 0x8f, 0xd4, 0x51, 0x01,
+  0xcc, 0x46, 0x02, 0xb8, 0x03, 0x00, 0xf2, 0x31, 0x00, 0x26, 0x07, 0x00, 0x84, 0x15, 0x00, 0x20, 0x7f, 0x20, 0xcc, 0x4a, 0x7a, 0x4a, 0xc0, 0x4a, 0x32, 0x09, 0x2a, 0xab, 0x42, 0x09, 0x2a, 0xd0,
+  0x63, 0x56, 0x95, 0x1a, 0x00, 0x00, 0xd8, 0x31, 0x00, 0xec, 0x0a, 0x61, 0x09, 0x2a, 0x25, 0x11, 0x0d, 0x53, 0xaa, 0x5f, 0x70, 0x63, 0x35, 0x95, 0x51, 0x7c, 0xaf, 0x63, 0x02, 0x19, 0x40, 0x29,
+  0x32, 0x0d, 0x53, 0x30, 0x27, 0x31, 0x0c, 0x53, 0xaf, 0x8e, 0x03, 0x50, 0x72, 0x84, 0x31, 0x7c, 0x8e, 0x0a, 0x7c, 0x50, 0x5b, 0xb2, 0x8c, 0xd2, 0x8c, 0x6c, 0x1c, 0x60, 0x8d, 0x6b, 0xa9, 0x4a,
+  0x0b, 0x5b, 0x9c, 0x94, 0x20, 0xad, 0x6b, 0xe8, 0x4d, 0x00, 0x3a, 0x03, 0x40, 0xb0, 0x94, 0xcc, 0x73, 0x46, 0x1c, 0x30, 0xc8, 0x5a, 0x6b, 0x74, 0x58, 0x10, 0x6b, 0x84, 0x03, 0xf0, 0x07, 0xcb,
+  0x7b, 0x8a, 0x6b, 0x8a, 0x73, 0x66, 0x52, 0x6a, 0x6b, 0x4a, 0x6b, 0xa7, 0x52, 0x2e, 0x84, 0x0d, 0x84, 0x09, 0x63, 0x8b, 0x73, 0x20, 0x00, 0x00, 0x2c, 0x63, 0x00, 0x80, 0x23, 0xf0, 0x05, 0xab,
+  0x73, 0x87, 0x52, 0x2e, 0x8c, 0x0d, 0x84, 0x4e, 0x8c, 0xac, 0x7b, 0x67, 0x52, 0x53, 0xad, 0xd5, 0xbd, 0x22, 0x21, 0x10, 0x07, 0x40, 0xc9, 0x5a, 0xcd, 0x7b, 0xd4, 0x18, 0x71, 0x88, 0x52, 0xcd,
+  0x7b, 0x70, 0x8c, 0xf2, 0xd8, 0x6d, 0x51, 0xca, 0x5a, 0x8e, 0x73, 0x4c, 0x30, 0xd1, 0x22, 0x51, 0x8c, 0xe8, 0x94, 0x02, 0xe6, 0x14, 0x13, 0x10, 0x0c, 0x7c, 0x02, 0x1c, 0x55, 0x12, 0xcf, 0xf4,
+  0x6d, 0x01, 0x20, 0x71, 0x02, 0x16, 0x8a, 0x11, 0x10, 0x6a, 0x43, 0x22, 0x6e, 0x73, 0x94, 0xbf, 0x11, 0x30, 0x48, 0x43, 0x12, 0x51, 0xee, 0x2d, 0x01, 0x22, 0x07, 0x00, 0x7e, 0x11, 0x00, 0xc0,
+  0x18, 0x11, 0x11, 0xc0, 0x18, 0x11, 0x11, 0x08, 0x20, 0x00, 0x5c, 0x00, 0x00, 0x08, 0xd5, 0x00, 0x92, 0x11, 0x00, 0x12, 0x0a, 0x02, 0x38, 0x27, 0x02, 0x22, 0x07, 0x00, 0x1c, 0x12, 0x40, 0xf3,
+  0xa4, 0xd3, 0xa4, 0x90, 0x06, 0x00, 0x50, 0x67, 0x00, 0x3c, 0xbc, 0x00, 0x72, 0xca, 0x02, 0x96, 0x03, 0x00, 0x5c, 0x03, 0x21, 0x34, 0xad, 0x20, 0xd5, 0x01, 0x72, 0x1c, 0x00, 0xdc, 0xbf, 0x40,
+  0x75, 0xbd, 0x30, 0x8c, 0x38, 0x0e, 0x00, 0x34, 0x0e, 0x00, 0x9c, 0xea, 0x20, 0xb7, 0xc5, 0x8a, 0x40, 0x11, 0x50, 0xf0, 0xdf, 0x00, 0x26, 0x00, 0x1d, 0x30, 0x9c, 0x0a, 0x0e, 0x9a, 0x03, 0x0e,
+  0x92, 0x03, 0x0a, 0x42, 0x15, 0x02, 0x46, 0x15, 0x04, 0xb6, 0x31, 0x17, 0x91, 0xa0, 0x2a, 0x05, 0xe4, 0x7f, 0x0b, 0x68, 0x1c, 0x0b, 0x72, 0xe3, 0x0e, 0x98, 0x6a, 0x06, 0x3c, 0x0e, 0x03, 0xfc,
+  0x06, 0x1b, 0x12, 0x34, 0x4e, 0x01, 0x1c, 0x6e, 0x01, 0x86, 0x0a, 0x12, 0x11, 0x7e, 0x9c, 0x07, 0x46, 0x4e, 0x15, 0x73, 0xc2, 0x11, 0x00, 0x78, 0x03, 0x26, 0x11, 0xb5, 0xfa, 0x5f, 0x00, 0x80,
+  0x03, 0x04, 0xc2, 0x11, 0x04, 0xa8, 0x0a, 0x00, 0x08, 0x0e, 0x04, 0x86, 0x03, 0x06, 0x16, 0x20, 0x04, 0x1c, 0x0e, 0x15, 0xf5, 0x64, 0x55, 0x13, 0xf5, 0xb2, 0x0a, 0x02, 0x64, 0x0e, 0x40, 0x4f,
+  0x9c, 0xed, 0x8b, 0x98, 0x07, 0x02, 0xfc, 0x18, 0x02, 0x7c, 0x7c, 0x04, 0xba, 0xdc, 0x02, 0x9e, 0xd5, 0x13, 0x36, 0x86, 0xb5, 0x02, 0x84, 0x3c, 0x00, 0x3e, 0x6e, 0x00, 0x82, 0x35, 0x00, 0x0a,
+  0x39, 0x04, 0xbe, 0x6a, 0x02, 0x24, 0x07, 0x11, 0xb8, 0x20, 0x27, 0x00, 0x18, 0x7d, 0x24, 0x1a, 0xef, 0xf8, 0x18, 0x22, 0xb9, 0xe6, 0x8e, 0x55, 0x00, 0xd8, 0x0a, 0x40, 0x15, 0x8d, 0xf0, 0x6b,
+  0x94, 0x4a, 0x80, 0x15, 0x8d, 0xf4, 0x8c, 0x73, 0x7c, 0xb3, 0x84, 0xba, 0x4d, 0x00, 0xe8, 0x62, 0x00, 0x26, 0x07, 0x00, 0xec, 0x18, 0x02, 0x44, 0x35, 0x00, 0x84, 0x03, 0x02, 0x42, 0xd4, 0x00,
+  0x42, 0x27, 0x00, 0x1a, 0x00, 0x40, 0x6a, 0x3a, 0x52, 0x7c, 0x18, 0x35, 0x00, 0x96, 0x03, 0x00, 0x68, 0x15, 0x04, 0x54, 0x43, 0x20, 0x15, 0x95, 0x56, 0x07, 0x00, 0x0c, 0x00, 0x00, 0x94, 0x3c,
+  0x00, 0x02, 0x55, 0x20, 0x8f, 0x63, 0x16, 0x07, 0x60, 0x76, 0x9d, 0xf8, 0xad, 0x52, 0x7c, 0x54, 0x43, 0x60, 0x0d, 0x53, 0x0d, 0x53, 0x08, 0x32, 0x2c, 0x6a, 0xc0, 0x8f, 0x63, 0xcb, 0x4a, 0x4d,
+  0x5b, 0xf3, 0x8c, 0x55, 0x9d, 0x14, 0x95, 0x5c, 0x6a, 0x20, 0x8e, 0x63, 0x86, 0x23, 0x00, 0xd6, 0x3f, 0x20, 0xce, 0x6b, 0xbc, 0x6d, 0x00, 0x74, 0x23, 0x70, 0x6c, 0x63, 0x0e, 0x7c, 0x4b, 0x63,
+  0x0a, 0xa8, 0x66, 0x30, 0x8c, 0x0e, 0x7c, 0xc2, 0x1f, 0x00, 0x04, 0x00, 0x00, 0x14, 0x07, 0x00, 0x6a, 0x2a, 0x00, 0xbe, 0x6d, 0x20, 0x4a, 0x63, 0xaa, 0x66, 0x40, 0xab, 0x73, 0x6e, 0x8c, 0x6c,
+  0x03, 0x00, 0xae, 0x66, 0x71, 0xa8, 0x52, 0x88, 0x52, 0x67, 0x4a, 0x4b, 0x54, 0x6a, 0xf0, 0x07, 0x2e, 0x8c, 0xed, 0x83, 0x2a, 0x6b, 0x4a, 0x6b, 0x87, 0x52, 0xe5, 0x41, 0x46, 0x4a, 0x06, 0x42,
+  0x26, 0x42, 0x2e, 0x84, 0x4b, 0x6b, 0xd8, 0x1f, 0xc0, 0xad, 0x73, 0x2f, 0x8c, 0x74, 0xad, 0x95, 0xb5, 0x8c, 0x73, 0x12, 0xa5, 0x92, 0x51, 0x00, 0xce, 0x66, 0x00, 0xb2, 0xdb, 0x32, 0xeb, 0x5a,
+  0x2d, 0xc8, 0x3f, 0x41, 0x73, 0x8e, 0x6b, 0x4d, 0x18, 0x7c, 0x02, 0x5e, 0x1c, 0x02, 0x7e, 0x03, 0x04, 0x64, 0x1c, 0x04, 0x6c, 0x71, 0x12, 0x72, 0x46, 0xdf, 0x01, 0xa6, 0xa6, 0x11, 0xaf, 0x88,
+  0x03, 0x20, 0xd3, 0x9c, 0x86, 0x11, 0x02, 0xb4, 0x03, 0x04, 0x68, 0x35, 0x02, 0xdc, 0x34, 0x02, 0x4a, 0x4e, 0x01, 0x34, 0x1c, 0x21, 0x73, 0x72, 0x72, 0x2e, 0x15, 0x31, 0x8e, 0x38, 0x00, 0xea,
+  0x06, 0x00, 0xa6, 0x23, 0x42, 0x6d, 0x73, 0x6e, 0x73, 0xf0, 0xc6, 0x00, 0xd4, 0x23, 0x00, 0xd2, 0x23, 0x00, 0x9e, 0x7c, 0x00, 0xc2, 0xdf, 0x71, 0xf3, 0xa4, 0x14, 0xa5, 0xf3, 0xa4, 0x71, 0xce,
+  0x11, 0x00, 0x8e, 0x03, 0x00, 0x08, 0x07, 0x00, 0x98, 0x0a, 0x00, 0x16, 0x03, 0x00, 0xbc, 0x0a, 0x60, 0x10, 0x8c, 0x8e, 0x7b, 0x6d, 0x73, 0x96, 0x03, 0x00, 0x1a, 0x00, 0xa4, 0x96, 0xbd, 0xd7,
+  0xc5, 0xb3, 0xa4, 0x8e, 0x7b, 0x71, 0x9c, 0x8c, 0x03, 0x2f, 0x71, 0x9c, 0x32, 0x0e, 0x0b, 0x09, 0xcc, 0x0a, 0x1e, 0x9c, 0x86, 0x03, 0x01, 0x88, 0x03, 0x09, 0xa8, 0x71, 0x02, 0x14, 0x07, 0x06,
+  0x20, 0x07, 0x03, 0xe6, 0x7f, 0x29, 0xa4, 0xb1, 0x18, 0xee, 0x0e, 0x30, 0x0e, 0x2c, 0xf1, 0xac, 0x18, 0x07, 0x05, 0x74, 0x3c, 0x17, 0xbd, 0x3e, 0x35, 0x03, 0xb6, 0x0a, 0x24, 0x32, 0xb5, 0x0e,
+  0x87, 0x00, 0xf8, 0x71, 0x00, 0x18, 0x4e, 0x02, 0x46, 0x27, 0x02, 0xc8, 0x11, 0x21, 0x11, 0xb5, 0xcc, 0x71, 0x03, 0xda, 0x38, 0x17, 0x93, 0x2c, 0x2e, 0x08, 0x72, 0x1c, 0x04, 0x12, 0x0e, 0x02,
+  0x24, 0x07, 0x04, 0xb8, 0x31, 0x06, 0x9e, 0x0a, 0x08, 0xea, 0x18, 0x06, 0x08, 0x00, 0x02, 0xc0, 0x31, 0x02, 0xc2, 0x5c, 0x71, 0xd9, 0xee, 0x36, 0xd6, 0x6f, 0x9c, 0x77, 0xe4, 0x71, 0x33, 0xf1,
+  0xac, 0x37, 0x5a, 0x6e, 0x00, 0x92, 0x95, 0x04, 0xd2, 0x6a, 0x00, 0x24, 0x80, 0x00, 0x28, 0x27, 0x02, 0xf0, 0x11, 0x11, 0x37, 0xa8, 0xbc, 0x00, 0xd0, 0x51, 0x02, 0x1a, 0x07, 0x02, 0xd2, 0x6a,
+  0x00, 0x74, 0x03, 0x00, 0x8c, 0x35, 0x42, 0xf9, 0xee, 0x3a, 0xf7, 0xf4, 0x18, 0x22, 0xd9, 0xe6, 0x7a, 0x8e, 0x40, 0xd9, 0xee, 0x98, 0xe6, 0x68, 0x00, 0x11, 0xb0, 0x0a, 0x71, 0x00, 0xc8, 0x18,
+  0x02, 0xc6, 0x66, 0x00, 0xf6, 0x1f, 0x00, 0x2c, 0x35, 0x22, 0xaf, 0x63, 0xc0, 0x11, 0x00, 0xb0, 0x3f, 0x04, 0x70, 0x23, 0x20, 0x36, 0x95, 0x34, 0x20, 0x00, 0x9e, 0x11, 0x20, 0x6b, 0x3a, 0x16,
+  0x27, 0x00, 0xe4, 0x97, 0x11, 0x4e, 0x1a, 0x07, 0x40, 0x26, 0x11, 0x6e, 0x5b, 0x4e, 0x1c, 0x30, 0xed, 0x4a, 0xcc, 0x8a, 0xf7, 0x30, 0x53, 0x09, 0x2a, 0x00, 0x20, 0x00, 0x94, 0x15, 0x02, 0x36,
+  0x15, 0x00, 0xd4, 0x3f, 0x00, 0x6c, 0x15, 0x00, 0xcc, 0x11, 0x30, 0x8e, 0x63, 0xd0, 0x06, 0x7c, 0x50, 0x8c, 0x14, 0x95, 0x4d, 0x5b, 0x32, 0x6a, 0x42, 0x92, 0x84, 0x4d, 0x5b, 0x94, 0x94, 0x21,
+  0x8e, 0x63, 0xa2, 0x2a, 0x50, 0x63, 0x6c, 0x63, 0xa9, 0x4a, 0x18, 0x3c, 0x20, 0x8c, 0x63, 0xbc, 0x6d, 0x00, 0x10, 0x3c, 0x20, 0xb0, 0x8c, 0xc8, 0x18, 0x00, 0x3c, 0x43, 0x20, 0x4a, 0x6b, 0x22,
+  0x3c, 0x00, 0xc2, 0x74, 0x00, 0xc4, 0x74, 0x20, 0x2a, 0x63, 0x94, 0x03, 0x20, 0xed, 0x83, 0x36, 0x6a, 0x00, 0x08, 0x00, 0xf0, 0x0d, 0x8f, 0x94, 0xcc, 0x7b, 0x2e, 0x8c, 0x0a, 0x63, 0x8f, 0x94,
+  0x0a, 0x63, 0x05, 0x42, 0xa8, 0x52, 0x06, 0x42, 0x47, 0x4a, 0xc9, 0x5a, 0xc9, 0x5a, 0xa9, 0x5a, 0x4b, 0x6b, 0x2c, 0x00, 0x11, 0xad, 0x6e, 0x71, 0x00, 0x52, 0x3c, 0x40, 0x89, 0x52, 0x0e, 0x84,
+  0x06, 0x00, 0xc0, 0xf3, 0x9c, 0x70, 0x8c, 0xb2, 0x94, 0x71, 0x94, 0x8d, 0x73, 0x8a, 0x52, 0xf4, 0x0d, 0x00, 0x6a, 0x23, 0x91, 0xaf, 0x73, 0x0c, 0x63, 0x0c, 0x63, 0x10, 0x7c, 0x8e, 0xaa, 0x11,
+  0x00, 0xd8, 0x0d, 0x00, 0x90, 0x38, 0x02, 0x34, 0x35, 0x13, 0xf0, 0x98, 0x9f, 0x03, 0x66, 0x71, 0x01, 0x32, 0x35, 0x15, 0xcf, 0xa2, 0x0a, 0x12, 0x10, 0xce, 0x94, 0x02, 0x4e, 0x38, 0x03, 0x68,
+  0x35, 0x02, 0x7e, 0x1c, 0x00, 0x0a, 0x00, 0x02, 0x32, 0x35, 0x11, 0xd0, 0x7a, 0x98, 0x00, 0xae, 0x03, 0x11, 0xb3, 0xde, 0x31, 0x02, 0xb0, 0x38, 0x00, 0x10, 0x00, 0x20, 0x34, 0xad, 0x66, 0x2a,
+  0x00, 0x4c, 0x23, 0x80, 0x34, 0xad, 0x35, 0xad, 0x51, 0x94, 0xf4, 0xa4, 0xec, 0xad, 0x20, 0x75, 0xb5, 0x04, 0x0e, 0x11, 0xd3, 0x28, 0x07, 0x01, 0xa6, 0x11, 0x00, 0x50, 0x07, 0x03, 0xea, 0xc6,
+  0x00, 0xe6, 0x1f, 0x31, 0x71, 0x94, 0x30, 0x44, 0xdc, 0x10, 0xcf, 0x22, 0xc0, 0x01, 0x7a, 0x03, 0x40, 0x18, 0xce, 0xdb, 0xe6, 0x1a, 0x07, 0x00, 0x9c, 0xea, 0x00, 0x3a, 0x03, 0x13, 0x51, 0x44,
+  0x07, 0x00, 0xbc, 0x03, 0x0f, 0xc4, 0x11, 0x10, 0x1f, 0x9c, 0x90, 0x03, 0x07, 0x0a, 0x0a, 0x27, 0x04, 0x8a, 0xca, 0x03, 0x12, 0x27, 0x01, 0x54, 0xdc, 0x0c, 0x94, 0xca, 0x1d, 0xf1, 0xa0, 0x2a,
+  0x04, 0xfe, 0xc6, 0x1c, 0x32, 0xa8, 0x0a, 0x2b, 0xb5, 0x11, 0xbc, 0x51, 0x00, 0xda, 0x7f, 0x02, 0x4c, 0x15, 0x11, 0x12, 0x76, 0x03, 0x02, 0x32, 0x8e, 0x04, 0x34, 0x47, 0x04, 0xe4, 0x18, 0x11,
+  0x53, 0x8a, 0x03, 0x05, 0x08, 0x00, 0x05, 0xfc, 0x3f, 0x06, 0xe6, 0x18, 0x24, 0xb4, 0xc5, 0x9e, 0x63, 0x06, 0x6c, 0x3c, 0x04, 0x9a, 0x2a, 0x08, 0xde, 0x18, 0x02, 0x94, 0x0a, 0x13, 0xf5, 0xc8,
+  0xaa, 0x00, 0xba, 0x4a, 0x04, 0xe2, 0x7c, 0x00, 0x34, 0x59, 0x00, 0x36, 0xf9, 0x04, 0xda, 0x18, 0x20, 0xf6, 0xcd, 0xf2, 0x3f, 0x02, 0xbc, 0x83, 0x02, 0x38, 0x27, 0x04, 0x58, 0xc7, 0x00, 0x6a,
+  0x1c, 0x02, 0x6c, 0x1c, 0x12, 0x77, 0x90, 0x1c, 0x03, 0xf2, 0xaa, 0x02, 0xec, 0x18, 0x51, 0xf6, 0xcd, 0x12, 0xad, 0x37, 0x0e, 0x39, 0x04, 0x30, 0x07, 0x22, 0x98, 0xe6, 0xf6, 0x6a, 0x00, 0x4a,
+  0xd2, 0x00, 0x36, 0x27, 0x02, 0xea, 0x3f, 0x20, 0xaf, 0x63, 0x1c, 0x0e, 0x00, 0x1c, 0x2e, 0x42, 0xf4, 0x8c, 0xd4, 0x84, 0x02, 0x39, 0x00, 0x82, 0x2a, 0x02, 0x38, 0x23, 0x20, 0xd0, 0x63, 0x5c,
+  0x35, 0x60, 0x2e, 0x53, 0x0d, 0x53, 0xed, 0x4a, 0xbc, 0x82, 0x20, 0xb0, 0x63, 0x22, 0x5c, 0x20, 0x6e, 0x5b, 0x58, 0x1c, 0x20, 0x4e, 0x53, 0x4a, 0x20, 0x11, 0xb4, 0x22, 0xc6, 0x00, 0x56, 0xb4,
+  0x00, 0x8a, 0x4a, 0x31, 0x8b, 0x42, 0xd0, 0x3c, 0x6e, 0x11, 0x93, 0x5a, 0x43, 0x40, 0x11, 0x74, 0xd4, 0x8c, 0x58, 0x1c, 0x00, 0x4a, 0x15, 0x60, 0x11, 0x74, 0xcf, 0x6b, 0xb3, 0x8c, 0xc2, 0xd0,
+  0x00, 0x74, 0xe9, 0x40, 0xaf, 0x6b, 0x71, 0x84, 0x0a, 0x27, 0x71, 0x30, 0x7c, 0x10, 0x74, 0x50, 0x7c, 0xce, 0x6e, 0x43, 0x20, 0x4c, 0x63, 0x0c, 0x5c, 0x01, 0x08, 0x91, 0x92, 0x73, 0xb0, 0x8c,
+  0xf1, 0x94, 0xb0, 0x94, 0x0d, 0x7c, 0xc4, 0x46, 0xa0, 0x2e, 0x84, 0xab, 0x73, 0xac, 0x73, 0xe9, 0x5a, 0xc8, 0x5a, 0x08, 0x00, 0x20, 0xa8, 0x52, 0x68, 0x7f, 0x42, 0x67, 0x4a, 0xe9, 0x5a, 0x34,
+  0x23, 0x00, 0x56, 0x1c, 0x00, 0x98, 0x0a, 0x60, 0x0d, 0x84, 0xa8, 0x5a, 0x2a, 0x6b, 0x32, 0x15, 0x00, 0x34, 0x1c, 0x80, 0x2a, 0x63, 0xca, 0x5a, 0x68, 0x52, 0x2b, 0x6b, 0x45, 0xe0, 0x40, 0x4f,
+  0x8c, 0x91, 0x94, 0xe2, 0x1f, 0x40, 0x68, 0x4a, 0xa9, 0x52, 0xa0, 0x31, 0x00, 0xca, 0x18, 0xa0, 0x28, 0x42, 0x24, 0x21, 0xaa, 0x52, 0x28, 0x42, 0xeb, 0x5a, 0x58, 0x03, 0x00, 0xa4, 0x2d, 0x00,
+  0x18, 0x58, 0x00, 0x7c, 0x03, 0x22, 0xf4, 0x9c, 0x30, 0x0e, 0x02, 0xce, 0xe9, 0x00, 0x30, 0x03, 0x00, 0x3c, 0x58, 0x02, 0xb0, 0x26, 0x02, 0x46, 0xb1, 0x18, 0x92, 0xfe, 0x37, 0x12, 0x8c, 0x58,
+  0x35, 0x05, 0xb2, 0x66, 0x10, 0x83, 0x70, 0x1c, 0x03, 0xc2, 0x03, 0x12, 0x83, 0x14, 0x00, 0x06, 0x30, 0x4a, 0x00, 0xb2, 0x0a, 0x00, 0x78, 0x2e, 0x02, 0x40, 0x18, 0x11, 0x30, 0x7e, 0x2a, 0x22,
+  0x14, 0xad, 0x54, 0x03, 0x01, 0x3e, 0x19, 0x20, 0x8c, 0x51, 0xf0, 0x18, 0x01, 0xbe, 0x0a, 0x00, 0x60, 0x3f, 0x00, 0x7c, 0x07, 0x10, 0xef, 0x7c, 0x2e, 0x41, 0x83, 0xcf, 0x83, 0xae, 0xdc, 0x18,
+  0x00, 0x40, 0x0e, 0x02, 0x44, 0x03, 0x80, 0x4d, 0x73, 0x2c, 0x73, 0xaf, 0x83, 0x72, 0x9c, 0xde, 0xdf, 0x60, 0x59, 0xce, 0x18, 0xce, 0x34, 0xad, 0x52, 0x15, 0x40, 0xef, 0x83, 0x6e, 0x73, 0x48,
+  0x07, 0x01, 0x40, 0x2e, 0x05, 0xf6, 0x06, 0x0f, 0x02, 0x20, 0x03, 0x0e, 0xcc, 0x11, 0x06, 0xd0, 0x11, 0x02, 0x14, 0x07, 0x0f, 0x8e, 0x03, 0x07, 0x0d, 0x0c, 0x47, 0x0f, 0x10, 0x47, 0x0a, 0x0a,
+  0xaa, 0x0a, 0x0b, 0x68, 0x1c, 0x0c, 0x86, 0x63, 0x05, 0xcc, 0x31, 0x06, 0x40, 0x15, 0x13, 0x53, 0x0a, 0x40, 0x04, 0xac, 0x4a, 0x04, 0xea, 0x18, 0x11, 0x52, 0xbe, 0x4a, 0x00, 0x1e, 0x07, 0x06,
+  0x02, 0x20, 0x02, 0x1a, 0x07, 0x02, 0x02, 0xf2, 0x04, 0xc0, 0xe3, 0x06, 0xca, 0x31, 0x00, 0x2c, 0x07, 0x02, 0xe6, 0x3f, 0x08, 0x3a, 0x0e, 0x02, 0xde, 0x38, 0x04, 0x38, 0x07, 0x02, 0x14, 0xa0,
+  0x00, 0xc2, 0x38, 0x00, 0x8e, 0x63, 0x02, 0xf8, 0x18, 0x24, 0x90, 0xa4, 0x4e, 0x2e, 0x02, 0xb8, 0x23, 0x24, 0xb8, 0xe6, 0x5a, 0x75, 0x02, 0xf6, 0x91, 0x02, 0x08, 0x39, 0x02, 0x3c, 0x67, 0x01,
+  0xbe, 0x2a, 0x01, 0xb8, 0x0a, 0x22, 0xd9, 0xe6, 0x82, 0x5c, 0x04, 0xd6, 0x51, 0x04, 0x8e, 0x23, 0x00, 0x1c, 0x07, 0x00, 0x18, 0x07, 0x10, 0x98, 0x82, 0xa7, 0x10, 0xce, 0xd8, 0x23, 0x22, 0xf2,
+  0xac, 0x3c, 0xf7, 0x00, 0x5c, 0x03, 0x11, 0xb0, 0x32, 0x15, 0x30, 0x8b, 0x3a, 0x8f, 0xda, 0x26, 0x01, 0xde, 0x74, 0x00, 0xc2, 0x54, 0x00, 0x3a, 0x51, 0x00, 0x80, 0x03, 0x40, 0xe9, 0x29, 0xac,
+  0x42, 0x00, 0x07, 0x00, 0x3e, 0xad, 0x00, 0xf0, 0x18, 0x31, 0xed, 0x4a, 0xaf, 0xdc, 0x46, 0x01, 0x84, 0x4a, 0xc1, 0x74, 0x73, 0x7c, 0x4e, 0x5b, 0xe9, 0x29, 0xd0, 0x63, 0x11, 0x74, 0xb0, 0x1e,
+  0x19, 0x40, 0x73, 0x7c, 0x31, 0x74, 0x94, 0xc2, 0x00, 0x46, 0x19, 0x20, 0x32, 0x7c, 0x80, 0x1c, 0x22, 0x29, 0x32, 0xb2, 0xf7, 0x00, 0x5c, 0x1c, 0x20, 0x4e, 0x63, 0x46, 0xcd, 0x00, 0x08, 0xed,
+  0x40, 0xec, 0x52, 0x30, 0x7c, 0x44, 0x6a, 0x40, 0x8d, 0x63, 0x69, 0x42, 0xa4, 0x38, 0x40, 0x54, 0xa5, 0x50, 0x84, 0xb8, 0x6d, 0x00, 0x56, 0xa6, 0x11, 0x2e, 0x80, 0x86, 0x20, 0xec, 0x7b, 0x68,
+  0x23, 0x00, 0x4e, 0x23, 0x22, 0x6a, 0x6b, 0xd6, 0x74, 0x00, 0xa4, 0x0a, 0x00, 0x8e, 0x86, 0x00, 0x2c, 0x23, 0xf0, 0x05, 0x90, 0x94, 0x2e, 0x84, 0xe9, 0x62, 0xed, 0x83, 0x6b, 0x73, 0x8b, 0x73,
+  0x09, 0x63, 0x4a, 0x6b, 0xc8, 0x5a, 0xc9, 0x62, 0x22, 0x00, 0x00, 0xba, 0x1f, 0x11, 0xad, 0x92, 0x03, 0x00, 0x10, 0x35, 0x20, 0xea, 0x62, 0xc0, 0x1f, 0x00, 0xc6, 0x3f, 0x00, 0x7a, 0x9f, 0x02,
+  0x88, 0x03, 0x20, 0xaa, 0x52, 0x14, 0x00, 0x44, 0x71, 0x8c, 0x4d, 0x6b, 0x14, 0xaa, 0x11, 0xaf, 0x6a, 0x2a, 0x11, 0xcf, 0x6c, 0x78, 0x02, 0x86, 0x2a, 0x02, 0x26, 0x43, 0x02, 0xb8, 0x26, 0x02,
+  0x50, 0x98, 0x04, 0x0e, 0x00, 0x22, 0xcf, 0x7b, 0x18, 0x07, 0x11, 0x8f, 0xf4, 0x3f, 0x02, 0x8e, 0x9f, 0x00, 0xa0, 0x11, 0x01, 0xa2, 0x38, 0x01, 0xc6, 0x51, 0x04, 0xb6, 0x0a, 0x02, 0xf4, 0x38,
+  0x02, 0xe0, 0x74, 0x11, 0x6e, 0x66, 0x2e, 0x01, 0x7c, 0x3c, 0x10, 0x8c, 0x46, 0x71, 0x62, 0x8f, 0x7b, 0xd0, 0x83, 0x51, 0x8c, 0xc6, 0x46, 0x00, 0x80, 0x03, 0x00, 0xda, 0x1f, 0x62, 0xd3, 0xa4,
+  0xf4, 0xa4, 0xd3, 0xa4, 0x6a, 0x1c, 0x00, 0x7a, 0x23, 0x00, 0x10, 0x03, 0x02, 0x44, 0x15, 0x02, 0x04, 0x00, 0x20, 0x71, 0x94, 0x2a, 0x07, 0x00, 0x98, 0x26, 0x00, 0xb6, 0x11, 0x00, 0x6e, 0x03,
+  0x02, 0xf2, 0x1f, 0x60, 0x14, 0xad, 0x76, 0xb5, 0x14, 0xad, 0x16, 0xe0, 0x00, 0x48, 0xf5, 0x00, 0xf4, 0x11, 0x00, 0x66, 0x0e, 0x01, 0x46, 0x07, 0x34, 0xa4, 0x71, 0x9c, 0x50, 0x15, 0x02, 0x08,
+  0x00, 0x08, 0x26, 0x07, 0x02, 0xa6, 0x03, 0x07, 0x54, 0x15, 0x09, 0x6e, 0x03, 0x06, 0x20, 0x2e, 0x04, 0x8a, 0x03, 0x04, 0x9c, 0x0a, 0x04, 0x0c, 0x00, 0x0a, 0xd4, 0x38, 0x15, 0xd1, 0xa6, 0x91,
+  0x0c, 0x36, 0x0e, 0x0a, 0x9e, 0x0a, 0x06, 0x8a, 0x6a, 0x06, 0x1e, 0x07, 0x0d, 0xd6, 0x38, 0x08, 0x38, 0x4e, 0x03, 0xd0, 0x11, 0x00, 0x16, 0x47, 0x02, 0xa0, 0xfc, 0x04, 0xac, 0x2a, 0x15, 0x32,
+  0x3a, 0x0e, 0x02, 0x3c, 0x2e, 0x17, 0x94, 0x90, 0x43, 0x02, 0x3c, 0x3c, 0x08, 0x60, 0xee, 0x0c, 0x54, 0x55, 0x06, 0x50, 0x1c, 0x04, 0x22, 0x07, 0x00, 0x30, 0x67, 0x04, 0x3e, 0x2e, 0x00, 0x0e,
+  0x00, 0x42, 0xcd, 0x8b, 0x36, 0xd6, 0x92, 0x03, 0x02, 0xc2, 0x18, 0x02, 0x10, 0x20, 0x02, 0x1c, 0x00, 0x02, 0x2c, 0xa7, 0x13, 0x16, 0x3a, 0xe0, 0x04, 0xd0, 0x83, 0x13, 0x77, 0x78, 0x75, 0x00,
+  0x9a, 0x3c, 0x00, 0xf4, 0x06, 0x02, 0x8a, 0x03, 0x02, 0xa2, 0x63, 0x22, 0xfa, 0xee, 0x2e, 0x60, 0x11, 0x77, 0x06, 0x59, 0x21, 0x12, 0xad, 0x1a, 0x40, 0x10, 0xee, 0xd2, 0x11, 0x02, 0xde, 0x4a,
+  0x42, 0x57, 0xde, 0xb3, 0x84, 0x10, 0x2e, 0x60, 0xd0, 0x6b, 0x6b, 0x3a, 0x6b, 0x3a, 0x38, 0x03, 0x11, 0x4a, 0x94, 0x58, 0x20, 0x0d, 0x53, 0xd8, 0x26, 0x10, 0x6e, 0xce, 0x2a, 0x10, 0x5b, 0x8c,
+  0xd0, 0x20, 0x36, 0x95, 0x94, 0xa9, 0x01, 0x7a, 0x1c, 0xf0, 0x00, 0x74, 0x4e, 0x5b, 0xf1, 0x6b, 0x93, 0x84, 0x76, 0x9d, 0xd8, 0xa5, 0x76, 0x9d, 0x36, 0x95, 0x42, 0x00, 0x20, 0x0d, 0x53, 0x32,
+  0xa6, 0x31, 0x93, 0x84, 0xb4, 0x72, 0x03, 0x01, 0xca, 0x5c, 0x01, 0x0a, 0xed, 0x02, 0x36, 0xcd, 0x02, 0xd2, 0x94, 0x80, 0x96, 0xa5, 0x15, 0x95, 0x92, 0x84, 0x31, 0x74, 0x8e, 0xbb, 0xf1, 0x0a,
+  0x4d, 0x5b, 0x4d, 0x63, 0x4d, 0x63, 0x10, 0x7c, 0xb6, 0xad, 0x30, 0x7c, 0x0b, 0x53, 0x4c, 0x63, 0x2c, 0x5b, 0xce, 0x73, 0x0f, 0x7c, 0x0f, 0x7c, 0x6c, 0xd8, 0x74, 0x20, 0xed, 0x7b, 0x20, 0x07,
+  0x80, 0x6f, 0x8c, 0xcc, 0x73, 0x2e, 0x84, 0x29, 0x63, 0xde, 0x26, 0xa0, 0x29, 0x63, 0xab, 0x73, 0x4a, 0x63, 0xc8, 0x5a, 0xe9, 0x5a, 0x76, 0x0a, 0xd1, 0x2a, 0x6b, 0xed, 0x7b, 0x67, 0x4a, 0xea,
+  0x62, 0xc9, 0x5a, 0xed, 0x7b, 0xac, 0x08, 0x7c, 0x00, 0x90, 0x03, 0x00, 0x92, 0x03, 0xa0, 0x8b, 0x7b, 0xe9, 0x62, 0xe9, 0x62, 0x2a, 0x6b, 0xa8, 0x5a, 0xb4, 0x66, 0x20, 0xea, 0x62, 0x4e, 0x43,
+  0x40, 0xaa, 0x5a, 0x6d, 0x73, 0x2c, 0x15, 0x00, 0x70, 0x23, 0x00, 0x02, 0x55, 0x61, 0x6d, 0x6b, 0xca, 0x5a, 0x30, 0x84, 0x80, 0x78, 0x01, 0x98, 0x46, 0x24, 0x6e, 0x6b, 0x52, 0x98, 0x01, 0x68,
+  0x46, 0x01, 0x8a, 0x9f, 0x13, 0xf0, 0x6c, 0x5f, 0x13, 0xb3, 0x02, 0x58, 0x02, 0x86, 0x2a, 0x04, 0x6a, 0x3f, 0x00, 0xe0, 0x06, 0x04, 0xaa, 0x2a, 0x15, 0xcf, 0xa4, 0x03, 0x13, 0x10, 0x5c, 0xbf,
+  0x02, 0xe6, 0x2d, 0x02, 0x34, 0x2e, 0x02, 0x14, 0x07, 0x13, 0xaf, 0x56, 0x9c, 0x15, 0x11, 0x52, 0x78, 0x11, 0x10, 0xe6, 0x11, 0x00, 0x2e, 0x03, 0x00, 0x1e, 0xdc, 0x00, 0x88, 0x03, 0x11, 0x51,
+  0xce, 0x03, 0x00, 0xfa, 0x06, 0x00, 0xb8, 0x03, 0x00, 0x02, 0x00, 0x00, 0xc0, 0x1f, 0x00, 0x52, 0x1c, 0x20, 0xf0, 0x8b, 0x2e, 0x00, 0x00, 0x96, 0x03, 0x11, 0xb3, 0x5a, 0x03, 0x21, 0xef, 0x83,
+  0x70, 0xe3, 0x01, 0x94, 0x03, 0x11, 0xb2, 0x40, 0x00, 0x20, 0x35, 0xb5, 0x2e, 0x0e, 0x00, 0x04, 0xe0, 0x00, 0xcc, 0x2a, 0x00, 0x88, 0x03, 0x11, 0x72, 0xc4, 0x03, 0x22, 0xef, 0x8b, 0x40, 0x00,
+  0x00, 0x00, 0x20, 0x3d, 0x30, 0x94, 0x30, 0x22, 0x07, 0x11, 0x71, 0x10, 0x0e, 0x16, 0x71, 0x74, 0x2a, 0x0d, 0x90, 0x03, 0x04, 0xac, 0x31, 0x0e, 0x18, 0x07, 0x08, 0x1e, 0x07, 0x24, 0xb0, 0xac,
+  0x8a, 0x03, 0x1f, 0xb0, 0x30, 0x95, 0x04, 0x0c, 0x12, 0x47, 0x06, 0xaa, 0x4a, 0x04, 0x30, 0x6e, 0x07, 0x86, 0x03, 0x0c, 0x58, 0x55, 0x03, 0x6a, 0x15, 0x00, 0x80, 0x03, 0x00, 0x9c, 0x15, 0x11,
+  0x73, 0x88, 0x23, 0x11, 0x73, 0x14, 0x07, 0x13, 0x52, 0xd2, 0x58, 0x00, 0x8a, 0x03, 0x17, 0x93, 0x34, 0x4e, 0x08, 0x00, 0x20, 0x00, 0xbe, 0x03, 0x00, 0x84, 0x03, 0x00, 0x6c, 0x15, 0x04, 0x78,
+  0x83, 0x0c, 0x6e, 0x1c, 0x02, 0xa8, 0x4a, 0x06, 0x9a, 0x03, 0x04, 0x7a, 0x3c, 0x04, 0xde, 0x31, 0x0a, 0xea, 0x31, 0x13, 0x36, 0xd0, 0x71, 0x22, 0xcd, 0x8b, 0x96, 0x35, 0x02, 0x0c, 0x99, 0x11,
+  0x77, 0xde, 0x1f, 0x20, 0x12, 0xad, 0x4c, 0x47, 0x10, 0x98, 0x68, 0x3c, 0x10, 0xee, 0x84, 0x0a, 0x13, 0xd9, 0x1c, 0x27, 0x00, 0x1a, 0x07, 0x71, 0xb1, 0xa4, 0x1a, 0xef, 0x1a, 0xef, 0xb5, 0x1c,
+  0x19, 0x00, 0x1c, 0x07, 0x00, 0x24, 0x20, 0x02, 0x24, 0x92, 0x04, 0x42, 0x07, 0x60, 0x37, 0xd6, 0x8b, 0x42, 0x11, 0x74, 0x1e, 0x07, 0x11, 0x8b, 0x60, 0x31, 0x40, 0x31, 0x74, 0xd4, 0x8c, 0x3e,
+  0x03, 0x20, 0xd4, 0x8c, 0x62, 0x58, 0x02, 0xe6, 0xf3, 0x40, 0x35, 0x95, 0x15, 0x95, 0x56, 0x35, 0x00, 0x7a, 0x51, 0x02, 0x5c, 0x23, 0x20, 0xf0, 0x6b, 0x78, 0x03, 0x60, 0xcc, 0x4a, 0x8b, 0x42,
+  0xcc, 0x4a, 0x8a, 0x0a, 0x00, 0x7c, 0x03, 0x00, 0xec, 0x4d, 0x02, 0x1e, 0x9f, 0x20, 0x0d, 0x53, 0x0e, 0x27, 0x42, 0x4e, 0x5b, 0x8f, 0x63, 0x74, 0x23, 0x30, 0x11, 0x74, 0x4e, 0xde, 0x7b, 0x10,
+  0x6b, 0xb6, 0xc9, 0x10, 0x92, 0x4c, 0xd4, 0x10, 0x63, 0xae, 0x0a, 0x40, 0xef, 0x73, 0x51, 0x7c, 0x68, 0x78, 0x00, 0x72, 0x7f, 0x20, 0x6c, 0x63, 0xa6, 0x0a, 0x20, 0x0e, 0x7c, 0x42, 0x6a, 0x00,
+  0xde, 0x74, 0x20, 0x2a, 0x63, 0x66, 0x86, 0x31, 0x4a, 0x63, 0xcd, 0x10, 0x8a, 0x40, 0x4e, 0x8c, 0x2d, 0x84, 0x8e, 0x5f, 0x20, 0x8b, 0x73, 0xde, 0x26, 0xa0, 0x4e, 0x8c, 0x6f, 0x8c, 0x8c, 0x73,
+  0x67, 0x4a, 0x8c, 0x73, 0x18, 0x15, 0xa0, 0x26, 0x4a, 0x6b, 0x73, 0x4a, 0x6b, 0x2a, 0x6b, 0xe9, 0x62, 0x26, 0x07, 0x51, 0x0a, 0x6b, 0x8c, 0x7b, 0x8b, 0x76, 0x9f, 0x80, 0xee, 0x83, 0x2f, 0x8c,
+  0xcd, 0x7b, 0xcd, 0x7b, 0x38, 0x35, 0x20, 0x2f, 0x84, 0x64, 0x14, 0x11, 0x8d, 0xce, 0x38, 0x60, 0xaa, 0x5a, 0xcb, 0x5a, 0x0c, 0x63, 0x2a, 0x03, 0x00, 0x1a, 0x83, 0x04, 0x6c, 0x51, 0x04, 0x7e,
+  0x86, 0x00, 0x40, 0x1c, 0x13, 0xf0, 0x94, 0x7f, 0x01, 0x9c, 0x86, 0x00, 0x9e, 0x31, 0x12, 0x73, 0xca, 0x1f, 0x11, 0x8f, 0x3c, 0x23, 0x10, 0x2d, 0x50, 0x1c, 0x01, 0x04, 0x47, 0x00, 0xb8, 0x2a,
+  0x00, 0xa6, 0x46, 0x02, 0x32, 0x23, 0x11, 0xf0, 0x9e, 0x18, 0x02, 0x2a, 0x07, 0x03, 0x56, 0x43, 0x10, 0x83, 0x22, 0x2e, 0x00, 0x2e, 0x00, 0x02, 0x12, 0x39, 0x31, 0x14, 0xad, 0x92, 0x08, 0x07,
+  0x00, 0x28, 0x03, 0x04, 0x12, 0x7c, 0x00, 0x54, 0x00, 0x02, 0xb6, 0x11, 0x00, 0xd2, 0x26, 0x20, 0xb3, 0x9c, 0xfa, 0x06, 0x22, 0xf4, 0xac, 0x26, 0x07, 0x00, 0x0c, 0xce, 0xc2, 0x55, 0xb5, 0xb3,
+  0xa4, 0xf0, 0x8b, 0x92, 0x9c, 0x31, 0x94, 0xb2, 0x9c, 0x32, 0x35, 0x82, 0xae, 0x83, 0xae, 0x83, 0x30, 0x8c, 0x30, 0x94, 0x10, 0x27, 0x00, 0xba, 0x0a, 0x00, 0x70, 0x1c, 0x40, 0x75, 0xb5, 0x35,
+  0xad, 0xf6, 0x2a, 0x00, 0x1e, 0x04, 0x02, 0x90, 0x07, 0x06, 0x18, 0x15, 0x10, 0x31, 0xb2, 0x23, 0x23, 0x9c, 0x51, 0x76, 0x03, 0x1d, 0x30, 0x3c, 0x15, 0x1a, 0x51, 0xc6, 0x11, 0x0b, 0x98, 0x03,
+  0x09, 0x16, 0x00, 0x05, 0x18, 0x07, 0x02, 0x86, 0x03, 0x08, 0x4c, 0x15, 0x02, 0x12, 0x07, 0x16, 0xb0, 0x24, 0x4e, 0x03, 0xec, 0x3f, 0x04, 0x6c, 0x1c, 0x06, 0x30, 0xd5, 0x04, 0xba, 0x11, 0x17,
+  0x11, 0x6c, 0x83, 0x16, 0x11, 0x78, 0x1c, 0x03, 0xe0, 0x7f, 0x02, 0x10, 0x07, 0x04, 0x3a, 0x0e, 0x02, 0x0c, 0x00, 0x00, 0x0e, 0x00, 0x22, 0xf1, 0xb4, 0x6c, 0x15, 0x02, 0x68, 0x5c, 0x14, 0x73,
+  0x20, 0x07, 0x07, 0x82, 0x43, 0x06, 0x1a, 0x47, 0x04, 0x14, 0x00, 0x00, 0xda, 0x26, 0x06, 0x68, 0x3c, 0x15, 0xb4, 0x80, 0x1c, 0x04, 0xc2, 0x31, 0x06, 0x50, 0x6e, 0x04, 0xa0, 0x03, 0x02, 0x9e,
+  0x0a, 0x02, 0xc0, 0x2a, 0x04, 0x44, 0xc7, 0x00, 0x10, 0x20, 0x02, 0x08, 0x12, 0x04, 0x34, 0x27, 0x02, 0x90, 0x5c, 0x22, 0x94, 0xc5, 0xae, 0x0a, 0x02, 0xf6, 0x91, 0x00, 0xc0, 0x55, 0x00, 0x36,
+  0x07, 0x11, 0x78, 0x5c, 0xc0, 0x00, 0xa6, 0x5c, 0x02, 0x98, 0x2a, 0x40, 0x5b, 0xf7, 0x33, 0xb5, 0x50, 0x2e, 0x20, 0xb1, 0xa4, 0x26, 0x60, 0x00, 0x9c, 0x03, 0x00, 0x90, 0x23, 0x00, 0x92, 0x35,
+  0x22, 0x1a, 0xf7, 0x0a, 0x84, 0x00, 0x96, 0x3c, 0x00, 0x24, 0x19, 0x22, 0x15, 0x95, 0x48, 0x31, 0x10, 0x93, 0x76, 0x23, 0x10, 0x7c, 0x56, 0x3c, 0x00, 0x3e, 0x23, 0x00, 0xe8, 0x82, 0x00, 0x3a,
+  0x15, 0x20, 0xf1, 0x73, 0x4e, 0x03, 0x00, 0xd4, 0x26, 0x00, 0x18, 0x07, 0x00, 0x5e, 0x03, 0x51, 0x93, 0x84, 0xaf, 0x63, 0x73, 0x6a, 0x35, 0x00, 0xd4, 0x31, 0x02, 0xa4, 0x03, 0x00, 0xd6, 0x0a,
+  0xe0, 0x51, 0x7c, 0xd4, 0x8c, 0x10, 0x74, 0xf0, 0x6b, 0xaf, 0x6b, 0x0d, 0x53, 0xb3, 0x8c, 0x60, 0x40, 0x20, 0x10, 0x74, 0x1e, 0xf4, 0x80, 0x93, 0x84, 0x8f, 0x63, 0x92, 0x84, 0x55, 0x9d, 0x08,
+  0x4e, 0x40, 0xaf, 0x6b, 0x8a, 0x42, 0xac, 0x31, 0x11, 0x6e, 0xaa, 0xc2, 0x00, 0xcc, 0x5f, 0x11, 0x71, 0xd8, 0x46, 0x00, 0x68, 0x4a, 0x00, 0x4e, 0x43, 0x00, 0x38, 0x0e, 0x00, 0x8e, 0x86, 0x20,
+  0xed, 0x73, 0x60, 0x1c, 0x00, 0x92, 0x03, 0x00, 0x4a, 0x6a, 0x00, 0x3e, 0x15, 0x40, 0x8b, 0x73, 0x2a, 0x63, 0xf8, 0x5b, 0x00, 0x96, 0x11, 0x20, 0xe9, 0x5a, 0x16, 0x35, 0x80, 0xee, 0x7b, 0x4b,
+  0x6b, 0xad, 0x73, 0xac, 0x73, 0x1a, 0x07, 0x31, 0x2a, 0x6b, 0x6b, 0x08, 0x00, 0x80, 0x4e, 0x94, 0x2a, 0x6b, 0xac, 0x7b, 0xac, 0x7b, 0x3e, 0x0e, 0x51, 0x6c, 0x73, 0x8d, 0x73, 0x4b, 0x4a, 0x43,
+  0x41, 0xeb, 0x62, 0x6c, 0x6b, 0xce, 0xbb, 0x21, 0x7b, 0x50, 0x00, 0x7c, 0x62, 0x31, 0x8c, 0x30, 0x84, 0x0c, 0x5b, 0xd0, 0x62, 0x02, 0x52, 0x51, 0x04, 0x76, 0x7f, 0x00, 0x0a, 0x00, 0x11, 0x92,
+  0xa8, 0xb4, 0x00, 0x86, 0x38, 0x02, 0x88, 0xc6, 0x00, 0x3c, 0x2a, 0x02, 0x7e, 0x38, 0x00, 0xf4, 0x06, 0x00, 0x7a, 0x8d, 0x60, 0xd4, 0xa4, 0x15, 0xad, 0x15, 0xad, 0x70, 0xc6, 0x00, 0x40, 0x7c,
+  0x02, 0x38, 0x07, 0x20, 0xd3, 0x9c, 0x0c, 0xbc, 0x00, 0x5a, 0x7c, 0x02, 0xcc, 0x0a, 0x31, 0xcf, 0x7b, 0x8f, 0x08, 0x12, 0x00, 0x48, 0xaa, 0x01, 0x9c, 0x23, 0x54, 0x7b, 0x0c, 0x63, 0x4d, 0x73,
+  0xac, 0x1c, 0x31, 0x10, 0x8c, 0xb2, 0x24, 0x35, 0x00, 0xba, 0x11, 0x00, 0x02, 0x19, 0x11, 0xcf, 0x18, 0x07, 0x00, 0xd4, 0x03, 0x62, 0x2d, 0x73, 0x4d, 0x73, 0xf0, 0x8b, 0x46, 0x23, 0x00, 0x72,
+  0x1c, 0x11, 0xcf, 0x42, 0x3c, 0x24, 0x2d, 0x73, 0x58, 0x23, 0x00, 0xae, 0x0a, 0x11, 0x30, 0xec, 0x18, 0x11, 0x92, 0xa2, 0x03, 0x00, 0x60, 0x03, 0x00, 0x04, 0x07, 0x00, 0x3e, 0x0e, 0x40, 0xf8,
+  0xc5, 0xd3, 0x9c, 0x86, 0xfc, 0x00, 0x76, 0x3c, 0x02, 0xc2, 0x11, 0x26, 0x71, 0x9c, 0xe4, 0x18, 0x17, 0x31, 0x76, 0x03, 0x0d, 0xf0, 0x18, 0x27, 0x9c, 0x51, 0x98, 0x31, 0x0e, 0x02, 0x00, 0x0a,
+  0x1e, 0x4e, 0x08, 0x7a, 0x43, 0x1d, 0x90, 0xa0, 0xf1, 0x0c, 0x1a, 0x07, 0x06, 0xf4, 0x1f, 0x03, 0x86, 0x03, 0x12, 0xbd, 0xda, 0x18, 0x00, 0x50, 0x03, 0x09, 0x74, 0x1c, 0x05, 0x16, 0x2e, 0x05,
+  0x94, 0x03, 0x05, 0xc6, 0x11, 0x13, 0x32, 0x06, 0x20, 0x00, 0x0e, 0xe0, 0x22, 0x93, 0xc5, 0x28, 0x27, 0x11, 0x53, 0x16, 0x67, 0x02, 0x6a, 0x5c, 0x02, 0x98, 0x43, 0x04, 0x98, 0x6a, 0x06, 0x1c,
+  0x07, 0x04, 0x8a, 0x23, 0x44, 0xf1, 0xac, 0x53, 0xbd, 0x12, 0x07, 0x04, 0x90, 0x43, 0x02, 0x02, 0x40, 0x0a, 0x06, 0x60, 0x15, 0xf5, 0x0e, 0x00, 0x00, 0xa0, 0x0a, 0x00, 0xb6, 0x2a, 0x02, 0x56,
+  0x27, 0x08, 0x82, 0x55, 0x00, 0xec, 0xf1, 0x00, 0x8a, 0x75, 0x02, 0x3e, 0x67, 0x04, 0x3a, 0x0e, 0x00, 0x42, 0x87, 0x04, 0x14, 0x60, 0x20, 0x16, 0xce, 0x54, 0x6e, 0x11, 0xb9, 0x54, 0x35, 0x22,
+  0xfa, 0xee, 0x7c, 0x23, 0x00, 0x54, 0xb9, 0x02, 0x7a, 0x03, 0x00, 0x8c, 0x03, 0x02, 0xb2, 0xb5, 0x00, 0xd4, 0xa3, 0x00, 0xc0, 0xa7, 0x00, 0xa4, 0x35, 0x01, 0x5a, 0x2e, 0x01, 0x8e, 0x1c, 0x60,
+  0x8e, 0x63, 0xec, 0x52, 0xab, 0x4a, 0x00, 0x63, 0x11, 0xf0, 0xe0, 0x06, 0x12, 0x52, 0x52, 0x8d, 0x01, 0x8c, 0x3c, 0x00, 0x80, 0x03, 0x00, 0x76, 0x15, 0x40, 0x51, 0x7c, 0xd0, 0x6b, 0xbc, 0x11,
+  0x00, 0xee, 0x1f, 0x00, 0xba, 0xa2, 0x00, 0xf8, 0x1f, 0x00, 0xf6, 0xbe, 0x00, 0xc6, 0x03, 0x00, 0x22, 0x5c, 0x60, 0x8f, 0x63, 0x2d, 0x5b, 0xec, 0x52, 0x7e, 0x0e, 0x40, 0x6a, 0x42, 0x0c, 0x53,
+  0xb4, 0x38, 0x20, 0x6e, 0x63, 0x86, 0x35, 0x00, 0xba, 0x11, 0x70, 0xec, 0x52, 0x31, 0x74, 0xd3, 0x8c, 0x6e, 0x92, 0x63, 0xb0, 0x4a, 0x8a, 0x42, 0x71, 0x7c, 0x75, 0xa5, 0x71, 0x84, 0x92, 0x84,
+  0x9e, 0x4a, 0x20, 0x30, 0x7c, 0xba, 0x66, 0x00, 0x9c, 0x31, 0x31, 0x2f, 0x7c, 0x8c, 0x3c, 0x98, 0x60, 0x90, 0x8c, 0x4b, 0x63, 0xcc, 0x73, 0x4c, 0x43, 0x40, 0x4a, 0x63, 0x4b, 0x63, 0xf0, 0x1f,
+  0x02, 0x42, 0x6a, 0x40, 0x0d, 0x7c, 0xed, 0x7b, 0x42, 0x71, 0x00, 0x4a, 0x6a, 0x01, 0xb0, 0x1f, 0x10, 0x7b, 0x8c, 0x0a, 0x00, 0xf2, 0x06, 0x00, 0xa2, 0x58, 0x00, 0xec, 0x26, 0x20, 0xac, 0x7b,
+  0x8a, 0x03, 0x20, 0x6f, 0x94, 0xb4, 0x86, 0x40, 0xed, 0x83, 0x0a, 0x63, 0x0a, 0xd1, 0x20, 0x0e, 0x84, 0x26, 0x07, 0x00, 0x66, 0x23, 0x60, 0x70, 0x8c, 0x0b, 0x63, 0x6d, 0x6b, 0x02, 0x7c, 0x01,
+  0x02, 0x55, 0x01, 0xc6, 0x3f, 0x02, 0x3c, 0x2a, 0x12, 0x10, 0x3c, 0x3c, 0x01, 0x3e, 0xd8, 0x01, 0x18, 0x6a, 0x03, 0xe4, 0x82, 0x02, 0x1a, 0x07, 0x11, 0xef, 0x92, 0x1f, 0x14, 0x11, 0x1c, 0xaa,
+  0x11, 0x94, 0x92, 0x0a, 0x11, 0x94, 0x20, 0x0e, 0x00, 0x0e, 0x07, 0x30, 0x83, 0x6e, 0x73, 0xd4, 0xf4, 0x22, 0x51, 0x94, 0x2a, 0xc3, 0x11, 0x31, 0x5c, 0x23, 0x02, 0xb4, 0x94, 0x02, 0x78, 0x83,
+  0x00, 0xd0, 0xb0, 0x04, 0x64, 0x1c, 0x04, 0x00, 0x5c, 0x00, 0x5c, 0xd1, 0x02, 0x40, 0x1c, 0x00, 0x2c, 0x07, 0x31, 0x6e, 0x7b, 0x6e, 0x9e, 0x11, 0x00, 0xc8, 0x06, 0x20, 0x92, 0x9c, 0xaa, 0xff,
+  0x70, 0x14, 0xad, 0xd3, 0xa4, 0xb3, 0xa4, 0x10, 0x18, 0x55, 0x01, 0xda, 0x1f, 0x31, 0x51, 0x94, 0x72, 0x7a, 0x03, 0x00, 0x50, 0x1c, 0x24, 0xf3, 0xa4, 0x98, 0x2a, 0x22, 0xd3, 0xa4, 0xc4, 0x31,
+  0x00, 0x6a, 0x1c, 0x02, 0x7c, 0x03, 0x00, 0xaa, 0x03, 0x20, 0x35, 0xad, 0xa4, 0xe3, 0x91, 0xb6, 0xbd, 0xd3, 0xa4, 0x51, 0x8c, 0xf0, 0x8b, 0x30, 0xca, 0x11, 0x01, 0x32, 0x00, 0x1c, 0x9c, 0xd2,
+  0x11, 0x09, 0x1c, 0x07, 0x19, 0x9c, 0x1a, 0x07, 0x0f, 0x90, 0x03, 0x08, 0x03, 0xf0, 0x1f, 0x05, 0xe4, 0x5f, 0x11, 0xb1, 0x32, 0xe3, 0x06, 0xf8, 0xc6, 0x0a, 0x2e, 0x0e, 0x0a, 0x78, 0x83, 0x18,
+  0x11, 0xea, 0x86, 0x07, 0x86, 0x0a, 0x0d, 0x44, 0x75, 0x05, 0x3a, 0x2e, 0x06, 0x52, 0x55, 0x02, 0x14, 0x07, 0x02, 0x5c, 0x15, 0x04, 0x5a, 0x35, 0x06, 0xba, 0x2a, 0x06, 0x2c, 0x0e, 0x06, 0xa2,
+  0xfc, 0x06, 0x1a, 0x27, 0x02, 0xf0, 0x46, 0x02, 0xaa, 0x11, 0x04, 0x9a, 0x83, 0x06, 0x96, 0x0a, 0x02, 0xb6, 0x23, 0x02, 0xa2, 0x11, 0x04, 0x06, 0xf2, 0x11, 0x16, 0xb4, 0xc3, 0x00, 0x40, 0xf9,
+  0x00, 0xb6, 0x31, 0x02, 0xc8, 0x4a, 0x00, 0x84, 0x03, 0x02, 0x40, 0xa0, 0x48, 0x4f, 0x9c, 0x73, 0xbd, 0xa4, 0x43, 0x04, 0x86, 0xee, 0x22, 0xf6, 0xcd, 0xce, 0xc3, 0x00, 0x1a, 0x07, 0x11, 0x78,
+  0xf2, 0x06, 0x00, 0xb0, 0x2a, 0x20, 0xf2, 0xac, 0xfa, 0xb1, 0x11, 0xd9, 0x82, 0x95, 0x00, 0x26, 0x27, 0x22, 0x37, 0xd6, 0x60, 0xa7, 0x02, 0xb6, 0x7c, 0x00, 0x1c, 0x59, 0x11, 0x57, 0x0c, 0x72,
+  0x00, 0xe4, 0x23, 0x20, 0xfa, 0xee, 0x98, 0x15, 0x71, 0x6a, 0x3a, 0x4d, 0x5b, 0xaf, 0x63, 0x15, 0x72, 0x8d, 0x42, 0xf4, 0x8c, 0x8f, 0x63, 0xac, 0x63, 0x00, 0x92, 0x03, 0x02, 0x46, 0x63, 0x11,
+  0xf0, 0x8c, 0x0a, 0x40, 0x4d, 0x5b, 0xd0, 0x6b, 0x8c, 0x03, 0x20, 0x4e, 0x5b, 0xf2, 0x2d, 0x00, 0x24, 0x47, 0x00, 0xd2, 0x1f, 0x00, 0x74, 0x03, 0xa0, 0xcc, 0x4a, 0xe8, 0x29, 0x09, 0x32, 0x6a,
+  0x3a, 0xcb, 0x4a, 0xa6, 0x5f, 0x00, 0x78, 0x03, 0x13, 0xab, 0xae, 0x0a, 0x11, 0x31, 0xc4, 0xf7, 0x00, 0x00, 0x0b, 0x00, 0x40, 0x00, 0x00, 0x96, 0x86, 0x60, 0xb2, 0x8c, 0x92, 0x84, 0x10, 0x74,
+  0x1e, 0x2e, 0x60, 0x8d, 0x6b, 0x2c, 0x5b, 0x8d, 0x6b, 0x96, 0x86, 0x00, 0x48, 0x15, 0x02, 0xd4, 0x6d, 0x20, 0x0e, 0x7c, 0xa8, 0x66, 0x00, 0x06, 0x63, 0x40, 0x67, 0x4a, 0x6b, 0x6b, 0x3e, 0x1c,
+  0x00, 0x20, 0x2e, 0x20, 0xc9, 0x5a, 0x30, 0x2e, 0x11, 0xed, 0xac, 0x94, 0x71, 0xcd, 0x7b, 0x0a, 0x63, 0x0b, 0x63, 0x2b, 0x72, 0x51, 0xa0, 0x90, 0x94, 0xce, 0x7b, 0xee, 0x83, 0x0f, 0x84, 0x4f,
+  0x8c, 0x3c, 0x63, 0x40, 0xcd, 0x83, 0xed, 0x83, 0xe4, 0x38, 0x60, 0x6f, 0x94, 0xcd, 0x7b, 0xc9, 0x5a, 0x1c, 0xaa, 0x00, 0x8c, 0x03, 0x00, 0x00, 0x47, 0x51, 0xef, 0x7b, 0xaa, 0x5a, 0x4c, 0x9a,
+  0x5f, 0x00, 0x94, 0x58, 0x00, 0x0a, 0x23, 0x02, 0xce, 0x26, 0x40, 0x4e, 0x6b, 0xaf, 0x73, 0x4a, 0x15, 0x02, 0x0a, 0x00, 0x02, 0x2a, 0x1c, 0x01, 0x60, 0x31, 0x10, 0x7b, 0x1c, 0x15, 0x00, 0xc2,
+  0xc2, 0x11, 0x51, 0xb6, 0x0d, 0x02, 0x8c, 0x03, 0x02, 0x60, 0x23, 0x02, 0x46, 0xb8, 0x00, 0x8c, 0x46, 0x00, 0x54, 0x03, 0x00, 0x20, 0x00, 0x11, 0xb2, 0x52, 0x2e, 0x00, 0xe6, 0xe2, 0x00, 0x58,
+  0x23, 0x00, 0xb0, 0x46, 0x00, 0x62, 0x00, 0x22, 0x0c, 0x6b, 0xe2, 0x31, 0x02, 0x76, 0x35, 0x00, 0x62, 0x2a, 0x02, 0x5c, 0x2e, 0x00, 0x1a, 0x07, 0x02, 0xc4, 0xe6, 0x01, 0x0e, 0x35, 0x10, 0x94,
+  0x28, 0x07, 0x51, 0xb3, 0xa4, 0xb3, 0xa4, 0x71, 0xca, 0x0a, 0x00, 0x34, 0x2e, 0x00, 0xe2, 0x26, 0x50, 0x6d, 0x73, 0x10, 0x8c, 0xb3, 0xde, 0x18, 0x70, 0x9c, 0xf3, 0xa4, 0x34, 0xad, 0x34, 0xad,
+  0xa6, 0x03, 0x00, 0xe8, 0x18, 0x13, 0xb2, 0x42, 0x0a, 0x13, 0xcf, 0xba, 0x31, 0x11, 0x71, 0xa6, 0x2a, 0x42, 0xaf, 0x83, 0x10, 0x8c, 0xf8, 0x7b, 0x00, 0xb4, 0x03, 0x40, 0x72, 0x94, 0xd7, 0xc5,
+  0x50, 0xee, 0x62, 0xd3, 0xa4, 0x38, 0xce, 0x75, 0xb5, 0x20, 0x40, 0x04, 0x84, 0x03, 0x1f, 0x30, 0x00, 0x20, 0x01, 0x19, 0x9c, 0x8e, 0x03, 0x0e, 0x42, 0x0e, 0x0a, 0x2a, 0x0e, 0x08, 0xbe, 0x11,
+  0x03, 0x30, 0x75, 0x08, 0xb2, 0x71, 0x2e, 0xf1, 0xb4, 0x26, 0x4e, 0x08, 0x32, 0x0e, 0x08, 0xda, 0x18, 0x0d, 0x8c, 0x03, 0x1a, 0xb5, 0x38, 0x0e, 0x06, 0x06, 0x60, 0x26, 0x53, 0xbd, 0x20, 0xc7,
+  0x04, 0x6c, 0x7c, 0x00, 0x32, 0x2e, 0x13, 0x32, 0xd0, 0x31, 0x06, 0x4a, 0x35, 0x0c, 0xde, 0x58, 0x04, 0x84, 0x03, 0x01, 0x76, 0x31, 0x05, 0xac, 0x11, 0x02, 0x64, 0x55, 0x04, 0x1a, 0x07, 0x04,
+  0x54, 0x3c, 0x06, 0x12, 0x99, 0x04, 0x2e, 0x07, 0x71, 0x98, 0xe6, 0x73, 0xbd, 0x2e, 0x94, 0x57, 0x06, 0xf9, 0x00, 0x62, 0x6e, 0x22, 0xb8, 0xe6, 0xfe, 0x38, 0x02, 0x6e, 0x35, 0x00, 0xc4, 0x0a,
+  0x02, 0x92, 0x03, 0x11, 0x78, 0xc2, 0x6a, 0x22, 0xf9, 0xee, 0x28, 0xa0, 0x22, 0x78, 0xde, 0x98, 0x2a, 0x02, 0x72, 0xe7, 0x00, 0x54, 0x35, 0x00, 0x48, 0x0e, 0x20, 0x4f, 0x9c, 0xa8, 0xae, 0x02,
+  0xa4, 0x95, 0x22, 0x0e, 0x8c, 0x88, 0x80, 0x00, 0x98, 0x03, 0x40, 0x1a, 0xf7, 0x94, 0xc5, 0x9e, 0x23, 0x20, 0x74, 0xbd, 0xf6, 0x6a, 0x00, 0x22, 0x07, 0x40, 0xb3, 0x84, 0x31, 0x7c, 0xf8, 0x5b,
+  0x22, 0x0c, 0x53, 0xc0, 0x38, 0x20, 0xaf, 0x6b, 0x74, 0x0a, 0x11, 0x52, 0x7a, 0x3c, 0x00, 0xa2, 0x0a, 0x40, 0x92, 0x84, 0xd4, 0x8c, 0x5a, 0x03, 0x02, 0xc2, 0xb0, 0x00, 0xde, 0x0a, 0x02, 0xa2,
+  0x31, 0x00, 0x32, 0x7c, 0x00, 0x2a, 0x0e, 0x80, 0x09, 0x32, 0xab, 0x42, 0xcc, 0x4a, 0xcb, 0x4a, 0x40, 0x63, 0x60, 0x8a, 0x42, 0xcf, 0x6b, 0xf0, 0x73, 0xf4, 0x26, 0x00, 0xbe, 0x8d, 0x20, 0xf4,
+  0x94, 0xc0, 0x5f, 0x02, 0x18, 0x8a, 0x00, 0x52, 0xfb, 0x00, 0x38, 0x55, 0xb0, 0x0c, 0x53, 0x8a, 0x4a, 0x50, 0x7c, 0xef, 0x73, 0xea, 0x52, 0x6c, 0x64, 0x51, 0x00, 0x54, 0x98, 0x50, 0x6b, 0xea,
+  0x52, 0x68, 0x42, 0x30, 0x2a, 0x20, 0xac, 0x73, 0x4a, 0x78, 0x40, 0x26, 0x42, 0x8c, 0x6b, 0x3c, 0x91, 0x30, 0x0a, 0x5b, 0x2a, 0x02, 0x5c, 0x52, 0x73, 0xea, 0x5a, 0xad, 0x73, 0x74, 0x58, 0x20,
+  0x4b, 0x6b, 0xae, 0x94, 0x20, 0xee, 0x7b, 0xf8, 0xa9, 0x00, 0x9e, 0x11, 0x20, 0x4c, 0x6b, 0xda, 0x4d, 0xf0, 0x01, 0x4b, 0x6b, 0xb1, 0x9c, 0x2e, 0x8c, 0xcd, 0x83, 0x2e, 0x8c, 0x4f, 0x94, 0x6b,
+  0x73, 0xe9, 0x62, 0x3e, 0x91, 0x40, 0x4f, 0x8c, 0xad, 0x7b, 0xfc, 0x7b, 0x20, 0x71, 0x8c, 0xc6, 0x66, 0x11, 0x10, 0x14, 0x3c, 0x15, 0x8e, 0x56, 0x23, 0x02, 0xbe, 0x11, 0x11, 0xcf, 0x2a, 0x43,
+  0x13, 0x51, 0x54, 0x86, 0x02, 0x7a, 0xe6, 0x00, 0x4c, 0x5f, 0x02, 0x46, 0x5f, 0x04, 0xc4, 0x5f, 0x02, 0x4e, 0x2a, 0x00, 0x76, 0x3f, 0x00, 0xf8, 0x06, 0x00, 0x0a, 0x0e, 0x02, 0x5e, 0xe6, 0x00,
+  0xda, 0x34, 0x11, 0xf0, 0xe0, 0x14, 0x02, 0xc0, 0x18, 0x11, 0xcf, 0x0e, 0x60, 0x00, 0xdc, 0x26, 0x00, 0x3a, 0x07, 0x02, 0xbe, 0x38, 0x01, 0x66, 0x9f, 0x00, 0x0e, 0x15, 0x01, 0x4a, 0x35, 0x11,
+  0x71, 0x5a, 0x6e, 0x00, 0x04, 0x00, 0x02, 0xe4, 0x26, 0x08, 0x1a, 0x35, 0x01, 0x64, 0xea, 0x12, 0x94, 0xe6, 0x1f, 0x10, 0x51, 0xc8, 0x0a, 0x21, 0xa4, 0x30, 0x76, 0x03, 0x42, 0xef, 0x8b, 0xef,
+  0x8b, 0x38, 0x35, 0x00, 0x9a, 0x0a, 0x32, 0xef, 0x8b, 0x30, 0x52, 0x2a, 0x12, 0x9c, 0x06, 0x20, 0x02, 0xb8, 0x0a, 0x40, 0x72, 0x9c, 0xb2, 0x9c, 0x92, 0x03, 0x11, 0xb3, 0x32, 0x07, 0x00, 0x7a,
+  0x07, 0x62, 0x75, 0xb5, 0x96, 0xbd, 0x75, 0xb5, 0xb6, 0x1c, 0x22, 0xb2, 0x9c, 0x54, 0x07, 0x02, 0x68, 0x03, 0x06, 0xb8, 0x2a, 0x0e, 0x36, 0x0e, 0x0f, 0x22, 0x07, 0x09, 0x08, 0x18, 0x07, 0x0f,
+  0x1e, 0x4e, 0x05, 0x04, 0x94, 0x2a, 0x0e, 0x7c, 0x23, 0x04, 0x4e, 0x15, 0x14, 0x11, 0x9c, 0x4a, 0x01, 0xec, 0x06, 0x04, 0x58, 0xdc, 0x0e, 0x68, 0x7c, 0x07, 0x44, 0x95, 0x05, 0x9e, 0x4a, 0x05,
+  0x6e, 0x1c, 0x02, 0x92, 0x63, 0x01, 0xae, 0x0a, 0x01, 0xde, 0x18, 0x14, 0xbd, 0x38, 0x35, 0x04, 0xc6, 0x18, 0x04, 0xea, 0x18, 0x08, 0xc6, 0x51, 0x24, 0xb4, 0xc5, 0x18, 0xf9, 0x04, 0x0e, 0x20,
+  0x02, 0x78, 0x23, 0x04, 0xd2, 0x11, 0x08, 0x32, 0x07, 0x02, 0x42, 0x75, 0x08, 0x10, 0x00, 0x02, 0xde, 0x4a, 0x00, 0xfa, 0x00, 0x20, 0x32, 0xb5, 0x26, 0x07, 0x02, 0x0c, 0x19, 0x02, 0xbe, 0x4a,
+  0x02, 0x54, 0x15, 0x00, 0x84, 0x0a, 0x20, 0x12, 0xad, 0xd8, 0x18, 0x00, 0x36, 0x0e, 0x00, 0x0e, 0x07, 0x02, 0xcc, 0x8a, 0x20, 0x16, 0xd6, 0xb4, 0x11, 0x00, 0x72, 0x55, 0x00, 0xf4, 0xee, 0x22,
+  0xd9, 0xe6, 0xbc, 0x35, 0x00, 0xac, 0x03, 0x00, 0x96, 0x99, 0x11, 0x33, 0x6a, 0x0e, 0x00, 0xce, 0x0a, 0x00, 0x60, 0x15, 0x00, 0xfc, 0x2a, 0x00, 0xaa, 0x23, 0x51, 0xd0, 0x6b, 0x51, 0x7c, 0xb3,
+  0x7a, 0x38, 0x00, 0x5a, 0x0a, 0x20, 0xf4, 0x94, 0x82, 0x1c, 0x00, 0x9e, 0x8d, 0x00, 0x82, 0x38, 0x00, 0x16, 0x00, 0x20, 0xcf, 0x6b, 0x06, 0x07, 0x10, 0x52, 0x2c, 0x0e, 0x01, 0xa8, 0x31, 0x00,
+  0x1a, 0x27, 0x21, 0x0d, 0x53, 0x70, 0xe2, 0x50, 0x63, 0x52, 0x7c, 0x73, 0x7c, 0xb0, 0x0a, 0x00, 0x10, 0xed, 0x11, 0x51, 0x3c, 0x5c, 0x20, 0xb3, 0x8c, 0x46, 0x91, 0x00, 0x78, 0xb4, 0x20, 0xf0,
+  0x73, 0xae, 0x11, 0x60, 0x4a, 0x3a, 0x4d, 0x5b, 0xb3, 0x8c, 0x0c, 0x27, 0x11, 0x51, 0xc6, 0x86, 0x40, 0x71, 0x84, 0x6d, 0x63, 0xb6, 0x7f, 0x00, 0x14, 0xb8, 0x80, 0x0b, 0x5b, 0xa9, 0x4a, 0x8c,
+  0x6b, 0x2f, 0x7c, 0xfa, 0x54, 0x61, 0x4b, 0x63, 0xe5, 0x39, 0x67, 0x4a, 0x1a, 0x6a, 0x21, 0x7c, 0xed, 0x9a, 0x5f, 0x00, 0x5e, 0x7f, 0x11, 0x4b, 0x88, 0x03, 0x00, 0xac, 0x46, 0x00, 0xdc, 0xc2,
+  0x00, 0xa2, 0x66, 0x00, 0xee, 0x34, 0x11, 0xae, 0x4a, 0xc6, 0x20, 0xca, 0x5a, 0xe8, 0x7b, 0x40, 0x50, 0x8c, 0xad, 0x7b, 0xb8, 0x8d, 0x00, 0x5e, 0x98, 0x01, 0x3c, 0x5c, 0x90, 0x7b, 0x4b, 0x73,
+  0x2f, 0x8c, 0x4c, 0x6b, 0xce, 0x83, 0x44, 0x46, 0x00, 0x4c, 0x1c, 0x00, 0x38, 0x63, 0x00, 0x08, 0x31, 0x00, 0xca, 0x18, 0x00, 0x8a, 0x31, 0x11, 0x8f, 0x92, 0xa2, 0x02, 0xda, 0x6d, 0x04, 0xf6,
+  0x4d, 0x11, 0x11, 0x68, 0x38, 0x02, 0x30, 0xbf, 0x13, 0x11, 0xaa, 0x58, 0x11, 0x72, 0x1e, 0x51, 0x00, 0x5a, 0x03, 0x12, 0xd3, 0x84, 0x51, 0x01, 0xd6, 0x02, 0x11, 0xf0, 0x72, 0x3f, 0x00, 0x78,
+  0x03, 0x11, 0x71, 0x74, 0x15, 0x11, 0x71, 0x8a, 0x63, 0x00, 0xf0, 0x26, 0x04, 0x5e, 0x1c, 0x00, 0x14, 0x0e, 0x22, 0x30, 0x8c, 0x40, 0x15, 0x01, 0x68, 0x27, 0x01, 0x58, 0xca, 0x11, 0x6d, 0xda,
+  0x0a, 0x22, 0xcf, 0x83, 0x48, 0x8e, 0x00, 0x36, 0x03, 0x22, 0x14, 0xad, 0x26, 0x07, 0x00, 0xa0, 0x0a, 0x02, 0xaa, 0x1f, 0x20, 0xef, 0x8b, 0x20, 0x03, 0x33, 0xae, 0x83, 0x71, 0x50, 0x0e, 0x01,
+  0x5e, 0x03, 0x03, 0x06, 0x0e, 0x01, 0xe6, 0x06, 0x00, 0xa4, 0x2a, 0x01, 0x50, 0x1c, 0x02, 0x34, 0x03, 0x01, 0xa8, 0xad, 0x30, 0xa4, 0x71, 0x94, 0x8a, 0x03, 0x06, 0xbe, 0x38, 0x02, 0x12, 0x20,
+  0xc0, 0xf3, 0xa4, 0x31, 0x94, 0x96, 0xbd, 0x59, 0xd6, 0x9a, 0xde, 0x76, 0xbd, 0x9e, 0x07, 0x00, 0xf6, 0x0a, 0x07, 0x40, 0x2e, 0x03, 0x7a, 0x03, 0x05, 0x50, 0x0e, 0x0e, 0xa0, 0x0a, 0x05, 0xbe,
+  0x11, 0x25, 0x91, 0xa4, 0x32, 0x0e, 0x0b, 0xca, 0x58, 0x0b, 0x7c, 0x23, 0x0e, 0x0a, 0x27, 0x0e, 0x9c, 0x2a, 0x15, 0xbd, 0x26, 0x55, 0x0a, 0xaa, 0x51, 0x1a, 0xb5, 0x20, 0x6e, 0x0c, 0x5e, 0x15,
+  0x02, 0x14, 0x67, 0x04, 0xe0, 0x38, 0x24, 0x52, 0xbd, 0xbc, 0x71, 0x02, 0x02, 0x80, 0x04, 0x6e, 0x1c, 0x06, 0x1c, 0x67, 0x08, 0xc4, 0x71, 0x06, 0xa2, 0x23, 0x02, 0xdc, 0x06, 0x15, 0xb4, 0xce,
+  0x18, 0x13, 0xb4, 0xe8, 0xd1, 0x17, 0x36, 0x56, 0x15, 0x02, 0xae, 0x7c, 0x22, 0x77, 0xde, 0x42, 0x2e, 0x04, 0x22, 0x40, 0x02, 0x4a, 0x35, 0x02, 0xaa, 0x43, 0x02, 0x4c, 0x15, 0x13, 0x16, 0xaa,
+  0x2a, 0x05, 0x62, 0xae, 0x30, 0xce, 0xd5, 0xcd, 0x88, 0x03, 0x00, 0x6e, 0x03, 0x04, 0x8e, 0x23, 0x01, 0x56, 0x1c, 0x01, 0x7e, 0x95, 0x61, 0x3b, 0xf7, 0x74, 0xbd, 0xcd, 0x8b, 0x0c, 0xbd, 0x12,
+  0xbd, 0xe6, 0x11, 0x80, 0x3b, 0xf7, 0x94, 0xbd, 0xee, 0x8b, 0x94, 0xc5, 0xb6, 0x43, 0x00, 0x94, 0x35, 0x02, 0xc4, 0x9c, 0x00, 0x62, 0x27, 0x10, 0x72, 0xaa, 0xa9, 0x10, 0x42, 0xd0, 0x06, 0x00,
+  0xa4, 0x31, 0x00, 0xa6, 0x11, 0x20, 0x72, 0x84, 0x80, 0x5f, 0x20, 0xec, 0x4a, 0x58, 0x03, 0x00, 0x4e, 0x43, 0x20, 0xaf, 0x6b, 0x10, 0x07, 0x01, 0x54, 0x4e, 0x32, 0x84, 0x4e, 0x5b, 0x1c, 0x8e,
+  0x40, 0xd0, 0x6b, 0x0d, 0x4b, 0xec, 0x71, 0x20, 0xed, 0x4a, 0x2c, 0x75, 0x00, 0xca, 0x03, 0x11, 0x10, 0x48, 0x5c, 0x00, 0xcc, 0x18, 0x00, 0x0c, 0x07, 0x40, 0x31, 0x74, 0x6e, 0x63, 0xc0, 0x0a,
+  0x00, 0x8a, 0x03, 0x60, 0xcb, 0x52, 0xb3, 0x8c, 0x4d, 0x63, 0xc0, 0x86, 0x00, 0x82, 0xdb, 0x00, 0x0a, 0xdf, 0x20, 0x2b, 0x5b, 0xbc, 0x38, 0x00, 0x7c, 0x66, 0x20, 0x0b, 0x5b, 0x3e, 0x78, 0x20,
+  0x4b, 0x63, 0x6a, 0x4a, 0x11, 0x8c, 0x7e, 0x78, 0x00, 0x9e, 0x58, 0x00, 0x38, 0x4a, 0x00, 0x9e, 0x46, 0xa2, 0xc9, 0x5a, 0xad, 0x73, 0x0b, 0x5b, 0xea, 0x5a, 0x8d, 0x6b, 0x20, 0xb8, 0x20, 0x8d,
+  0x73, 0xde, 0xa2, 0x00, 0x90, 0xfb, 0x20, 0x8d, 0x73, 0x5e, 0x51, 0x00, 0x2a, 0x91, 0x00, 0x96, 0xd4, 0x11, 0x6c, 0x9c, 0xd4, 0x00, 0xf4, 0x1f, 0x00, 0x1e, 0x07, 0xc2, 0x6c, 0x73, 0x0f, 0x84,
+  0x0b, 0x63, 0x8e, 0x73, 0xef, 0x7b, 0x6d, 0x73, 0xea, 0x74, 0x20, 0x8f, 0x7b, 0x0c, 0x15, 0x02, 0x66, 0x86, 0x01, 0xd8, 0x4d, 0x01, 0x38, 0x1c, 0x02, 0xb8, 0x5b, 0x02, 0x92, 0x5f, 0x02, 0x36,
+  0x63, 0x02, 0x4c, 0xa6, 0x01, 0x82, 0x3f, 0x03, 0x6e, 0x31, 0x00, 0xc4, 0x2d, 0x02, 0x6e, 0x8a, 0x00, 0x1a, 0x0e, 0x00, 0x6c, 0x18, 0x00, 0x64, 0xff, 0x00, 0xdc, 0xe2, 0x02, 0xfe, 0x26, 0x41,
+  0x6d, 0x73, 0x2c, 0x6b, 0x1c, 0x07, 0x41, 0x73, 0x4d, 0x73, 0x6d, 0x1e, 0x07, 0x00, 0x86, 0x11, 0x11, 0x8e, 0xe0, 0x18, 0x33, 0xb3, 0x9c, 0x10, 0x52, 0x07, 0x00, 0x86, 0x03, 0x02, 0x66, 0xf8,
+  0x20, 0x92, 0x9c, 0x06, 0x07, 0x10, 0xcf, 0xd4, 0x03, 0x50, 0x7b, 0x0f, 0x8c, 0xd2, 0xa4, 0x20, 0xc7, 0x00, 0x38, 0x00, 0x02, 0x26, 0x07, 0x00, 0x12, 0x07, 0x11, 0x51, 0xf6, 0x06, 0x00, 0x34,
+  0x1c, 0x00, 0x80, 0x23, 0x11, 0x30, 0xb4, 0x18, 0x04, 0x7c, 0x1c, 0x11, 0xb2, 0x3c, 0x0e, 0x02, 0x04, 0x00, 0x02, 0x46, 0x2e, 0x02, 0x20, 0x0e, 0x00, 0x60, 0x0e, 0x11, 0x50, 0xfc, 0x18, 0x00,
+  0x04, 0x00, 0x00, 0xbc, 0x11, 0x30, 0xaf, 0x83, 0x92, 0x5c, 0x12, 0x40, 0x94, 0x72, 0x94, 0xd7, 0x88, 0xf5, 0x21, 0xbd, 0xb3, 0x8c, 0x35, 0x03, 0x8c, 0x03, 0x0b, 0x8a, 0x23, 0x1b, 0x51, 0x8a,
+  0x03, 0x04, 0x62, 0x1c, 0x05, 0x90, 0x03, 0x17, 0xa4, 0xc6, 0x58, 0x0d, 0xa8, 0x71, 0x07, 0xd4, 0xbf, 0x0e, 0x8e, 0x03, 0x05, 0x6e, 0x1c, 0x17, 0x11, 0x2c, 0x6e, 0x07, 0xb8, 0x71, 0x05, 0x9c,
+  0x0a, 0x06, 0x2c, 0x0e, 0x0a, 0x10, 0x00, 0x04, 0x2c, 0x4e, 0x13, 0x32, 0x8e, 0x03, 0x04, 0x86, 0x43, 0x1b, 0x93, 0x2c, 0x6e, 0x06, 0x32, 0x6e, 0x04, 0x02, 0x07, 0x0a, 0xd0, 0x31, 0x04, 0xbe,
+  0x18, 0x22, 0x94, 0xc5, 0xf0, 0x06, 0x04, 0x02, 0x40, 0x06, 0x5a, 0x15, 0x02, 0x0a, 0x07, 0x02, 0x2a, 0x2e, 0x02, 0x0e, 0x40, 0x04, 0xf6, 0xf1, 0x04, 0x54, 0x4e, 0x02, 0xbc, 0x03, 0x13, 0x16,
+  0x82, 0x3c, 0x13, 0x78, 0xce, 0x11, 0x01, 0x2c, 0xc0, 0x01, 0x0e, 0x0e, 0x02, 0xd0, 0xaa, 0x02, 0x36, 0xa7, 0x01, 0xb0, 0x31, 0x03, 0x06, 0x27, 0x00, 0x6a, 0x1c, 0x51, 0x4f, 0x9c, 0x68, 0x5a,
+  0x94, 0xb6, 0x60, 0x60, 0xb1, 0xa4, 0xd1, 0xa4, 0xd9, 0xe6, 0x70, 0x35, 0x11, 0xfa, 0x42, 0xb9, 0x02, 0x44, 0x47, 0x02, 0x66, 0xa0, 0x00, 0xbc, 0x03, 0x02, 0x5c, 0x43, 0x20, 0xcf, 0x6b, 0x52,
+  0x15, 0x00, 0x78, 0x03, 0x00, 0x1e, 0x0e, 0x00, 0xee, 0x06, 0x20, 0xf0, 0x6b, 0x0e, 0x07, 0x00, 0x8c, 0x0a, 0x20, 0x8f, 0x63, 0x64, 0x55, 0x10, 0x4e, 0x78, 0x03, 0x12, 0x4a, 0x56, 0x71, 0x00,
+  0x84, 0xe2, 0x11, 0x11, 0x7e, 0x91, 0x00, 0x1c, 0x20, 0x80, 0x97, 0xa5, 0x56, 0x9d, 0x72, 0x84, 0x72, 0x7c, 0x42, 0x63, 0x42, 0x72, 0x84, 0xcf, 0x6b, 0x1c, 0x07, 0x80, 0xcf, 0x6b, 0x31, 0x7c,
+  0xd0, 0x73, 0xf0, 0x73, 0xda, 0x18, 0x00, 0x6c, 0x1c, 0xc0, 0x6d, 0x63, 0x10, 0x7c, 0xb2, 0x94, 0xb2, 0x8c, 0x6d, 0x63, 0xa9, 0x4a, 0x22, 0x83, 0x60, 0xca, 0x52, 0xa9, 0x52, 0x2b, 0x5b, 0x3e,
+  0x78, 0x20, 0x27, 0x42, 0x7e, 0xa6, 0x40, 0xad, 0x73, 0xcd, 0x73, 0xfa, 0x54, 0x20, 0xc5, 0x31, 0x84, 0x5f, 0x20, 0xa9, 0x52, 0x42, 0x4a, 0x00, 0xa8, 0x0a, 0x20, 0xad, 0x6b, 0x70, 0x55, 0x11,
+  0xca, 0x52, 0x23, 0x02, 0xd4, 0xde, 0x60, 0x0f, 0x84, 0xb2, 0x9c, 0xd2, 0x9c, 0x8a, 0x51, 0x22, 0x4c, 0x6b, 0xa8, 0x5f, 0x10, 0x2b, 0x9e, 0xcd, 0x70, 0x62, 0xad, 0x7b, 0xd2, 0x9c, 0x2f, 0x8c,
+  0x06, 0xca, 0x00, 0x22, 0x55, 0x00, 0x0c, 0x55, 0x00, 0xea, 0x4d, 0x02, 0xec, 0xb7, 0x11, 0x52, 0x94, 0x18, 0x01, 0x3c, 0x2a, 0x01, 0xa2, 0x3f, 0x01, 0xea, 0x14, 0x01, 0x60, 0x15, 0x00, 0x6c,
+  0x5f, 0x02, 0x32, 0x91, 0x15, 0x31, 0x18, 0x8a, 0x02, 0xb0, 0x38, 0x02, 0x70, 0x0a, 0x02, 0xde, 0x4d, 0x00, 0xc4, 0x1f, 0x00, 0xb0, 0x31, 0x00, 0xd2, 0x7b, 0x02, 0x44, 0x03, 0x00, 0xa0, 0x0a,
+  0x00, 0x84, 0x35, 0x03, 0x0a, 0x00, 0x10, 0x6b, 0x78, 0x2a, 0x00, 0x8a, 0xff, 0x02, 0xa0, 0x66, 0x02, 0x0c, 0x20, 0x10, 0xef, 0x9e, 0x1c, 0x03, 0x86, 0x31, 0x00, 0x02, 0x00, 0x00, 0xb8, 0x55,
+  0x22, 0xcf, 0x83, 0xec, 0x0d, 0x31, 0x51, 0x94, 0x91, 0x60, 0x0a, 0x00, 0xd2, 0x26, 0x42, 0xf3, 0xa4, 0x51, 0x94, 0x72, 0x03, 0x04, 0xda, 0x26, 0x02, 0x36, 0x00, 0x24, 0x8e, 0x7b, 0x0c, 0x00,
+  0x22, 0x71, 0x9c, 0xd4, 0x38, 0x20, 0x71, 0x94, 0xca, 0x0a, 0x03, 0xb6, 0x18, 0x01, 0x16, 0x1c, 0x20, 0xb2, 0x9c, 0x08, 0x19, 0x20, 0x50, 0x94, 0xdc, 0x0a, 0x00, 0xc2, 0x0a, 0x04, 0x4c, 0x27,
+  0x00, 0xa8, 0x03, 0x11, 0xb3, 0x9e, 0x1c, 0x00, 0xb2, 0x23, 0x31, 0xf3, 0xa4, 0x96, 0xe8, 0x11, 0x0e, 0x20, 0x0e, 0x03, 0x0c, 0x19, 0x08, 0x82, 0x03, 0x28, 0x9c, 0x91, 0xb2, 0x31, 0x03, 0x90,
+  0x03, 0x0e, 0xa6, 0x0a, 0x03, 0x34, 0x75, 0x0d, 0xea, 0x5f, 0x09, 0x4e, 0x15, 0x01, 0x2a, 0x0e, 0x05, 0xda, 0x3f, 0x06, 0x52, 0x7c, 0x0e, 0xbe, 0x71, 0x03, 0x72, 0x43, 0x02, 0x28, 0x0e, 0x02,
+  0x32, 0xce, 0x04, 0xd2, 0x31, 0x04, 0x88, 0x23, 0x01, 0x18, 0x07, 0x03, 0x84, 0x23, 0x02, 0x04, 0xa0, 0x0a, 0x70, 0x1c, 0x04, 0x6c, 0x5c, 0x06, 0xba, 0x2a, 0x04, 0xfa, 0x38, 0x08, 0x3c, 0x15,
+  0x02, 0xa6, 0x6a, 0x08, 0x92, 0x0a, 0x06, 0x60, 0x35, 0x00, 0xd4, 0x31, 0x00, 0xba, 0x23, 0x33, 0x77, 0xde, 0xb4, 0xf8, 0x91, 0x04, 0x9c, 0x43, 0x04, 0xb8, 0x4a, 0x13, 0x16, 0x14, 0x40, 0x11,
+  0xf5, 0xc6, 0x31, 0x02, 0xf0, 0x71, 0x00, 0x06, 0xbd, 0x60, 0xd9, 0xee, 0x16, 0xce, 0x12, 0xb5, 0xae, 0x11, 0x11, 0x78, 0xc0, 0xa3, 0x00, 0x22, 0x92, 0x22, 0xd9, 0xee, 0x9a, 0x0a, 0x00, 0x68,
+  0x03, 0x00, 0x46, 0x0e, 0x40, 0x12, 0xb5, 0x16, 0xce, 0xfa, 0x83, 0x13, 0x16, 0x7c, 0x8e, 0x00, 0x0e, 0x19, 0x00, 0xa0, 0x75, 0x02, 0x2e, 0x00, 0x02, 0xec, 0x83, 0x20, 0x11, 0x74, 0xb8, 0x66,
+  0x00, 0x52, 0x4a, 0x00, 0xbc, 0x11, 0x31, 0xb3, 0x8c, 0x6e, 0xa6, 0x5c, 0x20, 0x4d, 0x53, 0x9c, 0x03, 0x00, 0xfa, 0x2d, 0x00, 0x38, 0x1c, 0x02, 0xe2, 0x3f, 0x31, 0xec, 0x52, 0x11, 0xea, 0x74,
+  0x22, 0x52, 0x7c, 0x58, 0x47, 0x00, 0x9e, 0x0a, 0x00, 0x64, 0x15, 0x20, 0xcf, 0x6b, 0x38, 0x0e, 0x00, 0xcc, 0x11, 0x00, 0xc4, 0x3f, 0x40, 0xd3, 0x8c, 0x55, 0x9d, 0x46, 0x98, 0x60, 0xef, 0x73,
+  0xaf, 0x6b, 0xeb, 0x52, 0xb0, 0x5f, 0x00, 0xa4, 0x0a, 0x60, 0x13, 0x95, 0x10, 0x7c, 0xb2, 0x8c, 0xce, 0x58, 0x70, 0xa9, 0x4a, 0xea, 0x5a, 0x0b, 0x5b, 0x6c, 0x52, 0x31, 0xb0, 0x4a, 0x89, 0x4a,
+  0x4c, 0x63, 0x27, 0x3a, 0xc9, 0x52, 0x2b, 0x63, 0x2e, 0x07, 0x00, 0x38, 0x4a, 0x00, 0x4c, 0xed, 0x20, 0x90, 0x8c, 0xd2, 0x6d, 0x20, 0x0b, 0x5b, 0x86, 0x03, 0x30, 0xa9, 0x4a, 0x4c, 0x92, 0x8a,
+  0x30, 0x73, 0x0f, 0x7c, 0x22, 0xb8, 0x60, 0x91, 0x94, 0xef, 0x83, 0x4c, 0x6b, 0xd8, 0x02, 0x10, 0x0b, 0x46, 0x43, 0x10, 0x73, 0x20, 0xd1, 0x11, 0x6c, 0x7a, 0x23, 0x80, 0x4c, 0x6b, 0xaa, 0x5a,
+  0xea, 0x62, 0x89, 0x52, 0x9e, 0x03, 0x11, 0xae, 0xe2, 0x74, 0x00, 0x4e, 0x6a, 0x13, 0x31, 0x24, 0xd8, 0x02, 0x52, 0x23, 0x02, 0x74, 0x58, 0x00, 0xae, 0x1f, 0x02, 0xec, 0x46, 0x02, 0xee, 0x9b,
+  0x00, 0x40, 0x07, 0x02, 0x48, 0xbf, 0x04, 0xd0, 0x54, 0x04, 0x72, 0x66, 0x02, 0x2e, 0x15, 0x02, 0x7e, 0x0e, 0x20, 0x76, 0xb5, 0x20, 0x43, 0x00, 0x34, 0xbc, 0x10, 0x6e, 0xf4, 0x8d, 0x01, 0xee,
+  0x03, 0x13, 0x8e, 0xc8, 0x31, 0x11, 0x8e, 0xbc, 0x31, 0x00, 0x7c, 0x03, 0x02, 0xf4, 0x03, 0x04, 0x62, 0x58, 0x20, 0xef, 0x83, 0x24, 0x00, 0x00, 0x02, 0x31, 0x20, 0x0f, 0x8c, 0x28, 0x03, 0x00,
+  0x78, 0x03, 0x13, 0xb2, 0x82, 0xf8, 0x11, 0x71, 0x68, 0x03, 0x13, 0xcf, 0x44, 0x1c, 0x00, 0x18, 0x07, 0x00, 0x6e, 0x03, 0x00, 0x8c, 0x0a, 0x22, 0xae, 0x83, 0xc8, 0x0a, 0x00, 0x56, 0x03, 0x60,
+  0xd2, 0xa4, 0xef, 0x8b, 0xae, 0x83, 0xfc, 0x06, 0x00, 0x50, 0x07, 0x60, 0xef, 0x8b, 0x30, 0x8c, 0xef, 0x8b, 0x54, 0x15, 0x10, 0x92, 0xc4, 0x03, 0xf2, 0x0e, 0xac, 0x55, 0xb5, 0x92, 0xa4, 0x92,
+  0xa4, 0x30, 0x94, 0x91, 0x9c, 0xb2, 0x9c, 0x13, 0xad, 0xb6, 0xbd, 0xb6, 0xc5, 0xf3, 0xac, 0xd2, 0xa4, 0x50, 0x94, 0xd2, 0xa4, 0x71, 0x9c, 0x24, 0x00, 0x00, 0xb8, 0x03, 0x11, 0xef, 0xac, 0x23,
+  0x20, 0x55, 0xb5, 0x20, 0x59, 0x24, 0x11, 0x84, 0xe0, 0x3f, 0x1b, 0x91, 0xa0, 0x0a, 0x06, 0x8a, 0x03, 0x02, 0x8a, 0xb1, 0x05, 0xa6, 0x0a, 0x49, 0xa4, 0x6f, 0xa4, 0x8f, 0x3a, 0x35, 0x00, 0xd0,
+  0xff, 0x1a, 0xf0, 0x1e, 0x4e, 0x05, 0x08, 0x67, 0x0c, 0xd0, 0x38, 0x1d, 0x11, 0xe8, 0x3f, 0x04, 0x96, 0x03, 0x06, 0xf8, 0x66, 0x24, 0x11, 0xb5, 0x84, 0x43, 0x02, 0x52, 0x1c, 0x41, 0x6f, 0xa4,
+  0x6f, 0xa4, 0xa4, 0x6a, 0x03, 0xf6, 0x9f, 0x01, 0x10, 0xa7, 0x03, 0xc6, 0x03, 0x00, 0xec, 0x7f, 0x03, 0x4a, 0x15, 0x03, 0x72, 0x5c, 0x06, 0x74, 0x1c, 0x04, 0x0a, 0x67, 0x08, 0x5c, 0x55, 0x0a,
+  0x02, 0x00, 0x06, 0xc4, 0x31, 0x24, 0xb4, 0xc5, 0xde, 0x38, 0x02, 0x3c, 0x35, 0x02, 0xe8, 0x1f, 0x00, 0x9a, 0xc3, 0x11, 0x77, 0x08, 0x00, 0x02, 0x1c, 0x00, 0x51, 0x77, 0xde, 0x6f, 0x9c, 0x93,
+  0x2a, 0x00, 0x13, 0x36, 0xf4, 0x11, 0x02, 0x06, 0x59, 0x00, 0xfa, 0x3f, 0x04, 0xce, 0x31, 0x00, 0x0a, 0x40, 0x00, 0xc4, 0x31, 0x40, 0x74, 0xbd, 0xb8, 0xe6, 0x14, 0x00, 0x31, 0x73, 0xbd, 0x98,
+  0x18, 0x47, 0x00, 0xda, 0x11, 0x00, 0x9a, 0x23, 0x00, 0x0c, 0x32, 0xb1, 0x1a, 0xf7, 0xad, 0x83, 0x33, 0xb5, 0x3b, 0xf7, 0xf2, 0xac, 0xb5, 0x56, 0x04, 0x00, 0x78, 0x1c, 0x11, 0x90, 0x7a, 0xc7,
+  0x00, 0x5e, 0x0e, 0x01, 0x68, 0x15, 0x01, 0x04, 0x19, 0x02, 0x88, 0x35, 0x22, 0x8b, 0x3a, 0xe4, 0x46, 0x00, 0x80, 0x03, 0x00, 0xb8, 0x11, 0x22, 0xcc, 0x4a, 0xe6, 0x26, 0x00, 0x26, 0x15, 0x02,
+  0x8e, 0x31, 0x00, 0xac, 0x23, 0x00, 0x3e, 0x1c, 0x20, 0xb3, 0x8c, 0xb6, 0xf7, 0x00, 0xce, 0x0a, 0x02, 0xf0, 0x51, 0xf0, 0x05, 0x4d, 0x5b, 0x6a, 0x42, 0xd3, 0x8c, 0xf0, 0x73, 0xcb, 0x4a, 0xcf,
+  0x6b, 0xec, 0x52, 0x8a, 0x42, 0x6d, 0x63, 0x6e, 0x63, 0xd4, 0xf7, 0x00, 0xee, 0x1f, 0x20, 0x8e, 0x6b, 0x04, 0x9c, 0x02, 0x98, 0x2a, 0x20, 0x0f, 0x74, 0xcc, 0x86, 0x00, 0x12, 0x07, 0x51, 0x69,
+  0x42, 0xea, 0x52, 0x2b, 0x38, 0xed, 0x51, 0x2b, 0x63, 0xa9, 0x52, 0x8c, 0x50, 0x63, 0x00, 0x42, 0x63, 0x22, 0x0b, 0x5b, 0xf2, 0x82, 0x50, 0x70, 0x8c, 0x50, 0x8c, 0xce, 0x26, 0xe6, 0x30, 0x6b,
+  0xee, 0x7b, 0x6a, 0x63, 0x40, 0xaa, 0x52, 0xca, 0x52, 0x5c, 0x07, 0xc0, 0x0c, 0x5b, 0x8a, 0x4a, 0xaa, 0x52, 0xad, 0x73, 0x50, 0x8c, 0xb2, 0x9c, 0x70, 0x14, 0x00, 0xd0, 0x02, 0x00, 0x5a, 0x98,
+  0x60, 0xad, 0x7b, 0x2b, 0x6b, 0x0f, 0x84, 0x44, 0x0e, 0x00, 0xf0, 0x1f, 0x00, 0x08, 0x7c, 0x00, 0x4c, 0x0a, 0x00, 0x58, 0x6a, 0x13, 0xef, 0x68, 0x0a, 0x03, 0x7a, 0xc6, 0x13, 0x83, 0x6e, 0x31,
+  0x01, 0x58, 0x3f, 0x00, 0x28, 0x23, 0x24, 0xd0, 0x83, 0x28, 0x1c, 0x00, 0x3a, 0x55, 0x13, 0x10, 0x1a, 0x35, 0x13, 0xd3, 0xe4, 0x86, 0x00, 0x1c, 0x00, 0x04, 0x82, 0x4a, 0x02, 0x06, 0x0e, 0x22,
+  0xef, 0x7b, 0x76, 0x03, 0x00, 0xf6, 0x31, 0x04, 0xd4, 0x2a, 0x43, 0x71, 0x8c, 0x30, 0x84, 0x84, 0x0a, 0x11, 0x94, 0xec, 0x03, 0x00, 0x22, 0x60, 0x01, 0xfa, 0x26, 0x02, 0xb6, 0x0a, 0x00, 0xc4,
+  0x38, 0x00, 0xda, 0x0a, 0x11, 0x50, 0x22, 0x35, 0x00, 0x2e, 0x23, 0x10, 0x8e, 0xd8, 0xb1, 0x10, 0x73, 0x44, 0x15, 0x11, 0xef, 0x6e, 0x4a, 0x00, 0x40, 0x3c, 0x00, 0x3c, 0x0e, 0x00, 0x3a, 0x03,
+  0x11, 0xd3, 0x24, 0x07, 0x00, 0x8c, 0x0a, 0x00, 0x7a, 0x23, 0x00, 0x16, 0x03, 0x00, 0x28, 0x0e, 0x00, 0x78, 0x03, 0x00, 0x98, 0x0a, 0x00, 0x62, 0x03, 0x11, 0xb2, 0xfa, 0x26, 0x20, 0xf3, 0xac,
+  0x42, 0x07, 0x00, 0xa8, 0x03, 0x80, 0xcf, 0x8b, 0x50, 0x94, 0x51, 0x9c, 0x30, 0x94, 0xf4, 0x38, 0xe0, 0xce, 0x83, 0xae, 0x83, 0x91, 0x9c, 0xb2, 0xa4, 0xf3, 0xac, 0xb2, 0xa4, 0xef, 0x8b, 0x0e,
+  0x00, 0x71, 0xce, 0x83, 0x50, 0x94, 0xf3, 0xac, 0x50, 0x56, 0x15, 0x11, 0x14, 0xa6, 0x83, 0x22, 0x15, 0xa5, 0x62, 0x6e, 0x51, 0xf4, 0xac, 0xf3, 0xa4, 0x91, 0x12, 0x0b, 0x39, 0x92, 0xa4, 0x71,
+  0x4c, 0x3c, 0x18, 0x91, 0x8c, 0x03, 0x29, 0xa4, 0x70, 0xc6, 0x38, 0x0e, 0x50, 0x7c, 0x01, 0x90, 0x03, 0x0d, 0x62, 0xa3, 0x0a, 0x4a, 0x15, 0x16, 0x11, 0x46, 0x15, 0x07, 0x42, 0x0e, 0x04, 0xe4,
+  0x3f, 0x0c, 0xbe, 0x71, 0x02, 0x92, 0x2a, 0x24, 0x93, 0xc5, 0x10, 0x20, 0x08, 0x8e, 0xa3, 0x06, 0x1c, 0x07, 0x04, 0xe4, 0x18, 0x22, 0xb4, 0xcd, 0x04, 0x60, 0x08, 0xf8, 0x7f, 0x04, 0x40, 0x0e,
+  0x06, 0x06, 0x00, 0x24, 0x73, 0xbd, 0xf4, 0x5f, 0x02, 0x96, 0x5c, 0x04, 0x26, 0x07, 0x04, 0x24, 0x07, 0x06, 0x08, 0x00, 0x02, 0x84, 0x15, 0x00, 0xb4, 0x38, 0x11, 0x53, 0xd2, 0x7c, 0x02, 0x10,
+  0x07, 0x04, 0x34, 0x20, 0x02, 0x2c, 0x47, 0x02, 0x1e, 0x60, 0x00, 0xe8, 0x0d, 0x11, 0x57, 0x3a, 0x67, 0x02, 0x06, 0x00, 0x02, 0x8a, 0xf5, 0x02, 0x64, 0x35, 0x02, 0xae, 0x6a, 0x22, 0xfa, 0xee,
+  0x60, 0x75, 0x00, 0x78, 0x23, 0x40, 0x2f, 0x94, 0xd5, 0xc5, 0xbe, 0x63, 0x00, 0x86, 0x1c, 0x63, 0x16, 0xd6, 0x12, 0xad, 0xb5, 0xc5, 0x6c, 0xc0, 0x01, 0xac, 0x0a, 0x00, 0xc6, 0x63, 0x02, 0x1e,
+  0x39, 0x11, 0x37, 0x02, 0x39, 0x20, 0x8f, 0x63, 0x1a, 0x35, 0x00, 0xe0, 0x26, 0x00, 0x60, 0x15, 0x11, 0x93, 0x8c, 0x43, 0x20, 0x10, 0x6c, 0x50, 0x67, 0x22, 0x11, 0x74, 0xfe, 0x7b, 0x21, 0x15,
+  0x95, 0x94, 0x51, 0xf0, 0x00, 0x5b, 0x0d, 0x53, 0x31, 0x7c, 0x56, 0x9d, 0x6e, 0x63, 0x6e, 0x5b, 0xf4, 0x8c, 0x0d, 0x53, 0xe2, 0x6d, 0x00, 0x2e, 0xc6, 0x20, 0xae, 0x63, 0x9e, 0x31, 0x00, 0xee,
+  0x18, 0x20, 0x4d, 0x5b, 0x7a, 0x23, 0xe0, 0x34, 0x9d, 0x14, 0x9d, 0x71, 0x84, 0xcf, 0x73, 0x55, 0x9d, 0x34, 0x9d, 0x51, 0x7c, 0xb8, 0x31, 0x21, 0xaa, 0x4a, 0xc6, 0xf0, 0x50, 0x6b, 0x8e, 0x6b,
+  0x0f, 0x7c, 0xbc, 0x31, 0xb1, 0xb1, 0x94, 0x91, 0x8c, 0xee, 0x73, 0xce, 0x73, 0xb1, 0x94, 0x4c, 0xd4, 0x7b, 0x00, 0x6a, 0x5c, 0x11, 0x4c, 0x36, 0x4a, 0x20, 0x0b, 0x5b, 0x9c, 0x0a, 0x00, 0x86,
+  0x58, 0xd0, 0xcb, 0x52, 0xeb, 0x5a, 0xca, 0x52, 0x6d, 0x63, 0x69, 0x42, 0xe7, 0x39, 0x0c, 0x4c, 0x27, 0x30, 0x84, 0x13, 0xa5, 0x84, 0x03, 0x00, 0x7e, 0x7f, 0x20, 0x89, 0x52, 0x44, 0x91, 0x20,
+  0xce, 0x83, 0xc0, 0x11, 0x00, 0x64, 0x1c, 0x11, 0x6c, 0xc2, 0x8d, 0x20, 0x71, 0x94, 0x20, 0x38, 0x00, 0x10, 0x7c, 0x24, 0x2c, 0x63, 0xf0, 0x1b, 0x02, 0x5c, 0x4a, 0x00, 0xa8, 0x1f, 0x02, 0x7c,
+  0x71, 0x00, 0x5e, 0x03, 0x20, 0x2d, 0x6b, 0x9a, 0x1f, 0x02, 0x3a, 0x15, 0x02, 0x34, 0xd8, 0x02, 0x62, 0xdf, 0x11, 0x31, 0x48, 0x83, 0x02, 0xa8, 0x26, 0x00, 0x4c, 0x07, 0x06, 0xb8, 0x2a, 0x00,
+  0x3c, 0x00, 0x00, 0x3e, 0x00, 0x02, 0x76, 0xff, 0x00, 0xe0, 0x11, 0x17, 0x71, 0x16, 0x00, 0x22, 0x8e, 0x73, 0x38, 0x15, 0x31, 0x6e, 0x73, 0xef, 0x3e, 0x4e, 0x01, 0xe6, 0x26, 0x01, 0x30, 0x0e,
+  0xb1, 0xd3, 0xa4, 0xf3, 0xa4, 0x30, 0x8c, 0xce, 0x83, 0x4c, 0x73, 0x4c, 0x86, 0x03, 0x00, 0x0c, 0x2e, 0x00, 0x1c, 0x03, 0x22, 0x71, 0x94, 0x7e, 0x1c, 0x00, 0x0a, 0x07, 0x00, 0xac, 0x11, 0x31,
+  0x0f, 0x8c, 0xce, 0x62, 0x43, 0x11, 0xcf, 0x5a, 0x07, 0x00, 0x78, 0x0a, 0x02, 0x6c, 0x3c, 0x01, 0xe6, 0x11, 0x00, 0x8a, 0x23, 0x30, 0x8b, 0xf3, 0xac, 0x3e, 0x07, 0x00, 0x5c, 0x03, 0x03, 0x66,
+  0x15, 0x10, 0x9c, 0x5e, 0x0e, 0x55, 0xf3, 0xac, 0xd3, 0xa4, 0x51, 0xfe, 0x0d, 0x02, 0xb2, 0x0a, 0xe1, 0x0f, 0x8c, 0x30, 0x94, 0xb2, 0xa4, 0x54, 0xbd, 0x54, 0xb5, 0x13, 0xb5, 0x50, 0x94, 0x2c,
+  0x40, 0x00, 0xca, 0x03, 0xb0, 0x9c, 0x35, 0xad, 0xcf, 0x7b, 0x15, 0xa5, 0x59, 0xce, 0x9a, 0xd6, 0xe8, 0x43, 0x88, 0x50, 0x94, 0x91, 0x9c, 0x51, 0x9c, 0x92, 0xa4, 0xaa, 0x0a, 0x04, 0xc0, 0x38,
+  0x2a, 0x70, 0xa4, 0x64, 0x1c, 0x0e, 0x86, 0x4a, 0x06, 0x54, 0x7c, 0x1f, 0xf0, 0x36, 0x0e, 0x0a, 0x1a, 0x11, 0xf0, 0x7f, 0x0b, 0x2e, 0x15, 0x06, 0x54, 0x75, 0x13, 0x53, 0xb0, 0x31, 0x02, 0x7e,
+  0xc3, 0x00, 0x64, 0x0d, 0x11, 0x11, 0x50, 0x35, 0x02, 0x50, 0x3c, 0x02, 0xbe, 0x11, 0x17, 0x53, 0x3e, 0x2e, 0x15, 0x93, 0x00, 0x40, 0x06, 0x24, 0x67, 0x06, 0xa6, 0x4a, 0x02, 0xb4, 0x18, 0x08,
+  0x40, 0x0e, 0x04, 0xb8, 0x6a, 0x00, 0x46, 0x00, 0x02, 0x74, 0x43, 0x08, 0xd2, 0x71, 0x04, 0xe8, 0x1f, 0x11, 0xf5, 0xa2, 0x31, 0x00, 0x72, 0x00, 0x24, 0xb0, 0xa4, 0x0e, 0x07, 0x04, 0x34, 0x40,
+  0x04, 0x6c, 0x0e, 0x04, 0x68, 0x0e, 0x11, 0x57, 0x48, 0xae, 0x02, 0xc8, 0x6a, 0x02, 0x92, 0x9c, 0x00, 0x22, 0x27, 0x00, 0x16, 0x79, 0x20, 0x57, 0xd6, 0xe6, 0x3f, 0x42, 0x94, 0xbd, 0x53, 0xb5,
+  0x36, 0x2e, 0x02, 0x78, 0x3c, 0x20, 0x1a, 0xf7, 0x9a, 0x03, 0x22, 0xd1, 0xac, 0xfc, 0x11, 0x02, 0x0a, 0x92, 0x04, 0x50, 0xa0, 0x02, 0x16, 0xb2, 0x02, 0xc6, 0x2a, 0x00, 0x2a, 0x19, 0x21, 0xec,
+  0x4a, 0x4a, 0x1c, 0x00, 0x7a, 0x75, 0x12, 0x52, 0x9e, 0x98, 0x00, 0x96, 0x3c, 0x31, 0xf4, 0x8c, 0xd0, 0x52, 0x0e, 0x02, 0xd8, 0x46, 0x00, 0x3e, 0x07, 0x00, 0xf2, 0x26, 0x00, 0x30, 0x15, 0x00,
+  0x0c, 0x00, 0x20, 0x6a, 0x42, 0x72, 0xdb, 0x00, 0x72, 0xa6, 0x00, 0xde, 0x9b, 0x11, 0xcf, 0x3c, 0x15, 0xe0, 0x49, 0x3a, 0x8a, 0x4a, 0xae, 0x6b, 0x10, 0x7c, 0xae, 0x6b, 0xaa, 0x4a, 0xcb, 0x52,
+  0xba, 0x0a, 0x20, 0x08, 0x3a, 0x16, 0x6e, 0x00, 0xf8, 0x9b, 0x00, 0x5a, 0x91, 0x60, 0x10, 0x7c, 0x2c, 0x5b, 0x2c, 0x5b, 0xe8, 0x5f, 0x61, 0x2b, 0x63, 0x88, 0x4a, 0x6c, 0x6b, 0x78, 0xfb, 0x90,
+  0x73, 0xad, 0x73, 0x2b, 0x5b, 0x0b, 0x5b, 0xad, 0x73, 0x78, 0x5f, 0x20, 0x0b, 0x5b, 0x5a, 0x78, 0x10, 0x0c, 0x0c, 0x8a, 0x10, 0x63, 0x3a, 0xbf, 0xa0, 0x8a, 0x4a, 0x44, 0x21, 0xeb, 0x52, 0x10,
+  0x7c, 0x30, 0x84, 0x32, 0x0e, 0xf1, 0x01, 0xef, 0x83, 0x2f, 0x8c, 0x50, 0x8c, 0x8c, 0x73, 0x6c, 0x73, 0x70, 0x94, 0x91, 0x94, 0x30, 0x8c, 0x92, 0xf4, 0x01, 0x82, 0x1c, 0x40, 0x70, 0x94, 0x0f,
+  0x84, 0x82, 0x9f, 0x02, 0xa2, 0x0d, 0x20, 0x6d, 0x73, 0xec, 0x14, 0x00, 0x9c, 0x03, 0x00, 0x4a, 0x00, 0x10, 0x4d, 0xde, 0x26, 0x01, 0x68, 0xed, 0x00, 0xe0, 0x1f, 0x40, 0x0c, 0x63, 0x2d, 0x6b,
+  0x88, 0x03, 0x00, 0x42, 0x03, 0x11, 0xae, 0x02, 0x07, 0x02, 0xe4, 0x26, 0x01, 0xb4, 0x1f, 0x00, 0x72, 0x11, 0x05, 0xb6, 0x31, 0x02, 0xa4, 0x4a, 0x20, 0x92, 0x9c, 0x1a, 0x07, 0x02, 0x10, 0x27,
+  0x22, 0xef, 0x7b, 0xc8, 0x71, 0x00, 0xac, 0x0a, 0x16, 0x31, 0x20, 0x71, 0x00, 0x6a, 0x18, 0x10, 0x9c, 0xdc, 0x06, 0x00, 0xa6, 0xf8, 0x00, 0xfe, 0x4d, 0x00, 0xac, 0x11, 0x02, 0x44, 0x2a, 0x00,
+  0x92, 0x0a, 0x20, 0x2c, 0x6b, 0x9c, 0x7c, 0x00, 0xae, 0x0a, 0x00, 0x58, 0x03, 0x00, 0x2e, 0x0e, 0x00, 0xda, 0x06, 0x20, 0x6d, 0x7b, 0x7e, 0x0a, 0x00, 0xfe, 0x26, 0x01, 0x84, 0x0a, 0x21, 0x83,
+  0x0f, 0x02, 0x07, 0x11, 0x30, 0x42, 0x07, 0x02, 0xae, 0x11, 0x00, 0x76, 0x03, 0x13, 0x0f, 0x76, 0x3c, 0x00, 0xd8, 0x38, 0x11, 0x50, 0xac, 0x1c, 0x00, 0x4a, 0x03, 0x21, 0x92, 0xa4, 0x40, 0x35,
+  0x90, 0xa4, 0xef, 0x8b, 0x8e, 0x83, 0xcf, 0x8b, 0x92, 0xa4, 0x9e, 0x0a, 0x00, 0x08, 0x07, 0x60, 0x71, 0x9c, 0x13, 0xb5, 0xf3, 0xac, 0xbe, 0x0a, 0x80, 0xee, 0x8b, 0x2f, 0x94, 0x0f, 0x8c, 0xef,
+  0x8b, 0x90, 0x03, 0x60, 0x75, 0xbd, 0x17, 0xce, 0xd6, 0xc5, 0x34, 0x60, 0x20, 0xd7, 0xc5, 0xaa, 0xe3, 0x40, 0x76, 0xb5, 0xd7, 0xc5, 0xa4, 0x03, 0x00, 0x1c, 0x00, 0x37, 0x50, 0x9c, 0x50, 0x7c,
+  0x4a, 0x16, 0x70, 0x02, 0x00, 0x09, 0xba, 0x78, 0x0f, 0x9a, 0xb1, 0x03, 0x15, 0xf0, 0x1c, 0x07, 0x0f, 0x90, 0x03, 0x0b, 0x0b, 0x7e, 0x23, 0x0c, 0x3a, 0x15, 0x01, 0xc2, 0x18, 0x05, 0xb2, 0x71,
+  0x05, 0x68, 0x5c, 0x04, 0xac, 0xe3, 0x04, 0x86, 0xa3, 0x02, 0xc4, 0x11, 0x00, 0x20, 0x00, 0x13, 0x94, 0xaa, 0x4a, 0x03, 0xc6, 0x51, 0x03, 0xe2, 0x18, 0x28, 0xd5, 0xcd, 0x70, 0x3c, 0x08, 0x5c,
+  0x55, 0x00, 0x52, 0x03, 0x33, 0xd4, 0xcd, 0xd4, 0x94, 0x31, 0x15, 0xb4, 0x2e, 0x6e, 0x0a, 0x92, 0x43, 0x22, 0xb4, 0xc5, 0x3e, 0x4e, 0x02, 0xd8, 0x51, 0x02, 0x60, 0xce, 0x00, 0x3a, 0x00, 0x15,
+  0x15, 0xe0, 0x51, 0x24, 0x16, 0xd6, 0x9a, 0x5c, 0x02, 0x38, 0x67, 0x02, 0xc8, 0xe3, 0x11, 0x36, 0x66, 0x55, 0x02, 0xb2, 0x63, 0x02, 0x7e, 0x2a, 0x00, 0xa6, 0x11, 0x10, 0xf6, 0x58, 0x00, 0x52,
+  0xc5, 0x5b, 0xf7, 0xf6, 0xcd, 0x74, 0x95, 0x02, 0xae, 0x83, 0x02, 0x56, 0x0e, 0x02, 0x52, 0x2e, 0x02, 0x0e, 0x20, 0x13, 0xb9, 0x10, 0x59, 0x02, 0x1a, 0x39, 0x02, 0xca, 0x23, 0x20, 0xd9, 0xe6,
+  0xdc, 0x31, 0x00, 0xbc, 0x1f, 0x31, 0xd4, 0x8c, 0x73, 0xe0, 0x18, 0x11, 0x4e, 0xfc, 0x5f, 0x00, 0x9e, 0x23, 0x00, 0xba, 0x11, 0x02, 0x30, 0xf4, 0x00, 0xa6, 0x03, 0x20, 0xab, 0x42, 0x3a, 0x4e,
+  0x00, 0x34, 0x07, 0x00, 0x92, 0x2a, 0x00, 0xbc, 0xc2, 0x60, 0x08, 0x32, 0xe8, 0x31, 0x2d, 0x5b, 0x98, 0x0a, 0x60, 0x69, 0x42, 0xe7, 0x31, 0xcf, 0x6b, 0x78, 0x23, 0x80, 0x8e, 0x63, 0x10, 0x7c,
+  0xd3, 0x94, 0x71, 0x84, 0x66, 0x0a, 0x00, 0x86, 0x98, 0xf0, 0x07, 0x8e, 0x6b, 0x49, 0x42, 0xca, 0x4a, 0xef, 0x73, 0x69, 0x42, 0x69, 0x42, 0x0b, 0x5b, 0x89, 0x4a, 0x07, 0x3a, 0x68, 0x4a, 0xee,
+  0x7b, 0x6c, 0x71, 0xa0, 0x95, 0xad, 0xb1, 0x94, 0x50, 0x8c, 0x8d, 0x6b, 0xeb, 0x5a, 0x3a, 0x15, 0x00, 0x9a, 0x0a, 0x00, 0x46, 0x6a, 0xf0, 0x0b, 0x8a, 0x52, 0x6d, 0x6b, 0x28, 0x42, 0x86, 0x29,
+  0xe7, 0x39, 0x49, 0x42, 0x6a, 0x4a, 0x10, 0x7c, 0xb3, 0x94, 0x30, 0x84, 0x8e, 0x73, 0xd2, 0x9c, 0x70, 0x8c, 0x62, 0xe6, 0x00, 0x46, 0x15, 0x20, 0x0f, 0x8c, 0x98, 0x31, 0x02, 0x06, 0xca, 0x80,
+  0x0b, 0x6b, 0xea, 0x62, 0x0b, 0x63, 0x0b, 0x63, 0xde, 0x94, 0x00, 0x38, 0x0e, 0x00, 0xcc, 0xb4, 0x00, 0x52, 0xdf, 0x11, 0x2c, 0xa2, 0x46, 0x04, 0xe2, 0x70, 0x22, 0x8e, 0x73, 0x4c, 0x8a, 0x01,
+  0xd4, 0x8d, 0x01, 0x44, 0x31, 0x02, 0x1a, 0x00, 0x11, 0x72, 0x12, 0x1c, 0x15, 0x31, 0x4a, 0x07, 0x02, 0x6a, 0x1c, 0x02, 0xa2, 0x0a, 0x00, 0x3a, 0x43, 0x06, 0xc6, 0x1f, 0x11, 0x31, 0xf4, 0x62,
+  0x00, 0xc4, 0xf4, 0x00, 0x64, 0xa3, 0x62, 0x34, 0xad, 0x14, 0xa5, 0xb2, 0x9c, 0xe2, 0x31, 0x00, 0x66, 0x00, 0x02, 0x3c, 0x40, 0x26, 0x6e, 0x73, 0xdc, 0x7b, 0x00, 0xbc, 0x38, 0x11, 0x8e, 0x1a,
+  0x55, 0x00, 0x46, 0x03, 0x00, 0x20, 0x3c, 0x02, 0x12, 0x07, 0x00, 0x0a, 0x12, 0x00, 0xb4, 0x1c, 0x04, 0x72, 0x31, 0x41, 0xd3, 0xa4, 0xd2, 0xa4, 0x5e, 0x0e, 0x23, 0x94, 0x30, 0x42, 0x0e, 0x20,
+  0xb2, 0xa4, 0x98, 0x03, 0x00, 0x28, 0x15, 0x02, 0xda, 0x11, 0x00, 0x36, 0x00, 0x00, 0x8e, 0x23, 0x01, 0x1c, 0x07, 0x00, 0x44, 0x03, 0x52, 0x94, 0x10, 0x94, 0x91, 0x9c, 0x1c, 0x2e, 0x60, 0x96,
+  0xc5, 0x75, 0xbd, 0x71, 0x9c, 0x8a, 0x03, 0x20, 0xef, 0x8b, 0x48, 0x03, 0x40, 0x0f, 0x94, 0x50, 0x94, 0xe4, 0x06, 0xa0, 0xf2, 0xac, 0xb2, 0xa4, 0x34, 0xb5, 0xd2, 0xac, 0xb2, 0xa4, 0x50, 0x0e,
+  0x00, 0xe4, 0x03, 0x00, 0x4c, 0x0e, 0x00, 0xb8, 0x07, 0xb3, 0xf8, 0xc5, 0x59, 0xd6, 0x96, 0xbd, 0x34, 0xb5, 0x91, 0x9c, 0x50, 0x42, 0x0e, 0x08, 0x86, 0x03, 0x02, 0x1a, 0x07, 0x0a, 0xac, 0xb8,
+  0x0e, 0x72, 0x43, 0x02, 0xa6, 0x0a, 0x1e, 0xf0, 0x2e, 0x0e, 0x0c, 0x92, 0x03, 0x03, 0xa4, 0x11, 0x08, 0x22, 0x07, 0x02, 0x98, 0xb1, 0x0a, 0xa8, 0x91, 0x01, 0x8c, 0x1c, 0x36, 0xac, 0x73, 0xc5,
+  0x08, 0x40, 0x12, 0x52, 0x98, 0x4a, 0x04, 0x5a, 0x15, 0x14, 0xb5, 0xa4, 0x4a, 0x22, 0x93, 0xc5, 0x2a, 0x07, 0x05, 0x38, 0x4e, 0x45, 0xcd, 0xb4, 0xcd, 0x73, 0xa2, 0x6a, 0x06, 0x8e, 0x03, 0x13,
+  0xb4, 0xa8, 0x0a, 0x15, 0xd5, 0x92, 0x43, 0x62, 0x15, 0xd6, 0x8f, 0xa4, 0x12, 0xb5, 0x22, 0x35, 0x04, 0x3a, 0x6e, 0x04, 0x28, 0x87, 0x02, 0xa8, 0x11, 0x04, 0x8a, 0x1c, 0x24, 0x53, 0xbd, 0x22,
+  0x00, 0x55, 0xd9, 0xee, 0x16, 0xd6, 0xd4, 0x1a, 0x07, 0x08, 0x90, 0x5c, 0x02, 0x92, 0x03, 0x04, 0x60, 0xae, 0x00, 0x2a, 0x0e, 0x00, 0x6e, 0x15, 0x00, 0xa4, 0x23, 0x02, 0xa4, 0x5c, 0x20, 0x36,
+  0xd6, 0xb4, 0x0a, 0x00, 0x02, 0x40, 0x21, 0xf9, 0xee, 0xa0, 0x95, 0x12, 0xe6, 0x08, 0xfd, 0x02, 0x9a, 0x0a, 0x13, 0x57, 0xd8, 0x8a, 0x04, 0x00, 0x52, 0x11, 0x37, 0xe0, 0xa3, 0x02, 0xb0, 0x55,
+  0x00, 0x52, 0x07, 0x01, 0x0c, 0xb8, 0x70, 0x73, 0xb0, 0x6b, 0x11, 0x74, 0xb0, 0x6b, 0x26, 0x27, 0x31, 0x93, 0x84, 0x72, 0x5c, 0x15, 0x00, 0xc6, 0x11, 0x40, 0x4a, 0x3a, 0x66, 0x19, 0x44, 0x0e,
+  0x20, 0x8e, 0x63, 0x34, 0x15, 0x00, 0x04, 0x00, 0x40, 0xf4, 0x8c, 0x92, 0x84, 0x50, 0x0e, 0x60, 0x6e, 0x63, 0xab, 0x4a, 0x8b, 0x42, 0x96, 0xe2, 0xb1, 0x8a, 0x42, 0xab, 0x4a, 0xb2, 0x8c, 0x55,
+  0x9d, 0x92, 0x84, 0xcf, 0x78, 0x4a, 0x00, 0x0a, 0x4e, 0x00, 0x24, 0xa3, 0x00, 0x28, 0xb1, 0x00, 0x96, 0x03, 0x20, 0x50, 0x7c, 0x96, 0x03, 0x40, 0x0c, 0x5b, 0xeb, 0x5a, 0xf8, 0xf7, 0x40, 0xc6,
+  0x31, 0x70, 0x8c, 0xbe, 0x26, 0xf1, 0x0c, 0xad, 0x73, 0xa9, 0x52, 0x0b, 0x63, 0xce, 0x73, 0x30, 0x84, 0x6d, 0x6b, 0x4c, 0x63, 0x6d, 0x6b, 0xeb, 0x5a, 0xcf, 0x73, 0xcf, 0x73, 0x0c, 0x5b, 0xf0,
+  0x7b, 0x6d, 0x2e, 0x23, 0x00, 0xc4, 0x26, 0x80, 0x92, 0x8c, 0x8e, 0x6b, 0x8e, 0x6b, 0x92, 0x94, 0x20, 0x07, 0x80, 0x91, 0x94, 0x0e, 0x8c, 0x8c, 0x7b, 0x0e, 0x8c, 0x12, 0x07, 0x80, 0x0e, 0x8c,
+  0x0e, 0x84, 0x8d, 0x7b, 0x2b, 0x6b, 0xe0, 0x31, 0x50, 0xca, 0x62, 0x0f, 0x84, 0xb2, 0xd0, 0x10, 0x10, 0xa5, 0x20, 0x0a, 0x10, 0x71, 0x8a, 0x77, 0x34, 0x94, 0xb2, 0x9c, 0x80, 0x49, 0x06, 0x6c,
+  0x03, 0x15, 0x31, 0x34, 0xb8, 0x00, 0xf2, 0x0d, 0x02, 0xc4, 0x38, 0x00, 0x76, 0x23, 0x01, 0x94, 0x4d, 0x10, 0x83, 0xa2, 0x0a, 0x12, 0xae, 0xfa, 0x1f, 0x10, 0x8c, 0x00, 0x11, 0x00, 0xea, 0x34,
+  0x02, 0x18, 0x0e, 0x20, 0x51, 0x94, 0xda, 0x2d, 0x20, 0xf3, 0xa4, 0xa6, 0x0a, 0x60, 0xd7, 0xc5, 0xb7, 0xbd, 0xb3, 0x9c, 0x6e, 0xd8, 0x20, 0xec, 0x62, 0x9e, 0x0a, 0x04, 0xd0, 0x5b, 0x00, 0x5e,
+  0x4a, 0x11, 0x51, 0x04, 0x19, 0x20, 0x31, 0x8c, 0x7c, 0x03, 0x60, 0x55, 0xad, 0x92, 0x9c, 0xef, 0x83, 0x2e, 0x23, 0x02, 0x8a, 0x00, 0x00, 0xb8, 0x07, 0x40, 0xb3, 0xa4, 0xf4, 0xac, 0xc8, 0x11,
+  0x01, 0xfe, 0x2d, 0x10, 0xbd, 0xe0, 0x1f, 0x11, 0xb2, 0x38, 0x0a, 0x20, 0x30, 0x8c, 0xd6, 0x26, 0x02, 0xa0, 0x03, 0x22, 0x30, 0x94, 0x16, 0x4e, 0x01, 0xac, 0x03, 0x01, 0x66, 0x03, 0x02, 0x16,
+  0x07, 0x62, 0x71, 0x9c, 0xce, 0x83, 0xef, 0x8b, 0x32, 0x1c, 0x11, 0x30, 0x60, 0x0e, 0x00, 0x84, 0x0a, 0xf0, 0x0b, 0xd3, 0xac, 0x10, 0x94, 0xcf, 0x8b, 0x30, 0x94, 0x51, 0x9c, 0x50, 0x9c, 0x13,
+  0xad, 0xd2, 0xa4, 0xf2, 0xac, 0xb1, 0xa4, 0x13, 0xad, 0x13, 0xad, 0x70, 0x9c, 0x44, 0x0e, 0x20, 0x2f, 0x94, 0x02, 0x00, 0xc0, 0xef, 0x8b, 0x50, 0x9c, 0xf3, 0xac, 0xd7, 0xc5, 0xb6, 0xbd, 0xd7,
+  0xc5, 0xda, 0x2a, 0x60, 0x56, 0xb5, 0x55, 0xb5, 0x18, 0xce, 0x46, 0x07, 0x04, 0x8a, 0x03, 0x22, 0x91, 0xa4, 0x10, 0x07, 0x04, 0x8c, 0x03, 0x1d, 0x90, 0xd2, 0x5f, 0x0d, 0x42, 0xbc, 0x05, 0x8c,
+  0x03, 0x0f, 0xf8, 0x1f, 0x05, 0x09, 0x98, 0x2a, 0x09, 0x9c, 0x2a, 0x15, 0x32, 0x1e, 0x4e, 0x07, 0xe8, 0x18, 0x13, 0xb5, 0xaa, 0x51, 0x07, 0x2c, 0x4e, 0x19, 0x52, 0x6e, 0x5c, 0x02, 0x40, 0x2e,
+  0x03, 0x6e, 0x7c, 0x01, 0x34, 0x6e, 0x06, 0xb0, 0x4a, 0x1b, 0x94, 0xb4, 0x11, 0x06, 0x34, 0x0e, 0x15, 0x94, 0x8a, 0x63, 0x11, 0xd4, 0xe8, 0x06, 0x11, 0xb4, 0x16, 0x67, 0x06, 0x70, 0x3c, 0x04,
+  0x72, 0x15, 0x04, 0x7e, 0x1c, 0x02, 0x26, 0x07, 0x00, 0xc2, 0x23, 0x20, 0xd1, 0xac, 0x3c, 0x2e, 0x00, 0x1e, 0xa0, 0x00, 0x3a, 0x00, 0x26, 0xf5, 0xcd, 0x9c, 0xdc, 0x06, 0x70, 0x55, 0x02, 0xf4,
+  0x58, 0x02, 0x72, 0x75, 0x00, 0x20, 0x4e, 0x11, 0x77, 0x8e, 0x1c, 0x60, 0xf9, 0xee, 0x74, 0xbd, 0x98, 0xde, 0x48, 0x35, 0x80, 0xd1, 0xa4, 0x36, 0xd6, 0x53, 0xb5, 0xfa, 0xee, 0x86, 0x1c, 0x00,
+  0x4a, 0x80, 0x02, 0x2c, 0x59, 0x22, 0x53, 0xb5, 0x7e, 0x2e, 0x11, 0xb9, 0xaa, 0x2a, 0x02, 0x1a, 0x07, 0x20, 0xfa, 0xee, 0x08, 0x84, 0x00, 0x50, 0x60, 0x02, 0x30, 0x60, 0xa0, 0xcc, 0x4a, 0xcc,
+  0x4a, 0x2e, 0x5b, 0x31, 0x7c, 0x77, 0xa5, 0x2a, 0x2e, 0x02, 0xfa, 0x06, 0x20, 0x86, 0x19, 0x88, 0x43, 0x40, 0xa7, 0x21, 0xab, 0x42, 0x02, 0x55, 0x00, 0x50, 0x27, 0x00, 0xc6, 0x23, 0x00, 0x52,
+  0x43, 0x60, 0x6a, 0x42, 0xe8, 0x29, 0xab, 0x42, 0xb0, 0x03, 0xe0, 0xb3, 0x8c, 0x56, 0x9d, 0x4d, 0x5b, 0x31, 0x7c, 0x76, 0xa5, 0x96, 0xad, 0x51, 0x84, 0x76, 0x9f, 0x62, 0x0f, 0x74, 0x0c, 0x5b,
+  0xcb, 0x52, 0x4a, 0x5c, 0x00, 0x2e, 0x0e, 0x11, 0x6d, 0xe6, 0x18, 0x00, 0x40, 0x0e, 0x40, 0x4d, 0x63, 0x51, 0x84, 0x86, 0x0a, 0x60, 0x8e, 0x6b, 0xf3, 0x9c, 0x50, 0x84, 0x28, 0x6a, 0x00, 0x08,
+  0x15, 0x00, 0x50, 0x78, 0x20, 0x89, 0x52, 0x9c, 0x0a, 0x50, 0x4c, 0x63, 0xcb, 0x52, 0xcf, 0x8c, 0x9b, 0x00, 0x14, 0x7f, 0x40, 0x7c, 0x10, 0x7c, 0xf0, 0x14, 0xe6, 0xb0, 0x6b, 0xab, 0x52, 0x2d,
+  0x63, 0x93, 0x94, 0x14, 0xa5, 0x50, 0x8c, 0xf4, 0xe9, 0xf1, 0x00, 0x6c, 0x73, 0xcd, 0x83, 0xcd, 0x83, 0x8c, 0x7b, 0xc9, 0x62, 0x0a, 0x6b, 0xce, 0x83, 0x91, 0x84, 0x02, 0x11, 0xb1, 0x58, 0x14,
+  0x31, 0xb1, 0x9c, 0x0f, 0x1c, 0x18, 0x40, 0xce, 0x7b, 0x4c, 0x6b, 0xb6, 0x86, 0x21, 0x0c, 0x6b, 0xb4, 0x3b, 0x01, 0x3a, 0x58, 0x02, 0x06, 0x6a, 0x13, 0xf0, 0x9c, 0x0a, 0x02, 0x46, 0xdf, 0x00,
+  0x72, 0x8a, 0x00, 0x5c, 0x23, 0x13, 0xcf, 0x40, 0xa6, 0x11, 0xef, 0xf0, 0x26, 0x02, 0xee, 0x34, 0x22, 0xcf, 0x7b, 0x04, 0x00, 0x00, 0x98, 0x14, 0x02, 0x9c, 0x11, 0x13, 0x10, 0x62, 0xa3, 0x60,
+  0x6e, 0x73, 0x49, 0x4a, 0x4d, 0x6b, 0x8e, 0x0e, 0x11, 0x96, 0xfa, 0x22, 0x20, 0x92, 0x9c, 0xa8, 0x03, 0x01, 0x0e, 0x5c, 0x01, 0x02, 0x12, 0x00, 0xd0, 0x06, 0x42, 0x35, 0xad, 0xd3, 0xa4, 0x82,
+  0x03, 0x00, 0x76, 0x1c, 0x00, 0xb0, 0x07, 0x00, 0xc0, 0x11, 0x00, 0x8c, 0x1f, 0x20, 0x14, 0xad, 0xf0, 0x54, 0x00, 0x4e, 0x03, 0x10, 0x6d, 0x58, 0x87, 0x21, 0x83, 0x51, 0x0a, 0x0e, 0x11, 0x50,
+  0xa6, 0x0a, 0x00, 0x7e, 0x4a, 0x00, 0x1e, 0x07, 0x02, 0x14, 0x07, 0x02, 0xc6, 0x11, 0x00, 0xa6, 0x18, 0x20, 0x55, 0xb5, 0x48, 0x03, 0xa0, 0x18, 0xce, 0xd2, 0xa4, 0xd6, 0xc5, 0xd7, 0xc5, 0x96,
+  0xbd, 0x68, 0x0a, 0x42, 0x54, 0xb5, 0x92, 0xa4, 0x44, 0x07, 0x60, 0xcf, 0x8b, 0xae, 0x83, 0x71, 0x9c, 0x08, 0x07, 0x00, 0x54, 0x03, 0xc0, 0x50, 0x94, 0xee, 0x8b, 0x30, 0x94, 0x6d, 0x7b, 0xad,
+  0x83, 0xee, 0x8b, 0x58, 0x00, 0xc0, 0x50, 0x9c, 0xd2, 0xac, 0x34, 0xb5, 0xf3, 0xac, 0x71, 0x9c, 0x8d, 0x83, 0xf0, 0x03, 0x00, 0xe2, 0x00, 0x02, 0x20, 0x39, 0x40, 0x14, 0xad, 0xce, 0x83, 0x28,
+  0x0e, 0x13, 0x50, 0xba, 0x11, 0x27, 0x90, 0xa4, 0xd2, 0x18, 0x08, 0x14, 0x07, 0x03, 0xe4, 0xa6, 0x08, 0xdc, 0x18, 0x0e, 0x98, 0xb1, 0x0e, 0x90, 0x03, 0x04, 0x1a, 0x07, 0x0d, 0xae, 0x0a, 0x03,
+  0xa6, 0x0a, 0x02, 0x82, 0x0a, 0x04, 0x08, 0x00, 0x03, 0xb8, 0x31, 0x00, 0xba, 0x31, 0x23, 0xac, 0x52, 0x96, 0x43, 0x04, 0xf6, 0x7f, 0x02, 0x22, 0x07, 0x06, 0x3a, 0x6e, 0x03, 0xa6, 0x0a, 0x00,
+  0x1a, 0x07, 0x00, 0x38, 0x95, 0x15, 0xcd, 0x0e, 0x00, 0x18, 0xc5, 0xf6, 0x7f, 0x17, 0xf5, 0x02, 0x40, 0x06, 0x84, 0x5c, 0x22, 0x16, 0xd6, 0x28, 0x27, 0x04, 0xbe, 0x11, 0x02, 0x96, 0x63, 0x06,
+  0x26, 0x67, 0x04, 0xda, 0x18, 0x42, 0xd1, 0xac, 0x73, 0xbd, 0x0a, 0xe0, 0x00, 0xa6, 0x35, 0x02, 0x4e, 0x4e, 0x06, 0x8a, 0x03, 0x06, 0xee, 0x38, 0x02, 0xf2, 0x71, 0x00, 0x90, 0x0a, 0x02, 0xf8,
+  0xe3, 0x02, 0xd0, 0x58, 0x11, 0x78, 0x7c, 0x03, 0x60, 0xee, 0x8b, 0xfa, 0xee, 0x9c, 0xff, 0x3a, 0x80, 0x02, 0x6c, 0x15, 0x00, 0x42, 0x0e, 0x00, 0x3a, 0x0e, 0x22, 0x0e, 0x94, 0xae, 0x35, 0x15,
+  0xb9, 0x20, 0x07, 0x11, 0xd9, 0xbc, 0x0a, 0x00, 0xce, 0x2a, 0x31, 0xf9, 0xee, 0xb8, 0x7e, 0x4e, 0x40, 0x3b, 0xf7, 0xd4, 0x8c, 0x32, 0x15, 0x11, 0x6e, 0x56, 0x2e, 0x62, 0x4a, 0x3a, 0x6a, 0x3a,
+  0x09, 0x2a, 0x18, 0x20, 0xe0, 0x8b, 0x42, 0xd0, 0x6b, 0x76, 0x9d, 0xd4, 0x8c, 0x14, 0x95, 0x14, 0x95, 0x72, 0x84, 0x10, 0x07, 0xb0, 0xec, 0x52, 0xc7, 0x29, 0x8e, 0x63, 0xd4, 0x8c, 0xd3, 0x8c,
+  0xaf, 0x4a, 0x15, 0xf0, 0x10, 0x53, 0x6a, 0x42, 0xf0, 0x73, 0xd7, 0xad, 0x92, 0x8c, 0x8a, 0x4a, 0x69, 0x42, 0x92, 0x8c, 0xb2, 0x8c, 0xef, 0x73, 0x0c, 0x5b, 0x2c, 0x5b, 0x0c, 0x5b, 0x0c, 0x5b,
+  0xae, 0x6b, 0x51, 0x84, 0x2c, 0x07, 0x00, 0x18, 0x15, 0xf0, 0x05, 0xcb, 0x52, 0xcb, 0x52, 0xaf, 0x73, 0x8e, 0x6b, 0xae, 0x73, 0x10, 0x7c, 0xd2, 0x94, 0x4c, 0x63, 0x8d, 0x73, 0xb2, 0x94, 0x38,
+  0x03, 0x01, 0x5c, 0x71, 0x23, 0x6b, 0x0b, 0x2e, 0x0e, 0x60, 0xcf, 0x73, 0xeb, 0x5a, 0xec, 0x5a, 0xdc, 0x2d, 0xa0, 0x4d, 0x63, 0xec, 0x5a, 0x49, 0x42, 0x4a, 0x42, 0xec, 0x5a, 0x20, 0x98, 0x00,
+  0x32, 0x6a, 0x00, 0x84, 0x0d, 0xf0, 0x03, 0xea, 0x62, 0x2b, 0x6b, 0x2a, 0x73, 0x4b, 0x73, 0x4a, 0x73, 0x4b, 0x73, 0x4f, 0x94, 0x90, 0x9c, 0xb1, 0x9c, 0x28, 0x11, 0xe0, 0xea, 0x62, 0x89, 0x5a,
+  0x28, 0x4a, 0xca, 0x62, 0x4c, 0x73, 0xce, 0x83, 0x6d, 0x73, 0x94, 0x23, 0x00, 0x6c, 0x03, 0x40, 0xd3, 0x9c, 0xf3, 0xa4, 0x94, 0x1f, 0x02, 0x66, 0x23, 0x02, 0x5a, 0x15, 0x02, 0x0c, 0x00, 0x00,
+  0x80, 0x38, 0x00, 0x70, 0x0a, 0x02, 0xfe, 0x18, 0x00, 0x70, 0x03, 0x11, 0x8e, 0x00, 0x8e, 0x00, 0x70, 0x23, 0x02, 0x88, 0x6d, 0x11, 0x30, 0xaa, 0x34, 0x00, 0x18, 0x00, 0x02, 0x20, 0x8e, 0x22,
+  0x51, 0x94, 0xb6, 0x0a, 0x00, 0x6c, 0x07, 0x11, 0x35, 0x44, 0x43, 0x00, 0x2e, 0x19, 0x11, 0x4d, 0x68, 0x1c, 0x11, 0xf4, 0x96, 0x1f, 0x22, 0xf3, 0xa4, 0x36, 0x00, 0x11, 0x51, 0xc6, 0x5f, 0x04,
+  0x9c, 0x26, 0x31, 0x30, 0x8c, 0xaf, 0x14, 0x27, 0x20, 0xf3, 0xa4, 0xba, 0x03, 0x60, 0x4d, 0x73, 0xab, 0x5a, 0x6d, 0x73, 0xd6, 0x18, 0x31, 0x6d, 0x7b, 0x71, 0xbe, 0x1f, 0x20, 0x71, 0x9c, 0xe4,
+  0x06, 0x00, 0x82, 0x11, 0x11, 0x92, 0x8c, 0x11, 0x02, 0xca, 0x11, 0x20, 0xf3, 0xac, 0xae, 0x23, 0x00, 0x1a, 0x07, 0x01, 0xfe, 0x11, 0x10, 0x83, 0x14, 0x0f, 0x20, 0x8d, 0x7b, 0xa6, 0x11, 0x42,
+  0x8d, 0x7b, 0xae, 0x83, 0x9c, 0x0a, 0x20, 0x34, 0xb5, 0x68, 0x03, 0x60, 0x54, 0xb5, 0x13, 0xad, 0xf3, 0xac, 0x04, 0x0e, 0xf2, 0x09, 0xae, 0x83, 0x0f, 0x94, 0xef, 0x8b, 0x0f, 0x94, 0x50, 0x9c,
+  0xf2, 0xac, 0x75, 0xbd, 0x13, 0xb5, 0xd2, 0xac, 0xd2, 0xac, 0x30, 0x94, 0x0f, 0x94, 0x1c, 0x00, 0x40, 0x91, 0xa4, 0xb6, 0xc5, 0x40, 0x0e, 0x31, 0xf0, 0x83, 0x35, 0x14, 0x59, 0x20, 0x96, 0xbd,
+  0x30, 0x19, 0x04, 0x78, 0x23, 0x11, 0x50, 0xc0, 0x11, 0x0e, 0x40, 0x7c, 0x08, 0x1e, 0xb5, 0x00, 0xec, 0xa6, 0x02, 0xee, 0xa6, 0x06, 0x36, 0x0e, 0x0e, 0x94, 0x03, 0x0b, 0x7c, 0x43, 0x03, 0x20,
+  0x15, 0x01, 0x0a, 0x6e, 0x05, 0xc2, 0x11, 0x06, 0x02, 0x00, 0x05, 0x6a, 0x03, 0x03, 0x1a, 0x2e, 0x06, 0xfe, 0x5f, 0x02, 0xb2, 0x91, 0x04, 0x02, 0x20, 0x15, 0x93, 0xb8, 0xb1, 0x02, 0xfe, 0x1f,
+  0x13, 0x53, 0x24, 0x47, 0x12, 0x73, 0xc0, 0x91, 0x00, 0x7e, 0x7c, 0x18, 0xcd, 0x60, 0x15, 0x17, 0x94, 0x36, 0x0e, 0x04, 0x3a, 0x75, 0x11, 0xd4, 0x40, 0x0e, 0x02, 0xbe, 0x23, 0x04, 0xf2, 0x1f,
+  0x06, 0x4c, 0x8e, 0x04, 0x54, 0x35, 0x04, 0x68, 0x1c, 0x02, 0x20, 0x00, 0x00, 0x18, 0x00, 0x20, 0x15, 0xd6, 0xe8, 0x0a, 0x17, 0x15, 0x36, 0x67, 0x13, 0xf5, 0x28, 0x00, 0x11, 0x77, 0xc4, 0x51,
+  0x00, 0x3e, 0x4e, 0x31, 0x53, 0xb5, 0x16, 0x4c, 0x2e, 0x20, 0xfa, 0xee, 0xae, 0xc7, 0x20, 0x3a, 0xf7, 0x08, 0xab, 0x00, 0x30, 0x07, 0x00, 0x8e, 0x95, 0x02, 0xde, 0x51, 0x00, 0x90, 0x0a, 0x20,
+  0x32, 0xb5, 0xc8, 0x63, 0x20, 0x3b, 0xf7, 0xb6, 0x95, 0x00, 0x62, 0x0e, 0x04, 0x12, 0x39, 0x13, 0xd9, 0xa8, 0x7c, 0x11, 0xb8, 0x04, 0xab, 0x80, 0xd9, 0xe6, 0xd9, 0xe6, 0x16, 0xce, 0x77, 0xde,
+};
+
+const lv_image_dsc_t beach_lz4 = {
+  .header.cf = LV_COLOR_FORMAT_RGB565,
+  .header.magic = LV_IMAGE_HEADER_MAGIC,
+  .header.flags = IMAGE_LZ4_FLAG,
+  .header.w = 456,
+  .header.h = 280,
+  .header.stride = 912,
+  .data_size = 132736,
+  .data = beach_lz4_map,
+};
@@ -0,0 +1,206 @@
+#include "carousel.h"
+
+#include <stdlib.h>
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "scene.h"
+
+static const char *TAG = "carousel";
+
+typedef struct
+{
+    lv_obj_t *scr;
+    lv_obj_t *strip; // Two screens wide, holds the leaving and the entering page while sliding
+    lv_obj_t *images[2];
+    lv_draw_buf_t pages[CAROUSEL_MAX_PAGES];
+    reading_t readings[CAROUSEL_MAX_PAGES];
+    bool dirty[CAROUSEL_MAX_PAGES];
+    int count;
+    int current;
+    int next;
+    bool sliding;
+} carousel_t;
+
+static carousel_t carousel;
+
+static void anim_x_cb(void *var, int32_t v)
+{
+    lv_obj_set_x((lv_obj_t *)var, v);
+}
+
+// Hides or shows the live widgets, every child of the screen but the strip.
+static void live_set_hidden(bool hidden)
+{
+    uint32_t count = lv_obj_get_child_count(carousel.scr);
+    for (uint32_t i = 0; i < count; i++)
+    {
+        lv_obj_t *child = lv_obj_get_child(carousel.scr, i);
+        if (child == carousel.strip)
+        {
+            continue;
+        }
+        if (hidden)
+        {
+            lv_obj_add_flag(child, LV_OBJ_FLAG_HIDDEN);
+        }
+        else
+        {
+            lv_obj_remove_flag(child, LV_OBJ_FLAG_HIDDEN);
+        }
+    }
+}
+
+// Shows the page's reading and scene background on the live widgets and snapshots the screen into the page. The shown
+// page's reading and background are put back right after. Neither counts as a reading change, so the scene cache
+// doesn't see the round trip. The page stays dirty while its scene's background is still loading, so it isn't rendered
+// with the shown one.
+static void render_page(int index)
+{
+    if (!scene_prefetch(&carousel.readings[index]))
+    {
+        return;
+    }
+    reading_set_quiet(&carousel.readings[index]);
+    scene_snapshot_begin(&carousel.readings[index]);
+    lv_obj_update_layout(carousel.scr);
+    lv_result_t res = lv_snapshot_take_to_draw_buf(carousel.scr, LV_COLOR_FORMAT_RGB565, &carousel.pages[index]);
+    scene_snapshot_end();
+    reading_set_quiet(&carousel.readings[carousel.current]);
+    if (res != LV_RESULT_OK)
+    {
+        ESP_LOGE(TAG, "Failed to render page %d", index);
+        return;
+    }
+    lv_image_cache_drop(&carousel.pages[index]);
+    carousel.dirty[index] = false;
+}
+
+static void slide_completed_cb(lv_anim_t *a)
+{
+    carousel.current = carousel.next;
+    reading_set(&carousel.readings[carousel.current]);
+    scene_prefetch(&carousel.readings[(carousel.current + 1) % carousel.count]);
+    live_set_hidden(false);
+    lv_obj_add_flag(carousel.strip, LV_OBJ_FLAG_HIDDEN);
+    carousel.sliding = false;
+}
+
+static void dwell_timer_cb(lv_timer_t *timer)
+{
+    if (carousel.sliding)
+    {
+        return;
+    }
+    carousel.next = (carousel.current + 1) % carousel.count;
+    if (carousel.dirty[carousel.current])
+    {
+        render_page(carousel.current);
+    }
+    if (carousel.dirty[carousel.next])
+    {
+        render_page(carousel.next);
+    }
+    if (carousel.dirty[carousel.current] || carousel.dirty[carousel.next])
+    {
+        lv_timer_set_period(timer, CAROUSEL_RETRY_MS);
+        return;
+    }
+    lv_timer_set_period(timer, CAROUSEL_DWELL_MS);
+
+    lv_image_set_src(carousel.images[0], &carousel.pages[carousel.current]);
+    lv_image_set_src(carousel.images[1], &carousel.pages[carousel.next]);
+    lv_obj_set_x(carousel.strip, 0);
+    lv_obj_remove_flag(carousel.strip, LV_OBJ_FLAG_HIDDEN);
+    live_set_hidden(true);
+    carousel.sliding = true;
+
+    const int32_t width = lv_obj_get_width(carousel.scr);
+    lv_anim_t anim;
+    lv_anim_init(&anim);
+    lv_anim_set_var(&anim, carousel.strip);
+    lv_anim_set_exec_cb(&anim, anim_x_cb);
+    lv_anim_set_values(&anim, 0, -width);
+    lv_anim_set_duration(&anim, CAROUSEL_SLIDE_MS);
+    lv_anim_set_path_cb(&anim, lv_anim_path_ease_in_out);
+    lv_anim_set_completed_cb(&anim, slide_completed_cb);
+    lv_anim_start(&anim);
+}
+
+bool carousel_create(lv_obj_t *scr, const reading_t *readings, int count)
+{
+    count = count < CAROUSEL_MAX_PAGES ? count : CAROUSEL_MAX_PAGES;
+    const int32_t width = lv_obj_get_width(scr);
+    const int32_t height = lv_obj_get_height(scr);
+    const uint32_t stride = lv_draw_buf_width_to_stride(width, LV_COLOR_FORMAT_RGB565);
+    const uint32_t size = stride * height;
+
+    for (int i = 0; i < count; i++)
+    {
+        void *data = heap_caps_aligned_alloc(64, size, MALLOC_CAP_SPIRAM);
+        if (!data)
+        {
+            ESP_LOGE(TAG, "Failed to allocate the pages (PSRAM, %d bytes each)", (int)size);
+            for (int j = 0; j < i; j++)
+            {
+                free(carousel.pages[j].data);
+            }
+            carousel.count = 0;
+            reading_set(&readings[0]);
+            return false;
+        }
+        lv_draw_buf_init(&carousel.pages[i], width, height, LV_COLOR_FORMAT_RGB565, stride, data, size);
+        carousel.readings[i] = readings[i];
+        carousel.dirty[i] = true;
+    }
+    carousel.scr = scr;
+    carousel.count = count;
+
+    // The strip reaches past the screen while sliding, which must not make the screen scroll
+    lv_obj_remove_flag(scr, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_set_scrollbar_mode(scr, LV_SCROLLBAR_MODE_OFF);
+
+    carousel.strip = lv_obj_create(scr);
+    lv_obj_remove_style_all(carousel.strip);
+    lv_obj_remove_flag(carousel.strip, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_set_size(carousel.strip, width * 2, height);
+    lv_obj_add_flag(carousel.strip, LV_OBJ_FLAG_HIDDEN);
+    for (int i = 0; i < 2; i++)
+    {
+        carousel.images[i] = lv_image_create(carousel.strip);
+        lv_obj_set_pos(carousel.images[i], i * width, 0);
+    }
+
+    carousel.current = 0;
+    for (int i = 0; i < count; i++)
+    {
+        render_page(i);
+    }
+
+    if (count > 1)
+    {
+        lv_timer_create(dwell_timer_cb, CAROUSEL_DWELL_MS, NULL);
+    }
+    ESP_LOGI(TAG, "%d pages, %d bytes each", count, (int)size);
+    return true;
+}
+
+void carousel_set_reading(int index, const reading_t *reading)
+{
+    // Without pages only the first reading is shown
+    if (carousel.count == 0 && index == 0)
+    {
+        reading_set(reading);
+        return;
+    }
+    if (index < 0 || index >= carousel.count)
+    {
+        return;
+    }
+    carousel.readings[index] = *reading;
+    carousel.dirty[index] = true;
+    scene_prefetch(reading);
+    if (index == carousel.current && !carousel.sliding)
+    {
+        reading_set(reading);
+    }
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <stdbool.h>
+#include "lvgl.h"
+#include "reading.h"
+
+// Cycles the screen through the readings of several beaches with a horizontal slide. Every beach's page is rendered
+// once into a PSRAM snapshot, the slide moves the two cached pages across the screen with the live widgets hidden, so
+// it costs two image copies per frame and no layout or text rendering. A page is rendered again only after its reading
+// changed, and once its scene's background has been loaded.
+#define CAROUSEL_MAX_PAGES 4
+#define CAROUSEL_DWELL_MS 8000
+#define CAROUSEL_SLIDE_MS 400
+#define CAROUSEL_RETRY_MS 100 // While the scene of a page that slides next is still loading
+
+// Renders a page per reading from the widgets on `scr`, which are bound to the reading model, and starts cycling. Call
+// with the LVGL lock held. The carousel sets the reading model from then on, new readings go through
+// carousel_set_reading(). Returns false if the pages can't be allocated, the first reading is shown without cycling.
+bool carousel_create(lv_obj_t *scr, const reading_t *readings, int count);
+
+// Replaces the reading of page `index`, with the LVGL lock held. The shown page updates right away, others the next
+// time they slide in.
+void carousel_set_reading(int index, const reading_t *reading);
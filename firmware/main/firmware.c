@@ -9,7 +9,29 @@
 #include "esp_lcd_panel_io.h"
 #include "esp_lcd_panel_vendor.h"
 #include "esp_lcd_panel_ops.h"
+#include "esp_lcd_panel_commands.h"
 #include "esp_lcd_co5300.h"
+#include "nvs_flash.h"
+#include "nvs.h"
+#include "esp_console.h"
+#include "esp_pm.h"
+#include "esp_sleep.h"
+#include "driver/uart.h"
+
+#include <string.h>
+
+#include "rotate.h"
+#include "telemetry.h"
+#include "log_ring.h"
+#include "readout.h"
+#include "reading.h"
+#include "lvgl_heap.h"
+#include "frame_trace.h"
+#include "carousel.h"
+#include "assets.h"
+#include "scene.h"
+#include "shadow_frame.h"
+#include "ui_strings.h"
 
 #define LCD_HOST SPI2_HOST
 #define LCD_H_RES 280
@@ -24,51 +46,454 @@
 #define LCD_D2 GPIO_NUM_13
 #define LCD_D3 GPIO_NUM_14
 #define LCD_RST GPIO_NUM_21
+#define LCD_TE -1 // Tearing effect output of the panel, set to its GPIO on boards that route it
 #define LCD_BPP 16
 #define DRAW_BUF_LINES 70
+#define DRAW_BUF_SIZE (LVGL_WIDTH * DRAW_BUF_LINES * 2)
+#define STRIPE_ROWS 8
+#define SPI_MAX_TRANSFER_SIZE DRAW_BUF_SIZE
+
+// Set to 1 to benchmark combinations of draw buffer and stripe heights on the panel at first boot and keep the fastest
+// one in NVS, later boots use the stored one. DRAW_BUF_LINES and STRIPE_ROWS are used until then. Only the landscape
+// software rotation mode is tuned, the other modes have fixed buffers.
+#define DISPLAY_AUTOTUNE 1
+#define AUTOTUNE_FRAMES 5
+#define AUTOTUNE_NVS_NAMESPACE "display"
+
+// Set to 1 to render in the panel's native portrait orientation, LVGL rotates the landscape UI while rendering and
+// flush_cb sends the draw buffer to the panel as is. 0 renders in landscape and rotates the pixels in flush_cb.
+#define DISPLAY_PORTRAIT_NATIVE 0
+// The transformed UI root is rendered through an ARGB8888 layer allocated from the LVGL heap, as tall as the draw
+// buffer is wide and as wide as the draw buffer is tall, so the portrait draw buffer is kept short to fit the pool.
+#define DRAW_BUF_LINES_PORTRAIT 32
+
+// Set to 1 to let LVGL render into a full landscape frame in PSRAM. flush_cb compares each 8x8 tile of the flushed area
+// with the frame last sent to the panel and only sends the tiles whose pixels changed.
+#define DISPLAY_SHADOW_FRAME 0
+#define TILE_SIZE SHADOW_TILE_SIZE
+
+#if DISPLAY_SHADOW_FRAME && DISPLAY_PORTRAIT_NATIVE
+#error "DISPLAY_SHADOW_FRAME only works with the landscape software rotation"
+#endif
+
+// Set to 1 to log the average time of a full screen redraw and of a temperature update at boot, to compare the modes.
+#define DISPLAY_BENCHMARK 0
+
+// Set by the FONT_BENCHMARK CMake option, logs the render time of every generated my_font variant at boot.
+#ifndef FONT_BENCHMARK
+#define FONT_BENCHMARK 0
+#endif
+
+// Set to 1 to pace frames by the panel's tearing effect signal instead of the LVGL refresh timer, which is deleted. Every
+// TE pulse wakes the LVGL loop, which runs the timers and renders right away so the transfer starts at the top of the
+// panel scan.
+// Compare the "frame gap" telemetry with it on and off to see the jitter.
+#define DISPLAY_TE_SYNC 0
+
+#if DISPLAY_TE_SYNC && LCD_TE < 0
+#error "DISPLAY_TE_SYNC needs LCD_TE"
+#endif
+
+// Set to 1 to composite the overlay into each background once, when the scene cache has loaded it, widgets on top then
+// only copy the cached pixels under them when they are redrawn. Not available in portrait mode, where the UI
+// root is transformed.
+#define UI_CACHED_BACKGROUND 1
+
+// Set by the UI_COMPRESSED_BACKGROUND CMake option (on by default) to use the LZ4 compressed background image for sunny
+// weather, decompressed into the PSRAM scene cache. It takes about half the flash of the raw one. The asset pack only
+// holds the selected one.
+#ifndef UI_COMPRESSED_BACKGROUND
+#define UI_COMPRESSED_BACKGROUND 1
+#endif
+
+// Set to 1 to load the backgrounds and my_font from the asset partition instead of the app, so that they are only
+// reflashed when they change (idf.py assets-flash) and the app doesn't link them. Whatever the partition lacks, all of
+// it while it holds no valid pack, is shown with a UI_FALLBACK_COLOR background and the built-in Montserrat 28. With 0
+// the app's beach is shown in all weathers.
+#define UI_ASSET_PARTITION 1
+#define UI_FALLBACK_COLOR 0x2A6F97
+
+// Set to 1 to cycle through the beaches with a slide between snapshots of their pages. Not available in portrait mode.
+#define UI_CAROUSEL 1
+
+// Set to 1 to draw the temperature from pre-rendered antialiased digit sprites instead of a my_font label.
+#define UI_DIGIT_SPRITES 1
+
+// Set by the build once the fonts target has generated readout_font.c, the 4 bpp subset of my_font the digit sprites
+// are rasterized from. Without it they are rasterized from my_font, which isn't antialiased.
+#ifndef READOUT_FONT
+#define READOUT_FONT 0
+#endif
+
+// Refresh period while animations run and for one-off changes, LVGL pauses the refresh timer when nothing changes.
+#define REFR_PERIOD_ANIM_MS 16
+#define REFR_PERIOD_IDLE_MS LV_DEF_REFR_PERIOD
+#define LVGL_TASK_PRIO 4
+
+// Lowest CPU frequency while nothing holds a power management lock, the CPU light sleeps when idle.
+#define PM_MIN_FREQ_MHZ 40
+
+// The CO5300 takes commands over QSPI as a write opcode with the command in the address bits.
+#define CO5300_QSPI_CMD(cmd) ((0x02 << 24) | ((cmd) << 8))
 
 static const char *TAG = "LVGL";
 
 LV_IMG_DECLARE(beach); // from the converted .c file
+LV_IMG_DECLARE(beach_lz4);
 LV_FONT_DECLARE(my_font);
+#if READOUT_FONT
+LV_FONT_DECLARE(readout_font);
+#endif
+
+// State shared between flush_cb and the panel IO transfer done callback.
+// The two DMA-capable stripe buffers are allocated once in app_main so that flushing never touches the heap,
+// one is being rotated into while the other one is transferred to the panel. They are not used in portrait mode.
+// The LVGL draw buffers are kept here in landscape mode so that the auto-tuner can replace them.
+typedef struct
+{
+    esp_lcd_panel_handle_t panel;
+    lv_display_t *disp;
+    lv_color16_t *draw_buf[2];
+    lv_color16_t *stripe_buf[2];
+    int32_t stripe_rows;
+    uint8_t next_buf;
+    volatile int pending; // Stripes of the current flush that are not yet transferred
+    int64_t refr_start;   // Telemetry timestamps, see flush_begin
+    int64_t refr_ready;
+    int64_t render_start;
+    int64_t spi_start;
+    esp_pm_lock_handle_t render_lock;   // Held from refresh start to refresh ready
+    esp_pm_lock_handle_t transfer_lock; // Held from the first queued transfer of a flush until the last one is done
+#if DISPLAY_SHADOW_FRAME
+    lv_color16_t *sent_frame;                          // What is on the panel, in LVGL orientation and byte order
+    bool sent_valid;                                   // Cleared until the first full frame has been sent
+    uint64_t tile_changed[LVGL_HEIGHT / TILE_SIZE]; // One bit per tile column, for each tile row
+#endif
+} flush_ctx_t;
+
+static flush_ctx_t flush_ctx;
+
+// LVGL time straight from esp_timer, which keeps counting through light sleep, instead of a periodic tick interrupt.
+static uint32_t lvgl_tick_get_cb(void)
+{
+    return (uint32_t)(esp_timer_get_time() / 1000);
+}
+
+// Called from the SPI ISR when a stripe has been transferred, the flush is done when the last stripe is on the panel.
+static bool IRAM_ATTR on_color_trans_done(esp_lcd_panel_io_handle_t io, esp_lcd_panel_io_event_data_t *edata, void *user_ctx)
+{
+    flush_ctx_t *ctx = (flush_ctx_t *)user_ctx;
+    if (--ctx->pending == 0)
+    {
+        telemetry_record(TELEMETRY_SPI_US, esp_timer_get_time() - ctx->spi_start);
+        esp_pm_lock_release(ctx->transfer_lock);
+        lv_display_flush_ready(ctx->disp);
+    }
+    return false;
+}
+
+// Records how long LVGL took to render the area being flushed, counted from the start of the refresh or the end of the
+// previous flush_cb.
+static void flush_begin(flush_ctx_t *ctx)
+{
+    LV_PROFILER_BEGIN_TAG("flush");
+    telemetry_record(TELEMETRY_RENDER_US, esp_timer_get_time() - ctx->render_start);
+}
+
+// Called right before the first transfer of a flush is queued, the CPU must not light sleep with transfers in flight.
+static void transfer_begin(flush_ctx_t *ctx, int64_t now)
+{
+    ctx->spi_start = now;
+    esp_pm_lock_acquire(ctx->transfer_lock);
+}
+
+// `bytes` is what the `transfers` queued for the panel, which is less than the area when unchanged tiles are skipped.
+static void flush_end(flush_ctx_t *ctx, const lv_area_t *area, uint32_t transfers, uint32_t bytes, int64_t rotate_us)
+{
+    telemetry_record(TELEMETRY_ROTATE_US, rotate_us);
+    telemetry_count_flush(lv_area_get_size(area), bytes, transfers);
+    ctx->render_start = esp_timer_get_time();
+    LV_PROFILER_END_TAG("flush");
+}
+
+// Times whole refreshes, and starts the render time of the first area of a refresh. The CPU runs at full speed while
+// rendering.
+static void refr_event_cb(lv_event_t *e)
+{
+    flush_ctx_t *ctx = (flush_ctx_t *)lv_event_get_user_data(e);
+    if (lv_event_get_code(e) == LV_EVENT_REFR_START)
+    {
+        esp_pm_lock_acquire(ctx->render_lock);
+        ctx->refr_start = ctx->render_start = esp_timer_get_time();
+    }
+    else
+    {
+        esp_pm_lock_release(ctx->render_lock);
+        int64_t now = esp_timer_get_time();
+        telemetry_record(TELEMETRY_FRAME_US, now - ctx->refr_start);
+        if (ctx->refr_ready)
+        {
+            telemetry_record(TELEMETRY_FRAME_GAP_US, now - ctx->refr_ready);
+        }
+        ctx->refr_ready = now;
+    }
+}
+
+// The task running lv_timer_handler, it sleeps until the next LVGL timer is due or until it is notified.
+static TaskHandle_t lvgl_task;
+
+#if DISPLAY_TE_SYNC
+static int64_t last_te;
+static volatile bool te_pulse; // Set by the TE ISR, the next loop of the LVGL task refreshes the display
+static bool te_active;         // The TE interrupt is enabled, light sleep would drop pulses
+static esp_pm_lock_handle_t te_lock;
+
+// Rising edge of the tearing effect signal, the panel has started a new scan.
+static void IRAM_ATTR te_isr(void *arg)
+{
+    int64_t now = esp_timer_get_time();
+    if (last_te)
+    {
+        telemetry_record(TELEMETRY_TE_GAP_US, now - last_te);
+    }
+    last_te = now;
+    te_pulse = true;
+
+    // The interrupt is only enabled once the task exists
+    BaseType_t woken = pdFALSE;
+    vTaskNotifyGiveFromISR(lvgl_task, &woken);
+    portYIELD_FROM_ISR(woken);
+}
+
+// Turns on the panel's TE output, pulsing at the start of every vertical blank, and sets up its interrupt disabled.
+// Call before the LVGL task starts, the panel IO is only used by its flushes from then on.
+static void te_sync_init(esp_lcd_panel_io_handle_t io)
+{
+    uint8_t mode = 0; // V-blank only
+    ESP_ERROR_CHECK(esp_lcd_panel_io_tx_param(io, CO5300_QSPI_CMD(LCD_CMD_TEON), &mode, 1));
+
+    ESP_ERROR_CHECK(esp_pm_lock_create(ESP_PM_NO_LIGHT_SLEEP, 0, "te", &te_lock));
+
+    const gpio_config_t te_config = {
+        .pin_bit_mask = 1ULL << LCD_TE,
+        .mode = GPIO_MODE_INPUT,
+        .intr_type = GPIO_INTR_DISABLE};
+    ESP_ERROR_CHECK(gpio_config(&te_config));
+    ESP_ERROR_CHECK(gpio_install_isr_service(0));
+    ESP_ERROR_CHECK(gpio_isr_handler_add(LCD_TE, te_isr, NULL));
+    ESP_ERROR_CHECK(gpio_intr_disable(LCD_TE));
+    ESP_ERROR_CHECK(gpio_set_intr_type(LCD_TE, GPIO_INTR_POSEDGE));
+}
+
+// Starts waking the LVGL task on every TE pulse, the first one refreshes what was drawn before the task started.
+static void te_sync_start(void)
+{
+    lv_lock();
+    te_active = true;
+    esp_pm_lock_acquire(te_lock);
+    ESP_ERROR_CHECK(gpio_intr_enable(LCD_TE));
+    lv_unlock();
+}
+#endif
+
+// Wakes the LVGL task when called from another task, so that it runs its timers without waiting out its current sleep.
+static void lvgl_wake(void)
+{
+    if (lvgl_task && xTaskGetCurrentTaskHandle() != lvgl_task)
+    {
+        xTaskNotifyGive(lvgl_task);
+    }
+}
+
+// Something was invalidated. LVGL resumes its refresh timer itself, in TE mode the TE interrupt is enabled again
+// instead. Wakes the LVGL task when the change came from another task so that it doesn't wait out its current sleep.
+static void refresh_wake_cb(lv_event_t *e)
+{
+#if DISPLAY_TE_SYNC
+    if (lvgl_task && !te_active)
+    {
+        te_active = true;
+        esp_pm_lock_acquire(te_lock);
+        gpio_intr_enable(LCD_TE);
+    }
+#endif
+    lvgl_wake();
+}
+
+// After a refresh the display keeps refreshing at the faster rate while animations are running, at the idle rate
+// otherwise. LVGL pauses its refresh timer once nothing is left to redraw, in TE mode the TE interrupt is stopped
+// instead until the next invalidation.
+static void refresh_pace_cb(lv_event_t *e)
+{
+    bool animating = lv_anim_count_running() > 0;
+    uint32_t period = animating ? REFR_PERIOD_ANIM_MS : REFR_PERIOD_IDLE_MS;
+    lv_timer_set_period(lv_anim_get_timer(), period);
+#if DISPLAY_TE_SYNC
+    if (!animating && lvgl_task && te_active)
+    {
+        te_active = false;
+        gpio_intr_disable(LCD_TE);
+        esp_pm_lock_release(te_lock);
+    }
+#else
+    lv_timer_set_period(lv_display_get_refr_timer(lv_event_get_target(e)), period);
+#endif
+}
+
+// Runs the LVGL timers and sleeps for exactly as long as they allow, or until notified.
+static void lvgl_task_fn(void *arg)
+{
+    while (1)
+    {
+        uint32_t delay_ms = lv_timer_handler(); // runs animations, screen updates, etc.
+#if DISPLAY_TE_SYNC
+        if (te_pulse)
+        {
+            // Refreshes the default display, which has no refresh timer
+            te_pulse = false;
+            lv_lock();
+            lv_display_refr_timer(NULL);
+            lv_unlock();
+        }
+#endif
+        TickType_t delay = delay_ms == LV_NO_TIMER_READY ? portMAX_DELAY
+                                                         : (delay_ms + portTICK_PERIOD_MS - 1) / portTICK_PERIOD_MS;
+        ulTaskNotifyTake(pdTRUE, delay);
+    }
+}
 
-static void lvgl_tick_cb(void *arg)
+#if DISPLAY_PORTRAIT_NATIVE
+// Flush callback for LVGL display in portrait mode, the area is already in panel orientation so the draw buffer is
+// swapped into the panel byte order and transferred directly without an intermediate copy.
+static void flush_cb(lv_display_t *disp, const lv_area_t *area, const void *px_map)
 {
-    lv_tick_inc(2);
+    flush_ctx_t *ctx = (flush_ctx_t *)lv_display_get_user_data(disp);
+    flush_begin(ctx);
+
+    int64_t start = esp_timer_get_time();
+    lv_draw_sw_rgb565_swap((void *)px_map, lv_area_get_size(area));
+    transfer_begin(ctx, esp_timer_get_time());
+
+    ctx->pending = 1;
+    esp_lcd_panel_draw_bitmap(ctx->panel, area->x1, area->y1, area->x2 + 1, area->y2 + 1, px_map);
+    flush_end(ctx, area, 1, lv_area_get_size(area) * sizeof(lv_color16_t), ctx->spi_start - start);
 }
+#elif DISPLAY_SHADOW_FRAME
+// Flush callback for LVGL display in shadow frame mode, px_map is the whole PSRAM frame and the area is aligned to the
+// tile grid by the rounder. Runs of changed tiles along a tile row are rotated like in the landscape flush_cb and
+// sent as one panel window each, unchanged tiles are skipped even though LVGL redrew them.
+static void flush_cb(lv_display_t *disp, const lv_area_t *area, const void *px_map)
+{
+    flush_ctx_t *ctx = (flush_ctx_t *)lv_display_get_user_data(disp);
+    flush_begin(ctx);
+    const lv_color16_t *frame = (const lv_color16_t *)px_map;
+    const int32_t tx1 = area->x1 / TILE_SIZE;
+    const int32_t tx2 = area->x2 / TILE_SIZE;
+    const int32_t ty1 = area->y1 / TILE_SIZE;
+    const int32_t ty2 = area->y2 / TILE_SIZE;
+
+    // Diff stage, marks the changed tiles and counts the runs up front so that the transfer done callback can tell
+    // when the last one is on the panel. The panel content is unknown until the first full frame has been sent.
+    int runs = shadow_frame_diff((const uint16_t *)frame, (const uint16_t *)ctx->sent_frame, LVGL_WIDTH, tx1, ty1, tx2,
+                                 ty2, !ctx->sent_valid, ctx->tile_changed);
+    if (lv_display_flush_is_last(disp))
+    {
+        ctx->sent_valid = true;
+    }
+
+    if (runs == 0)
+    {
+        flush_end(ctx, area, 0, 0, 0);
+        lv_display_flush_ready(disp);
+        return;
+    }
+    ctx->pending = runs;
 
+    int64_t rotate_us = 0;
+    uint32_t bytes = 0;
+    bool first = true;
+
+    for (int32_t ty = ty1; ty <= ty2; ty++)
+    {
+        const int32_t y = ty * TILE_SIZE;
+        int32_t run_first;
+        int32_t run_last;
+
+        for (int32_t tx = tx1; shadow_frame_next_run(ctx->tile_changed[ty], tx, tx2, &run_first, &run_last);
+             tx = run_last + 1)
+        {
+            const int32_t x = run_first * TILE_SIZE;
+            const int32_t width = (run_last + 1 - run_first) * TILE_SIZE;
+            shadow_frame_copy((uint16_t *)ctx->sent_frame, (const uint16_t *)frame, LVGL_WIDTH, run_first, run_last, ty);
+
+            // The buffer was last used two runs ago, and queuing the previous run waited for that transfer to finish.
+            lv_color16_t *line_buf = ctx->stripe_buf[ctx->next_buf];
+            ctx->next_buf ^= 1;
+
+            int64_t start = esp_timer_get_time();
+            rotate_stripe((uint16_t *)line_buf, (const uint16_t *)(frame + y * LVGL_WIDTH + x), LVGL_WIDTH, width, TILE_SIZE);
+            int64_t end = esp_timer_get_time();
+            rotate_us += end - start;
+            if (first)
+            {
+                transfer_begin(ctx, end);
+                first = false;
+            }
+
+            int32_t y_offset = LCD_H_RES - y;
+            esp_lcd_panel_draw_bitmap(ctx->panel, y_offset - TILE_SIZE, x, y_offset, x + width, line_buf);
+            bytes += width * TILE_SIZE * sizeof(lv_color16_t);
+        }
+    }
+    flush_end(ctx, area, runs, bytes, rotate_us);
+}
+#else
 // Flush callback for LVGL display, rotates pixels in order to work with LVGL in landscape mode
 // while still using the panel in portrait mode, because the panel or driver does not support landscape mode directly.
+// LVGL line y ends up in panel column (LCD_H_RES - 1 - y) and LVGL column x in panel row x, so only the panel window
+// covering the rotated area is sent.
+// The rotation also swaps the pixels into the panel byte order, so every pixel is touched once.
+// Stripes are queued to the panel without waiting for them, so the next stripe is rotated while the previous one is
+// on the wire. LVGL is told that the flush is ready from on_color_trans_done.
 static void flush_cb(lv_display_t *disp, const lv_area_t *area, const void *px_map)
 {
-    ESP_LOGI(TAG, "Flushing area: x1=%d, y1=%d, x2=%d, y2=%d", (int)area->x1, (int)area->y1, (int)area->x2, (int)area->y2);
-    esp_lcd_panel_handle_t panel = (esp_lcd_panel_handle_t)lv_display_get_user_data(disp);
+    flush_ctx_t *ctx = (flush_ctx_t *)lv_display_get_user_data(disp);
+    flush_begin(ctx);
     const lv_color16_t *color_map = (const lv_color16_t *)px_map;
-    lv_draw_sw_rgb565_swap(color_map, (area->x2 - area->x1 + 1) * (area->y2 - area->y1 + 1));
+    const int32_t width = lv_area_get_width(area);
+    const int32_t height = lv_area_get_height(area);
 
-    // Allocate a line buffer for drawing, must at least draw 2 rows at a time in order for the display driver to work.
-    // We also need to balance the size of the buffer due to the limited amount of memory available.
+    // Must at least draw 2 rows at a time in order for the display driver to work, the rounder keeps the area
+    // 8 pixel aligned so every stripe is a multiple of 2 rows.
+    const int32_t rows = ctx->stripe_rows;
 
-    const int rows = 8;
-    const int cols = LVGL_WIDTH;
-    lv_color16_t *line_buf = heap_caps_aligned_alloc(64, LVGL_WIDTH * rows * sizeof(lv_color16_t), MALLOC_CAP_DMA);
+    // All stripes are counted up front, so a transfer finishing while we are still rotating can't end the flush early.
+    const int stripes = (height + rows - 1) / rows;
+    ctx->pending = stripes;
 
-    for (uint16_t n = 0; n < area->y2 - area->y1; n += rows)
+    int64_t rotate_us = 0;
+    for (int32_t n = 0; n < height; n += rows)
     {
-        for (uint16_t x = 0; x < LVGL_WIDTH; x++)
+        // The buffer was last used two stripes ago, and queuing the previous stripe waited for that transfer to finish.
+        lv_color16_t *line_buf = ctx->stripe_buf[ctx->next_buf];
+        ctx->next_buf ^= 1;
+
+        const int32_t stripe_rows = height - n < rows ? height - n : rows;
+        int64_t start = esp_timer_get_time();
+        rotate_stripe((uint16_t *)line_buf, (const uint16_t *)(color_map + n * width), width, width, stripe_rows);
+        int64_t end = esp_timer_get_time();
+        rotate_us += end - start;
+        if (n == 0)
         {
-            for (uint8_t y = 0; y < rows; y++)
-            {
-                line_buf[x * rows + (rows - y - 1)] = color_map[(n + y) * cols + x];
-            }
+            transfer_begin(ctx, end);
         }
 
-        int y_offset = LCD_H_RES - area->y1 - n;
-        esp_lcd_panel_draw_bitmap(panel, y_offset - rows, 0, y_offset, LCD_V_RES, line_buf);
+        int32_t y_offset = LCD_H_RES - area->y1 - n;
+        esp_lcd_panel_draw_bitmap(ctx->panel, y_offset - stripe_rows, area->x1, y_offset, area->x2 + 1, line_buf);
     }
-    free(line_buf);
-    lv_disp_flush_ready(disp);
+    flush_end(ctx, area, stripes, lv_area_get_size(area) * sizeof(lv_color16_t), rotate_us);
 }
+#endif
 
 static void lvgl_display_rounder_callback(lv_event_t *e)
 {
@@ -79,22 +504,503 @@ static void lvgl_display_rounder_callback(lv_event_t *e)
     area->y2 = (area->y2 & ~0x7U) + 7;
 }
 
-static void anim_x_cb(void *var, int32_t v)
+// The background image and, with UI_CACHED_BACKGROUND, the PSRAM buffer backgrounds are composited with the overlay in.
+static struct
+{
+    lv_obj_t *scr;
+    lv_obj_t *img;
+    lv_obj_t *overlay;
+#if UI_CACHED_BACKGROUND && !DISPLAY_PORTRAIT_NATIVE
+    lv_draw_buf_t composite;
+#endif
+} ui_bg;
+
+#if UI_CACHED_BACKGROUND && !DISPLAY_PORTRAIT_NATIVE
+static void obj_set_hidden(lv_obj_t *obj, bool hidden)
+{
+    if (hidden)
+    {
+        lv_obj_add_flag(obj, LV_OBJ_FLAG_HIDDEN);
+    }
+    else
+    {
+        lv_obj_remove_flag(obj, LV_OBJ_FLAG_HIDDEN);
+    }
+}
+
+// Draws the overlay without its children into a background that was just loaded, through a snapshot of the two. The
+// overlay's own decorations are then part of every background, so it stops drawing them. The background stays as it
+// was if the snapshot fails.
+static void ui_background_prepare(lv_draw_buf_t *background)
+{
+    if (!ui_bg.composite.data || background->data_size != ui_bg.composite.data_size ||
+        background->header.stride != ui_bg.composite.header.stride)
+    {
+        return;
+    }
+    const void *shown = lv_image_get_src(ui_bg.img);
+    lv_image_set_src(ui_bg.img, background);
+    lv_obj_remove_local_style_prop(ui_bg.overlay, LV_STYLE_BORDER_WIDTH, 0);
+    lv_obj_remove_local_style_prop(ui_bg.overlay, LV_STYLE_SHADOW_WIDTH, 0);
+
+    // Everything else on the screen is hidden for the snapshot and put back as it was, the carousel hides the image and
+    // the overlay while it slides.
+    uint32_t hidden = 0;
+    uint32_t count = lv_obj_get_child_count(ui_bg.scr);
+    count = count < 32 ? count : 32;
+    for (uint32_t i = 0; i < count; i++)
+    {
+        lv_obj_t *child = lv_obj_get_child(ui_bg.scr, i);
+        hidden |= (uint32_t)lv_obj_has_flag(child, LV_OBJ_FLAG_HIDDEN) << i;
+        obj_set_hidden(child, child != ui_bg.img && child != ui_bg.overlay);
+    }
+    uint32_t overlay_count = lv_obj_get_child_count(ui_bg.overlay);
+    for (uint32_t i = 0; i < overlay_count; i++)
+    {
+        lv_obj_add_flag(lv_obj_get_child(ui_bg.overlay, i), LV_OBJ_FLAG_HIDDEN);
+    }
+    lv_obj_update_layout(ui_bg.scr);
+    lv_result_t res = lv_snapshot_take_to_draw_buf(ui_bg.scr, LV_COLOR_FORMAT_RGB565, &ui_bg.composite);
+    for (uint32_t i = 0; i < overlay_count; i++)
+    {
+        lv_obj_remove_flag(lv_obj_get_child(ui_bg.overlay, i), LV_OBJ_FLAG_HIDDEN);
+    }
+    for (uint32_t i = 0; i < count; i++)
+    {
+        obj_set_hidden(lv_obj_get_child(ui_bg.scr, i), hidden >> i & 1);
+    }
+    lv_obj_set_style_border_width(ui_bg.overlay, 0, 0);
+    lv_obj_set_style_shadow_width(ui_bg.overlay, 0, 0);
+    lv_image_set_src(ui_bg.img, shown);
+
+    if (res == LV_RESULT_OK)
+    {
+        memcpy(background->data, ui_bg.composite.data, background->data_size);
+        lv_image_cache_drop(background);
+    }
+    else
+    {
+        ESP_LOGE(TAG, "Failed to snapshot the background");
+    }
+}
+#endif
+
+// Keeps the widgets the backgrounds are shown in. With UI_CACHED_BACKGROUND the composite is allocated in PSRAM, the
+// scenes' images are shown as they are if it can't be.
+static void ui_background_init(lv_obj_t *scr, lv_obj_t *img_bg, lv_obj_t *overlay)
+{
+    ui_bg.scr = scr;
+    ui_bg.img = img_bg;
+    ui_bg.overlay = overlay;
+#if UI_CACHED_BACKGROUND && !DISPLAY_PORTRAIT_NATIVE
+    uint32_t stride = lv_draw_buf_width_to_stride(LVGL_WIDTH, LV_COLOR_FORMAT_RGB565);
+    uint32_t size = stride * LVGL_HEIGHT;
+    void *data = heap_caps_aligned_alloc(64, size, MALLOC_CAP_SPIRAM);
+    if (!data)
+    {
+        ESP_LOGE(TAG, "Failed to allocate the background cache (PSRAM, %d bytes)", (int)size);
+        return;
+    }
+    lv_draw_buf_init(&ui_bg.composite, LVGL_WIDTH, LVGL_HEIGHT, LV_COLOR_FORMAT_RGB565, stride, data, size);
+#endif
+}
+
+// Shows the background of a new scene, from the scene cache with the LVGL lock held.
+static void ui_background_show(const void *background)
+{
+    lv_image_set_src(ui_bg.img, background);
+}
+
+// The background of the scenes the asset pack doesn't have. With UI_ASSET_PARTITION it is a solid colour filled into
+// PSRAM on first use, so that the app doesn't link the beach.
+static const lv_image_dsc_t *app_background(void)
+{
+#if UI_ASSET_PARTITION
+    static lv_image_dsc_t solid;
+    if (!solid.data)
+    {
+        const uint32_t stride = lv_draw_buf_width_to_stride(LVGL_WIDTH, LV_COLOR_FORMAT_RGB565);
+        const uint32_t size = stride * LVGL_HEIGHT;
+        uint16_t *data = heap_caps_aligned_alloc(64, size, MALLOC_CAP_SPIRAM);
+        if (!data)
+        {
+            ESP_LOGE(TAG, "Failed to allocate the fallback background (PSRAM, %d bytes)", (int)size);
+            abort();
+        }
+        const uint16_t color = lv_color_to_u16(lv_color_hex(UI_FALLBACK_COLOR));
+        for (uint32_t i = 0; i < size / sizeof(uint16_t); i++)
+        {
+            data[i] = color;
+        }
+        solid.header.magic = LV_IMAGE_HEADER_MAGIC;
+        solid.header.cf = LV_COLOR_FORMAT_RGB565;
+        solid.header.w = LVGL_WIDTH;
+        solid.header.h = LVGL_HEIGHT;
+        solid.header.stride = stride;
+        solid.data_size = size;
+        solid.data = (const uint8_t *)data;
+    }
+    return &solid;
+#else
+    return UI_COMPRESSED_BACKGROUND ? &beach_lz4 : &beach;
+#endif
+}
+
+// Creates the parent of the landscape UI. In portrait mode it is a LVGL_WIDTH x LVGL_HEIGHT object rotated onto the
+// portrait screen, otherwise the screen itself.
+static lv_obj_t *ui_root_create(void)
+{
+    lv_obj_t *scr = lv_scr_act();
+#if DISPLAY_PORTRAIT_NATIVE
+    lv_obj_remove_flag(scr, LV_OBJ_FLAG_SCROLLABLE);
+
+    lv_obj_t *root = lv_obj_create(scr);
+    lv_obj_remove_style_all(root);
+    lv_obj_set_size(root, LVGL_WIDTH, LVGL_HEIGHT);
+
+    // Rotating 90° clockwise around the top left corner, placed at the right edge of the screen, puts LVGL line y in
+    // panel column (LCD_H_RES - 1 - y) and LVGL column x in panel row x, the same mapping as the landscape flush_cb.
+    lv_obj_set_pos(root, LCD_H_RES, 0);
+    lv_obj_set_style_transform_pivot_x(root, 0, 0);
+    lv_obj_set_style_transform_pivot_y(root, 0, 0);
+    lv_obj_set_style_transform_rotation(root, 900, 0);
+    return root;
+#else
+    return scr;
+#endif
+}
+
+#if !DISPLAY_PORTRAIT_NATIVE
+// Allocates the two flush stripe buffers for stripes of `rows` lines, false if either allocation failed.
+static bool stripe_buffers_alloc(int32_t rows)
+{
+    size_t stripe_size = LVGL_WIDTH * rows * sizeof(lv_color16_t);
+    flush_ctx.stripe_buf[0] = heap_caps_aligned_alloc(64, stripe_size, MALLOC_CAP_DMA);
+    flush_ctx.stripe_buf[1] = heap_caps_aligned_alloc(64, stripe_size, MALLOC_CAP_DMA);
+    flush_ctx.stripe_rows = rows;
+
+    if (!flush_ctx.stripe_buf[0] || !flush_ctx.stripe_buf[1])
+    {
+        ESP_LOGE(TAG, "Failed to allocate flush stripe buffers (DMA-capable, %d bytes each). stripe0: %p, stripe1: %p",
+                 (int)stripe_size, flush_ctx.stripe_buf[0], flush_ctx.stripe_buf[1]);
+        free(flush_ctx.stripe_buf[0]);
+        free(flush_ctx.stripe_buf[1]);
+        flush_ctx.stripe_buf[0] = flush_ctx.stripe_buf[1] = NULL;
+        return false;
+    }
+    return true;
+}
+#endif
+
+#if DISPLAY_BENCHMARK || (DISPLAY_AUTOTUNE && !DISPLAY_PORTRAIT_NATIVE && !DISPLAY_SHADOW_FRAME)
+// Redraws `obj` a number of times and returns the average frame time in microseconds, rendering and flushing included.
+static int64_t measure_redraw(lv_display_t *disp, lv_obj_t *obj, int frames)
+{
+    lv_lock();
+    lv_refr_now(disp);
+    int64_t start = esp_timer_get_time();
+    for (int i = 0; i < frames; i++)
+    {
+        lv_obj_invalidate(obj);
+        lv_refr_now(disp);
+    }
+    int64_t frame_us = (esp_timer_get_time() - start) / frames;
+    lv_unlock();
+    return frame_us;
+}
+#endif
+
+#if DISPLAY_BENCHMARK
+static void display_benchmark(lv_display_t *disp, lv_obj_t *temp_label)
+{
+    int64_t frame_us = measure_redraw(disp, lv_scr_act(), 10);
+    ESP_LOGI(TAG, "Full screen redraw with %s, %d draw units: %.1f ms/frame",
+             DISPLAY_PORTRAIT_NATIVE ? "portrait native rendering" : DISPLAY_SHADOW_FRAME ? "shadow frame" : "software rotation",
+             LV_DRAW_SW_DRAW_UNIT_CNT, frame_us / 1000.0f);
+
+    int64_t temp_us = measure_redraw(disp, temp_label, 10);
+    ESP_LOGI(TAG, "Temperature redraw from %s with %s background: %.2f ms/frame",
+             UI_DIGIT_SPRITES ? "digit sprites" : "label",
+             UI_CACHED_BACKGROUND && !DISPLAY_PORTRAIT_NATIVE ? "cached" : "PSRAM scene",
+             temp_us / 1000.0f);
+}
+#endif
+
+#if FONT_BENCHMARK
+#include "font_variants.h"
+
+typedef struct
+{
+    const lv_font_t *font;
+    const char *name;
+    int bpp;
+    bool compressed;
+} font_variant_t;
+
+#define FONT_VARIANT_ENTRY(font, bpp, compressed) {&font, #font, bpp, compressed},
+static const font_variant_t font_variants[] = {FONT_VARIANTS(FONT_VARIANT_ENTRY)};
+#undef FONT_VARIANT_ENTRY
+
+#define UI_STRING_ENTRY(id, font, text) {#font, text},
+static const struct
+{
+    const char *font;
+    const char *text;
+} font_benchmark_texts[] = {UI_STRINGS(UI_STRING_ENTRY)};
+#undef UI_STRING_ENTRY
+
+// Draws the my_font texts with every generated variant on an off-screen canvas and logs the time per glyph, to weigh
+// the antialiasing of the higher bpp against their render time and flash size.
+static void font_benchmark(void)
+{
+    const int32_t height = lv_font_get_line_height(&my_font) * 2;
+    const uint32_t stride = lv_draw_buf_width_to_stride(LVGL_WIDTH, LV_COLOR_FORMAT_RGB565);
+    uint8_t *data = heap_caps_aligned_alloc(64, stride * height, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (!data)
+    {
+        ESP_LOGE(TAG, "Failed to allocate the font benchmark canvas (%d bytes)", (int)(stride * height));
+        return;
+    }
+
+    lv_lock();
+    lv_draw_buf_t buf;
+    lv_draw_buf_init(&buf, LVGL_WIDTH, height, LV_COLOR_FORMAT_RGB565, stride, data, stride * height);
+    lv_obj_t *canvas = lv_canvas_create(lv_layer_sys());
+    lv_obj_add_flag(canvas, LV_OBJ_FLAG_HIDDEN);
+    lv_canvas_set_draw_buf(canvas, &buf);
+
+    lv_draw_label_dsc_t label_dsc;
+    lv_draw_label_dsc_init(&label_dsc);
+    label_dsc.color = lv_color_white();
+    const lv_area_t area = {0, 0, LVGL_WIDTH - 1, height - 1};
+
+    for (int v = 0; v < sizeof(font_variants) / sizeof(font_variants[0]); v++)
+    {
+        label_dsc.font = font_variants[v].font;
+        uint32_t glyphs = 0;
+        int64_t start = esp_timer_get_time();
+        for (int run = 0; run < 10; run++)
+        {
+            for (int i = 0; i < sizeof(font_benchmark_texts) / sizeof(font_benchmark_texts[0]); i++)
+            {
+                if (strcmp(font_benchmark_texts[i].font, "my_font") != 0)
+                {
+                    continue;
+                }
+                lv_draw_buf_clear(&buf, NULL);
+                lv_layer_t layer;
+                lv_canvas_init_layer(canvas, &layer);
+                label_dsc.text = font_benchmark_texts[i].text;
+                lv_draw_label(&layer, &label_dsc, &area);
+                lv_canvas_finish_layer(canvas, &layer);
+                glyphs += lv_text_get_encoded_length(font_benchmark_texts[i].text);
+            }
+        }
+        int64_t elapsed_us = esp_timer_get_time() - start;
+        ESP_LOGI(TAG, "Font %s (%d bpp%s): %.2f us/glyph", font_variants[v].name, font_variants[v].bpp,
+                 font_variants[v].compressed ? ", compressed" : "", (float)elapsed_us / glyphs);
+    }
+
+    lv_obj_delete(canvas);
+    lv_unlock();
+    free(data);
+}
+#endif
+
+#if !DISPLAY_PORTRAIT_NATIVE && !DISPLAY_SHADOW_FRAME
+// Heights of the LVGL draw buffers and of the flush stripes, in lines.
+typedef struct
+{
+    uint8_t draw_lines;
+    uint8_t stripe_rows;
+} display_config_t;
+
+// Allocates both LVGL draw buffers and the stripe buffers and hands the draw buffers to LVGL.
+// Returns false and leaves nothing allocated if the memory isn't available.
+static bool display_buffers_alloc(lv_display_t *disp, const display_config_t *config)
+{
+    size_t buf_size = LVGL_WIDTH * config->draw_lines * sizeof(lv_color16_t);
+    flush_ctx.draw_buf[0] = heap_caps_aligned_alloc(64, buf_size, MALLOC_CAP_DMA);
+    flush_ctx.draw_buf[1] = heap_caps_aligned_alloc(64, buf_size, MALLOC_CAP_DMA);
+
+    if (!flush_ctx.draw_buf[0] || !flush_ctx.draw_buf[1])
+    {
+        ESP_LOGE(TAG, "Failed to allocate LVGL display buffers (DMA-capable, %d bytes each). buf1: %p, buf2: %p",
+                 (int)buf_size, flush_ctx.draw_buf[0], flush_ctx.draw_buf[1]);
+    }
+    if (!flush_ctx.draw_buf[0] || !flush_ctx.draw_buf[1] || !stripe_buffers_alloc(config->stripe_rows))
+    {
+        free(flush_ctx.draw_buf[0]);
+        free(flush_ctx.draw_buf[1]);
+        flush_ctx.draw_buf[0] = flush_ctx.draw_buf[1] = NULL;
+        return false;
+    }
+    lv_display_set_buffers(disp, flush_ctx.draw_buf[0], flush_ctx.draw_buf[1], buf_size, LV_DISPLAY_RENDER_MODE_PARTIAL);
+    return true;
+}
+
+#if DISPLAY_AUTOTUNE
+// Candidates tried by the auto-tuner, stripes are kept to multiples of 8 rows for the vector rotate kernel.
+static const uint8_t autotune_draw_lines[] = {24, 40, 56, 70, 88};
+static const uint8_t autotune_stripe_rows[] = {8, 16, 24, 32};
+
+// Frees the buffers of display_buffers_alloc once the last stripe has left them.
+static void display_buffers_free(void)
+{
+    while (flush_ctx.pending > 0)
+    {
+        vTaskDelay(1);
+    }
+    for (int i = 0; i < 2; i++)
+    {
+        free(flush_ctx.draw_buf[i]);
+        free(flush_ctx.stripe_buf[i]);
+        flush_ctx.draw_buf[i] = NULL;
+        flush_ctx.stripe_buf[i] = NULL;
+    }
+}
+
+// Reads the configuration stored by the auto-tuner, false if there is none yet.
+static bool display_config_load(display_config_t *config)
+{
+    nvs_handle_t nvs;
+    if (nvs_open(AUTOTUNE_NVS_NAMESPACE, NVS_READONLY, &nvs) != ESP_OK)
+    {
+        return false;
+    }
+    display_config_t stored;
+    bool found = nvs_get_u8(nvs, "draw_lines", &stored.draw_lines) == ESP_OK &&
+                 nvs_get_u8(nvs, "stripe_rows", &stored.stripe_rows) == ESP_OK;
+    nvs_close(nvs);
+
+    // The rounder needs room for at least one 8 pixel aligned row of areas and stripes must stay aligned to it.
+    if (!found || stored.draw_lines < 8 || stored.stripe_rows == 0 || stored.stripe_rows % 8 != 0 ||
+        LVGL_WIDTH * stored.stripe_rows * sizeof(lv_color16_t) > SPI_MAX_TRANSFER_SIZE)
+    {
+        return false;
+    }
+    *config = stored;
+    return true;
+}
+
+static void display_config_save(const display_config_t *config)
+{
+    nvs_handle_t nvs;
+    esp_err_t err = nvs_open(AUTOTUNE_NVS_NAMESPACE, NVS_READWRITE, &nvs);
+    if (err == ESP_OK)
+    {
+        err = nvs_set_u8(nvs, "draw_lines", config->draw_lines);
+        if (err == ESP_OK)
+        {
+            err = nvs_set_u8(nvs, "stripe_rows", config->stripe_rows);
+        }
+        if (err == ESP_OK)
+        {
+            err = nvs_commit(nvs);
+        }
+        nvs_close(nvs);
+    }
+    if (err != ESP_OK)
+    {
+        ESP_LOGW(TAG, "Failed to store the display configuration: %s", esp_err_to_name(err));
+    }
+}
+
+// Forgets the stored configuration, the next boot tunes again.
+static void display_config_erase(void)
 {
-    lv_obj_set_x((lv_obj_t *)var, v);
+    nvs_handle_t nvs;
+    esp_err_t err = nvs_open(AUTOTUNE_NVS_NAMESPACE, NVS_READWRITE, &nvs);
+    if (err == ESP_OK)
+    {
+        err = nvs_erase_all(nvs);
+        if (err == ESP_OK)
+        {
+            err = nvs_commit(nvs);
+        }
+        nvs_close(nvs);
+    }
+    if (err != ESP_OK)
+    {
+        ESP_LOGW(TAG, "Failed to erase the display configuration: %s", esp_err_to_name(err));
+    }
 }
 
+// Redraws the current screen with every candidate configuration that fits in memory and in a single SPI transfer,
+// stores the fastest one and leaves its buffers allocated.
+static void display_autotune(lv_display_t *disp, display_config_t *config)
+{
+    display_config_t best = *config;
+    int64_t best_us = INT64_MAX;
+
+    for (size_t i = 0; i < sizeof(autotune_draw_lines); i++)
+    {
+        for (size_t j = 0; j < sizeof(autotune_stripe_rows); j++)
+        {
+            display_config_t candidate = {autotune_draw_lines[i], autotune_stripe_rows[j]};
+            if (LVGL_WIDTH * candidate.stripe_rows * sizeof(lv_color16_t) > SPI_MAX_TRANSFER_SIZE)
+            {
+                continue;
+            }
+
+            display_buffers_free();
+            if (!display_buffers_alloc(disp, &candidate))
+            {
+                ESP_LOGW(TAG, "Skipping draw buffer %d lines, stripe %d rows", candidate.draw_lines, candidate.stripe_rows);
+                continue;
+            }
+
+            int64_t frame_us = measure_redraw(disp, lv_scr_act(), AUTOTUNE_FRAMES);
+            ESP_LOGI(TAG, "Draw buffer %d lines, stripe %d rows: %.1f ms/frame", candidate.draw_lines,
+                     candidate.stripe_rows, frame_us / 1000.0f);
+            if (frame_us < best_us)
+            {
+                best_us = frame_us;
+                best = candidate;
+            }
+        }
+    }
+
+    display_buffers_free();
+    if (best_us != INT64_MAX)
+    {
+        ESP_LOGI(TAG, "Using draw buffer %d lines, stripe %d rows", best.draw_lines, best.stripe_rows);
+        display_config_save(&best);
+    }
+    *config = best;
+}
+#endif
+#endif
+
 void app_main(void)
 {
+    // 0. NVS, holds the display configuration picked by the auto-tuner
+    esp_err_t ret = nvs_flash_init();
+    if (ret == ESP_ERR_NVS_NO_FREE_PAGES || ret == ESP_ERR_NVS_NEW_VERSION_FOUND)
+    {
+        ESP_ERROR_CHECK(nvs_flash_erase());
+        ret = nvs_flash_init();
+    }
+    ESP_ERROR_CHECK(ret);
+
+    // Scale the CPU down and light sleep whenever no lock is held, LVGL holds them while it renders and transfers.
+    esp_pm_config_t pm_config = {
+        .max_freq_mhz = CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ,
+        .min_freq_mhz = PM_MIN_FREQ_MHZ,
+        .light_sleep_enable = true};
+    ESP_ERROR_CHECK(esp_pm_configure(&pm_config));
+    ESP_ERROR_CHECK(esp_pm_lock_create(ESP_PM_CPU_FREQ_MAX, 0, "render", &flush_ctx.render_lock));
+    ESP_ERROR_CHECK(esp_pm_lock_create(ESP_PM_NO_LIGHT_SLEEP, 0, "transfer", &flush_ctx.transfer_lock));
+
     // 1. Initialize SPI bus
     spi_bus_config_t buscfg = CO5300_PANEL_BUS_QSPI_CONFIG(
         LCD_CLK, LCD_D0, LCD_D1, LCD_D2, LCD_D3,
-        LCD_H_RES * DRAW_BUF_LINES * 2);
+        SPI_MAX_TRANSFER_SIZE);
     ESP_ERROR_CHECK(spi_bus_initialize(LCD_HOST, &buscfg, SPI_DMA_CH_AUTO));
 
     // 2. Attach LCD to bus
     esp_lcd_panel_io_handle_t io_handle;
-    esp_lcd_panel_io_spi_config_t io_config = CO5300_PANEL_IO_QSPI_CONFIG(LCD_CS, NULL, NULL);
+    esp_lcd_panel_io_spi_config_t io_config = CO5300_PANEL_IO_QSPI_CONFIG(LCD_CS, on_color_trans_done, &flush_ctx);
     ESP_ERROR_CHECK(esp_lcd_new_panel_io_spi((esp_lcd_spi_bus_handle_t)LCD_HOST, &io_config, &io_handle));
 
     co5300_vendor_config_t vendor_config = {
@@ -115,18 +1021,57 @@ void app_main(void)
 
     ESP_ERROR_CHECK(esp_lcd_panel_disp_on_off(panel, true));
 
+#if ROTATE_BENCHMARK
+    rotate_benchmark();
+#endif
+
     // 3. LVGL setup
     lv_init();
+    lv_tick_set_cb(lvgl_tick_get_cb);
+    frame_trace_init();
 
+#if DISPLAY_PORTRAIT_NATIVE
+    lv_display_t *disp = lv_display_create(LCD_H_RES, LCD_V_RES);
+#else
     lv_display_t *disp = lv_display_create(LVGL_WIDTH, LCD_H_RES);
+#endif
     lv_display_set_color_format(disp, LV_COLOR_FORMAT_RGB565);
 
     lv_display_set_flush_cb(disp, (lv_display_flush_cb_t)flush_cb);
-    lv_display_set_user_data(disp, panel);
+    flush_ctx.panel = panel;
+    flush_ctx.disp = disp;
+    lv_display_set_user_data(disp, &flush_ctx);
     lv_display_add_event_cb(disp, lvgl_display_rounder_callback, LV_EVENT_INVALIDATE_AREA, NULL);
+    lv_display_add_event_cb(disp, refr_event_cb, LV_EVENT_REFR_START, &flush_ctx);
+    lv_display_add_event_cb(disp, refr_event_cb, LV_EVENT_REFR_READY, &flush_ctx);
+    lv_display_add_event_cb(disp, refresh_wake_cb, LV_EVENT_INVALIDATE_AREA, NULL);
+    lv_display_add_event_cb(disp, refresh_pace_cb, LV_EVENT_REFR_READY, NULL);
+
+#if DISPLAY_SHADOW_FRAME
+    // LVGL renders straight into a full frame, the previous one is kept to diff against. Both are too large for
+    // internal memory and only the stripe buffers need to be DMA-capable.
+    size_t frame_size = LVGL_WIDTH * LVGL_HEIGHT * sizeof(lv_color16_t);
+
+    ESP_LOGI(TAG, "Frame size: %d bytes", (int)frame_size);
+
+    lv_color_t *frame = heap_caps_aligned_alloc(64, frame_size, MALLOC_CAP_SPIRAM);
+    flush_ctx.sent_frame = heap_caps_aligned_alloc(64, frame_size, MALLOC_CAP_SPIRAM);
+
+    if (!frame || !flush_ctx.sent_frame)
+    {
+        ESP_LOGE(TAG, "Failed to allocate shadow frames (PSRAM). frame: %p, sent: %p", frame, flush_ctx.sent_frame);
+        abort();
+    }
+    lv_display_set_buffers(disp, frame, NULL, frame_size, LV_DISPLAY_RENDER_MODE_DIRECT);
 
-    // Allocate buffer (1/4 screen)
-    size_t buf_size = LVGL_WIDTH * DRAW_BUF_LINES * 2;
+    // Stripe buffers for the rotated tiles sent by flush_cb
+    if (!stripe_buffers_alloc(TILE_SIZE))
+    {
+        abort();
+    }
+#elif DISPLAY_PORTRAIT_NATIVE
+    // Allocate buffer
+    size_t buf_size = LCD_H_RES * DRAW_BUF_LINES_PORTRAIT * 2;
 
     ESP_LOGI(TAG, "Buffer size: %d bytes", (int)buf_size);
 
@@ -139,23 +1084,76 @@ void app_main(void)
         abort();
     }
     lv_display_set_buffers(disp, buf1, buf2, buf_size, LV_DISPLAY_RENDER_MODE_PARTIAL);
+#else
+    // Draw buffers plus the stripe buffers for the rotated pixels sent by flush_cb, we need to balance their size
+    // due to the limited amount of internal DMA memory available.
+    display_config_t display_config = {DRAW_BUF_LINES, STRIPE_ROWS};
+#if DISPLAY_AUTOTUNE
+    bool display_tuned = display_config_load(&display_config);
+#endif
 
-    // 4. Start LVGL tick timer
-    const esp_timer_create_args_t tick_args = {
-        .callback = lvgl_tick_cb,
-        .name = "lv_tick"};
-    esp_timer_handle_t tick_timer;
-    ESP_ERROR_CHECK(esp_timer_create(&tick_args, &tick_timer));
-    ESP_ERROR_CHECK(esp_timer_start_periodic(tick_timer, 2 * 1000)); // 2ms
+    ESP_LOGI(TAG, "Buffer size: %d lines, stripe size: %d rows", display_config.draw_lines, display_config.stripe_rows);
+
+#if DISPLAY_AUTOTUNE
+    // A configuration tuned by an earlier firmware may not fit next to what this one allocates, it is dropped and tuned
+    // again from the defaults
+    if (display_tuned && !display_buffers_alloc(disp, &display_config))
+    {
+        ESP_LOGW(TAG, "Stored display configuration doesn't fit, tuning again");
+        display_config_erase();
+        display_config = (display_config_t){DRAW_BUF_LINES, STRIPE_ROWS};
+        display_tuned = false;
+    }
+#endif
+    if (!flush_ctx.draw_buf[0] && !display_buffers_alloc(disp, &display_config))
+    {
+        abort();
+    }
+#endif
 
     // --- 6. Flex layout
 
-    lv_obj_t *img_bg = lv_image_create(lv_scr_act());
-    lv_image_set_src(img_bg, &beach);
+    // What the asset partition lacks, all of it after an app only flash or update, is shown with the app's own
+    // background and font
+    const lv_image_dsc_t *scene_sources[SCENE_COUNT] = {0};
+    const lv_font_t *large_font = NULL;
+#if UI_ASSET_PARTITION
+    static const char *const scene_assets[SCENE_COUNT] = {
+        [SCENE_SUNNY] = UI_COMPRESSED_BACKGROUND ? "beach_lz4" : "beach",
+        [SCENE_CLOUDY] = "beach_cloudy",
+        [SCENE_STORMY] = "beach_stormy",
+        [SCENE_COLD] = "beach_cold",
+        [SCENE_NIGHT] = "beach_night",
+    };
+    if (assets_init())
+    {
+        for (int i = 0; i < SCENE_COUNT; i++)
+        {
+            scene_sources[i] = assets_image(scene_assets[i]);
+        }
+        large_font = assets_font("my_font");
+    }
+    else
+    {
+        ESP_LOGW(TAG, "Using the app's background and font");
+    }
+    const lv_font_t *app_font = &lv_font_montserrat_28;
+#else
+    const lv_font_t *app_font = &my_font;
+#endif
+    for (int i = 0; i < SCENE_COUNT; i++)
+    {
+        scene_sources[i] = scene_sources[i] ? scene_sources[i] : app_background();
+    }
+    large_font = large_font ? large_font : app_font;
+
+    lv_obj_t *ui_root = ui_root_create();
+
+    lv_obj_t *img_bg = lv_image_create(ui_root);
     lv_obj_set_size(img_bg, LVGL_WIDTH, LCD_H_RES);
     lv_obj_align(img_bg, LV_ALIGN_CENTER, 0, 0);
 
-    lv_obj_t *overlay = lv_obj_create(lv_scr_act());
+    lv_obj_t *overlay = lv_obj_create(ui_root);
     lv_obj_set_size(overlay, LVGL_WIDTH, LVGL_HEIGHT);
     lv_obj_set_style_bg_opa(overlay, LV_OPA_TRANSP, 0);
     lv_obj_set_layout(overlay, LV_LAYOUT_FLEX);
@@ -164,31 +1162,139 @@ void app_main(void)
     lv_obj_set_style_flex_cross_place(overlay, LV_FLEX_ALIGN_START, 0);
     lv_obj_set_style_pad_top(overlay, 40, 0);
 
+    // Placeholder readings until a data source publishes them
+    const struct
+    {
+        ui_string_t location;
+        int32_t temperature_tenths;
+        reading_weather_t weather;
+    } beaches[] = {
+        {UI_STR_BEACH_AHUS, 204, READING_WEATHER_SUNNY},
+        {UI_STR_BEACH_MOLLE, 189, READING_WEATHER_CLOUDY},
+        {UI_STR_BEACH_LOMMA, 217, READING_WEATHER_STORMY},
+        {UI_STR_BEACH_SKANOR, 145, READING_WEATHER_SUNNY},
+    };
+    const int beach_count = sizeof(beaches) / sizeof(beaches[0]);
+    reading_t readings[sizeof(beaches) / sizeof(beaches[0])];
+    for (int i = 0; i < beach_count; i++)
+    {
+        readings[i] = (reading_t){.temperature_tenths = beaches[i].temperature_tenths,
+                                  .timestamp = 15 * 60 * 60,
+                                  .weather = beaches[i].weather};
+        strlcpy(readings[i].location, ui_strings[beaches[i].location], sizeof(readings[i].location));
+    }
+    reading_init(&readings[0], lvgl_wake);
+
     lv_obj_t *location_label = lv_label_create(overlay);
 
-    lv_label_set_text(location_label, "Åhus, Täppet");
-    lv_obj_set_style_text_font(location_label, &my_font, 0);
+    reading_bind_label(location_label, READING_LOCATION);
+    lv_obj_set_style_text_font(location_label, large_font, 0);
     lv_obj_set_style_text_color(location_label, lv_color_hex(0xFFFFFF), 0);
 
+#if UI_DIGIT_SPRITES
+#if READOUT_FONT
+    const lv_font_t *readout_font_used = &readout_font;
+#else
+    const lv_font_t *readout_font_used = large_font;
+#endif
+    if (!readout_atlas_init(readout_font_used))
+    {
+        abort();
+    }
+    lv_obj_t *temp_label = readout_create(overlay);
+
+    reading_bind_readout(temp_label, READING_TEMPERATURE);
+    readout_set_color(temp_label, lv_color_hex(0xFFFFFF));
+#else
     lv_obj_t *temp_label = lv_label_create(overlay);
 
-    lv_label_set_text(temp_label, "20.4 °C");
-    lv_obj_set_style_text_font(temp_label, &my_font, 0);
+    reading_bind_label(temp_label, READING_TEMPERATURE);
+    lv_obj_set_style_text_font(temp_label, large_font, 0);
     lv_obj_set_style_text_color(temp_label, lv_color_hex(0xFFFFFF), 0);
+#endif
 
     lv_obj_t *date_label = lv_label_create(overlay);
 
-    lv_label_set_text(date_label, "Idag kl 15:00");
+    reading_bind_label(date_label, READING_TIMESTAMP);
     lv_obj_set_style_text_font(date_label, &lv_font_montserrat_28, 0);
     lv_obj_set_style_text_color(date_label, lv_color_hex(0xFFFFFF), 0);
 
+    frame_trace_obj(img_bg, "beach");
+    frame_trace_obj(overlay, "overlay");
+    frame_trace_obj(location_label, "location");
+    frame_trace_obj(temp_label, "temperature");
+    frame_trace_obj(date_label, "date");
+
     // // Apply rotation in degrees * 10 (e.g. 90° = 900)
     // lv_obj_set_style_transform_angle(temp_label, 900, 0);
 
-    // 8. Loop
-    while (1)
+    // The background follows the shown reading from here on
+    ui_background_init(ui_root, img_bg, overlay);
+#if UI_CACHED_BACKGROUND && !DISPLAY_PORTRAIT_NATIVE
+    scene_prepare_cb_t prepare = ui_background_prepare;
+#else
+    scene_prepare_cb_t prepare = NULL;
+#endif
+    if (!scene_init(scene_sources, &readings[0], prepare, ui_background_show, lvgl_wake))
     {
-        lv_timer_handler(); // runs animations, screen updates, etc.
-        vTaskDelay(pdMS_TO_TICKS(16));
+        abort();
     }
+
+#if UI_CAROUSEL && !DISPLAY_PORTRAIT_NATIVE
+    lv_lock();
+    carousel_create(ui_root, readings, beach_count);
+    lv_unlock();
+#endif
+
+#if DISPLAY_AUTOTUNE && !DISPLAY_PORTRAIT_NATIVE && !DISPLAY_SHADOW_FRAME
+    // First boot, measure the real scene
+    if (!display_tuned)
+    {
+        display_autotune(disp, &display_config);
+        if (!display_buffers_alloc(disp, &display_config))
+        {
+            abort();
+        }
+    }
+#endif
+
+#if DISPLAY_BENCHMARK
+    display_benchmark(disp, temp_label);
+#endif
+#if FONT_BENCHMARK
+    font_benchmark();
+#endif
+
+    // 7. Console on the UART, for reading the telemetry from deployed units. From here on log lines are written by a
+    // background task so that they don't stall rendering.
+    log_ring_start();
+    esp_console_repl_t *repl = NULL;
+    esp_console_repl_config_t repl_config = ESP_CONSOLE_REPL_CONFIG_DEFAULT();
+    repl_config.prompt = "swim>";
+    esp_console_dev_uart_config_t uart_config = ESP_CONSOLE_DEV_UART_CONFIG_DEFAULT();
+    ESP_ERROR_CHECK(esp_console_new_repl_uart(&uart_config, &repl_config, &repl));
+    esp_console_register_help_command();
+    telemetry_register_commands();
+    lvgl_heap_register_commands();
+    frame_trace_register_commands();
+    scene_register_commands();
+    ESP_ERROR_CHECK(esp_console_start_repl(repl));
+    // Typing wakes the CPU from light sleep, the first characters are lost
+    ESP_ERROR_CHECK(uart_set_wakeup_threshold(CONFIG_ESP_CONSOLE_UART_NUM, 3));
+    ESP_ERROR_CHECK(esp_sleep_enable_uart_wakeup(CONFIG_ESP_CONSOLE_UART_NUM));
+
+    // 8. LVGL task
+    // LVGL runs with its FreeRTOS layer, the software draw units render on their own tasks on both cores while the LVGL
+    // task drives the timers and flushing. lv_timer_handler holds the LVGL lock while it runs, other tasks changing the
+    // UI must wrap their LVGL calls in lv_lock() / lv_unlock(), the invalidation wakes the LVGL task.
+#if DISPLAY_TE_SYNC
+    // The refresh timer is replaced by the TE pulse, a missing pulse only slows the UI down. Deleted rather than paused,
+    // every invalidation would resume it.
+    lv_display_delete_refr_timer(disp);
+    te_sync_init(io_handle);
+#endif
+    xTaskCreate(lvgl_task_fn, "lvgl", 8192, disp, LVGL_TASK_PRIO, &lvgl_task);
+#if DISPLAY_TE_SYNC
+    te_sync_start();
+#endif
 }
@@ -0,0 +1,194 @@
+#include "frame_trace.h"
+
+#if LV_USE_PROFILER && LV_USE_PROFILER_BUILTIN
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_err.h"
+#include "esp_console.h"
+#include "esp_cpu.h"
+#include "esp_timer.h"
+
+// Tasks that recorded spans, the index is the trace's thread id. Slots are claimed once per task and never freed.
+static TaskHandle_t tasks[FRAME_TRACE_MAX_TASKS];
+static bool first_event;
+static uint32_t unparsed;
+
+static uint64_t trace_tick_get_cb(void)
+{
+    return esp_timer_get_time();
+}
+
+static int trace_tid_get_cb(void)
+{
+    TaskHandle_t self = xTaskGetCurrentTaskHandle();
+    for (int i = 0; i < FRAME_TRACE_MAX_TASKS; i++)
+    {
+        TaskHandle_t expected = NULL;
+        if (tasks[i] == self ||
+            __atomic_compare_exchange_n(&tasks[i], &expected, self, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+        {
+            return i;
+        }
+    }
+    return FRAME_TRACE_MAX_TASKS;
+}
+
+static int trace_cpu_get_cb(void)
+{
+    return esp_cpu_get_core_id();
+}
+
+// Events are separated by commas, the first one opens the array.
+static const char *event_separator(void)
+{
+    bool first = first_event;
+    first_event = false;
+    return first ? "\n" : ",\n";
+}
+
+// Prints `text` as the contents of a JSON string, tag and task names can hold quotes and backslashes.
+static void print_json_string(const char *text)
+{
+    for (const char *c = text; *c; c++)
+    {
+        if (*c == '"' || *c == '\\')
+        {
+            printf("\\%c", *c);
+        }
+        else if ((unsigned char)*c < 0x20)
+        {
+            printf("\\u%04x", (unsigned char)*c);
+        }
+        else
+        {
+            putchar(*c);
+        }
+    }
+}
+
+// The builtin profiler writes one systrace line per span edge, "LVGL-<tid> [<cpu>] <s>.<us>: tracing_mark_write:
+// <B|E>|1|<name>", each is printed as a Chrome trace event.
+static void trace_flush_cb(const char *line)
+{
+    int tid;
+    int cpu;
+    unsigned long sec;
+    unsigned long usec;
+    char phase;
+    char name[64];
+    if (sscanf(line, " LVGL-%d [%d] %lu.%lu: tracing_mark_write: %c|%*d|%63[^\n]", &tid, &cpu, &sec, &usec, &phase,
+               name) != 6)
+    {
+        unparsed++;
+        return;
+    }
+    printf("%s{\"name\":\"", event_separator());
+    print_json_string(name);
+    printf("\",\"ph\":\"%c\",\"ts\":%llu,\"pid\":1,\"tid\":%d,\"args\":{\"cpu\":%d}}", phase,
+           (unsigned long long)sec * 1000000 + usec, tid, cpu);
+}
+
+void frame_trace_init(void)
+{
+    lv_profiler_builtin_config_t config;
+    lv_profiler_builtin_config_init(&config);
+    config.buf_size = LV_PROFILER_BUILTIN_BUF_SIZE;
+    config.tick_per_sec = 1000000;
+    config.tick_get_cb = trace_tick_get_cb;
+    config.tid_get_cb = trace_tid_get_cb;
+    config.cpu_get_cb = trace_cpu_get_cb;
+    config.flush_cb = trace_flush_cb;
+
+    lv_profiler_builtin_uninit();
+    lv_profiler_builtin_init(&config);
+    lv_profiler_builtin_set_enable(false);
+}
+
+static void trace_obj_cb(lv_event_t *e)
+{
+    const char *name = lv_event_get_user_data(e);
+    if (lv_event_get_code(e) == LV_EVENT_DRAW_MAIN_BEGIN)
+    {
+        LV_PROFILER_BEGIN_TAG(name);
+    }
+    else
+    {
+        LV_PROFILER_END_TAG(name);
+    }
+}
+
+void frame_trace_obj(lv_obj_t *obj, const char *name)
+{
+    lv_obj_add_event_cb(obj, trace_obj_cb, LV_EVENT_DRAW_MAIN_BEGIN, (void *)name);
+    lv_obj_add_event_cb(obj, trace_obj_cb, LV_EVENT_DRAW_POST_END, (void *)name);
+}
+
+static int trace_cmd(int argc, char **argv)
+{
+    int ms = argc > 1 ? atoi(argv[1]) : FRAME_TRACE_DEFAULT_MS;
+    if (ms <= 0)
+    {
+        printf("usage: trace [ms]\n");
+        return 1;
+    }
+
+    // The frames are rendered by the LVGL task as usual, a full buffer is flushed while recording and the trace
+    // continues
+    printf("{\"traceEvents\":[");
+    first_event = true;
+    unparsed = 0;
+    lv_lock();
+    lv_profiler_builtin_set_enable(true);
+    lv_obj_invalidate(lv_screen_active());
+    lv_unlock();
+
+    vTaskDelay(pdMS_TO_TICKS(ms));
+
+    lv_lock();
+    lv_profiler_builtin_set_enable(false);
+    lv_profiler_builtin_flush();
+    lv_unlock();
+
+    for (int i = 0; i < FRAME_TRACE_MAX_TASKS && tasks[i]; i++)
+    {
+        printf("%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"",
+               event_separator(), i);
+        print_json_string(pcTaskGetName(tasks[i]));
+        printf("\"}}");
+    }
+    printf("\n]}\n");
+    if (unparsed)
+    {
+        printf("%lu profiler lines not understood\n", (unsigned long)unparsed);
+    }
+    return 0;
+}
+
+void frame_trace_register_commands(void)
+{
+    const esp_console_cmd_t cmd = {
+        .command = "trace",
+        .help = "Record LVGL's render spans for a time, default 100 ms, and print them as Chrome trace JSON",
+        .hint = "[ms]",
+        .func = &trace_cmd};
+    ESP_ERROR_CHECK(esp_console_cmd_register(&cmd));
+}
+
+#else
+
+void frame_trace_init(void)
+{
+}
+
+void frame_trace_obj(lv_obj_t *obj, const char *name)
+{
+}
+
+void frame_trace_register_commands(void)
+{
+}
+
+#endif
@@ -0,0 +1,20 @@
+#pragma once
+
+#include "lvgl.h"
+
+// Records LVGL's profiler spans (CONFIG_LV_USE_PROFILER_BUILTIN) with esp_timer timestamps and dumps them over the
+// console as Chrome trace JSON, which chrome://tracing and ui.perfetto.dev open. LVGL itself records the refresh,
+// layout and draw unit spans, frame_trace_obj() and the flush callbacks add per-widget and flush spans. Without the
+// profiler in the LVGL config the functions do nothing.
+#define FRAME_TRACE_DEFAULT_MS 100
+#define FRAME_TRACE_MAX_TASKS 8
+
+// Call after lv_init(), replaces the profiler's default configuration.
+void frame_trace_init(void);
+
+// Adds a span named `name` around the drawing of `obj` and its children.
+void frame_trace_obj(lv_obj_t *obj, const char *name);
+
+// Adds the "trace" console command. "trace [ms]" invalidates the screen, records for the given time and prints the
+// spans as JSON.
+void frame_trace_register_commands(void);
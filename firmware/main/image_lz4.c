@@ -0,0 +1,17 @@
+#include "image_lz4.h"
+
+#include "esp_log.h"
+#include "src/libs/lz4/lz4.h"
+
+static const char *TAG = "image_lz4";
+
+bool image_lz4_decompress(const lv_image_dsc_t *src, uint8_t *dst, uint32_t size)
+{
+    int n = LZ4_decompress_safe((const char *)src->data, (char *)dst, src->data_size, size);
+    if (n != (int)size)
+    {
+        ESP_LOGE(TAG, "Corrupt image data (%d of %d bytes)", n, (int)size);
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,11 @@
+#pragma once
+
+#include "lvgl.h"
+
+// Images whose pixels are stored as one LZ4 block (tools/compress_image.py), marked with IMAGE_LZ4_FLAG in the header.
+// LVGL can't draw them, the scene cache decompresses them into PSRAM before they are shown.
+#define IMAGE_LZ4_FLAG LV_IMAGE_FLAGS_USER1
+
+// Decompresses the pixels of `src` into `dst`, which holds `size` bytes (stride * h). False if the data is corrupt.
+// Doesn't use LVGL, callable from any task.
+bool image_lz4_decompress(const lv_image_dsc_t *src, uint8_t *dst, uint32_t size);
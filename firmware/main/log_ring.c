@@ -0,0 +1,118 @@
+#include "log_ring.h"
+
+#include <stdarg.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_log.h"
+
+// Bounded multi-producer queue with a sequence number per slot. A slot is free for the producer at position pos when
+// its sequence is pos and holds a finished line for the consumer when it is pos + 1. Producers claim a position with a
+// compare and swap on head and format straight into the slot, the single consumer owns tail.
+typedef struct
+{
+    atomic_uint seq;
+    uint16_t len;
+    char text[LOG_RING_LINE_SIZE];
+} log_slot_t;
+
+static log_slot_t slots[LOG_RING_SLOTS];
+static atomic_uint head;
+static uint32_t tail;
+static atomic_uint dropped;
+static atomic_uint dropped_total;
+static TaskHandle_t drain_task;
+
+static int log_ring_vprintf(const char *format, va_list args)
+{
+    unsigned pos = atomic_load_explicit(&head, memory_order_relaxed);
+    log_slot_t *slot;
+    for (;;)
+    {
+        slot = &slots[pos & (LOG_RING_SLOTS - 1)];
+        int diff = (int)(atomic_load_explicit(&slot->seq, memory_order_acquire) - pos);
+        if (diff == 0)
+        {
+            if (atomic_compare_exchange_weak_explicit(&head, &pos, pos + 1, memory_order_relaxed, memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (diff < 0)
+        {
+            // The slot still holds a line from a lap ago, the ring is full
+            atomic_fetch_add_explicit(&dropped, 1, memory_order_relaxed);
+            atomic_fetch_add_explicit(&dropped_total, 1, memory_order_relaxed);
+            return 0;
+        }
+        else
+        {
+            pos = atomic_load_explicit(&head, memory_order_relaxed);
+        }
+    }
+
+    int len = vsnprintf(slot->text, LOG_RING_LINE_SIZE, format, args);
+    if (len < 0)
+    {
+        len = 0;
+    }
+    else if (len >= LOG_RING_LINE_SIZE)
+    {
+        // Cut, but keep the line break
+        len = LOG_RING_LINE_SIZE - 1;
+        slot->text[len - 1] = '\n';
+    }
+    slot->len = len;
+    atomic_store_explicit(&slot->seq, pos + 1, memory_order_release);
+    xTaskNotifyGive(drain_task);
+    return len;
+}
+
+static void log_drain_task(void *arg)
+{
+    for (;;)
+    {
+        bool wrote = false;
+        for (;;)
+        {
+            log_slot_t *slot = &slots[tail & (LOG_RING_SLOTS - 1)];
+            if (atomic_load_explicit(&slot->seq, memory_order_acquire) != tail + 1)
+            {
+                break;
+            }
+            fwrite(slot->text, 1, slot->len, stdout);
+            atomic_store_explicit(&slot->seq, tail + LOG_RING_SLOTS, memory_order_release);
+            tail++;
+            wrote = true;
+        }
+
+        unsigned lost = atomic_exchange_explicit(&dropped, 0, memory_order_relaxed);
+        if (lost)
+        {
+            printf("log: %u lines dropped\n", lost);
+            wrote = true;
+        }
+        if (wrote)
+        {
+            fflush(stdout);
+        }
+        // Sleeps until the next line, a full ring has been notified already so drops are reported with it
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    }
+}
+
+void log_ring_start(void)
+{
+    for (unsigned i = 0; i < LOG_RING_SLOTS; i++)
+    {
+        atomic_init(&slots[i].seq, i);
+    }
+    xTaskCreate(log_drain_task, "log_drain", 3072, NULL, tskIDLE_PRIORITY + 1, &drain_task);
+    esp_log_set_vprintf(log_ring_vprintf);
+}
+
+uint32_t log_ring_dropped(void)
+{
+    return atomic_load_explicit(&dropped_total, memory_order_relaxed);
+}
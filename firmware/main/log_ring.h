@@ -0,0 +1,16 @@
+#pragma once
+
+#include <stdint.h>
+
+// Deferred log output. Once started every esp_log line is formatted into a fixed slot of a lock-free ring and written to
+// the UART by a low priority task, so logging from the render path costs the formatting only. Lines that don't fit in
+// the ring are dropped and counted, the drain task reports the count. Lines longer than LOG_RING_LINE_SIZE are cut.
+#define LOG_RING_SLOTS 32 // Must be a power of 2
+#define LOG_RING_LINE_SIZE 128
+
+// Redirects esp_log into the ring and starts the drain task. Anything logged right before an abort() would be lost, so
+// this is called once boot can no longer fail.
+void log_ring_start(void);
+
+// Lines dropped since boot because the ring was full.
+uint32_t log_ring_dropped(void);
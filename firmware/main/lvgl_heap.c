@@ -0,0 +1,212 @@
+#include "lvgl_heap.h"
+
+#include <stdio.h>
+#include "freertos/FreeRTOS.h"
+#include "esp_err.h"
+#include "esp_console.h"
+#include "esp_heap_caps.h"
+#include "esp_memory_utils.h"
+#include "lvgl.h"
+
+typedef enum
+{
+    REGION_INTERNAL,
+    REGION_PSRAM,
+    REGION_COUNT
+} region_t;
+
+typedef struct
+{
+    size_t live;
+    size_t peak;
+    uint32_t allocs;
+} region_stats_t;
+
+static const uint32_t region_caps[REGION_COUNT] = {
+    [REGION_INTERNAL] = MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT,
+    [REGION_PSRAM] = MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT,
+};
+static const char *const region_names[REGION_COUNT] = {
+    [REGION_INTERNAL] = "internal",
+    [REGION_PSRAM] = "psram",
+};
+
+// The draw units allocate from their own threads, the counters are updated under a spinlock.
+static portMUX_TYPE stats_lock = portMUX_INITIALIZER_UNLOCKED;
+static region_stats_t stats[REGION_COUNT];
+static uint32_t failures;
+
+static region_t region_of(void *p)
+{
+    return esp_ptr_external_ram(p) ? REGION_PSRAM : REGION_INTERNAL;
+}
+
+static void count(void *p, int sign)
+{
+    region_stats_t *s = &stats[region_of(p)];
+    size_t size = heap_caps_get_allocated_size(p);
+    taskENTER_CRITICAL(&stats_lock);
+    if (sign > 0)
+    {
+        s->live += size;
+        s->allocs++;
+        s->peak = s->live > s->peak ? s->live : s->peak;
+    }
+    else
+    {
+        s->live -= size;
+        s->allocs--;
+    }
+    taskEXIT_CRITICAL(&stats_lock);
+}
+
+static void count_failure(void)
+{
+    taskENTER_CRITICAL(&stats_lock);
+    failures++;
+    taskEXIT_CRITICAL(&stats_lock);
+}
+
+// Region for an allocation of `size` bytes, the other one is the fallback.
+static region_t preferred_region(size_t size)
+{
+    return size < LVGL_HEAP_PSRAM_MIN ? REGION_INTERNAL : REGION_PSRAM;
+}
+
+void lv_mem_init(void)
+{
+}
+
+void lv_mem_deinit(void)
+{
+}
+
+lv_mem_pool_t lv_mem_add_pool(void *mem, size_t bytes)
+{
+    return NULL;
+}
+
+void lv_mem_remove_pool(lv_mem_pool_t pool)
+{
+}
+
+void *lv_malloc_core(size_t size)
+{
+    region_t region = preferred_region(size);
+    void *p = heap_caps_malloc_prefer(size, 2, region_caps[region], region_caps[!region]);
+    if (!p)
+    {
+        count_failure();
+        return NULL;
+    }
+    count(p, 1);
+    return p;
+}
+
+void *lv_realloc_core(void *p, size_t new_size)
+{
+    if (!p)
+    {
+        return lv_malloc_core(new_size);
+    }
+
+    region_t region = preferred_region(new_size);
+    size_t old_size = heap_caps_get_allocated_size(p);
+    region_t old_region = region_of(p);
+    void *q = heap_caps_realloc_prefer(p, new_size, 2, region_caps[region], region_caps[!region]);
+    if (!q)
+    {
+        count_failure();
+        return NULL;
+    }
+
+    size_t size = heap_caps_get_allocated_size(q);
+    region_t new_region = region_of(q);
+    taskENTER_CRITICAL(&stats_lock);
+    stats[old_region].live -= old_size;
+    stats[old_region].allocs--;
+    stats[new_region].live += size;
+    stats[new_region].allocs++;
+    stats[new_region].peak = stats[new_region].live > stats[new_region].peak ? stats[new_region].live
+                                                                              : stats[new_region].peak;
+    taskEXIT_CRITICAL(&stats_lock);
+    return q;
+}
+
+void lv_free_core(void *p)
+{
+    if (!p)
+    {
+        return;
+    }
+    count(p, -1);
+    heap_caps_free(p);
+}
+
+// For LVGL's memory monitor, both regions together.
+void lv_mem_monitor_core(lv_mem_monitor_t *mon_p)
+{
+    multi_heap_info_t info[REGION_COUNT];
+    size_t total = 0;
+    size_t free_size = 0;
+    size_t biggest = 0;
+    uint32_t free_blocks = 0;
+    for (int i = 0; i < REGION_COUNT; i++)
+    {
+        heap_caps_get_info(&info[i], region_caps[i]);
+        total += heap_caps_get_total_size(region_caps[i]);
+        free_size += info[i].total_free_bytes;
+        free_blocks += info[i].free_blocks;
+        biggest = info[i].largest_free_block > biggest ? info[i].largest_free_block : biggest;
+    }
+
+    taskENTER_CRITICAL(&stats_lock);
+    mon_p->used_cnt = stats[REGION_INTERNAL].allocs + stats[REGION_PSRAM].allocs;
+    mon_p->max_used = stats[REGION_INTERNAL].peak + stats[REGION_PSRAM].peak;
+    taskEXIT_CRITICAL(&stats_lock);
+
+    mon_p->total_size = total;
+    mon_p->free_size = free_size;
+    mon_p->free_cnt = free_blocks;
+    mon_p->free_biggest_size = biggest;
+    mon_p->used_pct = total ? 100 - (uint64_t)free_size * 100 / total : 0;
+    mon_p->frag_pct = free_size ? 100 - (uint64_t)biggest * 100 / free_size : 0;
+}
+
+lv_result_t lv_mem_test_core(void)
+{
+    return heap_caps_check_integrity_all(true) ? LV_RESULT_OK : LV_RESULT_INVALID;
+}
+
+static int lvmem_cmd(int argc, char **argv)
+{
+    region_stats_t snapshot[REGION_COUNT];
+    taskENTER_CRITICAL(&stats_lock);
+    snapshot[REGION_INTERNAL] = stats[REGION_INTERNAL];
+    snapshot[REGION_PSRAM] = stats[REGION_PSRAM];
+    uint32_t failed = failures;
+    taskEXIT_CRITICAL(&stats_lock);
+
+    printf("allocation failures %lu\n", (unsigned long)failed);
+    printf("%-10s %8s %10s %10s %10s %10s %6s\n", "", "allocs", "live", "peak", "heap free", "largest", "frag");
+    for (int i = 0; i < REGION_COUNT; i++)
+    {
+        multi_heap_info_t info;
+        heap_caps_get_info(&info, region_caps[i]);
+        unsigned frag = info.total_free_bytes ? 100 - (uint64_t)info.largest_free_block * 100 / info.total_free_bytes : 0;
+        printf("%-10s %8lu %10lu %10lu %10lu %10lu %5u%%\n", region_names[i], (unsigned long)snapshot[i].allocs,
+               (unsigned long)snapshot[i].live, (unsigned long)snapshot[i].peak, (unsigned long)info.total_free_bytes,
+               (unsigned long)info.largest_free_block, frag);
+    }
+    return 0;
+}
+
+void lvgl_heap_register_commands(void)
+{
+    const esp_console_cmd_t cmd = {
+        .command = "lvmem",
+        .help = "Print LVGL's live and peak heap usage in internal RAM and PSRAM and their fragmentation",
+        .hint = NULL,
+        .func = &lvmem_cmd};
+    ESP_ERROR_CHECK(esp_console_cmd_register(&cmd));
+}
@@ -0,0 +1,10 @@
+#pragma once
+
+// LVGL allocator (CONFIG_LV_USE_CUSTOM_MALLOC) on the ESP-IDF heap, which is a TLSF allocator, instead of LVGL's fixed
+// pool. Allocations below LVGL_HEAP_PSRAM_MIN bytes, the objects, styles and small draw tasks used on every frame, go
+// to internal RAM. Larger ones, draw layers and decoded image caches, go to PSRAM. Either falls back to the other
+// region when its own is full.
+#define LVGL_HEAP_PSRAM_MIN 4096
+
+// Adds the "lvmem" console command, which prints LVGL's live and peak usage of both regions and how fragmented they are.
+void lvgl_heap_register_commands(void);
@@ -0,0 +1,176 @@
+#include "reading.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "readout.h"
+
+#define READING_TEXT_SIZE 40
+
+static lv_subject_t location;
+static char location_buf[READING_LOCATION_SIZE];
+static char location_prev_buf[READING_LOCATION_SIZE];
+static lv_subject_t temperature;
+static lv_subject_t timestamp;
+
+// The shown reading, the weather has no widget and so no subject.
+static reading_t current;
+static void (*change_cb)(const reading_t *reading);
+
+// The last published reading, waiting for the coalesce timer to apply it.
+static portMUX_TYPE pending_lock = portMUX_INITIALIZER_UNLOCKED;
+static reading_t pending;
+static bool scheduled;
+
+static lv_timer_t *apply_timer;
+static void (*wake_lvgl)(void);
+
+static lv_subject_t *const subjects[READING_FIELD_COUNT] = {
+    [READING_LOCATION] = &location,
+    [READING_TEMPERATURE] = &temperature,
+    [READING_TIMESTAMP] = &timestamp,
+};
+
+static void reading_format(reading_field_t field, char *buf, size_t size)
+{
+    switch (field)
+    {
+    case READING_LOCATION:
+        snprintf(buf, size, "%s", lv_subject_get_string(&location));
+        break;
+    case READING_TEMPERATURE:
+    {
+        int32_t tenths = lv_subject_get_int(&temperature);
+        snprintf(buf, size, "%s%ld.%ld °C", tenths < 0 ? "-" : "", (long)(labs(tenths) / 10), (long)(labs(tenths) % 10));
+        break;
+    }
+    case READING_TIMESTAMP:
+    {
+        time_t t = lv_subject_get_int(&timestamp);
+        struct tm tm;
+        localtime_r(&t, &tm);
+        strftime(buf, size, "Idag kl %H:%M", &tm);
+        break;
+    }
+    default:
+        buf[0] = '\0';
+    }
+}
+
+// Sets the subjects that differ from the reading, only their observers run.
+static void reading_apply(const reading_t *reading, bool notify)
+{
+    bool changed = current.weather != reading->weather;
+    if (strcmp(lv_subject_get_string(&location), reading->location) != 0)
+    {
+        lv_subject_copy_string(&location, reading->location);
+        changed = true;
+    }
+    if (lv_subject_get_int(&temperature) != reading->temperature_tenths)
+    {
+        lv_subject_set_int(&temperature, reading->temperature_tenths);
+        changed = true;
+    }
+    if (lv_subject_get_int(&timestamp) != (int32_t)reading->timestamp)
+    {
+        lv_subject_set_int(&timestamp, (int32_t)reading->timestamp);
+        changed = true;
+    }
+
+    current = *reading;
+    if (notify && changed && change_cb)
+    {
+        change_cb(&current);
+    }
+}
+
+void reading_set(const reading_t *reading)
+{
+    reading_apply(reading, true);
+}
+
+void reading_set_quiet(const reading_t *reading)
+{
+    reading_apply(reading, false);
+}
+
+static void apply_timer_cb(lv_timer_t *timer)
+{
+    reading_t reading;
+    taskENTER_CRITICAL(&pending_lock);
+    reading = pending;
+    scheduled = false;
+    taskEXIT_CRITICAL(&pending_lock);
+
+    lv_timer_pause(timer);
+    reading_set(&reading);
+}
+
+void reading_init(const reading_t *initial, void (*wake)(void))
+{
+    wake_lvgl = wake;
+    current = *initial;
+    lv_subject_init_string(&location, location_buf, location_prev_buf, sizeof(location_buf), initial->location);
+    lv_subject_init_int(&temperature, initial->temperature_tenths);
+    lv_subject_init_int(&timestamp, (int32_t)initial->timestamp);
+
+    apply_timer = lv_timer_create(apply_timer_cb, READING_COALESCE_MS, NULL);
+    lv_timer_pause(apply_timer);
+}
+
+void reading_publish(const reading_t *reading)
+{
+    taskENTER_CRITICAL(&pending_lock);
+    pending = *reading;
+    bool start = !scheduled;
+    scheduled = true;
+    taskEXIT_CRITICAL(&pending_lock);
+
+    // The first reading of a burst starts the timer, the ones after it only replace the pending reading
+    if (start)
+    {
+        lv_lock();
+        lv_timer_reset(apply_timer);
+        lv_timer_resume(apply_timer);
+        lv_unlock();
+        if (wake_lvgl)
+        {
+            wake_lvgl();
+        }
+    }
+}
+
+void reading_on_change(void (*cb)(const reading_t *reading))
+{
+    change_cb = cb;
+}
+
+static void label_observer_cb(lv_observer_t *observer, lv_subject_t *subject)
+{
+    lv_obj_t *label = lv_observer_get_target_obj(observer);
+    char text[READING_TEXT_SIZE];
+    reading_format((reading_field_t)(intptr_t)lv_observer_get_user_data(observer), text, sizeof(text));
+    if (strcmp(lv_label_get_text(label), text) != 0)
+    {
+        lv_label_set_text(label, text);
+    }
+}
+
+void reading_bind_label(lv_obj_t *label, reading_field_t field)
+{
+    lv_subject_add_observer_obj(subjects[field], label_observer_cb, label, (void *)(intptr_t)field);
+}
+
+// The readout already leaves the sprites that didn't change alone, an unchanged text invalidates nothing.
+static void readout_observer_cb(lv_observer_t *observer, lv_subject_t *subject)
+{
+    char text[READING_TEXT_SIZE];
+    reading_format((reading_field_t)(intptr_t)lv_observer_get_user_data(observer), text, sizeof(text));
+    readout_set_text(lv_observer_get_target_obj(observer), text);
+}
+
+void reading_bind_readout(lv_obj_t *readout, reading_field_t field)
+{
+    lv_subject_add_observer_obj(subjects[field], readout_observer_cb, readout, (void *)(intptr_t)field);
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <stdint.h>
+#include <time.h>
+#include "lvgl.h"
+
+// The current reading shown on the screen, held in LVGL subjects. Widgets bound to a field are only updated, and so
+// only invalidated, when the field's formatted text changes. Readings can be published from any task, a burst of them
+// within READING_COALESCE_MS is applied as one update, so the display refreshes once for the last of them.
+#define READING_LOCATION_SIZE 32
+#define READING_COALESCE_MS 50
+
+typedef enum
+{
+    READING_WEATHER_SUNNY,
+    READING_WEATHER_CLOUDY,
+    READING_WEATHER_STORMY,
+} reading_weather_t;
+
+typedef struct
+{
+    char location[READING_LOCATION_SIZE];
+    int32_t temperature_tenths; // Water temperature in tenths of a degree Celsius
+    time_t timestamp;           // When the temperature was measured
+    reading_weather_t weather;  // At the beach when the temperature was measured
+} reading_t;
+
+typedef enum
+{
+    READING_LOCATION,
+    READING_TEMPERATURE,
+    READING_TIMESTAMP,
+    READING_FIELD_COUNT
+} reading_field_t;
+
+// Sets the first reading, call from the LVGL task or before it starts. `wake` is called after a reading is published from another
+// task, so that the LVGL task doesn't sleep past the update.
+void reading_init(const reading_t *initial, void (*wake)(void));
+
+// Shows a reading right away, from the LVGL task or with the LVGL lock held.
+void reading_set(const reading_t *reading);
+
+// Like reading_set() without calling the change listener, for a reading that is only shown to be rendered off screen.
+void reading_set_quiet(const reading_t *reading);
+
+// Queues a new reading, from any task.
+void reading_publish(const reading_t *reading);
+
+// Calls `cb` in the LVGL context after a reading that differs from the shown one has been set, one listener.
+void reading_on_change(void (*cb)(const reading_t *reading));
+
+// Keeps the text of `label` in sync with a field.
+void reading_bind_label(lv_obj_t *label, reading_field_t field);
+
+// Keeps the text of a digit sprite readout in sync with a field.
+void reading_bind_readout(lv_obj_t *readout, reading_field_t field);
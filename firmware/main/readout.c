@@ -0,0 +1,218 @@
+#include "readout.h"
+
+#include <string.h>
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+
+static const char *TAG = "readout";
+
+// Characters of the sprites in atlas order, the digits first.
+static const char *const sprite_texts[] = {"0", "1", "2", "3", "4", "5", "6", "7", "8", "9", ".", "-", "°", "C"};
+#define SPRITE_COUNT (sizeof(sprite_texts) / sizeof(sprite_texts[0]))
+#define DIGIT_COUNT 10
+
+typedef struct
+{
+    uint32_t letters[SPRITE_COUNT];
+    lv_image_dsc_t sprites[SPRITE_COUNT];
+    int32_t space_advance;
+    int32_t height;
+} readout_atlas_t;
+
+// Per widget state, one image per character slot.
+typedef struct
+{
+    lv_obj_t *slots[READOUT_MAX_CHARS];
+} readout_t;
+
+static readout_atlas_t atlas;
+
+static int sprite_index(uint32_t letter)
+{
+    for (int i = 0; i < SPRITE_COUNT; i++)
+    {
+        if (atlas.letters[i] == letter)
+        {
+            return i;
+        }
+    }
+    return -1;
+}
+
+bool readout_atlas_init(const lv_font_t *font)
+{
+    const int32_t height = lv_font_get_line_height(font);
+
+    // Digits share one advance, the other characters keep their own.
+    int32_t digit_advance = 0;
+    int32_t glyph_widths[SPRITE_COUNT];
+    for (int i = 0; i < SPRITE_COUNT; i++)
+    {
+        uint32_t pos = 0;
+        atlas.letters[i] = lv_text_encoded_next(sprite_texts[i], &pos);
+        glyph_widths[i] = lv_font_get_glyph_width(font, atlas.letters[i], 0);
+        if (i < DIGIT_COUNT && glyph_widths[i] > digit_advance)
+        {
+            digit_advance = glyph_widths[i];
+        }
+    }
+    int32_t advances[SPRITE_COUNT];
+    int32_t max_width = 0;
+    size_t total = 0;
+    for (int i = 0; i < SPRITE_COUNT; i++)
+    {
+        advances[i] = i < DIGIT_COUNT ? digit_advance : glyph_widths[i];
+        max_width = advances[i] > max_width ? advances[i] : max_width;
+        total += advances[i] * height;
+    }
+
+    // Glyphs are drawn white on a transparent ARGB8888 canvas, its alpha channel is the antialiased coverage.
+    uint32_t canvas_stride = lv_draw_buf_width_to_stride(max_width, LV_COLOR_FORMAT_ARGB8888);
+    uint32_t canvas_size = canvas_stride * height;
+    uint8_t *canvas_data = heap_caps_aligned_alloc(64, canvas_size, MALLOC_CAP_DEFAULT);
+    uint8_t *sprite_data = heap_caps_malloc(total, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (!canvas_data || !sprite_data)
+    {
+        ESP_LOGE(TAG, "Failed to allocate the digit sprites (%d bytes)", (int)total);
+        free(canvas_data);
+        free(sprite_data);
+        return false;
+    }
+
+    lv_draw_buf_t canvas_buf;
+    lv_draw_buf_init(&canvas_buf, max_width, height, LV_COLOR_FORMAT_ARGB8888, canvas_stride, canvas_data, canvas_size);
+    lv_obj_t *canvas = lv_canvas_create(lv_layer_sys());
+    lv_obj_add_flag(canvas, LV_OBJ_FLAG_HIDDEN);
+    lv_canvas_set_draw_buf(canvas, &canvas_buf);
+
+    lv_draw_label_dsc_t label_dsc;
+    lv_draw_label_dsc_init(&label_dsc);
+    label_dsc.font = font;
+    label_dsc.color = lv_color_white();
+
+    uint8_t *dst = sprite_data;
+    for (int i = 0; i < SPRITE_COUNT; i++)
+    {
+        const int32_t width = advances[i];
+        label_dsc.text = sprite_texts[i];
+
+        lv_draw_buf_clear(&canvas_buf, NULL);
+        lv_layer_t layer;
+        lv_canvas_init_layer(canvas, &layer);
+        // Centered in the cell, so the narrower digits sit in the middle of the shared advance
+        lv_area_t area = {(width - glyph_widths[i]) / 2, 0, width - 1, height - 1};
+        lv_draw_label(&layer, &label_dsc, &area);
+        lv_canvas_finish_layer(canvas, &layer);
+
+        for (int32_t y = 0; y < height; y++)
+        {
+            const uint8_t *src = canvas_data + y * canvas_stride;
+            for (int32_t x = 0; x < width; x++)
+            {
+                dst[y * width + x] = src[x * 4 + 3];
+            }
+        }
+
+        lv_image_dsc_t *sprite = &atlas.sprites[i];
+        sprite->header.magic = LV_IMAGE_HEADER_MAGIC;
+        sprite->header.cf = LV_COLOR_FORMAT_A8;
+        sprite->header.w = width;
+        sprite->header.h = height;
+        sprite->header.stride = width;
+        sprite->data_size = width * height;
+        sprite->data = dst;
+        dst += width * height;
+    }
+
+    lv_obj_delete(canvas);
+    free(canvas_data);
+
+    atlas.space_advance = lv_font_get_glyph_width(font, ' ', 0);
+    atlas.height = height;
+    ESP_LOGI(TAG, "Digit sprites: %d bytes, %d px high", (int)total, (int)height);
+    return true;
+}
+
+static void readout_delete_cb(lv_event_t *e)
+{
+    lv_free(lv_event_get_user_data(e));
+}
+
+lv_obj_t *readout_create(lv_obj_t *parent)
+{
+    lv_obj_t *obj = lv_obj_create(parent);
+    lv_obj_remove_style_all(obj);
+    lv_obj_set_size(obj, 0, atlas.height);
+
+    readout_t *readout = lv_malloc_zeroed(sizeof(readout_t));
+    LV_ASSERT_MALLOC(readout);
+    for (int i = 0; i < READOUT_MAX_CHARS; i++)
+    {
+        readout->slots[i] = lv_image_create(obj);
+        lv_obj_add_flag(readout->slots[i], LV_OBJ_FLAG_HIDDEN);
+        lv_obj_set_style_image_recolor_opa(readout->slots[i], LV_OPA_COVER, 0);
+    }
+    lv_obj_set_user_data(obj, readout);
+    lv_obj_add_event_cb(obj, readout_delete_cb, LV_EVENT_DELETE, readout);
+    return obj;
+}
+
+void readout_set_text(lv_obj_t *obj, const char *text)
+{
+    readout_t *readout = lv_obj_get_user_data(obj);
+    uint32_t i = 0;
+    int slot = 0;
+    int32_t x = 0;
+
+    while (text[i] != '\0' && slot < READOUT_MAX_CHARS)
+    {
+        uint32_t letter = lv_text_encoded_next(text, &i);
+        if (letter == ' ')
+        {
+            x += atlas.space_advance;
+            continue;
+        }
+        int index = sprite_index(letter);
+        if (index < 0)
+        {
+            continue;
+        }
+
+        // Only changed slots are touched, so only they get invalidated
+        lv_obj_t *img = readout->slots[slot++];
+        const lv_image_dsc_t *sprite = &atlas.sprites[index];
+        if (lv_image_get_src(img) != sprite)
+        {
+            lv_image_set_src(img, sprite);
+        }
+        if (lv_obj_get_style_x(img, LV_PART_MAIN) != x)
+        {
+            lv_obj_set_x(img, x);
+        }
+        if (lv_obj_has_flag(img, LV_OBJ_FLAG_HIDDEN))
+        {
+            lv_obj_remove_flag(img, LV_OBJ_FLAG_HIDDEN);
+        }
+        x += sprite->header.w;
+    }
+    for (; slot < READOUT_MAX_CHARS; slot++)
+    {
+        if (!lv_obj_has_flag(readout->slots[slot], LV_OBJ_FLAG_HIDDEN))
+        {
+            lv_obj_add_flag(readout->slots[slot], LV_OBJ_FLAG_HIDDEN);
+        }
+    }
+    if (lv_obj_get_style_width(obj, LV_PART_MAIN) != x)
+    {
+        lv_obj_set_width(obj, x);
+    }
+}
+
+void readout_set_color(lv_obj_t *obj, lv_color_t color)
+{
+    readout_t *readout = lv_obj_get_user_data(obj);
+    for (int i = 0; i < READOUT_MAX_CHARS; i++)
+    {
+        lv_obj_set_style_image_recolor(readout->slots[i], color, 0);
+    }
+}
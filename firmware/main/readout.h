@@ -0,0 +1,21 @@
+#pragma once
+
+#include <stdbool.h>
+#include "lvgl.h"
+
+// Numeric readout drawn from pre-rendered sprites instead of a label. The characters "0123456789.-°C" are rasterized
+// once into antialiased A8 sprites with fixed advances, all digits sharing the widest digit's advance so the readout
+// doesn't shift as the value changes. Setting a new text only swaps the sprites of the characters that changed, there
+// is no text layout, kerning or glyph decoding when the value updates. Spaces leave a gap, other characters are
+// skipped.
+#define READOUT_MAX_CHARS 10
+
+// Rasterizes the sprites from `font`, needs a display. Returns false if the memory isn't available.
+bool readout_atlas_init(const lv_font_t *font);
+
+lv_obj_t *readout_create(lv_obj_t *parent);
+
+void readout_set_text(lv_obj_t *readout, const char *text);
+
+// Color the sprites are drawn in.
+void readout_set_color(lv_obj_t *readout, lv_color_t color);
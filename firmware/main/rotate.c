@@ -0,0 +1,205 @@
+#include "rotate.h"
+
+// Tile size of the blocked transpose, 8x8 RGB565 pixels is 8 rows of 16 bytes on both the source and destination side,
+// so a tile only touches a few cache lines however long the source lines are.
+#define ROTATE_TILE 8
+
+// Swaps the bytes of both pixels in a 32-bit word.
+static inline uint32_t swap_pixels(uint32_t v)
+{
+    return ((v & 0x00FF00FF) << 8) | ((v >> 8) & 0x00FF00FF);
+}
+
+#if ROTATE_USE_PIE
+// In rotate_pie.S
+void rotate_band_pie(uint16_t *dst, const uint16_t *src, int32_t src_step, int32_t dst_step, int32_t tiles);
+#endif
+
+void rotate_stripe_ref(uint16_t *dst, const uint16_t *src, int32_t src_stride, int32_t width, int32_t rows)
+{
+    for (int32_t x = 0; x < width; x++)
+    {
+        for (int32_t y = 0; y < rows; y++)
+        {
+            uint16_t px = src[y * src_stride + x];
+            dst[x * rows + (rows - y - 1)] = (uint16_t)((px << 8) | (px >> 8));
+        }
+    }
+}
+
+static void rotate_stripe_tiled(uint16_t *dst, const uint16_t *src, int32_t src_stride, int32_t width, int32_t rows)
+{
+    for (int32_t y0 = 0; y0 < rows; y0 += ROTATE_TILE)
+    {
+        int32_t y_end = y0 + ROTATE_TILE < rows ? y0 + ROTATE_TILE : rows;
+
+        for (int32_t x0 = 0; x0 < width; x0 += ROTATE_TILE)
+        {
+            int32_t x_end = x0 + ROTATE_TILE < width ? x0 + ROTATE_TILE : width;
+
+            // Transpose 2x2 blocks with one 32-bit load per source line and one 32-bit store per destination row.
+            for (int32_t y = y0; y < y_end; y += 2)
+            {
+                const uint32_t *line0 = (const uint32_t *)(src + y * src_stride);
+                const uint32_t *line1 = (const uint32_t *)(src + (y + 1) * src_stride);
+                uint16_t *out = dst + rows - y - 2;
+
+                for (int32_t x = x0; x < x_end; x += 2)
+                {
+                    uint32_t a = swap_pixels(line0[x / 2]);
+                    uint32_t b = swap_pixels(line1[x / 2]);
+                    *(uint32_t *)(out + x * rows) = (b & 0xFFFF) | (a << 16);
+                    *(uint32_t *)(out + (x + 1) * rows) = (b >> 16) | (a & 0xFFFF0000);
+                }
+            }
+        }
+    }
+}
+
+void rotate_stripe(uint16_t *dst, const uint16_t *src, int32_t src_stride, int32_t width, int32_t rows)
+{
+#if ROTATE_USE_PIE
+    if (width % 8 == 0 && rows % 8 == 0 && src_stride % 8 == 0 && ((uintptr_t)src & 15) == 0 && ((uintptr_t)dst & 15) == 0)
+    {
+        for (int32_t y0 = 0; y0 < rows; y0 += 8)
+        {
+            rotate_band_pie(dst + rows - y0 - 8, src + (y0 + 7) * src_stride, -src_stride * (int32_t)sizeof(uint16_t),
+                            rows * sizeof(uint16_t), width / 8);
+        }
+        return;
+    }
+#endif
+    rotate_stripe_tiled(dst, src, src_stride, width, rows);
+}
+
+#if ROTATE_BENCHMARK
+
+#include "esp_log.h"
+#include "esp_cpu.h"
+#include "esp_heap_caps.h"
+#include "esp_random.h"
+#include "lvgl.h"
+#include <string.h>
+
+#define BENCH_WIDTH 456
+#define BENCH_LINES 70
+#define BENCH_ROWS 8
+#define BENCH_RUNS 10
+#define CHECK_AREAS 200
+
+static const char *TAG = "rotate";
+
+typedef void (*rotate_fn_t)(uint16_t *dst, const uint16_t *src, int32_t src_stride, int32_t width, int32_t rows);
+
+// Rotates a whole draw buffer stripe by stripe like flush_cb does, returns the best of BENCH_RUNS in cycles.
+static uint32_t bench_buffer(rotate_fn_t fn, uint16_t *dst, const uint16_t *src)
+{
+    uint32_t best = UINT32_MAX;
+    for (int run = 0; run < BENCH_RUNS; run++)
+    {
+        uint32_t start = esp_cpu_get_cycle_count();
+        for (int32_t n = 0; n < BENCH_LINES; n += BENCH_ROWS)
+        {
+            int32_t rows = BENCH_LINES - n < BENCH_ROWS ? BENCH_LINES - n : BENCH_ROWS;
+            fn(dst, src + n * BENCH_WIDTH, BENCH_WIDTH, BENCH_WIDTH, rows);
+        }
+        uint32_t cycles = esp_cpu_get_cycle_count() - start;
+        if (cycles < best)
+        {
+            best = cycles;
+        }
+    }
+    return best;
+}
+
+static void bench_source(const char *name, uint32_t caps, uint16_t *dst)
+{
+    uint16_t *src = heap_caps_aligned_alloc(64, BENCH_WIDTH * BENCH_LINES * sizeof(uint16_t), caps);
+    if (!src)
+    {
+        ESP_LOGW(TAG, "No %s memory for the benchmark source buffer", name);
+        return;
+    }
+    esp_fill_random(src, BENCH_WIDTH * BENCH_LINES * sizeof(uint16_t));
+
+    // The separate byte swap pass flush_cb used to run before rotating, for comparison with the fused kernels.
+    uint32_t swap = UINT32_MAX;
+    for (int run = 0; run < BENCH_RUNS; run++)
+    {
+        uint32_t start = esp_cpu_get_cycle_count();
+        lv_draw_sw_rgb565_swap(src, BENCH_WIDTH * BENCH_LINES);
+        uint32_t cycles = esp_cpu_get_cycle_count() - start;
+        swap = cycles < swap ? cycles : swap;
+    }
+
+    const float pixels = BENCH_WIDTH * BENCH_LINES;
+    uint32_t ref = bench_buffer(rotate_stripe_ref, dst, src);
+    uint32_t tiled = bench_buffer(rotate_stripe_tiled, dst, src);
+    uint32_t best = bench_buffer(rotate_stripe, dst, src);
+    ESP_LOGI(TAG, "%dx%d %s buffer: reference %.2f, tiled %.2f, %s %.2f cycles/px, separate swap pass was %.2f cycles/px",
+             BENCH_WIDTH, BENCH_LINES, name, ref / pixels, tiled / pixels, ROTATE_USE_PIE ? "PIE" : "tiled", best / pixels,
+             swap / pixels);
+    heap_caps_free(src);
+}
+
+// Rotates random areas with rotate_stripe and the reference, anything but a bit exact match is a failure.
+static void check_kernels(uint16_t *src)
+{
+    size_t stripe_size = BENCH_WIDTH * BENCH_LINES * sizeof(uint16_t);
+    uint16_t *expected = heap_caps_aligned_alloc(64, stripe_size, MALLOC_CAP_DEFAULT);
+    uint16_t *actual = heap_caps_aligned_alloc(64, stripe_size, MALLOC_CAP_DEFAULT);
+    if (!expected || !actual)
+    {
+        ESP_LOGW(TAG, "No memory for the kernel check");
+        heap_caps_free(expected);
+        heap_caps_free(actual);
+        return;
+    }
+
+    int failures = 0;
+    for (int i = 0; i < CHECK_AREAS; i++)
+    {
+        // Mostly 8 pixel aligned areas like the display rounder produces, with some only even sized ones mixed in.
+        int32_t align = esp_random() % 4 ? 8 : 2;
+        int32_t width = align * (1 + esp_random() % (BENCH_WIDTH / align));
+        int32_t rows = align * (1 + esp_random() % (BENCH_LINES / align));
+        int32_t stride = width + align * (esp_random() % ((BENCH_WIDTH - width) / align + 1));
+        int32_t offset = (esp_random() % (BENCH_LINES - rows + 1)) * stride;
+
+        memset(expected, 0, stripe_size);
+        memset(actual, 0, stripe_size);
+        rotate_stripe_ref(expected, src + offset, stride, width, rows);
+        rotate_stripe(actual, src + offset, stride, width, rows);
+        if (memcmp(expected, actual, stripe_size) != 0)
+        {
+            ESP_LOGE(TAG, "Kernel mismatch for width=%d rows=%d stride=%d", (int)width, (int)rows, (int)stride);
+            failures++;
+        }
+    }
+    ESP_LOGI(TAG, "Kernel check: %d of %d random areas match the reference", CHECK_AREAS - failures, CHECK_AREAS);
+    heap_caps_free(expected);
+    heap_caps_free(actual);
+}
+
+void rotate_benchmark(void)
+{
+    uint16_t *dst = heap_caps_aligned_alloc(64, BENCH_WIDTH * BENCH_ROWS * sizeof(uint16_t), MALLOC_CAP_DMA);
+    if (!dst)
+    {
+        ESP_LOGW(TAG, "No DMA memory for the benchmark stripe buffer");
+        return;
+    }
+    uint16_t *src = heap_caps_aligned_alloc(64, BENCH_WIDTH * BENCH_LINES * sizeof(uint16_t), MALLOC_CAP_DEFAULT);
+    if (src)
+    {
+        esp_fill_random(src, BENCH_WIDTH * BENCH_LINES * sizeof(uint16_t));
+        check_kernels(src);
+        heap_caps_free(src);
+    }
+
+    bench_source("internal", MALLOC_CAP_DMA, dst);
+    bench_source("PSRAM", MALLOC_CAP_SPIRAM, dst);
+    heap_caps_free(dst);
+}
+
+#endif
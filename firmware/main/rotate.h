@@ -0,0 +1,31 @@
+#pragma once
+
+#include <stdint.h>
+
+// Set to 1 to check the rotation kernels against the reference and log their cycles per pixel at boot.
+#define ROTATE_BENCHMARK 0
+
+// Rotate whole 8x8 tiles with the ESP32-S3 PIE vector instructions, set to 0 to always use the portable scalar kernel.
+// The host test (test/rotate_test.c) defines it, to build either kernel without the ESP-IDF configuration.
+#ifndef ROTATE_USE_PIE
+#include "sdkconfig.h"
+#if CONFIG_IDF_TARGET_ESP32S3
+#define ROTATE_USE_PIE 1
+#else
+#define ROTATE_USE_PIE 0
+#endif
+#endif
+
+// Rotates `rows` lines of `width` RGB565 pixels 90° into a portrait stripe, line y of src becomes column
+// (rows - y - 1) of dst and column x of src becomes row x of dst, which has `rows` pixels. The bytes of every pixel
+// are swapped on the way, into the big endian order the panel expects, so no separate swap pass is needed.
+// `rows`, `width` and `src_stride` (in pixels) must be even and both buffers 4 byte aligned. The vector kernel is used
+// when they are all multiples of 8 and the buffers are 16 byte aligned, which the 8 pixel display rounder guarantees.
+void rotate_stripe(uint16_t *dst, const uint16_t *src, int32_t src_stride, int32_t width, int32_t rows);
+
+// Plain per pixel version of rotate_stripe, the reference the optimized kernels have to match bit for bit.
+void rotate_stripe_ref(uint16_t *dst, const uint16_t *src, int32_t src_stride, int32_t width, int32_t rows);
+
+#if ROTATE_BENCHMARK
+void rotate_benchmark(void);
+#endif
@@ -0,0 +1,415 @@
+#include "scene.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_console.h"
+#include "esp_err.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_pm.h"
+#include "esp_timer.h"
+#include "image_lz4.h"
+
+static const char *TAG = "scene";
+
+static const char *const scene_names[SCENE_COUNT] = {
+    [SCENE_SUNNY] = "sunny",
+    [SCENE_CLOUDY] = "cloudy",
+    [SCENE_STORMY] = "stormy",
+    [SCENE_COLD] = "cold",
+    [SCENE_NIGHT] = "night",
+};
+
+// A decoded background, keyed by its source image so that scenes sharing a picture share the entry.
+typedef struct
+{
+    const lv_image_dsc_t *src; // NULL for a free entry
+    lv_draw_buf_t buf;
+    uint32_t last_used; // Use count when it was loaded or last shown, the lowest is evicted first
+    bool prepared;      // Set by the LVGL task, a decoded background isn't shown before
+} cache_entry_t;
+
+typedef struct
+{
+    const lv_image_dsc_t *sources[SCENE_COUNT];
+    scene_prepare_cb_t prepare;
+    scene_show_cb_t show;
+    cache_entry_t entries[SCENE_COUNT];
+    const cache_entry_t *shown;    // Never evicted
+    const cache_entry_t *snapshot; // Shown instead of it for a snapshot, NULL if the shown one is
+    scene_t wanted;                // Of the reading model
+    uint32_t requested;            // Scenes for the loader, a bit each
+    uint32_t failed;               // Scenes whose background couldn't be loaded, not tried again
+    uint32_t used_bytes; // Of the entries, and of the one being decoded
+    uint32_t use_count;
+    uint32_t hits; // Scene changes that found their background prepared
+    uint32_t misses;
+    uint32_t prefetches;
+    uint32_t evictions;
+    uint32_t failures;
+    uint32_t load_us_max;
+    TaskHandle_t loader;
+    esp_pm_lock_handle_t load_lock;
+    lv_timer_t *loaded_timer; // Resumed by the loader, shows the loaded background from the LVGL task
+    void (*wake_lvgl)(void);
+} scene_cache_t;
+
+// Only touched with the LVGL lock held, the loader task decodes into a buffer of its own without it and never calls
+// into the UI. The loader is the only task that evicts, so an entry it finds stays until it evicts it.
+static scene_cache_t cache;
+
+scene_t scene_for_reading(const reading_t *reading)
+{
+    struct tm tm;
+    localtime_r(&reading->timestamp, &tm);
+    if (tm.tm_hour < SCENE_DAY_START_HOUR || tm.tm_hour >= SCENE_NIGHT_START_HOUR)
+    {
+        return SCENE_NIGHT;
+    }
+    if (reading->weather == READING_WEATHER_STORMY)
+    {
+        return SCENE_STORMY;
+    }
+    if (reading->temperature_tenths < SCENE_COLD_TENTHS)
+    {
+        return SCENE_COLD;
+    }
+    return reading->weather == READING_WEATHER_CLOUDY ? SCENE_CLOUDY : SCENE_SUNNY;
+}
+
+static cache_entry_t *cache_find(const lv_image_dsc_t *src)
+{
+    for (int i = 0; i < SCENE_COUNT; i++)
+    {
+        if (cache.entries[i].src == src)
+        {
+            return &cache.entries[i];
+        }
+    }
+    return NULL;
+}
+
+// Evicts the least recently used entries until `size` more bytes fit, false if only the shown one is left.
+static bool cache_make_room(uint32_t size)
+{
+    while (cache.used_bytes + size > SCENE_CACHE_BYTES)
+    {
+        cache_entry_t *victim = NULL;
+        for (int i = 0; i < SCENE_COUNT; i++)
+        {
+            cache_entry_t *entry = &cache.entries[i];
+            if (entry->src && entry != cache.shown && (!victim || entry->last_used < victim->last_used))
+            {
+                victim = entry;
+            }
+        }
+        if (!victim)
+        {
+            return false;
+        }
+        lv_image_cache_drop(&victim->buf);
+        cache.used_bytes -= victim->buf.data_size;
+        free(victim->buf.data);
+        victim->src = NULL;
+        cache.evictions++;
+    }
+    return true;
+}
+
+static void mark_failed(const lv_image_dsc_t *src)
+{
+    for (int i = 0; i < SCENE_COUNT; i++)
+    {
+        if (cache.sources[i] == src)
+        {
+            cache.failed |= 1U << i;
+        }
+    }
+}
+
+// Decodes `src` into a new entry that the LVGL task still has to prepare, the LVGL lock is only held to update the
+// cache. NULL if it doesn't fit or can't be decoded.
+static cache_entry_t *cache_load(const lv_image_dsc_t *src)
+{
+    const lv_image_header_t *header = &src->header;
+    // Converted images leave the stride out, their rows are packed
+    const uint32_t stride = header->stride ? header->stride : header->w * lv_color_format_get_size(header->cf);
+    const uint32_t size = stride * header->h;
+
+    lv_lock();
+    bool room = cache_make_room(size);
+    if (room)
+    {
+        cache.used_bytes += size;
+    }
+    else
+    {
+        mark_failed(src);
+    }
+    lv_unlock();
+    if (!room)
+    {
+        ESP_LOGE(TAG, "No room for a %d byte background", (int)size);
+        return NULL;
+    }
+
+    esp_pm_lock_acquire(cache.load_lock);
+    int64_t start = esp_timer_get_time();
+    uint8_t *data = heap_caps_aligned_alloc(64, size, MALLOC_CAP_SPIRAM);
+    bool ok = false;
+    if (!data)
+    {
+        ESP_LOGE(TAG, "Failed to allocate a background (PSRAM, %d bytes)", (int)size);
+    }
+    else if (header->flags & IMAGE_LZ4_FLAG)
+    {
+        ok = image_lz4_decompress(src, data, size);
+    }
+    else if (src->data_size < size)
+    {
+        ESP_LOGE(TAG, "Background has %d bytes of pixels, expected %d", (int)src->data_size, (int)size);
+    }
+    else
+    {
+        memcpy(data, src->data, size);
+        ok = true;
+    }
+    uint32_t elapsed_us = esp_timer_get_time() - start;
+    esp_pm_lock_release(cache.load_lock);
+
+    cache_entry_t *entry = NULL;
+    lv_lock();
+    if (ok)
+    {
+        entry = cache_find(NULL);
+        entry->src = src;
+        lv_draw_buf_init(&entry->buf, header->w, header->h, header->cf, stride, data, size);
+        entry->last_used = ++cache.use_count;
+        entry->prepared = false;
+        cache.load_us_max = elapsed_us > cache.load_us_max ? elapsed_us : cache.load_us_max;
+        lv_timer_reset(cache.loaded_timer);
+        lv_timer_resume(cache.loaded_timer);
+    }
+    else
+    {
+        cache.used_bytes -= size;
+        cache.failures++;
+        mark_failed(src);
+        free(data);
+    }
+    lv_unlock();
+
+    if (ok)
+    {
+        ESP_LOGI(TAG, "Loaded a %dx%d background in %d us", (int)header->w, (int)header->h, (int)elapsed_us);
+        if (cache.wake_lvgl)
+        {
+            cache.wake_lvgl();
+        }
+    }
+    return entry;
+}
+
+// With the LVGL lock held.
+static void cache_show(cache_entry_t *entry)
+{
+    entry->last_used = ++cache.use_count;
+    cache.shown = entry;
+    cache.show(&entry->buf);
+}
+
+// Runs on the LVGL task after the loader added a background. Prepares the new ones and shows the wanted scene's if it
+// isn't shown yet.
+static void loaded_timer_cb(lv_timer_t *timer)
+{
+    lv_timer_pause(timer);
+    for (int i = 0; i < SCENE_COUNT; i++)
+    {
+        cache_entry_t *entry = &cache.entries[i];
+        if (entry->src && !entry->prepared)
+        {
+            if (cache.prepare)
+            {
+                cache.prepare(&entry->buf);
+            }
+            entry->prepared = true;
+        }
+    }
+    cache_entry_t *entry = cache_find(cache.sources[cache.wanted]);
+    if (entry && entry != cache.shown)
+    {
+        cache_show(entry);
+    }
+}
+
+// Queues the scene's background for the loader, with the LVGL lock held.
+static void cache_request(scene_t scene)
+{
+    cache.requested |= 1U << scene;
+    xTaskNotifyGive(cache.loader);
+}
+
+// Next background to load, the wanted scene's goes first. With the LVGL lock held.
+static const lv_image_dsc_t *next_request(void)
+{
+    while (cache.requested)
+    {
+        scene_t scene = cache.requested & 1U << cache.wanted ? cache.wanted : (scene_t)__builtin_ctz(cache.requested);
+        cache.requested &= ~(1U << scene);
+        if (!cache_find(cache.sources[scene]) && !(cache.failed & 1U << scene))
+        {
+            return cache.sources[scene];
+        }
+    }
+    return NULL;
+}
+
+static void loader_task(void *arg)
+{
+    while (1)
+    {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        while (1)
+        {
+            lv_lock();
+            const lv_image_dsc_t *src = next_request();
+            lv_unlock();
+            if (!src)
+            {
+                break;
+            }
+            cache_load(src);
+        }
+    }
+}
+
+static void reading_change_cb(const reading_t *reading)
+{
+    cache.wanted = scene_for_reading(reading);
+    cache_entry_t *entry = cache_find(cache.sources[cache.wanted]);
+    if (entry && entry == cache.shown)
+    {
+        return;
+    }
+    if (entry && entry->prepared)
+    {
+        cache.hits++;
+        cache_show(entry);
+        return;
+    }
+    // A decoded background is shown once the timer has prepared it, one that failed is never shown
+    cache.misses++;
+    if (!entry && !(cache.failed & 1U << cache.wanted))
+    {
+        cache_request(cache.wanted);
+    }
+}
+
+bool scene_prefetch(const reading_t *reading)
+{
+    scene_t scene = scene_for_reading(reading);
+    if (cache.failed & 1U << scene)
+    {
+        return true;
+    }
+    cache_entry_t *entry = cache_find(cache.sources[scene]);
+    if (!entry)
+    {
+        cache.prefetches++;
+        cache_request(scene);
+    }
+    return entry && entry->prepared;
+}
+
+void scene_snapshot_begin(const reading_t *reading)
+{
+    const cache_entry_t *entry = cache_find(cache.sources[scene_for_reading(reading)]);
+    if (entry && entry->prepared && entry != cache.shown)
+    {
+        cache.snapshot = entry;
+        cache.show(&entry->buf);
+    }
+}
+
+void scene_snapshot_end(void)
+{
+    if (cache.snapshot)
+    {
+        cache.snapshot = NULL;
+        cache.show(&cache.shown->buf);
+    }
+}
+
+bool scene_init(const lv_image_dsc_t *const sources[SCENE_COUNT], const reading_t *initial, scene_prepare_cb_t prepare,
+                scene_show_cb_t show, void (*wake)(void))
+{
+    memcpy(cache.sources, sources, sizeof(cache.sources));
+    cache.prepare = prepare;
+    cache.show = show;
+    cache.wake_lvgl = wake;
+    cache.wanted = scene_for_reading(initial);
+    ESP_ERROR_CHECK(esp_pm_lock_create(ESP_PM_CPU_FREQ_MAX, 0, "scene", &cache.load_lock));
+    cache.loaded_timer = lv_timer_create(loaded_timer_cb, 0, NULL);
+    lv_timer_pause(cache.loaded_timer);
+
+    // The first background is needed for the first frame, it is loaded right here
+    cache_entry_t *entry = cache_load(cache.sources[cache.wanted]);
+    if (!entry)
+    {
+        return false;
+    }
+    cache.misses++;
+    lv_lock();
+    if (cache.prepare)
+    {
+        cache.prepare(&entry->buf);
+    }
+    entry->prepared = true;
+    cache_show(entry);
+    lv_unlock();
+
+    xTaskCreate(loader_task, "scene_loader", 3072, NULL, SCENE_LOADER_PRIO, &cache.loader);
+    reading_on_change(reading_change_cb);
+    return true;
+}
+
+static int scenes_cmd(int argc, char **argv)
+{
+    lv_lock();
+    scene_cache_t snapshot = cache;
+    lv_unlock();
+
+    printf("hits %lu, misses %lu, prefetches %lu, evictions %lu, failed loads %lu, slowest load %lu us\n",
+           (unsigned long)snapshot.hits, (unsigned long)snapshot.misses, (unsigned long)snapshot.prefetches,
+           (unsigned long)snapshot.evictions, (unsigned long)snapshot.failures, (unsigned long)snapshot.load_us_max);
+    printf("cache %lu of %d bytes\n", (unsigned long)snapshot.used_bytes, SCENE_CACHE_BYTES);
+    for (int i = 0; i < SCENE_COUNT; i++)
+    {
+        bool cached = false;
+        bool shown = false;
+        for (int j = 0; j < SCENE_COUNT; j++)
+        {
+            if (snapshot.entries[j].src && snapshot.entries[j].src == snapshot.sources[i])
+            {
+                cached = true;
+                shown = snapshot.shown == &cache.entries[j];
+            }
+        }
+        printf("%-8s %s%s%s\n", scene_names[i], cached ? "cached" : "-", shown ? ", shown" : "",
+               i == snapshot.wanted ? ", wanted" : "");
+    }
+    return 0;
+}
+
+void scene_register_commands(void)
+{
+    const esp_console_cmd_t cmd = {
+        .command = "scenes",
+        .help = "Print the cached backgrounds and the cache hit and miss counts",
+        .hint = NULL,
+        .func = &scenes_cmd};
+    ESP_ERROR_CHECK(esp_console_cmd_register(&cmd));
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <stdbool.h>
+#include "lvgl.h"
+#include "reading.h"
+
+// The background follows the conditions of the shown reading: night before SCENE_DAY_START_HOUR or from
+// SCENE_NIGHT_START_HOUR, otherwise stormy weather, then water colder than SCENE_COLD_TENTHS, then cloudy or sunny.
+// Backgrounds are decoded from flash into a PSRAM cache of at most SCENE_CACHE_BYTES, which evicts the least recently
+// loaded or shown ones. A cached scene is shown right away. Any other is decoded by a low priority loader task while the previous
+// background stays on the screen, so the LVGL task never waits for the flash or the decompression. The loader only
+// decodes, the LVGL task prepares and shows the background once it is in the cache. Scenes can be prefetched ahead of
+// the reading that shows them.
+#define SCENE_CACHE_BYTES (1024 * 1024) // Four full screen RGB565 backgrounds
+#define SCENE_DAY_START_HOUR 6
+#define SCENE_NIGHT_START_HOUR 21
+#define SCENE_COLD_TENTHS 150
+#define SCENE_LOADER_PRIO 2
+
+typedef enum
+{
+    SCENE_SUNNY,
+    SCENE_CLOUDY,
+    SCENE_STORMY,
+    SCENE_COLD,
+    SCENE_NIGHT,
+    SCENE_COUNT
+} scene_t;
+
+// Draws what every background is shown with into a newly decoded one, in the LVGL context. Called once per background
+// before it is first shown.
+typedef void (*scene_prepare_cb_t)(lv_draw_buf_t *background);
+
+// Shows a background, in the LVGL context.
+typedef void (*scene_show_cb_t)(const void *background);
+
+scene_t scene_for_reading(const reading_t *reading);
+
+// Shows the background of `initial` before returning, then follows the reading model. `sources` are the RGB565 images
+// of every scene, raw or LZ4 compressed, scenes may share one. `prepare` can be NULL. `wake` is called after a
+// background has been loaded, so that the LVGL task doesn't sleep past showing it. Call after reading_init() and before
+// the LVGL task starts. Returns false if the first background can't be loaded.
+bool scene_init(const lv_image_dsc_t *const sources[SCENE_COUNT], const reading_t *initial, scene_prepare_cb_t prepare,
+                scene_show_cb_t show, void (*wake)(void));
+
+// Starts loading the background of `reading` unless it is cached, with the LVGL lock held. Returns true if setting the
+// reading would show its background right away, also when it failed to load and the shown one stays.
+bool scene_prefetch(const reading_t *reading);
+
+// Shows the prepared background of `reading` for a snapshot, the shown one if it isn't cached, until
+// scene_snapshot_end(). Neither counts as a scene change nor changes the cache order. With the LVGL lock held.
+void scene_snapshot_begin(const reading_t *reading);
+void scene_snapshot_end(void);
+
+// Adds the "scenes" console command, which prints the cached backgrounds and the cache hit and miss counts.
+void scene_register_commands(void);
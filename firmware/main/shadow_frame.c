@@ -0,0 +1,69 @@
+#include "shadow_frame.h"
+
+#include <string.h>
+
+// Returns true if the tile at x, y differs from what was last sent to the panel.
+static bool tile_changed(const uint16_t *frame, const uint16_t *sent, int32_t width, int32_t x, int32_t y)
+{
+    for (int32_t row = y; row < y + SHADOW_TILE_SIZE; row++)
+    {
+        if (memcmp(frame + row * width + x, sent + row * width + x, SHADOW_TILE_SIZE * sizeof(uint16_t)) != 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+int shadow_frame_diff(const uint16_t *frame, const uint16_t *sent, int32_t width, int32_t tx1, int32_t ty1, int32_t tx2,
+                      int32_t ty2, bool all, uint64_t *changed)
+{
+    int runs = 0;
+    for (int32_t ty = ty1; ty <= ty2; ty++)
+    {
+        uint64_t row = 0;
+        bool in_run = false;
+        for (int32_t tx = tx1; tx <= tx2; tx++)
+        {
+            bool tile = all || tile_changed(frame, sent, width, tx * SHADOW_TILE_SIZE, ty * SHADOW_TILE_SIZE);
+            if (tile)
+            {
+                row |= 1ULL << tx;
+                runs += !in_run;
+            }
+            in_run = tile;
+        }
+        changed[ty] = row;
+    }
+    return runs;
+}
+
+bool shadow_frame_next_run(uint64_t changed, int32_t from, int32_t to, int32_t *first, int32_t *last)
+{
+    int32_t tx = from;
+    while (tx <= to && (changed >> tx & 1) == 0)
+    {
+        tx++;
+    }
+    if (tx > to)
+    {
+        return false;
+    }
+    *first = tx;
+    while (tx < to && (changed >> (tx + 1) & 1))
+    {
+        tx++;
+    }
+    *last = tx;
+    return true;
+}
+
+void shadow_frame_copy(uint16_t *sent, const uint16_t *frame, int32_t width, int32_t tx1, int32_t tx2, int32_t ty)
+{
+    const int32_t x = tx1 * SHADOW_TILE_SIZE;
+    const size_t size = (tx2 + 1 - tx1) * SHADOW_TILE_SIZE * sizeof(uint16_t);
+    for (int32_t row = ty * SHADOW_TILE_SIZE; row < (ty + 1) * SHADOW_TILE_SIZE; row++)
+    {
+        memcpy(sent + row * width + x, frame + row * width + x, size);
+    }
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Finds what changed between a full RGB565 frame and the frame last sent to the panel, in square tiles of
+// SHADOW_TILE_SIZE pixels. The changed tiles are kept as one bit per tile column for each tile row, the consecutive
+// changed tiles of a row make up a run that is sent as one panel window. Frames are at most 64 tiles wide.
+#define SHADOW_TILE_SIZE 8
+
+// Marks the tiles in tile rows ty1 to ty2 and tile columns tx1 to tx2 that differ between `frame` and `sent`, or all of
+// them if `all`, in `changed` which is indexed by tile row. Both frames are `width` pixels wide. Returns the number of
+// runs.
+int shadow_frame_diff(const uint16_t *frame, const uint16_t *sent, int32_t width, int32_t tx1, int32_t ty1, int32_t tx2,
+                      int32_t ty2, bool all, uint64_t *changed);
+
+// Finds the first run of a tile row's `changed` bits between tile columns `from` and `to`, false if there is none.
+bool shadow_frame_next_run(uint64_t changed, int32_t from, int32_t to, int32_t *first, int32_t *last);
+
+// Copies the tile columns tx1 to tx2 of tile row ty from `frame` into `sent`.
+void shadow_frame_copy(uint16_t *sent, const uint16_t *frame, int32_t width, int32_t tx1, int32_t tx2, int32_t ty);
@@ -0,0 +1,151 @@
+#include "telemetry.h"
+
+#include <stdio.h>
+#include <string.h>
+#include "esp_attr.h"
+#include "esp_err.h"
+#include "esp_console.h"
+#include "log_ring.h"
+
+// Log-linear buckets, every power of two is split into 8 linear sub-buckets so a percentile read from the bucket edges
+// is within 12.5% of the real value. Values below 8 get a bucket each and values from 2^24 up share the last one.
+#define SUB_BUCKET_BITS 3
+#define SUB_BUCKETS (1 << SUB_BUCKET_BITS)
+#define MAX_VALUE_BITS 24
+#define BUCKET_COUNT ((MAX_VALUE_BITS - SUB_BUCKET_BITS + 1) * SUB_BUCKETS)
+
+typedef struct
+{
+    uint32_t buckets[BUCKET_COUNT];
+    uint32_t count;
+    uint32_t max;
+    uint64_t sum;
+} histogram_t;
+
+typedef struct
+{
+    histogram_t hist[TELEMETRY_HIST_COUNT];
+    uint32_t flushes;
+    uint32_t transfers;
+    uint64_t pixels;
+    uint64_t bytes;
+} telemetry_t;
+
+static const char *const hist_names[TELEMETRY_HIST_COUNT] = {
+    [TELEMETRY_RENDER_US] = "render us",
+    [TELEMETRY_ROTATE_US] = "rotate us",
+    [TELEMETRY_SPI_US] = "spi us",
+    [TELEMETRY_FRAME_US] = "frame us",
+    [TELEMETRY_FLUSH_PX] = "flush px",
+    [TELEMETRY_FRAME_GAP_US] = "frame gap",
+    [TELEMETRY_TE_GAP_US] = "te gap",
+};
+
+// Every histogram has a single writer, the SPI and TE ones are only written from their ISRs and the others from the LVGL
+// task.
+// The console reads a copy without stopping them, which can be off by the sample being recorded at that moment.
+static DRAM_ATTR telemetry_t telemetry;
+static telemetry_t snapshot;
+
+static inline IRAM_ATTR uint32_t bucket_index(uint32_t value)
+{
+    if (value >= 1U << MAX_VALUE_BITS)
+    {
+        return BUCKET_COUNT - 1;
+    }
+    if (value < SUB_BUCKETS)
+    {
+        return value;
+    }
+    uint32_t msb = 31 - __builtin_clz(value);
+    return (msb - SUB_BUCKET_BITS + 1) * SUB_BUCKETS + ((value >> (msb - SUB_BUCKET_BITS)) & (SUB_BUCKETS - 1));
+}
+
+// Largest value that falls into bucket `index`.
+static uint32_t bucket_upper(uint32_t index)
+{
+    if (index < SUB_BUCKETS)
+    {
+        return index;
+    }
+    uint32_t msb = index / SUB_BUCKETS + SUB_BUCKET_BITS - 1;
+    uint32_t lower = (SUB_BUCKETS + index % SUB_BUCKETS) << (msb - SUB_BUCKET_BITS);
+    return lower + (1U << (msb - SUB_BUCKET_BITS)) - 1;
+}
+
+void IRAM_ATTR telemetry_record(telemetry_hist_t hist, uint32_t value)
+{
+    histogram_t *h = &telemetry.hist[hist];
+    h->buckets[bucket_index(value)]++;
+    h->count++;
+    h->sum += value;
+    if (value > h->max)
+    {
+        h->max = value;
+    }
+}
+
+void telemetry_count_flush(uint32_t pixels, uint32_t bytes, uint32_t transfers)
+{
+    telemetry.flushes++;
+    telemetry.transfers += transfers;
+    telemetry.pixels += pixels;
+    telemetry.bytes += bytes;
+    telemetry_record(TELEMETRY_FLUSH_PX, pixels);
+}
+
+// Value at the given percentile, reported as the upper edge of its bucket and capped at the recorded maximum.
+static uint32_t percentile(const histogram_t *h, uint32_t percent)
+{
+    uint64_t target = ((uint64_t)h->count * percent + 99) / 100;
+    uint64_t seen = 0;
+    for (uint32_t i = 0; i < BUCKET_COUNT; i++)
+    {
+        seen += h->buckets[i];
+        if (seen >= target)
+        {
+            uint32_t upper = bucket_upper(i);
+            return upper < h->max ? upper : h->max;
+        }
+    }
+    return h->max;
+}
+
+static int telemetry_cmd(int argc, char **argv)
+{
+    if (argc > 1 && strcmp(argv[1], "reset") == 0)
+    {
+        memset(&telemetry, 0, sizeof(telemetry));
+        return 0;
+    }
+
+    memcpy(&snapshot, &telemetry, sizeof(snapshot));
+
+    printf("flushes %lu, transfers %lu, pixels %llu, bytes %llu\n", (unsigned long)snapshot.flushes,
+           (unsigned long)snapshot.transfers, (unsigned long long)snapshot.pixels, (unsigned long long)snapshot.bytes);
+    printf("log lines dropped %lu\n", (unsigned long)log_ring_dropped());
+    printf("%-10s %8s %8s %8s %8s %8s %8s\n", "", "count", "mean", "p50", "p90", "p99", "max");
+    for (int i = 0; i < TELEMETRY_HIST_COUNT; i++)
+    {
+        const histogram_t *h = &snapshot.hist[i];
+        if (h->count == 0)
+        {
+            printf("%-10s %8d\n", hist_names[i], 0);
+            continue;
+        }
+        printf("%-10s %8lu %8lu %8lu %8lu %8lu %8lu\n", hist_names[i], (unsigned long)h->count,
+               (unsigned long)(h->sum / h->count), (unsigned long)percentile(h, 50), (unsigned long)percentile(h, 90),
+               (unsigned long)percentile(h, 99), (unsigned long)h->max);
+    }
+    return 0;
+}
+
+void telemetry_register_commands(void)
+{
+    const esp_console_cmd_t cmd = {
+        .command = "telemetry",
+        .help = "Print render path counters and latency percentiles, \"telemetry reset\" clears them",
+        .hint = "[reset]",
+        .func = &telemetry_cmd};
+    ESP_ERROR_CHECK(esp_console_cmd_register(&cmd));
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <stdint.h>
+
+// Latency and size histograms of the render path. Recording is a few instructions into fixed static storage, no
+// allocation, locking or logging, so it can stay enabled on deployed units and be called from ISRs.
+typedef enum
+{
+    TELEMETRY_RENDER_US,    // LVGL rendering of a flushed area, including any wait for the previous flush
+    TELEMETRY_ROTATE_US,    // Pixel conversion in flush_cb (rotation and byte swap)
+    TELEMETRY_SPI_US,       // First queued transfer of a flush until the last one is on the panel
+    TELEMETRY_FRAME_US,     // Whole display refresh, from refresh start to refresh ready
+    TELEMETRY_FLUSH_PX,     // Pixels in a flushed area
+    TELEMETRY_FRAME_GAP_US, // Refresh ready to the next refresh ready, the frame pacing and its jitter
+    TELEMETRY_TE_GAP_US,    // Between tearing effect pulses of the panel
+    TELEMETRY_HIST_COUNT
+} telemetry_hist_t;
+
+void telemetry_record(telemetry_hist_t hist, uint32_t value);
+
+// Counts a flush of `pixels` pixels that sent `bytes` bytes in `transfers` panel transfers.
+void telemetry_count_flush(uint32_t pixels, uint32_t bytes, uint32_t transfers);
+
+// Adds the "telemetry" console command, which prints the counters and p50/p90/p99/max of every histogram.
+// "telemetry reset" clears them.
+void telemetry_register_commands(void);
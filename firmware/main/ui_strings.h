@@ -0,0 +1,26 @@
+#pragma once
+
+// Every text the UI shows, with the font it is drawn in. tools/gen_fonts.py reads this table to subset the generated
+// fonts to the glyphs that are actually used, so a text or a character that can appear at runtime has to be listed
+// here before it can be drawn in a generated font. Rows are X(id, font, "text").
+#define UI_STRINGS(X)                                        \
+    X(BEACH_AHUS, my_font, "Åhus, Täppet")                   \
+    X(BEACH_MOLLE, my_font, "Mölle, Hamnen")                 \
+    X(BEACH_LOMMA, my_font, "Lomma, Bryggan")                \
+    X(BEACH_SKANOR, my_font, "Skanör, Revet")                \
+    X(TEMPERATURE, my_font, "20.4 °C")                       \
+    X(TEMPERATURE_CHARS, my_font, "-0123456789.,°C ")        \
+    X(READOUT_CHARS, readout_font, "-0123456789.°C ")        \
+    X(DATE, lv_font_montserrat_28, "Idag kl 15:00")
+
+#define UI_STRING_ID(id, font, text) UI_STR_##id,
+typedef enum
+{
+    UI_STRINGS(UI_STRING_ID)
+    UI_STR_COUNT
+} ui_string_t;
+#undef UI_STRING_ID
+
+#define UI_STRING_TEXT(id, font, text) [UI_STR_##id] = text,
+static const char *const ui_strings[UI_STR_COUNT] = {UI_STRINGS(UI_STRING_TEXT)};
+#undef UI_STRING_TEXT
@@ -0,0 +1,336 @@
+// Host test of the asset pack built by tools/pack_assets.py from beach.c and my_font.c: the CRC matches, the records
+// read back through the structs of assets_pack.h match the C sources, and records whose offsets or lengths reach
+// outside of their entry or the pack are rejected before a descriptor is built from them.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "assets_pack.h"
+
+static int failures;
+
+#define CHECK(cond)                                                                  \
+    do                                                                               \
+    {                                                                                \
+        if (!(cond))                                                                 \
+        {                                                                            \
+            fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            failures++;                                                              \
+        }                                                                            \
+    } while (0)
+
+static uint8_t *pack;
+static uint8_t *copy;
+static size_t pack_size;
+
+static char *read_file(const char *path, size_t *size)
+{
+    FILE *f = fopen(path, "rb");
+    if (!f)
+    {
+        fprintf(stderr, "Can't open %s\n", path);
+        exit(1);
+    }
+    fseek(f, 0, SEEK_END);
+    long length = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    // 4 byte aligned like the mapping, and terminated for the source scans
+    char *data = aligned_alloc(4, ((size_t)length + 4) & ~(size_t)3);
+    if (!data || fread(data, 1, length, f) != (size_t)length)
+    {
+        fprintf(stderr, "Can't read %s\n", path);
+        exit(1);
+    }
+    data[length] = 0;
+    fclose(f);
+    *size = length;
+    return data;
+}
+
+// zlib's CRC-32, which esp_rom_crc32_le computes on the device.
+static uint32_t crc32(const uint8_t *data, size_t size)
+{
+    uint32_t crc = 0xFFFFFFFF;
+    for (size_t i = 0; i < size; i++)
+    {
+        crc ^= data[i];
+        for (int bit = 0; bit < 8; bit++)
+        {
+            crc = crc >> 1 ^ (0xEDB88320 & -(crc & 1));
+        }
+    }
+    return ~crc;
+}
+
+// The values of a byte array in a generated C file, skipping the comments between them. Returns the count.
+static size_t source_array(const char *source, const char *name, uint8_t *values, size_t capacity)
+{
+    char pattern[64];
+    snprintf(pattern, sizeof(pattern), " %s[] =", name);
+    const char *p = strstr(source, pattern);
+    if (!p)
+    {
+        fprintf(stderr, "No %s in the source\n", name);
+        exit(1);
+    }
+    p = strchr(p, '{') + 1;
+    size_t count = 0;
+    while (*p && *p != '}')
+    {
+        if (p[0] == '/' && p[1] == '*')
+        {
+            p = strstr(p, "*/") + 2;
+        }
+        else if (*p == '-' || (*p >= '0' && *p <= '9'))
+        {
+            char *end;
+            long value = strtol(p, &end, 0);
+            if (count < capacity)
+            {
+                values[count] = (uint8_t)value;
+            }
+            count++;
+            p = end;
+        }
+        else
+        {
+            p++;
+        }
+    }
+    return count;
+}
+
+static long source_field(const char *source, const char *name)
+{
+    const char *p = strstr(source, name);
+    if (!p)
+    {
+        fprintf(stderr, "No %s in the source\n", name);
+        exit(1);
+    }
+    return strtol(strchr(p, '=') + 1, NULL, 0);
+}
+
+static const uint8_t *record_of(const assets_header_t *header, const char *name, assets_type_t type)
+{
+    const assets_entry_t *entry = assets_pack_find(header, name, type);
+    return entry ? (const uint8_t *)header + entry->offset : NULL;
+}
+
+static void check_image(const assets_header_t *header, const char *source)
+{
+    const assets_entry_t *entry = assets_pack_find(header, "beach", ASSETS_TYPE_IMAGE);
+    CHECK(entry && assets_pack_record_valid(header, entry));
+    if (!entry)
+    {
+        return;
+    }
+    const assets_image_t *image = (const assets_image_t *)record_of(header, "beach", ASSETS_TYPE_IMAGE);
+    CHECK(image->format == ASSETS_IMAGE_RGB565);
+    CHECK(image->w == source_field(source, ".header.w"));
+    CHECK(image->h == source_field(source, ".header.h"));
+    CHECK(image->stride == image->w * 2);
+
+    static uint8_t pixels[1024 * 1024];
+    size_t count = source_array(source, "beach_map", pixels, sizeof(pixels));
+    CHECK(image->data_size == count);
+    CHECK(memcmp((const uint8_t *)image + image->data, pixels, count) == 0);
+}
+
+static void check_font(const assets_header_t *header, const char *source)
+{
+    const assets_entry_t *entry = assets_pack_find(header, "my_font", ASSETS_TYPE_FONT);
+    CHECK(entry && assets_pack_record_valid(header, entry));
+    if (!entry)
+    {
+        return;
+    }
+    const uint8_t *record = record_of(header, "my_font", ASSETS_TYPE_FONT);
+    const assets_font_t *font = (const assets_font_t *)record;
+    CHECK(font->line_height == source_field(source, ".line_height"));
+    CHECK(font->base_line == source_field(source, ".base_line"));
+    CHECK(font->bpp == source_field(source, ".bpp"));
+    CHECK(font->cmap_num == source_field(source, ".cmap_num"));
+
+    static uint8_t values[256 * 1024];
+    size_t count = source_array(source, "glyph_bitmap", values, sizeof(values));
+    CHECK(font->bitmap_size == count);
+    CHECK(memcmp(record + font->bitmap, values, count) == 0);
+
+    // Each glyph descriptor in the LVGL bitfield layout, glyph 0 included
+    uint32_t glyphs = 0;
+    for (const char *p = strstr(source, "{.bitmap_index"); p; p = strstr(p + 1, "{.bitmap_index"), glyphs++)
+    {
+        int index, adv_w, box_w, box_h, ofs_x, ofs_y;
+        sscanf(p, "{.bitmap_index = %d, .adv_w = %d, .box_w = %d, .box_h = %d, .ofs_x = %d, .ofs_y = %d", &index,
+               &adv_w, &box_w, &box_h, &ofs_x, &ofs_y);
+        const uint8_t *dsc = record + font->glyph_dsc + glyphs * ASSETS_GLYPH_DSC_SIZE;
+        uint32_t word = dsc[0] | dsc[1] << 8 | dsc[2] << 16 | (uint32_t)dsc[3] << 24;
+        CHECK((int)(word & 0xFFFFF) == index && (int)(word >> 20) == adv_w);
+        CHECK(dsc[4] == box_w && dsc[5] == box_h && (int8_t)dsc[6] == ofs_x && (int8_t)dsc[7] == ofs_y);
+    }
+    CHECK(font->glyph_cnt == glyphs);
+
+    CHECK(font->kern == ASSETS_KERN_CLASSES);
+    CHECK(font->kern_left_cnt == source_field(source, ".left_class_cnt"));
+    CHECK(font->kern_right_cnt == source_field(source, ".right_class_cnt"));
+    count = source_array(source, "kern_class_values", values, sizeof(values));
+    CHECK(count == (size_t)font->kern_left_cnt * font->kern_right_cnt);
+    CHECK(memcmp(record + font->kern_values, values, count) == 0);
+}
+
+// A fresh copy of the pack to corrupt.
+static assets_header_t *reset(void)
+{
+    memcpy(copy, pack, pack_size);
+    return (assets_header_t *)copy;
+}
+
+static assets_entry_t *entry_of(assets_header_t *header, const char *name, assets_type_t type)
+{
+    return (assets_entry_t *)assets_pack_find(header, name, type);
+}
+
+static void check_rejected(void)
+{
+    assets_header_t *header = reset();
+    header->size = pack_size + 1;
+    CHECK(!assets_pack_check(header, pack_size));
+    header = reset();
+    header->version++;
+    CHECK(!assets_pack_check(header, pack_size));
+    header = reset();
+    header->count = (pack_size - sizeof(assets_header_t)) / sizeof(assets_entry_t) + 1;
+    CHECK(!assets_pack_check(header, pack_size));
+    header = reset();
+    CHECK(!assets_pack_check(header, sizeof(assets_header_t) - 1));
+
+    // Entries reaching past the pack, into the entry table or misaligned
+    header = reset();
+    assets_entry_t *entry = entry_of(header, "my_font", ASSETS_TYPE_FONT);
+    entry->size += 4;
+    CHECK(!assets_pack_record_valid(header, entry));
+    entry->size -= 4;
+    entry->offset = header->size - 8;
+    CHECK(!assets_pack_record_valid(header, entry));
+    entry->offset = sizeof(assets_header_t);
+    CHECK(!assets_pack_record_valid(header, entry));
+    entry->offset = pack_size + 0x10000;
+    CHECK(!assets_pack_record_valid(header, entry));
+    header = reset();
+    entry = entry_of(header, "beach", ASSETS_TYPE_IMAGE);
+    entry->offset += 2;
+    CHECK(!assets_pack_record_valid(header, entry));
+
+    // Image data past the record, or shorter than the rows LVGL reads
+    header = reset();
+    entry = entry_of(header, "beach", ASSETS_TYPE_IMAGE);
+    assets_image_t *image = (assets_image_t *)(copy + entry->offset);
+    image->data_size++;
+    CHECK(!assets_pack_record_valid(header, entry));
+    image->data_size--;
+    image->h++;
+    CHECK(!assets_pack_record_valid(header, entry));
+    image->h--;
+    image->stride = image->w;
+    CHECK(!assets_pack_record_valid(header, entry));
+    image->stride = image->w * 2;
+    image->data = 0;
+    CHECK(!assets_pack_record_valid(header, entry));
+    header = reset();
+    entry = entry_of(header, "beach", ASSETS_TYPE_IMAGE);
+    entry->size = sizeof(assets_image_t) - 1;
+    CHECK(!assets_pack_record_valid(header, entry));
+
+    // Font arrays past the record
+    header = reset();
+    entry = entry_of(header, "my_font", ASSETS_TYPE_FONT);
+    assets_font_t *font = (assets_font_t *)(copy + entry->offset);
+    CHECK(assets_pack_record_valid(header, entry));
+    font->bitmap_size = entry->size;
+    CHECK(!assets_pack_record_valid(header, entry));
+    header = reset();
+    font->glyph_cnt = entry->size / ASSETS_GLYPH_DSC_SIZE;
+    CHECK(!assets_pack_record_valid(header, entry));
+    header = reset();
+    font->glyph_cnt = 0x40000000;
+    CHECK(!assets_pack_record_valid(header, entry));
+    header = reset();
+    font->bitmap++;
+    CHECK(!assets_pack_record_valid(header, entry));
+    header = reset();
+    font->cmap_num = entry->size / sizeof(assets_cmap_t);
+    CHECK(!assets_pack_record_valid(header, entry));
+    header = reset();
+    font->kern_left_cnt = 255;
+    font->kern_right_cnt = 255;
+    CHECK(!assets_pack_record_valid(header, entry));
+    header = reset();
+    font->kern = ASSETS_KERN_PAIRS;
+    font->kern_left_cnt = 2;
+    font->kern_pair_cnt = entry->size / 4;
+    CHECK(!assets_pack_record_valid(header, entry));
+    header = reset();
+    font->kern = 3;
+    CHECK(!assets_pack_record_valid(header, entry));
+
+    // Each cmap's lists, for its type
+    for (int i = 0; i < font->cmap_num; i++)
+    {
+        header = reset();
+        assets_cmap_t *cmap = (assets_cmap_t *)(copy + entry->offset + font->cmaps) + i;
+        if (cmap->type == ASSETS_CMAP_FORMAT0_TINY)
+        {
+            continue;
+        }
+        if (cmap->type == ASSETS_CMAP_FORMAT0_FULL)
+        {
+            cmap->range_length = 0xFFFF;
+        }
+        else
+        {
+            cmap->list_length = 0xFFFF;
+        }
+        CHECK(!assets_pack_record_valid(header, entry));
+        header = reset();
+        cmap->type = 4;
+        CHECK(!assets_pack_record_valid(header, entry));
+    }
+}
+
+int main(int argc, char **argv)
+{
+    if (argc != 4)
+    {
+        fprintf(stderr, "Usage: %s assets.bin beach.c my_font.c\n", argv[0]);
+        return 1;
+    }
+    size_t size;
+    pack = (uint8_t *)read_file(argv[1], &pack_size);
+    copy = malloc(pack_size);
+    char *beach = read_file(argv[2], &size);
+    char *my_font = read_file(argv[3], &size);
+    if (!copy)
+    {
+        fprintf(stderr, "Out of memory\n");
+        return 1;
+    }
+
+    const assets_header_t *header = (const assets_header_t *)pack;
+    CHECK(assets_pack_check(header, pack_size));
+    CHECK(header->size == pack_size && header->count == 2);
+    CHECK(crc32(pack + sizeof(assets_header_t), header->size - sizeof(assets_header_t)) == header->crc32);
+
+    check_image(header, beach);
+    check_font(header, my_font);
+    CHECK(!assets_pack_find(header, "sunny", ASSETS_TYPE_IMAGE));
+    CHECK(!assets_pack_find(header, "beach", ASSETS_TYPE_FONT));
+    check_rejected();
+
+    printf("asset pack: %d failed checks\n", failures);
+    free(pack);
+    free(copy);
+    free(beach);
+    free(my_font);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,165 @@
+// Host test of rotate_stripe against rotate_stripe_ref over random areas, which have to match bit for bit. Built with
+// ROTATE_USE_PIE 0 it covers the scalar tiled kernel. Built with ROTATE_USE_PIE 1 the band routine of rotate_pie.S is
+// replaced by the emulation below, which runs the same vector instructions in the same order, so it covers the
+// transpose and byte swap sequence and the pointer math of the wrapper. The instructions themselves are only run by
+// the boot check on the device (ROTATE_BENCHMARK).
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "rotate.h"
+
+#define MAX_WIDTH 456
+#define MAX_LINES 70
+#define AREAS 2000
+
+#if ROTATE_USE_PIE
+// A 128-bit PIE register.
+typedef union
+{
+    uint8_t b[16];
+    uint16_t h[8];
+} q_t;
+
+// ee.vzip.16 qa, qb: interleaves the halfwords of both registers, qa gets the first half of the result.
+static void vzip_16(q_t *qa, q_t *qb)
+{
+    q_t a = *qa;
+    q_t b = *qb;
+    for (int i = 0; i < 4; i++)
+    {
+        qa->h[2 * i] = a.h[i];
+        qa->h[2 * i + 1] = b.h[i];
+        qb->h[2 * i] = a.h[4 + i];
+        qb->h[2 * i + 1] = b.h[4 + i];
+    }
+}
+
+// ee.vzip.8 qa, qb: interleaves the bytes of both registers, qa gets the first half of the result.
+static void vzip_8(q_t *qa, q_t *qb)
+{
+    q_t a = *qa;
+    q_t b = *qb;
+    for (int i = 0; i < 8; i++)
+    {
+        qa->b[2 * i] = a.b[i];
+        qa->b[2 * i + 1] = b.b[i];
+        qb->b[2 * i] = a.b[8 + i];
+        qb->b[2 * i + 1] = b.b[8 + i];
+    }
+}
+
+// ee.vunzip.8 qa, qb: qa gets the even and qb the odd bytes of qa followed by qb.
+static void vunzip_8(q_t *qa, q_t *qb)
+{
+    uint8_t both[32];
+    memcpy(both, qa->b, 16);
+    memcpy(both + 16, qb->b, 16);
+    for (int i = 0; i < 16; i++)
+    {
+        qa->b[i] = both[2 * i];
+        qb->b[i] = both[2 * i + 1];
+    }
+}
+
+// rotate_pie.S, instruction for instruction.
+void rotate_band_pie(uint16_t *dst, const uint16_t *src, int32_t src_step, int32_t dst_step, int32_t tiles)
+{
+    uint8_t *out = (uint8_t *)dst;
+    const uint8_t *in = (const uint8_t *)src;
+    for (int32_t t = 0; t < tiles; t++)
+    {
+        q_t q[8];
+        const uint8_t *line = in;
+        for (int i = 0; i < 8; i++)
+        {
+            memcpy(q[i].b, line, 16);
+            line += src_step;
+        }
+
+        vzip_16(&q[0], &q[4]);
+        vzip_16(&q[1], &q[5]);
+        vzip_16(&q[2], &q[6]);
+        vzip_16(&q[3], &q[7]);
+        vzip_16(&q[0], &q[2]);
+        vzip_16(&q[4], &q[6]);
+        vzip_16(&q[1], &q[3]);
+        vzip_16(&q[5], &q[7]);
+        vzip_16(&q[0], &q[1]);
+        vzip_16(&q[2], &q[3]);
+        vzip_16(&q[4], &q[5]);
+        vzip_16(&q[6], &q[7]);
+
+        for (int i = 0; i < 8; i += 2)
+        {
+            vunzip_8(&q[i], &q[i + 1]);
+            vzip_8(&q[i + 1], &q[i]);
+        }
+
+        static const int order[8] = {1, 0, 3, 2, 5, 4, 7, 6};
+        for (int i = 0; i < 8; i++)
+        {
+            memcpy(out, q[order[i]].b, 16);
+            out += dst_step;
+        }
+        in += 16;
+    }
+}
+#endif
+
+static uint16_t *aligned_buffer(size_t pixels)
+{
+    uint16_t *buf = aligned_alloc(64, (pixels * sizeof(uint16_t) + 63) & ~(size_t)63);
+    if (!buf)
+    {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    return buf;
+}
+
+int main(void)
+{
+    const size_t src_pixels = MAX_WIDTH * MAX_LINES + 8;
+    uint16_t *src = aligned_buffer(src_pixels);
+    uint16_t *expected = aligned_buffer(MAX_WIDTH * MAX_LINES + 8);
+    uint16_t *actual = aligned_buffer(MAX_WIDTH * MAX_LINES + 8);
+    srand(1);
+    for (size_t i = 0; i < src_pixels; i++)
+    {
+        src[i] = (uint16_t)rand();
+    }
+
+    int failures = 0;
+    int vector_areas = 0;
+    for (int i = 0; i < AREAS; i++)
+    {
+        // Mostly 8 pixel aligned areas like the display rounder produces, with some only even sized ones mixed in. Some
+        // buffers are only 4 byte aligned, which has to take the scalar kernel.
+        int32_t align = rand() % 4 ? 8 : 2;
+        int32_t width = align * (1 + rand() % (MAX_WIDTH / align));
+        int32_t rows = align * (1 + rand() % (MAX_LINES / align));
+        int32_t stride = width + align * (rand() % ((MAX_WIDTH - width) / align + 1));
+        int32_t offset = (rand() % (MAX_LINES - rows + 1)) * stride + (rand() % 4 ? 0 : 2);
+        int32_t dst_offset = rand() % 4 ? 0 : 2;
+        vector_areas += align == 8 && stride % 8 == 0 && offset % 8 == 0 && dst_offset == 0;
+
+        memset(expected, 0, (MAX_WIDTH * MAX_LINES + 8) * sizeof(uint16_t));
+        memset(actual, 0, (MAX_WIDTH * MAX_LINES + 8) * sizeof(uint16_t));
+        rotate_stripe_ref(expected + dst_offset, src + offset, stride, width, rows);
+        rotate_stripe(actual + dst_offset, src + offset, stride, width, rows);
+        if (memcmp(expected, actual, (MAX_WIDTH * MAX_LINES + 8) * sizeof(uint16_t)) != 0)
+        {
+            fprintf(stderr, "Mismatch for width=%d rows=%d stride=%d offset=%d dst_offset=%d\n", (int)width, (int)rows,
+                    (int)stride, (int)offset, (int)dst_offset);
+            failures++;
+        }
+    }
+
+    printf("%s kernel: %d of %d random areas match the reference, %d of them vector aligned\n",
+           ROTATE_USE_PIE ? "PIE" : "tiled", AREAS - failures, AREAS, vector_areas);
+    free(src);
+    free(expected);
+    free(actual);
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,117 @@
+// Host test of the shadow frame diff, on a frame of the display's size: the first flush sends every tile, an unchanged
+// frame sends nothing, scattered changes are sent as one window per run of changed tiles, and the sent frame matches
+// the rendered one once the runs have been copied.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "shadow_frame.h"
+
+#define WIDTH 456
+#define HEIGHT 280
+#define TILES_X (WIDTH / SHADOW_TILE_SIZE)
+#define TILES_Y (HEIGHT / SHADOW_TILE_SIZE)
+
+static int failures;
+
+#define CHECK(cond)                                                                  \
+    do                                                                               \
+    {                                                                                \
+        if (!(cond))                                                                 \
+        {                                                                            \
+            fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            failures++;                                                              \
+        }                                                                            \
+    } while (0)
+
+static uint16_t frame[WIDTH * HEIGHT];
+static uint16_t sent[WIDTH * HEIGHT];
+static uint64_t changed[TILES_Y];
+
+// Copies every run of the area like flush_cb, returns the number of runs.
+static int send_runs(int32_t tx1, int32_t ty1, int32_t tx2, int32_t ty2)
+{
+    int runs = 0;
+    for (int32_t ty = ty1; ty <= ty2; ty++)
+    {
+        int32_t first;
+        int32_t last;
+        for (int32_t tx = tx1; shadow_frame_next_run(changed[ty], tx, tx2, &first, &last); tx = last + 1)
+        {
+            CHECK(first >= tx && last >= first && last <= tx2);
+            shadow_frame_copy(sent, frame, WIDTH, first, last, ty);
+            runs++;
+        }
+    }
+    return runs;
+}
+
+static void set_pixel(int32_t x, int32_t y)
+{
+    frame[y * WIDTH + x] ^= 0x1234;
+}
+
+int main(void)
+{
+    srand(1);
+    for (int i = 0; i < WIDTH * HEIGHT; i++)
+    {
+        frame[i] = (uint16_t)rand();
+    }
+
+    // Nothing is known about the panel yet, every tile is sent and each tile row is one run
+    int runs = shadow_frame_diff(frame, sent, WIDTH, 0, 0, TILES_X - 1, TILES_Y - 1, true, changed);
+    CHECK(runs == TILES_Y);
+    CHECK(send_runs(0, 0, TILES_X - 1, TILES_Y - 1) == runs);
+    CHECK(memcmp(frame, sent, sizeof(frame)) == 0);
+
+    // The same frame again
+    runs = shadow_frame_diff(frame, sent, WIDTH, 0, 0, TILES_X - 1, TILES_Y - 1, false, changed);
+    CHECK(runs == 0);
+    for (int ty = 0; ty < TILES_Y; ty++)
+    {
+        CHECK(changed[ty] == 0);
+    }
+
+    // Two pixels in neighbouring tiles make one run, a pixel further along the row another one. Tile row 20 gets a run
+    // up to the last tile column and the change in tile row 30 is outside the flushed area.
+    set_pixel(2 * SHADOW_TILE_SIZE + 7, 5 * SHADOW_TILE_SIZE);
+    set_pixel(3 * SHADOW_TILE_SIZE, 5 * SHADOW_TILE_SIZE + 7);
+    set_pixel(10 * SHADOW_TILE_SIZE + 3, 5 * SHADOW_TILE_SIZE + 3);
+    set_pixel((TILES_X - 2) * SHADOW_TILE_SIZE, 20 * SHADOW_TILE_SIZE);
+    set_pixel((TILES_X - 1) * SHADOW_TILE_SIZE + 7, 20 * SHADOW_TILE_SIZE + 7);
+    set_pixel(4 * SHADOW_TILE_SIZE, 30 * SHADOW_TILE_SIZE);
+    runs = shadow_frame_diff(frame, sent, WIDTH, 0, 0, TILES_X - 1, 25, false, changed);
+    CHECK(runs == 3);
+    CHECK(changed[5] == (1ULL << 2 | 1ULL << 3 | 1ULL << 10));
+    CHECK(changed[20] == (1ULL << (TILES_X - 2) | 1ULL << (TILES_X - 1)));
+    CHECK(send_runs(0, 0, TILES_X - 1, 25) == runs);
+    CHECK(memcmp(frame, sent, sizeof(frame)) != 0);
+
+    // The change outside the area is sent with the next flush that covers it, then both frames match
+    runs = shadow_frame_diff(frame, sent, WIDTH, 0, 26, TILES_X - 1, TILES_Y - 1, false, changed);
+    CHECK(runs == 1);
+    CHECK(changed[30] == 1ULL << 4);
+    CHECK(send_runs(0, 26, TILES_X - 1, TILES_Y - 1) == runs);
+    CHECK(memcmp(frame, sent, sizeof(frame)) == 0);
+
+    // Random changes in random areas, sending the runs leaves the area identical in both frames
+    for (int i = 0; i < 200; i++)
+    {
+        int32_t tx1 = rand() % TILES_X;
+        int32_t tx2 = tx1 + rand() % (TILES_X - tx1);
+        int32_t ty1 = rand() % TILES_Y;
+        int32_t ty2 = ty1 + rand() % (TILES_Y - ty1);
+        for (int j = rand() % 20; j > 0; j--)
+        {
+            set_pixel(tx1 * SHADOW_TILE_SIZE + rand() % ((tx2 - tx1 + 1) * SHADOW_TILE_SIZE),
+                      ty1 * SHADOW_TILE_SIZE + rand() % ((ty2 - ty1 + 1) * SHADOW_TILE_SIZE));
+        }
+        runs = shadow_frame_diff(frame, sent, WIDTH, tx1, ty1, tx2, ty2, false, changed);
+        CHECK(send_runs(tx1, ty1, tx2, ty2) == runs);
+        CHECK(memcmp(frame, sent, sizeof(frame)) == 0);
+    }
+
+    printf("shadow frame: %d failed checks\n", failures);
+    return failures ? 1 : 0;
+}
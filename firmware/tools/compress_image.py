@@ -0,0 +1,152 @@
+#!/usr/bin/env python3
+"""Compresses an LVGL image C file (as written by LVGLImage.py or the online converter) with LZ4 for image_lz4.c.
+
+  compress_image.py main/beach.c main/beach_lz4.c
+
+The pixels are packed as one raw LZ4 block with the lz4 command line tool at its highest level, the output defines
+<name>_lz4 flagged with IMAGE_LZ4_FLAG for the scene cache. Without the lz4 tool a simpler built-in compressor is used,
+its blocks are somewhat larger.
+"""
+
+import argparse
+import collections
+import os
+import re
+import shutil
+import subprocess
+import sys
+
+LZ4_MAGIC = 0x184D2204
+LZ4_MIN_MATCH = 4
+LZ4_MAX_OFFSET = 65535
+LZ4_LAST_LITERALS = 5  # The block ends with at least this many literals
+LZ4_MATCH_LIMIT = 12   # and the last match starts at least this far from the end
+LZ4_CHAIN_DEPTH = 32
+
+
+def read_image(path):
+    with open(path, encoding='utf-8') as f:
+        source = f.read()
+    array = re.search(r'uint8_t (\w+)_map\[\]\s*=\s*\{(.*?)\};', source, re.S)
+    if not array:
+        sys.exit(f'No image array in {path}')
+    header = {key: value for key, value in re.findall(r'\.header\.(\w+)\s*=\s*(\w+)', source)}
+    pixels = bytes(int(x, 16) for x in re.findall(r'0x([0-9a-fA-F]{2})', array.group(2)))
+    return array.group(1), header, pixels
+
+
+def lz4_length(out, length):
+    while length >= 255:
+        out.append(255)
+        length -= 255
+    out.append(length)
+
+
+def lz4_sequence(out, literals, offset=0, match=0):
+    """Appends a sequence, the last one of a block has no match."""
+    match_code = match - LZ4_MIN_MATCH if offset else 0
+    out.append(min(len(literals), 15) << 4 | min(match_code, 15))
+    if len(literals) >= 15:
+        lz4_length(out, len(literals) - 15)
+    out += literals
+    if offset:
+        out += offset.to_bytes(2, 'little')
+        if match_code >= 15:
+            lz4_length(out, match_code - 15)
+
+
+def lz4_block_builtin(data):
+    """LZ4 block compressor, takes the longest match among the last LZ4_CHAIN_DEPTH positions of each 4 byte key."""
+    out = bytearray()
+    chains = {}
+    anchor = 0
+    i = 0
+
+    def insert(position):
+        key = data[position:position + LZ4_MIN_MATCH]
+        chain = chains.get(key)
+        if chain is None:
+            chain = chains[key] = collections.deque(maxlen=LZ4_CHAIN_DEPTH)
+        chain.append(position)
+
+    while i < len(data) - LZ4_MATCH_LIMIT:
+        limit = len(data) - LZ4_LAST_LITERALS - i
+        match = offset = 0
+        for candidate in reversed(chains.get(data[i:i + LZ4_MIN_MATCH], ())):
+            if i - candidate > LZ4_MAX_OFFSET:
+                break
+            length = LZ4_MIN_MATCH
+            while length < limit and data[candidate + length] == data[i + length]:
+                length += 1
+            if length > match:
+                match, offset = length, i - candidate
+        insert(i)
+        if not match:
+            i += 1
+            continue
+        lz4_sequence(out, data[anchor:i], offset, match)
+        for position in range(i + 1, min(i + match, len(data) - LZ4_MATCH_LIMIT)):
+            insert(position)
+        i += match
+        anchor = i
+    lz4_sequence(out, data[anchor:])
+    return bytes(out)
+
+
+def lz4_block(data):
+    """Compresses `data` into a single raw LZ4 block, taken out of the frame the lz4 tool writes."""
+    if not shutil.which('lz4'):
+        return lz4_block_builtin(data)
+    frame = subprocess.run(['lz4', '-12', '-B7', '--no-frame-crc', '-c'], input=data, capture_output=True,
+                           check=True).stdout
+    if int.from_bytes(frame[0:4], 'little') != LZ4_MAGIC:
+        sys.exit('Unexpected lz4 output')
+    flags = frame[4]
+    pos = 4 + 2 + (8 if flags & 0x08 else 0) + (4 if flags & 0x01 else 0) + 1
+    size = int.from_bytes(frame[pos:pos + 4], 'little')
+    if size & 0x80000000:
+        sys.exit('The image does not compress')
+    block = frame[pos + 4:pos + 4 + size]
+    if int.from_bytes(frame[pos + 4 + size:pos + 8 + size], 'little') != 0:
+        sys.exit('The image did not fit into one LZ4 block')
+    return block
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('input', help='LVGL image C file')
+    parser.add_argument('output', help='C file to write')
+    args = parser.parse_args()
+
+    name, header, pixels = read_image(args.input)
+    width = int(header['w'])
+    height = int(header['h'])
+    if header.get('cf') != 'LV_COLOR_FORMAT_RGB565' or len(pixels) != width * height * 2:
+        sys.exit('Only RGB565 images without stride padding are supported')
+    block = lz4_block(pixels)
+
+    lines = []
+    for i in range(0, len(block), 32):
+        lines.append('  ' + ' '.join(f'0x{b:02x},' for b in block[i:i + 32]))
+    with open(args.output, 'w', encoding='utf-8') as f:
+        f.write(f'// Generated by tools/compress_image.py from {os.path.basename(args.input)}, do not edit.\n')
+        f.write(f'// {len(pixels)} bytes of RGB565 packed into {len(block)} bytes with LZ4.\n\n')
+        f.write('#include "lvgl.h"\n#include "image_lz4.h"\n\n')
+        f.write(f'static const LV_ATTRIBUTE_LARGE_CONST uint8_t {name}_lz4_map[] = {{\n')
+        f.write('\n'.join(lines))
+        f.write('\n};\n\n')
+        f.write(f'const lv_image_dsc_t {name}_lz4 = {{\n')
+        f.write('  .header.cf = LV_COLOR_FORMAT_RGB565,\n')
+        f.write('  .header.magic = LV_IMAGE_HEADER_MAGIC,\n')
+        f.write('  .header.flags = IMAGE_LZ4_FLAG,\n')
+        f.write(f'  .header.w = {width},\n')
+        f.write(f'  .header.h = {height},\n')
+        f.write(f'  .header.stride = {width * 2},\n')
+        f.write(f'  .data_size = {len(block)},\n')
+        f.write(f'  .data = {name}_lz4_map,\n')
+        f.write('};\n')
+    print(f'{args.output}: {len(pixels)} -> {len(block)} bytes ({100 * len(block) // len(pixels)}%)')
+
+
+if __name__ == '__main__':
+    main()
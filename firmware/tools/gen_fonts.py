@@ -0,0 +1,126 @@
+#!/usr/bin/env python3
+"""Generates the LVGL fonts from the texts the UI actually shows.
+
+The characters are collected from the UI_STRINGS table in main/ui_strings.h, so a font only contains glyphs that are
+used. Fonts are converted with lv_font_conv (npm install -g lv_font_conv) using the options my_font.c was first made
+with.
+
+  gen_fonts.py --font Montserrat-Medium.ttf --name my_font --out main/my_font.c
+      Regenerates one font, at --bpp (default 1) and optionally --compress.
+
+  gen_fonts.py --font Montserrat-Medium.ttf --name my_font --variants main/font_variants
+      Writes a variant for every bpp, and a compressed one of each with --compress, plus font_variants.h, and prints
+      the flash size of each one. Build with FONT_BENCHMARK to time their rendering on the device.
+"""
+
+import argparse
+import os
+import re
+import shutil
+import subprocess
+import sys
+
+STRINGS_RE = re.compile(r'X\(\s*(\w+)\s*,\s*(\w+)\s*,\s*"((?:[^"\\]|\\.)*)"\s*\)')
+ARRAY_RE = re.compile(r'^static (?:LV_ATTRIBUTE_LARGE_CONST )?const (\w+) (\w+)\[\]\s*=\s*\{(.*?)\};', re.S | re.M)
+ELEMENT_SIZES = {'uint8_t': 1, 'int8_t': 1, 'uint16_t': 2}
+GLYPH_DSC_SIZE = 8  # lv_font_fmt_txt_glyph_dsc_t
+CMAP_SIZE = 20  # lv_font_fmt_txt_cmap_t
+FONT_OVERHEAD = 96  # lv_font_fmt_txt_dsc_t, kerning descriptor and lv_font_t
+
+
+def collect_chars(strings_path, font_name):
+    with open(strings_path, encoding='utf-8') as f:
+        source = f.read()
+    chars = set()
+    for _, font, text in STRINGS_RE.findall(source):
+        if font == font_name:
+            chars.update(text)
+    chars.discard('\n')
+    if not chars:
+        sys.exit(f'No strings for {font_name} in {strings_path}')
+    return ''.join(sorted(chars))
+
+
+def convert(args, chars, bpp, compress, out_path):
+    cmd = [args.lv_font_conv, '--bpp', str(bpp), '--size', str(args.size), '--stride', '1', '--align', '1',
+           '--font', args.font, '--symbols', chars, '--format', 'lvgl', '-o', out_path]
+    if not compress:
+        cmd.insert(5, '--no-compress')
+    subprocess.run(cmd, check=True)
+
+
+def flash_size(path):
+    """Bytes the font's constant data takes in flash, counted from the arrays of the generated source."""
+    with open(path, encoding='utf-8') as f:
+        source = re.sub(r'/\*.*?\*/', '', f.read(), flags=re.S)
+    bitmap = 0
+    total = FONT_OVERHEAD
+    for ctype, name, body in ARRAY_RE.findall(source):
+        if ctype in ELEMENT_SIZES:
+            size = len(re.findall(r'-?(?:0x[0-9a-fA-F]+|\d+)', body)) * ELEMENT_SIZES[ctype]
+        elif ctype == 'lv_font_fmt_txt_glyph_dsc_t':
+            size = body.count('{') * GLYPH_DSC_SIZE
+        elif ctype == 'lv_font_fmt_txt_cmap_t':
+            size = body.count('.range_start') * CMAP_SIZE
+        else:
+            continue
+        if name == 'glyph_bitmap':
+            bitmap = size
+        total += size
+    return bitmap, total
+
+
+def write_variants(args, chars):
+    os.makedirs(args.variants, exist_ok=True)
+    variants = []
+    for bpp in args.bpp_list:
+        for compress in (False, True) if args.compress else (False,):
+            name = f'{args.name}_{bpp}bpp' + ('_z' if compress else '')
+            path = os.path.join(args.variants, name + '.c')
+            convert(args, chars, bpp, compress, path)
+            variants.append((name, bpp, compress, *flash_size(path)))
+
+    with open(os.path.join(args.variants, 'font_variants.h'), 'w', encoding='utf-8') as f:
+        f.write('// Generated by tools/gen_fonts.py, do not edit.\n#pragma once\n\n#include "lvgl.h"\n\n')
+        for name, *_ in variants:
+            f.write(f'LV_FONT_DECLARE({name});\n')
+        f.write('\n// X(font, bpp, compressed)\n#define FONT_VARIANTS(X) \\\n')
+        f.write(' \\\n'.join(f'    X({name}, {bpp}, {int(compress)})' for name, bpp, compress, *_ in variants))
+        f.write('\n')
+
+    print(f'{len(chars)} glyphs: {chars}')
+    print(f'{"variant":<20} {"bitmaps":>10} {"flash":>10}')
+    for name, _, _, bitmap, total in variants:
+        print(f'{name:<20} {bitmap:>10} {total:>10}')
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--strings', default=os.path.join(os.path.dirname(__file__), '..', 'main', 'ui_strings.h'))
+    parser.add_argument('--font', required=True, help='TTF to convert')
+    parser.add_argument('--name', required=True, help='Font name, as used in the UI_STRINGS table')
+    parser.add_argument('--size', type=int, default=48)
+    parser.add_argument('--bpp', type=int, default=1, choices=(1, 2, 4))
+    parser.add_argument('--compress', action='store_true', help='Needs CONFIG_LV_USE_FONT_COMPRESSED')
+    parser.add_argument('--out', help='Font source to write')
+    parser.add_argument('--variants', help='Directory to write every variant to')
+    parser.add_argument('--bpp-list', type=int, nargs='+', default=(1, 2, 4))
+    parser.add_argument('--lv-font-conv', default='lv_font_conv')
+    args = parser.parse_args()
+
+    if not args.out and not args.variants:
+        parser.error('--out or --variants is required')
+    if not shutil.which(args.lv_font_conv):
+        sys.exit(f'{args.lv_font_conv} not found, install it with npm install -g lv_font_conv')
+
+    chars = collect_chars(args.strings, args.name)
+    if args.out:
+        convert(args, chars, args.bpp, args.compress, args.out)
+        bitmap, total = flash_size(args.out)
+        print(f'{args.out}: {len(chars)} glyphs, {bitmap} bytes of bitmaps, {total} bytes of flash')
+    if args.variants:
+        write_variants(args, chars)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,239 @@
+#!/usr/bin/env python3
+"""Packs LVGL images and lv_font_conv fonts into the asset partition image read by main/assets.c.
+
+  pack_assets.py -o assets.bin --image beach=main/beach.c --font my_font=main/my_font.c \
+      --variant beach_night=main/beach.c:night
+
+Images are RGB565 C files from the LVGL image converter or tools/compress_image.py, fonts are C files from
+lv_font_conv. The layout is described in main/assets_pack.h, the structs below must match it.
+
+A variant is an uncompressed RGB565 image recolored with one of the TINTS and stored LZ4 compressed, it stands in for
+a background until there is artwork for that weather.
+"""
+
+import argparse
+import array
+import re
+import struct
+import sys
+import zlib
+
+from compress_image import lz4_block, read_image
+
+ASSETS_MAGIC = 0x54455341
+ASSETS_VERSION = 2
+NAME_SIZE = 24
+
+HEADER = struct.Struct('<IHHII')
+ENTRY = struct.Struct(f'<{NAME_SIZE}sIII')
+IMAGE = struct.Struct('<IIHHHBx')
+FONT = struct.Struct('<9IhhbbHHBBBBB5x')
+CMAP = struct.Struct('<3IHHHBx')
+
+TYPE_IMAGE, TYPE_FONT = 0, 1
+IMAGE_RGB565, IMAGE_RGB565_LZ4 = 0, 1
+KERN_NONE, KERN_CLASSES, KERN_PAIRS = 0, 1, 2
+CMAP_TYPES = {
+    'LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL': 0,
+    'LV_FONT_FMT_TXT_CMAP_SPARSE_FULL': 1,
+    'LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY': 2,
+    'LV_FONT_FMT_TXT_CMAP_SPARSE_TINY': 3,
+}
+ARRAY_TYPES = {'uint8_t': '<B', 'int8_t': '<b', 'uint16_t': '<H'}
+
+# Saturation, brightness and the red, green and blue gains of the variant tints.
+TINTS = {
+    'cloudy': (0.35, 0.85, (0.95, 0.98, 1.05)),
+    'stormy': (0.25, 0.55, (0.90, 0.95, 1.05)),
+    'cold': (0.80, 0.95, (0.80, 0.95, 1.15)),
+    'night': (0.40, 0.30, (0.70, 0.80, 1.20)),
+}
+
+
+def read_source(path):
+    with open(path, encoding='utf-8') as f:
+        return re.sub(r'/\*.*?\*/', '', f.read(), flags=re.S)
+
+
+def field(source, name):
+    match = re.search(rf'\.{name}\s*=\s*(-?\w+)', source)
+    if not match:
+        sys.exit(f'No .{name} in the source')
+    return match.group(1)
+
+
+def arrays(source):
+    """The byte and halfword arrays of a generated C file, by name, packed as they are declared."""
+    result = {}
+    for ctype, name, body in re.findall(r'(u?int(?:8|16)_t) (\w+)\[\]\s*=\s*\{(.*?)\};', source, re.S):
+        values = [int(v, 0) for v in re.findall(r'-?(?:0x[0-9a-fA-F]+|\d+)', body)]
+        result[name] = (ctype, b''.join(struct.pack(ARRAY_TYPES[ctype], v) for v in values))
+    return result
+
+
+class Record:
+    """Builds a record from a fixed header followed by 4 byte aligned arrays, offsets from the record start."""
+
+    def __init__(self, header_size):
+        self.data = bytearray(header_size)
+
+    def add(self, blob):
+        if not blob:
+            return 0
+        self.data += bytes(-len(self.data) % 4)
+        offset = len(self.data)
+        self.data += blob
+        return offset
+
+
+def pack_image(path):
+    source = read_source(path)
+    data = next(iter(arrays(source).values()))[1]
+    width = int(field(source, 'header.w'))
+    height = int(field(source, 'header.h'))
+    if field(source, 'header.cf') != 'LV_COLOR_FORMAT_RGB565':
+        sys.exit(f'{path}: only RGB565 images are supported')
+    compressed = re.search(r'\.header\.flags\s*=\s*IMAGE_LZ4_FLAG', source) is not None
+    if not compressed and len(data) != width * height * 2:
+        sys.exit(f'{path}: unexpected image size')
+
+    record = Record(IMAGE.size)
+    offset = record.add(data)
+    record.data[:IMAGE.size] = IMAGE.pack(offset, len(data), width, height, width * 2,
+                                          IMAGE_RGB565_LZ4 if compressed else IMAGE_RGB565)
+    return TYPE_IMAGE, bytes(record.data)
+
+
+def tint_rgb565(pixels, tint):
+    """Recolors little endian RGB565 pixels, moving each towards its luma by the saturation and scaling it."""
+    saturation, brightness, gains = TINTS[tint]
+    colors = {}
+    result = array.array('H')
+    for value in array.array('H', pixels):
+        color = colors.get(value)
+        if color is None:
+            rgb = ((value >> 11) * 255 / 31, (value >> 5 & 63) * 255 / 63, (value & 31) * 255 / 31)
+            luma = 0.299 * rgb[0] + 0.587 * rgb[1] + 0.114 * rgb[2]
+            r, g, b = (max(0, min(255, round((luma + (c - luma) * saturation) * brightness * gain)))
+                       for c, gain in zip(rgb, gains))
+            color = colors[value] = (r >> 3) << 11 | (g >> 2) << 5 | b >> 3
+        result.append(color)
+    return result.tobytes()
+
+
+def pack_variant(path, tint):
+    _, header, pixels = read_image(path)
+    width = int(header['w'])
+    height = int(header['h'])
+    if header.get('cf') != 'LV_COLOR_FORMAT_RGB565' or len(pixels) != width * height * 2:
+        sys.exit(f'{path}: only uncompressed RGB565 images without stride padding can be tinted')
+    data = lz4_block(tint_rgb565(pixels, tint))
+
+    record = Record(IMAGE.size)
+    offset = record.add(data)
+    record.data[:IMAGE.size] = IMAGE.pack(offset, len(data), width, height, width * 2, IMAGE_RGB565_LZ4)
+    return TYPE_IMAGE, bytes(record.data)
+
+
+def pack_font(path):
+    source = read_source(path)
+    named = arrays(source)
+    record = Record(FONT.size)
+
+    bitmap_data = named['glyph_bitmap'][1]
+    bitmap = record.add(bitmap_data)
+    glyphs = re.findall(r'\{\.bitmap_index = (\d+), \.adv_w = (\d+), \.box_w = (\d+), \.box_h = (\d+), '
+                        r'\.ofs_x = (-?\d+), \.ofs_y = (-?\d+)\}', source)
+    glyph_dsc = record.add(b''.join(struct.pack('<IBBbb', int(i) | int(a) << 20, int(w), int(h), int(x), int(y))
+                                    for i, a, w, h, x, y in glyphs))
+
+    cmaps = re.findall(r'\.range_start = (\d+), \.range_length = (\d+), \.glyph_id_start = (\d+),\s*'
+                       r'\.unicode_list = (\w+), \.glyph_id_ofs_list = (\w+), \.list_length = (\d+), \.type = (\w+)',
+                       source)
+    packed_cmaps = []
+    for start, length, glyph_start, unicode_list, ofs_list, list_length, cmap_type in cmaps:
+        unicode_offset = record.add(named[unicode_list][1]) if unicode_list != 'NULL' else 0
+        ofs_offset = record.add(named[ofs_list][1]) if ofs_list != 'NULL' else 0
+        packed_cmaps.append(CMAP.pack(int(start), unicode_offset, ofs_offset, int(length), int(glyph_start),
+                                      int(list_length), CMAP_TYPES[cmap_type]))
+    cmaps_offset = record.add(b''.join(packed_cmaps))
+
+    kern = KERN_NONE
+    kern_left = kern_right = kern_values = pair_cnt = left_cnt = right_cnt = 0
+    if 'kern_class_values' in named:
+        kern = KERN_CLASSES
+        kern_left = record.add(named['kern_left_class_mapping'][1])
+        kern_right = record.add(named['kern_right_class_mapping'][1])
+        kern_values = record.add(named['kern_class_values'][1])
+        left_cnt = int(field(source, 'left_class_cnt'))
+        right_cnt = int(field(source, 'right_class_cnt'))
+    elif 'kern_pair_values' in named:
+        kern = KERN_PAIRS
+        ctype, ids = named['kern_pair_glyph_ids']
+        kern_left = record.add(ids)
+        kern_values = record.add(named['kern_pair_values'][1])
+        pair_cnt = int(field(source, 'pair_cnt'))
+        left_cnt = 2 if ctype == 'uint16_t' else 1
+
+    record.data[:FONT.size] = FONT.pack(
+        bitmap, len(bitmap_data), glyph_dsc, len(glyphs), cmaps_offset, kern_left, kern_right, kern_values, pair_cnt,
+        int(field(source, 'line_height')), int(field(source, 'base_line')),
+        int(field(source, 'underline_position')), int(field(source, 'underline_thickness')),
+        int(field(source, 'kern_scale')) if kern else 0, len(cmaps), int(field(source, 'bpp')),
+        int(field(source, 'bitmap_format')), kern, left_cnt, right_cnt)
+    return TYPE_FONT, bytes(record.data)
+
+
+def named_path(value):
+    name, _, path = value.partition('=')
+    if not path or len(name.encode()) >= NAME_SIZE:
+        raise argparse.ArgumentTypeError(f'expected name=path with a name shorter than {NAME_SIZE} bytes')
+    return name, path
+
+
+def named_variant(value):
+    name, path = named_path(value)
+    path, _, tint = path.rpartition(':')
+    if tint not in TINTS:
+        raise argparse.ArgumentTypeError(f'expected name=path:tint with one of {", ".join(TINTS)}')
+    return name, path, tint
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('-o', '--output', required=True)
+    parser.add_argument('--image', type=named_path, action='append', default=[])
+    parser.add_argument('--font', type=named_path, action='append', default=[])
+    parser.add_argument('--variant', type=named_variant, action='append', default=[],
+                        help='name=path:tint, a tinted and LZ4 compressed copy of an RGB565 image')
+    parser.add_argument('--partition-size', type=lambda v: int(v, 0), help='Fail if the pack is larger')
+    args = parser.parse_args()
+
+    assets = [(name, *pack_image(path)) for name, path in args.image]
+    assets += [(name, *pack_variant(path, tint)) for name, path, tint in args.variant]
+    assets += [(name, *pack_font(path)) for name, path in args.font]
+
+    # Records start 4 byte aligned after the index, in argument order
+    offset = HEADER.size + ENTRY.size * len(assets)
+    index = b''
+    records = b''
+    for name, asset_type, record in assets:
+        padding = bytes(-(offset + len(records)) % 4)
+        records += padding
+        index += ENTRY.pack(name.encode(), asset_type, offset + len(records), len(record))
+        records += record
+    body = index + records
+    size = HEADER.size + len(body)
+    if args.partition_size and size > args.partition_size:
+        sys.exit(f'Assets are {size} bytes, the partition has {args.partition_size}')
+
+    with open(args.output, 'wb') as f:
+        f.write(HEADER.pack(ASSETS_MAGIC, ASSETS_VERSION, len(assets), size, zlib.crc32(body)))
+        f.write(body)
+    for name, asset_type, record in assets:
+        print(f'{name:<24} {"image" if asset_type == TYPE_IMAGE else "font":<6} {len(record):>8}')
+    print(f'{args.output}: {size} bytes')
+
+
+if __name__ == '__main__':
+    main()